@@ -273,15 +273,27 @@ def _do_generate_c_source(args):
     fuzzer_filename_c = name + '_fuzzer.c'
     fuzzer_filename_mk = name + '_fuzzer.mk'
 
-    compiled = compile_files(args.specification,
-                             args.codec)
+    specification = parse_files(args.specification)
+    c.check_options(args.codec,
+                    specification,
+                    args.open_type_views,
+                    args.lazy_open_types,
+                    args.generate_iovec_encoder)
+    compiled = compile_dict(specification, args.codec)
     header, source, fuzzer_source, fuzzer_makefile = c.generate(
         compiled,
         args.codec,
         name,
         filename_h,
         filename_c,
-        fuzzer_filename_c)
+        fuzzer_filename_c,
+        args.view_threshold,
+        args.arena_threshold,
+        args.generate_jer_encoder,
+        specification,
+        args.open_type_views,
+        args.lazy_open_types,
+        args.generate_iovec_encoder)
 
     with open(filename_h, 'w') as fout:
         fout.write(header)
@@ -392,7 +404,7 @@ def _main():
         description='Generate C source code from given ASN.1 specification.')
     subparser.add_argument(
         '-c', '--codec',
-        choices=('oer', 'uper'),
+        choices=('oer', 'per', 'uper', 'ber', 'der'),
         default='oer',
         help='Codec to generate code for (default: %(default)s).')
     subparser.add_argument(
@@ -402,6 +414,41 @@ def _main():
         '-f', '--generate-fuzzer',
         action='store_true',
         help='Also generate fuzzer source code.')
+    subparser.add_argument(
+        '--view-threshold',
+        type=int,
+        help=('Generate variable size OCTET STRINGs with a maximum size of at '
+              'least this many bytes as pointers into the encoded data instead '
+              'of inline buffers. Not supported by PER and UPER.'))
+    subparser.add_argument(
+        '--arena-threshold',
+        type=int,
+        help=('Decode variable size OCTET STRINGs and SEQUENCE OFs with a '
+              'maximum size of at least this many bytes or elements into a '
+              'caller provided arena instead of inline arrays.'))
+    subparser.add_argument(
+        '--generate-jer-encoder',
+        action='store_true',
+        help='Also generate functions encoding the types as JSON (JER).')
+    subparser.add_argument(
+        '--open-type-views',
+        action='store_true',
+        help=('Keep open type values with keys not in their object set as '
+              'views of their encodings instead of failing to decode them. '
+              'Only supported by PER and UPER.'))
+    subparser.add_argument(
+        '--lazy-open-types',
+        action='store_true',
+        help=('Keep all open type values as views of their encodings, and '
+              'generate functions decoding them when needed. Only supported '
+              'by PER and UPER.'))
+    subparser.add_argument(
+        '--generate-iovec-encoder',
+        action='store_true',
+        help=('Also generate functions encoding the types as struct iovec '
+              'segments, which reference large OCTET STRING and character '
+              'string values instead of copying them. Only supported by '
+              'OER.'))
     subparser.add_argument('specification',
                            nargs='+',
                            help='ASN.1 specification as one or more .asn files.')
@@ -473,6 +473,8 @@ class Type(BaseType):
         :param flags:
         """
         super().__init__(name, type_name)
+        self.module_name = None
+
         if number is None:
             self.tag = None
             self.tag_len = None
@@ -962,12 +964,13 @@ class Null(StandardDecodeMixin, Type):
 
 class BitString(StandardEncodeMixin, PrimitiveOrConstructedType):
 
-    def __init__(self, name, has_named_bits):
+    def __init__(self, name, has_named_bits, named_bits=None):
         super(BitString, self).__init__(name,
                                         'BIT STRING',
                                         Tag.BIT_STRING,
                                         self)
         self.has_named_bits = has_named_bits
+        self.named_bits = named_bits
 
     def is_default(self, value):
         if self.default is None:
@@ -1657,7 +1660,10 @@ class Compiler(compiler.Compiler):
             compiled = DateTime(name)
         elif type_name == 'BIT STRING':
             has_named_bits = ('named-bits' in type_descriptor)
-            compiled = BitString(name, has_named_bits)
+            compiled = BitString(name,
+                                 has_named_bits,
+                                 self.get_named_bits(type_descriptor,
+                                                     module_name))
         elif type_name == 'ANY':
             compiled = Any(name)
         elif type_name == 'ANY DEFINED BY':
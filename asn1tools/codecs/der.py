@@ -118,11 +118,12 @@ class Integer(StandardEncodeMixin, Type):
 
 class BitString(Type):
 
-    def __init__(self, name, has_named_bits):
+    def __init__(self, name, has_named_bits, named_bits=None):
         super(BitString, self).__init__(name,
                                         'BIT STRING',
                                         Tag.BIT_STRING)
         self.has_named_bits = has_named_bits
+        self.named_bits = named_bits
 
     def is_default(self, value):
         if self.default is None:
@@ -367,7 +368,10 @@ class Compiler(ber.Compiler):
             compiled = DateTime(name)
         elif type_name == 'BIT STRING':
             has_named_bits = ('named-bits' in type_descriptor)
-            compiled = BitString(name, has_named_bits)
+            compiled = BitString(name,
+                                 has_named_bits,
+                                 self.get_named_bits(type_descriptor,
+                                                     module_name))
         elif type_name == 'ANY':
             compiled = Any(name)
         elif type_name == 'ANY DEFINED BY':
@@ -1,9 +1,15 @@
 import time
 
 from ...version import __version__
+from ...errors import Error
+from . import ber
 from . import oer
+from . import per
 from . import uper
 from .utils import camel_to_snake_case
+from .utils import get_object_identifier_values
+from .utils import get_open_types
+from .utils import has_open_types
 
 
 HEADER_FMT = '''\
@@ -40,10 +46,7 @@ HEADER_FMT = '''\
 #ifndef {include_guard}
 #define {include_guard}
 
-#include <stdint.h>
-#include <stdbool.h>
-#include <unistd.h>
-
+{includes}
 #ifndef ENOMEM
 #    define ENOMEM 12
 #endif
@@ -68,6 +71,22 @@ HEADER_FMT = '''\
 #    define EBADENUM 503
 #endif
 
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
 {structs}
 {declarations}
 #endif
@@ -104,8 +123,7 @@ SOURCE_FMT = '''\
  * This file was generated by asn1tools version {version} {date}.
  */
 
-#include <string.h>
-
+{includes}
 #include "{header}"
 
 {helpers}
@@ -159,6 +177,16 @@ static void assert_first_encode(ssize_t res)
     }}
 }}
 
+static void assert_encoded_size(ssize_t res, ssize_t size)
+{{
+    if (res != size) {{
+        printf("Encoded size %ld does not match first encode result %ld.\\n",
+               size,
+               res);
+        __builtin_trap();
+    }}
+}}
+
 static void assert_second_decode(ssize_t res)
 {{
     if (res < 0) {{
@@ -203,7 +231,7 @@ static void assert_second_encode_data(const uint8_t *encoded_p,
     }}
 }}
 
-{tests}
+{arena}{tests}
 
 int LLVMFuzzerTestOneInput(const uint8_t *data_p, size_t size)
 {{
@@ -284,11 +312,11 @@ static void test_{name}(
     struct {name}_t decoded2;
 
     memset(&decoded, 0, sizeof(decoded));
-
+{first_arena_reset}
     res = {name}_decode(
         &decoded,
         encoded_p,
-        size);
+        size{arena_argument});
 
     if (res >= 0) {{
         res = {name}_encode(
@@ -297,23 +325,21 @@ static void test_{name}(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, {name}_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
-
+{second_arena_reset}
         res2 = {name}_decode(
             &decoded2,
             &encoded[0],
-            res);
+            res{arena_argument});
 
         assert_second_decode(res2);
-        assert_second_decode_data(&decoded,
-                                  &decoded2,
-                                  sizeof(decoded));
-
+{second_decode_data_check}
         res2 = {name}_encode(
             &encoded2[0],
             sizeof(encoded2),
-            &decoded);
+            &{second_encode_source});
 
         assert_second_encode(res, res2);
         assert_second_encode_data(&encoded[0], &encoded2[0], res);
@@ -322,22 +348,76 @@ static void test_{name}(
 '''
 
 
+SECOND_DECODE_DATA_CHECK_FMT = '''\
+        assert_second_decode_data(&decoded,
+                                  &decoded2,
+                                  sizeof(decoded));
+'''
+
+FUZZER_ARENA_FMT = '''\
+static uint8_t arena_buf[1048576];
+
+static struct {namespace}_arena_t arena = {{
+    .buf = &arena_buf[0],
+    .size = sizeof(arena_buf),
+    .pos = 0
+}};
+
+'''
+
+
 def _generate_fuzzer_source(namespace,
                             compiled,
                             date,
                             header_name,
                             source_name,
-                            fuzzer_source_name):
+                            fuzzer_source_name,
+                            view_threshold,
+                            arena_threshold,
+                            open_type_views,
+                            lazy_open_types):
     tests = []
     calls = []
 
+    # Views and arena data point into different buffers after the
+    # first and second decode, so compare the encoded data of the
+    # second decode instead.
+    if (view_threshold is None
+        and arena_threshold is None
+        and not open_type_views
+        and not lazy_open_types):
+        second_decode_data_check = SECOND_DECODE_DATA_CHECK_FMT
+        second_encode_source = 'decoded'
+    else:
+        second_decode_data_check = ''
+        second_encode_source = 'decoded2'
+
+    # Both decodes of a test need the same amount of arena memory, so
+    # the arena is reset before each of them.
+    if arena_threshold is None:
+        arena = ''
+        first_arena_reset = ''
+        second_arena_reset = ''
+        arena_argument = ''
+    else:
+        arena = FUZZER_ARENA_FMT.format(namespace=namespace)
+        first_arena_reset = '    arena.pos = 0;\n'
+        second_arena_reset = '        arena.pos = 0;\n'
+        arena_argument = ',\n        &arena'
+
     for module_name, module in sorted(compiled.modules.items()):
         for type_name in sorted(module):
             name = '{}_{}_{}'.format(namespace,
                                      camel_to_snake_case(module_name),
                                      camel_to_snake_case(type_name))
 
-            test = TEST_FMT.format(name=name)
+            test = TEST_FMT.format(
+                name=name,
+                second_decode_data_check=second_decode_data_check,
+                second_encode_source=second_encode_source,
+                first_arena_reset=first_arena_reset,
+                second_arena_reset=second_arena_reset,
+                arena_argument=arena_argument)
             tests.append(test)
 
             call = '    test_{}(data_p, size);'.format(name)
@@ -346,6 +426,7 @@ def _generate_fuzzer_source(namespace,
     source = FUZZER_SOURCE_FMT.format(version=__version__,
                                       date=date,
                                       header=header_name,
+                                      arena=arena,
                                       tests='\n'.join(tests),
                                       llvm_body='\n'.join(calls))
 
@@ -357,12 +438,47 @@ def _generate_fuzzer_source(namespace,
     return source, makefile
 
 
+def check_options(codec,
+                  specification=None,
+                  open_type_views=False,
+                  lazy_open_types=False,
+                  iovec_encoder=False):
+    """Raise an error if given parsed specification or options are not
+    supported by given codec. Called by :func:`generate()`, and before
+    compiling, as open types can not be compiled for all codecs.
+
+    """
+
+    if codec not in ['per', 'uper']:
+        if specification is not None and has_open_types(specification):
+            raise Error('Open types are only supported by PER and UPER.')
+
+        if open_type_views:
+            raise Error(
+                'Open type views are not supported by {}.'.format(codec.upper()))
+
+        if lazy_open_types:
+            raise Error(
+                'Lazy open types are not supported by {}.'.format(codec.upper()))
+
+    if codec != 'oer' and iovec_encoder:
+        raise Error(
+            'Iovec encoders are not supported by {}.'.format(codec.upper()))
+
+
 def generate(compiled,
              codec,
              namespace,
              header_name,
              source_name,
-             fuzzer_source_name):
+             fuzzer_source_name,
+             view_threshold=None,
+             arena_threshold=None,
+             jer_encoder=False,
+             specification=None,
+             open_type_views=False,
+             lazy_open_types=False,
+             iovec_encoder=False):
     """Generate C source code from given compiled specification.
 
     `namespace` is used as a prefix for all defines, data structures
@@ -377,6 +493,41 @@ def generate(compiled,
     `fuzzer_source_name` is the file name of the C source file, which
     is needed by the fuzzer makefile.
 
+    `view_threshold` is the minimum maximum size, in bytes, of
+    variable size OCTET STRINGs generated as pointer and length views
+    of the encoded data instead of inline buffers. Views are not
+    supported by PER and UPER. Give as ``None`` to never generate views.
+
+    `arena_threshold` is the minimum maximum size of variable size
+    OCTET STRINGs, in bytes, and SEQUENCE OFs, in elements, decoded
+    into a caller provided arena instead of inline arrays. All decode
+    functions take an arena argument if given. Give as ``None`` to
+    never use an arena.
+
+    `jer_encoder` also generates functions encoding the C structs as
+    JSON (JER).
+
+    `specification` is the parsed specification dictionary `compiled`
+    was compiled from. Its named OBJECT IDENTIFIER values are
+    generated as constants with precomputed encodings. PER and UPER
+    open types are dispatched on the INTEGER member selecting their
+    value in its object set, which are also found in it.
+
+    `open_type_views` keeps PER and UPER open type values with keys
+    not in their object set as views of their encodings instead of
+    failing to decode them. UPER views require an arena. Only
+    supported by PER and UPER.
+
+    `lazy_open_types` keeps all PER and UPER open type values as views
+    of their encodings, which are decoded by a generated function per
+    member when needed. UPER views require an arena. Only supported
+    by PER and UPER.
+
+    `iovec_encoder` also generates functions encoding into a list of
+    ``struct iovec`` segments, which reference large OCTET STRING and
+    character string values instead of copying them. Only supported
+    by OER.
+
     This function returns a tuple of the C header and source files as
     strings.
 
@@ -386,25 +537,86 @@ def generate(compiled,
     namespace = camel_to_snake_case(namespace)
     include_guard = '{}_H'.format(namespace.upper())
 
+    object_identifiers = []
+    open_types = {}
+
+    check_options(codec,
+                  specification,
+                  open_type_views,
+                  lazy_open_types,
+                  iovec_encoder)
+
+    if specification is not None:
+        object_identifiers = get_object_identifier_values(specification)
+
+        # Only PER and UPER support open types.
+        if codec in ['per', 'uper']:
+            open_types = get_open_types(specification)
+
     if codec == 'oer':
         structs, declarations, helpers, definitions = oer.generate(
             compiled,
-            namespace)
+            namespace,
+            view_threshold,
+            arena_threshold,
+            jer_encoder,
+            object_identifiers,
+            iovec_encoder)
     elif codec == 'uper':
         structs, declarations, helpers, definitions = uper.generate(
             compiled,
-            namespace)
+            namespace,
+            view_threshold,
+            arena_threshold,
+            jer_encoder,
+            object_identifiers,
+            open_types,
+            open_type_views,
+            lazy_open_types)
+    elif codec == 'per':
+        structs, declarations, helpers, definitions = per.generate(
+            compiled,
+            namespace,
+            view_threshold,
+            arena_threshold,
+            jer_encoder,
+            object_identifiers,
+            open_types,
+            open_type_views,
+            lazy_open_types)
+    elif codec in ['ber', 'der']:
+        structs, declarations, helpers, definitions = ber.generate(
+            compiled,
+            namespace,
+            view_threshold,
+            arena_threshold,
+            jer_encoder,
+            object_identifiers)
     else:
         raise Exception()
 
+    header_includes = ['stdint.h', 'stdbool.h', 'unistd.h']
+
+    if 'struct iovec' in declarations:
+        header_includes.append('sys/uio.h')
+
     header = HEADER_FMT.format(version=__version__,
                                date=date,
                                include_guard=include_guard,
+                               includes=''.join(['#include <{}>\n'.format(include)
+                                                 for include in header_includes]),
                                structs=structs,
                                declarations=declarations)
 
+    includes = ['string.h']
+
+    if 'snprintf(' in helpers:
+        includes.insert(0, 'stdio.h')
+
     source = SOURCE_FMT.format(version=__version__,
                                date=date,
+                               includes=''.join(['#include <{}>\n'.format(include)
+                                                 for include in includes]),
                                header=header_name,
                                helpers=helpers,
                                definitions=definitions)
@@ -415,6 +627,10 @@ def generate(compiled,
         date,
         header_name,
         source_name,
-        fuzzer_source_name)
+        fuzzer_source_name,
+        view_threshold,
+        arena_threshold,
+        open_type_views,
+        lazy_open_types)
 
     return header, source, fuzzer_source, fuzzer_makefile
@@ -0,0 +1,974 @@
+"""Basic Encoding Rules (BER) and Distinguished Encoding Rules (DER) C
+source code codec generator.
+
+"""
+from operator import itemgetter
+
+from .utils import ENCODER_AND_DECODER_STRUCTS
+from .utils import Generator
+from .utils import is_user_type
+from .utils import indent_lines
+from .utils import dedent_lines
+from .utils import canonical
+from .utils import is_object_identifier
+from .utils import OID_MAXIMUM_CONTENTS_SIZE
+from .ber_functions import functions
+from . import jer
+from ...codecs import ber
+from ...codecs import der
+
+
+INTEGER_TYPES = (ber.Integer, der.Integer)
+OCTET_STRING_TYPES = (ber.OctetString, der.OctetString)
+BIT_STRING_TYPES = (ber.BitString, der.BitString)
+SEQUENCE_OF_TYPES = (ber.SequenceOf, der.SequenceOf)
+
+# Types encoded as a constructed value around contents generated into
+# a separate function, as references to them may replace the tag.
+CONSTRUCTED_TYPES = (ber.Sequence, ber.ExplicitTag) + SEQUENCE_OF_TYPES
+
+DEFINITION_CONTENT_FMT = '''\
+static void {namespace}_{module_name_snake}_{type_name_snake}_encode_content(
+    struct encoder_t *encoder_p,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p)
+{{
+{encode_body}\
+}}
+
+static void {namespace}_{module_name_snake}_{type_name_snake}_decode_content(
+    struct decoder_t *decoder_p,
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p)
+{{
+{decode_body}\
+}}
+
+static void {namespace}_{module_name_snake}_{type_name_snake}_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p)
+{{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    {namespace}_{module_name_snake}_{type_name_snake}_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, {tag}, start);
+}}
+
+static void {namespace}_{module_name_snake}_{type_name_snake}_decode_inner(
+    struct decoder_t *decoder_p,
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p)
+{{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, {tag});
+    {namespace}_{module_name_snake}_{type_name_snake}_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}}
+'''
+
+
+def get_integer_length(value):
+    """Returns the number of bytes of given value in minimal two's
+    complement form.
+
+    """
+
+    return (8 + (value + (value < 0)).bit_length()) // 8
+
+
+def get_length_length(length):
+    if length < 128:
+        return 1
+    else:
+        return 1 + (length.bit_length() + 7) // 8
+
+
+def get_tlv_size(tag, length):
+    return len(tag) + get_length_length(length) + length
+
+
+def format_unused_parameters(lines, parameters):
+    return [
+        '(void){};'.format(parameter)
+        for parameter in parameters
+        if not any([parameter in line for line in lines])
+    ] + lines
+
+
+def format_length_check(length, checker):
+    if checker.minimum == checker.maximum:
+        condition = '{} != {}u'.format(length, checker.maximum)
+    else:
+        condition = '{} > {}u'.format(length, checker.maximum)
+
+    return [
+        'if ({}) {{'.format(condition),
+        '    decoder_abort(decoder_p, EBADLENGTH);',
+        '',
+        '    return;',
+        '}',
+        ''
+    ]
+
+
+class _Generator(Generator):
+
+    def format_tag(self, type_):
+        if len(type_.tag) > 4:
+            raise self.error('Tags of more than four bytes are not supported.')
+
+        return '0x{}u'.format(bytes(type_.tag).hex())
+
+    def get_tags(self, type_):
+        if type_.tag is not None:
+            return [self.format_tag(type_)]
+        elif isinstance(type_, ber.Choice):
+            tags = []
+
+            for member in type_.members:
+                tags += self.get_tags(member)
+
+            return tags
+        else:
+            raise self.error(
+                "Unsupported type '{}'.".format(type_.type_name))
+
+    def get_present_condition(self, type_):
+        conditions = [
+            'decoder_peek_tag(decoder_p) == {}'.format(tag)
+            for tag in self.get_tags(type_)
+        ]
+
+        if len(conditions) == 1:
+            return conditions[0]
+
+        return ' || '.join(['({})'.format(condition) for condition in conditions])
+
+    def get_enumerated_values(self, type_):
+        return sorted([(canonical(data), value)
+                       for data, value in type_.data_to_value.items()],
+                      key=itemgetter(1))
+
+    def get_enumerated_names(self, type_):
+        return list(type_.data_to_value.items())
+
+    def get_choice_members(self, type_):
+        return type_.members
+
+    def format_default(self, type_):
+        if isinstance(type_, ber.Boolean):
+            return str(type_.default).lower()
+        elif isinstance(type_, ber.Enumerated):
+            return self.format_default_enumerated(type_)
+        else:
+            return str(type_.default)
+
+    def format_type(self, type_, checker):
+        if isinstance(type_, INTEGER_TYPES):
+            return self.format_integer(checker)
+        elif isinstance(type_, ber.Boolean):
+            return self.format_boolean()
+        elif isinstance(type_, ber.Real):
+            return ['double']
+        elif isinstance(type_, ber.Null):
+            return []
+        elif self.is_recursive_user_type(type_):
+            raise self.error('Recursive types are not supported.')
+        elif is_user_type(type_):
+            return self.format_user_type(type_.type_name,
+                                         type_.module_name)
+        elif isinstance(type_, ber.ExplicitTag):
+            return self.format_type(type_.inner, checker)
+        elif isinstance(type_, OCTET_STRING_TYPES):
+            return self.format_octet_string(checker)
+        elif isinstance(type_, ber.Sequence):
+            return self.format_sequence(type_, checker)
+        elif isinstance(type_, ber.Choice):
+            return self.format_choice(type_, checker)
+        elif isinstance(type_, SEQUENCE_OF_TYPES):
+            return self.format_sequence_of(type_, checker)
+        elif isinstance(type_, ber.Enumerated):
+            return self.format_enumerated(type_)
+        elif isinstance(type_, BIT_STRING_TYPES):
+            return self.format_bit_string(type_, checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier(type_)
+        else:
+            raise self.error(
+                "Unsupported type '{}'.".format(type_.type_name))
+
+    def format_sequence(self, type_, checker):
+        if type_.additions is not None:
+            if any([isinstance(addition, list) for addition in type_.additions]):
+                raise self.error('Extension addition groups are not supported.')
+
+        return super(_Generator, self).format_sequence(type_, checker)
+
+    def format_bit_string(self, type_, checker):
+        if self.is_bit_string_buffer(checker):
+            raise self.error(
+                'BIT STRING must have a fixed size of at most 64 bits.')
+
+        return super(_Generator, self).format_bit_string(type_, checker)
+
+    def generate_type_declaration_process(self, type_, checker):
+        if isinstance(type_, INTEGER_TYPES):
+            lines = self.format_integer(checker)
+            lines[0] += ' value;'
+        elif isinstance(type_, ber.Boolean):
+            lines = self.format_boolean()
+            lines[0] += ' value;'
+        elif isinstance(type_, ber.Real):
+            lines = ['double value;']
+        elif isinstance(type_, ber.Enumerated):
+            lines = self.format_enumerated(type_)
+            lines[0] += ' value;'
+        elif isinstance(type_, ber.Sequence):
+            lines = self.format_sequence(type_, checker)[1:-1]
+            lines = dedent_lines(lines)
+        elif isinstance(type_, SEQUENCE_OF_TYPES):
+            lines = self.format_sequence_of(type_, checker)[1:-1]
+            lines = dedent_lines(lines)
+        elif isinstance(type_, ber.Choice):
+            lines = self.format_choice(type_, checker)
+            lines = dedent_lines(lines[1:-1])
+        elif isinstance(type_, OCTET_STRING_TYPES):
+            lines = self.format_octet_string(checker)[1:-1]
+            lines = dedent_lines(lines)
+        elif isinstance(type_, BIT_STRING_TYPES):
+            lines = self.format_bit_string(type_, checker)
+            lines[0] += ' value;'
+        elif is_object_identifier(type_):
+            lines = self.format_object_identifier(type_)
+            lines[0] += ' value;'
+        elif isinstance(type_, ber.ExplicitTag):
+            lines = self.generate_type_declaration_process(type_.inner, checker)
+        elif isinstance(type_, ber.Null):
+            lines = []
+        else:
+            raise self.error(
+                "Unsupported type '{}'.".format(type_.type_name))
+
+        return lines
+
+    def format_constructed_inner(self, type_, encode_lines, decode_lines):
+        """Encode given contents backwards and then prepend the tag and
+        length, and decode given contents within the length of the
+        constructed value.
+
+        """
+
+        tag = self.format_tag(type_)
+        unique_start = self.add_unique_encode_variable('ssize_t {};', 'start')
+        unique_outer_size = self.add_unique_decode_variable('ssize_t {};',
+                                                            'outer_size')
+        encode_lines = [
+            '{} = encoder_p->pos;'.format(unique_start)
+        ] + encode_lines + [
+            'encoder_prepend_tag_length(encoder_p, {}, {});'.format(tag,
+                                                                    unique_start)
+        ]
+        decode_lines = [
+            '{} = decoder_enter(decoder_p, {});'.format(unique_outer_size, tag)
+        ] + decode_lines + [
+            'decoder_leave(decoder_p, {});'.format(unique_outer_size)
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_integer_inner(self, type_, checker):
+        type_name = self.format_type_name(checker.minimum, checker.maximum)
+
+        if checker.minimum >= 0:
+            function = 'unsigned_integer'
+        else:
+            function = 'integer'
+
+        if type_name in ['int64_t', 'uint64_t']:
+            cast = ''
+        else:
+            cast = '({})'.format(type_name)
+
+        return (
+            [
+                'encoder_prepend_{}(encoder_p, {}, src_p->{});'.format(
+                    function,
+                    self.format_tag(type_),
+                    self.location_inner())
+            ],
+            [
+                'dst_p->{} = {}decoder_read_{}(decoder_p, {});'.format(
+                    self.location_inner(),
+                    cast,
+                    function,
+                    self.format_tag(type_))
+            ]
+        )
+
+    def format_boolean_inner(self, type_):
+        return (
+            [
+                'encoder_prepend_bool(encoder_p, {}, src_p->{});'.format(
+                    self.format_tag(type_),
+                    self.location_inner())
+            ],
+            [
+                'dst_p->{} = decoder_read_bool(decoder_p, {});'.format(
+                    self.location_inner(),
+                    self.format_tag(type_))
+            ]
+        )
+
+    def format_real_inner(self, type_):
+        return (
+            [
+                'encoder_prepend_real(encoder_p, {}, src_p->{});'.format(
+                    self.format_tag(type_),
+                    self.location_inner())
+            ],
+            [
+                'dst_p->{} = decoder_read_real(decoder_p, {});'.format(
+                    self.location_inner(),
+                    self.format_tag(type_))
+            ]
+        )
+
+    def format_null_inner(self, type_):
+        return (
+            [
+                'encoder_prepend_null(encoder_p, {});'.format(
+                    self.format_tag(type_))
+            ],
+            [
+                'decoder_read_null(decoder_p, {});'.format(
+                    self.format_tag(type_))
+            ]
+        )
+
+    def format_object_identifier_inner(self, type_):
+        location = '{}.'.format(self.location_inner())
+        tag = self.format_tag(type_)
+
+        return (
+            [
+                'encoder_prepend_oid(encoder_p,',
+                '                    {},'.format(tag),
+                '                    &src_p->{}arcs[0],'.format(location),
+                '                    src_p->{}length);'.format(location)
+            ],
+            [
+                'decoder_read_oid(decoder_p,',
+                '                 {},'.format(tag),
+                '                 &dst_p->{}arcs[0],'.format(location),
+                '                 &dst_p->{}length);'.format(location)
+            ]
+        )
+
+    def format_octet_string_inner(self, type_, checker):
+        location = self.location_inner('', '.')
+        tag = self.format_tag(type_)
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+
+        if self.is_octet_string_pointer(checker):
+            buf = 'src_p->{}buf'.format(location)
+        else:
+            buf = '&src_p->{}buf[0]'.format(location)
+
+        if checker.minimum == checker.maximum:
+            length = '{}u'.format(checker.maximum)
+        else:
+            length = 'src_p->{}length'.format(location)
+
+        encode_lines = [
+            'encoder_prepend_octet_string(encoder_p,',
+            '                             {},'.format(tag),
+            '                             {},'.format(buf),
+            '                             {});'.format(length)
+        ]
+        decode_lines = [
+            '{} = decoder_read_tag_length(decoder_p, {});'.format(
+                unique_length,
+                tag),
+            ''
+        ] + format_length_check(unique_length, checker)
+
+        if checker.minimum != checker.maximum:
+            if checker.maximum < 256 and not self.is_octet_string_pointer(checker):
+                cast = '(uint8_t)'
+            else:
+                cast = ''
+
+            decode_lines.append('dst_p->{}length = {}{};'.format(location,
+                                                                 cast,
+                                                                 unique_length))
+
+        if self.is_octet_string_pointer(checker):
+            if self.is_octet_string_view(checker):
+                read_function = 'decoder_read_bytes_view'
+            else:
+                read_function = 'decoder_read_bytes_arena'
+
+            read_prefix = 'dst_p->{}buf = {}('.format(location, read_function)
+            decode_lines += [
+                '{}decoder_p,'.format(read_prefix),
+                '{}{});'.format(' ' * len(read_prefix), unique_length)
+            ]
+        else:
+            decode_lines += [
+                'decoder_read_bytes(decoder_p,',
+                '                   &dst_p->{}buf[0],'.format(location),
+                '                   {});'.format(unique_length)
+            ]
+
+        return encode_lines, decode_lines
+
+    def format_bit_string_inner(self, type_, checker):
+        number_of_bits = checker.minimum
+        max_value = 2 ** number_of_bits - 1
+        type_name = self.format_type_name(max_value, max_value)
+        tag = self.format_tag(type_)
+
+        # Named bits are numbered from the most significant bit of the
+        # C type, which may be wider than the BIT STRING.
+        shift = 8 * self.value_length(max_value) - number_of_bits
+
+        if shift == 0:
+            encode_value = '(uint64_t)src_p->{}'.format(self.location_inner())
+            decode_value = '({})decoder_read_bit_string(decoder_p, {}, {})'.format(
+                type_name,
+                tag,
+                number_of_bits)
+        else:
+            encode_value = '(uint64_t)src_p->{} >> {}'.format(
+                self.location_inner(),
+                shift)
+            decode_value = ('({})(decoder_read_bit_string(decoder_p, {}, {}) '
+                            '<< {})'.format(type_name,
+                                            tag,
+                                            number_of_bits,
+                                            shift))
+
+        return (
+            [
+                'encoder_prepend_bit_string(encoder_p,',
+                '                           {},'.format(tag),
+                '                           {},'.format(encode_value),
+                '                           {});'.format(number_of_bits)
+            ],
+            [
+                'dst_p->{} = {};'.format(self.location_inner(), decode_value)
+            ]
+        )
+
+    def format_enumerated_inner(self, type_, type_name):
+        unique_enum_value = self.add_unique_decode_variable('int64_t {};',
+                                                            'enum_value')
+        tag = self.format_tag(type_)
+        encode_lines = [
+            'encoder_prepend_integer(encoder_p, {}, (int64_t)src_p->{});'.format(
+                tag,
+                self.location_inner())
+        ]
+        decode_lines = [
+            '{} = decoder_read_integer(decoder_p, {});'.format(
+                unique_enum_value,
+                tag),
+            '',
+            'switch ({}) {{'.format(unique_enum_value),
+            ''
+        ]
+
+        for value in sorted(type_.value_to_data):
+            decode_lines.append('case {}:'.format(value))
+
+        decode_lines += [
+            '    dst_p->{} = (enum {}){};'.format(self.location_inner(),
+                                                  type_name,
+                                                  unique_enum_value),
+            '    break;',
+            '',
+            'default:',
+            '    decoder_abort(decoder_p, EBADENUM);',
+            '    break;',
+            '}'
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_sequence_inner(self, type_, checker):
+        encode_lines = []
+        decode_lines = []
+        default_condition_by_member_name = {}
+
+        for member in type_.root_members:
+            if isinstance(member, ber.ExplicitTag) and member.has_default():
+                raise self.error(
+                    'DEFAULT on explicitly tagged members is not supported.')
+
+            condition = self.get_present_condition(member)
+
+            if member.optional:
+                decode_lines += [
+                    '',
+                    'dst_p->{}is_{}_present = ({});'.format(
+                        self.location_inner('', '.'),
+                        canonical(member.name),
+                        condition)
+                ]
+            elif member.default is not None:
+                default_condition_by_member_name[member.name] = condition
+
+            (member_encode_lines,
+             member_decode_lines) = self.format_sequence_inner_member(
+                 member,
+                 checker,
+                 default_condition_by_member_name)
+
+            # Members are encoded backwards.
+            encode_lines = member_encode_lines + encode_lines
+            decode_lines += member_decode_lines
+
+        if type_.additions is not None:
+            for addition in type_.additions:
+                is_present = '{}is_{}_addition_present'.format(
+                    self.location_inner('', '.'),
+                    addition.name)
+
+                (addition_encode_lines,
+                 addition_decode_lines) = self.format_sequence_inner_member(
+                     addition,
+                     checker,
+                     None,
+                     skip_when_not_present=False)
+
+                encode_lines = [
+                    '',
+                    'if (src_p->{}) {{'.format(is_present)
+                ] + indent_lines(addition_encode_lines) + [
+                    '}',
+                    ''
+                ] + encode_lines
+                decode_lines += [
+                    '',
+                    'dst_p->{} = ({});'.format(
+                        is_present,
+                        self.get_present_condition(addition)),
+                    '',
+                    'if (dst_p->{}) {{'.format(is_present)
+                ] + indent_lines(addition_decode_lines) + [
+                    '}',
+                    ''
+                ]
+
+            # Skip any additions unknown to this version of the type.
+            decode_lines += [
+                '',
+                'decoder_skip_additions(decoder_p);'
+            ]
+
+        return encode_lines, decode_lines
+
+    def format_sequence_of_inner(self, type_, checker):
+        unique_i = self.add_unique_variable(
+            '{} {{}};'.format(self.format_type_name(0, checker.maximum)),
+            'i')
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+
+        with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
+            element_encode_lines, element_decode_lines = self.format_type_inner(
+                type_.element_type,
+                checker.element_type)
+
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            number_of_elements = '{}u'.format(checker.maximum)
+            length_lines = []
+        else:
+            number_of_elements = 'src_p->{}length'.format(location)
+
+            if checker.maximum < 256 and not self.is_sequence_of_arena(checker):
+                cast = '(uint8_t)'
+            else:
+                cast = ''
+
+            length_lines = [
+                'dst_p->{}length = {}{};'.format(location, cast, unique_length),
+                ''
+            ]
+
+        # Elements are encoded backwards.
+        encode_lines = [
+            '{} = {};'.format(unique_i, number_of_elements),
+            '',
+            'while ({} > 0u) {{'.format(unique_i),
+            '    {}--;'.format(unique_i)
+        ] + indent_lines(element_encode_lines) + [
+            '}',
+            ''
+        ]
+        decode_lines = [
+            '{} = decoder_count_elements(decoder_p);'.format(unique_length),
+            ''
+        ] + format_length_check(unique_length, checker) + length_lines
+        decode_lines += self.format_sequence_of_arena_alloc(checker)
+        decode_lines += [
+            'for ({ui} = 0; {ui} < {length}; {ui}++) {{'.format(
+                ui=unique_i,
+                length=unique_length)
+        ] + indent_lines(element_decode_lines) + [
+            '}',
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_choice_inner(self, type_, checker):
+        encode_lines = []
+        decode_lines = []
+        choice = '{}choice'.format(self.location_inner('', '.'))
+
+        for member in type_.members:
+            member_checker = self.get_member_checker(checker,
+                                                     member.name)
+
+            with self.asn1_members_backtrace_push(canonical(member.name)):
+                with self.c_members_backtrace_push('value'):
+                    with self.c_members_backtrace_push(canonical(member.name)):
+                        choice_encode_lines, choice_decode_lines = self.format_type_inner(
+                            member,
+                            member_checker)
+
+            encode_lines += [
+                'case {}_choice_{}_e:'.format(self.location, canonical(member.name))
+            ] + indent_lines(choice_encode_lines + ['break;']) + [
+                ''
+            ]
+
+            choice_decode_lines = [
+                'dst_p->{} = {}_choice_{}_e;'.format(choice,
+                                                     self.location,
+                                                     canonical(member.name))
+            ] + choice_decode_lines + [
+                'break;'
+            ]
+            decode_lines += [
+                'case {}:'.format(tag) for tag in self.get_tags(member)
+            ] + indent_lines(choice_decode_lines) + [
+                ''
+            ]
+
+        encode_lines = [
+            '',
+            'switch (src_p->{}) {{'.format(choice),
+            ''
+        ] + encode_lines + [
+            'default:',
+            '    encoder_abort(encoder_p, EBADCHOICE);',
+            '    break;',
+            '}',
+            ''
+        ]
+
+        decode_lines = [
+            '',
+            'switch (decoder_peek_tag(decoder_p)) {',
+            ''
+        ] + decode_lines + [
+            'default:',
+            '    decoder_abort(decoder_p, EBADCHOICE);',
+            '    break;',
+            '}',
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_user_type_inner(self, type_, checker):
+        prefix = self.get_user_type_prefix(type_.type_name, type_.module_name)
+
+        if isinstance(type_, ber.Choice):
+            return (
+                [
+                    '{}_encode_inner(encoder_p, &src_p->{});'.format(
+                        prefix,
+                        self.location_inner())
+                ],
+                [
+                    '{}_decode_inner(decoder_p, &dst_p->{});'.format(
+                        prefix,
+                        self.location_inner())
+                ]
+            )
+        elif isinstance(type_, CONSTRUCTED_TYPES):
+            # The referenced type may be implicitly tagged with another
+            # tag, so only its contents are generated by the type.
+            return self.format_constructed_inner(
+                type_,
+                [
+                    '{}_encode_content(encoder_p, &src_p->{});'.format(
+                        prefix,
+                        self.location_inner())
+                ],
+                [
+                    '{}_decode_content(decoder_p, &dst_p->{});'.format(
+                        prefix,
+                        self.location_inner())
+                ])
+        elif isinstance(type_, ber.Enumerated):
+            with self.c_members_backtrace_push('value'):
+                return self.format_enumerated_inner(type_, '{}_e'.format(prefix))
+        elif isinstance(type_, BIT_STRING_TYPES):
+            with self.c_members_backtrace_push('value'):
+                return self.format_bit_string_inner(type_, checker)
+        elif is_object_identifier(type_):
+            with self.c_members_backtrace_push('value'):
+                return self.format_object_identifier_inner(type_)
+        else:
+            return self.format_type_value_inner(type_, checker)
+
+    def format_type_inner(self, type_, checker):
+        if self.is_recursive_user_type(type_):
+            raise self.error('Recursive types are not supported.')
+        elif isinstance(type_, (ber.Boolean, ber.Real, ber.Null) + INTEGER_TYPES):
+            return self.format_type_value_inner(type_, checker)
+        elif is_user_type(type_):
+            return self.format_user_type_inner(type_, checker)
+        elif isinstance(type_, ber.ExplicitTag):
+            return self.format_constructed_inner(
+                type_,
+                *self.format_type_inner(type_.inner, checker))
+        else:
+            return self.format_type_value_inner(type_, checker)
+
+    def format_type_value_inner(self, type_, checker):
+        """Encode and decode given type as defined by its class, with its
+        own tag.
+
+        """
+
+        if isinstance(type_, INTEGER_TYPES):
+            return self.format_integer_inner(type_, checker)
+        elif isinstance(type_, ber.Boolean):
+            return self.format_boolean_inner(type_)
+        elif isinstance(type_, ber.Real):
+            return self.format_real_inner(type_)
+        elif isinstance(type_, ber.Null):
+            return self.format_null_inner(type_)
+        elif isinstance(type_, OCTET_STRING_TYPES):
+            return self.format_octet_string_inner(type_, checker)
+        elif isinstance(type_, BIT_STRING_TYPES):
+            return self.format_bit_string_inner(type_, checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier_inner(type_)
+        elif isinstance(type_, ber.Enumerated):
+            return self.format_enumerated_inner(type_,
+                                                '{}_e'.format(self.location))
+        elif isinstance(type_, CONSTRUCTED_TYPES):
+            return self.format_constructed_inner(
+                type_,
+                *self.format_type_content_inner(type_, checker))
+        elif isinstance(type_, ber.Choice):
+            return self.format_choice_inner(type_, checker)
+        else:
+            raise self.error(
+                "Unsupported type '{}'.".format(type_.type_name))
+
+    def format_type_content_inner(self, type_, checker):
+        if isinstance(type_, ber.Sequence):
+            return self.format_sequence_inner(type_, checker)
+        elif isinstance(type_, SEQUENCE_OF_TYPES):
+            return self.format_sequence_of_inner(type_, checker)
+        else:
+            return self.format_type_value_inner(type_.inner, checker)
+
+    def generate_definition_inner_process(self, type_, checker):
+        if isinstance(type_, CONSTRUCTED_TYPES):
+            encode_lines, decode_lines = self.format_type_content_inner(type_,
+                                                                        checker)
+        else:
+            encode_lines, decode_lines = self.format_type_value_inner(type_,
+                                                                      checker)
+
+        return (
+            format_unused_parameters(encode_lines, ['encoder_p', 'src_p']),
+            format_unused_parameters(decode_lines, ['decoder_p', 'dst_p'])
+        )
+
+    def generate_decode_fields_inner_process(self, type_, checker):
+        _, decode_lines = self.format_constructed_inner(
+            type_,
+            [],
+            self.format_type_content_inner(type_, checker)[1])
+
+        return format_unused_parameters(decode_lines, ['dst_p'])
+
+    def format_definition_inner(self, type_, encode_body, decode_body):
+        if not isinstance(type_, CONSTRUCTED_TYPES):
+            return super(_Generator, self).format_definition_inner(type_,
+                                                                   encode_body,
+                                                                   decode_body)
+
+        return DEFINITION_CONTENT_FMT.format(
+            namespace=self.namespace,
+            module_name_snake=self.module_name_snake,
+            type_name_snake=self.type_name_snake,
+            encode_body=encode_body,
+            decode_body=decode_body,
+            tag=self.format_tag(type_))
+
+    def get_maximum_encoded_size(self, type_, checker):
+        if isinstance(type_, ber.Choice):
+            return self.get_maximum_encoded_choice_size(type_, checker)
+        elif isinstance(type_, ber.ExplicitTag):
+            size = self.get_maximum_encoded_size(type_.inner, checker)
+        else:
+            size = self.get_maximum_encoded_contents_size(type_, checker)
+
+        if size is None:
+            return None
+
+        return get_tlv_size(type_.tag, size)
+
+    def get_maximum_encoded_contents_size(self, type_, checker):
+        if isinstance(type_, INTEGER_TYPES):
+            return max(get_integer_length(checker.minimum),
+                       get_integer_length(checker.maximum))
+        elif isinstance(type_, ber.Boolean):
+            return 1
+        elif isinstance(type_, ber.Real):
+            # Control octet, two exponent octets and a 53 bits mantissa.
+            return 10
+        elif isinstance(type_, ber.Null):
+            return 0
+        elif isinstance(type_, OCTET_STRING_TYPES):
+            return checker.maximum
+        elif isinstance(type_, BIT_STRING_TYPES):
+            return 1 + (checker.maximum + 7) // 8
+        elif is_object_identifier(type_):
+            return OID_MAXIMUM_CONTENTS_SIZE
+        elif isinstance(type_, ber.Enumerated):
+            return max([get_integer_length(value)
+                        for value in type_.value_to_data])
+        elif isinstance(type_, ber.Sequence):
+            return self.get_maximum_encoded_sequence_size(type_, checker)
+        elif isinstance(type_, SEQUENCE_OF_TYPES):
+            element_size = self.get_maximum_encoded_size(type_.element_type,
+                                                         checker.element_type)
+
+            if element_size is None:
+                return None
+
+            return checker.maximum * element_size
+        else:
+            return None
+
+    def get_maximum_encoded_sequence_size(self, type_, checker):
+        size = 0
+        members = list(type_.root_members)
+
+        if type_.additions is not None:
+            members += type_.additions
+
+        for member in members:
+            member_size = self.get_maximum_encoded_size(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_size is None:
+                return None
+
+            size += member_size
+
+        return size
+
+    def get_maximum_encoded_choice_size(self, type_, checker):
+        size = 0
+
+        for member in type_.members:
+            member_size = self.get_maximum_encoded_size(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_size is None:
+                return None
+
+            size = max(size, member_size)
+
+        return size
+
+    def format_type_skip(self, type_, checker):
+        """Tagged values are skipped using their length, so the type of
+        the value is not needed.
+
+        """
+
+        if type_.tag is not None:
+            return ['decoder_skip(decoder_p, {});'.format(self.format_tag(type_))]
+        elif isinstance(type_, ber.Choice):
+            return self.format_choice_skip(type_)
+        else:
+            raise self.error(
+                "Unsupported type '{}'.".format(type_.type_name))
+
+    def format_type_skip_inner(self, type_, checker):
+        return self.format_type_skip(type_, checker)
+
+    def format_choice_skip(self, type_):
+        unique_tag = self.add_unique_decode_variable('uint32_t {};', 'tag')
+
+        return [
+            '{} = decoder_peek_tag(decoder_p);'.format(unique_tag),
+            '',
+            'switch ({}) {{'.format(unique_tag),
+            ''
+        ] + [
+            'case {}:'.format(tag) for tag in self.get_tags(type_)
+        ] + [
+            '    decoder_skip(decoder_p, {});'.format(unique_tag),
+            '    break;',
+            '',
+            'default:',
+            '    decoder_abort(decoder_p, EBADCHOICE);',
+            '    break;',
+            '}'
+        ]
+
+    def is_complex_user_type(self, type_):
+        return is_user_type(type_) and \
+            not isinstance(type_, (ber.Boolean, ber.Real, ber.Null) + INTEGER_TYPES)
+
+    def is_buffer_type(self, type_):
+        return isinstance(type_, OCTET_STRING_TYPES)
+
+    def is_sequence_type(self, type_):
+        return isinstance(type_, ber.Sequence)
+
+    def generate_helpers(self, definitions):
+        helpers = []
+
+        for pattern, definition in functions:
+            is_in_helpers = any([pattern in helper for helper in helpers])
+
+            if pattern in definitions or is_in_helpers:
+                helpers.insert(0, definition)
+
+        structs = self.format_encoder_and_decoder_structs(ENCODER_AND_DECODER_STRUCTS)
+
+        return [structs] + helpers + ['']
+
+
+def generate(compiled,
+             namespace,
+             view_threshold=None,
+             arena_threshold=None,
+             jer_encoder=False,
+             object_identifiers=None):
+    generator = _Generator(namespace, view_threshold, arena_threshold)
+
+    if object_identifiers is not None:
+        generator.object_identifiers = object_identifiers
+
+    if jer_encoder:
+        generator.jer_generator = jer.Generator(generator)
+
+    return generator.generate(compiled)
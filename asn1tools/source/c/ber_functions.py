@@ -0,0 +1,918 @@
+"""Functions required by the BER and DER C code generator
+
+"""
+
+from .utils import ENCODER_ABORT
+from .utils import DECODER_ABORT
+from .utils import DECODER_ARENA_ALLOC
+from .utils import DECODER_READ_BYTES_ARENA
+from .utils import OID_ENCODE
+from .utils import OID_DECODE
+
+ENCODER_INIT = '''\
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = (ssize_t)size;
+    self_p->size_only = false;
+}\
+'''
+
+ENCODER_GET_RESULT = '''
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    ssize_t length;
+
+    if (self_p->size < 0) {
+        return (self_p->size);
+    }
+
+    length = (self_p->size - self_p->pos);
+
+    /* Encoded backwards from the end of the buffer, move to the start. */
+    if ((self_p->buf_p != NULL) && (self_p->pos > 0)) {
+        (void)memmove(&self_p->buf_p[0],
+                      &self_p->buf_p[self_p->pos],
+                      (size_t)length);
+    }
+
+    return (length);
+}\
+'''
+
+ENCODER_ALLOC = '''
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if (self_p->size_only) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos -= (ssize_t)size;
+    } else if (self_p->pos >= (ssize_t)size) {
+        self_p->pos -= (ssize_t)size;
+        pos = self_p->pos;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}\
+'''
+
+ENCODER_PREPEND_BYTES = '''
+static void encoder_prepend_bytes(struct encoder_t *self_p,
+                                  const uint8_t *buf_p,
+                                  size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}\
+'''
+
+ENCODER_PREPEND_UINT8 = '''
+static void encoder_prepend_uint8(struct encoder_t *self_p,
+                                  uint8_t value)
+{
+    encoder_prepend_bytes(self_p, &value, sizeof(value));
+}\
+'''
+
+ENCODER_PREPEND_LONG_UINT = '''
+static void encoder_prepend_long_uint(struct encoder_t *self_p,
+                                      uint64_t value,
+                                      uint8_t number_of_bytes)
+{
+    uint8_t buf[8];
+    uint8_t i;
+
+    for (i = number_of_bytes; i > 0u; i--) {
+        buf[i - 1u] = (uint8_t)value;
+        value >>= 8;
+    }
+
+    encoder_prepend_bytes(self_p, &buf[0], number_of_bytes);
+}\
+'''
+
+ENCODER_PREPEND_TAG = '''
+static void encoder_prepend_tag(struct encoder_t *self_p,
+                                uint32_t tag)
+{
+    do {
+        encoder_prepend_uint8(self_p, (uint8_t)tag);
+        tag >>= 8;
+    } while (tag != 0u);
+}\
+'''
+
+ENCODER_PREPEND_LENGTH = '''
+static void encoder_prepend_length(struct encoder_t *self_p,
+                                   uint32_t length)
+{
+    uint8_t number_of_bytes;
+
+    if (length < 128u) {
+        encoder_prepend_uint8(self_p, (uint8_t)length);
+    } else {
+        number_of_bytes = 1;
+
+        while ((number_of_bytes < 4u)
+               && ((length >> (8u * number_of_bytes)) != 0u)) {
+            number_of_bytes++;
+        }
+
+        encoder_prepend_long_uint(self_p, length, number_of_bytes);
+        encoder_prepend_uint8(self_p, (uint8_t)(0x80u | number_of_bytes));
+    }
+}\
+'''
+
+ENCODER_PREPEND_TAG_LENGTH = '''
+static void encoder_prepend_tag_length(struct encoder_t *self_p,
+                                       uint32_t tag,
+                                       ssize_t start)
+{
+    encoder_prepend_length(self_p, (uint32_t)(start - self_p->pos));
+    encoder_prepend_tag(self_p, tag);
+}\
+'''
+
+ENCODER_PREPEND_INTEGER = '''
+static void encoder_prepend_integer(struct encoder_t *self_p,
+                                    uint32_t tag,
+                                    int64_t value)
+{
+    ssize_t start;
+    uint64_t bits;
+    uint8_t number_of_bytes;
+
+    start = self_p->pos;
+    bits = (uint64_t)value;
+
+    if (value < 0) {
+        bits = ~bits;
+    }
+
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8u)
+           && ((bits >> ((8u * number_of_bytes) - 1u)) != 0u)) {
+        number_of_bytes++;
+    }
+
+    encoder_prepend_long_uint(self_p, (uint64_t)value, number_of_bytes);
+    encoder_prepend_tag_length(self_p, tag, start);
+}\
+'''
+
+ENCODER_PREPEND_UNSIGNED_INTEGER = '''
+static void encoder_prepend_unsigned_integer(struct encoder_t *self_p,
+                                             uint32_t tag,
+                                             uint64_t value)
+{
+    ssize_t start;
+    uint8_t number_of_bytes;
+
+    start = self_p->pos;
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8u)
+           && ((value >> ((8u * number_of_bytes) - 1u)) != 0u)) {
+        number_of_bytes++;
+    }
+
+    encoder_prepend_long_uint(self_p, value, number_of_bytes);
+
+    /* A leading zero byte keeps values above INT64_MAX positive. */
+    if ((value >> 63) != 0u) {
+        encoder_prepend_uint8(self_p, 0);
+    }
+
+    encoder_prepend_tag_length(self_p, tag, start);
+}\
+'''
+
+ENCODER_PREPEND_BOOL = '''
+static void encoder_prepend_bool(struct encoder_t *self_p,
+                                 uint32_t tag,
+                                 bool value)
+{
+    encoder_prepend_uint8(self_p, value ? 0xffu : 0x00u);
+    encoder_prepend_uint8(self_p, 1);
+    encoder_prepend_tag(self_p, tag);
+}\
+'''
+
+ENCODER_PREPEND_NULL = '''
+static void encoder_prepend_null(struct encoder_t *self_p,
+                                 uint32_t tag)
+{
+    encoder_prepend_uint8(self_p, 0);
+    encoder_prepend_tag(self_p, tag);
+}\
+'''
+
+ENCODER_PREPEND_REAL = '''
+static void encoder_prepend_real(struct encoder_t *self_p,
+                                 uint32_t tag,
+                                 double value)
+{
+    ssize_t start;
+    uint64_t bits;
+    uint64_t mantissa;
+    int32_t exponent;
+    uint8_t number_of_bytes;
+    uint8_t control;
+
+    start = self_p->pos;
+    (void)memcpy(&bits, &value, sizeof(bits));
+    exponent = (int32_t)((bits >> 52) & 0x7ffu);
+    mantissa = (bits & 0x000fffffffffffffull);
+
+    if (exponent == 0x7ff) {
+        if (mantissa != 0u) {
+            encoder_prepend_uint8(self_p, 0x42);
+        } else if ((bits >> 63) != 0u) {
+            encoder_prepend_uint8(self_p, 0x41);
+        } else {
+            encoder_prepend_uint8(self_p, 0x40);
+        }
+    } else if ((exponent == 0) && (mantissa == 0u)) {
+        /* Plus zero has no contents octets. */
+        if ((bits >> 63) != 0u) {
+            encoder_prepend_uint8(self_p, 0x43);
+        }
+    } else {
+        if (exponent == 0) {
+            exponent = -1074;
+        } else {
+            mantissa |= 0x0010000000000000ull;
+            exponent -= 1075;
+        }
+
+        /* DER requires an odd mantissa. */
+        while ((mantissa & 1u) == 0u) {
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        number_of_bytes = 1;
+
+        while ((mantissa >> (8u * number_of_bytes)) != 0u) {
+            number_of_bytes++;
+        }
+
+        encoder_prepend_long_uint(self_p, mantissa, number_of_bytes);
+
+        if ((exponent >= -128) && (exponent < 128)) {
+            encoder_prepend_uint8(self_p, (uint8_t)exponent);
+            control = 0x80;
+        } else {
+            encoder_prepend_long_uint(self_p, (uint64_t)(int64_t)exponent, 2);
+            control = 0x81;
+        }
+
+        if ((bits >> 63) != 0u) {
+            control |= 0x40u;
+        }
+
+        encoder_prepend_uint8(self_p, control);
+    }
+
+    encoder_prepend_tag_length(self_p, tag, start);
+}\
+'''
+
+ENCODER_PREPEND_OCTET_STRING = '''
+static void encoder_prepend_octet_string(struct encoder_t *self_p,
+                                         uint32_t tag,
+                                         const uint8_t *buf_p,
+                                         uint32_t length)
+{
+    encoder_prepend_bytes(self_p, buf_p, length);
+    encoder_prepend_length(self_p, length);
+    encoder_prepend_tag(self_p, tag);
+}\
+'''
+
+ENCODER_PREPEND_BIT_STRING = '''
+static void encoder_prepend_bit_string(struct encoder_t *self_p,
+                                       uint32_t tag,
+                                       uint64_t value,
+                                       uint8_t number_of_bits)
+{
+    uint8_t number_of_bytes;
+    uint8_t number_of_unused_bits;
+
+    number_of_bytes = (uint8_t)((number_of_bits + 7u) / 8u);
+    number_of_unused_bits = (uint8_t)((8u * number_of_bytes) - number_of_bits);
+
+    if (number_of_bits < 64u) {
+        value &= ((1ull << number_of_bits) - 1u);
+    }
+
+    encoder_prepend_long_uint(self_p,
+                              value << number_of_unused_bits,
+                              number_of_bytes);
+    encoder_prepend_uint8(self_p, number_of_unused_bits);
+    encoder_prepend_uint8(self_p, (uint8_t)(number_of_bytes + 1u));
+    encoder_prepend_tag(self_p, tag);
+}\
+'''
+
+DECODER_INIT = '''
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}\
+'''
+
+DECODER_GET_RESULT = '''
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}\
+'''
+
+DECODER_FREE = '''
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}\
+'''
+
+DECODER_READ_BYTES = '''
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}\
+'''
+
+DECODER_READ_BYTES_VIEW = '''
+static const uint8_t *decoder_read_bytes_view(struct decoder_t *self_p,
+                                              size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos < 0) {
+        return (NULL);
+    }
+
+    return (&self_p->buf_p[pos]);
+}\
+'''
+
+DECODER_READ_UINT8 = '''
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}\
+'''
+
+DECODER_READ_LONG_UINT = '''
+static uint64_t decoder_read_long_uint(struct decoder_t *self_p,
+                                       uint8_t number_of_bytes)
+{
+    uint64_t value;
+    uint8_t i;
+
+    value = 0;
+
+    for (i = 0; i < number_of_bytes; i++) {
+        value <<= 8;
+        value |= decoder_read_uint8(self_p);
+    }
+
+    return (value);
+}\
+'''
+
+DECODER_READ_TAG = '''
+static uint32_t decoder_read_tag(struct decoder_t *self_p)
+{
+    uint32_t tag;
+    uint8_t i;
+
+    tag = decoder_read_uint8(self_p);
+
+    if ((tag & 0x1fu) == 0x1fu) {
+        i = 1;
+
+        do {
+            if (i == 4u) {
+                decoder_abort(self_p, EBADTAG);
+
+                return (0);
+            }
+
+            tag <<= 8;
+            tag |= (uint32_t)decoder_read_uint8(self_p);
+            i++;
+        } while ((tag & 0x80u) == 0x80u);
+    }
+
+    return (tag);
+}\
+'''
+
+DECODER_PEEK_TAG = '''
+static uint32_t decoder_peek_tag(const struct decoder_t *self_p)
+{
+    struct decoder_t decoder;
+
+    decoder = *self_p;
+
+    return (decoder_read_tag(&decoder));
+}\
+'''
+
+DECODER_READ_LENGTH = '''
+static uint32_t decoder_read_length(struct decoder_t *self_p)
+{
+    uint32_t length;
+    uint8_t number_of_bytes;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        number_of_bytes = (uint8_t)(length & 0x7fu);
+
+        /* Indefinite lengths are not supported. */
+        if ((number_of_bytes == 0u) || (number_of_bytes > 4u)) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = (uint32_t)decoder_read_long_uint(self_p, number_of_bytes);
+    }
+
+    if ((size_t)length > (size_t)(self_p->size - self_p->pos)) {
+        decoder_abort(self_p, EOUTOFDATA);
+
+        return (0);
+    }
+
+    return (length);
+}\
+'''
+
+DECODER_READ_TAG_LENGTH = '''
+static uint32_t decoder_read_tag_length(struct decoder_t *self_p,
+                                        uint32_t tag)
+{
+    if (decoder_read_tag(self_p) != tag) {
+        decoder_abort(self_p, EBADTAG);
+
+        return (0);
+    }
+
+    return (decoder_read_length(self_p));
+}\
+'''
+
+DECODER_ENTER = '''
+static ssize_t decoder_enter(struct decoder_t *self_p,
+                             uint32_t tag)
+{
+    ssize_t size;
+    uint32_t length;
+
+    length = decoder_read_tag_length(self_p, tag);
+    size = self_p->size;
+
+    /* Limit decoding to the contents of the constructed value. */
+    if (size >= 0) {
+        self_p->size = (self_p->pos + (ssize_t)length);
+    }
+
+    return (size);
+}\
+'''
+
+DECODER_LEAVE = '''
+static void decoder_leave(struct decoder_t *self_p,
+                          ssize_t size)
+{
+    if (self_p->size < 0) {
+        return;
+    }
+
+    if (self_p->pos != self_p->size) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    self_p->size = size;
+}\
+'''
+
+DECODER_SKIP = '''
+static void decoder_skip(struct decoder_t *self_p,
+                         uint32_t tag)
+{
+    (void)decoder_free(self_p, decoder_read_tag_length(self_p, tag));
+}\
+'''
+
+DECODER_SKIP_ADDITIONS = '''
+static void decoder_skip_additions(struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        self_p->pos = self_p->size;
+    }
+}\
+'''
+
+DECODER_COUNT_ELEMENTS = '''
+static uint32_t decoder_count_elements(const struct decoder_t *self_p)
+{
+    struct decoder_t decoder;
+    uint32_t count;
+
+    decoder = *self_p;
+    count = 0;
+
+    while (decoder.pos < decoder.size) {
+        (void)decoder_read_tag(&decoder);
+        (void)decoder_free(&decoder, decoder_read_length(&decoder));
+        count++;
+    }
+
+    return (count);
+}\
+'''
+
+DECODER_READ_INTEGER = '''
+static int64_t decoder_read_integer(struct decoder_t *self_p,
+                                    uint32_t tag)
+{
+    uint32_t length;
+    uint64_t value;
+
+    length = decoder_read_tag_length(self_p, tag);
+
+    if ((length == 0u) || (length > 8u)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    value = decoder_read_long_uint(self_p, (uint8_t)length);
+
+    if ((length < 8u) && ((value & (1ull << ((8u * length) - 1u))) != 0u)) {
+        value |= (0xffffffffffffffffull << (8u * length));
+    }
+
+    return ((int64_t)value);
+}\
+'''
+
+DECODER_READ_UNSIGNED_INTEGER = '''
+static uint64_t decoder_read_unsigned_integer(struct decoder_t *self_p,
+                                              uint32_t tag)
+{
+    uint32_t length;
+
+    length = decoder_read_tag_length(self_p, tag);
+
+    if ((length == 0u) || (length > 9u)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    if (length == 9u) {
+        if (decoder_read_uint8(self_p) != 0u) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = 8;
+    }
+
+    return (decoder_read_long_uint(self_p, (uint8_t)length));
+}\
+'''
+
+DECODER_READ_BOOL = '''
+static bool decoder_read_bool(struct decoder_t *self_p,
+                              uint32_t tag)
+{
+    if (decoder_read_tag_length(self_p, tag) != 1u) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (false);
+    }
+
+    return (decoder_read_uint8(self_p) != 0u);
+}\
+'''
+
+DECODER_READ_NULL = '''
+static void decoder_read_null(struct decoder_t *self_p,
+                              uint32_t tag)
+{
+    if (decoder_read_tag_length(self_p, tag) != 0u) {
+        decoder_abort(self_p, EBADLENGTH);
+    }
+}\
+'''
+
+DECODER_READ_REAL = '''
+static double decoder_read_real(struct decoder_t *self_p,
+                                uint32_t tag)
+{
+    uint32_t length;
+    uint8_t control;
+    uint8_t number_of_bytes;
+    uint64_t mantissa;
+    uint64_t bits;
+    int32_t exponent;
+    int32_t shift;
+    double value;
+
+    length = decoder_read_tag_length(self_p, tag);
+    bits = 0;
+
+    if (length == 0u) {
+        (void)memcpy(&value, &bits, sizeof(value));
+
+        return (value);
+    }
+
+    control = decoder_read_uint8(self_p);
+
+    if ((control & 0x80u) == 0u) {
+        if ((length != 1u) || ((control & 0xfcu) != 0x40u)) {
+            /* Decimal encodings are not supported. */
+            decoder_abort(self_p, EINVAL);
+
+            return (0.0);
+        }
+
+        if (control == 0x40u) {
+            bits = 0x7ff0000000000000ull;
+        } else if (control == 0x41u) {
+            bits = 0xfff0000000000000ull;
+        } else if (control == 0x42u) {
+            bits = 0x7ff8000000000000ull;
+        } else {
+            bits = 0x8000000000000000ull;
+        }
+
+        (void)memcpy(&value, &bits, sizeof(value));
+
+        return (value);
+    }
+
+    /* Base 2, 8 or 16, and an exponent of one to three bytes. */
+    number_of_bytes = (uint8_t)((control & 0x03u) + 1u);
+
+    if (((control & 0x30u) == 0x30u)
+        || (number_of_bytes == 4u)
+        || (length < (number_of_bytes + 2u))
+        || ((length - number_of_bytes - 1u) > 8u)) {
+        decoder_abort(self_p, EINVAL);
+
+        return (0.0);
+    }
+
+    exponent = (int32_t)decoder_read_long_uint(self_p, number_of_bytes);
+
+    if ((exponent & (1 << ((8 * number_of_bytes) - 1))) != 0) {
+        exponent -= (1 << (8 * number_of_bytes));
+    }
+
+    if ((control & 0x30u) == 0x10u) {
+        exponent *= 3;
+    } else if ((control & 0x30u) == 0x20u) {
+        exponent *= 4;
+    }
+
+    exponent += (int32_t)((control >> 2) & 0x03u);
+    mantissa = decoder_read_long_uint(self_p,
+                                      (uint8_t)(length - number_of_bytes - 1u));
+
+    if (mantissa != 0u) {
+        while ((mantissa & 1u) == 0u) {
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        if ((mantissa >> 53) != 0u) {
+            decoder_abort(self_p, EINVAL);
+
+            return (0.0);
+        }
+
+        while ((mantissa & 0x0010000000000000ull) == 0u) {
+            mantissa <<= 1;
+            exponent--;
+        }
+
+        exponent += 1075;
+
+        if (exponent >= 0x7ff) {
+            decoder_abort(self_p, EINVAL);
+
+            return (0.0);
+        } else if (exponent <= 0) {
+            /* Subnormal number, must be exact. */
+            shift = (1 - exponent);
+
+            if ((shift > 52)
+                || ((mantissa & ((1ull << shift) - 1u)) != 0u)) {
+                decoder_abort(self_p, EINVAL);
+
+                return (0.0);
+            }
+
+            mantissa >>= shift;
+            exponent = 0;
+        } else {
+            mantissa &= 0x000fffffffffffffull;
+        }
+
+        bits = (((uint64_t)exponent << 52) | mantissa);
+    }
+
+    if ((control & 0x40u) != 0u) {
+        bits |= 0x8000000000000000ull;
+    }
+
+    (void)memcpy(&value, &bits, sizeof(value));
+
+    return (value);
+}\
+'''
+
+DECODER_READ_BIT_STRING = '''
+static uint64_t decoder_read_bit_string(struct decoder_t *self_p,
+                                        uint32_t tag,
+                                        uint8_t number_of_bits)
+{
+    uint8_t number_of_bytes;
+    uint8_t number_of_unused_bits;
+
+    number_of_bytes = (uint8_t)((number_of_bits + 7u) / 8u);
+    number_of_unused_bits = (uint8_t)((8u * number_of_bytes) - number_of_bits);
+
+    if (decoder_read_tag_length(self_p, tag) != (number_of_bytes + 1u)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    if (decoder_read_uint8(self_p) != number_of_unused_bits) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    return (decoder_read_long_uint(self_p, number_of_bytes)
+            >> number_of_unused_bits);
+}\
+'''
+
+ENCODER_PREPEND_OID = '''
+static void encoder_prepend_oid(struct encoder_t *self_p,
+                                uint32_t tag,
+                                const uint32_t *arcs_p,
+                                uint8_t length)
+{
+    uint8_t buf[75];
+    ssize_t size;
+
+    size = oid_encode(&buf[0], arcs_p, length);
+
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    encoder_prepend_octet_string(self_p, tag, &buf[0], (uint32_t)size);
+}\
+'''
+
+DECODER_READ_OID = '''
+static void decoder_read_oid(struct decoder_t *self_p,
+                             uint32_t tag,
+                             uint32_t *arcs_p,
+                             uint8_t *length_p)
+{
+    uint32_t size;
+    ssize_t pos;
+    int res;
+
+    size = decoder_read_tag_length(self_p, tag);
+    pos = decoder_free(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    /* Decoded directly from the encoded data. */
+    res = oid_decode(arcs_p, length_p, &self_p->buf_p[pos], size);
+
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+    }
+}\
+'''
+
+functions = [
+    ('decoder_read_oid(', DECODER_READ_OID),
+    ('oid_decode(', OID_DECODE),
+    ('decoder_read_bit_string(', DECODER_READ_BIT_STRING),
+    ('decoder_read_real(', DECODER_READ_REAL),
+    ('decoder_read_null(', DECODER_READ_NULL),
+    ('decoder_read_bool(', DECODER_READ_BOOL),
+    ('decoder_read_unsigned_integer(', DECODER_READ_UNSIGNED_INTEGER),
+    ('decoder_read_integer(', DECODER_READ_INTEGER),
+    ('decoder_count_elements(', DECODER_COUNT_ELEMENTS),
+    ('decoder_skip_additions(', DECODER_SKIP_ADDITIONS),
+    ('decoder_skip(', DECODER_SKIP),
+    ('decoder_leave(', DECODER_LEAVE),
+    ('decoder_enter(', DECODER_ENTER),
+    ('decoder_read_tag_length(', DECODER_READ_TAG_LENGTH),
+    ('decoder_read_length(', DECODER_READ_LENGTH),
+    ('decoder_peek_tag(', DECODER_PEEK_TAG),
+    ('decoder_read_tag(', DECODER_READ_TAG),
+    ('decoder_read_long_uint(', DECODER_READ_LONG_UINT),
+    ('decoder_read_uint8(', DECODER_READ_UINT8),
+    ('decoder_read_bytes_arena(', DECODER_READ_BYTES_ARENA),
+    ('decoder_read_bytes_view(', DECODER_READ_BYTES_VIEW),
+    ('decoder_read_bytes(', DECODER_READ_BYTES),
+    ('decoder_free(', DECODER_FREE),
+    ('decoder_arena_alloc(', DECODER_ARENA_ALLOC),
+    ('decoder_abort(', DECODER_ABORT),
+    ('decoder_get_result(', DECODER_GET_RESULT),
+    ('decoder_init(', DECODER_INIT),
+    ('encoder_prepend_oid(', ENCODER_PREPEND_OID),
+    ('oid_encode(', OID_ENCODE),
+    ('encoder_prepend_bit_string(', ENCODER_PREPEND_BIT_STRING),
+    ('encoder_prepend_octet_string(', ENCODER_PREPEND_OCTET_STRING),
+    ('encoder_prepend_real(', ENCODER_PREPEND_REAL),
+    ('encoder_prepend_null(', ENCODER_PREPEND_NULL),
+    ('encoder_prepend_bool(', ENCODER_PREPEND_BOOL),
+    ('encoder_prepend_unsigned_integer(', ENCODER_PREPEND_UNSIGNED_INTEGER),
+    ('encoder_prepend_integer(', ENCODER_PREPEND_INTEGER),
+    ('encoder_prepend_tag_length(', ENCODER_PREPEND_TAG_LENGTH),
+    ('encoder_prepend_length(', ENCODER_PREPEND_LENGTH),
+    ('encoder_prepend_tag(', ENCODER_PREPEND_TAG),
+    ('encoder_prepend_long_uint(', ENCODER_PREPEND_LONG_UINT),
+    ('encoder_prepend_uint8(', ENCODER_PREPEND_UINT8),
+    ('encoder_prepend_bytes(', ENCODER_PREPEND_BYTES),
+    ('encoder_alloc(', ENCODER_ALLOC),
+    ('encoder_abort(', ENCODER_ABORT),
+    ('encoder_get_result(', ENCODER_GET_RESULT),
+    ('encoder_init(', ENCODER_INIT)
+]
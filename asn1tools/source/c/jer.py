@@ -0,0 +1,994 @@
+"""JSON Encoding Rules (JER) C source code encoder generator, used
+together with any of the other C source code generators. The JSON text
+is written directly from the structs generated by the other generator.
+
+"""
+
+import json
+import re
+
+from .utils import is_user_type
+from .utils import indent_lines
+from .utils import canonical
+from .utils import camel_to_snake_case
+from .utils import is_restricted_string
+
+
+DECLARATION_FMT = '''
+/**
+ * Encode type {type_name} defined in module {module_name} as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p);
+'''
+
+DEFINITION_INNER_FMT = '''\
+static void {namespace}_{module_name_snake}_{type_name_snake}_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p)
+{{
+{encode_body}\
+}}
+'''
+
+DEFINITION_INNER_DECLARATION_FMT = '''\
+static void {namespace}_{module_name_snake}_{type_name_snake}_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p);
+'''
+
+DEFINITION_FMT = '''\
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p)
+{{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    {namespace}_{module_name_snake}_{type_name_snake}_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}}
+'''
+
+JER_ENCODER_STRUCT = '''\
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+'''
+
+JER_ENCODER_INIT = '''\
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}\
+'''
+
+JER_ENCODER_GET_RESULT = '''
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}\
+'''
+
+JER_ENCODER_ABORT = '''
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}\
+'''
+
+JER_ENCODER_ENTER = '''
+static bool jer_encoder_enter(struct jer_encoder_t *self_p,
+                              const void *value_p)
+{
+    if (value_p == NULL) {
+        jer_encoder_abort(self_p, EINVAL);
+
+        return (false);
+    }
+
+    if (self_p->remaining_depth == 0) {
+        jer_encoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}\
+'''
+
+JER_ENCODER_LEAVE = '''
+static void jer_encoder_leave(struct jer_encoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}\
+'''
+
+JER_ENCODER_ALLOC = '''
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}\
+'''
+
+JER_ENCODER_APPEND_STRING = '''
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}\
+'''
+
+JER_ENCODER_APPEND_CHAR = '''
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}\
+'''
+
+JER_ENCODER_CLOSE = '''
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}\
+'''
+
+JER_ENCODER_APPEND_UINT = '''
+static void jer_encoder_append_uint(struct jer_encoder_t *self_p,
+                                    uint64_t value)
+{
+    static const char digits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    uint8_t *buf_p;
+    uint64_t power;
+    size_t number_of_digits;
+    size_t i;
+
+    number_of_digits = 1;
+    power = 10;
+
+    while ((number_of_digits < 20) && (value >= power)) {
+        number_of_digits++;
+        power *= 10;
+    }
+
+    buf_p = jer_encoder_alloc(self_p, number_of_digits);
+
+    if (buf_p == NULL) {
+        return;
+    }
+
+    /* Two digits at a time from the end. */
+    i = number_of_digits;
+
+    while (value >= 100) {
+        i -= 2;
+        (void)memcpy(&buf_p[i], &digits[2 * (value % 100)], 2);
+        value /= 100;
+    }
+
+    if (value >= 10) {
+        (void)memcpy(&buf_p[0], &digits[2 * value], 2);
+    } else {
+        buf_p[0] = (uint8_t)('0' + value);
+    }
+}\
+'''
+
+JER_ENCODER_APPEND_INT = '''
+static void jer_encoder_append_int(struct jer_encoder_t *self_p,
+                                   int64_t value)
+{
+    if (value < 0) {
+        jer_encoder_append_char(self_p, '-');
+        jer_encoder_append_uint(self_p, 0u - (uint64_t)value);
+    } else {
+        jer_encoder_append_uint(self_p, (uint64_t)value);
+    }
+}\
+'''
+
+JER_ENCODER_APPEND_BOOL = '''
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}\
+'''
+
+JER_ENCODER_APPEND_DOUBLE = '''
+static void jer_encoder_append_double(struct jer_encoder_t *self_p,
+                                      double value)
+{
+    char buf[32];
+    int length;
+
+    /* NaN compares false to everything. */
+    if (!((value <= 0.0) || (value > 0.0))) {
+        jer_encoder_append_string(self_p, "\\"NaN\\"", 5);
+    } else if (value > 1.7976931348623157e308) {
+        jer_encoder_append_string(self_p, "\\"INF\\"", 5);
+    } else if (value < -1.7976931348623157e308) {
+        jer_encoder_append_string(self_p, "\\"-INF\\"", 6);
+    } else {
+        length = snprintf(&buf[0], sizeof(buf), "%.17g", value);
+
+        if ((length <= 0) || ((size_t)length >= sizeof(buf))) {
+            jer_encoder_abort(self_p, EINVAL);
+
+            return;
+        }
+
+        jer_encoder_append_string(self_p, &buf[0], (size_t)length);
+
+        /* Always a number with a fraction or an exponent. */
+        if (strpbrk(&buf[0], ".e") == NULL) {
+            jer_encoder_append_string(self_p, ".0", 2);
+        }
+    }
+}\
+'''
+
+JER_ENCODER_APPEND_HEX = '''
+static void jer_encoder_append_hex(struct jer_encoder_t *self_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    uint8_t *dst_p;
+    size_t i;
+
+    dst_p = jer_encoder_alloc(self_p, 2 * size + 2);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    dst_p[0] = '"';
+
+    for (i = 0; i < size; i++) {
+        dst_p[2 * i + 1] = (uint8_t)digits[buf_p[i] >> 4];
+        dst_p[2 * i + 2] = (uint8_t)digits[buf_p[i] & 0xf];
+    }
+
+    dst_p[2 * size + 1] = '"';
+}\
+'''
+
+JER_ENCODER_APPEND_QUOTED_STRING = '''
+static void jer_encoder_append_quoted_string(struct jer_encoder_t *self_p,
+                                             const char *buf_p,
+                                             size_t size)
+{
+    /* Short escapes of control characters, or 'u' for \\u00XX. */
+    static const char escapes[] = "uuuuuuuubtnufruuuuuuuuuuuuuuuuuu";
+    static const char digits[] = "0123456789abcdef";
+    uint8_t *dst_p;
+    size_t length;
+    size_t i;
+    uint8_t value;
+
+    length = size + 2;
+
+    for (i = 0; i < size; i++) {
+        value = (uint8_t)buf_p[i];
+
+        if ((value == '"') || (value == '\\\\')) {
+            length++;
+        } else if ((value < 0x20) && (escapes[value] != 'u')) {
+            length++;
+        } else if ((value < 0x20) || (value >= 0x7f)) {
+            length += 5;
+        }
+    }
+
+    dst_p = jer_encoder_alloc(self_p, length);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    *dst_p++ = '"';
+
+    for (i = 0; i < size; i++) {
+        value = (uint8_t)buf_p[i];
+
+        if ((value == '"') || (value == '\\\\')) {
+            *dst_p++ = '\\\\';
+            *dst_p++ = value;
+        } else if ((value < 0x20) && (escapes[value] != 'u')) {
+            *dst_p++ = '\\\\';
+            *dst_p++ = (uint8_t)escapes[value];
+        } else if ((value < 0x20) || (value >= 0x7f)) {
+            *dst_p++ = '\\\\';
+            *dst_p++ = 'u';
+            *dst_p++ = '0';
+            *dst_p++ = '0';
+            *dst_p++ = (uint8_t)digits[value >> 4];
+            *dst_p++ = (uint8_t)digits[value & 0xf];
+        } else {
+            *dst_p++ = value;
+        }
+    }
+
+    *dst_p = '"';
+}\
+'''
+
+JER_ENCODER_APPEND_BIT_STRING = '''
+static void jer_encoder_append_bit_string(struct jer_encoder_t *self_p,
+                                          uint64_t value,
+                                          size_t number_of_bits)
+{
+    uint8_t buf[8];
+    size_t i;
+
+    /* The value starts at the most significant bit. Unused bits in
+       the last byte are zero. */
+    if (number_of_bits < 64) {
+        value &= ~(UINT64_MAX >> number_of_bits);
+    }
+
+    for (i = 0; i < 8; i++) {
+        buf[i] = (uint8_t)(value >> (56 - 8 * i));
+    }
+
+    jer_encoder_append_hex(self_p, &buf[0], (number_of_bits + 7) / 8);
+}\
+'''
+
+JER_ENCODER_APPEND_BIT_STRING_BUFFER = '''
+static void jer_encoder_append_bit_string_buffer(struct jer_encoder_t *self_p,
+                                                 const uint8_t *buf_p,
+                                                 size_t number_of_bits)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    uint8_t *dst_p;
+    size_t size;
+    size_t i;
+    uint8_t value;
+
+    size = ((number_of_bits + 7) / 8);
+    dst_p = jer_encoder_alloc(self_p, 2 * size + 2);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    dst_p[0] = '"';
+
+    for (i = 0; i < size; i++) {
+        value = buf_p[i];
+
+        /* Unused bits in the last byte are zero. */
+        if ((8 * (i + 1)) > number_of_bits) {
+            value &= (uint8_t)(0xffu << (8 * (i + 1) - number_of_bits));
+        }
+
+        dst_p[2 * i + 1] = (uint8_t)digits[value >> 4];
+        dst_p[2 * i + 2] = (uint8_t)digits[value & 0xf];
+    }
+
+    dst_p[2 * size + 1] = '"';
+}\
+'''
+
+JER_ENCODER_APPEND_OID = '''
+static void jer_encoder_append_oid(struct jer_encoder_t *self_p,
+                                   const uint32_t *arcs_p,
+                                   uint8_t length)
+{
+    uint8_t i;
+
+    if (length > 16) {
+        jer_encoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    jer_encoder_append_char(self_p, '"');
+
+    for (i = 0; i < length; i++) {
+        if (i > 0) {
+            jer_encoder_append_char(self_p, '.');
+        }
+
+        jer_encoder_append_uint(self_p, arcs_p[i]);
+    }
+
+    jer_encoder_append_char(self_p, '"');
+}\
+'''
+
+# Patterns of functions that call other functions must be found before
+# the functions they call, as each found function is inserted first.
+functions = [
+    ('jer_encoder_append_oid(', JER_ENCODER_APPEND_OID),
+    ('jer_encoder_append_double(', JER_ENCODER_APPEND_DOUBLE),
+    ('jer_encoder_append_bit_string(', JER_ENCODER_APPEND_BIT_STRING),
+    (
+        'jer_encoder_append_bit_string_buffer(',
+        JER_ENCODER_APPEND_BIT_STRING_BUFFER
+    ),
+    ('jer_encoder_append_hex(', JER_ENCODER_APPEND_HEX),
+    (
+        'jer_encoder_append_quoted_string(',
+        JER_ENCODER_APPEND_QUOTED_STRING
+    ),
+    ('jer_encoder_append_bool(', JER_ENCODER_APPEND_BOOL),
+    ('jer_encoder_append_int(', JER_ENCODER_APPEND_INT),
+    ('jer_encoder_append_uint(', JER_ENCODER_APPEND_UINT),
+    ('jer_encoder_close(', JER_ENCODER_CLOSE),
+    ('jer_encoder_append_char(', JER_ENCODER_APPEND_CHAR),
+    ('jer_encoder_append_string(', JER_ENCODER_APPEND_STRING),
+    ('jer_encoder_alloc(', JER_ENCODER_ALLOC),
+    ('jer_encoder_leave(', JER_ENCODER_LEAVE),
+    ('jer_encoder_enter(', JER_ENCODER_ENTER),
+    ('jer_encoder_abort(', JER_ENCODER_ABORT),
+    ('jer_encoder_get_result(', JER_ENCODER_GET_RESULT),
+    ('jer_encoder_init(', JER_ENCODER_INIT)
+]
+
+
+def strip_explicit_tags(type_):
+    while type_.__class__.__name__ == 'ExplicitTag':
+        type_ = type_.inner
+
+    return type_
+
+
+APPEND_LITERAL_RE = re.compile(
+    r"^( *)jer_encoder_append_(?:char\(encoder_p, '(.)'\)"
+    r"|string\(encoder_p, \"(.*)\", \d+\));$")
+
+
+def format_string(value):
+    """Returns a C string literal and its length of given JSON text,
+    which never contains characters that need escaping in C except
+    double quotes.
+
+    """
+
+    return '"{}", {}'.format(value.replace('"', '\\"'), len(value))
+
+
+def unescape(mo):
+    if mo.group(2) is not None:
+        return mo.group(2)
+    else:
+        return mo.group(3).replace('\\"', '"')
+
+
+def merge_literal_appends(lines):
+    """Merge appends of characters and strings known when generating
+    following each other into a single append.
+
+    """
+
+    merged_lines = []
+    previous_mo = None
+
+    for line in lines:
+        mo = APPEND_LITERAL_RE.match(line)
+
+        if (mo is not None
+            and previous_mo is not None
+            and mo.group(1) == previous_mo.group(1)):
+            value = unescape(previous_mo) + unescape(mo)
+            line = '{}jer_encoder_append_string(encoder_p, {});'.format(
+                mo.group(1),
+                format_string(value))
+            mo = APPEND_LITERAL_RE.match(line)
+            merged_lines[-1] = line
+        else:
+            merged_lines.append(line)
+
+        previous_mo = mo
+
+    return merged_lines
+
+
+class Generator(object):
+    """Generates JER encode functions of all types of given generator of
+    another codec, using its struct definitions.
+
+    """
+
+    def __init__(self, generator):
+        self.generator = generator
+
+    def error(self, message):
+        return self.generator.error(message)
+
+    def location_inner(self, default='value', end=''):
+        return self.generator.location_inner(default, end)
+
+    def append_string(self, value):
+        return 'jer_encoder_append_string(encoder_p, {});'.format(
+            format_string(value))
+
+    def format_integer(self, checker):
+        if checker.minimum < 0:
+            return [
+                'jer_encoder_append_int(encoder_p, (int64_t)src_p->{});'.format(
+                    self.location_inner())
+            ]
+        else:
+            return [
+                'jer_encoder_append_uint(encoder_p, (uint64_t)src_p->{});'.format(
+                    self.location_inner())
+            ]
+
+    def format_boolean(self):
+        return [
+            'jer_encoder_append_bool(encoder_p, src_p->{});'.format(
+                self.location_inner())
+        ]
+
+    def format_real(self):
+        return [
+            'jer_encoder_append_double(encoder_p, (double)src_p->{});'.format(
+                self.location_inner())
+        ]
+
+    def format_null(self):
+        return [self.append_string('null')]
+
+    def format_octet_string(self, checker):
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            length = '{}u'.format(checker.maximum)
+        else:
+            length = 'src_p->{}length'.format(location)
+
+        return [
+            'jer_encoder_append_hex(encoder_p, src_p->{}buf, {});'.format(
+                location,
+                length)
+        ]
+
+    def format_restricted_string(self, checker):
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            length = '{}u'.format(checker.maximum)
+        else:
+            length = 'src_p->{}length'.format(location)
+
+        return [
+            'jer_encoder_append_quoted_string(encoder_p,',
+            '                                 &src_p->{}buf[0],'.format(location),
+            '                                 {});'.format(length)
+        ]
+
+    def format_object_identifier(self):
+        location = '{}.'.format(self.location_inner())
+
+        return [
+            'jer_encoder_append_oid(encoder_p,',
+            '                       &src_p->{}arcs[0],'.format(location),
+            '                       src_p->{}length);'.format(location)
+        ]
+
+    def format_bit_string(self, checker):
+        if self.generator.is_bit_string_buffer(checker):
+            return self.format_bit_string_buffer(checker)
+
+        number_of_bits = checker.minimum
+
+        if number_of_bits == 0:
+            return [self.append_string('""')]
+
+        shift = self.generator.get_bit_string_shift(checker)
+        value = '(uint64_t)src_p->{}'.format(self.location_inner())
+
+        if shift > 0:
+            value += ' << {}'.format(shift)
+
+        return [
+            'jer_encoder_append_bit_string(encoder_p, {}, {});'.format(
+                value,
+                number_of_bits)
+        ]
+
+    def format_bit_string_buffer(self, checker):
+        """Variable size BIT STRINGs are encoded as an object with the
+        value and its length in bits.
+
+        """
+
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            length = '{}u'.format(checker.maximum)
+        else:
+            length = 'src_p->{}length'.format(location)
+
+        lines = [
+            'jer_encoder_append_bit_string_buffer(encoder_p,',
+            '                                     &src_p->{}buf[0],'.format(
+                location),
+            '                                     {});'.format(length)
+        ]
+
+        if checker.minimum != checker.maximum:
+            lines = [self.append_string('{"value":')] + lines + [
+                self.append_string(',"length":'),
+                'jer_encoder_append_uint(encoder_p, (uint64_t){});'.format(length),
+                "jer_encoder_append_char(encoder_p, '}');"
+            ]
+
+        return lines
+
+    def format_enumerated(self, type_):
+        lines = [
+            '',
+            'switch (src_p->{}) {{'.format(self.location_inner()),
+            ''
+        ]
+
+        for name, _ in sorted(self.generator.get_enumerated_names(type_),
+                              key=lambda item: item[1]):
+            lines += [
+                'case {}_{}_e:'.format(self.generator.location,
+                                       canonical(name)),
+                '    ' + self.append_string(json.dumps(name)),
+                '    break;',
+                ''
+            ]
+
+        return lines + [
+            'default:',
+            '    jer_encoder_abort(encoder_p, EBADENUM);',
+            '    break;',
+            '}',
+            ''
+        ]
+
+    def format_sequence_member(self, member, checker, is_present):
+        member_checker = self.generator.get_member_checker(checker,
+                                                           member.name)
+
+        with self.generator.members_backtrace_push(canonical(member.name)):
+            lines = self.format_type(member, member_checker)
+
+        lines = [
+            self.append_string(json.dumps(member.name) + ':')
+        ] + lines + [
+            "jer_encoder_append_char(encoder_p, ',');"
+        ]
+
+        if is_present is not None:
+            lines = [
+                '',
+                'if (src_p->{}{}) {{'.format(self.location_inner('', '.'),
+                                             is_present)
+            ] + indent_lines(lines) + [
+                '}',
+                ''
+            ]
+
+        return lines
+
+    def format_sequence(self, type_, checker):
+        lines = ["jer_encoder_append_char(encoder_p, '{');"]
+
+        for member in type_.root_members:
+            if member.optional:
+                is_present = 'is_{}_present'.format(canonical(member.name))
+            else:
+                is_present = None
+
+            lines += self.format_sequence_member(member, checker, is_present)
+
+        for addition in type_.additions or []:
+            if isinstance(addition, list):
+                raise self.error('Extension addition groups are not supported '
+                                 'by the JER encoder.')
+
+            lines += self.format_sequence_member(
+                addition,
+                checker,
+                'is_{}_addition_present'.format(addition.name))
+
+        return lines + ["jer_encoder_close(encoder_p, '}');"]
+
+    def format_sequence_of(self, type_, checker):
+        unique_i = self.generator.add_unique_encode_variable(
+            '{} {{}};'.format(self.generator.format_type_name(0,
+                                                              checker.maximum)),
+            'i')
+
+        if checker.minimum == checker.maximum:
+            length = '{}u'.format(checker.maximum)
+        else:
+            length = 'src_p->{}length'.format(self.location_inner('', '.'))
+
+        with self.generator.c_members_backtrace_push(
+                'elements[{}]'.format(unique_i)):
+            lines = self.format_type(type_.element_type,
+                                     checker.element_type)
+
+        return [
+            "jer_encoder_append_char(encoder_p, '[');",
+            '',
+            'for ({ui} = 0; {ui} < {length}; {ui}++) {{'.format(
+                ui=unique_i,
+                length=length)
+        ] + indent_lines(lines + ["jer_encoder_append_char(encoder_p, ',');"]) + [
+            '}',
+            '',
+            "jer_encoder_close(encoder_p, ']');",
+            ''
+        ]
+
+    def format_choice(self, type_, checker):
+        lines = [
+            '',
+            'switch (src_p->{}choice) {{'.format(self.location_inner('', '.')),
+            ''
+        ]
+
+        for member in self.generator.get_choice_members(type_):
+            member_checker = self.generator.get_member_checker(checker,
+                                                               member.name)
+
+            with self.generator.asn1_members_backtrace_push(
+                    canonical(member.name)):
+                with self.generator.c_members_backtrace_push('value'):
+                    with self.generator.c_members_backtrace_push(
+                            canonical(member.name)):
+                        choice_lines = self.format_type(member, member_checker)
+
+            choice_lines = [
+                self.append_string('{' + json.dumps(member.name) + ':')
+            ] + choice_lines + [
+                "jer_encoder_append_char(encoder_p, '}');",
+                'break;'
+            ]
+            lines += [
+                'case {}_choice_{}_e:'.format(self.generator.location,
+                                              canonical(member.name))
+            ] + indent_lines(choice_lines) + [
+                ''
+            ]
+
+        return lines + [
+            'default:',
+            '    jer_encoder_abort(encoder_p, EBADCHOICE);',
+            '    break;',
+            '}',
+            ''
+        ]
+
+    def format_user_type(self, type_name, module_name):
+        prefix = self.generator.get_user_type_prefix(type_name, module_name)
+
+        return [
+            '{}_encode_jer_inner(encoder_p, &src_p->{});'.format(
+                prefix,
+                self.location_inner())
+        ]
+
+    def format_recursive_user_type(self, type_):
+        prefix = self.generator.get_user_type_prefix(type_.type_name,
+                                                     type_.module_name)
+        location = self.location_inner()
+
+        return [
+            '',
+            'if (jer_encoder_enter(encoder_p, src_p->{})) {{'.format(location),
+            '    {}_encode_jer_inner(encoder_p, src_p->{});'.format(prefix,
+                                                                    location),
+            '    jer_encoder_leave(encoder_p);',
+            '}',
+            ''
+        ]
+
+    def format_open_type(self, type_):
+        """Open types are encoded as their value, which type is selected
+        by the key member.
+
+        """
+
+        if self.generator.lazy_open_types:
+            raise self.error(
+                'Lazy open types are not supported by the JER encoder.')
+
+        key_member_name, alternatives = self.generator.get_open_type(type_)
+        lines = [
+            '',
+            'switch (src_p->{}) {{'.format(canonical(key_member_name)),
+            ''
+        ]
+
+        for key_values, type_name, module_name, name in alternatives:
+            with self.generator.c_members_backtrace_push(name):
+                case_lines = self.format_user_type(type_name, module_name)
+
+            lines += [
+                'case {}:'.format(key_value) for key_value in key_values
+            ] + indent_lines(case_lines + ['break;']) + [
+                ''
+            ]
+
+        return lines + [
+            'default:',
+            '    jer_encoder_abort(encoder_p, EBADCHOICE);',
+            '    break;',
+            '}',
+            ''
+        ]
+
+    def format_type(self, type_, checker, is_top_level=False):
+        inner_type = strip_explicit_tags(type_)
+
+        # Class names are the same in all codecs.
+        kind = inner_type.__class__.__name__
+
+        if kind == 'Integer':
+            return self.format_integer(checker)
+        elif kind == 'Boolean':
+            return self.format_boolean()
+        elif kind == 'Real':
+            return self.format_real()
+        elif kind == 'Null':
+            return self.format_null()
+        elif kind == 'OpenType':
+            return self.format_open_type(type_)
+        elif not is_top_level:
+            for user_type in [type_, inner_type]:
+                if self.generator.is_recursive_user_type(user_type):
+                    return self.format_recursive_user_type(user_type)
+                elif is_user_type(user_type):
+                    return self.format_user_type(user_type.type_name,
+                                                 user_type.module_name)
+
+        type_ = inner_type
+
+        if kind == 'OctetString':
+            return self.format_octet_string(checker)
+        elif is_restricted_string(type_):
+            return self.format_restricted_string(checker)
+        elif kind == 'ObjectIdentifier':
+            return self.format_object_identifier()
+        elif kind == 'BitString':
+            return self.format_bit_string(checker)
+        elif kind == 'Enumerated':
+            return self.format_enumerated(type_)
+        elif kind == 'Sequence':
+            return self.format_sequence(type_, checker)
+        elif kind == 'SequenceOf':
+            return self.format_sequence_of(type_, checker)
+        elif kind == 'Choice':
+            return self.format_choice(type_, checker)
+        else:
+            raise self.error(
+                "Unsupported type '{}'.".format(type_.type_name))
+
+    def generate_declaration(self):
+        generator = self.generator
+
+        return DECLARATION_FMT.format(namespace=generator.namespace,
+                                      module_name=generator.module_name,
+                                      type_name=generator.type_name,
+                                      module_name_snake=generator.module_name_snake,
+                                      type_name_snake=generator.type_name_snake)
+
+    def generate_definition_inner(self, compiled_type):
+        generator = self.generator
+        generator.reset_variables()
+        encode_lines = self.format_type(compiled_type.type,
+                                        compiled_type.constraints_checker.type,
+                                        True)
+        encode_lines = merge_literal_appends(encode_lines)
+
+        if not any(['src_p' in line for line in encode_lines]):
+            encode_lines = ['(void)src_p;', ''] + encode_lines
+
+        if generator.encode_variable_lines:
+            encode_lines = generator.encode_variable_lines + [''] + encode_lines
+
+        encode_lines = indent_lines(encode_lines) + ['']
+
+        return DEFINITION_INNER_FMT.format(namespace=generator.namespace,
+                                           module_name_snake=generator.module_name_snake,
+                                           type_name_snake=generator.type_name_snake,
+                                           encode_body='\n'.join(encode_lines))
+
+    def generate_definition_inner_declaration(self, type_name, module_name):
+        return DEFINITION_INNER_DECLARATION_FMT.format(
+            namespace=self.generator.namespace,
+            module_name_snake=camel_to_snake_case(module_name),
+            type_name_snake=camel_to_snake_case(type_name))
+
+    def generate_definition(self):
+        generator = self.generator
+
+        return DEFINITION_FMT.format(namespace=generator.namespace,
+                                     module_name_snake=generator.module_name_snake,
+                                     type_name_snake=generator.type_name_snake)
+
+    def generate_helpers(self, definitions):
+        helpers = []
+
+        for pattern, definition in functions:
+            is_in_helpers = any([pattern in helper for helper in helpers])
+
+            if pattern in definitions or is_in_helpers:
+                helpers.insert(0, definition)
+
+        return [JER_ENCODER_STRUCT] + helpers + ['']
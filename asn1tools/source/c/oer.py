@@ -13,10 +13,73 @@ from .utils import is_user_type
 from .utils import indent_lines
 from .utils import dedent_lines
 from .utils import canonical
+from .utils import is_restricted_string
+from .utils import is_object_identifier
+from .utils import OID_MAXIMUM_CONTENTS_SIZE
 from .oer_functions import functions
+from .oer_functions import iovec_functions
+from . import jer
 from ...codecs import oer
 
 
+IOVEC_MIN_REFERENCE_SIZE_FMT = '''\
+/**
+ * Minimum size, in bytes, of OCTET STRING and character string values
+ * referenced by the iovec encoders instead of copied into their
+ * scratch buffer.
+ */
+#ifndef {namespace_upper}_IOVEC_MIN_REFERENCE_SIZE
+#    define {namespace_upper}_IOVEC_MIN_REFERENCE_SIZE 64
+#endif
+'''
+
+IOVEC_DECLARATION_FMT = '''\
+/**
+ * Encode type {type_name} defined in module {module_name} as segments
+ * to write with writev() or sendmsg(). Large OCTET STRING and
+ * character string values are referenced in src_p instead of copied,
+ * everything else is encoded into the scratch buffer. The segments
+ * are valid as long as src_p and scratch_p are.
+ *
+ * @param[out] iov_p Segments of the encoded data.
+ * @param[in] iovcnt Number of elements in iov_p.
+ * @param[out] scratch_p Buffer to encode copied data into.
+ * @param[in] size Size of scratch_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Number of used segments or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode_iovec(
+    struct iovec *iov_p,
+    size_t iovcnt,
+    uint8_t *scratch_p,
+    size_t size,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p);
+'''
+
+IOVEC_DEFINITION_FMT = '''
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode_iovec(
+    struct iovec *iov_p,
+    size_t iovcnt,
+    uint8_t *scratch_p,
+    size_t size,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p)
+{{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, scratch_p, size);
+    encoder.iov_p = iov_p;
+    encoder.iov_size = (ssize_t)iovcnt;
+    encoder.iov_pos = 0;
+    encoder.iov_threshold = {namespace_upper}_IOVEC_MIN_REFERENCE_SIZE;
+    encoder.segment_pos = 0;
+    {namespace}_{module_name_snake}_{type_name_snake}_encode_inner(&encoder, src_p);
+
+    return (encoder_get_iovec_result(&encoder));
+}}
+'''
+
+
 def get_encoded_real_lengths(type_):
     return [4] if type_.fmt == '>f' else [8]
 
@@ -85,6 +148,17 @@ def get_sequence_additions_mask_length(additions):
     return (len(additions) + 7) // 8
 
 
+def get_minimum_uint_length(value):
+    if value < 256:
+        return 1
+    elif value < 65536:
+        return 2
+    elif value < 16777216:
+        return 3
+    else:
+        return 4
+
+
 def format_null_inner():
     return (
         [
@@ -100,9 +174,12 @@ def format_null_inner():
 
 class _Generator(Generator):
 
-    def __init__(self, namespace):
-        super(_Generator, self).__init__(namespace)
+    def __init__(self, namespace, view_threshold=None, arena_threshold=None):
+        super(_Generator, self).__init__(namespace,
+                                         view_threshold,
+                                         arena_threshold)
         self.additional_helpers = {}
+        self.iovec_encoder = False
 
     def format_real(self, type_):
         if type_.fmt is None:
@@ -131,6 +208,9 @@ class _Generator(Generator):
                        for data, value in type_.data_to_value.items()],
                       key=itemgetter(1))
 
+    def get_enumerated_names(self, type_):
+        return list(type_.data_to_value.items())
+
     def get_choice_members(self, type_):
         return type_.root_members
 
@@ -151,11 +231,17 @@ class _Generator(Generator):
             return self.format_real(type_)
         elif isinstance(type_, oer.Null):
             return []
+        elif self.is_recursive_user_type(type_):
+            return self.format_recursive_user_type(type_)
         elif is_user_type(type_):
             return self.format_user_type(type_.type_name,
                                          type_.module_name)
         elif isinstance(type_, oer.OctetString):
             return self.format_octet_string(checker)
+        elif is_restricted_string(type_):
+            return self.format_restricted_string(type_, checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier(type_)
         elif isinstance(type_, oer.Sequence):
             return self.format_sequence(type_, checker)
         elif isinstance(type_, oer.Choice):
@@ -179,8 +265,10 @@ class _Generator(Generator):
             return get_encoded_real_lengths(type_)
         elif isinstance(type_, oer.Null):
             return [0]
-        elif isinstance(type_, oer.OctetString):
+        elif isinstance(type_, oer.OctetString) or is_restricted_string(type_):
             return self.get_encoded_octet_string_lengths(type_, checker)
+        elif is_object_identifier(type_):
+            return self.get_encoded_object_identifier_lengths(type_)
         elif isinstance(type_, oer.Sequence):
             return self.get_encoded_sequence_lengths(type_, checker)
         elif isinstance(type_, oer.Choice):
@@ -189,6 +277,8 @@ class _Generator(Generator):
             return self.get_encoded_sequence_of_lengths(type_, checker)
         elif isinstance(type_, oer.Enumerated):
             return self.get_encoded_enumerated_length(type_)
+        elif isinstance(type_, oer.BitString):
+            return self.get_encoded_bit_string_lengths(type_, checker)
         else:
             raise self.error(
                 "Unsupported type '{}'.".format(type_.type_name))
@@ -218,8 +308,18 @@ class _Generator(Generator):
         elif isinstance(type_, oer.OctetString):
             lines = self.format_octet_string(checker)[1:-1]
             lines = dedent_lines(lines)
+        elif is_restricted_string(type_):
+            lines = self.format_restricted_string(type_, checker)[1:-1]
+            lines = dedent_lines(lines)
         elif isinstance(type_, oer.BitString):
             lines = self.format_bit_string(type_, checker)
+
+            if self.is_bit_string_buffer(checker):
+                lines = dedent_lines(lines[1:-1])
+            else:
+                lines[0] += ' value;'
+        elif is_object_identifier(type_):
+            lines = self.format_object_identifier(type_)
             lines[0] += ' value;'
         elif isinstance(type_, oer.Null):
             lines = []
@@ -246,6 +346,9 @@ class _Generator(Generator):
         )
 
     def format_bit_string_inner(self, checker):
+        if self.is_bit_string_buffer(checker):
+            return self.format_bit_string_buffer_inner(checker)
+
         max_value = 2**checker.minimum - 1
         type_name = self.format_type_name(max_value, max_value)
         type_length = self.value_length(max_value)
@@ -283,6 +386,57 @@ class _Generator(Generator):
 
         return encode_lines, decode_lines
 
+    def format_bit_string_buffer_inner(self, checker):
+        """Variable size BIT STRINGs are prefixed by a length determinant
+        and the number of unused bits in the last byte.
+
+        """
+
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            encode_length = '{}u'.format(checker.maximum)
+            decode_length = encode_length
+            encode_lines = []
+            decode_lines = []
+        else:
+            encode_length = 'src_p->{}length'.format(location)
+            decode_length = 'dst_p->{}length'.format(location)
+            encode_lines = [
+                'encoder_append_bit_string_length(encoder_p, {});'.format(
+                    encode_length)
+            ]
+            decode_lines = [
+                '{} = decoder_read_bit_string_length(decoder_p, {}u);'.format(
+                    decode_length,
+                    checker.maximum)
+            ]
+
+        encode_lines += [
+            'encoder_append_bit_string(encoder_p,',
+            '                          &src_p->{}buf[0],'.format(location),
+            '                          {});'.format(encode_length)
+        ]
+        decode_lines += [
+            'decoder_read_bit_string(decoder_p,',
+            '                        &dst_p->{}buf[0],'.format(location),
+            '                        {});'.format(decode_length)
+        ]
+
+        return encode_lines, decode_lines
+
+    def get_encoded_bit_string_lengths(self, type_, checker):
+        if not self.is_bit_string_buffer(checker):
+            return [self.value_length(2 ** checker.minimum - 1)]
+        elif checker.minimum == checker.maximum:
+            return [(checker.maximum + 7) // 8]
+
+        with self.members_backtrace_push(type_.name):
+            location = self.location_inner('', '.')
+            size = '((src_p->{}length + 7u) / 8u)'.format(location)
+
+            return ['length_determinant_length({} + 1u)'.format(size), 1, size]
+
     def get_encoded_integer_lengths(self, checker):
         return [self.type_length(checker.minimum, checker.maximum) // 8]
 
@@ -382,7 +536,37 @@ class _Generator(Generator):
                 else:
                     inner = '    {} |= {}u;'.format(present_mask, mask)
 
-                    if self.is_buffer_type(member):
+                    member_checker = self.get_member_checker(checker, member.name)
+
+                    if (self.is_buffer_type(member)
+                        and self.is_octet_string_pointer(member_checker)):
+                        default_variable = canonical(member.name) + '_default'
+
+                        name = '{}{}'.format(self.location_inner('', '.'),
+                                             canonical(member.name))
+                        encode_lines += [
+                            'if ((src_p->{}.length != sizeof({})) ||'.format(
+                                name,
+                                default_variable),
+                            '    (memcmp(src_p->{}.buf, {}, sizeof({})) != 0)) {{'.format(
+                                name,
+                                default_variable,
+                                default_variable),
+                            inner,
+                            '}',
+                            ''
+                        ]
+                    elif is_restricted_string(member):
+                        encode_lines += [
+                            'if ({}) {{'.format(
+                                self.format_restricted_string_default_condition(
+                                    member,
+                                    member_checker)),
+                            inner,
+                            '}',
+                            ''
+                        ]
+                    elif self.is_buffer_type(member):
                         default_variable = canonical(member.name) + '_default'
 
                         encode_lines += [
@@ -420,7 +604,20 @@ class _Generator(Generator):
             ]
             decode_lines.append('')
 
+        members = []
+
         for member in type_.root_members:
+            member_checker = self.get_fixed_layout_member_checker(member,
+                                                                  checker)
+
+            if member_checker is not None:
+                members.append((member, member_checker))
+                continue
+
+            self.append_fixed_layout_members(encode_lines,
+                                             decode_lines,
+                                             members,
+                                             checker)
             (member_encode_lines,
              member_decode_lines) = self.format_sequence_inner_member(
                  member,
@@ -430,6 +627,11 @@ class _Generator(Generator):
             encode_lines += member_encode_lines
             decode_lines += member_decode_lines
 
+        self.append_fixed_layout_members(encode_lines,
+                                         decode_lines,
+                                         members,
+                                         checker)
+
         if type_.additions is not None and len(type_.additions) > 0:
             additions_encode_lines, additions_decode_lines = (
                 self.format_sequence_additions(type_, checker))
@@ -458,6 +660,159 @@ class _Generator(Generator):
 
         return encode_lines, decode_lines
 
+    def get_fixed_layout_member_checker(self, member, checker):
+        """Returns the checker of given SEQUENCE member if it is always
+        present and is an integer, a boolean or a fixed size OCTET
+        STRING, which are encoded with a fixed size, otherwise None.
+
+        """
+
+        if member.optional or member.default is not None:
+            return None
+
+        # Field selective decoding reads members one by one.
+        if self.field_by_member_name is not None:
+            return None
+
+        member_checker = self.get_member_checker(checker, member.name)
+
+        if isinstance(member, (oer.Integer, oer.Boolean)):
+            return member_checker
+        elif is_user_type(member):
+            return None
+        elif isinstance(member, oer.OctetString):
+            if member_checker.minimum != member_checker.maximum:
+                return None
+
+            if self.is_octet_string_pointer(member_checker):
+                return None
+
+            return member_checker
+
+        return None
+
+    def append_fixed_layout_members(self,
+                                    encode_lines,
+                                    decode_lines,
+                                    members,
+                                    checker):
+        """Append consecutive fixed size members to given lines, and
+        empty the list of members.
+
+        """
+
+        if len(members) == 1:
+            (member_encode_lines,
+             member_decode_lines) = self.format_sequence_inner_member(
+                 members[0][0],
+                 checker,
+                 {})
+            encode_lines += member_encode_lines
+            decode_lines += member_decode_lines
+        elif len(members) > 1:
+            (members_encode_lines,
+             members_decode_lines) = self.format_fixed_layout_members(members)
+            encode_lines += members_encode_lines
+            decode_lines += members_decode_lines
+
+        del members[:]
+
+    def format_fixed_layout_members(self, members):
+        """All members are written and read at fixed offsets after a single
+        bounds check, instead of one check per member.
+
+        """
+
+        unique_pos = self.add_unique_variable('ssize_t {};', 'pos')
+        location = self.location_inner('', '.')
+        encode_lines = []
+        decode_lines = []
+        offset = 0
+
+        for member, member_checker in members:
+            name = '{}{}'.format(location, canonical(member.name))
+
+            if offset == 0:
+                index = unique_pos
+            else:
+                index = '{} + {}'.format(unique_pos, offset)
+
+            encoder_buf = 'encoder_p->buf_p[{}]'.format(index)
+            decoder_buf = 'decoder_p->buf_p[{}]'.format(index)
+
+            if isinstance(member, oer.Boolean):
+                size = 1
+                encode_lines.append(
+                    '{} = (src_p->{} ? 255u : 0u);'.format(encoder_buf, name))
+                decode_lines.append(
+                    'dst_p->{} = ({} != 0u);'.format(name, decoder_buf))
+            elif isinstance(member, oer.Integer):
+                type_name = self.format_type_name(member_checker.minimum,
+                                                  member_checker.maximum)
+                size = self.type_length(member_checker.minimum,
+                                        member_checker.maximum) // 8
+
+                if size == 1:
+                    encode_lines.append(
+                        '{} = (uint8_t)src_p->{};'.format(encoder_buf, name))
+
+                    value = decoder_buf
+
+                    if member_checker.minimum < 0:
+                        value = '({}){}'.format(type_name, value)
+
+                    decode_lines.append('dst_p->{} = {};'.format(name, value))
+                else:
+                    encode_lines.append(
+                        'store_uint{}(&{}, (uint{}_t)src_p->{});'.format(
+                            8 * size,
+                            encoder_buf,
+                            8 * size,
+                            name))
+                    value = 'load_uint{}(&{})'.format(8 * size, decoder_buf)
+
+                    if member_checker.minimum < 0:
+                        value = '({}){}'.format(type_name, value)
+
+                    decode_lines.append('dst_p->{} = {};'.format(name, value))
+            else:
+                size = member_checker.maximum
+
+                if size > 0:
+                    encode_lines += [
+                        '(void)memcpy(&{},'.format(encoder_buf),
+                        '             &src_p->{}.buf[0],'.format(name),
+                        '             {});'.format(size)
+                    ]
+                    decode_lines += [
+                        '(void)memcpy(&dst_p->{}.buf[0],'.format(name),
+                        '             &{},'.format(decoder_buf),
+                        '             {});'.format(size)
+                    ]
+
+            offset += size
+
+        encode_lines = [
+            '',
+            '{} = encoder_alloc(encoder_p, {});'.format(unique_pos, offset),
+            '',
+            'if ({} >= 0) {{'.format(unique_pos)
+        ] + indent_lines(encode_lines) + [
+            '}',
+            ''
+        ]
+        decode_lines = [
+            '',
+            '{} = decoder_free(decoder_p, {});'.format(unique_pos, offset),
+            '',
+            'if ({} >= 0) {{'.format(unique_pos)
+        ] + indent_lines(decode_lines) + [
+            '}',
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
     def format_sequence_additions(self, type_, checker):
         encode_lines = ['']
         decode_lines = ['']
@@ -655,15 +1010,36 @@ class _Generator(Generator):
 
         return lengths
 
+    def format_append_payload(self, buf, length):
+        """Returns the line(s) appending given OCTET STRING or character
+        string value. Large values are referenced instead of copied by
+        the iovec encoders.
+
+        """
+
+        if self.iovec_encoder:
+            function = 'encoder_append_payload('
+        else:
+            function = 'encoder_append_bytes('
+
+        indent = len(function) * ' '
+
+        return [
+            '{}encoder_p,'.format(function),
+            '{}{},'.format(indent, buf),
+            '{}{});'.format(indent, length)
+        ]
+
     def format_octet_string_inner(self, checker):
         location = self.location_inner('', '.')
 
+        if self.is_octet_string_pointer(checker):
+            return self.format_octet_string_pointer_inner(checker)
+
         if checker.minimum == checker.maximum:
-            encode_lines = [
-                'encoder_append_bytes(encoder_p,',
-                '                     &src_p->{}buf[0],'.format(location),
-                '                     {});'.format(checker.maximum)
-            ]
+            encode_lines = self.format_append_payload(
+                '&src_p->{}buf[0]'.format(location),
+                checker.maximum)
             decode_lines = [
                 'decoder_read_bytes(decoder_p,',
                 '                   &dst_p->{}buf[0],'.format(location),
@@ -672,11 +1048,10 @@ class _Generator(Generator):
         elif checker.maximum < 128:
             encode_lines = [
                 'encoder_append_uint8(encoder_p, src_p->{}length);'.format(
-                    location),
-                'encoder_append_bytes(encoder_p,',
-                '                     &src_p->{}buf[0],'.format(location),
-                '                     src_p->{}length);'.format(location)
-            ]
+                    location)
+            ] + self.format_append_payload(
+                '&src_p->{}buf[0]'.format(location),
+                'src_p->{}length'.format(location))
             decode_lines = [
                 'dst_p->{}length = decoder_read_uint8(decoder_p);'.format(
                     location),
@@ -694,11 +1069,10 @@ class _Generator(Generator):
         else:
             encode_lines = [
                 'encoder_append_length_determinant(encoder_p, src_p->{}length);'.format(
-                    location),
-                'encoder_append_bytes(encoder_p,',
-                '                     &src_p->{}buf[0],'.format(location),
-                '                     src_p->{}length);'.format(location)
-            ]
+                    location)
+            ] + self.format_append_payload(
+                '&src_p->{}buf[0]'.format(location),
+                'src_p->{}length'.format(location))
             decode_lines = [
                 'dst_p->{}length = decoder_read_length_determinant(decoder_p);'.format(
                     location),
@@ -716,6 +1090,108 @@ class _Generator(Generator):
 
         return encode_lines, decode_lines
 
+    def format_restricted_string_inner(self, checker):
+        """Restricted character strings are encoded as OCTET STRINGs, and
+        the characters are not checked.
+
+        """
+
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            encode_length = str(checker.maximum)
+            decode_length = encode_length
+            encode_lines = []
+            decode_lines = []
+        else:
+            encode_length = 'src_p->{}length'.format(location)
+            decode_length = 'dst_p->{}length'.format(location)
+
+            if checker.maximum < 128:
+                encode_lines = [
+                    'encoder_append_uint8(encoder_p, {});'.format(encode_length)
+                ]
+                decode_lines = [
+                    '{} = decoder_read_uint8(decoder_p);'.format(decode_length)
+                ]
+            else:
+                encode_lines = [
+                    'encoder_append_length_determinant(encoder_p, {});'.format(
+                        encode_length)
+                ]
+                decode_lines = [
+                    '{} = decoder_read_length_determinant(decoder_p);'.format(
+                        decode_length)
+                ]
+
+            decode_lines += [
+                '',
+                'if ({} > {}u) {{'.format(decode_length, checker.maximum),
+                '    decoder_abort(decoder_p, EBADLENGTH);',
+                '',
+                '    return;',
+                '}',
+                ''
+            ]
+
+        encode_lines += self.format_append_payload(
+            '(const uint8_t *)&src_p->{}buf[0]'.format(location),
+            encode_length)
+        decode_lines += [
+            'decoder_read_bytes(decoder_p,',
+            '                   (uint8_t *)&dst_p->{}buf[0],'.format(location),
+            '                   {});'.format(decode_length),
+            'dst_p->{}buf[{}] = \'\\0\';'.format(location, decode_length)
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_octet_string_pointer_inner(self, checker):
+        location = self.location_inner('', '.')
+
+        if self.is_octet_string_view(checker):
+            read_function = 'decoder_read_bytes_view'
+        else:
+            read_function = 'decoder_read_bytes_arena'
+
+        read_prefix = 'dst_p->{}buf = {}('.format(location, read_function)
+
+        if checker.maximum < 128:
+            encode_lines = [
+                'encoder_append_uint8(encoder_p, (uint8_t)src_p->{}length);'.format(
+                    location)
+            ]
+            decode_lines = [
+                'dst_p->{}length = decoder_read_uint8(decoder_p);'.format(
+                    location)
+            ]
+        else:
+            encode_lines = [
+                'encoder_append_length_determinant(encoder_p, src_p->{}length);'.format(
+                    location)
+            ]
+            decode_lines = [
+                'dst_p->{}length = decoder_read_length_determinant(decoder_p);'.format(
+                    location)
+            ]
+
+        encode_lines += self.format_append_payload(
+            'src_p->{}buf'.format(location),
+            'src_p->{}length'.format(location))
+        decode_lines += [
+            '',
+            'if (dst_p->{}length > {}u) {{'.format(location, checker.maximum),
+            '    decoder_abort(decoder_p, EBADLENGTH);',
+            '',
+            '    return;',
+            '}',
+            '',
+            '{}decoder_p,'.format(read_prefix),
+            '{}dst_p->{}length);'.format(' ' * len(read_prefix), location)
+        ]
+
+        return encode_lines, decode_lines
+
     def get_encoded_octet_string_lengths(self, type_, checker):
         with self.members_backtrace_push(type_.name):
             if checker.minimum == checker.maximum:
@@ -728,6 +1204,15 @@ class _Generator(Generator):
                 return ['length_determinant_length({})'.format(src_length),
                         src_length]
 
+    def get_encoded_object_identifier_lengths(self, type_):
+        with self.members_backtrace_push(type_.name):
+            location = '{}.'.format(self.location_inner())
+
+            return [
+                'oid_encoded_length(&src_p->{0}arcs[0], src_p->{0}length)'.format(
+                    location)
+            ]
+
     def format_user_type_inner(self, type_name, module_name):
         prefix = self.get_user_type_prefix(type_name, module_name)
         encode_lines = [
@@ -933,19 +1418,11 @@ class _Generator(Generator):
         unique_number_of_length_bytes = self.add_unique_variable(
             'uint8_t {};',
             'number_of_length_bytes')
-        unique_i = self.add_unique_variable(
-            '{} {{}};'.format(self.format_type_name(0, checker.maximum)),
-            'i')
 
         if checker.minimum == checker.maximum:
             unique_length = self.add_unique_decode_variable('uint8_t {};',
                                                             'length')
 
-        with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
-            encode_lines, decode_lines = self.format_type_inner(
-                type_.element_type,
-                checker.element_type)
-
         location = self.location_inner('', '.')
 
         if checker.minimum == checker.maximum:
@@ -958,11 +1435,8 @@ class _Generator(Generator):
                 'encoder_append_uint(encoder_p,',
                 '                    {},'.format(checker.maximum),
                 '                    {});'.format(unique_number_of_length_bytes),
-                '',
-                'for ({ui} = 0; {ui} < {maximum}u; {ui}++) {{'.format(
-                    ui=unique_i,
-                    maximum=checker.maximum),
-            ] + indent_lines(encode_lines)
+                ''
+            ]
             decode_lines = [
                 '{} = decoder_read_uint8(decoder_p);'.format(
                     unique_number_of_length_bytes),
@@ -975,13 +1449,12 @@ class _Generator(Generator):
                 '',
                 '    return;',
                 '}',
-                '',
-                'for ({ui} = 0; {ui} < {maximum}u; {ui}++) {{'.format(
-                    ui=unique_i,
-                    maximum=checker.maximum),
-            ] + indent_lines(decode_lines)
+                ''
+            ]
+            encode_length = '{}u'.format(checker.maximum)
+            decode_length = encode_length
         else:
-            if checker.maximum < 256:
+            if checker.maximum < 256 and not self.is_sequence_of_arena(checker):
                 cast = '(uint8_t)'
             else:
                 cast = ''
@@ -994,11 +1467,8 @@ class _Generator(Generator):
                 'encoder_append_uint(encoder_p,',
                 '                    src_p->{}length,'.format(location),
                 '                    {});'.format(unique_number_of_length_bytes),
-                '',
-                'for ({ui} = 0; {ui} < src_p->{loc}length; {ui}++) {{'.format(
-                    ui=unique_i,
-                    loc=location),
-            ] + indent_lines(encode_lines)
+                ''
+            ]
             decode_lines = [
                 '{} = decoder_read_uint8(decoder_p);'.format(
                     unique_number_of_length_bytes),
@@ -1011,14 +1481,124 @@ class _Generator(Generator):
                 '',
                 '    return;',
                 '}',
-                '',
-                'for ({ui} = 0; {ui} < dst_p->{loc}length; {ui}++) {{'.format(
-                    loc=location,
-                    ui=unique_i),
-            ] + indent_lines(decode_lines)
+                ''
+            ] + self.format_sequence_of_arena_alloc(checker)
+            encode_length = 'src_p->{}length'.format(location)
+            decode_length = 'dst_p->{}length'.format(location)
+
+        array_type_name = self.get_sequence_of_array_type_name(type_, checker)
+
+        if array_type_name is not None:
+            (elements_encode_lines,
+             elements_decode_lines) = self.format_sequence_of_array_inner(
+                 array_type_name,
+                 encode_length,
+                 decode_length)
+        else:
+            (elements_encode_lines,
+             elements_decode_lines) = self.format_sequence_of_elements_inner(
+                 type_,
+                 checker,
+                 encode_length,
+                 decode_length)
+
+        encode_lines += elements_encode_lines
+        decode_lines += elements_decode_lines
+
+        return encode_lines, decode_lines
+
+    def format_sequence_of_elements_inner(self,
+                                          type_,
+                                          checker,
+                                          encode_length,
+                                          decode_length):
+        unique_i = self.add_unique_variable(
+            '{} {{}};'.format(self.format_type_name(0, checker.maximum)),
+            'i')
+
+        with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
+            encode_lines, decode_lines = self.format_type_inner(
+                type_.element_type,
+                checker.element_type)
+
+        encode_lines = [
+            'for ({ui} = 0; {ui} < {length}; {ui}++) {{'.format(
+                ui=unique_i,
+                length=encode_length)
+        ] + indent_lines(encode_lines) + [
+            '}',
+            ''
+        ]
+        decode_lines = [
+            'for ({ui} = 0; {ui} < {length}; {ui}++) {{'.format(
+                ui=unique_i,
+                length=decode_length)
+        ] + indent_lines(decode_lines) + [
+            '}',
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
+    def get_sequence_of_array_type_name(self, type_, checker):
+        """Returns the C type name of the elements of given SEQUENCE OF if
+        they are integers or booleans, which are all encoded and
+        decoded by a single loop over the array, otherwise None.
+
+        """
+
+        element_type = type_.element_type
 
-        encode_lines += ['}', '']
-        decode_lines += ['}', '']
+        if is_user_type(element_type):
+            return None
+
+        if isinstance(element_type, oer.Boolean):
+            return 'bool'
+        elif isinstance(element_type, oer.Integer):
+            return self.format_type_name(checker.element_type.minimum,
+                                         checker.element_type.maximum)
+        else:
+            return None
+
+    def format_sequence_of_array_inner(self,
+                                       type_name,
+                                       encode_length,
+                                       decode_length):
+        location = self.location_inner('', '.')
+        encode_elements = 'src_p->{}elements'.format(location)
+        decode_elements = 'dst_p->{}elements'.format(location)
+
+        if type_name == 'bool':
+            suffix = 'bool_array'
+        else:
+            # Signed integers are encoded as their two's complement.
+            if not type_name.startswith('u'):
+                type_name = 'u' + type_name
+                encode_elements = '(const {} *){}'.format(type_name,
+                                                          encode_elements)
+                decode_elements = '({} *){}'.format(type_name, decode_elements)
+
+            suffix = type_name[:-2] + '_array'
+
+        if suffix == 'uint8_array':
+            encode_prefix = 'encoder_append_bytes('
+            decode_prefix = 'decoder_read_bytes('
+        else:
+            encode_prefix = 'encoder_append_{}('.format(suffix)
+            decode_prefix = 'decoder_read_{}('.format(suffix)
+
+        encode_lines = [
+            '{}encoder_p,'.format(encode_prefix),
+            '{}{},'.format(' ' * len(encode_prefix), encode_elements),
+            '{}{});'.format(' ' * len(encode_prefix), encode_length),
+            ''
+        ]
+        decode_lines = [
+            '{}decoder_p,'.format(decode_prefix),
+            '{}{},'.format(' ' * len(decode_prefix), decode_elements),
+            '{}{});'.format(' ' * len(decode_prefix), decode_length),
+            ''
+        ]
 
         return encode_lines, decode_lines
 
@@ -1044,11 +1624,17 @@ class _Generator(Generator):
             return [], []
         elif isinstance(type_, oer.Boolean):
             return self.format_boolean_inner()
+        elif self.is_recursive_user_type(type_):
+            return self.format_recursive_user_type_inner(type_)
         elif is_user_type(type_):
             return self.format_user_type_inner(type_.type_name,
                                                type_.module_name)
         elif isinstance(type_, oer.OctetString):
             return self.format_octet_string_inner(checker)
+        elif is_restricted_string(type_):
+            return self.format_restricted_string_inner(checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier_inner()
         elif isinstance(type_, oer.Sequence):
             return self.format_sequence_inner(type_, checker)
         elif isinstance(type_, oer.Choice):
@@ -1077,6 +1663,10 @@ class _Generator(Generator):
             return self.format_choice_inner(type_, checker)
         elif isinstance(type_, oer.OctetString):
             return self.format_octet_string_inner(checker)
+        elif is_restricted_string(type_):
+            return self.format_restricted_string_inner(checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier_inner()
         elif isinstance(type_, oer.BitString):
             return self.format_bit_string_inner(checker)
         elif isinstance(type_, oer.Enumerated):
@@ -1086,6 +1676,398 @@ class _Generator(Generator):
         else:
             return [], []
 
+    def get_maximum_encoded_size(self, type_, checker):
+        if isinstance(type_, oer.Integer):
+            return self.type_length(checker.minimum, checker.maximum) // 8
+        elif isinstance(type_, oer.Boolean):
+            return 1
+        elif isinstance(type_, oer.Real):
+            return get_encoded_real_lengths(type_)[0]
+        elif isinstance(type_, oer.Null):
+            return 0
+        elif isinstance(type_, oer.OctetString) or is_restricted_string(type_):
+            return self.get_maximum_encoded_octet_string_size(checker)
+        elif isinstance(type_, oer.Sequence):
+            return self.get_maximum_encoded_sequence_size(type_, checker)
+        elif isinstance(type_, oer.Choice):
+            return self.get_maximum_encoded_choice_size(type_, checker)
+        elif isinstance(type_, oer.SequenceOf):
+            return self.get_maximum_encoded_sequence_of_size(type_, checker)
+        elif isinstance(type_, oer.Enumerated):
+            return self.get_maximum_encoded_enumerated_size(type_)
+        elif isinstance(type_, oer.BitString):
+            return self.get_maximum_encoded_bit_string_size(checker)
+        elif is_object_identifier(type_):
+            return 1 + OID_MAXIMUM_CONTENTS_SIZE
+        else:
+            return None
+
+    def get_maximum_encoded_octet_string_size(self, checker):
+        if checker.minimum == checker.maximum:
+            return checker.maximum
+        elif checker.maximum < 128:
+            return 1 + checker.maximum
+        else:
+            return get_length_determinant_length(checker.maximum) + checker.maximum
+
+    def get_maximum_encoded_bit_string_size(self, checker):
+        if not self.is_bit_string_buffer(checker):
+            return self.value_length(2 ** checker.minimum - 1)
+
+        size = (checker.maximum + 7) // 8
+
+        if checker.minimum == checker.maximum:
+            return size
+        else:
+            return get_length_determinant_length(size + 1) + 1 + size
+
+    def get_maximum_encoded_sequence_size(self, type_, checker):
+        optionals = get_sequence_optionals(type_)
+        extension_bit = get_sequence_extension_bit(type_)
+        size = get_sequence_present_mask_length(optionals, extension_bit)
+
+        for member in type_.root_members:
+            member_size = self.get_maximum_encoded_size(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_size is None:
+                return None
+
+            size += member_size
+
+        if type_.additions is not None and len(type_.additions) > 0:
+            additions_mask_length = get_sequence_additions_mask_length(
+                type_.additions)
+            size += get_length_determinant_length(additions_mask_length + 1)
+            size += 1 + additions_mask_length
+
+            for addition in type_.additions:
+                addition_size = self.get_maximum_encoded_size(
+                    addition,
+                    self.get_member_checker(checker, addition.name))
+
+                if addition_size is None:
+                    return None
+
+                size += get_length_determinant_length(addition_size)
+                size += addition_size
+
+        return size
+
+    def get_maximum_encoded_choice_size(self, type_, checker):
+        size = 0
+
+        for member in type_.root_members:
+            member_size = self.get_maximum_encoded_size(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_size is None:
+                return None
+
+            size = max(size, len(member.tag) + member_size)
+
+        return size
+
+    def get_maximum_encoded_sequence_of_size(self, type_, checker):
+        element_size = self.get_maximum_encoded_size(type_.element_type,
+                                                     checker.element_type)
+
+        if element_size is None:
+            return None
+
+        return (1
+                + get_minimum_uint_length(checker.maximum)
+                + checker.maximum * element_size)
+
+    def get_maximum_encoded_enumerated_size(self, type_):
+        values = type_.value_to_data
+
+        if min(values) >= 0 and max(values) < 128:
+            return 1
+        else:
+            return 1 + max(self.get_enumerated_value_length(min(values)),
+                           self.get_enumerated_value_length(max(values)))
+
+    def get_fixed_skip_size(self, type_, checker):
+        """Returns the encoded size in bytes of given type if it does not
+        depend on the encoded data, otherwise None.
+
+        """
+
+        if isinstance(type_, oer.Integer):
+            return self.type_length(checker.minimum, checker.maximum) // 8
+        elif isinstance(type_, oer.Boolean):
+            return 1
+        elif isinstance(type_, oer.Real):
+            return get_encoded_real_lengths(type_)[0]
+        elif isinstance(type_, oer.Null):
+            return 0
+        elif isinstance(type_, oer.BitString):
+            if checker.minimum == checker.maximum:
+                return self.get_maximum_encoded_bit_string_size(checker)
+        elif isinstance(type_, oer.OctetString) or is_restricted_string(type_):
+            if checker.minimum == checker.maximum:
+                return checker.maximum
+        elif isinstance(type_, oer.Sequence):
+            return self.get_fixed_skip_sequence_size(type_, checker)
+
+        return None
+
+    def get_fixed_skip_sequence_size(self, type_, checker):
+        if get_sequence_optionals(type_) or type_.additions is not None:
+            return None
+
+        size = 0
+
+        for member in type_.root_members:
+            member_size = self.get_fixed_skip_size(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_size is None:
+                return None
+
+            size += member_size
+
+        return size
+
+    def format_type_skip_inner(self, type_, checker):
+        size = self.get_fixed_skip_size(type_, checker)
+
+        if size is not None:
+            return self.format_skip(size)
+        elif isinstance(type_, oer.OctetString) or is_restricted_string(type_):
+            return self.format_octet_string_skip(checker)
+        elif isinstance(type_, oer.BitString):
+            return self.format_bit_string_skip(checker)
+        elif is_object_identifier(type_):
+            return ['decoder_skip_oid(decoder_p);']
+        elif isinstance(type_, oer.Sequence):
+            return self.format_sequence_skip(type_, checker)
+        elif isinstance(type_, oer.Choice):
+            return self.format_choice_skip(type_, checker)
+        elif isinstance(type_, oer.SequenceOf):
+            return self.format_sequence_of_skip(type_, checker)
+        elif isinstance(type_, oer.Enumerated):
+            return self.format_enumerated_skip(type_)
+        else:
+            raise self.error(str(type_))
+
+    def format_octet_string_skip(self, checker):
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+
+        if checker.maximum < 128:
+            read_function = 'decoder_read_uint8'
+        else:
+            read_function = 'decoder_read_length_determinant'
+
+        return [
+            '{} = {}(decoder_p);'.format(unique_length, read_function),
+            '',
+            'if ({} > {}u) {{'.format(unique_length, checker.maximum),
+            '    decoder_abort(decoder_p, EBADLENGTH);',
+            '',
+            '    return;',
+            '}',
+            '',
+            '(void)decoder_free(decoder_p, {});'.format(unique_length)
+        ]
+
+    def format_bit_string_skip(self, checker):
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+
+        return [
+            '{} = decoder_read_bit_string_length(decoder_p, {}u);'.format(
+                unique_length,
+                checker.maximum),
+            '(void)decoder_free(decoder_p, ({} + 7u) / 8u);'.format(unique_length)
+        ]
+
+    def format_sequence_skip(self, type_, checker):
+        optionals = get_sequence_optionals(type_)
+        extension_bit = get_sequence_extension_bit(type_)
+        present_mask_length = get_sequence_present_mask_length(optionals,
+                                                               extension_bit)
+        lines = []
+        condition_by_member_name = {}
+
+        if present_mask_length > 0:
+            unique_present_mask = self.add_unique_decode_variable(
+                'uint8_t {{}}[{}];'.format(present_mask_length),
+                'present_mask')
+            lines += [
+                'decoder_read_bytes(decoder_p,',
+                '                   &{}[0],'.format(unique_present_mask),
+                '                   sizeof({}));'.format(unique_present_mask),
+                ''
+            ]
+
+            for i, member in enumerate(optionals, start=extension_bit):
+                byte, bit = divmod(i, 8)
+                condition_by_member_name[member.name] = (
+                    '({0}[{1}] & 0x{2:02x}u) == 0x{2:02x}u'.format(
+                        unique_present_mask,
+                        byte,
+                        1 << (7 - bit)))
+
+        size = 0
+
+        for member in type_.root_members:
+            member_checker = self.get_member_checker(checker, member.name)
+            member_size = self.get_fixed_skip_size(member, member_checker)
+
+            if member_size is not None and member.name not in condition_by_member_name:
+                size += member_size
+                continue
+
+            lines += self.format_skip(size)
+            size = 0
+
+            with self.members_backtrace_push(canonical(member.name)):
+                member_lines = self.format_type_skip(member, member_checker)
+
+            if member.name in condition_by_member_name:
+                member_lines = [
+                    'if ({}) {{'.format(condition_by_member_name[member.name])
+                ] + indent_lines(member_lines) + [
+                    '}'
+                ]
+
+            lines += member_lines
+
+        lines += self.format_skip(size)
+
+        if extension_bit == 1:
+            lines += [
+                '',
+                'if (({}[0] & 0x80u) == 0x80u) {{'.format(unique_present_mask),
+                '    decoder_skip_additions(decoder_p);',
+                '}'
+            ]
+
+        return lines
+
+    def format_choice_skip(self, type_, checker):
+        unique_tag = self.add_unique_decode_variable('uint32_t {};', 'tag')
+        lines = [
+            '{} = decoder_read_tag(decoder_p);'.format(unique_tag),
+            '',
+            'switch ({}) {{'.format(unique_tag),
+            ''
+        ]
+
+        for member in type_.root_members:
+            member_checker = self.get_member_checker(checker, member.name)
+            tag_length = len(member.tag)
+            tag = bitstruct.unpack('u{}'.format(8 * tag_length), member.tag)[0]
+            tag = '0x{{:0{}x}}'.format(2 * tag_length).format(tag)
+
+            with self.members_backtrace_push(canonical(member.name)):
+                member_lines = self.format_type_skip(member, member_checker)
+
+            lines += [
+                'case {}:'.format(tag)
+            ] + indent_lines(member_lines + ['break;']) + [
+                ''
+            ]
+
+        return lines + [
+            'default:',
+            '    decoder_abort(decoder_p, EBADCHOICE);',
+            '    break;',
+            '}'
+        ]
+
+    def format_sequence_of_skip(self, type_, checker):
+        unique_number_of_length_bytes = self.add_unique_decode_variable(
+            'uint8_t {};',
+            'number_of_length_bytes')
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+        element_size = self.get_fixed_skip_size(type_.element_type,
+                                                checker.element_type)
+
+        if checker.minimum == checker.maximum:
+            lines = [
+                '{} = decoder_read_uint8(decoder_p);'.format(
+                    unique_number_of_length_bytes),
+                '{} = decoder_read_uint8(decoder_p);'.format(unique_length),
+                '',
+                'if (({} != 1u) || ({} > {}u)) {{'.format(
+                    unique_number_of_length_bytes,
+                    unique_length,
+                    checker.maximum)
+            ]
+            number_of_elements = '{}u'.format(checker.maximum)
+        else:
+            lines = [
+                '{} = decoder_read_uint8(decoder_p);'.format(
+                    unique_number_of_length_bytes),
+                '{} = decoder_read_uint(decoder_p, {});'.format(
+                    unique_length,
+                    unique_number_of_length_bytes),
+                '',
+                'if ({} > {}u) {{'.format(unique_length, checker.maximum)
+            ]
+            number_of_elements = unique_length
+
+        lines += [
+            '    decoder_abort(decoder_p, EBADLENGTH);',
+            '',
+            '    return;',
+            '}',
+            ''
+        ]
+
+        if element_size == 0:
+            pass
+        elif element_size is not None:
+            lines.append('(void)decoder_free(decoder_p, {} * {}u);'.format(
+                number_of_elements,
+                element_size))
+        else:
+            unique_i = self.add_unique_decode_variable('uint32_t {};', 'i')
+
+            with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
+                element_lines = self.format_type_skip(type_.element_type,
+                                                      checker.element_type)
+
+            lines += [
+                'for ({ui} = 0; {ui} < {n}; {ui}++) {{'.format(
+                    ui=unique_i,
+                    n=number_of_elements)
+            ] + indent_lines(element_lines) + [
+                '}'
+            ]
+
+        return lines
+
+    def format_enumerated_skip(self, type_):
+        max_value = max(type_.value_to_data)
+        min_value = min(type_.value_to_data)
+        type_length = max(self.get_enumerated_value_length(min_value),
+                          self.get_enumerated_value_length(max_value))
+        unique_enum_length = self.add_unique_decode_variable('uint8_t {};',
+                                                             'enum_length')
+
+        return [
+            '{} = decoder_read_uint8(decoder_p);'.format(unique_enum_length),
+            '',
+            'if (({} & 0x80u) == 0x80u) {{'.format(unique_enum_length),
+            '    {} &= 0x7fu;'.format(unique_enum_length),
+            '',
+            '    if (({length} > {type_length}u) || ({length} == 0u)) {{'.format(
+                type_length=type_length, length=unique_enum_length),
+            '        decoder_abort(decoder_p, EBADLENGTH);',
+            '',
+            '        return;',
+            '    }',
+            '',
+            '    (void)decoder_free(decoder_p, {});'.format(unique_enum_length),
+            '}'
+        ]
+
     def is_complex_user_type(self, type_):
         return is_user_type(type_) and \
             not isinstance(type_, (oer.Integer, oer.Boolean, oer.Real, oer.Null))
@@ -1093,6 +2075,44 @@ class _Generator(Generator):
     def is_buffer_type(self, type_):
         return isinstance(type_, oer.OctetString)
 
+    def is_sequence_type(self, type_):
+        return isinstance(type_, oer.Sequence)
+
+    def generate(self, compiled):
+        structs, declarations, helpers, definitions = \
+            super(_Generator, self).generate(compiled)
+
+        if self.iovec_encoder:
+            structs = IOVEC_MIN_REFERENCE_SIZE_FMT.format(
+                namespace_upper=self.namespace.upper()) + '\n' + structs
+
+        return structs, declarations, helpers, definitions
+
+    def generate_declaration(self, compiled_type):
+        declaration = super(_Generator, self).generate_declaration(compiled_type)
+
+        if self.iovec_encoder:
+            declaration += '\n' + IOVEC_DECLARATION_FMT.format(
+                namespace=self.namespace,
+                module_name=self.module_name,
+                type_name=self.type_name,
+                module_name_snake=self.module_name_snake,
+                type_name_snake=self.type_name_snake)
+
+        return declaration
+
+    def generate_definition(self, compiled_type):
+        definition = super(_Generator, self).generate_definition(compiled_type)
+
+        if self.iovec_encoder:
+            definition += IOVEC_DEFINITION_FMT.format(
+                namespace=self.namespace,
+                namespace_upper=self.namespace.upper(),
+                module_name_snake=self.module_name_snake,
+                type_name_snake=self.type_name_snake)
+
+        return definition
+
     def generate_helpers(self, definitions):
         helpers = []
 
@@ -1100,13 +2120,46 @@ class _Generator(Generator):
             is_in_helpers = any([pattern in helper for helper in helpers])
 
             if pattern in definitions or is_in_helpers:
+                if self.iovec_encoder:
+                    definition = iovec_functions.get(pattern, definition)
+
                 helpers.insert(0, definition)
 
         for additional_helpers in self.additional_helpers.values():
             helpers.extend(additional_helpers + [''])
 
-        return [ENCODER_AND_DECODER_STRUCTS] + helpers + ['']
+        encoder_members = []
+
+        if self.iovec_encoder:
+            encoder_members += [
+                'struct iovec *iov_p;',
+                'ssize_t iov_size;',
+                'ssize_t iov_pos;',
+                'size_t iov_threshold;',
+                'ssize_t segment_pos;'
+            ]
+
+        structs = self.format_encoder_and_decoder_structs(
+            ENCODER_AND_DECODER_STRUCTS,
+            encoder_members)
+
+        return [structs] + helpers + ['']
+
+
+def generate(compiled,
+             namespace,
+             view_threshold=None,
+             arena_threshold=None,
+             jer_encoder=False,
+             object_identifiers=None,
+             iovec_encoder=False):
+    generator = _Generator(namespace, view_threshold, arena_threshold)
+    generator.iovec_encoder = iovec_encoder
+
+    if object_identifiers is not None:
+        generator.object_identifiers = object_identifiers
 
+    if jer_encoder:
+        generator.jer_generator = jer.Generator(generator)
 
-def generate(compiled, namespace):
-    return _Generator(namespace).generate(compiled)
+    return generator.generate(compiled)
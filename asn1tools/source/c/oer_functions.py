@@ -4,6 +4,22 @@
 
 from .utils import ENCODER_ABORT
 from .utils import DECODER_ABORT
+from .utils import DECODER_ARENA_ALLOC
+from .utils import ENCODER_ENTER
+from .utils import ENCODER_LEAVE
+from .utils import DECODER_ENTER
+from .utils import DECODER_LEAVE
+from .utils import DECODER_READ_BYTES_ARENA
+from .utils import OID_ENCODE
+from .utils import OID_DECODE
+from .utils import DECODER_SKIP_OID
+from .utils import ALWAYS_INLINE
+from .utils import LOAD_UINT16
+from .utils import LOAD_UINT32
+from .utils import LOAD_UINT64
+from .utils import STORE_UINT16
+from .utils import STORE_UINT32
+from .utils import STORE_UINT64
 
 ENUMERATED_VALUE_LENGTH = '''
 static uint8_t enumerated_value_length(int32_t value)
@@ -74,6 +90,20 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (ssize_t)size;
     self_p->pos = 0;
+    self_p->size_only = false;
+}\
+'''
+
+ENCODER_INIT_IOVEC = '''\
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->iov_p = NULL;
 }\
 '''
 
@@ -93,6 +123,10 @@ static ssize_t encoder_alloc(struct encoder_t *self_p,
     if ((self_p->pos + (ssize_t)size) <= self_p->size) {
         pos = self_p->pos;
         self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
     } else {
         pos = -ENOMEM;
         encoder_abort(self_p, ENOMEM);
@@ -119,6 +153,97 @@ static void encoder_append_bytes(struct encoder_t *self_p,
 }\
 '''
 
+ENCODER_APPEND_IOVEC = '''
+static void encoder_append_iovec(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (self_p->iov_pos == self_p->iov_size) {
+        encoder_abort(self_p, ENOMEM);
+
+        return;
+    }
+
+    /* The payload is only read by writev() and friends. */
+    self_p->iov_p[self_p->iov_pos].iov_base = (void *)(uintptr_t)buf_p;
+    self_p->iov_p[self_p->iov_pos].iov_len = size;
+    self_p->iov_pos++;
+}\
+'''
+
+ENCODER_APPEND_SEGMENT = '''
+static void encoder_append_segment(struct encoder_t *self_p)
+{
+    if (self_p->pos > self_p->segment_pos) {
+        encoder_append_iovec(self_p,
+                             &self_p->buf_p[self_p->segment_pos],
+                             (size_t)(self_p->pos - self_p->segment_pos));
+        self_p->segment_pos = self_p->pos;
+    }
+}\
+'''
+
+ENCODER_APPEND_PAYLOAD = '''
+static void encoder_append_payload(struct encoder_t *self_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    if ((self_p->iov_p == NULL) || (size < self_p->iov_threshold)) {
+        encoder_append_bytes(self_p, buf_p, size);
+
+        return;
+    }
+
+    /* Close the scratch buffer segment and reference the payload
+       instead of copying it. */
+    encoder_append_segment(self_p);
+
+    if (self_p->pos >= 0) {
+        encoder_append_iovec(self_p, buf_p, size);
+    }
+}\
+'''
+
+ENCODER_GET_IOVEC_RESULT = '''
+static ssize_t encoder_get_iovec_result(struct encoder_t *self_p)
+{
+    encoder_append_segment(self_p);
+
+    if (self_p->pos < 0) {
+        return (self_p->pos);
+    }
+
+    return (self_p->iov_pos);
+}\
+'''
+
+ENCODER_APPEND_BIT_STRING = '''
+static void encoder_append_bit_string(struct encoder_t *self_p,
+                                      const uint8_t *buf_p,
+                                      uint32_t number_of_bits)
+{
+    uint32_t size;
+    uint32_t rest;
+
+    size = (number_of_bits / 8u);
+    rest = (number_of_bits % 8u);
+    encoder_append_bytes(self_p, buf_p, size);
+
+    if (rest != 0u) {
+        encoder_append_uint8(self_p, (uint8_t)(buf_p[size] & (0xffu << (8u - rest))));
+    }
+}\
+'''
+
+ENCODER_APPEND_BIT_STRING_LENGTH = '''
+static void encoder_append_bit_string_length(struct encoder_t *self_p,
+                                             uint32_t number_of_bits)
+{
+    encoder_append_length_determinant(self_p, ((number_of_bits + 7u) / 8u) + 1u);
+    encoder_append_uint8(self_p, (uint8_t)((8u - (number_of_bits % 8u)) % 8u));
+}\
+'''
+
 ENCODER_APPEND_UINT8 = '''
 static void encoder_append_uint8(struct encoder_t *self_p,
                                  uint8_t value)
@@ -379,6 +504,67 @@ static void decoder_read_bytes(struct decoder_t *self_p,
 }\
 '''
 
+DECODER_READ_BIT_STRING = '''
+static void decoder_read_bit_string(struct decoder_t *self_p,
+                                    uint8_t *buf_p,
+                                    uint32_t number_of_bits)
+{
+    uint32_t size;
+    uint32_t rest;
+
+    size = (number_of_bits / 8u);
+    rest = (number_of_bits % 8u);
+
+    if (rest != 0u) {
+        decoder_read_bytes(self_p, buf_p, size + 1u);
+        buf_p[size] &= (uint8_t)(0xffu << (8u - rest));
+    } else {
+        decoder_read_bytes(self_p, buf_p, size);
+    }
+}\
+'''
+
+DECODER_READ_BIT_STRING_LENGTH = '''
+static uint32_t decoder_read_bit_string_length(struct decoder_t *self_p,
+                                               uint32_t maximum)
+{
+    uint32_t size;
+    uint32_t number_of_unused_bits;
+
+    size = decoder_read_length_determinant(self_p);
+    number_of_unused_bits = decoder_read_uint8(self_p);
+
+    /* The unused bits octet is included in the size. */
+    if ((size == 0u)
+        || (size > (((maximum + 7u) / 8u) + 1u))
+        || (number_of_unused_bits > 7u)
+        || ((size == 1u) && (number_of_unused_bits != 0u))
+        || ((8u * (size - 1u) - number_of_unused_bits) > maximum)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    return (8u * (size - 1u) - number_of_unused_bits);
+}\
+'''
+
+DECODER_READ_BYTES_VIEW = '''
+static const uint8_t *decoder_read_bytes_view(struct decoder_t *self_p,
+                                              size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos < 0) {
+        return (NULL);
+    }
+
+    return (&self_p->buf_p[pos]);
+}\
+'''
+
 DECODER_READ_UINT8 = '''
 static uint8_t decoder_read_uint8(struct decoder_t *self_p)
 {
@@ -620,6 +806,48 @@ static uint32_t decoder_read_length_determinant(struct decoder_t *self_p)
 }\
 '''
 
+DECODER_SKIP_ADDITIONS = '''
+static void decoder_skip_additions(struct decoder_t *self_p)
+{
+    uint32_t length;
+    uint32_t number_of_additions;
+    uint32_t i;
+    uint8_t mask;
+    ssize_t pos;
+
+    length = decoder_read_length_determinant(self_p);
+
+    if (length <= 1u) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(self_p, length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    number_of_additions = 0;
+
+    /* First byte is the number of unused bits in the presence bitmap. */
+    for (i = 1; i < length; i++) {
+        for (mask = self_p->buf_p[pos + (ssize_t)i]; mask != 0u; mask >>= 1) {
+            number_of_additions += (mask & 1u);
+        }
+    }
+
+    for (i = 0; i < number_of_additions; i++) {
+        length = decoder_read_length_determinant(self_p);
+
+        if (decoder_free(self_p, length) < 0) {
+            return;
+        }
+    }
+}\
+'''
+
 DECODER_READ_TAG = '''
 static uint32_t decoder_read_tag(struct decoder_t *self_p)
 {
@@ -638,8 +866,268 @@ static uint32_t decoder_read_tag(struct decoder_t *self_p)
 }\
 '''
 
+ENCODER_APPEND_OID = '''
+static void encoder_append_oid(struct encoder_t *self_p,
+                               const uint32_t *arcs_p,
+                               uint8_t length)
+{
+    uint8_t buf[75];
+    ssize_t size;
+
+    size = oid_encode(&buf[0], arcs_p, length);
+
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    encoder_append_length_determinant(self_p, (uint32_t)size);
+    encoder_append_bytes(self_p, &buf[0], (size_t)size);
+}\
+'''
+
+DECODER_READ_OID = '''
+static void decoder_read_oid(struct decoder_t *self_p,
+                             uint32_t *arcs_p,
+                             uint8_t *length_p)
+{
+    uint32_t size;
+    ssize_t pos;
+    int res;
+
+    size = decoder_read_length_determinant(self_p);
+    pos = decoder_free(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    /* Decoded directly from the encoded data. */
+    res = oid_decode(arcs_p, length_p, &self_p->buf_p[pos], size);
+
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+    }
+}\
+'''
+
+OID_ENCODED_LENGTH = '''
+static uint32_t oid_encoded_length(const uint32_t *arcs_p, uint8_t length)
+{
+    uint8_t buf[75];
+    ssize_t size;
+
+    size = oid_encode(&buf[0], arcs_p, length);
+
+    /* The error is reported when encoding the value. */
+    if (size < 0) {
+        size = 0;
+    }
+
+    return (1u + (uint32_t)size);
+}\
+'''
+
+ENCODER_APPEND_BOOL_ARRAY = '''
+static void encoder_append_bool_array(struct encoder_t *self_p,
+                                      const bool *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        buf_p[i] = (values_p[i] ? 255u : 0u);
+    }
+}\
+'''
+
+ENCODER_APPEND_UINT16_ARRAY = '''
+static void encoder_append_uint16_array(struct encoder_t *self_p,
+                                        const uint16_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 2 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint16(&buf_p[2 * i], values_p[i]);
+    }
+}\
+'''
+
+ENCODER_APPEND_UINT32_ARRAY = '''
+static void encoder_append_uint32_array(struct encoder_t *self_p,
+                                        const uint32_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 4 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint32(&buf_p[4 * i], values_p[i]);
+    }
+}\
+'''
+
+ENCODER_APPEND_UINT64_ARRAY = '''
+static void encoder_append_uint64_array(struct encoder_t *self_p,
+                                        const uint64_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 8 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint64(&buf_p[8 * i], values_p[i]);
+    }
+}\
+'''
+
+DECODER_READ_BOOL_ARRAY = '''
+static void decoder_read_bool_array(struct decoder_t *self_p,
+                                    bool *values_p,
+                                    size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = (buf_p[i] != 0u);
+    }
+}\
+'''
+
+DECODER_READ_UINT16_ARRAY = '''
+static void decoder_read_uint16_array(struct decoder_t *self_p,
+                                      uint16_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 2 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 2 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint16(&buf_p[2 * i]);
+    }
+}\
+'''
+
+DECODER_READ_UINT32_ARRAY = '''
+static void decoder_read_uint32_array(struct decoder_t *self_p,
+                                      uint32_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 4 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 4 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint32(&buf_p[4 * i]);
+    }
+}\
+'''
+
+DECODER_READ_UINT64_ARRAY = '''
+static void decoder_read_uint64_array(struct decoder_t *self_p,
+                                      uint64_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 8 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 8 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint64(&buf_p[8 * i]);
+    }
+}\
+'''
+
 functions = [
+    ('decoder_skip_oid(', DECODER_SKIP_OID),
+    ('decoder_read_oid(', DECODER_READ_OID),
+    ('oid_decode(', OID_DECODE),
+    ('decoder_skip_additions(', DECODER_SKIP_ADDITIONS),
     ('decoder_read_tag(', DECODER_READ_TAG),
+    ('decoder_read_bit_string_length(', DECODER_READ_BIT_STRING_LENGTH),
     ('decoder_read_length_determinant(', DECODER_READ_LENGTH_DETERMINANT),
     ('decoder_read_bool(', DECODER_READ_BOOL),
     ('decoder_read_double(', DECODER_READ_DOUBLE),
@@ -655,11 +1143,28 @@ functions = [
     ('decoder_read_uint32(', DECODER_READ_UINT32),
     ('decoder_read_uint16(', DECODER_READ_UINT16),
     ('decoder_read_uint8(', DECODER_READ_UINT8),
+    ('decoder_read_bytes_arena(', DECODER_READ_BYTES_ARENA),
+    ('decoder_read_bytes_view(', DECODER_READ_BYTES_VIEW),
+    ('decoder_read_bit_string(', DECODER_READ_BIT_STRING),
+    ('decoder_read_uint64_array(', DECODER_READ_UINT64_ARRAY),
+    ('decoder_read_uint32_array(', DECODER_READ_UINT32_ARRAY),
+    ('decoder_read_uint16_array(', DECODER_READ_UINT16_ARRAY),
+    ('decoder_read_bool_array(', DECODER_READ_BOOL_ARRAY),
     ('decoder_read_bytes(', DECODER_READ_BYTES),
     ('decoder_free(', DECODER_FREE),
+    ('decoder_leave(', DECODER_LEAVE),
+    ('decoder_enter(', DECODER_ENTER),
+    ('decoder_arena_alloc(', DECODER_ARENA_ALLOC),
     ('decoder_abort(', DECODER_ABORT),
     ('decoder_get_result(', DECODER_GET_RESULT),
     ('decoder_init(', DECODER_INIT),
+    ('encoder_get_iovec_result(', ENCODER_GET_IOVEC_RESULT),
+    ('encoder_append_payload(', ENCODER_APPEND_PAYLOAD),
+    ('encoder_append_segment(', ENCODER_APPEND_SEGMENT),
+    ('encoder_append_iovec(', ENCODER_APPEND_IOVEC),
+    ('encoder_append_oid(', ENCODER_APPEND_OID),
+    ('encoder_append_bit_string(', ENCODER_APPEND_BIT_STRING),
+    ('encoder_append_bit_string_length(', ENCODER_APPEND_BIT_STRING_LENGTH),
     ('encoder_append_length_determinant(', ENCODER_APPEND_LENGTH_DETERMINANT),
     ('encoder_append_bool(', ENCODER_APPEND_BOOL),
     ('encoder_append_double(', ENCODER_APPEND_DOUBLE),
@@ -675,12 +1180,32 @@ functions = [
     ('encoder_append_uint32(', ENCODER_APPEND_UINT32),
     ('encoder_append_uint16(', ENCODER_APPEND_UINT16),
     ('encoder_append_uint8(', ENCODER_APPEND_UINT8),
+    ('encoder_append_uint64_array(', ENCODER_APPEND_UINT64_ARRAY),
+    ('encoder_append_uint32_array(', ENCODER_APPEND_UINT32_ARRAY),
+    ('encoder_append_uint16_array(', ENCODER_APPEND_UINT16_ARRAY),
+    ('encoder_append_bool_array(', ENCODER_APPEND_BOOL_ARRAY),
     ('encoder_append_bytes(', ENCODER_APPEND_BYTES),
     ('encoder_alloc(', ENCODER_ALLOC),
+    ('encoder_leave(', ENCODER_LEAVE),
+    ('encoder_enter(', ENCODER_ENTER),
     ('encoder_abort(', ENCODER_ABORT),
     ('encoder_get_result(', ENCODER_GET_RESULT),
     ('encoder_init(', ENCODER_INIT),
+    ('oid_encoded_length(', OID_ENCODED_LENGTH),
+    ('oid_encode(', OID_ENCODE),
     ('minimum_uint_length(', MINIMUM_UINT_LENGTH),
     ('length_determinant_length(', LENGTH_DETERMINANT_LENGTH),
-    ('enumerated_value_length(', ENUMERATED_VALUE_LENGTH)
+    ('enumerated_value_length(', ENUMERATED_VALUE_LENGTH),
+    ('load_uint64(', LOAD_UINT64),
+    ('load_uint32(', LOAD_UINT32),
+    ('load_uint16(', LOAD_UINT16),
+    ('store_uint64(', STORE_UINT64),
+    ('store_uint32(', STORE_UINT32),
+    ('store_uint16(', STORE_UINT16),
+    ('ALWAYS_INLINE', ALWAYS_INLINE)
 ]
+
+# Helpers of the iovec encoders replacing their default variants.
+iovec_functions = {
+    'encoder_init(': ENCODER_INIT_IOVEC
+}
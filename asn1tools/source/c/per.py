@@ -0,0 +1,718 @@
+"""Aligned Packed Encoding Rules (PER) C source code codec generator.
+
+"""
+
+from .utils import is_user_type
+from .utils import indent_lines
+from .utils import is_restricted_string
+from .utils import is_object_identifier
+from .per_functions import ENCODER_AND_DECODER_STRUCTS
+from .per_functions import functions
+from . import jer
+from . import uper
+from ...codecs import per
+
+
+def get_length_number_of_bits(type_, checker):
+    """Returns the number of bits of the length determinant of given
+    variable size OCTET STRING or SEQUENCE OF type, and if it is
+    octet-aligned or not.
+
+    """
+
+    range_ = (checker.maximum - checker.minimum + 1)
+
+    if range_ <= 255:
+        return type_.number_of_bits, False
+    elif range_ == 256:
+        return 8, True
+    elif range_ <= 65536:
+        return 16, True
+    else:
+        return type_.number_of_bits, True
+
+
+class _Generator(uper._Generator):
+
+    codec = per
+
+    def format_octet_string(self, checker):
+        if self.is_octet_string_view(checker):
+            raise self.error('OCTET STRING views are not supported by PER.')
+
+        if checker.maximum > 65535:
+            raise self.error(
+                'OCTET STRING with a maximum size of more than 65535 bytes is '
+                'not supported by PER.')
+
+        return super(uper._Generator, self).format_octet_string(checker)
+
+    def format_restricted_string(self, type_, checker):
+        if checker.has_upper_bound() and checker.maximum > 65535:
+            raise self.error(
+                '{} with a maximum size of more than 65535 characters is not '
+                'supported by PER.'.format(type_.__class__.__name__))
+
+        return super(uper._Generator, self).format_restricted_string(type_,
+                                                                     checker)
+
+    def format_bit_string(self, type_, checker):
+        if checker.has_upper_bound() and checker.maximum > 65535:
+            raise self.error(
+                'BIT STRING with a maximum size of more than 65535 bits is '
+                'not supported by PER.')
+
+        return super(uper._Generator, self).format_bit_string(type_, checker)
+
+    def format_open_type(self, type_):
+        return super(uper._Generator, self).format_open_type(type_)
+
+    def format_sequence_of(self, type_, checker):
+        if checker.maximum > 65535:
+            raise self.error(
+                'SEQUENCE OF with a maximum size of more than 65535 elements is '
+                'not supported by PER.')
+
+        return super(_Generator, self).format_sequence_of(type_, checker)
+
+    def get_choice_index_number_of_bits(self, type_):
+        """Returns the number of bits of the index of given CHOICE type, and
+        if it is octet-aligned or not.
+
+        """
+
+        range_ = (type_.maximum + 1)
+
+        if range_ <= 255:
+            return type_.root_number_of_bits, False
+        elif range_ == 256:
+            return 8, True
+        elif range_ <= 65536:
+            return 16, True
+        else:
+            raise self.error(
+                'CHOICE with more than 65536 members is not supported by PER.')
+
+    def format_choice_index_encode(self, type_, index):
+        number_of_bits, aligned = self.get_choice_index_number_of_bits(type_)
+        lines = [
+            'encoder_append_non_negative_binary_integer(encoder_p, {}, {});'.format(
+                index,
+                number_of_bits)
+        ]
+
+        if aligned:
+            lines.insert(0, 'encoder_align(encoder_p);')
+
+        return lines
+
+    def format_choice_index_decode(self, type_, unique_choice, type_name):
+        number_of_bits, aligned = self.get_choice_index_number_of_bits(type_)
+        lines = [
+            '{} = ({})decoder_read_non_negative_binary_integer(decoder_p, {});'.format(
+                unique_choice,
+                type_name,
+                number_of_bits)
+        ]
+
+        if aligned:
+            lines.insert(0, 'decoder_align(decoder_p);')
+
+        return lines
+
+    def format_integer_inner(self, type_, checker):
+        range_ = (checker.maximum - checker.minimum + 1)
+
+        if range_ <= 255:
+            return super(_Generator, self).format_integer_inner(type_, checker)
+        elif range_ <= 65536:
+            if range_ == 256:
+                number_of_bits = 8
+            else:
+                number_of_bits = 16
+
+            if type_.number_of_bits == number_of_bits:
+                encode_lines, decode_lines = super(
+                    _Generator,
+                    self).format_integer_inner(type_, checker)
+            else:
+                location = self.location_inner()
+                encode_lines = [
+                    'encoder_append_non_negative_binary_integer(',
+                    '    encoder_p,',
+                    '    (uint64_t)(src_p->{} - {}),'.format(
+                        location,
+                        checker.minimum),
+                    '    {});'.format(number_of_bits)
+                ]
+                decode_lines = [
+                    'dst_p->{} = decoder_read_non_negative_binary_integer('.format(
+                        location),
+                    '    decoder_p,',
+                    '    {});'.format(number_of_bits),
+                    'dst_p->{} += {};'.format(location, checker.minimum)
+                ]
+
+            return (['encoder_align(encoder_p);'] + encode_lines,
+                    ['decoder_align(decoder_p);'] + decode_lines)
+        else:
+            return self.format_indefinite_integer_inner(type_, checker)
+
+    def get_integer_bit_field_number_of_bits(self, type_, checker):
+        # Integers with a range of more than 255 values are aligned.
+        if (checker.maximum - checker.minimum + 1) > 255:
+            return None
+
+        return type_.number_of_bits
+
+    def format_indefinite_integer_inner(self, type_, checker):
+        """Integers with a range of more than 64K values are encoded as a
+        length in bytes followed by an octet-aligned value.
+
+        """
+
+        type_name = self.format_type_name(checker.minimum, checker.maximum)
+        location = self.location_inner()
+
+        if checker.minimum < 0:
+            encode_offset = ' + {}u'.format(-checker.minimum)
+            decode_offset = ' - {}u'.format(-checker.minimum)
+        elif checker.minimum > 0:
+            encode_offset = ' - {}u'.format(checker.minimum)
+            decode_offset = ' + {}u'.format(checker.minimum)
+        else:
+            encode_offset = ''
+            decode_offset = ''
+
+        return (
+            [
+                'encoder_append_indefinite_whole_number(',
+                '    encoder_p,',
+                '    (uint64_t)src_p->{}{},'.format(location, encode_offset),
+                '    {});'.format(type_.number_of_indefinite_bits)
+            ],
+            [
+                'dst_p->{} = ({})(decoder_read_indefinite_whole_number('.format(
+                    location,
+                    type_name),
+                '    decoder_p,',
+                '    {},'.format(type_.number_of_indefinite_bits),
+                '    {}){});'.format((type_.number_of_bits + 7) // 8,
+                                     decode_offset)
+            ]
+        )
+
+    def format_bit_string_inner(self, type_, checker):
+        if checker.minimum != checker.maximum:
+            return self.format_bit_string_buffer_inner(type_, checker)
+
+        encode_lines, decode_lines = super(
+            _Generator,
+            self).format_bit_string_inner(type_, checker)
+
+        if type_.maximum > 16:
+            encode_lines = ['encoder_align(encoder_p);'] + encode_lines
+            decode_lines = ['decoder_align(decoder_p);'] + decode_lines
+
+        return encode_lines, decode_lines
+
+    def format_bit_string_buffer_inner(self, type_, checker):
+        """The bits of variable size BIT STRINGs are octet-aligned after
+        their length.
+
+        """
+
+        if checker.minimum == checker.maximum:
+            return super(_Generator, self).format_bit_string_buffer_inner(
+                type_,
+                checker)
+
+        location = self.location_inner('', '.')
+        encode_lines, decode_lines = self.format_length_inner(type_, checker)
+        bits_encode_lines, bits_decode_lines = self.format_bit_string_bits_inner(
+            'src_p->{}length'.format(location),
+            'dst_p->{}length'.format(location))
+
+        return (encode_lines + ['encoder_align(encoder_p);'] + bits_encode_lines,
+                decode_lines + ['decoder_align(decoder_p);'] + bits_decode_lines)
+
+    def format_length_inner(self, type_, checker):
+        """Returns encode and decode lines of the length determinant of given
+        variable size OCTET STRING or SEQUENCE OF type.
+
+        """
+
+        location = self.location_inner('', '.')
+        number_of_bits, aligned = get_length_number_of_bits(type_, checker)
+        encode_lines = [
+            'encoder_append_non_negative_binary_integer(',
+            '    encoder_p,',
+            '    src_p->{}length - {}u,'.format(location, checker.minimum),
+            '    {});'.format(number_of_bits)
+        ]
+        decode_lines = [
+            'dst_p->{}length = decoder_read_non_negative_binary_integer('.format(
+                location),
+            '    decoder_p,',
+            '    {});'.format(number_of_bits),
+            'dst_p->{}length += {}u;'.format(location, checker.minimum)
+        ]
+
+        if aligned:
+            encode_lines.insert(0, 'encoder_align(encoder_p);')
+            decode_lines.insert(0, 'decoder_align(decoder_p);')
+
+        if not uper.does_bits_match_range(number_of_bits,
+                                          checker.minimum,
+                                          checker.maximum):
+            decode_lines += [
+                '',
+                'if (dst_p->{}length > {}u) {{'.format(location, checker.maximum),
+                '    decoder_abort(decoder_p, EBADLENGTH);',
+                '',
+                '    return;',
+                '}'
+            ]
+
+        return encode_lines, decode_lines + ['']
+
+    def format_octet_string_inner(self, type_, checker):
+        location = self.location_inner('', '.')
+
+        if checker.minimum == checker.maximum:
+            encode_lines, decode_lines = super(
+                _Generator,
+                self).format_octet_string_inner(type_, checker)
+
+            if checker.maximum > 2:
+                encode_lines = ['encoder_align(encoder_p);'] + encode_lines
+                decode_lines = ['decoder_align(decoder_p);'] + decode_lines
+
+            return encode_lines, decode_lines
+
+        if self.is_octet_string_arena(checker):
+            read_prefix = 'dst_p->{}buf = decoder_read_bytes_arena('.format(location)
+            read_lines = [
+                '{}decoder_p,'.format(read_prefix),
+                '{}dst_p->{}length);'.format(' ' * len(read_prefix), location)
+            ]
+            encode_buf = 'src_p->{}buf'.format(location)
+        else:
+            read_lines = [
+                'decoder_read_bytes(decoder_p,',
+                '                   &dst_p->{}buf[0],'.format(location),
+                '                   dst_p->{}length);'.format(location)
+            ]
+            encode_buf = '&src_p->{}buf[0]'.format(location)
+
+        encode_lines, decode_lines = self.format_length_inner(type_, checker)
+        encode_lines += [
+            'encoder_align(encoder_p);',
+            'encoder_append_bytes(encoder_p,',
+            '                     {},'.format(encode_buf),
+            '                     src_p->{}length);'.format(location)
+        ]
+        decode_lines += ['decoder_align(decoder_p);'] + read_lines
+
+        return encode_lines, decode_lines
+
+    def is_restricted_string_aligned(self, type_, checker):
+        """Returns True if the characters of given fixed size restricted
+        character string type are octet-aligned, otherwise False.
+
+        """
+
+        return type_.bits_per_character * checker.maximum > 16
+
+    def format_restricted_string_inner(self, type_, checker):
+        location = self.location_inner('', '.')
+        characters_encode_lines, characters_decode_lines = \
+            self.format_restricted_string_characters_inner(type_, checker)
+
+        if checker.minimum == checker.maximum:
+            if self.is_restricted_string_aligned(type_, checker):
+                characters_encode_lines.insert(0, 'encoder_align(encoder_p);')
+                characters_decode_lines.insert(0, 'decoder_align(decoder_p);')
+
+            return characters_encode_lines, characters_decode_lines
+
+        encode_lines, decode_lines = self.format_length_inner(type_, checker)
+
+        # Empty strings are not aligned.
+        if checker.maximum > 1:
+            encode_lines += [
+                '',
+                'if (src_p->{}length > 0) {{'.format(location),
+                '    encoder_align(encoder_p);',
+                '}',
+                ''
+            ]
+            decode_lines += [
+                'if (dst_p->{}length > 0) {{'.format(location),
+                '    decoder_align(decoder_p);',
+                '}',
+                ''
+            ]
+
+        return (encode_lines + characters_encode_lines,
+                decode_lines + characters_decode_lines)
+
+    def format_sequence_of_inner(self, type_, checker):
+        if checker.minimum == checker.maximum:
+            return super(_Generator, self).format_sequence_of_inner(type_,
+                                                                    checker)
+
+        type_name = self.format_type_name(0, checker.maximum)
+        unique_i = self.add_unique_variable('{} {{}};'.format(type_name),
+                                            'i')
+
+        with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
+            encode_lines, decode_lines = self.format_type_inner(
+                type_.element_type,
+                checker.element_type)
+
+        location = self.location_inner('', '.')
+        first_encode_lines, first_decode_lines = self.format_length_inner(
+            type_,
+            checker)
+        first_encode_lines += [
+            '',
+            'for ({0} = 0; {0} < src_p->{1}length; {0}++) {{'.format(
+                unique_i,
+                location)
+        ]
+        first_decode_lines += self.format_sequence_of_arena_alloc(checker)
+        first_decode_lines += [
+            'for ({0} = 0; {0} < dst_p->{1}length; {0}++) {{'.format(
+                unique_i,
+                location)
+        ]
+
+        encode_lines = first_encode_lines + indent_lines(encode_lines) + ['}', '']
+        decode_lines = first_decode_lines + indent_lines(decode_lines) + ['}', '']
+
+        return encode_lines, decode_lines
+
+    def get_maximum_encoded_number_of_bits(self, type_, checker):
+        if isinstance(type_, per.Integer):
+            range_ = (checker.maximum - checker.minimum + 1)
+
+            if range_ <= 255:
+                return type_.number_of_bits
+            elif range_ == 256:
+                return 7 + 8
+            elif range_ <= 65536:
+                return 7 + 16
+            else:
+                return (type_.number_of_indefinite_bits
+                        + 7
+                        + 8 * ((type_.number_of_bits + 7) // 8))
+        elif isinstance(type_, per.BitString):
+            return self.get_maximum_encoded_bit_string_number_of_bits(type_,
+                                                                      checker)
+        elif is_object_identifier(type_) or isinstance(type_, per.Real):
+            return 7 + super(_Generator, self).get_maximum_encoded_number_of_bits(
+                type_,
+                checker)
+        else:
+            return super(_Generator, self).get_maximum_encoded_number_of_bits(
+                type_,
+                checker)
+
+    def format_open_type_length_inner(self, size, length):
+        """The length and the value of open types are octet-aligned, so
+        views never need to be copied.
+
+        """
+
+        encode_lines, decode_lines = super(
+            _Generator,
+            self).format_open_type_length_inner(size, length)
+
+        return (['encoder_align(encoder_p);'] + encode_lines,
+                ['decoder_align(decoder_p);'] + decode_lines)
+
+    def format_open_type_view_read(self, length):
+        return 'decoder_read_view(decoder_p, {})'.format(length)
+
+    def format_real_inner(self):
+        encode_lines, decode_lines = super(_Generator, self).format_real_inner()
+
+        return (['encoder_align(encoder_p);'] + encode_lines,
+                ['decoder_align(decoder_p);'] + decode_lines)
+
+    def format_object_identifier_inner(self):
+        encode_lines, decode_lines = super(
+            _Generator,
+            self).format_object_identifier_inner()
+
+        return (['encoder_align(encoder_p);'] + encode_lines,
+                ['decoder_align(decoder_p);'] + decode_lines)
+
+    def get_maximum_encoded_octet_string_number_of_bits(self, type_, checker):
+        number_of_bits = 8 * checker.maximum
+
+        if checker.minimum != checker.maximum:
+            length_number_of_bits, aligned = get_length_number_of_bits(type_,
+                                                                       checker)
+            number_of_bits += length_number_of_bits + 7
+
+            if aligned:
+                number_of_bits += 7
+        elif checker.maximum > 2:
+            number_of_bits += 7
+
+        return number_of_bits
+
+    def get_maximum_encoded_restricted_string_number_of_bits(
+            self,
+            type_,
+            checker):
+        number_of_bits = type_.bits_per_character * checker.maximum
+
+        if checker.minimum != checker.maximum:
+            length_number_of_bits, aligned = get_length_number_of_bits(type_,
+                                                                       checker)
+            number_of_bits += length_number_of_bits
+
+            if aligned:
+                number_of_bits += 7
+
+            if checker.maximum > 1:
+                number_of_bits += 7
+        elif self.is_restricted_string_aligned(type_, checker):
+            number_of_bits += 7
+
+        return number_of_bits
+
+    def get_maximum_encoded_bit_string_number_of_bits(self, type_, checker):
+        number_of_bits = checker.maximum
+
+        if checker.minimum != checker.maximum:
+            length_number_of_bits, aligned = get_length_number_of_bits(type_,
+                                                                       checker)
+            number_of_bits += length_number_of_bits + 7
+
+            if aligned:
+                number_of_bits += 7
+        elif checker.maximum > 16:
+            number_of_bits += 7
+
+        return number_of_bits
+
+    def get_maximum_encoded_sequence_of_number_of_bits(self, type_, checker):
+        element_number_of_bits = self.get_maximum_encoded_number_of_bits(
+            type_.element_type,
+            checker.element_type)
+
+        if element_number_of_bits is None:
+            return None
+
+        number_of_bits = checker.maximum * element_number_of_bits
+
+        if checker.minimum != checker.maximum:
+            length_number_of_bits, aligned = get_length_number_of_bits(type_,
+                                                                       checker)
+            number_of_bits += length_number_of_bits
+
+            if aligned:
+                number_of_bits += 7
+
+        return number_of_bits
+
+    def get_maximum_encoded_choice_number_of_bits(self, type_, checker):
+        number_of_bits = 0
+
+        for member in type_.root_index_to_member.values():
+            member_number_of_bits = self.get_maximum_encoded_number_of_bits(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_number_of_bits is None:
+                return None
+
+            number_of_bits = max(number_of_bits, member_number_of_bits)
+
+        index_number_of_bits, aligned = self.get_choice_index_number_of_bits(type_)
+
+        if aligned:
+            index_number_of_bits += 7
+
+        return index_number_of_bits + number_of_bits
+
+    def get_fixed_skip_size(self, type_, checker):
+        """Returns the encoded size in bits of given type if it does not
+        depend on the encoded data or the alignment, otherwise None.
+
+        """
+
+        if isinstance(type_, per.Integer):
+            if checker.maximum - checker.minimum + 1 > 255:
+                return None
+        elif isinstance(type_, per.BitString):
+            if type_.maximum > 16:
+                return None
+        elif isinstance(type_, per.OctetString):
+            if checker.maximum > 2:
+                return None
+        elif is_restricted_string(type_):
+            if self.is_restricted_string_aligned(type_, checker):
+                return None
+
+        return super(_Generator, self).get_fixed_skip_size(type_, checker)
+
+    def format_type_skip(self, type_, checker):
+        """Referenced INTEGER types are always inlined, and so are their
+        skips.
+
+        """
+
+        if is_user_type(type_) and not self.is_complex_user_type(type_):
+            return self.format_type_skip_inner(type_, checker)
+
+        return super(_Generator, self).format_type_skip(type_, checker)
+
+    def format_type_skip_inner(self, type_, checker):
+        if self.get_fixed_skip_size(type_, checker) is not None:
+            pass
+        elif isinstance(type_, per.Integer):
+            return self.format_integer_skip(type_, checker)
+        elif isinstance(type_, per.BitString):
+            if checker.minimum == checker.maximum:
+                return (['decoder_align(decoder_p);']
+                        + self.format_skip(checker.maximum))
+        elif isinstance(type_, per.OctetString):
+            if checker.minimum == checker.maximum:
+                return (['decoder_align(decoder_p);']
+                        + self.format_skip(8 * checker.maximum))
+        elif isinstance(type_, per.Real):
+            return ['decoder_align(decoder_p);', 'decoder_skip_real(decoder_p);']
+        elif is_object_identifier(type_):
+            return ['decoder_align(decoder_p);', 'decoder_skip_oid(decoder_p);']
+
+        return super(_Generator, self).format_type_skip_inner(type_, checker)
+
+    def format_integer_skip(self, type_, checker):
+        range_ = (checker.maximum - checker.minimum + 1)
+
+        if range_ == 256:
+            return ['decoder_align(decoder_p);'] + self.format_skip(8)
+        elif range_ <= 65536:
+            return ['decoder_align(decoder_p);'] + self.format_skip(16)
+        else:
+            return [
+                '(void)decoder_read_indefinite_whole_number(decoder_p, {}, {});'.format(
+                    type_.number_of_indefinite_bits,
+                    (type_.number_of_bits + 7) // 8)
+            ]
+
+    def format_length_skip(self, type_, checker):
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+        number_of_bits, aligned = get_length_number_of_bits(type_, checker)
+        lines = [
+            '{} = (uint32_t)decoder_read_non_negative_binary_integer('.format(
+                unique_length),
+            '    decoder_p,',
+            '    {});'.format(number_of_bits),
+            '{} += {}u;'.format(unique_length, checker.minimum)
+        ]
+
+        if aligned:
+            lines.insert(0, 'decoder_align(decoder_p);')
+
+        if not uper.does_bits_match_range(number_of_bits,
+                                          checker.minimum,
+                                          checker.maximum):
+            lines += [
+                '',
+                'if ({} > {}u) {{'.format(unique_length, checker.maximum),
+                '    decoder_abort(decoder_p, EBADLENGTH);',
+                '',
+                '    return;',
+                '}'
+            ]
+
+        return unique_length, lines + ['']
+
+    def format_octet_string_skip(self, type_, checker):
+        unique_length, lines = self.format_length_skip(type_, checker)
+
+        return lines + [
+            'decoder_align(decoder_p);',
+            '(void)decoder_free(decoder_p, 8u * {});'.format(unique_length)
+        ]
+
+    def format_bit_string_skip(self, type_, checker):
+        unique_length, lines = self.format_length_skip(type_, checker)
+
+        return lines + [
+            'decoder_align(decoder_p);',
+            '(void)decoder_free(decoder_p, {});'.format(unique_length)
+        ]
+
+    def format_restricted_string_skip(self, type_, checker):
+        if checker.minimum == checker.maximum:
+            lines = self.format_restricted_string_characters_skip(
+                type_,
+                '{}u'.format(checker.maximum))
+
+            if self.is_restricted_string_aligned(type_, checker):
+                lines.insert(0, 'decoder_align(decoder_p);')
+
+            return lines
+
+        unique_length, lines = self.format_length_skip(type_, checker)
+
+        if checker.maximum > 1:
+            lines += [
+                'if ({} > 0) {{'.format(unique_length),
+                '    decoder_align(decoder_p);',
+                '}',
+                ''
+            ]
+
+        return lines + self.format_restricted_string_characters_skip(
+            type_,
+            unique_length)
+
+    def generate_helpers(self, definitions):
+        helpers = []
+
+        for pattern, definition in functions:
+            is_in_helpers = any([pattern in helper for helper in helpers])
+
+            if pattern in definitions or is_in_helpers:
+                helpers.insert(0, definition)
+
+        for additional_helpers in self.additional_helpers.values():
+            helpers.extend([''] + additional_helpers)
+
+        structs = self.format_encoder_and_decoder_structs(ENCODER_AND_DECODER_STRUCTS)
+
+        return [structs] + helpers + ['']
+
+
+def generate(compiled,
+             namespace,
+             view_threshold=None,
+             arena_threshold=None,
+             jer_encoder=False,
+             object_identifiers=None,
+             open_types=None,
+             open_type_views=False,
+             lazy_open_types=False):
+    generator = _Generator(namespace, view_threshold, arena_threshold)
+
+    if object_identifiers is not None:
+        generator.object_identifiers = object_identifiers
+
+    if open_types is not None:
+        generator.open_types = open_types
+
+    generator.open_type_views = open_type_views
+    generator.lazy_open_types = lazy_open_types
+
+    if jer_encoder:
+        generator.jer_generator = jer.Generator(generator)
+
+    return generator.generate(compiled)
@@ -0,0 +1,84 @@
+"""Functions required by the PER C code generator
+
+"""
+
+from .uper_functions import ENCODER_AND_DECODER_STRUCTS
+from .uper_functions import functions as uper_functions
+
+ENCODER_ALIGN = '''
+static ALWAYS_INLINE void encoder_align(struct encoder_t *self_p)
+{
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)((8 - (self_p->pos & 7)) & 7));
+}\
+'''
+
+ENCODER_APPEND_INDEFINITE_WHOLE_NUMBER = '''
+static void encoder_append_indefinite_whole_number(struct encoder_t *self_p,
+                                                   uint64_t value,
+                                                   size_t number_of_length_bits)
+{
+    size_t number_of_bytes;
+
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8) && ((value >> (8 * number_of_bytes)) != 0)) {
+        number_of_bytes++;
+    }
+
+    encoder_append_non_negative_binary_integer(self_p,
+                                               number_of_bytes - 1,
+                                               number_of_length_bits);
+    encoder_align(self_p);
+    encoder_append_non_negative_binary_integer(self_p,
+                                               value,
+                                               8 * number_of_bytes);
+}\
+'''
+
+DECODER_ALIGN = '''
+static ALWAYS_INLINE void decoder_align(struct decoder_t *self_p)
+{
+    (void)decoder_free(self_p, (size_t)((8 - (self_p->pos & 7)) & 7));
+}\
+'''
+
+DECODER_READ_INDEFINITE_WHOLE_NUMBER = '''
+static uint64_t decoder_read_indefinite_whole_number(struct decoder_t *self_p,
+                                                     size_t number_of_length_bits,
+                                                     size_t maximum_number_of_bytes)
+{
+    size_t number_of_bytes;
+
+    number_of_bytes = (size_t)decoder_read_non_negative_binary_integer(
+        self_p,
+        number_of_length_bits);
+    number_of_bytes++;
+
+    if (number_of_bytes > maximum_number_of_bytes) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    decoder_align(self_p);
+
+    return (decoder_read_non_negative_binary_integer(self_p,
+                                                     8 * number_of_bytes));
+}\
+'''
+
+functions = [
+    (
+        'decoder_read_indefinite_whole_number(',
+        DECODER_READ_INDEFINITE_WHOLE_NUMBER
+    ),
+    ('decoder_align(', DECODER_ALIGN),
+    (
+        'encoder_append_indefinite_whole_number(',
+        ENCODER_APPEND_INDEFINITE_WHOLE_NUMBER
+    ),
+    ('encoder_align(', ENCODER_ALIGN)
+] + uper_functions
@@ -3,14 +3,19 @@
 """
 import textwrap
 
-from .utils import ENCODER_AND_DECODER_STRUCTS
 from .utils import Generator
 from .utils import camel_to_snake_case
 from .utils import is_user_type
 from .utils import indent_lines
 from .utils import dedent_lines
 from .utils import canonical
+from .utils import is_restricted_string
+from .utils import is_object_identifier
+from .utils import is_open_type
+from .utils import OID_MAXIMUM_CONTENTS_SIZE
+from .uper_functions import ENCODER_AND_DECODER_STRUCTS
 from .uper_functions import functions
+from . import jer
 from ...codecs import uper
 
 
@@ -18,82 +23,210 @@ def does_bits_match_range(number_of_bits, minimum, maximum):
     return 2 ** number_of_bits == (maximum - minimum + 1)
 
 
+def format_map(name, values):
+    """Returns a lookup table of given name and values.
+
+    """
+
+    lines = ['static const uint8_t {}[{}] = {{'.format(name, len(values))]
+
+    for i in range(0, len(values), 12):
+        lines.append('    ' + ' '.join(['0x{:02x},'.format(value)
+                                        for value in values[i:i + 12]]))
+
+    lines[-1] = lines[-1][:-1]
+
+    return lines + ['};']
+
+
 class _Generator(Generator):
 
+    codec = uper
+
+    def __init__(self, namespace, view_threshold=None, arena_threshold=None):
+        super(_Generator, self).__init__(namespace,
+                                         view_threshold,
+                                         arena_threshold)
+        self.restricted_string_map_names = {}
+        self.additional_helpers = {}
+
     def format_real(self):
-        return []
+        return ['double']
+
+    def format_octet_string(self, checker):
+        if self.is_octet_string_view(checker):
+            raise self.error('OCTET STRING views are not supported by UPER.')
+
+        return super(_Generator, self).format_octet_string(checker)
+
+    def format_restricted_string(self, type_, checker):
+        if checker.has_upper_bound() and checker.maximum > 65535:
+            raise self.error(
+                '{} with a maximum size of more than 65535 characters is not '
+                'supported by UPER.'.format(type_.__class__.__name__))
+
+        return super(_Generator, self).format_restricted_string(type_, checker)
+
+    def format_bit_string(self, type_, checker):
+        if checker.has_upper_bound() and checker.maximum > 65535:
+            raise self.error(
+                'BIT STRING with a maximum size of more than 65535 bits is '
+                'not supported by UPER.')
+
+        return super(_Generator, self).format_bit_string(type_, checker)
+
+    def format_open_type(self, type_):
+        lines = super(_Generator, self).format_open_type(type_)
+
+        if ((self.open_type_views or self.lazy_open_types)
+            and self.arena_threshold is None):
+            raise self.error('Open type views require an arena in UPER.')
+
+        return lines
+
+    def get_restricted_string_map_name(self, type_):
+        """Returns the name prefix of the encode and decode lookup tables of
+        the permitted alphabet of given restricted character string
+        type. Types with equal alphabets share tables.
+
+        """
+
+        permitted_alphabet = type_.permitted_alphabet
+        key = (tuple(sorted(permitted_alphabet.encode_map.items())),
+               type_.bits_per_character)
+
+        if key in self.restricted_string_map_names:
+            return self.restricted_string_map_names[key]
+
+        if permitted_alphabet is type_.PERMITTED_ALPHABET:
+            name = camel_to_snake_case(type_.__class__.__name__)
+        else:
+            name = self.location
+
+        if name in self.additional_helpers:
+            name += '_{}'.format(type_.bits_per_character)
+
+        # 0xff is never a valid index or character as all alphabets
+        # are ASCII.
+        encode_map = 256 * [0xff]
+        decode_map = (1 << type_.bits_per_character) * [0xff]
+
+        for char, index in permitted_alphabet.encode_map.items():
+            encode_map[char] = index
+
+        for index, char in permitted_alphabet.decode_map.items():
+            decode_map[index] = char
+
+        self.additional_helpers[name] = (
+            format_map('{}_encode_map'.format(name), encode_map)
+            + ['']
+            + format_map('{}_decode_map'.format(name), decode_map))
+        self.restricted_string_map_names[key] = name
+
+        return name
+
+    def is_restricted_string_alphabet_complete(self, type_):
+        """Returns True if all indexes that fit in the number of bits per
+        character are valid, otherwise False.
+
+        """
+
+        return (len(type_.permitted_alphabet.decode_map)
+                == 1 << type_.bits_per_character)
 
     def get_enumerated_values(self, type_):
         return sorted([(canonical(data), value)
                        for data, value in type_.root_data_to_value.items()])
 
+    def get_enumerated_names(self, type_):
+        return list(type_.root_data_to_value.items())
+
     def get_choice_members(self, type_):
         return type_.root_index_to_member.values()
 
     def format_default(self, type_):
-        if isinstance(type_, uper.Boolean):
+        if isinstance(type_, self.codec.Boolean):
             return str(type_.default).lower()
-        elif isinstance(type_, uper.Enumerated):
+        elif isinstance(type_, self.codec.Enumerated):
             return self.format_default_enumerated(type_)
         else:
             return str(type_.default)
 
     def format_type(self, type_, checker):
-        if isinstance(type_, uper.Integer):
+        if isinstance(type_, self.codec.Integer):
             return self.format_integer(checker)
-        elif isinstance(type_, uper.Boolean):
+        elif isinstance(type_, self.codec.Boolean):
             return self.format_boolean()
-        elif isinstance(type_, uper.Real):
+        elif isinstance(type_, self.codec.Real):
             return self.format_real()
-        elif isinstance(type_, uper.Null):
+        elif isinstance(type_, self.codec.Null):
             return []
+        elif is_open_type(type_):
+            return self.format_open_type(type_)
+        elif self.is_recursive_user_type(type_):
+            return self.format_recursive_user_type(type_)
         elif is_user_type(type_):
             return self.format_user_type(type_.type_name,
                                          type_.module_name)
-        elif isinstance(type_, uper.OctetString):
+        elif isinstance(type_, self.codec.OctetString):
             return self.format_octet_string(checker)
-        elif isinstance(type_, uper.Sequence):
+        elif is_restricted_string(type_):
+            return self.format_restricted_string(type_, checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier(type_)
+        elif isinstance(type_, self.codec.Sequence):
             return self.format_sequence(type_, checker)
-        elif isinstance(type_, uper.Choice):
+        elif isinstance(type_, self.codec.Choice):
             return self.format_choice(type_, checker)
-        elif isinstance(type_, uper.SequenceOf):
+        elif isinstance(type_, self.codec.SequenceOf):
             return self.format_sequence_of(type_, checker)
-        elif isinstance(type_, uper.Enumerated):
+        elif isinstance(type_, self.codec.Enumerated):
             return self.format_enumerated(type_)
-        elif isinstance(type_, uper.BitString):
+        elif isinstance(type_, self.codec.BitString):
             return self.format_bit_string(type_, checker)
         else:
             raise self.error(
                 "Unsupported type '{}'.".format(type_.type_name))
 
     def generate_type_declaration_process(self, type_, checker):
-        if isinstance(type_, uper.Integer):
+        if isinstance(type_, self.codec.Integer):
             lines = self.format_integer(checker)
             lines[0] += ' value;'
-        elif isinstance(type_, uper.Boolean):
+        elif isinstance(type_, self.codec.Boolean):
             lines = self.format_boolean()
             lines[0] += ' value;'
-        elif isinstance(type_, uper.Real):
+        elif isinstance(type_, self.codec.Real):
             lines = self.format_real()
-        elif isinstance(type_, uper.Enumerated):
+            lines[0] += ' value;'
+        elif isinstance(type_, self.codec.Enumerated):
             lines = self.format_enumerated(type_)
             lines[0] += ' value;'
-        elif isinstance(type_, uper.Sequence):
+        elif isinstance(type_, self.codec.Sequence):
             lines = self.format_sequence(type_, checker)[1:-1]
             lines = dedent_lines(lines)
-        elif isinstance(type_, uper.SequenceOf):
+        elif isinstance(type_, self.codec.SequenceOf):
             lines = self.format_sequence_of(type_, checker)[1:-1]
             lines = dedent_lines(lines)
-        elif isinstance(type_, uper.Choice):
+        elif isinstance(type_, self.codec.Choice):
             lines = self.format_choice(type_, checker)
             lines = dedent_lines(lines[1:-1])
-        elif isinstance(type_, uper.OctetString):
+        elif isinstance(type_, self.codec.OctetString):
             lines = self.format_octet_string(checker)[1:-1]
             lines = dedent_lines(lines)
-        elif isinstance(type_, uper.BitString):
+        elif is_restricted_string(type_):
+            lines = self.format_restricted_string(type_, checker)[1:-1]
+            lines = dedent_lines(lines)
+        elif isinstance(type_, self.codec.BitString):
             lines = self.format_bit_string(type_, checker)
+
+            if self.is_bit_string_buffer(checker):
+                lines = dedent_lines(lines[1:-1])
+            else:
+                lines[0] += ' value;'
+        elif is_object_identifier(type_):
+            lines = self.format_object_identifier(type_)
             lines[0] += ' value;'
-        elif isinstance(type_, uper.Null):
+        elif isinstance(type_, self.codec.Null):
             lines = []
         else:
             raise self.error(
@@ -102,25 +235,29 @@ class _Generator(Generator):
         return lines
 
     def generate_definition_inner_process(self, type_, checker):
-        if isinstance(type_, uper.Integer):
+        if isinstance(type_, self.codec.Integer):
             return self.format_integer_inner(type_, checker)
-        elif isinstance(type_, uper.Boolean):
+        elif isinstance(type_, self.codec.Boolean):
             return self.format_boolean_inner()
-        elif isinstance(type_, uper.Real):
+        elif isinstance(type_, self.codec.Real):
             return self.format_real_inner()
-        elif isinstance(type_, uper.Sequence):
+        elif isinstance(type_, self.codec.Sequence):
             return self.format_sequence_inner(type_, checker)
-        elif isinstance(type_, uper.SequenceOf):
+        elif isinstance(type_, self.codec.SequenceOf):
             return self.format_sequence_of_inner(type_, checker)
-        elif isinstance(type_, uper.Choice):
+        elif isinstance(type_, self.codec.Choice):
             return self.format_choice_inner(type_, checker)
-        elif isinstance(type_, uper.OctetString):
+        elif isinstance(type_, self.codec.OctetString):
             return self.format_octet_string_inner(type_, checker)
-        elif isinstance(type_, uper.BitString):
-            return self.format_bit_string_inner(type_)
-        elif isinstance(type_, uper.Enumerated):
+        elif is_restricted_string(type_):
+            return self.format_restricted_string_inner(type_, checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier_inner()
+        elif isinstance(type_, self.codec.BitString):
+            return self.format_bit_string_inner(type_, checker)
+        elif isinstance(type_, self.codec.Enumerated):
             return self.format_enumerated_inner(type_)
-        elif isinstance(type_, uper.Null):
+        elif isinstance(type_, self.codec.Null):
             return self.format_null_inner()
         else:
             return [], []
@@ -160,7 +297,10 @@ class _Generator(Generator):
                 ]
             )
 
-    def format_bit_string_inner(self, type_):
+    def format_bit_string_inner(self, type_, checker):
+        if self.is_bit_string_buffer(checker):
+            return self.format_bit_string_buffer_inner(type_, checker)
+
         location = self.location_inner()
 
         return (
@@ -178,6 +318,41 @@ class _Generator(Generator):
             ]
         )
 
+    def format_bit_string_buffer_inner(self, type_, checker):
+        """Whole bytes are copied, or shifted a word at a time if not
+        aligned, instead of appending or reading one bit at a time.
+
+        """
+
+        if checker.minimum == checker.maximum:
+            return self.format_bit_string_bits_inner(checker.maximum,
+                                                     checker.maximum)
+
+        location = self.location_inner('', '.')
+        encode_lines, decode_lines = self.format_length_inner(type_, checker)
+        bits_encode_lines, bits_decode_lines = self.format_bit_string_bits_inner(
+            'src_p->{}length'.format(location),
+            'dst_p->{}length'.format(location))
+
+        return (encode_lines + bits_encode_lines,
+                decode_lines + bits_decode_lines)
+
+    def format_bit_string_bits_inner(self, encode_length, decode_length):
+        location = self.location_inner('', '.')
+
+        return (
+            [
+                'encoder_append_bit_string(encoder_p,',
+                '                          &src_p->{}buf[0],'.format(location),
+                '                          {});'.format(encode_length)
+            ],
+            [
+                'decoder_read_bit_string(decoder_p,',
+                '                        &dst_p->{}buf[0],'.format(location),
+                '                        {});'.format(decode_length)
+            ]
+        )
+
     def format_boolean_inner(self):
         return (
             [
@@ -191,12 +366,27 @@ class _Generator(Generator):
         )
 
     def format_real_inner(self):
-        return [], []
+        """REAL is encoded as a length determinant followed by the X.690
+        binary encoding of the value.
+
+        """
+
+        return (
+            [
+                'encoder_append_real(encoder_p, src_p->{});'.format(
+                    self.location_inner())
+            ],
+            [
+                'dst_p->{} = decoder_read_real(decoder_p);'.format(
+                    self.location_inner())
+            ]
+        )
 
     def format_sequence_inner(self, type_, checker):
         encode_lines = []
         decode_lines = []
         member_name_to_is_present = {}
+        fields = []
 
         if type_.additions is not None:
 
@@ -208,33 +398,57 @@ class _Generator(Generator):
                 encode_lines.append('    return;')
                 encode_lines.append('}')
 
-            encode_lines.append('encoder_append_bool(encoder_p, false);')
-
             if len(type_.additions) > 0:
                 unique_extension_present = \
                     self.add_unique_decode_variable('bool {};', 'extension_is_present')
-                decode_lines.append(
-                    'extension_is_present = decoder_read_bool(decoder_p);')
+                fields.append((
+                    1,
+                    None,
+                    ['{} = ({{}} != 0u);'.format(unique_extension_present)],
+                    ['encoder_append_bool(encoder_p, false);'],
+                    ['extension_is_present = decoder_read_bool(decoder_p);']))
             else:
-                decode_lines.append('decoder_read_bool(decoder_p);')
+                fields.append((
+                    1,
+                    None,
+                    [],
+                    ['encoder_append_bool(encoder_p, false);'],
+                    ['decoder_read_bool(decoder_p);']))
 
         for member in type_.root_members:
 
             if member.optional:
                 name = '{}is_{}_present'.format(self.location_inner('', '.'),
                                                 canonical(member.name))
-                encode_lines.append(
-                    'encoder_append_bool(encoder_p, src_p->{});'.format(
-                        name))
-                decode_lines.append(
-                    'dst_p->{} = decoder_read_bool(decoder_p);'.format(
-                        name))
+                fields.append((
+                    1,
+                    '(uint64_t)src_p->{}'.format(name),
+                    ['dst_p->{} = ({{}} != 0u);'.format(name)],
+                    ['encoder_append_bool(encoder_p, src_p->{});'.format(name)],
+                    ['dst_p->{} = decoder_read_bool(decoder_p);'.format(name)]))
             elif member.default is not None:
+                self.append_bit_fields(encode_lines, decode_lines, fields)
                 unique_is_present = self.add_unique_decode_variable('bool {};',
                                                                     'is_present')
                 member_name_to_is_present[member.name] = unique_is_present
 
-                if self.is_buffer_type(member):
+                if (self.is_buffer_type(member)
+                    and self.is_octet_string_arena(
+                        self.get_member_checker(checker, member.name))):
+                    default_variable = canonical(member.name) + '_default'
+
+                    encode_lines += [
+                        'encoder_append_bool(encoder_p, (src_p->{}{}.length != sizeof({})) ||'.format(
+                            self.location_inner('', '.'),
+                            canonical(member.name),
+                            default_variable),
+                        '                               (memcmp(src_p->{}{}.buf, {}, sizeof({})) != 0));'.format(
+                            self.location_inner('', '.'),
+                            canonical(member.name),
+                            default_variable,
+                            default_variable)
+                    ]
+                elif self.is_buffer_type(member):
                     default_variable = canonical(member.name) + '_default'
 
                     encode_lines += [
@@ -248,6 +462,12 @@ class _Generator(Generator):
                             canonical(member.name),
                             default_variable)
                     ]
+                elif is_restricted_string(member):
+                    encode_lines.append(
+                        'encoder_append_bool(encoder_p, {});'.format(
+                            self.format_restricted_string_default_condition(
+                                member,
+                                self.get_member_checker(checker, member.name))))
                 else:
                     encode_lines.append(
                         'encoder_append_bool(encoder_p, src_p->{}{}{} != {});'.format(
@@ -260,6 +480,13 @@ class _Generator(Generator):
                         unique_is_present))
 
         for member in type_.root_members:
+            field = self.get_bit_field(member, checker)
+
+            if field is not None:
+                fields.append(field)
+                continue
+
+            self.append_bit_fields(encode_lines, decode_lines, fields)
             (member_encode_lines,
              member_decode_lines) = self.format_sequence_inner_member(
                  member,
@@ -269,6 +496,8 @@ class _Generator(Generator):
             encode_lines += member_encode_lines
             decode_lines += member_decode_lines
 
+        self.append_bit_fields(encode_lines, decode_lines, fields)
+
         if type_.additions is not None and len(type_.additions) > 0:
             decode_lines.append('if({}) {{'.format(unique_extension_present))
             decode_lines.append('    decoder_abort(decoder_p, EINVAL);')
@@ -277,9 +506,206 @@ class _Generator(Generator):
 
         return encode_lines, decode_lines
 
+    def get_bit_field(self, member, checker):
+        """Returns given SEQUENCE member as a bit field if it is always
+        present and is a boolean or an integer encoded with a fixed
+        number of bits, otherwise None.
+
+        A bit field is its number of bits, its value as an uint64_t
+        expression, format strings of lines storing the value read,
+        and the lines encoding and decoding it on its own.
+
+        """
+
+        if member.optional or member.default is not None:
+            return None
+
+        # Field selective decoding reads members one by one.
+        if self.field_by_member_name is not None:
+            return None
+
+        if not isinstance(member, (self.codec.Integer, self.codec.Boolean)):
+            return None
+
+        if is_user_type(member):
+            return None
+
+        member_checker = self.get_member_checker(checker, member.name)
+
+        if isinstance(member, self.codec.Boolean):
+            number_of_bits = 1
+        else:
+            number_of_bits = self.get_integer_bit_field_number_of_bits(
+                member,
+                member_checker)
+
+            if number_of_bits is None:
+                return None
+
+        if not 1 <= number_of_bits <= 57:
+            return None
+
+        name = '{}{}'.format(self.location_inner('', '.'),
+                             canonical(member.name))
+
+        if isinstance(member, self.codec.Boolean):
+            value = '(uint64_t)src_p->{}'.format(name)
+            decode_fmts = ['dst_p->{} = ({{}} != 0u);'.format(name)]
+        else:
+            minimum = member_checker.minimum
+            type_name = self.format_type_name(minimum, member_checker.maximum)
+
+            if minimum == 0:
+                value = '(uint64_t)src_p->{}'.format(name)
+            else:
+                value = '(uint64_t)(src_p->{} - {})'.format(name, minimum)
+
+            value = '({} & 0x{:x}u)'.format(value, (1 << number_of_bits) - 1)
+
+            if minimum == 0:
+                decode_fmt = '{}'
+            elif minimum > 0:
+                decode_fmt = '({{}} + {}u)'.format(minimum)
+            else:
+                decode_fmt = '((int64_t){{}} - {})'.format(-minimum)
+
+            decode_fmts = ['dst_p->{} = ({}){};'.format(name,
+                                                        type_name,
+                                                        decode_fmt)]
+
+        encode_lines, decode_lines = self.format_sequence_inner_member(member,
+                                                                       checker,
+                                                                       {})
+
+        return (number_of_bits, value, decode_fmts, encode_lines, decode_lines)
+
+    def get_integer_bit_field_number_of_bits(self, type_, checker):
+        return type_.number_of_bits
+
+    def append_bit_fields(self, encode_lines, decode_lines, fields):
+        """Append consecutive bit fields to given lines, and empty the list
+        of fields. Fields are grouped in regions of at most 57 bits,
+        which are encoded and decoded with a single bounds check.
+
+        """
+
+        regions = []
+        number_of_bits = 58
+
+        for field in fields:
+            if number_of_bits + field[0] > 57:
+                regions.append([])
+                number_of_bits = 0
+
+            regions[-1].append(field)
+            number_of_bits += field[0]
+
+        for region in regions:
+            if len(region) == 1:
+                encode_lines += region[0][3]
+                decode_lines += region[0][4]
+            else:
+                (region_encode_lines,
+                 region_decode_lines) = self.format_bit_fields(region)
+                encode_lines += region_encode_lines
+                decode_lines += region_decode_lines
+
+        del fields[:]
+
+    def format_bit_fields(self, fields):
+        """All fields are written with a single bit write and read with a
+        single bit read, after a single bounds check. The fields are
+        zero if out of data, just as when read one by one.
+
+        """
+
+        unique_pos = self.add_unique_decode_variable('ssize_t {};', 'pos')
+        unique_bits = self.add_unique_decode_variable('uint64_t {};', 'bits')
+        number_of_bits = sum([field[0] for field in fields])
+        values = []
+        decode_lines = []
+        shift = number_of_bits
+
+        for size, value, decode_fmts, _, _ in fields:
+            shift -= size
+            mask = '0x{:x}u'.format((1 << size) - 1)
+
+            if value is not None:
+                if shift > 0:
+                    value = '({} << {})'.format(value, shift)
+
+                values.append(value)
+
+            if shift == 0 and size == number_of_bits:
+                bits = unique_bits
+            elif shift == 0:
+                bits = '({} & {})'.format(unique_bits, mask)
+            elif shift + size == number_of_bits:
+                bits = '({} >> {})'.format(unique_bits, shift)
+            else:
+                bits = '(({} >> {}) & {})'.format(unique_bits, shift, mask)
+
+            for decode_fmt in decode_fmts:
+                decode_lines.append(decode_fmt.format(bits))
+
+        if not values:
+            values = ['0']
+
+        prefix = '                       '
+        encode_lines = [
+            '',
+            'if (encoder_alloc(encoder_p, {}) >= 0) {{'.format(number_of_bits),
+            '    encoder_write_bits(encoder_p,',
+            '{}{}'.format(prefix, values[0])
+        ]
+
+        for value in values[1:]:
+            encode_lines.append('{}| {}'.format(prefix, value))
+
+        encode_lines[-1] += ','
+        encode_lines += [
+            '{}{});'.format(prefix, number_of_bits),
+            '}',
+            ''
+        ]
+        decode_lines = [
+            '',
+            '{} = decoder_free(decoder_p, {});'.format(unique_pos,
+                                                       number_of_bits),
+            '',
+            'if ({} >= 0) {{'.format(unique_pos),
+            '    {} = decoder_read_bits(decoder_p, (size_t){}, {});'.format(
+                unique_bits,
+                unique_pos,
+                number_of_bits),
+            '} else {',
+            '    {} = 0;'.format(unique_bits),
+            '}',
+            ''
+        ] + decode_lines + [
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
     def format_octet_string_inner(self, type_, checker):
         location = self.location_inner('', '.')
 
+        if self.is_octet_string_arena(checker):
+            read_prefix = 'dst_p->{}buf = decoder_read_bytes_arena('.format(location)
+            read_lines = [
+                '{}decoder_p,'.format(read_prefix),
+                '{}dst_p->{}length);'.format(' ' * len(read_prefix), location)
+            ]
+            encode_buf = 'src_p->{}buf'.format(location)
+        else:
+            read_lines = [
+                'decoder_read_bytes(decoder_p,',
+                '                   &dst_p->{}buf[0],'.format(location),
+                '                   dst_p->{}length);'.format(location)
+            ]
+            encode_buf = '&src_p->{}buf[0]'.format(location)
+
         if checker.minimum == checker.maximum:
             encode_lines = [
                 'encoder_append_bytes(encoder_p,',
@@ -298,7 +724,7 @@ class _Generator(Generator):
                 '    src_p->{}length - {}u,'.format(location, checker.minimum),
                 '    {});'.format(type_.number_of_bits),
                 'encoder_append_bytes(encoder_p,',
-                '                     &src_p->{}buf[0],'.format(location),
+                '                     {},'.format(encode_buf),
                 '                     src_p->{}length);'.format(location)
             ]
             decode_lines = [
@@ -322,13 +748,88 @@ class _Generator(Generator):
                     ''
                 ]
 
+            decode_lines += read_lines
+
+        return encode_lines, decode_lines
+
+    def format_length_inner(self, type_, checker):
+        """Returns encode and decode lines of the length determinant of given
+        variable size type.
+
+        """
+
+        location = self.location_inner('', '.')
+        encode_lines = [
+            'encoder_append_non_negative_binary_integer(',
+            '    encoder_p,',
+            '    src_p->{}length - {}u,'.format(location, checker.minimum),
+            '    {});'.format(type_.number_of_bits)
+        ]
+        decode_lines = [
+            'dst_p->{}length = decoder_read_non_negative_binary_integer('.format(
+                location),
+            '    decoder_p,',
+            '    {});'.format(type_.number_of_bits),
+            'dst_p->{}length += {}u;'.format(location, checker.minimum)
+        ]
+
+        if not does_bits_match_range(type_.number_of_bits,
+                                     checker.minimum,
+                                     checker.maximum):
             decode_lines += [
-                'decoder_read_bytes(decoder_p,',
-                '                   &dst_p->{}buf[0],'.format(location),
-                '                   dst_p->{}length);'.format(location)
+                '',
+                'if (dst_p->{}length > {}u) {{'.format(location, checker.maximum),
+                '    decoder_abort(decoder_p, EBADLENGTH);',
+                '',
+                '    return;',
+                '}'
             ]
 
-        return encode_lines, decode_lines
+        return encode_lines, decode_lines + ['']
+
+    def format_restricted_string_inner(self, type_, checker):
+        if checker.minimum == checker.maximum:
+            return self.format_restricted_string_characters_inner(type_, checker)
+
+        encode_lines, decode_lines = self.format_length_inner(type_, checker)
+        characters_encode_lines, characters_decode_lines = \
+            self.format_restricted_string_characters_inner(type_, checker)
+
+        return (encode_lines + characters_encode_lines,
+                decode_lines + characters_decode_lines)
+
+    def format_restricted_string_characters_inner(self, type_, checker):
+        """Each character is mapped to and from its index in the permitted
+        alphabet using lookup tables.
+
+        """
+
+        location = self.location_inner('', '.')
+        map_name = self.get_restricted_string_map_name(type_)
+
+        if checker.minimum == checker.maximum:
+            encode_length = '{}u'.format(checker.maximum)
+            decode_length = encode_length
+        else:
+            encode_length = 'src_p->{}length'.format(location)
+            decode_length = 'dst_p->{}length'.format(location)
+
+        return (
+            [
+                'encoder_append_string(encoder_p,',
+                '                      &src_p->{}buf[0],'.format(location),
+                '                      {},'.format(encode_length),
+                '                      &{}_encode_map[0],'.format(map_name),
+                '                      {});'.format(type_.bits_per_character)
+            ],
+            [
+                'decoder_read_string(decoder_p,',
+                '                    &dst_p->{}buf[0],'.format(location),
+                '                    {},'.format(decode_length),
+                '                    &{}_decode_map[0],'.format(map_name),
+                '                    {});'.format(type_.bits_per_character)
+            ]
+        )
 
     def format_user_type_inner(self, type_name, module_name):
         module_name_snake = camel_to_snake_case(module_name)
@@ -349,6 +850,160 @@ class _Generator(Generator):
 
         return encode_lines, decode_lines
 
+    def format_open_type_length_inner(self, size, length):
+        return (
+            ['encoder_append_open_type_length(encoder_p, {});'.format(size)],
+            ['{} = decoder_read_open_type_length(decoder_p);'.format(length)]
+        )
+
+    def format_open_type_view_read(self, length):
+        return 'decoder_read_view_arena(decoder_p, {})'.format(length)
+
+    def format_open_type_inner(self, type_):
+        """The value is encoded after its size, which is calculated by
+        encoding it once without writing anything. It is decoded by
+        the function of the type selected by the key member.
+
+        """
+
+        if self.lazy_open_types:
+            return self.format_lazy_open_type_inner()
+
+        key_member_name, alternatives = self.get_open_type(type_)
+        key = canonical(key_member_name)
+        location = self.location_inner()
+        unique_size = self.add_unique_encode_variable('ssize_t {};', 'size')
+        unique_length = self.add_unique_decode_variable('size_t {};', 'length')
+        unique_start_pos = self.add_unique_variable('ssize_t {};', 'start_pos')
+        size_lines = []
+        encode_lines = []
+        decode_lines = []
+
+        for key_values, type_name, module_name, name in alternatives:
+            prefix = self.get_user_type_prefix(type_name, module_name)
+            member = '{}.{}'.format(location, name)
+            case_lines = ['case {}:'.format(key_value) for key_value in key_values]
+            size_lines += case_lines + [
+                '    {} = {}_encoded_size(&src_p->{});'.format(unique_size,
+                                                               prefix,
+                                                               member),
+                '    break;',
+                ''
+            ]
+            encode_lines += case_lines + [
+                '    {}_encode_inner(encoder_p, &src_p->{});'.format(prefix,
+                                                                     member),
+                '    break;',
+                ''
+            ]
+            decode_lines += case_lines + [
+                '    {}_decode_inner(decoder_p, &dst_p->{});'.format(prefix,
+                                                                     member),
+                '    break;',
+                ''
+            ]
+
+        if self.open_type_views:
+            unknown = '{}.unknown'.format(location)
+            size_lines += [
+                'default:',
+                '    {} = (ssize_t)src_p->{}.size;'.format(unique_size, unknown)
+            ]
+            encode_lines += [
+                'default:',
+                '    encoder_append_bytes(encoder_p,',
+                '                         src_p->{}.buf,'.format(unknown),
+                '                         src_p->{}.size);'.format(unknown)
+            ]
+            decode_lines += [
+                'default:',
+                '    dst_p->{}.buf = {};'.format(
+                    unknown,
+                    self.format_open_type_view_read(unique_length)),
+                '    dst_p->{}.size = {};'.format(unknown, unique_length)
+            ]
+        else:
+            size_lines += [
+                'default:',
+                '    {} = -EBADCHOICE;'.format(unique_size)
+            ]
+            encode_lines += [
+                'default:'
+            ]
+            decode_lines += [
+                'default:',
+                '    decoder_abort(decoder_p, EBADCHOICE);'
+            ]
+
+        length_encode_lines, length_decode_lines = \
+            self.format_open_type_length_inner(unique_size, unique_length)
+
+        encode_lines = [
+            '',
+            'switch (src_p->{}) {{'.format(key),
+            ''
+        ] + size_lines + [
+            '    break;',
+            '}',
+            ''
+        ] + length_encode_lines + [
+            '{} = encoder_p->pos;'.format(unique_start_pos),
+            '',
+            'switch (src_p->{}) {{'.format(key),
+            ''
+        ] + encode_lines + [
+            '    break;',
+            '}',
+            '',
+            'encoder_end_open_type(encoder_p, {}, {});'.format(unique_start_pos,
+                                                               unique_size)
+        ]
+        decode_lines = length_decode_lines + [
+            '{} = decoder_p->pos;'.format(unique_start_pos),
+            '',
+            'switch (dst_p->{}) {{'.format(key),
+            ''
+        ] + decode_lines + [
+            '    break;',
+            '}',
+            '',
+            'decoder_end_open_type(decoder_p, {}, {});'.format(unique_start_pos,
+                                                               unique_length)
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_lazy_open_type_inner(self):
+        """The encoded value is kept as is, and decoded by the generated
+        decode function of the member when needed.
+
+        """
+
+        location = self.location_inner()
+        size = '(ssize_t)src_p->{}.size'.format(location)
+        unique_length = self.add_unique_decode_variable('size_t {};', 'length')
+        unique_start_pos = self.add_unique_encode_variable('ssize_t {};',
+                                                           'start_pos')
+        encode_lines, decode_lines = self.format_open_type_length_inner(
+            size,
+            unique_length)
+        encode_lines += [
+            '{} = encoder_p->pos;'.format(unique_start_pos),
+            'encoder_append_bytes(encoder_p,',
+            '                     src_p->{}.buf,'.format(location),
+            '                     src_p->{}.size);'.format(location),
+            'encoder_end_open_type(encoder_p, {}, {});'.format(unique_start_pos,
+                                                               size)
+        ]
+        decode_lines += [
+            'dst_p->{}.buf = {};'.format(
+                location,
+                self.format_open_type_view_read(unique_length)),
+            'dst_p->{}.size = {};'.format(location, unique_length)
+        ]
+
+        return encode_lines, decode_lines
+
     def format_choice_inner(self, type_, checker):
         encode_lines = []
         decode_lines = []
@@ -371,11 +1026,9 @@ class _Generator(Generator):
 
             index = type_.root_name_to_index[member.name]
 
-            choice_encode_lines = [
-                'encoder_append_non_negative_binary_integer(encoder_p, {}, {});'.format(
-                    index,
-                    type_.root_number_of_bits)
-            ] + choice_encode_lines + [
+            choice_encode_lines = self.format_choice_index_encode(
+                type_,
+                index) + choice_encode_lines + [
                 'break;'
             ]
             encode_lines += [
@@ -409,11 +1062,10 @@ class _Generator(Generator):
             ''
         ]
 
-        decode_lines = [
-            '{} = ({})decoder_read_non_negative_binary_integer(decoder_p, {});'.format(
-                unique_choice,
-                type_name,
-                type_.root_number_of_bits),
+        decode_lines = self.format_choice_index_decode(
+            type_,
+            unique_choice,
+            type_name) + [
             '',
             'switch ({}) {{'.format(unique_choice),
             ''
@@ -427,6 +1079,21 @@ class _Generator(Generator):
 
         return encode_lines, decode_lines
 
+    def format_choice_index_encode(self, type_, index):
+        return [
+            'encoder_append_non_negative_binary_integer(encoder_p, {}, {});'.format(
+                index,
+                type_.root_number_of_bits)
+        ]
+
+    def format_choice_index_decode(self, type_, unique_choice, type_name):
+        return [
+            '{} = ({})decoder_read_non_negative_binary_integer(decoder_p, {});'.format(
+                unique_choice,
+                type_name,
+                type_.root_number_of_bits)
+        ]
+
     def format_enumerated_inner(self, type_):
         type_name = self.format_type_name(0, max(type_.root_data_to_value.values()))
         unique_value = self.add_unique_variable(
@@ -518,9 +1185,29 @@ class _Generator(Generator):
                                             'i')
 
         with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
-            encode_lines, decode_lines = self.format_type_inner(
-                type_.element_type,
-                checker.element_type)
+            element = self.get_sequence_of_bit_field(type_, checker)
+
+            if element is None:
+                encode_lines, decode_lines = self.format_type_inner(
+                    type_.element_type,
+                    checker.element_type)
+
+        location = self.location_inner('', '.')
+
+        if element is not None:
+            if checker.minimum == checker.maximum:
+                encode_length = '{}u'.format(checker.maximum)
+                decode_length = encode_length
+            else:
+                encode_length = 'src_p->{}length'.format(location)
+                decode_length = 'dst_p->{}length'.format(location)
+
+            encode_lines, decode_lines = self.format_sequence_of_bit_fields(
+                element,
+                location,
+                unique_i,
+                encode_length,
+                decode_length)
 
         if checker.minimum == checker.maximum:
             first_encode_lines = first_decode_lines = [
@@ -530,7 +1217,6 @@ class _Generator(Generator):
                     checker.maximum)
             ]
         else:
-            location = self.location_inner('', '.')
             first_encode_lines = [
                 'encoder_append_non_negative_binary_integer(',
                 '    encoder_p,',
@@ -562,50 +1248,725 @@ class _Generator(Generator):
                     ''
                 ]
 
+            first_decode_lines += self.format_sequence_of_arena_alloc(checker)
             first_decode_lines += [
                 'for ({0} = 0; {0} < dst_p->{1}length; {0}++) {{'.format(
                     unique_i,
                     location)
             ]
 
+        if element is not None:
+            # The length is followed by the packed elements instead of
+            # a loop over them.
+            first_encode_lines = first_encode_lines[:-1]
+            first_decode_lines = first_decode_lines[:-1]
+
+            return (first_encode_lines + encode_lines,
+                    first_decode_lines + decode_lines)
+
         encode_lines = first_encode_lines + indent_lines(encode_lines) + ['}', '']
         decode_lines = first_decode_lines + indent_lines(decode_lines) + ['}', '']
 
         return encode_lines, decode_lines
 
+    def get_sequence_of_bit_field(self, type_, checker):
+        """Returns the element type of given SEQUENCE OF as a bit field if
+        it is a boolean, an integer or an enumerated encoded with a
+        fixed number of bits, and the SEQUENCE OF may have enough
+        elements to fill at least one word, otherwise None.
+
+        A bit field is its number of bits, format strings of the
+        element's value as an uint64_t and of the element read from a
+        value, and the largest valid value if decoded values must be
+        checked, otherwise None.
+
+        """
+
+        maximum_length = checker.maximum
+        checker = checker.element_type
+        type_ = type_.element_type
+
+        if is_user_type(type_):
+            return None
+
+        maximum = None
+
+        if isinstance(type_, self.codec.Boolean):
+            number_of_bits = 1
+            value_fmt = '(uint64_t){element}'
+            decode_fmt = '{element} = ({value} != 0u);'
+        elif isinstance(type_, self.codec.Integer):
+            number_of_bits = self.get_integer_bit_field_number_of_bits(type_,
+                                                                       checker)
+
+            if number_of_bits is None:
+                return None
+
+            minimum = checker.minimum
+            type_name = self.format_type_name(minimum, checker.maximum)
+
+            if minimum == 0:
+                value_fmt = '(uint64_t){element}'
+                decode_fmt = '{element} = (' + type_name + '){value};'
+            elif minimum > 0:
+                value_fmt = '(uint64_t)({element} - ' + str(minimum) + ')'
+                decode_fmt = ('{element} = (' + type_name + ')({value} + '
+                              + str(minimum) + 'u);')
+            else:
+                value_fmt = '(uint64_t)({element} - ' + str(minimum) + ')'
+                decode_fmt = ('{element} = (' + type_name + ')((int64_t){value} - '
+                              + str(-minimum) + ');')
+        elif isinstance(type_, self.codec.Enumerated):
+            if any([(type_.root_data_to_index[data]
+                     != type_.root_data_to_value[data])
+                    for data in type_.root_data_to_index]):
+                return None
+
+            number_of_bits = type_.root_number_of_bits
+            number_of_values = len(self.get_enumerated_values(type_))
+
+            if bin(number_of_values).count('1') != 1:
+                maximum = number_of_values - 1
+
+            value_fmt = '(uint64_t){element}'
+            decode_fmt = '{element} = (enum ' + self.location + '_e){value};'
+        else:
+            return None
+
+        if not 1 <= number_of_bits <= 28:
+            return None
+
+        if maximum_length < 57 // number_of_bits:
+            return None
+
+        return (number_of_bits, value_fmt, decode_fmt, maximum)
+
+    def format_sequence_of_bit_fields(self,
+                                      element,
+                                      location,
+                                      unique_i,
+                                      encode_length,
+                                      decode_length):
+        """The elements are encoded and decoded after a single bounds
+        check, packed into 64 bits words written at once, and unpacked
+        from words of at most 57 bits read at once. Remaining elements
+        are written and read one by one.
+
+        """
+
+        number_of_bits, value_fmt, decode_fmt, maximum = element
+        mask = '0x{:x}u'.format((1 << number_of_bits) - 1)
+        encode_count = 64 // number_of_bits
+        decode_count = 57 // number_of_bits
+        unique_j = self.add_unique_variable('uint8_t {};', 'j')
+        unique_bits = self.add_unique_variable('uint64_t {};', 'bits')
+        unique_pos = self.add_unique_decode_variable('ssize_t {};', 'pos')
+        encode_element = 'src_p->{}elements[{} + {}]'.format(location,
+                                                             unique_i,
+                                                             unique_j)
+        decode_element = 'dst_p->{}elements[{} + {}]'.format(location,
+                                                             unique_i,
+                                                             unique_j)
+        encode_value = '({} & {})'.format(value_fmt.format(element=encode_element),
+                                          mask)
+        tail_encode_value = value_fmt.format(
+            element='src_p->{}elements[{}]'.format(location, unique_i))
+
+        if maximum is not None:
+            unique_value = self.add_unique_decode_variable('uint64_t {};',
+                                                           'value')
+            check_lines = [
+                '',
+                'if ({} > {}u) {{'.format(unique_value, maximum),
+                '    decoder_abort(decoder_p, EBADENUM);',
+                '',
+                '    return;',
+                '}',
+                ''
+            ]
+            block_decode_lines = [
+                '{} = (({} >> ({}u - ({}u * {}))) & {});'.format(
+                    unique_value,
+                    unique_bits,
+                    (decode_count - 1) * number_of_bits,
+                    number_of_bits,
+                    unique_j,
+                    mask)
+            ] + check_lines + [
+                decode_fmt.format(element=decode_element, value=unique_value)
+            ]
+            tail_decode_lines = [
+                '{} = decoder_read_bits(decoder_p, (size_t){}, {});'.format(
+                    unique_value,
+                    unique_pos,
+                    number_of_bits)
+            ] + check_lines + [
+                decode_fmt.format(
+                    element='dst_p->{}elements[{}]'.format(location, unique_i),
+                    value=unique_value)
+            ]
+        else:
+            block_decode_lines = [
+                decode_fmt.format(
+                    element=decode_element,
+                    value='(({} >> ({}u - ({}u * {}))) & {})'.format(
+                        unique_bits,
+                        (decode_count - 1) * number_of_bits,
+                        number_of_bits,
+                        unique_j,
+                        mask))
+            ]
+            tail_decode_lines = [
+                decode_fmt.format(
+                    element='dst_p->{}elements[{}]'.format(location, unique_i),
+                    value='decoder_read_bits(decoder_p, (size_t){}, {})'.format(
+                        unique_pos,
+                        number_of_bits))
+            ]
+
+        encode_lines = [
+            '',
+            'if (encoder_alloc(encoder_p, {}u * {}) >= 0) {{'.format(
+                number_of_bits,
+                encode_length),
+            '    for ({0} = 0; ({0} + {1}u) <= {2}; {0} += {1}u) {{'.format(
+                unique_i,
+                encode_count,
+                encode_length),
+            '        {} = 0;'.format(unique_bits),
+            '',
+            '        for ({0} = 0; {0} < {1}u; {0}++) {{'.format(
+                unique_j,
+                encode_count),
+            '            {0} = (({0} << {1}) | {2});'.format(
+                unique_bits,
+                number_of_bits,
+                encode_value),
+            '        }',
+            '',
+            '        encoder_write_bits(encoder_p, {}, {});'.format(
+                unique_bits,
+                encode_count * number_of_bits),
+            '    }',
+            '',
+            '    for (; {0} < {1}; {0}++) {{'.format(unique_i, encode_length),
+            '        encoder_write_bits(encoder_p, {}, {});'.format(
+                tail_encode_value,
+                number_of_bits),
+            '    }',
+            '}',
+            ''
+        ]
+        decode_lines = [
+            '{} = decoder_free(decoder_p, {}u * {});'.format(unique_pos,
+                                                             number_of_bits,
+                                                             decode_length),
+            '',
+            'if ({} < 0) {{'.format(unique_pos),
+            '    return;',
+            '}',
+            '',
+            'for ({0} = 0; ({0} + {1}u) <= {2}; {0} += {1}u) {{'.format(
+                unique_i,
+                decode_count,
+                decode_length),
+            '    {} = decoder_read_bits(decoder_p, (size_t){}, {});'.format(
+                unique_bits,
+                unique_pos,
+                decode_count * number_of_bits),
+            '    {} += {};'.format(unique_pos, decode_count * number_of_bits),
+            '',
+            '    for ({0} = 0; {0} < {1}u; {0}++) {{'.format(
+                unique_j,
+                decode_count)
+        ] + indent_lines(indent_lines(block_decode_lines)) + [
+            '    }',
+            '}',
+            '',
+            'for (; {0} < {1}; {0}++) {{'.format(unique_i, decode_length)
+        ] + indent_lines(tail_decode_lines) + [
+            '    {} += {};'.format(unique_pos, number_of_bits),
+            '}',
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
     def format_type_inner(self, type_, checker):
-        if isinstance(type_, uper.Integer):
+        if isinstance(type_, self.codec.Integer):
             return self.format_integer_inner(type_, checker)
-        elif isinstance(type_, uper.Real):
+        elif isinstance(type_, self.codec.Real):
             return self.format_real_inner()
-        elif isinstance(type_, uper.Null):
+        elif isinstance(type_, self.codec.Null):
             return [], []
-        elif isinstance(type_, uper.Boolean):
+        elif isinstance(type_, self.codec.Boolean):
             return self.format_boolean_inner()
+        elif is_open_type(type_):
+            return self.format_open_type_inner(type_)
+        elif self.is_recursive_user_type(type_):
+            return self.format_recursive_user_type_inner(type_)
         elif is_user_type(type_):
             return self.format_user_type_inner(type_.type_name,
                                                type_.module_name)
-        elif isinstance(type_, uper.OctetString):
+        elif isinstance(type_, self.codec.OctetString):
             return self.format_octet_string_inner(type_, checker)
-        elif isinstance(type_, uper.Sequence):
+        elif is_restricted_string(type_):
+            return self.format_restricted_string_inner(type_, checker)
+        elif is_object_identifier(type_):
+            return self.format_object_identifier_inner()
+        elif isinstance(type_, self.codec.Sequence):
             return self.format_sequence_inner(type_, checker)
-        elif isinstance(type_, uper.Choice):
+        elif isinstance(type_, self.codec.Choice):
             return self.format_choice_inner(type_, checker)
-        elif isinstance(type_, uper.SequenceOf):
+        elif isinstance(type_, self.codec.SequenceOf):
             return self.format_sequence_of_inner(type_, checker)
-        elif isinstance(type_, uper.Enumerated):
+        elif isinstance(type_, self.codec.Enumerated):
             return self.format_enumerated_inner(type_)
-        elif isinstance(type_, uper.BitString):
-            return self.format_bit_string_inner(type_)
+        elif isinstance(type_, self.codec.BitString):
+            return self.format_bit_string_inner(type_, checker)
         else:
             raise self.error(type_)
 
+    def get_maximum_encoded_size(self, type_, checker):
+        number_of_bits = self.get_maximum_encoded_number_of_bits(type_, checker)
+
+        if number_of_bits is None:
+            return None
+
+        return (number_of_bits + 7) // 8
+
+    def get_maximum_encoded_number_of_bits(self, type_, checker):
+        if isinstance(type_, self.codec.Integer):
+            return type_.number_of_bits
+        elif isinstance(type_, self.codec.Boolean):
+            return 1
+        elif isinstance(type_, self.codec.Real):
+            # Length octet, control octet, two exponent octets and a 53
+            # bits mantissa.
+            return 8 + 8 * 10
+        elif isinstance(type_, self.codec.Null):
+            return 0
+        elif isinstance(type_, self.codec.OctetString):
+            return self.get_maximum_encoded_octet_string_number_of_bits(type_,
+                                                                        checker)
+        elif is_restricted_string(type_):
+            return self.get_maximum_encoded_restricted_string_number_of_bits(
+                type_,
+                checker)
+        elif isinstance(type_, self.codec.Sequence):
+            return self.get_maximum_encoded_sequence_number_of_bits(type_, checker)
+        elif isinstance(type_, self.codec.Choice):
+            return self.get_maximum_encoded_choice_number_of_bits(type_, checker)
+        elif isinstance(type_, self.codec.SequenceOf):
+            return self.get_maximum_encoded_sequence_of_number_of_bits(type_,
+                                                                       checker)
+        elif isinstance(type_, self.codec.Enumerated):
+            return type_.root_number_of_bits
+        elif isinstance(type_, self.codec.BitString):
+            return self.get_maximum_encoded_bit_string_number_of_bits(type_,
+                                                                      checker)
+        elif is_object_identifier(type_):
+            return 8 + 8 * OID_MAXIMUM_CONTENTS_SIZE
+        else:
+            return None
+
+    def get_maximum_encoded_octet_string_number_of_bits(self, type_, checker):
+        number_of_bits = 8 * checker.maximum
+
+        if checker.minimum != checker.maximum:
+            number_of_bits += type_.number_of_bits
+
+        return number_of_bits
+
+    def get_maximum_encoded_bit_string_number_of_bits(self, type_, checker):
+        number_of_bits = checker.maximum
+
+        if checker.minimum != checker.maximum:
+            number_of_bits += type_.number_of_bits
+
+        return number_of_bits
+
+    def get_maximum_encoded_restricted_string_number_of_bits(
+            self,
+            type_,
+            checker):
+        number_of_bits = type_.bits_per_character * checker.maximum
+
+        if checker.minimum != checker.maximum:
+            number_of_bits += type_.number_of_bits
+
+        return number_of_bits
+
+    def get_maximum_encoded_sequence_number_of_bits(self, type_, checker):
+        number_of_bits = 0
+
+        if type_.additions is not None:
+            number_of_bits += 1
+
+        for member in type_.root_members:
+            if member.optional or member.default is not None:
+                number_of_bits += 1
+
+            member_number_of_bits = self.get_maximum_encoded_number_of_bits(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_number_of_bits is None:
+                return None
+
+            number_of_bits += member_number_of_bits
+
+        return number_of_bits
+
+    def get_maximum_encoded_choice_number_of_bits(self, type_, checker):
+        number_of_bits = 0
+
+        for member in type_.root_index_to_member.values():
+            member_number_of_bits = self.get_maximum_encoded_number_of_bits(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_number_of_bits is None:
+                return None
+
+            number_of_bits = max(number_of_bits, member_number_of_bits)
+
+        return type_.root_number_of_bits + number_of_bits
+
+    def get_maximum_encoded_sequence_of_number_of_bits(self, type_, checker):
+        element_number_of_bits = self.get_maximum_encoded_number_of_bits(
+            type_.element_type,
+            checker.element_type)
+
+        if element_number_of_bits is None:
+            return None
+
+        number_of_bits = checker.maximum * element_number_of_bits
+
+        if checker.minimum != checker.maximum:
+            number_of_bits += type_.number_of_bits
+
+        return number_of_bits
+
+    def get_fixed_skip_size(self, type_, checker):
+        """Returns the encoded size in bits of given type if it does not
+        depend on the encoded data, otherwise None.
+
+        """
+
+        if isinstance(type_, self.codec.Integer):
+            return type_.number_of_bits
+        elif isinstance(type_, self.codec.Boolean):
+            return 1
+        elif isinstance(type_, self.codec.Null):
+            return 0
+        elif isinstance(type_, self.codec.BitString):
+            if checker.minimum == checker.maximum:
+                return checker.maximum
+        elif isinstance(type_, self.codec.OctetString):
+            if checker.minimum == checker.maximum:
+                return 8 * checker.maximum
+        elif is_restricted_string(type_):
+            # All characters are valid only if the alphabet is complete.
+            if (checker.minimum == checker.maximum
+                and self.is_restricted_string_alphabet_complete(type_)):
+                return type_.bits_per_character * checker.maximum
+        elif isinstance(type_, self.codec.Enumerated):
+            # All indexes are valid only if the number of values is a
+            # power of two.
+            if bin(len(self.get_enumerated_values(type_))).count('1') == 1:
+                return type_.root_number_of_bits
+        elif isinstance(type_, self.codec.Sequence):
+            return self.get_fixed_skip_sequence_size(type_, checker)
+        elif isinstance(type_, self.codec.SequenceOf):
+            if checker.minimum == checker.maximum:
+                element_size = self.get_fixed_skip_size(type_.element_type,
+                                                        checker.element_type)
+
+                if element_size is not None:
+                    return checker.maximum * element_size
+
+        return None
+
+    def get_fixed_skip_sequence_size(self, type_, checker):
+        if type_.additions:
+            return None
+
+        size = 0
+
+        if type_.additions is not None:
+            size += 1
+
+        for member in type_.root_members:
+            if member.optional or member.default is not None:
+                return None
+
+            member_size = self.get_fixed_skip_size(
+                member,
+                self.get_member_checker(checker, member.name))
+
+            if member_size is None:
+                return None
+
+            size += member_size
+
+        return size
+
+    def format_type_skip_inner(self, type_, checker):
+        size = self.get_fixed_skip_size(type_, checker)
+
+        if size is not None:
+            return self.format_skip(size)
+        elif isinstance(type_, self.codec.OctetString):
+            return self.format_octet_string_skip(type_, checker)
+        elif isinstance(type_, self.codec.BitString):
+            return self.format_bit_string_skip(type_, checker)
+        elif is_restricted_string(type_):
+            return self.format_restricted_string_skip(type_, checker)
+        elif isinstance(type_, self.codec.Real):
+            return ['decoder_skip_real(decoder_p);']
+        elif is_object_identifier(type_):
+            return ['decoder_skip_oid(decoder_p);']
+        elif is_open_type(type_):
+            return self.format_open_type_skip()
+        elif isinstance(type_, self.codec.Sequence):
+            return self.format_sequence_skip(type_, checker)
+        elif isinstance(type_, self.codec.Choice):
+            return self.format_choice_skip(type_, checker)
+        elif isinstance(type_, self.codec.SequenceOf):
+            return self.format_sequence_of_skip(type_, checker)
+        elif isinstance(type_, self.codec.Enumerated):
+            return self.format_enumerated_skip(type_)
+        else:
+            raise self.error(type_)
+
+    def format_length_skip(self, type_, checker):
+        """Read the length of given OCTET STRING or SEQUENCE OF type into a
+        new variable.
+
+        """
+
+        unique_length = self.add_unique_decode_variable('uint32_t {};', 'length')
+        lines = [
+            '{} = (uint32_t)decoder_read_non_negative_binary_integer('.format(
+                unique_length),
+            '    decoder_p,',
+            '    {});'.format(type_.number_of_bits),
+            '{} += {}u;'.format(unique_length, checker.minimum)
+        ]
+
+        if not does_bits_match_range(type_.number_of_bits,
+                                     checker.minimum,
+                                     checker.maximum):
+            lines += [
+                '',
+                'if ({} > {}u) {{'.format(unique_length, checker.maximum),
+                '    decoder_abort(decoder_p, EBADLENGTH);',
+                '',
+                '    return;',
+                '}'
+            ]
+
+        return unique_length, lines + ['']
+
+    def format_octet_string_skip(self, type_, checker):
+        unique_length, lines = self.format_length_skip(type_, checker)
+
+        return lines + [
+            '(void)decoder_free(decoder_p, 8u * {});'.format(unique_length)
+        ]
+
+    def format_bit_string_skip(self, type_, checker):
+        unique_length, lines = self.format_length_skip(type_, checker)
+
+        return lines + [
+            '(void)decoder_free(decoder_p, {});'.format(unique_length)
+        ]
+
+    def format_restricted_string_skip(self, type_, checker):
+        if checker.minimum == checker.maximum:
+            length = '{}u'.format(checker.maximum)
+            lines = []
+        else:
+            length, lines = self.format_length_skip(type_, checker)
+
+        return lines + self.format_restricted_string_characters_skip(type_,
+                                                                     length)
+
+    def format_restricted_string_characters_skip(self, type_, length):
+        if self.is_restricted_string_alphabet_complete(type_):
+            return [
+                '(void)decoder_free(decoder_p, {}u * {});'.format(
+                    type_.bits_per_character,
+                    length)
+            ]
+        else:
+            return [
+                'decoder_skip_string(decoder_p,',
+                '                    {},'.format(length),
+                '                    &{}_decode_map[0],'.format(
+                    self.get_restricted_string_map_name(type_)),
+                '                    {});'.format(type_.bits_per_character)
+            ]
+
+    def format_open_type_skip(self):
+        unique_length = self.add_unique_decode_variable('size_t {};', 'length')
+        _, decode_lines = self.format_open_type_length_inner(None, unique_length)
+
+        return decode_lines + [
+            '(void)decoder_free(decoder_p, 8u * {});'.format(unique_length)
+        ]
+
+    def format_sequence_skip(self, type_, checker):
+        lines = []
+        is_present_by_member_name = {}
+        size = 0
+
+        if type_.additions:
+            lines += [
+                'if (decoder_read_bool(decoder_p)) {',
+                '    decoder_abort(decoder_p, EINVAL);',
+                '',
+                '    return;',
+                '}',
+                ''
+            ]
+        elif type_.additions is not None:
+            size += 1
+
+        for member in type_.root_members:
+            if member.optional or member.default is not None:
+                lines += self.format_skip(size)
+                size = 0
+                unique_is_present = self.add_unique_decode_variable('bool {};',
+                                                                    'is_present')
+                is_present_by_member_name[member.name] = unique_is_present
+                lines.append('{} = decoder_read_bool(decoder_p);'.format(
+                    unique_is_present))
+
+        for member in type_.root_members:
+            member_checker = self.get_member_checker(checker, member.name)
+            member_size = self.get_fixed_skip_size(member, member_checker)
+
+            if member_size is not None and member.name not in is_present_by_member_name:
+                size += member_size
+                continue
+
+            lines += self.format_skip(size)
+            size = 0
+
+            with self.members_backtrace_push(canonical(member.name)):
+                member_lines = self.format_type_skip(member, member_checker)
+
+            if member.name in is_present_by_member_name:
+                member_lines = [
+                    'if ({}) {{'.format(is_present_by_member_name[member.name])
+                ] + indent_lines(member_lines) + [
+                    '}'
+                ]
+
+            lines += member_lines
+
+        return lines + self.format_skip(size)
+
+    def format_choice_skip(self, type_, checker):
+        type_name = self.format_type_name(0, max(type_.root_index_to_member))
+        unique_choice = self.add_unique_decode_variable(
+            '{} {{}};'.format(type_name),
+            'choice')
+        lines = self.format_choice_index_decode(
+            type_,
+            unique_choice,
+            type_name) + [
+            '',
+            'switch ({}) {{'.format(unique_choice),
+            ''
+        ]
+
+        for member in type_.root_index_to_member.values():
+            member_checker = self.get_member_checker(checker, member.name)
+
+            with self.members_backtrace_push(canonical(member.name)):
+                member_lines = self.format_type_skip(member, member_checker)
+
+            lines += [
+                'case {}:'.format(type_.root_name_to_index[member.name])
+            ] + indent_lines(member_lines + ['break;']) + [
+                ''
+            ]
+
+        return lines + [
+            'default:',
+            '    decoder_abort(decoder_p, EBADCHOICE);',
+            '    break;',
+            '}'
+        ]
+
+    def format_sequence_of_skip(self, type_, checker):
+        if checker.minimum == checker.maximum:
+            number_of_elements = '{}u'.format(checker.maximum)
+            lines = []
+        else:
+            number_of_elements, lines = self.format_length_skip(type_, checker)
+
+        element_size = self.get_fixed_skip_size(type_.element_type,
+                                                checker.element_type)
+
+        if element_size == 0:
+            pass
+        elif element_size is not None:
+            lines.append('(void)decoder_free(decoder_p, {} * {}u);'.format(
+                number_of_elements,
+                element_size))
+        else:
+            unique_i = self.add_unique_decode_variable('uint32_t {};', 'i')
+
+            with self.c_members_backtrace_push('elements[{}]'.format(unique_i)):
+                element_lines = self.format_type_skip(type_.element_type,
+                                                      checker.element_type)
+
+            lines += [
+                'for ({ui} = 0; {ui} < {n}; {ui}++) {{'.format(
+                    ui=unique_i,
+                    n=number_of_elements)
+            ] + indent_lines(element_lines) + [
+                '}'
+            ]
+
+        return lines
+
+    def format_enumerated_skip(self, type_):
+        type_name = self.format_type_name(0, max(type_.root_data_to_value.values()))
+        unique_value = self.add_unique_decode_variable(
+            '{} {{}};'.format(type_name),
+            'value')
+
+        return [
+            '{} = decoder_read_non_negative_binary_integer('
+            'decoder_p, {});'.format(unique_value,
+                                     type_.root_number_of_bits),
+            '',
+            'if ({} > {}u) {{'.format(unique_value,
+                                      len(self.get_enumerated_values(type_)) - 1),
+            '    decoder_abort(decoder_p, EBADENUM);',
+            '}'
+        ]
+
+    def get_bit_string_shift(self, checker):
+        return 64 - checker.minimum
+
     def is_complex_user_type(self, type_):
         return is_user_type(type_) and \
-            not isinstance(type_, (uper.Integer, uper.Boolean, uper.Real, uper.Null))
+            not isinstance(type_, (self.codec.Integer,
+                                   self.codec.Boolean,
+                                   self.codec.Real,
+                                   self.codec.Null))
 
     def is_buffer_type(self, type_):
-        return isinstance(type_, uper.OctetString)
+        return isinstance(type_, self.codec.OctetString)
+
+    def is_sequence_type(self, type_):
+        return isinstance(type_, self.codec.Sequence)
 
     def generate_helpers(self, definitions):
         helpers = []
@@ -616,8 +1977,35 @@ class _Generator(Generator):
             if pattern in definitions or is_in_helpers:
                 helpers.insert(0, definition)
 
-        return [ENCODER_AND_DECODER_STRUCTS] + helpers + ['']
+        for additional_helpers in self.additional_helpers.values():
+            helpers.extend([''] + additional_helpers)
+
+        structs = self.format_encoder_and_decoder_structs(ENCODER_AND_DECODER_STRUCTS)
+
+        return [structs] + helpers + ['']
+
+
+def generate(compiled,
+             namespace,
+             view_threshold=None,
+             arena_threshold=None,
+             jer_encoder=False,
+             object_identifiers=None,
+             open_types=None,
+             open_type_views=False,
+             lazy_open_types=False):
+    generator = _Generator(namespace, view_threshold, arena_threshold)
+
+    if object_identifiers is not None:
+        generator.object_identifiers = object_identifiers
+
+    if open_types is not None:
+        generator.open_types = open_types
+
+    generator.open_type_views = open_type_views
+    generator.lazy_open_types = lazy_open_types
 
+    if jer_encoder:
+        generator.jer_generator = jer.Generator(generator)
 
-def generate(compiled, namespace):
-    return _Generator(namespace).generate(compiled)
+    return generator.generate(compiled)
@@ -4,6 +4,36 @@
 
 from .utils import ENCODER_ABORT
 from .utils import DECODER_ABORT
+from .utils import DECODER_ARENA_ALLOC
+from .utils import ENCODER_ENTER
+from .utils import ENCODER_LEAVE
+from .utils import DECODER_ENTER
+from .utils import DECODER_LEAVE
+from .utils import DECODER_READ_BYTES_ARENA
+from .utils import OID_ENCODE
+from .utils import OID_DECODE
+from .utils import DECODER_SKIP_OID
+from .utils import ALWAYS_INLINE
+from .utils import LOAD_UINT64
+from .utils import STORE_UINT64
+
+ENCODER_AND_DECODER_STRUCTS = '''\
+struct encoder_t {{
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+{encoder_members}}};
+
+struct decoder_t {{
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+{decoder_members}}};
+'''
 
 ENCODER_INIT = '''\
 static void encoder_init(struct encoder_t *self_p,
@@ -13,13 +43,25 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (8 * (ssize_t)size);
     self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
 }\
 '''
 
 ENCODER_GET_RESULT = '''
-static ssize_t encoder_get_result(const struct encoder_t *self_p)
+static ssize_t encoder_get_result(struct encoder_t *self_p)
 {
+    size_t i;
+
     if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
         return ((self_p->pos + 7) / 8);
     } else {
         return (self_p->pos);
@@ -28,14 +70,18 @@ static ssize_t encoder_get_result(const struct encoder_t *self_p)
 '''
 
 ENCODER_ALLOC = '''
-static ssize_t encoder_alloc(struct encoder_t *self_p,
-                             size_t size)
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
 {
     ssize_t pos;
 
     if ((self_p->pos + (ssize_t)size) <= self_p->size) {
         pos = self_p->pos;
         self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
     } else {
         pos = -ENOMEM;
         encoder_abort(self_p, ENOMEM);
@@ -45,23 +91,100 @@ static ssize_t encoder_alloc(struct encoder_t *self_p,
 }\
 '''
 
+ENCODER_WRITE_BITS = '''
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}\
+'''
+
+ENCODER_WRITE_BYTES = '''
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}\
+'''
+
 ENCODER_APPEND_BIT = '''
-static void encoder_append_bit(struct encoder_t *self_p,
-                               int value)
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
 {
-    ssize_t pos;
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}\
+'''
 
-    pos = encoder_alloc(self_p, 1);
+ENCODER_APPEND_BIT_STRING = '''
+static void encoder_append_bit_string(struct encoder_t *self_p,
+                                      const uint8_t *buf_p,
+                                      size_t number_of_bits)
+{
+    size_t size;
+    size_t rest;
 
-    if (pos < 0) {
+    if (encoder_alloc(self_p, number_of_bits) < 0) {
         return;
     }
 
-    if ((pos % 8) == 0) {
-        self_p->buf_p[pos / 8] = 0;
-    }
+    size = (number_of_bits / 8u);
+    rest = (number_of_bits % 8u);
+    encoder_write_bytes(self_p, buf_p, size);
 
-    self_p->buf_p[pos / 8] |= (uint8_t)(value << (7 - (pos % 8)));
+    if (rest != 0) {
+        encoder_write_bits(self_p, (uint64_t)(buf_p[size] >> (8u - rest)), rest);
+    }
 }\
 '''
 
@@ -70,117 +193,130 @@ static void encoder_append_bytes(struct encoder_t *self_p,
                                  const uint8_t *buf_p,
                                  size_t size)
 {
-    size_t i;
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}\
+'''
+
+ENCODER_APPEND_STRING = '''
+static void encoder_append_string(struct encoder_t *self_p,
+                                  const char *buf_p,
+                                  size_t length,
+                                  const uint8_t *encode_map_p,
+                                  size_t number_of_bits)
+{
     ssize_t pos;
-    size_t byte_pos;
-    size_t pos_in_byte;
+    size_t i;
+    size_t j;
+    size_t chunk_length;
+    uint64_t chunk;
+    uint8_t value;
+    uint8_t values;
 
-    pos = encoder_alloc(self_p, 8u * size);
+    pos = encoder_alloc(self_p, number_of_bits * length);
 
-    if (pos < 0) {
+    /* Characters are validated also when only calculating the size. */
+    if ((pos < 0) && !self_p->size_only) {
         return;
     }
 
-    byte_pos = ((size_t)pos / 8u);
-    pos_in_byte = ((size_t)pos % 8u);
-
-    if (pos_in_byte == 0u) {
-        (void)memcpy(&self_p->buf_p[byte_pos], buf_p, size);
+    if (number_of_bits > 0) {
+        chunk_length = (56u / number_of_bits);
     } else {
-        for (i = 0; i < size; i++) {
-            self_p->buf_p[byte_pos + i] |= (buf_p[i] >> pos_in_byte);
-            self_p->buf_p[byte_pos + i + 1] = (buf_p[i] << (8u - pos_in_byte));
+        chunk_length = length;
+    }
+
+    /* Pack up to 56 bits of characters per write. All valid indexes
+       are below 0x80, so one test per chunk finds invalid
+       characters. */
+    i = 0;
+
+    while (i < length) {
+        chunk = 0;
+        values = 0;
+
+        for (j = 0; (j < chunk_length) && (i < length); j++) {
+            value = encode_map_p[(uint8_t)buf_p[i]];
+            values |= value;
+            chunk = ((chunk << number_of_bits) | value);
+            i++;
+        }
+
+        if ((values & 0x80) != 0) {
+            encoder_abort(self_p, EBADCHAR);
+
+            return;
+        }
+
+        if (pos >= 0) {
+            encoder_write_bits(self_p, chunk, number_of_bits * j);
         }
     }
 }\
 '''
 
 ENCODER_APPEND_UINT8 = '''
-static void encoder_append_uint8(struct encoder_t *self_p,
-                                 uint8_t value)
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
 {
-    uint8_t buf[1];
-
-    buf[0] = (uint8_t)value;
-
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
 }\
 '''
 
 ENCODER_APPEND_UINT16 = '''
-static void encoder_append_uint16(struct encoder_t *self_p,
-                                  uint16_t value)
+static ALWAYS_INLINE void encoder_append_uint16(struct encoder_t *self_p,
+                                                uint16_t value)
 {
-    uint8_t buf[2];
-
-    buf[0] = (uint8_t)(value >> 8);
-    buf[1] = (uint8_t)value;
-
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_append_non_negative_binary_integer(self_p, value, 16);
 }\
 '''
 
 ENCODER_APPEND_UINT32 = '''
-static void encoder_append_uint32(struct encoder_t *self_p,
-                                  uint32_t value)
+static ALWAYS_INLINE void encoder_append_uint32(struct encoder_t *self_p,
+                                                uint32_t value)
 {
-    uint8_t buf[4];
-
-    buf[0] = (uint8_t)(value >> 24);
-    buf[1] = (uint8_t)(value >> 16);
-    buf[2] = (uint8_t)(value >> 8);
-    buf[3] = (uint8_t)value;
-
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_append_non_negative_binary_integer(self_p, value, 32);
 }\
 '''
 
 ENCODER_APPEND_UINT64 = '''
-static void encoder_append_uint64(struct encoder_t *self_p,
-                                  uint64_t value)
+static ALWAYS_INLINE void encoder_append_uint64(struct encoder_t *self_p,
+                                                uint64_t value)
 {
-    uint8_t buf[8];
-
-    buf[0] = (uint8_t)(value >> 56);
-    buf[1] = (uint8_t)(value >> 48);
-    buf[2] = (uint8_t)(value >> 40);
-    buf[3] = (uint8_t)(value >> 32);
-    buf[4] = (uint8_t)(value >> 24);
-    buf[5] = (uint8_t)(value >> 16);
-    buf[6] = (uint8_t)(value >> 8);
-    buf[7] = (uint8_t)value;
-
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_append_non_negative_binary_integer(self_p, value, 64);
 }\
 '''
 
 ENCODER_APPEND_INT8 = '''
-static void encoder_append_int8(struct encoder_t *self_p,
-                                int8_t value)
+static ALWAYS_INLINE void encoder_append_int8(struct encoder_t *self_p,
+                                              int8_t value)
 {
     encoder_append_uint8(self_p, (uint8_t)value + 128);
 }\
 '''
 
 ENCODER_APPEND_INT16 = '''
-static void encoder_append_int16(struct encoder_t *self_p,
-                                 int16_t value)
+static ALWAYS_INLINE void encoder_append_int16(struct encoder_t *self_p,
+                                               int16_t value)
 {
     encoder_append_uint16(self_p, (uint16_t)value + 32768);
 }\
 '''
 
 ENCODER_APPEND_INT32 = '''
-static void encoder_append_int32(struct encoder_t *self_p,
-                                 int32_t value)
+static ALWAYS_INLINE void encoder_append_int32(struct encoder_t *self_p,
+                                               int32_t value)
 {
     encoder_append_uint32(self_p, (uint32_t)value + 2147483648);
 }\
 '''
 
 ENCODER_APPEND_INT64 = '''
-static void encoder_append_int64(struct encoder_t *self_p,
-                                 int64_t value)
+static ALWAYS_INLINE void encoder_append_int64(struct encoder_t *self_p,
+                                               int64_t value)
 {
     uint64_t u64_value;
 
@@ -192,22 +328,69 @@ static void encoder_append_int64(struct encoder_t *self_p,
 '''
 
 ENCODER_APPEND_BOOL = '''
-static void encoder_append_bool(struct encoder_t *self_p, bool value)
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
 {
     encoder_append_bit(self_p, value ? 1 : 0);
 }\
 '''
 
 ENCODER_APPEND_NON_NEGATIVE_BINARY_INTEGER = '''
-static void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
-                                                       uint64_t value,
-                                                       size_t size)
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
 {
-    size_t i;
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}\
+'''
+
+ENCODER_APPEND_OPEN_TYPE_LENGTH = '''
+static void encoder_append_open_type_length(struct encoder_t *self_p,
+                                            ssize_t size)
+{
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    /* An empty encoding is replaced by a single zero byte. */
+    if (size == 0) {
+        size = 1;
+    }
+
+    if (size < 128) {
+        encoder_append_uint8(self_p, (uint8_t)size);
+    } else if (size < 16384) {
+        encoder_append_uint16(self_p, (uint16_t)(0x8000 | size));
+    } else {
+        /* Fragmented encodings are not supported. */
+        encoder_abort(self_p, EBADLENGTH);
+    }
+}\
+'''
+
+ENCODER_END_OPEN_TYPE = '''
+static void encoder_end_open_type(struct encoder_t *self_p,
+                                  ssize_t start_pos,
+                                  ssize_t size)
+{
+    if (self_p->size < 0) {
+        return;
+    }
 
-    for (i = 0; i < size; i++) {
-        encoder_append_bit(self_p, (value >> (size - i - 1)) & 1);
+    if (size == 0) {
+        size = 1;
     }
+
+    /* Pad with zero bits up to the end of the encoding. */
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)(start_pos + (8 * size) - self_p->pos));
 }\
 '''
 
@@ -234,8 +417,8 @@ static ssize_t decoder_get_result(const struct decoder_t *self_p)
 '''
 
 DECODER_FREE = '''
-static ssize_t decoder_free(struct decoder_t *self_p,
-                            size_t size)
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
 {
     ssize_t pos;
 
@@ -251,8 +434,46 @@ static ssize_t decoder_free(struct decoder_t *self_p,
 }\
 '''
 
+DECODER_LOAD_WINDOW = '''
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}\
+'''
+
+DECODER_READ_BITS = '''
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}\
+'''
+
 DECODER_READ_BIT = '''
-static int decoder_read_bit(struct decoder_t *self_p)
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
 {
     ssize_t pos;
     int value;
@@ -260,7 +481,7 @@ static int decoder_read_bit(struct decoder_t *self_p)
     pos = decoder_free(self_p, 1);
 
     if (pos >= 0) {
-        value = ((self_p->buf_p[pos / 8] >> (7 - (pos % 8))) & 1);
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
     } else {
         value = 0;
     }
@@ -276,8 +497,8 @@ static void decoder_read_bytes(struct decoder_t *self_p,
 {
     size_t i;
     ssize_t pos;
-    size_t byte_pos;
-    size_t pos_in_byte;
+    size_t bit_pos;
+    uint64_t value;
 
     pos = decoder_free(self_p, 8u * size);
 
@@ -285,76 +506,191 @@ static void decoder_read_bytes(struct decoder_t *self_p,
         return;
     }
 
-    byte_pos = ((size_t)pos / 8u);
-    pos_in_byte = ((size_t)pos % 8u);
+    bit_pos = (size_t)pos;
 
-    if (pos_in_byte == 0) {
-        (void)memcpy(buf_p, &self_p->buf_p[byte_pos], size);
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
     } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
         for (i = 0; i < size; i++) {
-            buf_p[i] = (self_p->buf_p[byte_pos + i] << pos_in_byte);
-            buf_p[i] |= (self_p->buf_p[byte_pos + i + 1] >> (8u - pos_in_byte));
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
         }
     }
 }\
 '''
 
-DECODER_READ_UINT8 = '''
-static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+DECODER_READ_BIT_STRING = '''
+static void decoder_read_bit_string(struct decoder_t *self_p,
+                                    uint8_t *buf_p,
+                                    size_t number_of_bits)
 {
-    uint8_t value;
+    size_t size;
+    size_t rest;
 
-    decoder_read_bytes(self_p, &value, sizeof(value));
+    size = (number_of_bits / 8u);
+    rest = (number_of_bits % 8u);
+    decoder_read_bytes(self_p, buf_p, size);
 
-    return (value);
+    if (rest != 0) {
+        buf_p[size] = (uint8_t)(
+            decoder_read_non_negative_binary_integer(self_p, rest) << (8u - rest));
+    }
 }\
 '''
 
-DECODER_READ_UINT16 = '''
-static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+DECODER_READ_STRING = '''
+static void decoder_read_string(struct decoder_t *self_p,
+                                char *buf_p,
+                                size_t length,
+                                const uint8_t *decode_map_p,
+                                size_t number_of_bits)
 {
-    uint8_t buf[2];
+    size_t i;
+    size_t j;
+    size_t chunk_length;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t chunk;
+    uint8_t value;
+    uint8_t values;
+
+    buf_p[length] = '\\0';
+    pos = decoder_free(self_p, number_of_bits * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    if (number_of_bits == 0) {
+        (void)memset(buf_p, decode_map_p[0], length);
+
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+    chunk_length = (56u / number_of_bits);
+
+    /* Unpack up to 56 bits of characters per window load. */
+    for (i = 0; i < length; i += chunk_length) {
+        if (chunk_length > (length - i)) {
+            chunk_length = (length - i);
+        }
+
+        chunk = decoder_read_bits(self_p,
+                                  bit_pos,
+                                  number_of_bits * chunk_length);
+        bit_pos += (number_of_bits * chunk_length);
+        values = 0;
+
+        for (j = chunk_length; j > 0; j--) {
+            value = decode_map_p[chunk & ((1u << number_of_bits) - 1u)];
+            values |= value;
+            buf_p[i + j - 1] = (char)value;
+            chunk >>= number_of_bits;
+        }
 
-    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+        if ((values & 0x80) != 0) {
+            decoder_abort(self_p, EBADCHAR);
 
-    return (((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+            return;
+        }
+    }
 }\
 '''
 
-DECODER_READ_UINT32 = '''
-static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+DECODER_SKIP_STRING = '''
+static void decoder_skip_string(struct decoder_t *self_p,
+                                size_t length,
+                                const uint8_t *decode_map_p,
+                                size_t number_of_bits)
 {
-    uint8_t buf[4];
+    size_t i;
+    size_t j;
+    size_t chunk_length;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t chunk;
+    uint8_t values;
+
+    pos = decoder_free(self_p, number_of_bits * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+    chunk_length = (56u / number_of_bits);
+
+    for (i = 0; i < length; i += chunk_length) {
+        if (chunk_length > (length - i)) {
+            chunk_length = (length - i);
+        }
+
+        chunk = decoder_read_bits(self_p,
+                                  bit_pos,
+                                  number_of_bits * chunk_length);
+        bit_pos += (number_of_bits * chunk_length);
+        values = 0;
+
+        for (j = 0; j < chunk_length; j++) {
+            values |= decode_map_p[chunk & ((1u << number_of_bits) - 1u)];
+            chunk >>= number_of_bits;
+        }
+
+        if ((values & 0x80) != 0) {
+            decoder_abort(self_p, EBADCHAR);
 
-    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+            return;
+        }
+    }
+}\
+'''
 
-    return (((uint32_t)buf[0] << 24)
-            | ((uint32_t)buf[1] << 16)
-            | ((uint32_t)buf[2] << 8)
-            | (uint32_t)buf[3]);
+DECODER_READ_UINT8 = '''
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
 }\
 '''
 
-DECODER_READ_UINT64 = '''
-static uint64_t decoder_read_uint64(struct decoder_t *self_p)
+DECODER_READ_UINT16 = '''
+static ALWAYS_INLINE uint16_t decoder_read_uint16(struct decoder_t *self_p)
 {
-    uint8_t buf[8];
+    return ((uint16_t)decoder_read_non_negative_binary_integer(self_p, 16));
+}\
+'''
 
-    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+DECODER_READ_UINT32 = '''
+static ALWAYS_INLINE uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    return ((uint32_t)decoder_read_non_negative_binary_integer(self_p, 32));
+}\
+'''
 
-    return (((uint64_t)buf[0] << 56)
-            | ((uint64_t)buf[1] << 48)
-            | ((uint64_t)buf[2] << 40)
-            | ((uint64_t)buf[3] << 32)
-            | ((uint64_t)buf[4] << 24)
-            | ((uint64_t)buf[5] << 16)
-            | ((uint64_t)buf[6] << 8)
-            | (uint64_t)buf[7]);
+DECODER_READ_UINT64 = '''
+static ALWAYS_INLINE uint64_t decoder_read_uint64(struct decoder_t *self_p)
+{
+    return (decoder_read_non_negative_binary_integer(self_p, 64));
 }\
 '''
 
 DECODER_READ_INT8 = '''
-static int8_t decoder_read_int8(struct decoder_t *self_p)
+static ALWAYS_INLINE int8_t decoder_read_int8(struct decoder_t *self_p)
 {
     int8_t value;
 
@@ -366,7 +702,7 @@ static int8_t decoder_read_int8(struct decoder_t *self_p)
 '''
 
 DECODER_READ_INT16 = '''
-static int16_t decoder_read_int16(struct decoder_t *self_p)
+static ALWAYS_INLINE int16_t decoder_read_int16(struct decoder_t *self_p)
 {
     int16_t value;
 
@@ -378,7 +714,7 @@ static int16_t decoder_read_int16(struct decoder_t *self_p)
 '''
 
 DECODER_READ_INT32 = '''
-static int32_t decoder_read_int32(struct decoder_t *self_p)
+static ALWAYS_INLINE int32_t decoder_read_int32(struct decoder_t *self_p)
 {
     int32_t value;
 
@@ -390,7 +726,7 @@ static int32_t decoder_read_int32(struct decoder_t *self_p)
 '''
 
 DECODER_READ_INT64 = '''
-static int64_t decoder_read_int64(struct decoder_t *self_p)
+static ALWAYS_INLINE int64_t decoder_read_int64(struct decoder_t *self_p)
 {
     uint64_t value;
 
@@ -402,35 +738,446 @@ static int64_t decoder_read_int64(struct decoder_t *self_p)
 '''
 
 DECODER_READ_BOOL = '''
-static bool decoder_read_bool(struct decoder_t *self_p)
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
 {
     return (decoder_read_bit(self_p) != 0);
 }\
 '''
 
 DECODER_READ_NON_NEGATIVE_BINARY_INTEGER = '''
-static uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
-                                                         size_t size)
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
 {
-    size_t i;
+    ssize_t pos;
     uint64_t value;
 
-    value = 0;
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}\
+'''
+
+DECODER_READ_OPEN_TYPE_LENGTH = '''
+static size_t decoder_read_open_type_length(struct decoder_t *self_p)
+{
+    size_t length;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0) {
+        /* Fragmented encodings are not supported. */
+        if ((length & 0x40u) != 0) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = (((length & 0x3fu) << 8) | decoder_read_uint8(self_p));
+    }
+
+    /* Empty values are encoded as a single zero byte, never as an
+       empty encoding. */
+    if (length == 0) {
+        decoder_abort(self_p, EBADLENGTH);
+    }
+
+    return (length);
+}\
+'''
+
+DECODER_END_OPEN_TYPE = '''
+static void decoder_end_open_type(struct decoder_t *self_p,
+                                  ssize_t start_pos,
+                                  size_t length)
+{
+    ssize_t end_pos;
+
+    if (self_p->size < 0) {
+        return;
+    }
+
+    end_pos = (start_pos + (8 * (ssize_t)length));
+
+    /* The value must fit in its encoding, and any padding is
+       skipped. */
+    if (self_p->pos > end_pos) {
+        decoder_abort(self_p, EBADLENGTH);
+    } else {
+        (void)decoder_free(self_p, (size_t)(end_pos - self_p->pos));
+    }
+}\
+'''
+
+DECODER_READ_VIEW = '''
+static const uint8_t *decoder_read_view(struct decoder_t *self_p,
+                                        size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return (NULL);
+    }
+
+    return (&self_p->buf_p[(size_t)pos / 8u]);
+}\
+'''
+
+DECODER_READ_VIEW_ARENA = '''
+static const uint8_t *decoder_read_view_arena(struct decoder_t *self_p,
+                                              size_t size)
+{
+    /* Data not starting at a byte boundary is copied to the arena. */
+    if ((self_p->pos & 7) != 0) {
+        return (decoder_read_bytes_arena(self_p, size));
+    }
+
+    return (decoder_read_view(self_p, size));
+}\
+'''
+
+ENCODER_APPEND_OID = '''
+static void encoder_append_oid(struct encoder_t *self_p,
+                               const uint32_t *arcs_p,
+                               uint8_t length)
+{
+    uint8_t buf[75];
+    ssize_t size;
+
+    size = oid_encode(&buf[0], arcs_p, length);
+
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    encoder_append_uint8(self_p, (uint8_t)size);
+    encoder_append_bytes(self_p, &buf[0], (size_t)size);
+}\
+'''
+
+DECODER_READ_OID = '''
+static void decoder_read_oid(struct decoder_t *self_p,
+                             uint32_t *arcs_p,
+                             uint8_t *length_p)
+{
+    uint8_t buf[75];
+    uint8_t size;
+    int res;
+
+    size = decoder_read_uint8(self_p);
+
+    if (size > sizeof(buf)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(self_p, &buf[0], size);
+
+    if (self_p->size < 0) {
+        return;
+    }
+
+    res = oid_decode(arcs_p, length_p, &buf[0], size);
+
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+    }
+}\
+'''
+
+REAL_ENCODE = '''
+static uint8_t real_encode(uint8_t *buf_p, double value)
+{
+    uint64_t bits;
+    uint64_t mantissa;
+    int32_t exponent;
+    uint8_t size;
+    uint8_t i;
+
+    (void)memcpy(&bits, &value, sizeof(bits));
+    exponent = (int32_t)((bits >> 52) & 0x7ffu);
+    mantissa = (bits & 0x000fffffffffffffull);
+
+    if (exponent == 0x7ff) {
+        if (mantissa != 0u) {
+            buf_p[0] = 0x42;
+        } else if ((bits >> 63) != 0u) {
+            buf_p[0] = 0x41;
+        } else {
+            buf_p[0] = 0x40;
+        }
+
+        return (1);
+    } else if ((exponent == 0) && (mantissa == 0u)) {
+        /* Plus zero has no contents octets. */
+        if ((bits >> 63) != 0u) {
+            buf_p[0] = 0x43;
+
+            return (1);
+        }
+
+        return (0);
+    }
+
+    if (exponent == 0) {
+        exponent = -1074;
+    } else {
+        mantissa |= 0x0010000000000000ull;
+        exponent -= 1075;
+    }
+
+    /* The mantissa must be odd. Integers and short fractions have
+       many trailing zeros, so remove whole bytes first. */
+    while ((mantissa & 0xffu) == 0u) {
+        mantissa >>= 8;
+        exponent += 8;
+    }
+
+    while ((mantissa & 1u) == 0u) {
+        mantissa >>= 1;
+        exponent++;
+    }
+
+    if ((bits >> 63) != 0u) {
+        buf_p[0] = 0xc0;
+    } else {
+        buf_p[0] = 0x80;
+    }
+
+    if ((exponent >= -128) && (exponent < 128)) {
+        buf_p[1] = (uint8_t)exponent;
+        size = 2;
+    } else {
+        buf_p[0] |= 0x01u;
+        buf_p[1] = (uint8_t)((uint32_t)exponent >> 8);
+        buf_p[2] = (uint8_t)exponent;
+        size = 3;
+    }
+
+    i = 1;
+
+    while ((mantissa >> (8u * i)) != 0u) {
+        i++;
+    }
+
+    size += i;
+
+    for (; i > 0; i--) {
+        buf_p[size - i] = (uint8_t)(mantissa >> (8u * (i - 1u)));
+    }
+
+    return (size);
+}\
+'''
+
+REAL_DECODE = '''
+static int real_decode(double *value_p, const uint8_t *buf_p, uint8_t size)
+{
+    uint8_t control;
+    uint8_t number_of_bytes;
+    uint8_t i;
+    uint64_t mantissa;
+    uint64_t bits;
+    int32_t exponent;
+    int32_t shift;
+
+    bits = 0;
+
+    if (size == 0u) {
+        (void)memcpy(value_p, &bits, sizeof(bits));
+
+        return (0);
+    }
+
+    control = buf_p[0];
+
+    if ((control & 0x80u) == 0u) {
+        if ((size != 1u) || ((control & 0xfcu) != 0x40u)) {
+            /* Decimal encodings are not supported. */
+            return (-EINVAL);
+        }
+
+        if (control == 0x40u) {
+            bits = 0x7ff0000000000000ull;
+        } else if (control == 0x41u) {
+            bits = 0xfff0000000000000ull;
+        } else if (control == 0x42u) {
+            bits = 0x7ff8000000000000ull;
+        } else {
+            bits = 0x8000000000000000ull;
+        }
+
+        (void)memcpy(value_p, &bits, sizeof(bits));
+
+        return (0);
+    }
+
+    /* Base 2 without a scaling factor, as restricted by CER and DER,
+       and an exponent of one to three bytes. Other bases and scaling
+       factors would be encoded differently, and often longer. */
+    number_of_bytes = (uint8_t)((control & 0x03u) + 1u);
+
+    if (((control & 0x3cu) != 0u)
+        || (number_of_bytes == 4u)
+        || (size < (number_of_bytes + 2u))
+        || ((size - number_of_bytes - 1u) > 8u)) {
+        return (-EINVAL);
+    }
+
+    if ((buf_p[1] & 0x80u) != 0u) {
+        exponent = -1;
+    } else {
+        exponent = 0;
+    }
+
+    for (i = 1; i <= number_of_bytes; i++) {
+        exponent = (int32_t)(((uint32_t)exponent << 8) | buf_p[i]);
+    }
+
+    mantissa = 0;
+
+    for (; i < size; i++) {
+        mantissa <<= 8;
+        mantissa |= buf_p[i];
+    }
+
+    if (mantissa != 0u) {
+        /* Canonical encodings of binary64 values have an odd mantissa
+           of at most 53 bits. */
+        while ((mantissa >> 53) != 0u) {
+            if ((mantissa & 1u) != 0u) {
+                return (-EINVAL);
+            }
+
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        while ((mantissa >> 45) == 0u) {
+            mantissa <<= 8;
+            exponent -= 8;
+        }
+
+        while ((mantissa >> 52) == 0u) {
+            mantissa <<= 1;
+            exponent--;
+        }
+
+        exponent += 1075;
+
+        if (exponent >= 0x7ff) {
+            return (-EINVAL);
+        } else if (exponent <= 0) {
+            /* Subnormal number, must be exact. */
+            shift = (1 - exponent);
+
+            if ((shift > 52)
+                || ((mantissa & ((1ull << shift) - 1u)) != 0u)) {
+                return (-EINVAL);
+            }
+
+            mantissa >>= shift;
+            exponent = 0;
+        } else {
+            mantissa &= 0x000fffffffffffffull;
+        }
+
+        bits = (((uint64_t)exponent << 52) | mantissa);
+    }
+
+    if ((control & 0x40u) != 0u) {
+        bits |= 0x8000000000000000ull;
+    }
+
+    (void)memcpy(value_p, &bits, sizeof(bits));
+
+    return (0);
+}\
+'''
+
+ENCODER_APPEND_REAL = '''
+static void encoder_append_real(struct encoder_t *self_p, double value)
+{
+    uint8_t buf[11];
+
+    /* The length determinant is always one byte. */
+    buf[0] = real_encode(&buf[1], value);
+    encoder_append_bytes(self_p, &buf[0], (size_t)buf[0] + 1u);
+}\
+'''
+
+DECODER_READ_REAL = '''
+static double decoder_read_real(struct decoder_t *self_p)
+{
+    uint8_t buf[12];
+    uint8_t size;
+    double value;
+    int res;
+
+    size = decoder_read_uint8(self_p);
+
+    if (size > sizeof(buf)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0.0);
+    }
+
+    decoder_read_bytes(self_p, &buf[0], size);
+
+    if (self_p->size < 0) {
+        return (0.0);
+    }
+
+    res = real_decode(&value, &buf[0], size);
 
-    for (i = 0; i < size; i++) {
-        value <<= 1;
-        value |= (uint64_t)decoder_read_bit(self_p);
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+
+        return (0.0);
     }
 
     return (value);
 }\
 '''
 
+DECODER_SKIP_REAL = '''
+static void decoder_skip_real(struct decoder_t *self_p)
+{
+    (void)decoder_read_real(self_p);
+}\
+'''
+
 functions = [
-    (
-        'decoder_read_non_negative_binary_integer(',
-        DECODER_READ_NON_NEGATIVE_BINARY_INTEGER
-    ),
+    ('decoder_read_view_arena(', DECODER_READ_VIEW_ARENA),
+    ('decoder_read_view(', DECODER_READ_VIEW),
+    ('decoder_end_open_type(', DECODER_END_OPEN_TYPE),
+    ('decoder_read_open_type_length(', DECODER_READ_OPEN_TYPE_LENGTH),
+    ('encoder_end_open_type(', ENCODER_END_OPEN_TYPE),
+    ('encoder_append_open_type_length(', ENCODER_APPEND_OPEN_TYPE_LENGTH),
+    ('decoder_skip_real(', DECODER_SKIP_REAL),
+    ('decoder_read_real(', DECODER_READ_REAL),
+    ('real_decode(', REAL_DECODE),
+    ('decoder_skip_oid(', DECODER_SKIP_OID),
+    ('decoder_read_oid(', DECODER_READ_OID),
+    ('oid_decode(', OID_DECODE),
+    ('decoder_read_string(', DECODER_READ_STRING),
+    ('decoder_skip_string(', DECODER_SKIP_STRING),
     ('decoder_read_bool(', DECODER_READ_BOOL),
     ('decoder_read_int64(', DECODER_READ_INT64),
     ('decoder_read_int32(', DECODER_READ_INT32),
@@ -440,16 +1187,28 @@ functions = [
     ('decoder_read_uint32(', DECODER_READ_UINT32),
     ('decoder_read_uint16(', DECODER_READ_UINT16),
     ('decoder_read_uint8(', DECODER_READ_UINT8),
+    ('decoder_read_bit_string(', DECODER_READ_BIT_STRING),
+    (
+        'decoder_read_non_negative_binary_integer(',
+        DECODER_READ_NON_NEGATIVE_BINARY_INTEGER
+    ),
+    ('decoder_read_bytes_arena(', DECODER_READ_BYTES_ARENA),
     ('decoder_read_bytes(', DECODER_READ_BYTES),
     ('decoder_read_bit(', DECODER_READ_BIT),
+    ('decoder_read_bits(', DECODER_READ_BITS),
+    ('decoder_load_window(', DECODER_LOAD_WINDOW),
     ('decoder_free(', DECODER_FREE),
+    ('decoder_leave(', DECODER_LEAVE),
+    ('decoder_enter(', DECODER_ENTER),
+    ('decoder_arena_alloc(', DECODER_ARENA_ALLOC),
     ('decoder_abort(', DECODER_ABORT),
     ('decoder_get_result(', DECODER_GET_RESULT),
     ('decoder_init(', DECODER_INIT),
-    (
-        'encoder_append_non_negative_binary_integer(',
-        ENCODER_APPEND_NON_NEGATIVE_BINARY_INTEGER
-    ),
+    ('encoder_append_real(', ENCODER_APPEND_REAL),
+    ('real_encode(', REAL_ENCODE),
+    ('encoder_append_oid(', ENCODER_APPEND_OID),
+    ('oid_encode(', OID_ENCODE),
+    ('encoder_append_string(', ENCODER_APPEND_STRING),
     ('encoder_append_bool(', ENCODER_APPEND_BOOL),
     ('encoder_append_int64(', ENCODER_APPEND_INT64),
     ('encoder_append_int32(', ENCODER_APPEND_INT32),
@@ -459,10 +1218,22 @@ functions = [
     ('encoder_append_uint32(', ENCODER_APPEND_UINT32),
     ('encoder_append_uint16(', ENCODER_APPEND_UINT16),
     ('encoder_append_uint8(', ENCODER_APPEND_UINT8),
-    ('encoder_append_bytes(', ENCODER_APPEND_BYTES),
+    ('encoder_append_bit_string(', ENCODER_APPEND_BIT_STRING),
     ('encoder_append_bit(', ENCODER_APPEND_BIT),
+    (
+        'encoder_append_non_negative_binary_integer(',
+        ENCODER_APPEND_NON_NEGATIVE_BINARY_INTEGER
+    ),
+    ('encoder_append_bytes(', ENCODER_APPEND_BYTES),
+    ('encoder_write_bytes(', ENCODER_WRITE_BYTES),
+    ('encoder_write_bits(', ENCODER_WRITE_BITS),
     ('encoder_alloc(', ENCODER_ALLOC),
+    ('encoder_leave(', ENCODER_LEAVE),
+    ('encoder_enter(', ENCODER_ENTER),
     ('encoder_abort(', ENCODER_ABORT),
     ('encoder_get_result(', ENCODER_GET_RESULT),
-    ('encoder_init(', ENCODER_INIT)
+    ('encoder_init(', ENCODER_INIT),
+    ('load_uint64(', LOAD_UINT64),
+    ('store_uint64(', STORE_UINT64),
+    ('ALWAYS_INLINE', ALWAYS_INLINE)
 ]
@@ -2,6 +2,8 @@ import re
 from operator import itemgetter
 
 from ...errors import Error
+from ...errors import CompileError
+from ...codecs import compiler
 
 
 TYPE_DECLARATION_FMT = '''\
@@ -14,6 +16,35 @@ struct {namespace}_{module_name_snake}_{type_name_snake}_t {{
 }};
 '''
 
+RESTRICTED_STRING_TYPE_NAMES = [
+    'NumericString',
+    'PrintableString',
+    'IA5String',
+    'VisibleString'
+]
+
+# The first subidentifier of an OBJECT IDENTIFIER holds two arcs, and
+# every arc fits in five bytes of seven bits each.
+OID_MAXIMUM_NUMBER_OF_ARCS = 16
+OID_MAXIMUM_CONTENTS_SIZE = 5 * (OID_MAXIMUM_NUMBER_OF_ARCS - 1)
+
+OID_ROOT_ARCS = {
+    'itu-t': 0,
+    'ccitt': 0,
+    'iso': 1,
+    'joint-iso-itu-t': 2,
+    'joint-iso-ccitt': 2
+}
+
+MAXIMUM_ENCODED_SIZE_FMT = '''\
+/**
+ * Maximum encoded size of type {type_name} defined in module
+ * {module_name}, in bytes.
+ */
+#define {define_prefix}_MAX_ENCODED_SIZE {size}u
+
+'''
+
 DECLARATION_FMT = '''\
 /**
  * Encode type {type_name} defined in module {module_name}.
@@ -29,19 +60,81 @@ ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode(
     size_t size,
     const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p);
 
+/**
+ * Calculate the encoded size of type {type_name} defined in module
+ * {module_name}, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encoded_size(
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p);
+
 /**
  * Decode type {type_name} defined in module {module_name}.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
- *
+{arena_parameter_doc} *
  * @return Number of bytes decoded or negative error code.
  */
 ssize_t {namespace}_{module_name_snake}_{type_name_snake}_decode(
     struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    const uint8_t *src_p,
+    size_t size{arena_parameter});
+
+/**
+ * Find the end of an encoded value of type {type_name} defined in
+ * module {module_name}, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_skip(
     const uint8_t *src_p,
     size_t size);
+
+/**
+ * Encode given number of values of type {type_name} defined in module
+ * {module_name} after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type {type_name} defined in module
+ * {module_name} encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+{arena_parameter_doc} *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_decode_batch(
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p{arena_parameter});
 '''
 
 DEFINITION_INNER_FMT = '''\
@@ -74,32 +167,337 @@ ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode(
     return (encoder_get_result(&encoder));
 }}
 
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encoded_size(
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p)
+{{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    {namespace}_{module_name_snake}_{type_name_snake}_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}}
+
 ssize_t {namespace}_{module_name_snake}_{type_name_snake}_decode(
     struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    const uint8_t *src_p,
+    size_t size{arena_parameter})
+{{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+{arena_init}    {namespace}_{module_name_snake}_{type_name_snake}_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}}
+
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_skip(
     const uint8_t *src_p,
     size_t size)
 {{
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    {namespace}_{module_name_snake}_{type_name_snake}_decode_inner(&decoder, dst_p);
+    {namespace}_{module_name_snake}_{type_name_snake}_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }}
+
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {{
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        {namespace}_{module_name_snake}_{type_name_snake}_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {{
+            return (res);
+        }}
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }}
+
+    return ((ssize_t)pos);
+}}
+
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_decode_batch(
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p{arena_parameter})
+{{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {{
+        decoder_init(&decoder, &src_p[pos], size - pos);
+{arena_batch_init}        {namespace}_{module_name_snake}_{type_name_snake}_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {{
+            return (res);
+        }}
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }}
+
+    return ((ssize_t)pos);
+}}
+'''
+
+DECODE_FIELDS_DECLARATION_FMT = '''\
+/**
+ * Fields of type {type_name} defined in module {module_name}, to decode
+ * with {namespace}_{module_name_snake}_{type_name_snake}_decode_fields().
+ */
+{field_defines}
+
+/**
+ * Decode given fields of type {type_name} defined in module
+ * {module_name}. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+{arena_parameter_doc} *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_decode_fields(
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields{arena_parameter});
+'''
+
+DECODE_FIELDS_INNER_FMT = '''
+static void {namespace}_{module_name_snake}_{type_name_snake}_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    uint64_t fields)
+{{
+{decode_body}\
+}}
+'''
+
+DECODE_FIELDS_DEFINITION_FMT = '''
+ssize_t {namespace}_{module_name_snake}_{type_name_snake}_decode_fields(
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields{arena_parameter})
+{{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+{arena_init}    {namespace}_{module_name_snake}_{type_name_snake}_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}}
+'''
+
+SKIP_INNER_FMT = '''\
+static void {namespace}_{module_name_snake}_{type_name_snake}_skip_inner(
+    struct decoder_t *decoder_p)
+{{
+{skip_body}\
+}}
+'''
+
+DEFINITION_INNER_DECLARATION_FMT = '''\
+static void {namespace}_{module_name_snake}_{type_name_snake}_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct {namespace}_{module_name_snake}_{type_name_snake}_t *src_p);
+
+static void {namespace}_{module_name_snake}_{type_name_snake}_decode_inner(
+    struct decoder_t *decoder_p,
+    struct {namespace}_{module_name_snake}_{type_name_snake}_t *dst_p);
+
+static void {namespace}_{module_name_snake}_{type_name_snake}_skip_inner(
+    struct decoder_t *decoder_p);
+'''
+
+ARENA_FMT = '''\
+/**
+ * Memory the decoders allocate SEQUENCE OF elements and OCTET STRING
+ * data from. Reset pos to zero to free everything allocated from it.
+ */
+struct {namespace}_arena_t {{
+    uint8_t *buf;
+    size_t size;
+    size_t pos;
+}};
+'''
+
+OPEN_TYPE_FMT = '''\
+/**
+ * Encoded value of an open type, pointing into the decoded data or
+ * the arena.
+ */
+struct {namespace}_open_type_t {{
+    const uint8_t *buf;
+    size_t size;
+}};
+'''
+
+LAZY_OPEN_TYPE_DECLARATION_FMT = '''
+/**
+ * Decode open type member {member_name} of type {type_name} defined in
+ * module {module_name}, which was decoded as a view of its encoding.
+ * Member {key_member_name} selects the decoded union member.
+ *
+ * @param[out] dst_p Decoded value.
+ * @param[in] src_p Decoded data with the view to decode.
+{arena_parameter_doc} *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t {prefix}_decode_{member}(
+    union {location}_t *dst_p,
+    const struct {prefix}_t *src_p{arena_parameter});
+'''
+
+LAZY_OPEN_TYPE_DEFINITION_FMT = '''
+ssize_t {prefix}_decode_{member}(
+    union {location}_t *dst_p,
+    const struct {prefix}_t *src_p{arena_parameter})
+{{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p->{member}.buf, src_p->{member}.size);
+{arena_init}
+    switch (src_p->{key_member}) {{
+
+{cases}    }}
+
+    return (decoder_get_result(&decoder));
+}}
+'''
+
+RECURSION_DEPTH_FMT = '''\
+/**
+ * Maximum nesting depth of recursive types. Deeper values are neither
+ * encoded nor decoded, but fail with EBADDEPTH.
+ */
+#ifndef {namespace_upper}_MAX_RECURSION_DEPTH
+#    define {namespace_upper}_MAX_RECURSION_DEPTH 32
+#endif
+'''
+
+ARENA_PARAMETER_DOC = '''\
+ * @param[in,out] arena_p Memory to allocate decoded data from.
 '''
 
 ENCODER_AND_DECODER_STRUCTS = '''\
-struct encoder_t {
+struct encoder_t {{
     uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
-};
+    bool size_only;
+{encoder_members}}};
 
-struct decoder_t {
+struct decoder_t {{
     const uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
-};
+{decoder_members}}};
+'''
+
+ALWAYS_INLINE = '''
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif\
+'''
+
+LOAD_UINT16 = '''
+static ALWAYS_INLINE uint16_t load_uint16(const uint8_t *buf_p)
+{
+    return ((uint16_t)(((uint16_t)buf_p[0] << 8) | (uint16_t)buf_p[1]));
+}\
+'''
+
+LOAD_UINT32 = '''
+static ALWAYS_INLINE uint32_t load_uint32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | (uint32_t)buf_p[3]);
+}\
+'''
+
+LOAD_UINT64 = '''
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}\
+'''
+
+STORE_UINT16 = '''
+static ALWAYS_INLINE void store_uint16(uint8_t *buf_p, uint16_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 8);
+    buf_p[1] = (uint8_t)value;
+}\
+'''
+
+STORE_UINT32 = '''
+static ALWAYS_INLINE void store_uint32(uint8_t *buf_p, uint32_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 24);
+    buf_p[1] = (uint8_t)(value >> 16);
+    buf_p[2] = (uint8_t)(value >> 8);
+    buf_p[3] = (uint8_t)value;
+}\
+'''
+
+STORE_UINT64 = '''
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}\
 '''
 
 ENCODER_ABORT = '''
@@ -124,6 +522,331 @@ static void decoder_abort(struct decoder_t *self_p,
 }\
 '''
 
+DECODER_ARENA_ALLOC = '''
+static void *decoder_arena_alloc(struct decoder_t *self_p, size_t size)
+{
+    size_t pos;
+
+    /* Keep all allocations aligned for any member type. */
+    pos = ((self_p->arena_p->pos + 7u) & ~(size_t)7u);
+
+    if ((pos > self_p->arena_p->size)
+        || (size > (self_p->arena_p->size - pos))) {
+        decoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    self_p->arena_p->pos = (pos + size);
+
+    return (&self_p->arena_p->buf[pos]);
+}\
+'''
+
+ENCODER_ENTER = '''
+static bool encoder_enter(struct encoder_t *self_p, const void *value_p)
+{
+    if (value_p == NULL) {
+        encoder_abort(self_p, EINVAL);
+
+        return (false);
+    }
+
+    if (self_p->remaining_depth == 0) {
+        encoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}\
+'''
+
+ENCODER_LEAVE = '''
+static void encoder_leave(struct encoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}\
+'''
+
+DECODER_ENTER = '''
+static bool decoder_enter(struct decoder_t *self_p)
+{
+    if (self_p->remaining_depth == 0) {
+        decoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}\
+'''
+
+DECODER_LEAVE = '''
+static void decoder_leave(struct decoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}\
+'''
+
+DECODER_READ_BYTES_ARENA = '''
+static const uint8_t *decoder_read_bytes_arena(struct decoder_t *self_p,
+                                               size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = decoder_arena_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        decoder_read_bytes(self_p, buf_p, size);
+    }
+
+    return (buf_p);
+}\
+'''
+
+
+OID_FMT = '''\
+/**
+ * An OBJECT IDENTIFIER as its arcs.
+ */
+struct {namespace}_oid_t {{
+    uint8_t length;
+    uint32_t arcs[16];
+}};
+'''
+
+OID_VALUE_DECLARATION_FMT = '''\
+/**
+ * OBJECT IDENTIFIER value {value_name} defined in module {module_name}.
+ */
+extern const struct {namespace}_oid_t {namespace}_{module_name_snake}_\
+{value_name_snake}_oid;
+'''
+
+OID_VALUE_DEFINITION_FMT = '''\
+const struct {namespace}_oid_t {namespace}_{module_name_snake}_\
+{value_name_snake}_oid = {{
+    .length = {length},
+    .arcs = {{ {arcs} }}
+}};
+'''
+
+OID_LOOKUP_ENCODED_FMT = '''\
+static const uint8_t *oid_lookup_encoded(const uint32_t *arcs_p,
+                                         uint8_t length,
+                                         size_t *size_p)
+{{
+    const uint8_t *buf_p;
+
+    buf_p = NULL;
+
+    switch (length) {{
+
+{cases}
+    default:
+        break;
+    }}
+
+    return (buf_p);
+}}
+'''
+
+OID_LOOKUP_ARCS_FMT = '''\
+static bool oid_lookup_arcs(uint32_t *arcs_p,
+                            uint8_t *length_p,
+                            const uint8_t *buf_p,
+                            size_t size)
+{{
+    const struct {namespace}_oid_t *oid_p;
+
+    oid_p = NULL;
+
+    switch (size) {{
+
+{cases}
+    default:
+        break;
+    }}
+
+    if (oid_p == NULL) {{
+        return (false);
+    }}
+
+    memcpy(arcs_p, &oid_p->arcs[0], (size_t)oid_p->length * sizeof(uint32_t));
+    *length_p = oid_p->length;
+
+    return (true);
+}}
+'''
+
+OID_LOOKUP_STUBS = '''\
+static const uint8_t *oid_lookup_encoded(const uint32_t *arcs_p,
+                                         uint8_t length,
+                                         size_t *size_p)
+{
+    (void)arcs_p;
+    (void)length;
+    (void)size_p;
+
+    return (NULL);
+}
+
+static bool oid_lookup_arcs(uint32_t *arcs_p,
+                            uint8_t *length_p,
+                            const uint8_t *buf_p,
+                            size_t size)
+{
+    (void)arcs_p;
+    (void)length_p;
+    (void)buf_p;
+    (void)size;
+
+    return (false);
+}\
+'''
+
+OID_ENCODE = '''
+static ssize_t oid_encode(uint8_t *buf_p,
+                          const uint32_t *arcs_p,
+                          uint8_t length)
+{
+    const uint8_t *encoded_p;
+    uint64_t value;
+    size_t size;
+    uint8_t i;
+    unsigned int shift;
+
+    if ((length < 2) || (length > 16)) {
+        return (-EBADLENGTH);
+    }
+
+    /* Named values are copied as they are. */
+    encoded_p = oid_lookup_encoded(arcs_p, length, &size);
+
+    if (encoded_p != NULL) {
+        memcpy(buf_p, encoded_p, size);
+
+        return ((ssize_t)size);
+    }
+
+    if ((arcs_p[0] > 2) || ((arcs_p[0] < 2) && (arcs_p[1] > 39))) {
+        return (-EBADOID);
+    }
+
+    size = 0;
+
+    for (i = 1; i < length; i++) {
+        if (i == 1) {
+            value = (40u * (uint64_t)arcs_p[0] + arcs_p[1]);
+        } else {
+            value = arcs_p[i];
+        }
+
+        shift = 28;
+
+        while ((shift > 0) && ((value >> shift) == 0)) {
+            shift -= 7;
+        }
+
+        while (shift > 0) {
+            buf_p[size] = (uint8_t)(0x80u | ((value >> shift) & 0x7fu));
+            size++;
+            shift -= 7;
+        }
+
+        buf_p[size] = (uint8_t)(value & 0x7fu);
+        size++;
+    }
+
+    return ((ssize_t)size);
+}\
+'''
+
+OID_DECODE = '''
+static int oid_decode(uint32_t *arcs_p,
+                      uint8_t *length_p,
+                      const uint8_t *buf_p,
+                      size_t size)
+{
+    uint64_t value;
+    uint8_t length;
+    size_t i;
+
+    /* Named values are matched on their encoding. */
+    if (oid_lookup_arcs(arcs_p, length_p, buf_p, size)) {
+        return (0);
+    }
+
+    if (size == 0) {
+        return (-EBADLENGTH);
+    }
+
+    if ((buf_p[size - 1] & 0x80u) != 0) {
+        return (-EBADOID);
+    }
+
+    length = 0;
+    value = 0;
+
+    for (i = 0; i < size; i++) {
+        value <<= 7;
+        value |= (buf_p[i] & 0x7fu);
+
+        if (value > 0x10000004full) {
+            return (-EBADOID);
+        }
+
+        if ((buf_p[i] & 0x80u) != 0) {
+            continue;
+        }
+
+        if (length == 0) {
+            if (value < 80) {
+                arcs_p[0] = (uint32_t)(value / 40);
+                arcs_p[1] = (uint32_t)(value % 40);
+            } else {
+                arcs_p[0] = 2;
+                arcs_p[1] = (uint32_t)(value - 80);
+            }
+
+            length = 2;
+        } else {
+            if (length == 16) {
+                return (-EBADLENGTH);
+            }
+
+            if (value > 0xffffffffu) {
+                return (-EBADOID);
+            }
+
+            arcs_p[length] = (uint32_t)value;
+            length++;
+        }
+
+        value = 0;
+    }
+
+    *length_p = length;
+
+    return (0);
+}\
+'''
+
+DECODER_SKIP_OID = '''
+static void decoder_skip_oid(struct decoder_t *self_p)
+{
+    uint32_t arcs[16];
+    uint8_t length;
+
+    decoder_read_oid(self_p, &arcs[0], &length);
+}\
+'''
+
 
 class _MembersBacktracesContext(object):
 
@@ -148,19 +871,27 @@ class _UserType(object):
                  type_declaration,
                  declaration,
                  definition_inner,
-                 definition):
+                 definition,
+                 skip_inner,
+                 jer_definition_inner,
+                 jer_definition):
         self.type_name = type_name
         self.module_name = module_name
         self.type_declaration = type_declaration
         self.declaration = declaration
         self.definition_inner = definition_inner
         self.definition = definition
+        self.skip_inner = skip_inner
+        self.jer_definition_inner = jer_definition_inner
+        self.jer_definition = jer_definition
 
 
 class Generator(object):
 
-    def __init__(self, namespace):
+    def __init__(self, namespace, view_threshold=None, arena_threshold=None):
         self.namespace = canonical(namespace)
+        self.view_threshold = view_threshold
+        self.arena_threshold = arena_threshold
         self.asn1_members_backtrace = []
         self.c_members_backtrace = []
         self.module_name = None
@@ -171,14 +902,28 @@ class Generator(object):
         self.encode_variable_lines = []
         self.decode_variable_lines = []
         self.used_user_types = []
+        self.field_by_member_name = None
+        self.jer_generator = None
+        self.object_identifiers = []
+        self.has_object_identifier = False
+        self.recursive_user_types = set()
+        self.refers_to_user_type_cache = {}
+        self.open_types = {}
+        self.open_type_views = False
+        self.lazy_open_types = False
+        self.lazy_open_type_members = []
 
     def reset_type(self):
         self.helper_lines = []
+        self.used_user_types = []
+        self.lazy_open_type_members = []
+        self.reset_variables()
+
+    def reset_variables(self):
         self.base_variables = set()
         self.used_suffixes_by_base_variables = {}
         self.encode_variable_lines = []
         self.decode_variable_lines = []
-        self.used_user_types = []
 
     @property
     def module_name_snake(self):
@@ -370,7 +1115,8 @@ class Generator(object):
             member_lines = self.format_type(member, member_checker)
 
         if member_lines:
-            member_lines[-1] += ' {};'.format(canonical(member.name))
+            member_lines[-1] = format_declaration(member_lines[-1],
+                                                  canonical(member.name))
 
         return member_lines
 
@@ -391,10 +1137,61 @@ class Generator(object):
     def format_boolean(self):
         return ['bool']
 
+    def is_octet_string_view(self, checker):
+        """Variable size OCTET STRINGs with a maximum size of at least the
+        view threshold point into the encoded data instead of having an
+        inline buffer.
+
+        """
+
+        if self.view_threshold is None:
+            return False
+
+        return (checker.minimum != checker.maximum
+                and checker.maximum >= self.view_threshold)
+
+    def is_arena_size(self, checker):
+        if self.arena_threshold is None:
+            return False
+
+        return (checker.minimum != checker.maximum
+                and checker.maximum >= self.arena_threshold)
+
+    def is_octet_string_arena(self, checker):
+        """Variable size OCTET STRINGs with a maximum size of at least the
+        arena threshold are decoded into the arena, unless they are
+        views.
+
+        """
+
+        return (not self.is_octet_string_view(checker)
+                and self.is_arena_size(checker))
+
+    def is_octet_string_pointer(self, checker):
+        return (self.is_octet_string_view(checker)
+                or self.is_octet_string_arena(checker))
+
+    def is_sequence_of_arena(self, checker):
+        """Variable size SEQUENCE OFs with a maximum number of elements of
+        at least the arena threshold have their elements decoded into
+        the arena.
+
+        """
+
+        return self.is_arena_size(checker)
+
     def format_octet_string(self, checker):
         if not checker.has_upper_bound():
             raise self.error('OCTET STRING has no maximum length.')
 
+        if self.is_octet_string_pointer(checker):
+            return [
+                'struct {',
+                '    const uint8_t *buf;',
+                '    uint32_t length;',
+                '}'
+            ]
+
         if checker.minimum == checker.maximum:
             lines = []
         elif checker.maximum < 256:
@@ -409,17 +1206,58 @@ class Generator(object):
             '}'
         ]
 
+    def format_restricted_string(self, type_, checker):
+        """Restricted character strings have one byte per character and
+        are always null terminated after decoding.
+
+        """
+
+        if not checker.has_upper_bound():
+            raise self.error('{} has no maximum length.'.format(
+                type_.__class__.__name__))
+
+        if checker.minimum == checker.maximum:
+            lines = []
+        elif checker.maximum < 256:
+            lines = ['    uint8_t length;']
+        else:
+            lines = ['    uint32_t length;']
+
+        return [
+            'struct {'
+        ] + lines + [
+            '    char buf[{}];'.format(checker.maximum + 1),
+            '}'
+        ]
+
+    def format_restricted_string_default_condition(self, member, checker):
+        """Returns a condition that is true if given restricted character
+        string member is not equal to its default value.
+
+        """
+
+        name = '{}{}'.format(self.location_inner('', '.'), canonical(member.name))
+        default_variable = canonical(member.name) + '_default'
+        compare = 'memcmp(&src_p->{}.buf[0], {}, {}u) != 0'.format(
+            name,
+            default_variable,
+            len(member.default))
+
+        if checker.minimum == checker.maximum:
+            return compare
+        else:
+            return '(src_p->{}.length != {}u) || ({})'.format(name,
+                                                              len(member.default),
+                                                              compare)
+
     def format_bit_string(self, type_, checker):
         def get_value(value):
             byte = (length - 1) - (value // 8)
             bit = 7 - (value % 8)
             return ('0x{:0' + str(length // 4) + 'x}').format(1 << (bit + byte * 8))
 
-        if checker.minimum != checker.maximum:
-            raise self.error('BIT STRING with variable SIZE not supported.')
-        if checker.minimum > 64:
-            raise self.error('BIT STRING with a length of more than 64 bits are not '
-                             'supported.')
+        if self.is_bit_string_buffer(checker):
+            return self.format_bit_string_buffer(type_, checker)
 
         max_value = 2**checker.minimum - 1
 
@@ -436,6 +1274,49 @@ class Generator(object):
 
         return [type_name]
 
+    def is_bit_string_buffer(self, checker):
+        """Variable size BIT STRINGs and BIT STRINGs of more than 64 bits
+        are stored in a byte array instead of an integer.
+
+        """
+
+        return (checker.minimum != checker.maximum
+                or checker.maximum > 64)
+
+    def format_bit_string_buffer(self, type_, checker):
+        """The first bit is the most significant bit of the first byte, as
+        in the encoding. Unused bits of the last byte are zero after
+        decoding and ignored when encoding.
+
+        """
+
+        if not checker.has_upper_bound():
+            raise self.error('BIT STRING has no maximum length.')
+
+        if type_.named_bits:
+            raise self.error(
+                'BIT STRING with named bits must have a fixed size of at '
+                'most 64 bits.')
+
+        if type_.default is not None:
+            raise self.error(
+                'BIT STRING DEFAULT values must have a fixed size of at most '
+                '64 bits.')
+
+        if checker.minimum == checker.maximum:
+            lines = []
+        elif checker.maximum < 256:
+            lines = ['    uint8_t length;']
+        else:
+            lines = ['    uint32_t length;']
+
+        return [
+            'struct {'
+        ] + lines + [
+            '    uint8_t buf[{}];'.format((checker.maximum + 7) // 8),
+            '}'
+        ]
+
     def format_sequence(self, type_, checker):
         lines = []
 
@@ -460,8 +1341,16 @@ class Generator(object):
 
         lines = self.format_type(type_.element_type, checker.element_type)
 
+        if self.is_sequence_of_arena(checker):
+            if lines:
+                lines[-1] = format_declaration(lines[-1], '*elements')
+
+            return ['struct {'] + indent_lines(['uint32_t length;'] + lines) + ['}']
+
         if lines:
-            lines[-1] += ' elements[{}];'.format(checker.maximum)
+            lines[-1] = format_declaration(
+                lines[-1],
+                'elements[{}]'.format(checker.maximum))
 
         if checker.minimum == checker.maximum:
             length_lines = []
@@ -472,6 +1361,23 @@ class Generator(object):
 
         return ['struct {'] + indent_lines(length_lines + lines) + ['}']
 
+    def format_sequence_of_arena_alloc(self, checker):
+        if not self.is_sequence_of_arena(checker):
+            return []
+
+        location = self.location_inner('', '.')
+
+        return [
+            'dst_p->{}elements = decoder_arena_alloc('.format(location),
+            '    decoder_p,',
+            '    dst_p->{0}length * sizeof(dst_p->{0}elements[0]));'.format(location),
+            '',
+            'if (dst_p->{}elements == NULL) {{'.format(location),
+            '    return;',
+            '}',
+            ''
+        ]
+
     def format_enumerated(self, type_):
         lines = ['enum {}_e'.format(self.location)]
 
@@ -500,7 +1406,8 @@ class Generator(object):
                 choice_lines = self.format_type(member, member_checker)
 
             if choice_lines:
-                choice_lines[-1] += ' {};'.format(canonical(member.name))
+                choice_lines[-1] = format_declaration(choice_lines[-1],
+                                                      canonical(member.name))
 
             lines += choice_lines
             choices.append('    {}_choice_{}_e'.format(self.location,
@@ -525,14 +1432,186 @@ class Generator(object):
         return lines
 
     def format_user_type(self, type_name, module_name):
-        module_name_snake = camel_to_snake_case(module_name)
-        type_name_snake = camel_to_snake_case(type_name)
-
         self.used_user_types.append((type_name, module_name))
 
-        return ['struct {}_{}_{}_t'.format(self.namespace,
-                                           module_name_snake,
-                                           type_name_snake)]
+        return [self.format_user_type_struct(type_name, module_name)]
+
+    def format_user_type_struct(self, type_name, module_name):
+        return 'struct {}_{}_{}_t'.format(self.namespace,
+                                          camel_to_snake_case(module_name),
+                                          camel_to_snake_case(type_name))
+
+    def is_recursive_user_type(self, type_):
+        """Returns True if given type refers back to the type being
+        generated, either directly or via other user types.
+
+        """
+
+        if isinstance(type_, compiler.Recursive):
+            return True
+
+        if not is_user_type(type_):
+            return False
+
+        return self.refers_to_user_type(type_,
+                                        (self.type_name, self.module_name))
+
+    def refers_to_user_type(self, type_, user_type):
+        if isinstance(type_, compiler.Recursive):
+            return (type_.type_name, type_.module_name) == user_type
+
+        if is_user_type(type_):
+            key = (type_.type_name, type_.module_name, user_type)
+
+            if key not in self.refers_to_user_type_cache:
+                self.refers_to_user_type_cache[key] = any([
+                    self.refers_to_user_type(member, user_type)
+                    for member in get_member_types(type_)
+                ])
+
+            return self.refers_to_user_type_cache[key]
+
+        return any([
+            self.refers_to_user_type(member, user_type)
+            for member in get_member_types(type_)
+        ])
+
+    def format_recursive_user_type(self, type_):
+        """Recursive types are pointers to values allocated from the
+        arena, as they would otherwise contain themselves.
+
+        """
+
+        if self.arena_threshold is None:
+            raise self.error('Recursive types require an arena.')
+
+        self.recursive_user_types.add((type_.type_name, type_.module_name))
+
+        return ['{} *'.format(self.format_user_type_struct(type_.type_name,
+                                                           type_.module_name))]
+
+    def format_recursive_user_type_inner(self, type_):
+        prefix = self.get_user_type_prefix(type_.type_name, type_.module_name)
+        location = self.location_inner()
+        encode_lines = [
+            '',
+            'if (encoder_enter(encoder_p, src_p->{})) {{'.format(location),
+            '    {}_encode_inner(encoder_p, src_p->{});'.format(prefix,
+                                                                location),
+            '    encoder_leave(encoder_p);',
+            '}',
+            ''
+        ]
+        decode_lines = [
+            '',
+            'if (decoder_enter(decoder_p)) {',
+            '    dst_p->{} = decoder_arena_alloc('.format(location),
+            '        decoder_p,',
+            '        sizeof(*dst_p->{}));'.format(location),
+            '',
+            '    if (dst_p->{} != NULL) {{'.format(location),
+            '        {}_decode_inner(decoder_p, dst_p->{});'.format(prefix,
+                                                                    location),
+            '    }',
+            '',
+            '    decoder_leave(decoder_p);',
+            '}',
+            ''
+        ]
+
+        return encode_lines, decode_lines
+
+    def format_recursive_user_type_skip(self, type_):
+        prefix = self.get_user_type_prefix(type_.type_name, type_.module_name)
+
+        return [
+            '',
+            'if (decoder_enter(decoder_p)) {',
+            '    {}_skip_inner(decoder_p);'.format(prefix),
+            '    decoder_leave(decoder_p);',
+            '}',
+            ''
+        ]
+
+    def get_open_type(self, type_):
+        """Returns the name of the member selecting the value of given open
+        type, and a list of its alternatives as key values, type name,
+        module name and union member name tuples. Objects of the same
+        type share alternative.
+
+        """
+
+        key = (self.module_name, self.type_name, type_.name)
+
+        if (len(self.asn1_members_backtrace) != 1
+            or len(self.c_members_backtrace) != 1
+            or key not in self.open_types):
+            raise self.error('Open types are only supported as members of '
+                             'SEQUENCEs with a table constraint.')
+
+        key_member_name, objects = self.open_types[key]
+
+        if not objects and not (self.open_type_views or self.lazy_open_types):
+            raise self.error('Open type object set has no objects.')
+
+        alternatives = []
+        key_values = set()
+
+        for key_value, type_name, module_name in objects:
+            if key_value in key_values:
+                continue
+
+            key_values.add(key_value)
+
+            for alternative in alternatives:
+                if alternative[1:3] == (type_name, module_name):
+                    alternative[0].append(key_value)
+                    break
+            else:
+                alternatives.append(([key_value],
+                                     type_name,
+                                     module_name,
+                                     camel_to_snake_case(type_name)))
+
+        return key_member_name, alternatives
+
+    def format_open_type(self, type_):
+        """Open types are unions of the types in their object set. The
+        value of the member selecting the object tells which union
+        member is valid.
+
+        """
+
+        key_member_name, alternatives = self.get_open_type(type_)
+        lines = []
+
+        for _, type_name, module_name, name in alternatives:
+            type_line = self.format_user_type(type_name, module_name)[0]
+            lines.append(format_declaration(type_line, name))
+
+        # Lazy open types are kept as views of their encodings, and
+        # decoded into a separate union on demand.
+        if self.lazy_open_types:
+            if not lines:
+                lines = ['uint8_t dummy;']
+
+            self.helper_lines += [
+                'union {}_t {{'.format(self.location)
+            ] + indent_lines(lines) + [
+                '};',
+                ''
+            ]
+            self.lazy_open_type_members.append((self.c_members_backtrace[-1],
+                                                self.location,
+                                                key_member_name,
+                                                alternatives))
+
+            return ['struct {}_open_type_t'.format(self.namespace)]
+
+        if self.open_type_views:
+            lines.append('struct {}_open_type_t unknown;'.format(self.namespace))
+
+        return ['union {'] + indent_lines(lines) + ['}']
 
     def format_sequence_inner_member(self,
                                      member,
@@ -540,12 +1619,21 @@ class Generator(object):
                                      default_condition_by_member_name,
                                      skip_when_not_present=True):
         member_checker = self.get_member_checker(checker, member.name)
+        is_field = (self.field_by_member_name is not None
+                    and not self.c_members_backtrace
+                    and member.name in self.field_by_member_name)
 
         with self.members_backtrace_push(canonical(member.name)):
             encode_lines, decode_lines = self.format_type_inner(
                 member,
                 member_checker)
 
+            if is_field:
+                decode_lines = self.format_decode_field(
+                    self.field_by_member_name[member.name],
+                    decode_lines,
+                    self.format_type_skip(member, member_checker))
+
         location = self.location_inner('', '.')
 
         if member.optional and skip_when_not_present:
@@ -567,7 +1655,74 @@ class Generator(object):
         elif member.default is not None and skip_when_not_present:
             name = '{}{}'.format(location, canonical(member.name))
 
-            if self.is_buffer_type(member):
+            if (self.is_buffer_type(member)
+                and self.is_octet_string_pointer(member_checker)):
+                default_value = ('{{'
+                                 + ', '.join(['0x%02X' % m for m in member.default])
+                                 + '}};')
+                default_variable = self.add_unique_variable(
+                    'static const uint8_t {}[] = ' + default_value,
+                    canonical(member.name) + '_default')
+
+                encode_lines = [
+                    '',
+                    'if ((src_p->{}.length != sizeof({})) ||'.format(
+                        name,
+                        default_variable),
+                    '    (memcmp(src_p->{}.buf, {}, sizeof({})) != 0)) {{'.format(
+                        name,
+                        default_variable,
+                        default_variable)
+                ] + indent_lines(encode_lines) + [
+                    '}',
+                    ''
+                ]
+                decode_lines = [
+                    '',
+                    'if ({}) {{'.format(default_condition_by_member_name[member.name])
+                ] + indent_lines(decode_lines) + [
+                    '} else {',
+                    '    dst_p->{}.buf = &{}[0];'.format(name, default_variable),
+                    '    dst_p->{}.length = sizeof({});'.format(name, default_variable),
+                    '}',
+                    ''
+                ]
+            elif is_restricted_string(member):
+                default_variable = self.add_unique_variable(
+                    'static const char {}[] = ' + format_c_string(member.default) + ';',
+                    canonical(member.name) + '_default')
+                decode_default_lines = [
+                    '    (void)memcpy(&dst_p->{}.buf[0], {}, sizeof({}));'.format(
+                        name,
+                        default_variable,
+                        default_variable)
+                ]
+
+                if member_checker.minimum != member_checker.maximum:
+                    decode_default_lines.append(
+                        '    dst_p->{}.length = {}u;'.format(name,
+                                                             len(member.default)))
+
+                encode_lines = [
+                    '',
+                    'if ({}) {{'.format(
+                        self.format_restricted_string_default_condition(
+                            member,
+                            member_checker))
+                ] + indent_lines(encode_lines) + [
+                    '}',
+                    ''
+                ]
+                decode_lines = [
+                    '',
+                    'if ({}) {{'.format(default_condition_by_member_name[member.name])
+                ] + indent_lines(decode_lines) + [
+                    '} else {'
+                ] + decode_default_lines + [
+                    '}',
+                    ''
+                ]
+            elif self.is_buffer_type(member):
                 default_value = '{{' + ', '.join(['0x%02X' % m for m in member.default]) + '}};'
                 default_variable = self.add_unique_variable('static const uint8_t {}[] = ' + default_value,
                                                             canonical(member.name) + '_default')
@@ -625,7 +1780,67 @@ class Generator(object):
                     ''
                 ]
 
-        return encode_lines, decode_lines
+        return encode_lines, decode_lines
+
+    def format_decode_field(self, field, decode_lines, skip_lines):
+        """Decode given member only if its field is set, and skip it
+        otherwise.
+
+        """
+
+        if not decode_lines and not skip_lines:
+            return []
+
+        lines = [
+            'if ((fields & {}) != 0u) {{'.format(field)
+        ] + indent_lines(decode_lines)
+
+        if skip_lines:
+            lines += ['} else {'] + indent_lines(skip_lines)
+
+        return lines + ['}']
+
+    def format_skip(self, size):
+        if size == 0:
+            return []
+
+        return ['(void)decoder_free(decoder_p, {}u);'.format(size)]
+
+    def format_type_skip(self, type_, checker):
+        """Skip given type. Referenced user types with a size depending on
+        the encoded data are skipped with their skip function.
+
+        """
+
+        if self.is_recursive_user_type(type_):
+            return self.format_recursive_user_type_skip(type_)
+
+        if (is_user_type(type_)
+            and self.get_fixed_skip_size(type_, checker) is None):
+            prefix = self.get_user_type_prefix(type_.type_name,
+                                               type_.module_name)
+
+            return ['{}_skip_inner(decoder_p);'.format(prefix)]
+
+        return self.format_type_skip_inner(type_, checker)
+
+    def get_decode_fields_members(self, type_):
+        """Returns the root members of given type if a decode fields
+        function should be generated for it, otherwise None.
+
+        """
+
+        if not self.is_sequence_type(type_):
+            return None
+
+        if not 0 < len(type_.root_members) <= 64:
+            return None
+
+        return type_.root_members
+
+    def get_field_define(self, member):
+        return '{}_FIELD_{}'.format(self.location.upper(),
+                                    canonical(member.name).upper())
 
     def generate_type_declaration(self, compiled_type):
         type_ = compiled_type.type
@@ -651,17 +1866,125 @@ class Generator(object):
                                         members='\n'.join(lines))
         ]
 
-    def generate_declaration(self):
-        return DECLARATION_FMT.format(namespace=self.namespace,
-                                      module_name=self.module_name,
-                                      type_name=self.type_name,
-                                      module_name_snake=self.module_name_snake,
-                                      type_name_snake=self.type_name_snake)
+    @property
+    def arena_parameter(self):
+        if self.arena_threshold is None:
+            return ''
+        else:
+            return ',\n    struct {}_arena_t *arena_p'.format(self.namespace)
 
-    def generate_definition(self):
-        return DEFINITION_FMT.format(namespace=self.namespace,
-                                     module_name_snake=self.module_name_snake,
-                                     type_name_snake=self.type_name_snake)
+    def generate_declaration(self, compiled_type):
+        if self.arena_threshold is None:
+            arena_parameter_doc = ''
+        else:
+            arena_parameter_doc = ARENA_PARAMETER_DOC
+
+        declaration = DECLARATION_FMT.format(namespace=self.namespace,
+                                             module_name=self.module_name,
+                                             type_name=self.type_name,
+                                             module_name_snake=self.module_name_snake,
+                                             type_name_snake=self.type_name_snake,
+                                             arena_parameter=self.arena_parameter,
+                                             arena_parameter_doc=arena_parameter_doc)
+        size = self.get_maximum_encoded_size(compiled_type.type,
+                                             compiled_type.constraints_checker.type)
+
+        if size is not None:
+            declaration = MAXIMUM_ENCODED_SIZE_FMT.format(
+                module_name=self.module_name,
+                type_name=self.type_name,
+                define_prefix=self.location.upper(),
+                size=size) + declaration
+
+        members = self.get_decode_fields_members(compiled_type.type)
+
+        if members is not None:
+            field_defines = [
+                '#define {} (1ull << {})'.format(self.get_field_define(member), i)
+                for i, member in enumerate(members)
+            ]
+            declaration += '\n' + DECODE_FIELDS_DECLARATION_FMT.format(
+                namespace=self.namespace,
+                module_name=self.module_name,
+                type_name=self.type_name,
+                module_name_snake=self.module_name_snake,
+                type_name_snake=self.type_name_snake,
+                field_defines='\n'.join(field_defines),
+                arena_parameter=self.arena_parameter,
+                arena_parameter_doc=arena_parameter_doc)
+
+        for member, location, key_member_name, _ in self.lazy_open_type_members:
+            declaration += LAZY_OPEN_TYPE_DECLARATION_FMT.format(
+                type_name=self.type_name,
+                module_name=self.module_name,
+                member_name=member,
+                key_member_name=key_member_name,
+                prefix=self.get_user_type_prefix(self.type_name,
+                                                 self.module_name),
+                member=member,
+                location=location,
+                arena_parameter=self.arena_parameter,
+                arena_parameter_doc=arena_parameter_doc)
+
+        return declaration
+
+    def generate_definition(self, compiled_type):
+        if self.arena_threshold is None:
+            arena_init = ''
+            arena_batch_init = ''
+        else:
+            arena_init = '    decoder.arena_p = arena_p;\n'
+            arena_batch_init = '        decoder.arena_p = arena_p;\n'
+
+        definition = DEFINITION_FMT.format(namespace=self.namespace,
+                                           module_name_snake=self.module_name_snake,
+                                           type_name_snake=self.type_name_snake,
+                                           arena_parameter=self.arena_parameter,
+                                           arena_init=arena_init,
+                                           arena_batch_init=arena_batch_init)
+
+        if self.get_decode_fields_members(compiled_type.type) is not None:
+            definition += DECODE_FIELDS_DEFINITION_FMT.format(
+                namespace=self.namespace,
+                module_name_snake=self.module_name_snake,
+                type_name_snake=self.type_name_snake,
+                arena_parameter=self.arena_parameter,
+                arena_init=arena_init)
+
+        for member, location, key_member_name, alternatives in \
+                self.lazy_open_type_members:
+            definition += LAZY_OPEN_TYPE_DEFINITION_FMT.format(
+                prefix=self.get_user_type_prefix(self.type_name,
+                                                 self.module_name),
+                member=member,
+                location=location,
+                key_member=canonical(key_member_name),
+                cases=self.format_lazy_open_type_cases(alternatives),
+                arena_parameter=self.arena_parameter,
+                arena_init=arena_init)
+
+        return definition
+
+    def format_lazy_open_type_cases(self, alternatives):
+        lines = []
+
+        for key_values, type_name, module_name, name in alternatives:
+            lines += ['case {}:'.format(key_value) for key_value in key_values]
+            lines += [
+                '    {}_decode_inner(&decoder, &dst_p->{});'.format(
+                    self.get_user_type_prefix(type_name, module_name),
+                    name),
+                '    break;',
+                ''
+            ]
+
+        lines += [
+            'default:',
+            '    decoder_abort(&decoder, EBADCHOICE);',
+            '    break;'
+        ]
+
+        return '\n'.join(indent_lines(lines)) + '\n'
 
     def generate_definition_inner(self, compiled_type):
         encode_lines, decode_lines = self.generate_definition_inner_process(
@@ -677,11 +2000,91 @@ class Generator(object):
         encode_lines = indent_lines(encode_lines) + ['']
         decode_lines = indent_lines(decode_lines) + ['']
 
+        definition_inner = self.format_definition_inner(
+            compiled_type.type,
+            '\n'.join(encode_lines),
+            '\n'.join(decode_lines))
+
+        members = self.get_decode_fields_members(compiled_type.type)
+
+        if members is not None:
+            definition_inner += self.generate_decode_fields_inner(compiled_type,
+                                                                  members)
+
+        return definition_inner
+
+    def format_definition_inner(self, type_, encode_body, decode_body):
         return DEFINITION_INNER_FMT.format(namespace=self.namespace,
                                            module_name_snake=self.module_name_snake,
                                            type_name_snake=self.type_name_snake,
-                                           encode_body='\n'.join(encode_lines),
-                                           decode_body='\n'.join(decode_lines))
+                                           encode_body=encode_body,
+                                           decode_body=decode_body)
+
+    def generate_decode_fields_inner(self, compiled_type, members):
+        """Generate the decode function of given SEQUENCE type once more,
+        but with each root member wrapped in a check if its field is
+        set.
+
+        """
+
+        self.reset_variables()
+        self.field_by_member_name = {
+            member.name: self.get_field_define(member)
+            for member in members
+        }
+
+        # Open types are dispatched on the member selecting their
+        # value, so it is decoded whenever they are.
+        for member in members:
+            if not is_open_type(member):
+                continue
+
+            with self.members_backtrace_push(canonical(member.name)):
+                key_member_name, _ = self.get_open_type(member)
+
+            self.field_by_member_name[key_member_name] = '({} | {})'.format(
+                self.field_by_member_name[key_member_name],
+                self.field_by_member_name[member.name])
+
+        try:
+            decode_lines = self.generate_decode_fields_inner_process(
+                compiled_type.type,
+                compiled_type.constraints_checker.type)
+        finally:
+            self.field_by_member_name = None
+
+        if self.decode_variable_lines:
+            decode_lines = self.decode_variable_lines + [''] + decode_lines
+
+        decode_lines = indent_lines(decode_lines) + ['']
+
+        return DECODE_FIELDS_INNER_FMT.format(
+            namespace=self.namespace,
+            module_name_snake=self.module_name_snake,
+            type_name_snake=self.type_name_snake,
+            decode_body='\n'.join(decode_lines))
+
+    def generate_decode_fields_inner_process(self, type_, checker):
+        return self.generate_definition_inner_process(type_, checker)[1]
+
+    def generate_skip_inner(self, compiled_type):
+        self.reset_variables()
+        skip_lines = self.format_type_skip_inner(
+            compiled_type.type,
+            compiled_type.constraints_checker.type)
+
+        if not skip_lines:
+            skip_lines = ['(void)decoder_p;']
+
+        if self.decode_variable_lines:
+            skip_lines = self.decode_variable_lines + [''] + skip_lines
+
+        skip_lines = indent_lines(skip_lines) + ['']
+
+        return SKIP_INNER_FMT.format(namespace=self.namespace,
+                                     module_name_snake=self.module_name_snake,
+                                     type_name_snake=self.type_name_snake,
+                                     skip_body='\n'.join(skip_lines))
 
     def generate(self, compiled):
         user_types = {}
@@ -699,16 +2102,29 @@ class Generator(object):
                 if not type_declaration:
                     continue
 
-                declaration = self.generate_declaration()
+                declaration = self.generate_declaration(compiled_type)
                 definition_inner = self.generate_definition_inner(compiled_type)
-                definition = self.generate_definition()
+                definition = self.generate_definition(compiled_type)
+                skip_inner = self.generate_skip_inner(compiled_type)
+
+                if self.jer_generator is None:
+                    jer_definition_inner = None
+                    jer_definition = None
+                else:
+                    declaration += self.jer_generator.generate_declaration()
+                    jer_definition_inner = \
+                        self.jer_generator.generate_definition_inner(compiled_type)
+                    jer_definition = self.jer_generator.generate_definition()
 
                 user_type = _UserType(type_name,
                                       module_name,
                                       type_declaration,
                                       declaration,
                                       definition_inner,
-                                      definition)
+                                      definition,
+                                      skip_inner,
+                                      jer_definition_inner,
+                                      jer_definition)
                 user_type_name_tuple = (user_type.type_name, user_type.module_name)
                 user_types[user_type_name_tuple] = user_type
                 user_type_dependencies[user_type_name_tuple] = self.used_user_types
@@ -719,21 +2135,232 @@ class Generator(object):
         declarations = []
         definitions_inner = []
         definitions = []
+        jer_definitions_inner = []
+        jer_definitions = []
 
         for user_type_name in user_type_sorted_names:
             user_type = user_types[user_type_name]
             type_declarations.extend(user_type.type_declaration)
             declarations.append(user_type.declaration)
             definitions_inner.append(user_type.definition_inner)
+            definitions_inner.append(user_type.skip_inner)
             definitions.append(user_type.definition)
 
+            if self.jer_generator is not None:
+                jer_definitions_inner.append(user_type.jer_definition_inner)
+                jer_definitions.append(user_type.jer_definition)
+
+        if self.arena_threshold is not None:
+            type_declarations.insert(0, ARENA_FMT.format(namespace=self.namespace))
+
+        open_type_struct = 'struct {}_open_type_t '.format(self.namespace)
+
+        if any([open_type_struct in type_declaration
+                for type_declaration in type_declarations]):
+            type_declarations.insert(0, OPEN_TYPE_FMT.format(namespace=self.namespace))
+
+        if self.recursive_user_types:
+            type_declarations.insert(
+                0,
+                RECURSION_DEPTH_FMT.format(namespace_upper=self.namespace.upper()))
+
+            # Recursive types may call each others inner functions
+            # before they are defined.
+            declarations_inner = []
+            jer_declarations_inner = []
+
+            for type_name, module_name in sorted(self.recursive_user_types):
+                declarations_inner.append(
+                    DEFINITION_INNER_DECLARATION_FMT.format(
+                        namespace=self.namespace,
+                        module_name_snake=camel_to_snake_case(module_name),
+                        type_name_snake=camel_to_snake_case(type_name)))
+
+                if self.jer_generator is not None:
+                    jer_declarations_inner.append(
+                        self.jer_generator.generate_definition_inner_declaration(
+                            type_name,
+                            module_name))
+
+            definitions_inner = declarations_inner + definitions_inner
+            jer_definitions_inner = jer_declarations_inner + jer_definitions_inner
+
+        if self.has_object_identifier or self.object_identifiers:
+            type_declarations.insert(
+                0,
+                self.format_object_identifier_declarations())
+
         type_declarations = '\n'.join(type_declarations)
         declarations = '\n'.join(declarations)
         definitions = '\n'.join(definitions_inner + definitions)
-        helpers = '\n'.join(self.generate_helpers(definitions))
+        helpers = self.generate_helpers(definitions)
+
+        # The OBJECT IDENTIFIER helpers look up named values in tables
+        # generated from the specification.
+        if any(['oid_encode(' in helper or 'oid_decode(' in helper
+                for helper in helpers]):
+            helpers.insert(1, self.format_object_identifier_lookups())
+
+        if self.object_identifiers:
+            helpers.insert(1, self.format_object_identifier_values())
+
+        # The JER encoder has its own helpers, which names partly
+        # contain the names of the codec helpers.
+        if self.jer_generator is not None:
+            jer_definitions = '\n'.join(jer_definitions_inner + jer_definitions)
+            helpers += self.jer_generator.generate_helpers(jer_definitions)
+            definitions += '\n' + jer_definitions
+
+        helpers = '\n'.join(self.format_recursion_depth(helpers))
 
         return type_declarations, declarations, helpers, definitions
 
+    def format_object_identifier(self, type_):
+        if type_.default is not None:
+            raise self.error(
+                'OBJECT IDENTIFIER DEFAULT values are not supported.')
+
+        self.has_object_identifier = True
+
+        return ['struct {}_oid_t'.format(self.namespace)]
+
+    def format_object_identifier_inner(self):
+        location = '{}.'.format(self.location_inner())
+
+        return (
+            [
+                'encoder_append_oid(encoder_p,',
+                '                   &src_p->{}arcs[0],'.format(location),
+                '                   src_p->{}length);'.format(location)
+            ],
+            [
+                'decoder_read_oid(decoder_p,',
+                '                 &dst_p->{}arcs[0],'.format(location),
+                '                 &dst_p->{}length);'.format(location)
+            ]
+        )
+
+    def format_object_identifier_declarations(self):
+        declarations = [OID_FMT.format(namespace=self.namespace)]
+
+        for module_name, value_name, _ in self.object_identifiers:
+            declarations.append(OID_VALUE_DECLARATION_FMT.format(
+                namespace=self.namespace,
+                module_name=module_name,
+                module_name_snake=camel_to_snake_case(module_name),
+                value_name=value_name,
+                value_name_snake=camel_to_snake_case(value_name)))
+
+        return '\n'.join(declarations)
+
+    def format_object_identifier_values(self):
+        definitions = []
+
+        for module_name, value_name, arcs in self.object_identifiers:
+            definitions.append(OID_VALUE_DEFINITION_FMT.format(
+                namespace=self.namespace,
+                module_name_snake=camel_to_snake_case(module_name),
+                value_name_snake=camel_to_snake_case(value_name),
+                length=len(arcs),
+                arcs=', '.join(['{}u'.format(arc) for arc in arcs])))
+
+        return '\n'.join(definitions)
+
+    def format_object_identifier_lookups(self):
+        """Returns the precomputed encodings of all named values and
+        functions mapping arcs to encodings and back. Values with
+        equal arcs share an encoding.
+
+        """
+
+        if not self.object_identifiers:
+            return OID_LOOKUP_STUBS
+
+        arrays = []
+        names_by_arcs = {}
+
+        for module_name, value_name, arcs in self.object_identifiers:
+            if arcs in names_by_arcs:
+                continue
+
+            name = '{}_{}'.format(camel_to_snake_case(module_name),
+                                  camel_to_snake_case(value_name))
+            names_by_arcs[arcs] = (name, encode_object_identifier(arcs))
+            encoded = names_by_arcs[arcs][1]
+            lines = [
+                ', '.join(['0x{:02x}'.format(byte) for byte in encoded[i:i + 12]])
+                for i in range(0, len(encoded), 12)
+            ]
+            arrays.append(
+                'static const uint8_t {}_oid_encoded[] = {{\n'.format(name)
+                + '\n'.join(join_lines(indent_lines(lines), ','))
+                + '\n};\n')
+
+        encoded_cases = []
+
+        for length in sorted(set([len(arcs) for arcs in names_by_arcs])):
+            encoded_cases += ['', 'case {}:'.format(length)]
+            conditions = []
+
+            for arcs, (name, _) in sorted(names_by_arcs.items()):
+                if len(arcs) != length:
+                    continue
+
+                conditions.append([
+                    'if (memcmp(arcs_p, &{}_{}_oid.arcs[0], {} * sizeof(uint32_t)) '
+                    '== 0) {{'.format(self.namespace, name, length),
+                    '    buf_p = &{}_oid_encoded[0];'.format(name),
+                    '    *size_p = sizeof({}_oid_encoded);'.format(name),
+                    '}'
+                ])
+
+            encoded_cases += indent_lines(self.join_conditions(conditions))
+            encoded_cases.append('    break;')
+
+        arcs_cases = []
+        sizes = sorted(set([len(encoded) for _, encoded in names_by_arcs.values()]))
+
+        for size in sizes:
+            arcs_cases += ['', 'case {}:'.format(size)]
+            conditions = []
+
+            for name, encoded in sorted(names_by_arcs.values()):
+                if len(encoded) != size:
+                    continue
+
+                conditions.append([
+                    'if (memcmp(buf_p, &{}_oid_encoded[0], {}) == 0) {{'.format(
+                        name,
+                        size),
+                    '    oid_p = &{}_{}_oid;'.format(self.namespace, name),
+                    '}'
+                ])
+
+            arcs_cases += indent_lines(self.join_conditions(conditions))
+            arcs_cases.append('    break;')
+
+        return '\n'.join(arrays + [
+            OID_LOOKUP_ENCODED_FMT.format(
+                cases='\n'.join(indent_lines(encoded_cases[1:]) + [''])),
+            OID_LOOKUP_ARCS_FMT.format(
+                namespace=self.namespace,
+                cases='\n'.join(indent_lines(arcs_cases[1:]) + ['']))
+        ]).rstrip('\n')
+
+    @staticmethod
+    def join_conditions(conditions):
+        """Chain given if statements with else.
+
+        """
+
+        lines = conditions[0]
+
+        for condition in conditions[1:]:
+            lines[-1] += ' else ' + condition[0]
+            lines += condition[1:]
+
+        return lines
+
     def format_default(self, type_):
         raise NotImplementedError('To be implemented by subclasses.')
 
@@ -749,6 +2376,19 @@ class Generator(object):
     def get_choice_members(self, type_):
         raise NotImplementedError('To be implemented by subclasses.')
 
+    def get_enumerated_names(self, type_):
+        raise NotImplementedError('To be implemented by subclasses.')
+
+    def get_bit_string_shift(self, checker):
+        """Returns the number of bits to shift given fixed size BIT STRING
+        left to have its first bit in the most significant bit of an
+        uint64_t. The first bit is the most significant bit of the
+        smallest number of bytes the BIT STRING fits in by default.
+
+        """
+
+        return 64 - 8 * self.value_length(2 ** checker.minimum - 1)
+
     def generate_type_declaration_process(self, type_, checker):
         raise NotImplementedError('To be implemented by subclasses.')
 
@@ -758,12 +2398,70 @@ class Generator(object):
     def generate_helpers(self, definitions):
         raise NotImplementedError('To be implemented by subclasses.')
 
+    def get_maximum_encoded_size(self, type_, checker):
+        raise NotImplementedError('To be implemented by subclasses.')
+
+    def format_encoder_and_decoder_structs(self, structs, encoder_members=None):
+        """Add given members to the encoder struct, and the arena pointer to
+        the decoder struct in arena mode.
+
+        """
+
+        if encoder_members is None:
+            encoder_members = []
+
+        decoder_members = []
+
+        if self.arena_threshold is not None:
+            decoder_members.append(
+                'struct {}_arena_t *arena_p;'.format(self.namespace))
+
+        return structs.format(
+            encoder_members=''.join(['    {}\n'.format(member)
+                                     for member in encoder_members]),
+            decoder_members=''.join(['    {}\n'.format(member)
+                                     for member in decoder_members]))
+
+    def format_recursion_depth(self, helpers):
+        """Add the remaining recursion depth to the encoder and decoder
+        structs, and initialize it in their init functions.
+
+        """
+
+        if not self.recursive_user_types:
+            return helpers
+
+        helpers = [
+            re.sub(r'(struct \w*coder_t {\n(?:    .*\n)*)',
+                   r'\1    int remaining_depth;\n',
+                   helper)
+            for helper in helpers
+        ]
+
+        return [
+            re.sub(r'(static void \w*coder_init\(.*?\n)}',
+                   r'\1    self_p->remaining_depth = {}_MAX_RECURSION_DEPTH;\n}}'.format(
+                       self.namespace.upper()),
+                   helper,
+                   flags=re.DOTALL)
+            for helper in helpers
+        ]
+
     def is_complex_user_type(self, type_):
         raise NotImplementedError('To be implemented by subclasses.')
 
     def is_buffer_type(self, type_):
         raise NotImplementedError('To be implemented by subclasses.')
 
+    def is_sequence_type(self, type_):
+        raise NotImplementedError('To be implemented by subclasses.')
+
+    def get_fixed_skip_size(self, type_, checker):
+        raise NotImplementedError('To be implemented by subclasses.')
+
+    def format_type_skip_inner(self, type_, checker):
+        raise NotImplementedError('To be implemented by subclasses.')
+
 
 def canonical(value):
     """Replace anything but 'a-z', 'A-Z' and '0-9' with '_'.
@@ -782,6 +2480,317 @@ def camel_to_snake_case(value):
     return value
 
 
+def is_restricted_string(type_):
+    """Returns True if given type is a restricted character string type
+    with one byte per character. Class names are the same in all
+    codecs.
+
+    """
+
+    return type_.__class__.__name__ in RESTRICTED_STRING_TYPE_NAMES
+
+
+def is_object_identifier(type_):
+    """Returns True if given type is an OBJECT IDENTIFIER. Class names
+    are the same in all codecs.
+
+    """
+
+    return type_.__class__.__name__ == 'ObjectIdentifier'
+
+
+def encode_object_identifier(arcs):
+    """Returns the contents octets of an OBJECT IDENTIFIER with given
+    arcs.
+
+    """
+
+    encoded = []
+
+    for value in [40 * arcs[0] + arcs[1]] + list(arcs[2:]):
+        subidentifier = [value & 0x7f]
+        value >>= 7
+
+        while value > 0:
+            subidentifier.insert(0, 0x80 | (value & 0x7f))
+            value >>= 7
+
+        encoded += subidentifier
+
+    return encoded
+
+
+def get_object_identifier_values(specification):
+    """Returns a list of (module name, value name, arcs) of all named
+    OBJECT IDENTIFIER values in given parsed specification that fits
+    in the generated C struct. Values referencing unknown values are
+    ignored.
+
+    """
+
+    values = {}
+
+    for module_name, module in specification.items():
+        for value_name, value in module.get('values', {}).items():
+            if value['type'] == 'OBJECT IDENTIFIER':
+                values[(module_name, value_name)] = value['value']
+
+    resolved = {}
+
+    def resolve(key, visited):
+        if key in resolved:
+            return resolved[key]
+
+        if key in visited:
+            return None
+
+        visited.add(key)
+        arcs = []
+
+        for i, component in enumerate(values[key]):
+            if isinstance(component, tuple):
+                component = component[1]
+
+            if isinstance(component, int):
+                arcs.append(component)
+            elif i > 0:
+                return None
+            elif component in OID_ROOT_ARCS:
+                arcs.append(OID_ROOT_ARCS[component])
+            else:
+                # A reference to another value, preferably in the same
+                # module.
+                candidates = [(key[0], component)] + sorted(
+                    [name for name in values if name[1] == component])
+                candidates = [name for name in candidates if name in values]
+
+                if not candidates:
+                    return None
+
+                reference = resolve(candidates[0], visited)
+
+                if reference is None:
+                    return None
+
+                arcs += reference
+
+        resolved[key] = arcs
+
+        return arcs
+
+    object_identifiers = []
+
+    for key in sorted(values):
+        arcs = resolve(key, set())
+
+        if arcs is None:
+            continue
+
+        if not 2 <= len(arcs) <= OID_MAXIMUM_NUMBER_OF_ARCS:
+            continue
+
+        if arcs[0] > 2 or (arcs[0] < 2 and arcs[1] > 39):
+            continue
+
+        if any([arc < 0 or arc > 0xffffffff for arc in arcs]):
+            continue
+
+        object_identifiers.append((key[0], key[1], tuple(arcs)))
+
+    return object_identifiers
+
+
+def is_open_type(type_):
+    """Returns True if given type is an open type. Class names are the
+    same in all codecs.
+
+    """
+
+    return type_.__class__.__name__ == 'OpenType'
+
+
+def is_integer_class_field(compiler_, type_name, module_name):
+    """Returns True if given object class field type name, for example
+    'IE.&id', is an INTEGER, possibly via type references.
+
+    """
+
+    if '.&' not in type_name:
+        return False
+
+    result = compiler_.lookup_object_class_type_name(type_name, module_name)
+
+    if result is None:
+        return False
+
+    type_name, module_name = result
+
+    while True:
+        try:
+            type_descriptor, module_name = compiler_.lookup_type_descriptor(
+                type_name,
+                module_name)
+        except CompileError:
+            break
+
+        type_name = type_descriptor['type']
+
+    return type_name == 'INTEGER'
+
+
+def get_open_type_objects(compiler_,
+                          module_name,
+                          type_name,
+                          members,
+                          member):
+    """Returns the name of the member selecting the value of given open
+    type member, and the key value, type name and module name of each
+    object in its object set.
+
+    """
+
+    location = '{}.{}.{}'.format(module_name, type_name, member['name'])
+    object_set_name, keys = member['table']
+    key_members = []
+
+    if len(keys) == 1:
+        key_members = [key_member
+                       for key_member in members[:members.index(member)]
+                       if key_member['name'] == keys[0]]
+
+    if not key_members:
+        raise Error(
+            "{}: Open type key '{}' is not a preceding member of the same "
+            "SEQUENCE.".format(location, ', '.join(keys)))
+
+    key_member = key_members[0]
+
+    if not is_integer_class_field(compiler_, key_member['type'], module_name):
+        raise Error('{}: Open type keys must be INTEGERs.'.format(location))
+
+    key_field = key_member['type'].split('.')[-1]
+    value_field = member['type'].split('.')[-1]
+    object_set, object_set_module_name = compiler_.lookup_in_modules(
+        'object-sets',
+        'object set',
+        object_set_name,
+        module_name)
+    objects = []
+
+    for object_ in object_set['members']:
+        # The extension marker.
+        if object_ in [',', '.']:
+            continue
+
+        if not isinstance(object_, dict):
+            raise Error(
+                "{}: Object reference '{}' in object set '{}' is not "
+                "supported.".format(location, object_, object_set_name))
+
+        key_value = object_[key_field]
+
+        if not isinstance(key_value, int):
+            value, _ = compiler_.lookup_value(key_value, object_set_module_name)
+            key_value = value['value']
+
+        value_type_name = object_[value_field]['type']
+
+        try:
+            _, value_module_name = compiler_.lookup_type_descriptor(
+                value_type_name,
+                object_set_module_name)
+        except CompileError:
+            raise Error(
+                "{}: Open type value '{}' is not a type reference.".format(
+                    location,
+                    value_type_name))
+
+        objects.append((key_value, value_type_name, value_module_name))
+
+    return key_member['name'], objects
+
+
+def get_open_types(specification):
+    """Returns the member selecting the value and the objects of each
+    open type member of a SEQUENCE type in given parsed specification,
+    keyed by module, type and member name.
+
+    """
+
+    compiler_ = compiler.Compiler(specification)
+    open_types = {}
+
+    for module_name, module in specification.items():
+        for type_name, type_descriptor in module['types'].items():
+            if type_descriptor['type'] != 'SEQUENCE':
+                continue
+
+            members = [member
+                       for member in type_descriptor['members']
+                       if isinstance(member, dict)]
+
+            for member in members:
+                if not isinstance(member.get('table'), list):
+                    continue
+
+                open_types[(module_name, type_name, member['name'])] = \
+                    get_open_type_objects(compiler_,
+                                          module_name,
+                                          type_name,
+                                          members,
+                                          member)
+
+    return open_types
+
+
+def has_open_types(specification):
+    """Returns True if any type in given parsed specification has an open
+    type, ``IE.&Value``, member or element.
+
+    """
+
+    def is_open_type_descriptor(type_descriptor):
+        if compiler.is_open_type(type_descriptor['type']):
+            return True
+
+        for member in type_descriptor.get('members', []):
+            # Addition groups are lists of members.
+            if isinstance(member, list):
+                if any([is_open_type_descriptor(addition)
+                        for addition in member]):
+                    return True
+            elif isinstance(member, dict):
+                if is_open_type_descriptor(member):
+                    return True
+
+        if 'element' in type_descriptor:
+            return is_open_type_descriptor(type_descriptor['element'])
+
+        return False
+
+    return any([is_open_type_descriptor(type_descriptor)
+                for module in specification.values()
+                for type_descriptor in module['types'].values()])
+
+
+def format_c_string(value):
+    """Returns given ASCII string as a C string literal.
+
+    """
+
+    chars = []
+
+    for char in value:
+        if char in '"\\?':
+            chars.append('\\' + char)
+        elif ' ' <= char <= '~':
+            chars.append(char)
+        else:
+            chars.append('\\{:03o}'.format(ord(char)))
+
+    return '"{}"'.format(''.join(chars))
+
+
 def join_lines(lines, suffix):
     return[line + suffix for line in lines[:-1]] + lines[-1:]
 
@@ -790,6 +2799,39 @@ def is_user_type(type_):
     return type_.module_name is not None
 
 
+def get_member_types(type_):
+    """Returns the member, element and explicitly tagged types of given
+    type, which attribute names differ slightly between the codecs.
+
+    """
+
+    members = []
+
+    for name in ['root_members', 'additions', 'members']:
+        members += getattr(type_, name, None) or []
+
+    if hasattr(type_, 'root_index_to_member'):
+        members += type_.root_index_to_member.values()
+
+    for name in ['element_type', 'inner']:
+        if getattr(type_, name, None) is not None:
+            members.append(getattr(type_, name))
+
+    return members
+
+
+def format_declaration(type_line, declarator):
+    """Returns a declaration of given declarator, with the asterisk of
+    pointer types next to it.
+
+    """
+
+    if type_line.endswith('*'):
+        return '{}{};'.format(type_line, declarator)
+    else:
+        return '{} {};'.format(type_line, declarator)
+
+
 def strip_blank_lines(lines):
     try:
         while lines[0] == '':
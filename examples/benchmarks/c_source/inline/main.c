@@ -0,0 +1,156 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "uper.h"
+
+#define NUMBER_OF_PDUS 1000
+#define ENCODED_SIZE 40
+
+static struct uper_my_protocol_pdu_t pdus[NUMBER_OF_PDUS];
+static struct uper_my_protocol_pdu_t decoded[NUMBER_OF_PDUS];
+static uint8_t encoded[NUMBER_OF_PDUS * ENCODED_SIZE];
+static size_t offsets[NUMBER_OF_PDUS];
+
+static void init_pdu(struct uper_my_protocol_pdu_t *pdu_p, int i)
+{
+    memset(pdu_p, 0, sizeof(*pdu_p));
+    pdu_p->a = i;
+    pdu_p->b.choice = uper_my_protocol_pdu_b_choice_a_e;
+    pdu_p->b.value.a.length = 2;
+
+    /* First element. */
+    pdu_p->b.value.a.elements[0].choice = uper_my_protocol_b_choice_a_e;
+    pdu_p->b.value.a.elements[0].value.a.is_a_present = true;
+    pdu_p->b.value.a.elements[0].value.a.a.a.length = 0;
+    pdu_p->b.value.a.elements[0].value.a.a.is_b_present = false;
+    pdu_p->b.value.a.elements[0].value.a.a.c = 0;
+    pdu_p->b.value.a.elements[0].value.a.b = 4294967295;
+    pdu_p->b.value.a.elements[0].value.a.c.choice = uper_my_protocol_c_c_choice_a_e;
+    pdu_p->b.value.a.elements[0].value.a.c.value.a.elements[0].length = 3;
+    memcpy(&pdu_p->b.value.a.elements[0].value.a.c.value.a.elements[0].buf[0],
+           "\x00\x01\x02",
+           3);
+    pdu_p->b.value.a.elements[0].value.a.c.value.a.elements[1].length = 4;
+    memcpy(&pdu_p->b.value.a.elements[0].value.a.c.value.a.elements[1].buf[0],
+           "\x00\x01\x02\x03",
+           4);
+    pdu_p->b.value.a.elements[0].value.a.c.value.a.elements[2].length = 5;
+    memcpy(&pdu_p->b.value.a.elements[0].value.a.c.value.a.elements[2].buf[0],
+           "\x00\x01\x02\x03\x04",
+           5);
+    pdu_p->b.value.a.elements[0].value.a.d.a = true;
+
+    /* Second element. */
+    pdu_p->b.value.a.elements[1].choice = uper_my_protocol_b_choice_b_e;
+    pdu_p->b.value.a.elements[1].value.b.length = 16;
+    memset(&pdu_p->b.value.a.elements[1].value.b.buf[0], 0x5a, 16);
+}
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static ssize_t encode_per_call(void)
+{
+    ssize_t res;
+    size_t pos;
+    int i;
+
+    pos = 0;
+
+    for (i = 0; i < NUMBER_OF_PDUS; i++) {
+        res = uper_my_protocol_pdu_encode(&encoded[pos],
+                                          sizeof(encoded) - pos,
+                                          &pdus[i]);
+
+        if (res <= 0) {
+            return (res);
+        }
+
+        offsets[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+static ssize_t decode_per_call(size_t size)
+{
+    ssize_t res;
+    size_t pos;
+    int i;
+
+    pos = 0;
+
+    for (i = 0; i < NUMBER_OF_PDUS; i++) {
+        res = uper_my_protocol_pdu_decode(&decoded[i],
+                                          &encoded[pos],
+                                          size - pos);
+
+        if (res <= 0) {
+            return (res);
+        }
+
+        offsets[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+static void print_result(const char *name_p, double elapsed, int iterations)
+{
+    printf("%-20s %8.3f s %12.0f PDUs/s\n",
+           name_p,
+           elapsed,
+           (double)iterations * NUMBER_OF_PDUS / elapsed);
+}
+
+int main(int argc, const char *argv[])
+{
+    int i;
+    int iterations;
+    ssize_t size;
+    ssize_t res;
+    double start;
+
+    iterations = atoi(argv[1]);
+
+    for (i = 0; i < NUMBER_OF_PDUS; i++) {
+        init_pdu(&pdus[i], i);
+    }
+
+    size = encode_per_call();
+
+    start = now();
+
+    for (i = 0; i < iterations; i++) {
+        res = encode_per_call();
+        assert(res == size);
+    }
+
+    print_result("Encode:", now() - start, iterations);
+    start = now();
+
+    for (i = 0; i < iterations; i++) {
+        res = decode_per_call((size_t)size);
+        assert(res == size);
+    }
+
+    print_result("Decode:", now() - start, iterations);
+
+    /* Just a sanity check that decoding was performed. */
+    assert(decoded[NUMBER_OF_PDUS - 1].a == NUMBER_OF_PDUS - 1);
+
+    return (0);
+}
@@ -0,0 +1,12674 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 15:02:06 2026.
+ */
+
+#include <string.h>
+
+#include "ber.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = (ssize_t)size;
+    self_p->size_only = false;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    ssize_t length;
+
+    if (self_p->size < 0) {
+        return (self_p->size);
+    }
+
+    length = (self_p->size - self_p->pos);
+
+    /* Encoded backwards from the end of the buffer, move to the start. */
+    if ((self_p->buf_p != NULL) && (self_p->pos > 0)) {
+        (void)memmove(&self_p->buf_p[0],
+                      &self_p->buf_p[self_p->pos],
+                      (size_t)length);
+    }
+
+    return (length);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if (self_p->size_only) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos -= (ssize_t)size;
+    } else if (self_p->pos >= (ssize_t)size) {
+        self_p->pos -= (ssize_t)size;
+        pos = self_p->pos;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_prepend_bytes(struct encoder_t *self_p,
+                                  const uint8_t *buf_p,
+                                  size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_prepend_uint8(struct encoder_t *self_p,
+                                  uint8_t value)
+{
+    encoder_prepend_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_prepend_long_uint(struct encoder_t *self_p,
+                                      uint64_t value,
+                                      uint8_t number_of_bytes)
+{
+    uint8_t buf[8];
+    uint8_t i;
+
+    for (i = number_of_bytes; i > 0u; i--) {
+        buf[i - 1u] = (uint8_t)value;
+        value >>= 8;
+    }
+
+    encoder_prepend_bytes(self_p, &buf[0], number_of_bytes);
+}
+
+static void encoder_prepend_tag(struct encoder_t *self_p,
+                                uint32_t tag)
+{
+    do {
+        encoder_prepend_uint8(self_p, (uint8_t)tag);
+        tag >>= 8;
+    } while (tag != 0u);
+}
+
+static void encoder_prepend_length(struct encoder_t *self_p,
+                                   uint32_t length)
+{
+    uint8_t number_of_bytes;
+
+    if (length < 128u) {
+        encoder_prepend_uint8(self_p, (uint8_t)length);
+    } else {
+        number_of_bytes = 1;
+
+        while ((number_of_bytes < 4u)
+               && ((length >> (8u * number_of_bytes)) != 0u)) {
+            number_of_bytes++;
+        }
+
+        encoder_prepend_long_uint(self_p, length, number_of_bytes);
+        encoder_prepend_uint8(self_p, (uint8_t)(0x80u | number_of_bytes));
+    }
+}
+
+static void encoder_prepend_tag_length(struct encoder_t *self_p,
+                                       uint32_t tag,
+                                       ssize_t start)
+{
+    encoder_prepend_length(self_p, (uint32_t)(start - self_p->pos));
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void encoder_prepend_integer(struct encoder_t *self_p,
+                                    uint32_t tag,
+                                    int64_t value)
+{
+    ssize_t start;
+    uint64_t bits;
+    uint8_t number_of_bytes;
+
+    start = self_p->pos;
+    bits = (uint64_t)value;
+
+    if (value < 0) {
+        bits = ~bits;
+    }
+
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8u)
+           && ((bits >> ((8u * number_of_bytes) - 1u)) != 0u)) {
+        number_of_bytes++;
+    }
+
+    encoder_prepend_long_uint(self_p, (uint64_t)value, number_of_bytes);
+    encoder_prepend_tag_length(self_p, tag, start);
+}
+
+static void encoder_prepend_unsigned_integer(struct encoder_t *self_p,
+                                             uint32_t tag,
+                                             uint64_t value)
+{
+    ssize_t start;
+    uint8_t number_of_bytes;
+
+    start = self_p->pos;
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8u)
+           && ((value >> ((8u * number_of_bytes) - 1u)) != 0u)) {
+        number_of_bytes++;
+    }
+
+    encoder_prepend_long_uint(self_p, value, number_of_bytes);
+
+    /* A leading zero byte keeps values above INT64_MAX positive. */
+    if ((value >> 63) != 0u) {
+        encoder_prepend_uint8(self_p, 0);
+    }
+
+    encoder_prepend_tag_length(self_p, tag, start);
+}
+
+static void encoder_prepend_bool(struct encoder_t *self_p,
+                                 uint32_t tag,
+                                 bool value)
+{
+    encoder_prepend_uint8(self_p, value ? 0xffu : 0x00u);
+    encoder_prepend_uint8(self_p, 1);
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void encoder_prepend_null(struct encoder_t *self_p,
+                                 uint32_t tag)
+{
+    encoder_prepend_uint8(self_p, 0);
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void encoder_prepend_real(struct encoder_t *self_p,
+                                 uint32_t tag,
+                                 double value)
+{
+    ssize_t start;
+    uint64_t bits;
+    uint64_t mantissa;
+    int32_t exponent;
+    uint8_t number_of_bytes;
+    uint8_t control;
+
+    start = self_p->pos;
+    (void)memcpy(&bits, &value, sizeof(bits));
+    exponent = (int32_t)((bits >> 52) & 0x7ffu);
+    mantissa = (bits & 0x000fffffffffffffull);
+
+    if (exponent == 0x7ff) {
+        if (mantissa != 0u) {
+            encoder_prepend_uint8(self_p, 0x42);
+        } else if ((bits >> 63) != 0u) {
+            encoder_prepend_uint8(self_p, 0x41);
+        } else {
+            encoder_prepend_uint8(self_p, 0x40);
+        }
+    } else if ((exponent == 0) && (mantissa == 0u)) {
+        /* Plus zero has no contents octets. */
+        if ((bits >> 63) != 0u) {
+            encoder_prepend_uint8(self_p, 0x43);
+        }
+    } else {
+        if (exponent == 0) {
+            exponent = -1074;
+        } else {
+            mantissa |= 0x0010000000000000ull;
+            exponent -= 1075;
+        }
+
+        /* DER requires an odd mantissa. */
+        while ((mantissa & 1u) == 0u) {
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        number_of_bytes = 1;
+
+        while ((mantissa >> (8u * number_of_bytes)) != 0u) {
+            number_of_bytes++;
+        }
+
+        encoder_prepend_long_uint(self_p, mantissa, number_of_bytes);
+
+        if ((exponent >= -128) && (exponent < 128)) {
+            encoder_prepend_uint8(self_p, (uint8_t)exponent);
+            control = 0x80;
+        } else {
+            encoder_prepend_long_uint(self_p, (uint64_t)(int64_t)exponent, 2);
+            control = 0x81;
+        }
+
+        if ((bits >> 63) != 0u) {
+            control |= 0x40u;
+        }
+
+        encoder_prepend_uint8(self_p, control);
+    }
+
+    encoder_prepend_tag_length(self_p, tag, start);
+}
+
+static void encoder_prepend_octet_string(struct encoder_t *self_p,
+                                         uint32_t tag,
+                                         const uint8_t *buf_p,
+                                         uint32_t length)
+{
+    encoder_prepend_bytes(self_p, buf_p, length);
+    encoder_prepend_length(self_p, length);
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void encoder_prepend_bit_string(struct encoder_t *self_p,
+                                       uint32_t tag,
+                                       uint64_t value,
+                                       uint8_t number_of_bits)
+{
+    uint8_t number_of_bytes;
+    uint8_t number_of_unused_bits;
+
+    number_of_bytes = (uint8_t)((number_of_bits + 7u) / 8u);
+    number_of_unused_bits = (uint8_t)((8u * number_of_bytes) - number_of_bits);
+
+    if (number_of_bits < 64u) {
+        value &= ((1ull << number_of_bits) - 1u);
+    }
+
+    encoder_prepend_long_uint(self_p,
+                              value << number_of_unused_bits,
+                              number_of_bytes);
+    encoder_prepend_uint8(self_p, number_of_unused_bits);
+    encoder_prepend_uint8(self_p, (uint8_t)(number_of_bytes + 1u));
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint64_t decoder_read_long_uint(struct decoder_t *self_p,
+                                       uint8_t number_of_bytes)
+{
+    uint64_t value;
+    uint8_t i;
+
+    value = 0;
+
+    for (i = 0; i < number_of_bytes; i++) {
+        value <<= 8;
+        value |= decoder_read_uint8(self_p);
+    }
+
+    return (value);
+}
+
+static uint32_t decoder_read_tag(struct decoder_t *self_p)
+{
+    uint32_t tag;
+    uint8_t i;
+
+    tag = decoder_read_uint8(self_p);
+
+    if ((tag & 0x1fu) == 0x1fu) {
+        i = 1;
+
+        do {
+            if (i == 4u) {
+                decoder_abort(self_p, EBADTAG);
+
+                return (0);
+            }
+
+            tag <<= 8;
+            tag |= (uint32_t)decoder_read_uint8(self_p);
+            i++;
+        } while ((tag & 0x80u) == 0x80u);
+    }
+
+    return (tag);
+}
+
+static uint32_t decoder_peek_tag(const struct decoder_t *self_p)
+{
+    struct decoder_t decoder;
+
+    decoder = *self_p;
+
+    return (decoder_read_tag(&decoder));
+}
+
+static uint32_t decoder_read_length(struct decoder_t *self_p)
+{
+    uint32_t length;
+    uint8_t number_of_bytes;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        number_of_bytes = (uint8_t)(length & 0x7fu);
+
+        /* Indefinite lengths are not supported. */
+        if ((number_of_bytes == 0u) || (number_of_bytes > 4u)) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = (uint32_t)decoder_read_long_uint(self_p, number_of_bytes);
+    }
+
+    if ((size_t)length > (size_t)(self_p->size - self_p->pos)) {
+        decoder_abort(self_p, EOUTOFDATA);
+
+        return (0);
+    }
+
+    return (length);
+}
+
+static uint32_t decoder_read_tag_length(struct decoder_t *self_p,
+                                        uint32_t tag)
+{
+    if (decoder_read_tag(self_p) != tag) {
+        decoder_abort(self_p, EBADTAG);
+
+        return (0);
+    }
+
+    return (decoder_read_length(self_p));
+}
+
+static ssize_t decoder_enter(struct decoder_t *self_p,
+                             uint32_t tag)
+{
+    ssize_t size;
+    uint32_t length;
+
+    length = decoder_read_tag_length(self_p, tag);
+    size = self_p->size;
+
+    /* Limit decoding to the contents of the constructed value. */
+    if (size >= 0) {
+        self_p->size = (self_p->pos + (ssize_t)length);
+    }
+
+    return (size);
+}
+
+static void decoder_leave(struct decoder_t *self_p,
+                          ssize_t size)
+{
+    if (self_p->size < 0) {
+        return;
+    }
+
+    if (self_p->pos != self_p->size) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    self_p->size = size;
+}
+
+static void decoder_skip(struct decoder_t *self_p,
+                         uint32_t tag)
+{
+    (void)decoder_free(self_p, decoder_read_tag_length(self_p, tag));
+}
+
+static void decoder_skip_additions(struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        self_p->pos = self_p->size;
+    }
+}
+
+static uint32_t decoder_count_elements(const struct decoder_t *self_p)
+{
+    struct decoder_t decoder;
+    uint32_t count;
+
+    decoder = *self_p;
+    count = 0;
+
+    while (decoder.pos < decoder.size) {
+        (void)decoder_read_tag(&decoder);
+        (void)decoder_free(&decoder, decoder_read_length(&decoder));
+        count++;
+    }
+
+    return (count);
+}
+
+static int64_t decoder_read_integer(struct decoder_t *self_p,
+                                    uint32_t tag)
+{
+    uint32_t length;
+    uint64_t value;
+
+    length = decoder_read_tag_length(self_p, tag);
+
+    if ((length == 0u) || (length > 8u)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    value = decoder_read_long_uint(self_p, (uint8_t)length);
+
+    if ((length < 8u) && ((value & (1ull << ((8u * length) - 1u))) != 0u)) {
+        value |= (0xffffffffffffffffull << (8u * length));
+    }
+
+    return ((int64_t)value);
+}
+
+static uint64_t decoder_read_unsigned_integer(struct decoder_t *self_p,
+                                              uint32_t tag)
+{
+    uint32_t length;
+
+    length = decoder_read_tag_length(self_p, tag);
+
+    if ((length == 0u) || (length > 9u)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    if (length == 9u) {
+        if (decoder_read_uint8(self_p) != 0u) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = 8;
+    }
+
+    return (decoder_read_long_uint(self_p, (uint8_t)length));
+}
+
+static bool decoder_read_bool(struct decoder_t *self_p,
+                              uint32_t tag)
+{
+    if (decoder_read_tag_length(self_p, tag) != 1u) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (false);
+    }
+
+    return (decoder_read_uint8(self_p) != 0u);
+}
+
+static void decoder_read_null(struct decoder_t *self_p,
+                              uint32_t tag)
+{
+    if (decoder_read_tag_length(self_p, tag) != 0u) {
+        decoder_abort(self_p, EBADLENGTH);
+    }
+}
+
+static double decoder_read_real(struct decoder_t *self_p,
+                                uint32_t tag)
+{
+    uint32_t length;
+    uint8_t control;
+    uint8_t number_of_bytes;
+    uint64_t mantissa;
+    uint64_t bits;
+    int32_t exponent;
+    int32_t shift;
+    double value;
+
+    length = decoder_read_tag_length(self_p, tag);
+    bits = 0;
+
+    if (length == 0u) {
+        (void)memcpy(&value, &bits, sizeof(value));
+
+        return (value);
+    }
+
+    control = decoder_read_uint8(self_p);
+
+    if ((control & 0x80u) == 0u) {
+        if ((length != 1u) || ((control & 0xfcu) != 0x40u)) {
+            /* Decimal encodings are not supported. */
+            decoder_abort(self_p, EINVAL);
+
+            return (0.0);
+        }
+
+        if (control == 0x40u) {
+            bits = 0x7ff0000000000000ull;
+        } else if (control == 0x41u) {
+            bits = 0xfff0000000000000ull;
+        } else if (control == 0x42u) {
+            bits = 0x7ff8000000000000ull;
+        } else {
+            bits = 0x8000000000000000ull;
+        }
+
+        (void)memcpy(&value, &bits, sizeof(value));
+
+        return (value);
+    }
+
+    /* Base 2, 8 or 16, and an exponent of one to three bytes. */
+    number_of_bytes = (uint8_t)((control & 0x03u) + 1u);
+
+    if (((control & 0x30u) == 0x30u)
+        || (number_of_bytes == 4u)
+        || (length < (number_of_bytes + 2u))
+        || ((length - number_of_bytes - 1u) > 8u)) {
+        decoder_abort(self_p, EINVAL);
+
+        return (0.0);
+    }
+
+    exponent = (int32_t)decoder_read_long_uint(self_p, number_of_bytes);
+
+    if ((exponent & (1 << ((8 * number_of_bytes) - 1))) != 0) {
+        exponent -= (1 << (8 * number_of_bytes));
+    }
+
+    if ((control & 0x30u) == 0x10u) {
+        exponent *= 3;
+    } else if ((control & 0x30u) == 0x20u) {
+        exponent *= 4;
+    }
+
+    exponent += (int32_t)((control >> 2) & 0x03u);
+    mantissa = decoder_read_long_uint(self_p,
+                                      (uint8_t)(length - number_of_bytes - 1u));
+
+    if (mantissa != 0u) {
+        while ((mantissa & 1u) == 0u) {
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        if ((mantissa >> 53) != 0u) {
+            decoder_abort(self_p, EINVAL);
+
+            return (0.0);
+        }
+
+        while ((mantissa & 0x0010000000000000ull) == 0u) {
+            mantissa <<= 1;
+            exponent--;
+        }
+
+        exponent += 1075;
+
+        if (exponent >= 0x7ff) {
+            decoder_abort(self_p, EINVAL);
+
+            return (0.0);
+        } else if (exponent <= 0) {
+            /* Subnormal number, must be exact. */
+            shift = (1 - exponent);
+
+            if ((shift > 52)
+                || ((mantissa & ((1ull << shift) - 1u)) != 0u)) {
+                decoder_abort(self_p, EINVAL);
+
+                return (0.0);
+            }
+
+            mantissa >>= shift;
+            exponent = 0;
+        } else {
+            mantissa &= 0x000fffffffffffffull;
+        }
+
+        bits = (((uint64_t)exponent << 52) | mantissa);
+    }
+
+    if ((control & 0x40u) != 0u) {
+        bits |= 0x8000000000000000ull;
+    }
+
+    (void)memcpy(&value, &bits, sizeof(value));
+
+    return (value);
+}
+
+static uint64_t decoder_read_bit_string(struct decoder_t *self_p,
+                                        uint32_t tag,
+                                        uint8_t number_of_bits)
+{
+    uint8_t number_of_bytes;
+    uint8_t number_of_unused_bits;
+
+    number_of_bytes = (uint8_t)((number_of_bits + 7u) / 8u);
+    number_of_unused_bits = (uint8_t)((8u * number_of_bytes) - number_of_bits);
+
+    if (decoder_read_tag_length(self_p, tag) != (number_of_bytes + 1u)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    if (decoder_read_uint8(self_p) != number_of_unused_bits) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    return (decoder_read_long_uint(self_p, number_of_bytes)
+            >> number_of_unused_bits);
+}
+
+static void ber_c_source_a_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_a_t *src_p)
+{
+    encoder_prepend_octet_string(encoder_p,
+                                 0x89u,
+                                 &src_p->j.buf[0],
+                                 11u);
+    encoder_prepend_bool(encoder_p, 0x88u, src_p->i);
+    encoder_prepend_unsigned_integer(encoder_p, 0x87u, src_p->h);
+    encoder_prepend_unsigned_integer(encoder_p, 0x86u, src_p->g);
+    encoder_prepend_unsigned_integer(encoder_p, 0x85u, src_p->f);
+    encoder_prepend_unsigned_integer(encoder_p, 0x84u, src_p->e);
+    encoder_prepend_integer(encoder_p, 0x83u, src_p->d);
+    encoder_prepend_integer(encoder_p, 0x82u, src_p->c);
+    encoder_prepend_integer(encoder_p, 0x81u, src_p->b);
+    encoder_prepend_integer(encoder_p, 0x80u, src_p->a);
+}
+
+static void ber_c_source_a_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_a_t *dst_p)
+{
+    uint32_t length;
+
+    dst_p->a = (int8_t)decoder_read_integer(decoder_p, 0x80u);
+    dst_p->b = (int16_t)decoder_read_integer(decoder_p, 0x81u);
+    dst_p->c = (int32_t)decoder_read_integer(decoder_p, 0x82u);
+    dst_p->d = decoder_read_integer(decoder_p, 0x83u);
+    dst_p->e = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x84u);
+    dst_p->f = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x85u);
+    dst_p->g = (uint32_t)decoder_read_unsigned_integer(decoder_p, 0x86u);
+    dst_p->h = decoder_read_unsigned_integer(decoder_p, 0x87u);
+    dst_p->i = decoder_read_bool(decoder_p, 0x88u);
+    length = decoder_read_tag_length(decoder_p, 0x89u);
+
+    if (length != 11u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->j.buf[0],
+                       length);
+}
+
+static void ber_c_source_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_a_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_a_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_a_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_a_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_a_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_A_FIELD_A) != 0u) {
+        dst_p->a = (int8_t)decoder_read_integer(decoder_p, 0x80u);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_B) != 0u) {
+        dst_p->b = (int16_t)decoder_read_integer(decoder_p, 0x81u);
+    } else {
+        decoder_skip(decoder_p, 0x81u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_C) != 0u) {
+        dst_p->c = (int32_t)decoder_read_integer(decoder_p, 0x82u);
+    } else {
+        decoder_skip(decoder_p, 0x82u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_integer(decoder_p, 0x83u);
+    } else {
+        decoder_skip(decoder_p, 0x83u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_E) != 0u) {
+        dst_p->e = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x84u);
+    } else {
+        decoder_skip(decoder_p, 0x84u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_F) != 0u) {
+        dst_p->f = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x85u);
+    } else {
+        decoder_skip(decoder_p, 0x85u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_G) != 0u) {
+        dst_p->g = (uint32_t)decoder_read_unsigned_integer(decoder_p, 0x86u);
+    } else {
+        decoder_skip(decoder_p, 0x86u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_H) != 0u) {
+        dst_p->h = decoder_read_unsigned_integer(decoder_p, 0x87u);
+    } else {
+        decoder_skip(decoder_p, 0x87u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_I) != 0u) {
+        dst_p->i = decoder_read_bool(decoder_p, 0x88u);
+    } else {
+        decoder_skip(decoder_p, 0x88u);
+    }
+    if ((fields & BER_C_SOURCE_A_FIELD_J) != 0u) {
+        length = decoder_read_tag_length(decoder_p, 0x89u);
+
+        if (length != 11u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->j.buf[0],
+                           length);
+    } else {
+        decoder_skip(decoder_p, 0x89u);
+    }
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_ab_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ab_t *src_p)
+{
+    ssize_t start;
+    ssize_t start_2;
+
+    start_2 = encoder_p->pos;
+    encoder_prepend_unsigned_integer(encoder_p, 0x02u, src_p->b);
+    encoder_prepend_tag_length(encoder_p, 0xa1u, start_2);
+    start = encoder_p->pos;
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->a);
+    encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+}
+
+static void ber_c_source_ab_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ab_t *dst_p)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    outer_size = decoder_enter(decoder_p, 0xa0u);
+    dst_p->a = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+    decoder_leave(decoder_p, outer_size);
+    outer_size_2 = decoder_enter(decoder_p, 0xa1u);
+    dst_p->b = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x02u);
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_ab_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ab_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ab_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ab_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ab_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ab_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ab_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ab_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+
+    outer_size_3 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AB_FIELD_A) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+        dst_p->a = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa0u);
+    }
+    if ((fields & BER_C_SOURCE_AB_FIELD_B) != 0u) {
+        outer_size_2 = decoder_enter(decoder_p, 0xa1u);
+        dst_p->b = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x02u);
+        decoder_leave(decoder_p, outer_size_2);
+    } else {
+        decoder_skip(decoder_p, 0xa1u);
+    }
+    decoder_leave(decoder_p, outer_size_3);
+}
+
+static void ber_c_source_ab_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_q_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_q_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case ber_c_source_q_choice_c001_e:
+        encoder_prepend_bool(encoder_p, 0x80u, src_p->value.c001);
+        break;
+
+    case ber_c_source_q_choice_c002_e:
+        encoder_prepend_bool(encoder_p, 0x81u, src_p->value.c002);
+        break;
+
+    case ber_c_source_q_choice_c003_e:
+        encoder_prepend_bool(encoder_p, 0x82u, src_p->value.c003);
+        break;
+
+    case ber_c_source_q_choice_c004_e:
+        encoder_prepend_bool(encoder_p, 0x83u, src_p->value.c004);
+        break;
+
+    case ber_c_source_q_choice_c005_e:
+        encoder_prepend_bool(encoder_p, 0x84u, src_p->value.c005);
+        break;
+
+    case ber_c_source_q_choice_c006_e:
+        encoder_prepend_bool(encoder_p, 0x85u, src_p->value.c006);
+        break;
+
+    case ber_c_source_q_choice_c007_e:
+        encoder_prepend_bool(encoder_p, 0x86u, src_p->value.c007);
+        break;
+
+    case ber_c_source_q_choice_c008_e:
+        encoder_prepend_bool(encoder_p, 0x87u, src_p->value.c008);
+        break;
+
+    case ber_c_source_q_choice_c009_e:
+        encoder_prepend_bool(encoder_p, 0x88u, src_p->value.c009);
+        break;
+
+    case ber_c_source_q_choice_c010_e:
+        encoder_prepend_bool(encoder_p, 0x89u, src_p->value.c010);
+        break;
+
+    case ber_c_source_q_choice_c011_e:
+        encoder_prepend_bool(encoder_p, 0x8au, src_p->value.c011);
+        break;
+
+    case ber_c_source_q_choice_c012_e:
+        encoder_prepend_bool(encoder_p, 0x8bu, src_p->value.c012);
+        break;
+
+    case ber_c_source_q_choice_c013_e:
+        encoder_prepend_bool(encoder_p, 0x8cu, src_p->value.c013);
+        break;
+
+    case ber_c_source_q_choice_c014_e:
+        encoder_prepend_bool(encoder_p, 0x8du, src_p->value.c014);
+        break;
+
+    case ber_c_source_q_choice_c015_e:
+        encoder_prepend_bool(encoder_p, 0x8eu, src_p->value.c015);
+        break;
+
+    case ber_c_source_q_choice_c016_e:
+        encoder_prepend_bool(encoder_p, 0x8fu, src_p->value.c016);
+        break;
+
+    case ber_c_source_q_choice_c017_e:
+        encoder_prepend_bool(encoder_p, 0x90u, src_p->value.c017);
+        break;
+
+    case ber_c_source_q_choice_c018_e:
+        encoder_prepend_bool(encoder_p, 0x91u, src_p->value.c018);
+        break;
+
+    case ber_c_source_q_choice_c019_e:
+        encoder_prepend_bool(encoder_p, 0x92u, src_p->value.c019);
+        break;
+
+    case ber_c_source_q_choice_c020_e:
+        encoder_prepend_bool(encoder_p, 0x93u, src_p->value.c020);
+        break;
+
+    case ber_c_source_q_choice_c021_e:
+        encoder_prepend_bool(encoder_p, 0x94u, src_p->value.c021);
+        break;
+
+    case ber_c_source_q_choice_c022_e:
+        encoder_prepend_bool(encoder_p, 0x95u, src_p->value.c022);
+        break;
+
+    case ber_c_source_q_choice_c023_e:
+        encoder_prepend_bool(encoder_p, 0x96u, src_p->value.c023);
+        break;
+
+    case ber_c_source_q_choice_c024_e:
+        encoder_prepend_bool(encoder_p, 0x97u, src_p->value.c024);
+        break;
+
+    case ber_c_source_q_choice_c025_e:
+        encoder_prepend_bool(encoder_p, 0x98u, src_p->value.c025);
+        break;
+
+    case ber_c_source_q_choice_c026_e:
+        encoder_prepend_bool(encoder_p, 0x99u, src_p->value.c026);
+        break;
+
+    case ber_c_source_q_choice_c027_e:
+        encoder_prepend_bool(encoder_p, 0x9au, src_p->value.c027);
+        break;
+
+    case ber_c_source_q_choice_c028_e:
+        encoder_prepend_bool(encoder_p, 0x9bu, src_p->value.c028);
+        break;
+
+    case ber_c_source_q_choice_c029_e:
+        encoder_prepend_bool(encoder_p, 0x9cu, src_p->value.c029);
+        break;
+
+    case ber_c_source_q_choice_c030_e:
+        encoder_prepend_bool(encoder_p, 0x9du, src_p->value.c030);
+        break;
+
+    case ber_c_source_q_choice_c031_e:
+        encoder_prepend_bool(encoder_p, 0x9eu, src_p->value.c031);
+        break;
+
+    case ber_c_source_q_choice_c032_e:
+        encoder_prepend_bool(encoder_p, 0x9f1fu, src_p->value.c032);
+        break;
+
+    case ber_c_source_q_choice_c033_e:
+        encoder_prepend_bool(encoder_p, 0x9f20u, src_p->value.c033);
+        break;
+
+    case ber_c_source_q_choice_c034_e:
+        encoder_prepend_bool(encoder_p, 0x9f21u, src_p->value.c034);
+        break;
+
+    case ber_c_source_q_choice_c035_e:
+        encoder_prepend_bool(encoder_p, 0x9f22u, src_p->value.c035);
+        break;
+
+    case ber_c_source_q_choice_c036_e:
+        encoder_prepend_bool(encoder_p, 0x9f23u, src_p->value.c036);
+        break;
+
+    case ber_c_source_q_choice_c037_e:
+        encoder_prepend_bool(encoder_p, 0x9f24u, src_p->value.c037);
+        break;
+
+    case ber_c_source_q_choice_c038_e:
+        encoder_prepend_bool(encoder_p, 0x9f25u, src_p->value.c038);
+        break;
+
+    case ber_c_source_q_choice_c039_e:
+        encoder_prepend_bool(encoder_p, 0x9f26u, src_p->value.c039);
+        break;
+
+    case ber_c_source_q_choice_c040_e:
+        encoder_prepend_bool(encoder_p, 0x9f27u, src_p->value.c040);
+        break;
+
+    case ber_c_source_q_choice_c041_e:
+        encoder_prepend_bool(encoder_p, 0x9f28u, src_p->value.c041);
+        break;
+
+    case ber_c_source_q_choice_c042_e:
+        encoder_prepend_bool(encoder_p, 0x9f29u, src_p->value.c042);
+        break;
+
+    case ber_c_source_q_choice_c043_e:
+        encoder_prepend_bool(encoder_p, 0x9f2au, src_p->value.c043);
+        break;
+
+    case ber_c_source_q_choice_c044_e:
+        encoder_prepend_bool(encoder_p, 0x9f2bu, src_p->value.c044);
+        break;
+
+    case ber_c_source_q_choice_c045_e:
+        encoder_prepend_bool(encoder_p, 0x9f2cu, src_p->value.c045);
+        break;
+
+    case ber_c_source_q_choice_c046_e:
+        encoder_prepend_bool(encoder_p, 0x9f2du, src_p->value.c046);
+        break;
+
+    case ber_c_source_q_choice_c047_e:
+        encoder_prepend_bool(encoder_p, 0x9f2eu, src_p->value.c047);
+        break;
+
+    case ber_c_source_q_choice_c048_e:
+        encoder_prepend_bool(encoder_p, 0x9f2fu, src_p->value.c048);
+        break;
+
+    case ber_c_source_q_choice_c049_e:
+        encoder_prepend_bool(encoder_p, 0x9f30u, src_p->value.c049);
+        break;
+
+    case ber_c_source_q_choice_c050_e:
+        encoder_prepend_bool(encoder_p, 0x9f31u, src_p->value.c050);
+        break;
+
+    case ber_c_source_q_choice_c051_e:
+        encoder_prepend_bool(encoder_p, 0x9f32u, src_p->value.c051);
+        break;
+
+    case ber_c_source_q_choice_c052_e:
+        encoder_prepend_bool(encoder_p, 0x9f33u, src_p->value.c052);
+        break;
+
+    case ber_c_source_q_choice_c053_e:
+        encoder_prepend_bool(encoder_p, 0x9f34u, src_p->value.c053);
+        break;
+
+    case ber_c_source_q_choice_c054_e:
+        encoder_prepend_bool(encoder_p, 0x9f35u, src_p->value.c054);
+        break;
+
+    case ber_c_source_q_choice_c055_e:
+        encoder_prepend_bool(encoder_p, 0x9f36u, src_p->value.c055);
+        break;
+
+    case ber_c_source_q_choice_c056_e:
+        encoder_prepend_bool(encoder_p, 0x9f37u, src_p->value.c056);
+        break;
+
+    case ber_c_source_q_choice_c057_e:
+        encoder_prepend_bool(encoder_p, 0x9f38u, src_p->value.c057);
+        break;
+
+    case ber_c_source_q_choice_c058_e:
+        encoder_prepend_bool(encoder_p, 0x9f39u, src_p->value.c058);
+        break;
+
+    case ber_c_source_q_choice_c059_e:
+        encoder_prepend_bool(encoder_p, 0x9f3au, src_p->value.c059);
+        break;
+
+    case ber_c_source_q_choice_c060_e:
+        encoder_prepend_bool(encoder_p, 0x9f3bu, src_p->value.c060);
+        break;
+
+    case ber_c_source_q_choice_c061_e:
+        encoder_prepend_bool(encoder_p, 0x9f3cu, src_p->value.c061);
+        break;
+
+    case ber_c_source_q_choice_c062_e:
+        encoder_prepend_bool(encoder_p, 0x9f3du, src_p->value.c062);
+        break;
+
+    case ber_c_source_q_choice_c063_e:
+        encoder_prepend_bool(encoder_p, 0x9f3eu, src_p->value.c063);
+        break;
+
+    case ber_c_source_q_choice_c064_e:
+        encoder_prepend_bool(encoder_p, 0x9f3fu, src_p->value.c064);
+        break;
+
+    case ber_c_source_q_choice_c065_e:
+        encoder_prepend_bool(encoder_p, 0x9f40u, src_p->value.c065);
+        break;
+
+    case ber_c_source_q_choice_c066_e:
+        encoder_prepend_bool(encoder_p, 0x9f41u, src_p->value.c066);
+        break;
+
+    case ber_c_source_q_choice_c067_e:
+        encoder_prepend_bool(encoder_p, 0x9f42u, src_p->value.c067);
+        break;
+
+    case ber_c_source_q_choice_c068_e:
+        encoder_prepend_bool(encoder_p, 0x9f43u, src_p->value.c068);
+        break;
+
+    case ber_c_source_q_choice_c069_e:
+        encoder_prepend_bool(encoder_p, 0x9f44u, src_p->value.c069);
+        break;
+
+    case ber_c_source_q_choice_c070_e:
+        encoder_prepend_bool(encoder_p, 0x9f45u, src_p->value.c070);
+        break;
+
+    case ber_c_source_q_choice_c071_e:
+        encoder_prepend_bool(encoder_p, 0x9f46u, src_p->value.c071);
+        break;
+
+    case ber_c_source_q_choice_c072_e:
+        encoder_prepend_bool(encoder_p, 0x9f47u, src_p->value.c072);
+        break;
+
+    case ber_c_source_q_choice_c073_e:
+        encoder_prepend_bool(encoder_p, 0x9f48u, src_p->value.c073);
+        break;
+
+    case ber_c_source_q_choice_c074_e:
+        encoder_prepend_bool(encoder_p, 0x9f49u, src_p->value.c074);
+        break;
+
+    case ber_c_source_q_choice_c075_e:
+        encoder_prepend_bool(encoder_p, 0x9f4au, src_p->value.c075);
+        break;
+
+    case ber_c_source_q_choice_c076_e:
+        encoder_prepend_bool(encoder_p, 0x9f4bu, src_p->value.c076);
+        break;
+
+    case ber_c_source_q_choice_c077_e:
+        encoder_prepend_bool(encoder_p, 0x9f4cu, src_p->value.c077);
+        break;
+
+    case ber_c_source_q_choice_c078_e:
+        encoder_prepend_bool(encoder_p, 0x9f4du, src_p->value.c078);
+        break;
+
+    case ber_c_source_q_choice_c079_e:
+        encoder_prepend_bool(encoder_p, 0x9f4eu, src_p->value.c079);
+        break;
+
+    case ber_c_source_q_choice_c080_e:
+        encoder_prepend_bool(encoder_p, 0x9f4fu, src_p->value.c080);
+        break;
+
+    case ber_c_source_q_choice_c081_e:
+        encoder_prepend_bool(encoder_p, 0x9f50u, src_p->value.c081);
+        break;
+
+    case ber_c_source_q_choice_c082_e:
+        encoder_prepend_bool(encoder_p, 0x9f51u, src_p->value.c082);
+        break;
+
+    case ber_c_source_q_choice_c083_e:
+        encoder_prepend_bool(encoder_p, 0x9f52u, src_p->value.c083);
+        break;
+
+    case ber_c_source_q_choice_c084_e:
+        encoder_prepend_bool(encoder_p, 0x9f53u, src_p->value.c084);
+        break;
+
+    case ber_c_source_q_choice_c085_e:
+        encoder_prepend_bool(encoder_p, 0x9f54u, src_p->value.c085);
+        break;
+
+    case ber_c_source_q_choice_c086_e:
+        encoder_prepend_bool(encoder_p, 0x9f55u, src_p->value.c086);
+        break;
+
+    case ber_c_source_q_choice_c087_e:
+        encoder_prepend_bool(encoder_p, 0x9f56u, src_p->value.c087);
+        break;
+
+    case ber_c_source_q_choice_c088_e:
+        encoder_prepend_bool(encoder_p, 0x9f57u, src_p->value.c088);
+        break;
+
+    case ber_c_source_q_choice_c089_e:
+        encoder_prepend_bool(encoder_p, 0x9f58u, src_p->value.c089);
+        break;
+
+    case ber_c_source_q_choice_c090_e:
+        encoder_prepend_bool(encoder_p, 0x9f59u, src_p->value.c090);
+        break;
+
+    case ber_c_source_q_choice_c091_e:
+        encoder_prepend_bool(encoder_p, 0x9f5au, src_p->value.c091);
+        break;
+
+    case ber_c_source_q_choice_c092_e:
+        encoder_prepend_bool(encoder_p, 0x9f5bu, src_p->value.c092);
+        break;
+
+    case ber_c_source_q_choice_c093_e:
+        encoder_prepend_bool(encoder_p, 0x9f5cu, src_p->value.c093);
+        break;
+
+    case ber_c_source_q_choice_c094_e:
+        encoder_prepend_bool(encoder_p, 0x9f5du, src_p->value.c094);
+        break;
+
+    case ber_c_source_q_choice_c095_e:
+        encoder_prepend_bool(encoder_p, 0x9f5eu, src_p->value.c095);
+        break;
+
+    case ber_c_source_q_choice_c096_e:
+        encoder_prepend_bool(encoder_p, 0x9f5fu, src_p->value.c096);
+        break;
+
+    case ber_c_source_q_choice_c097_e:
+        encoder_prepend_bool(encoder_p, 0x9f60u, src_p->value.c097);
+        break;
+
+    case ber_c_source_q_choice_c098_e:
+        encoder_prepend_bool(encoder_p, 0x9f61u, src_p->value.c098);
+        break;
+
+    case ber_c_source_q_choice_c099_e:
+        encoder_prepend_bool(encoder_p, 0x9f62u, src_p->value.c099);
+        break;
+
+    case ber_c_source_q_choice_c100_e:
+        encoder_prepend_bool(encoder_p, 0x9f63u, src_p->value.c100);
+        break;
+
+    case ber_c_source_q_choice_c101_e:
+        encoder_prepend_bool(encoder_p, 0x9f64u, src_p->value.c101);
+        break;
+
+    case ber_c_source_q_choice_c102_e:
+        encoder_prepend_bool(encoder_p, 0x9f65u, src_p->value.c102);
+        break;
+
+    case ber_c_source_q_choice_c103_e:
+        encoder_prepend_bool(encoder_p, 0x9f66u, src_p->value.c103);
+        break;
+
+    case ber_c_source_q_choice_c104_e:
+        encoder_prepend_bool(encoder_p, 0x9f67u, src_p->value.c104);
+        break;
+
+    case ber_c_source_q_choice_c105_e:
+        encoder_prepend_bool(encoder_p, 0x9f68u, src_p->value.c105);
+        break;
+
+    case ber_c_source_q_choice_c106_e:
+        encoder_prepend_bool(encoder_p, 0x9f69u, src_p->value.c106);
+        break;
+
+    case ber_c_source_q_choice_c107_e:
+        encoder_prepend_bool(encoder_p, 0x9f6au, src_p->value.c107);
+        break;
+
+    case ber_c_source_q_choice_c108_e:
+        encoder_prepend_bool(encoder_p, 0x9f6bu, src_p->value.c108);
+        break;
+
+    case ber_c_source_q_choice_c109_e:
+        encoder_prepend_bool(encoder_p, 0x9f6cu, src_p->value.c109);
+        break;
+
+    case ber_c_source_q_choice_c110_e:
+        encoder_prepend_bool(encoder_p, 0x9f6du, src_p->value.c110);
+        break;
+
+    case ber_c_source_q_choice_c111_e:
+        encoder_prepend_bool(encoder_p, 0x9f6eu, src_p->value.c111);
+        break;
+
+    case ber_c_source_q_choice_c112_e:
+        encoder_prepend_bool(encoder_p, 0x9f6fu, src_p->value.c112);
+        break;
+
+    case ber_c_source_q_choice_c113_e:
+        encoder_prepend_bool(encoder_p, 0x9f70u, src_p->value.c113);
+        break;
+
+    case ber_c_source_q_choice_c114_e:
+        encoder_prepend_bool(encoder_p, 0x9f71u, src_p->value.c114);
+        break;
+
+    case ber_c_source_q_choice_c115_e:
+        encoder_prepend_bool(encoder_p, 0x9f72u, src_p->value.c115);
+        break;
+
+    case ber_c_source_q_choice_c116_e:
+        encoder_prepend_bool(encoder_p, 0x9f73u, src_p->value.c116);
+        break;
+
+    case ber_c_source_q_choice_c117_e:
+        encoder_prepend_bool(encoder_p, 0x9f74u, src_p->value.c117);
+        break;
+
+    case ber_c_source_q_choice_c118_e:
+        encoder_prepend_bool(encoder_p, 0x9f75u, src_p->value.c118);
+        break;
+
+    case ber_c_source_q_choice_c119_e:
+        encoder_prepend_bool(encoder_p, 0x9f76u, src_p->value.c119);
+        break;
+
+    case ber_c_source_q_choice_c120_e:
+        encoder_prepend_bool(encoder_p, 0x9f77u, src_p->value.c120);
+        break;
+
+    case ber_c_source_q_choice_c121_e:
+        encoder_prepend_bool(encoder_p, 0x9f78u, src_p->value.c121);
+        break;
+
+    case ber_c_source_q_choice_c122_e:
+        encoder_prepend_bool(encoder_p, 0x9f79u, src_p->value.c122);
+        break;
+
+    case ber_c_source_q_choice_c123_e:
+        encoder_prepend_bool(encoder_p, 0x9f7au, src_p->value.c123);
+        break;
+
+    case ber_c_source_q_choice_c124_e:
+        encoder_prepend_bool(encoder_p, 0x9f7bu, src_p->value.c124);
+        break;
+
+    case ber_c_source_q_choice_c125_e:
+        encoder_prepend_bool(encoder_p, 0x9f7cu, src_p->value.c125);
+        break;
+
+    case ber_c_source_q_choice_c126_e:
+        encoder_prepend_bool(encoder_p, 0x9f7du, src_p->value.c126);
+        break;
+
+    case ber_c_source_q_choice_c127_e:
+        encoder_prepend_bool(encoder_p, 0x9f7eu, src_p->value.c127);
+        break;
+
+    case ber_c_source_q_choice_c128_e:
+        encoder_prepend_bool(encoder_p, 0x9f7fu, src_p->value.c128);
+        break;
+
+    case ber_c_source_q_choice_c129_e:
+        encoder_prepend_bool(encoder_p, 0x9f8100u, src_p->value.c129);
+        break;
+
+    case ber_c_source_q_choice_c130_e:
+        encoder_prepend_bool(encoder_p, 0x9f8101u, src_p->value.c130);
+        break;
+
+    case ber_c_source_q_choice_c131_e:
+        encoder_prepend_bool(encoder_p, 0x9f8102u, src_p->value.c131);
+        break;
+
+    case ber_c_source_q_choice_c132_e:
+        encoder_prepend_bool(encoder_p, 0x9f8103u, src_p->value.c132);
+        break;
+
+    case ber_c_source_q_choice_c133_e:
+        encoder_prepend_bool(encoder_p, 0x9f8104u, src_p->value.c133);
+        break;
+
+    case ber_c_source_q_choice_c134_e:
+        encoder_prepend_bool(encoder_p, 0x9f8105u, src_p->value.c134);
+        break;
+
+    case ber_c_source_q_choice_c135_e:
+        encoder_prepend_bool(encoder_p, 0x9f8106u, src_p->value.c135);
+        break;
+
+    case ber_c_source_q_choice_c136_e:
+        encoder_prepend_bool(encoder_p, 0x9f8107u, src_p->value.c136);
+        break;
+
+    case ber_c_source_q_choice_c137_e:
+        encoder_prepend_bool(encoder_p, 0x9f8108u, src_p->value.c137);
+        break;
+
+    case ber_c_source_q_choice_c138_e:
+        encoder_prepend_bool(encoder_p, 0x9f8109u, src_p->value.c138);
+        break;
+
+    case ber_c_source_q_choice_c139_e:
+        encoder_prepend_bool(encoder_p, 0x9f810au, src_p->value.c139);
+        break;
+
+    case ber_c_source_q_choice_c140_e:
+        encoder_prepend_bool(encoder_p, 0x9f810bu, src_p->value.c140);
+        break;
+
+    case ber_c_source_q_choice_c141_e:
+        encoder_prepend_bool(encoder_p, 0x9f810cu, src_p->value.c141);
+        break;
+
+    case ber_c_source_q_choice_c142_e:
+        encoder_prepend_bool(encoder_p, 0x9f810du, src_p->value.c142);
+        break;
+
+    case ber_c_source_q_choice_c143_e:
+        encoder_prepend_bool(encoder_p, 0x9f810eu, src_p->value.c143);
+        break;
+
+    case ber_c_source_q_choice_c144_e:
+        encoder_prepend_bool(encoder_p, 0x9f810fu, src_p->value.c144);
+        break;
+
+    case ber_c_source_q_choice_c145_e:
+        encoder_prepend_bool(encoder_p, 0x9f8110u, src_p->value.c145);
+        break;
+
+    case ber_c_source_q_choice_c146_e:
+        encoder_prepend_bool(encoder_p, 0x9f8111u, src_p->value.c146);
+        break;
+
+    case ber_c_source_q_choice_c147_e:
+        encoder_prepend_bool(encoder_p, 0x9f8112u, src_p->value.c147);
+        break;
+
+    case ber_c_source_q_choice_c148_e:
+        encoder_prepend_bool(encoder_p, 0x9f8113u, src_p->value.c148);
+        break;
+
+    case ber_c_source_q_choice_c149_e:
+        encoder_prepend_bool(encoder_p, 0x9f8114u, src_p->value.c149);
+        break;
+
+    case ber_c_source_q_choice_c150_e:
+        encoder_prepend_bool(encoder_p, 0x9f8115u, src_p->value.c150);
+        break;
+
+    case ber_c_source_q_choice_c151_e:
+        encoder_prepend_bool(encoder_p, 0x9f8116u, src_p->value.c151);
+        break;
+
+    case ber_c_source_q_choice_c152_e:
+        encoder_prepend_bool(encoder_p, 0x9f8117u, src_p->value.c152);
+        break;
+
+    case ber_c_source_q_choice_c153_e:
+        encoder_prepend_bool(encoder_p, 0x9f8118u, src_p->value.c153);
+        break;
+
+    case ber_c_source_q_choice_c154_e:
+        encoder_prepend_bool(encoder_p, 0x9f8119u, src_p->value.c154);
+        break;
+
+    case ber_c_source_q_choice_c155_e:
+        encoder_prepend_bool(encoder_p, 0x9f811au, src_p->value.c155);
+        break;
+
+    case ber_c_source_q_choice_c156_e:
+        encoder_prepend_bool(encoder_p, 0x9f811bu, src_p->value.c156);
+        break;
+
+    case ber_c_source_q_choice_c157_e:
+        encoder_prepend_bool(encoder_p, 0x9f811cu, src_p->value.c157);
+        break;
+
+    case ber_c_source_q_choice_c158_e:
+        encoder_prepend_bool(encoder_p, 0x9f811du, src_p->value.c158);
+        break;
+
+    case ber_c_source_q_choice_c159_e:
+        encoder_prepend_bool(encoder_p, 0x9f811eu, src_p->value.c159);
+        break;
+
+    case ber_c_source_q_choice_c160_e:
+        encoder_prepend_bool(encoder_p, 0x9f811fu, src_p->value.c160);
+        break;
+
+    case ber_c_source_q_choice_c161_e:
+        encoder_prepend_bool(encoder_p, 0x9f8120u, src_p->value.c161);
+        break;
+
+    case ber_c_source_q_choice_c162_e:
+        encoder_prepend_bool(encoder_p, 0x9f8121u, src_p->value.c162);
+        break;
+
+    case ber_c_source_q_choice_c163_e:
+        encoder_prepend_bool(encoder_p, 0x9f8122u, src_p->value.c163);
+        break;
+
+    case ber_c_source_q_choice_c164_e:
+        encoder_prepend_bool(encoder_p, 0x9f8123u, src_p->value.c164);
+        break;
+
+    case ber_c_source_q_choice_c165_e:
+        encoder_prepend_bool(encoder_p, 0x9f8124u, src_p->value.c165);
+        break;
+
+    case ber_c_source_q_choice_c166_e:
+        encoder_prepend_bool(encoder_p, 0x9f8125u, src_p->value.c166);
+        break;
+
+    case ber_c_source_q_choice_c167_e:
+        encoder_prepend_bool(encoder_p, 0x9f8126u, src_p->value.c167);
+        break;
+
+    case ber_c_source_q_choice_c168_e:
+        encoder_prepend_bool(encoder_p, 0x9f8127u, src_p->value.c168);
+        break;
+
+    case ber_c_source_q_choice_c169_e:
+        encoder_prepend_bool(encoder_p, 0x9f8128u, src_p->value.c169);
+        break;
+
+    case ber_c_source_q_choice_c170_e:
+        encoder_prepend_bool(encoder_p, 0x9f8129u, src_p->value.c170);
+        break;
+
+    case ber_c_source_q_choice_c171_e:
+        encoder_prepend_bool(encoder_p, 0x9f812au, src_p->value.c171);
+        break;
+
+    case ber_c_source_q_choice_c172_e:
+        encoder_prepend_bool(encoder_p, 0x9f812bu, src_p->value.c172);
+        break;
+
+    case ber_c_source_q_choice_c173_e:
+        encoder_prepend_bool(encoder_p, 0x9f812cu, src_p->value.c173);
+        break;
+
+    case ber_c_source_q_choice_c174_e:
+        encoder_prepend_bool(encoder_p, 0x9f812du, src_p->value.c174);
+        break;
+
+    case ber_c_source_q_choice_c175_e:
+        encoder_prepend_bool(encoder_p, 0x9f812eu, src_p->value.c175);
+        break;
+
+    case ber_c_source_q_choice_c176_e:
+        encoder_prepend_bool(encoder_p, 0x9f812fu, src_p->value.c176);
+        break;
+
+    case ber_c_source_q_choice_c177_e:
+        encoder_prepend_bool(encoder_p, 0x9f8130u, src_p->value.c177);
+        break;
+
+    case ber_c_source_q_choice_c178_e:
+        encoder_prepend_bool(encoder_p, 0x9f8131u, src_p->value.c178);
+        break;
+
+    case ber_c_source_q_choice_c179_e:
+        encoder_prepend_bool(encoder_p, 0x9f8132u, src_p->value.c179);
+        break;
+
+    case ber_c_source_q_choice_c180_e:
+        encoder_prepend_bool(encoder_p, 0x9f8133u, src_p->value.c180);
+        break;
+
+    case ber_c_source_q_choice_c181_e:
+        encoder_prepend_bool(encoder_p, 0x9f8134u, src_p->value.c181);
+        break;
+
+    case ber_c_source_q_choice_c182_e:
+        encoder_prepend_bool(encoder_p, 0x9f8135u, src_p->value.c182);
+        break;
+
+    case ber_c_source_q_choice_c183_e:
+        encoder_prepend_bool(encoder_p, 0x9f8136u, src_p->value.c183);
+        break;
+
+    case ber_c_source_q_choice_c184_e:
+        encoder_prepend_bool(encoder_p, 0x9f8137u, src_p->value.c184);
+        break;
+
+    case ber_c_source_q_choice_c185_e:
+        encoder_prepend_bool(encoder_p, 0x9f8138u, src_p->value.c185);
+        break;
+
+    case ber_c_source_q_choice_c186_e:
+        encoder_prepend_bool(encoder_p, 0x9f8139u, src_p->value.c186);
+        break;
+
+    case ber_c_source_q_choice_c187_e:
+        encoder_prepend_bool(encoder_p, 0x9f813au, src_p->value.c187);
+        break;
+
+    case ber_c_source_q_choice_c188_e:
+        encoder_prepend_bool(encoder_p, 0x9f813bu, src_p->value.c188);
+        break;
+
+    case ber_c_source_q_choice_c189_e:
+        encoder_prepend_bool(encoder_p, 0x9f813cu, src_p->value.c189);
+        break;
+
+    case ber_c_source_q_choice_c190_e:
+        encoder_prepend_bool(encoder_p, 0x9f813du, src_p->value.c190);
+        break;
+
+    case ber_c_source_q_choice_c191_e:
+        encoder_prepend_bool(encoder_p, 0x9f813eu, src_p->value.c191);
+        break;
+
+    case ber_c_source_q_choice_c192_e:
+        encoder_prepend_bool(encoder_p, 0x9f813fu, src_p->value.c192);
+        break;
+
+    case ber_c_source_q_choice_c193_e:
+        encoder_prepend_bool(encoder_p, 0x9f8140u, src_p->value.c193);
+        break;
+
+    case ber_c_source_q_choice_c194_e:
+        encoder_prepend_bool(encoder_p, 0x9f8141u, src_p->value.c194);
+        break;
+
+    case ber_c_source_q_choice_c195_e:
+        encoder_prepend_bool(encoder_p, 0x9f8142u, src_p->value.c195);
+        break;
+
+    case ber_c_source_q_choice_c196_e:
+        encoder_prepend_bool(encoder_p, 0x9f8143u, src_p->value.c196);
+        break;
+
+    case ber_c_source_q_choice_c197_e:
+        encoder_prepend_bool(encoder_p, 0x9f8144u, src_p->value.c197);
+        break;
+
+    case ber_c_source_q_choice_c198_e:
+        encoder_prepend_bool(encoder_p, 0x9f8145u, src_p->value.c198);
+        break;
+
+    case ber_c_source_q_choice_c199_e:
+        encoder_prepend_bool(encoder_p, 0x9f8146u, src_p->value.c199);
+        break;
+
+    case ber_c_source_q_choice_c200_e:
+        encoder_prepend_bool(encoder_p, 0x9f8147u, src_p->value.c200);
+        break;
+
+    case ber_c_source_q_choice_c201_e:
+        encoder_prepend_bool(encoder_p, 0x9f8148u, src_p->value.c201);
+        break;
+
+    case ber_c_source_q_choice_c202_e:
+        encoder_prepend_bool(encoder_p, 0x9f8149u, src_p->value.c202);
+        break;
+
+    case ber_c_source_q_choice_c203_e:
+        encoder_prepend_bool(encoder_p, 0x9f814au, src_p->value.c203);
+        break;
+
+    case ber_c_source_q_choice_c204_e:
+        encoder_prepend_bool(encoder_p, 0x9f814bu, src_p->value.c204);
+        break;
+
+    case ber_c_source_q_choice_c205_e:
+        encoder_prepend_bool(encoder_p, 0x9f814cu, src_p->value.c205);
+        break;
+
+    case ber_c_source_q_choice_c206_e:
+        encoder_prepend_bool(encoder_p, 0x9f814du, src_p->value.c206);
+        break;
+
+    case ber_c_source_q_choice_c207_e:
+        encoder_prepend_bool(encoder_p, 0x9f814eu, src_p->value.c207);
+        break;
+
+    case ber_c_source_q_choice_c208_e:
+        encoder_prepend_bool(encoder_p, 0x9f814fu, src_p->value.c208);
+        break;
+
+    case ber_c_source_q_choice_c209_e:
+        encoder_prepend_bool(encoder_p, 0x9f8150u, src_p->value.c209);
+        break;
+
+    case ber_c_source_q_choice_c210_e:
+        encoder_prepend_bool(encoder_p, 0x9f8151u, src_p->value.c210);
+        break;
+
+    case ber_c_source_q_choice_c211_e:
+        encoder_prepend_bool(encoder_p, 0x9f8152u, src_p->value.c211);
+        break;
+
+    case ber_c_source_q_choice_c212_e:
+        encoder_prepend_bool(encoder_p, 0x9f8153u, src_p->value.c212);
+        break;
+
+    case ber_c_source_q_choice_c213_e:
+        encoder_prepend_bool(encoder_p, 0x9f8154u, src_p->value.c213);
+        break;
+
+    case ber_c_source_q_choice_c214_e:
+        encoder_prepend_bool(encoder_p, 0x9f8155u, src_p->value.c214);
+        break;
+
+    case ber_c_source_q_choice_c215_e:
+        encoder_prepend_bool(encoder_p, 0x9f8156u, src_p->value.c215);
+        break;
+
+    case ber_c_source_q_choice_c216_e:
+        encoder_prepend_bool(encoder_p, 0x9f8157u, src_p->value.c216);
+        break;
+
+    case ber_c_source_q_choice_c217_e:
+        encoder_prepend_bool(encoder_p, 0x9f8158u, src_p->value.c217);
+        break;
+
+    case ber_c_source_q_choice_c218_e:
+        encoder_prepend_bool(encoder_p, 0x9f8159u, src_p->value.c218);
+        break;
+
+    case ber_c_source_q_choice_c219_e:
+        encoder_prepend_bool(encoder_p, 0x9f815au, src_p->value.c219);
+        break;
+
+    case ber_c_source_q_choice_c220_e:
+        encoder_prepend_bool(encoder_p, 0x9f815bu, src_p->value.c220);
+        break;
+
+    case ber_c_source_q_choice_c221_e:
+        encoder_prepend_bool(encoder_p, 0x9f815cu, src_p->value.c221);
+        break;
+
+    case ber_c_source_q_choice_c222_e:
+        encoder_prepend_bool(encoder_p, 0x9f815du, src_p->value.c222);
+        break;
+
+    case ber_c_source_q_choice_c223_e:
+        encoder_prepend_bool(encoder_p, 0x9f815eu, src_p->value.c223);
+        break;
+
+    case ber_c_source_q_choice_c224_e:
+        encoder_prepend_bool(encoder_p, 0x9f815fu, src_p->value.c224);
+        break;
+
+    case ber_c_source_q_choice_c225_e:
+        encoder_prepend_bool(encoder_p, 0x9f8160u, src_p->value.c225);
+        break;
+
+    case ber_c_source_q_choice_c226_e:
+        encoder_prepend_bool(encoder_p, 0x9f8161u, src_p->value.c226);
+        break;
+
+    case ber_c_source_q_choice_c227_e:
+        encoder_prepend_bool(encoder_p, 0x9f8162u, src_p->value.c227);
+        break;
+
+    case ber_c_source_q_choice_c228_e:
+        encoder_prepend_bool(encoder_p, 0x9f8163u, src_p->value.c228);
+        break;
+
+    case ber_c_source_q_choice_c229_e:
+        encoder_prepend_bool(encoder_p, 0x9f8164u, src_p->value.c229);
+        break;
+
+    case ber_c_source_q_choice_c230_e:
+        encoder_prepend_bool(encoder_p, 0x9f8165u, src_p->value.c230);
+        break;
+
+    case ber_c_source_q_choice_c231_e:
+        encoder_prepend_bool(encoder_p, 0x9f8166u, src_p->value.c231);
+        break;
+
+    case ber_c_source_q_choice_c232_e:
+        encoder_prepend_bool(encoder_p, 0x9f8167u, src_p->value.c232);
+        break;
+
+    case ber_c_source_q_choice_c233_e:
+        encoder_prepend_bool(encoder_p, 0x9f8168u, src_p->value.c233);
+        break;
+
+    case ber_c_source_q_choice_c234_e:
+        encoder_prepend_bool(encoder_p, 0x9f8169u, src_p->value.c234);
+        break;
+
+    case ber_c_source_q_choice_c235_e:
+        encoder_prepend_bool(encoder_p, 0x9f816au, src_p->value.c235);
+        break;
+
+    case ber_c_source_q_choice_c236_e:
+        encoder_prepend_bool(encoder_p, 0x9f816bu, src_p->value.c236);
+        break;
+
+    case ber_c_source_q_choice_c237_e:
+        encoder_prepend_bool(encoder_p, 0x9f816cu, src_p->value.c237);
+        break;
+
+    case ber_c_source_q_choice_c238_e:
+        encoder_prepend_bool(encoder_p, 0x9f816du, src_p->value.c238);
+        break;
+
+    case ber_c_source_q_choice_c239_e:
+        encoder_prepend_bool(encoder_p, 0x9f816eu, src_p->value.c239);
+        break;
+
+    case ber_c_source_q_choice_c240_e:
+        encoder_prepend_bool(encoder_p, 0x9f816fu, src_p->value.c240);
+        break;
+
+    case ber_c_source_q_choice_c241_e:
+        encoder_prepend_bool(encoder_p, 0x9f8170u, src_p->value.c241);
+        break;
+
+    case ber_c_source_q_choice_c242_e:
+        encoder_prepend_bool(encoder_p, 0x9f8171u, src_p->value.c242);
+        break;
+
+    case ber_c_source_q_choice_c243_e:
+        encoder_prepend_bool(encoder_p, 0x9f8172u, src_p->value.c243);
+        break;
+
+    case ber_c_source_q_choice_c244_e:
+        encoder_prepend_bool(encoder_p, 0x9f8173u, src_p->value.c244);
+        break;
+
+    case ber_c_source_q_choice_c245_e:
+        encoder_prepend_bool(encoder_p, 0x9f8174u, src_p->value.c245);
+        break;
+
+    case ber_c_source_q_choice_c246_e:
+        encoder_prepend_bool(encoder_p, 0x9f8175u, src_p->value.c246);
+        break;
+
+    case ber_c_source_q_choice_c247_e:
+        encoder_prepend_bool(encoder_p, 0x9f8176u, src_p->value.c247);
+        break;
+
+    case ber_c_source_q_choice_c248_e:
+        encoder_prepend_bool(encoder_p, 0x9f8177u, src_p->value.c248);
+        break;
+
+    case ber_c_source_q_choice_c249_e:
+        encoder_prepend_bool(encoder_p, 0x9f8178u, src_p->value.c249);
+        break;
+
+    case ber_c_source_q_choice_c250_e:
+        encoder_prepend_bool(encoder_p, 0x9f8179u, src_p->value.c250);
+        break;
+
+    case ber_c_source_q_choice_c251_e:
+        encoder_prepend_bool(encoder_p, 0x9f817au, src_p->value.c251);
+        break;
+
+    case ber_c_source_q_choice_c252_e:
+        encoder_prepend_bool(encoder_p, 0x9f817bu, src_p->value.c252);
+        break;
+
+    case ber_c_source_q_choice_c253_e:
+        encoder_prepend_bool(encoder_p, 0x9f817cu, src_p->value.c253);
+        break;
+
+    case ber_c_source_q_choice_c254_e:
+        encoder_prepend_bool(encoder_p, 0x9f817du, src_p->value.c254);
+        break;
+
+    case ber_c_source_q_choice_c255_e:
+        encoder_prepend_bool(encoder_p, 0x9f817eu, src_p->value.c255);
+        break;
+
+    case ber_c_source_q_choice_c256_e:
+        encoder_prepend_bool(encoder_p, 0x9f817fu, src_p->value.c256);
+        break;
+
+    case ber_c_source_q_choice_c257_e:
+        encoder_prepend_bool(encoder_p, 0x9f8200u, src_p->value.c257);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_q_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_q_t *dst_p)
+{
+    switch (decoder_peek_tag(decoder_p)) {
+
+    case 0x80u:
+        dst_p->choice = ber_c_source_q_choice_c001_e;
+        dst_p->value.c001 = decoder_read_bool(decoder_p, 0x80u);
+        break;
+
+    case 0x81u:
+        dst_p->choice = ber_c_source_q_choice_c002_e;
+        dst_p->value.c002 = decoder_read_bool(decoder_p, 0x81u);
+        break;
+
+    case 0x82u:
+        dst_p->choice = ber_c_source_q_choice_c003_e;
+        dst_p->value.c003 = decoder_read_bool(decoder_p, 0x82u);
+        break;
+
+    case 0x83u:
+        dst_p->choice = ber_c_source_q_choice_c004_e;
+        dst_p->value.c004 = decoder_read_bool(decoder_p, 0x83u);
+        break;
+
+    case 0x84u:
+        dst_p->choice = ber_c_source_q_choice_c005_e;
+        dst_p->value.c005 = decoder_read_bool(decoder_p, 0x84u);
+        break;
+
+    case 0x85u:
+        dst_p->choice = ber_c_source_q_choice_c006_e;
+        dst_p->value.c006 = decoder_read_bool(decoder_p, 0x85u);
+        break;
+
+    case 0x86u:
+        dst_p->choice = ber_c_source_q_choice_c007_e;
+        dst_p->value.c007 = decoder_read_bool(decoder_p, 0x86u);
+        break;
+
+    case 0x87u:
+        dst_p->choice = ber_c_source_q_choice_c008_e;
+        dst_p->value.c008 = decoder_read_bool(decoder_p, 0x87u);
+        break;
+
+    case 0x88u:
+        dst_p->choice = ber_c_source_q_choice_c009_e;
+        dst_p->value.c009 = decoder_read_bool(decoder_p, 0x88u);
+        break;
+
+    case 0x89u:
+        dst_p->choice = ber_c_source_q_choice_c010_e;
+        dst_p->value.c010 = decoder_read_bool(decoder_p, 0x89u);
+        break;
+
+    case 0x8au:
+        dst_p->choice = ber_c_source_q_choice_c011_e;
+        dst_p->value.c011 = decoder_read_bool(decoder_p, 0x8au);
+        break;
+
+    case 0x8bu:
+        dst_p->choice = ber_c_source_q_choice_c012_e;
+        dst_p->value.c012 = decoder_read_bool(decoder_p, 0x8bu);
+        break;
+
+    case 0x8cu:
+        dst_p->choice = ber_c_source_q_choice_c013_e;
+        dst_p->value.c013 = decoder_read_bool(decoder_p, 0x8cu);
+        break;
+
+    case 0x8du:
+        dst_p->choice = ber_c_source_q_choice_c014_e;
+        dst_p->value.c014 = decoder_read_bool(decoder_p, 0x8du);
+        break;
+
+    case 0x8eu:
+        dst_p->choice = ber_c_source_q_choice_c015_e;
+        dst_p->value.c015 = decoder_read_bool(decoder_p, 0x8eu);
+        break;
+
+    case 0x8fu:
+        dst_p->choice = ber_c_source_q_choice_c016_e;
+        dst_p->value.c016 = decoder_read_bool(decoder_p, 0x8fu);
+        break;
+
+    case 0x90u:
+        dst_p->choice = ber_c_source_q_choice_c017_e;
+        dst_p->value.c017 = decoder_read_bool(decoder_p, 0x90u);
+        break;
+
+    case 0x91u:
+        dst_p->choice = ber_c_source_q_choice_c018_e;
+        dst_p->value.c018 = decoder_read_bool(decoder_p, 0x91u);
+        break;
+
+    case 0x92u:
+        dst_p->choice = ber_c_source_q_choice_c019_e;
+        dst_p->value.c019 = decoder_read_bool(decoder_p, 0x92u);
+        break;
+
+    case 0x93u:
+        dst_p->choice = ber_c_source_q_choice_c020_e;
+        dst_p->value.c020 = decoder_read_bool(decoder_p, 0x93u);
+        break;
+
+    case 0x94u:
+        dst_p->choice = ber_c_source_q_choice_c021_e;
+        dst_p->value.c021 = decoder_read_bool(decoder_p, 0x94u);
+        break;
+
+    case 0x95u:
+        dst_p->choice = ber_c_source_q_choice_c022_e;
+        dst_p->value.c022 = decoder_read_bool(decoder_p, 0x95u);
+        break;
+
+    case 0x96u:
+        dst_p->choice = ber_c_source_q_choice_c023_e;
+        dst_p->value.c023 = decoder_read_bool(decoder_p, 0x96u);
+        break;
+
+    case 0x97u:
+        dst_p->choice = ber_c_source_q_choice_c024_e;
+        dst_p->value.c024 = decoder_read_bool(decoder_p, 0x97u);
+        break;
+
+    case 0x98u:
+        dst_p->choice = ber_c_source_q_choice_c025_e;
+        dst_p->value.c025 = decoder_read_bool(decoder_p, 0x98u);
+        break;
+
+    case 0x99u:
+        dst_p->choice = ber_c_source_q_choice_c026_e;
+        dst_p->value.c026 = decoder_read_bool(decoder_p, 0x99u);
+        break;
+
+    case 0x9au:
+        dst_p->choice = ber_c_source_q_choice_c027_e;
+        dst_p->value.c027 = decoder_read_bool(decoder_p, 0x9au);
+        break;
+
+    case 0x9bu:
+        dst_p->choice = ber_c_source_q_choice_c028_e;
+        dst_p->value.c028 = decoder_read_bool(decoder_p, 0x9bu);
+        break;
+
+    case 0x9cu:
+        dst_p->choice = ber_c_source_q_choice_c029_e;
+        dst_p->value.c029 = decoder_read_bool(decoder_p, 0x9cu);
+        break;
+
+    case 0x9du:
+        dst_p->choice = ber_c_source_q_choice_c030_e;
+        dst_p->value.c030 = decoder_read_bool(decoder_p, 0x9du);
+        break;
+
+    case 0x9eu:
+        dst_p->choice = ber_c_source_q_choice_c031_e;
+        dst_p->value.c031 = decoder_read_bool(decoder_p, 0x9eu);
+        break;
+
+    case 0x9f1fu:
+        dst_p->choice = ber_c_source_q_choice_c032_e;
+        dst_p->value.c032 = decoder_read_bool(decoder_p, 0x9f1fu);
+        break;
+
+    case 0x9f20u:
+        dst_p->choice = ber_c_source_q_choice_c033_e;
+        dst_p->value.c033 = decoder_read_bool(decoder_p, 0x9f20u);
+        break;
+
+    case 0x9f21u:
+        dst_p->choice = ber_c_source_q_choice_c034_e;
+        dst_p->value.c034 = decoder_read_bool(decoder_p, 0x9f21u);
+        break;
+
+    case 0x9f22u:
+        dst_p->choice = ber_c_source_q_choice_c035_e;
+        dst_p->value.c035 = decoder_read_bool(decoder_p, 0x9f22u);
+        break;
+
+    case 0x9f23u:
+        dst_p->choice = ber_c_source_q_choice_c036_e;
+        dst_p->value.c036 = decoder_read_bool(decoder_p, 0x9f23u);
+        break;
+
+    case 0x9f24u:
+        dst_p->choice = ber_c_source_q_choice_c037_e;
+        dst_p->value.c037 = decoder_read_bool(decoder_p, 0x9f24u);
+        break;
+
+    case 0x9f25u:
+        dst_p->choice = ber_c_source_q_choice_c038_e;
+        dst_p->value.c038 = decoder_read_bool(decoder_p, 0x9f25u);
+        break;
+
+    case 0x9f26u:
+        dst_p->choice = ber_c_source_q_choice_c039_e;
+        dst_p->value.c039 = decoder_read_bool(decoder_p, 0x9f26u);
+        break;
+
+    case 0x9f27u:
+        dst_p->choice = ber_c_source_q_choice_c040_e;
+        dst_p->value.c040 = decoder_read_bool(decoder_p, 0x9f27u);
+        break;
+
+    case 0x9f28u:
+        dst_p->choice = ber_c_source_q_choice_c041_e;
+        dst_p->value.c041 = decoder_read_bool(decoder_p, 0x9f28u);
+        break;
+
+    case 0x9f29u:
+        dst_p->choice = ber_c_source_q_choice_c042_e;
+        dst_p->value.c042 = decoder_read_bool(decoder_p, 0x9f29u);
+        break;
+
+    case 0x9f2au:
+        dst_p->choice = ber_c_source_q_choice_c043_e;
+        dst_p->value.c043 = decoder_read_bool(decoder_p, 0x9f2au);
+        break;
+
+    case 0x9f2bu:
+        dst_p->choice = ber_c_source_q_choice_c044_e;
+        dst_p->value.c044 = decoder_read_bool(decoder_p, 0x9f2bu);
+        break;
+
+    case 0x9f2cu:
+        dst_p->choice = ber_c_source_q_choice_c045_e;
+        dst_p->value.c045 = decoder_read_bool(decoder_p, 0x9f2cu);
+        break;
+
+    case 0x9f2du:
+        dst_p->choice = ber_c_source_q_choice_c046_e;
+        dst_p->value.c046 = decoder_read_bool(decoder_p, 0x9f2du);
+        break;
+
+    case 0x9f2eu:
+        dst_p->choice = ber_c_source_q_choice_c047_e;
+        dst_p->value.c047 = decoder_read_bool(decoder_p, 0x9f2eu);
+        break;
+
+    case 0x9f2fu:
+        dst_p->choice = ber_c_source_q_choice_c048_e;
+        dst_p->value.c048 = decoder_read_bool(decoder_p, 0x9f2fu);
+        break;
+
+    case 0x9f30u:
+        dst_p->choice = ber_c_source_q_choice_c049_e;
+        dst_p->value.c049 = decoder_read_bool(decoder_p, 0x9f30u);
+        break;
+
+    case 0x9f31u:
+        dst_p->choice = ber_c_source_q_choice_c050_e;
+        dst_p->value.c050 = decoder_read_bool(decoder_p, 0x9f31u);
+        break;
+
+    case 0x9f32u:
+        dst_p->choice = ber_c_source_q_choice_c051_e;
+        dst_p->value.c051 = decoder_read_bool(decoder_p, 0x9f32u);
+        break;
+
+    case 0x9f33u:
+        dst_p->choice = ber_c_source_q_choice_c052_e;
+        dst_p->value.c052 = decoder_read_bool(decoder_p, 0x9f33u);
+        break;
+
+    case 0x9f34u:
+        dst_p->choice = ber_c_source_q_choice_c053_e;
+        dst_p->value.c053 = decoder_read_bool(decoder_p, 0x9f34u);
+        break;
+
+    case 0x9f35u:
+        dst_p->choice = ber_c_source_q_choice_c054_e;
+        dst_p->value.c054 = decoder_read_bool(decoder_p, 0x9f35u);
+        break;
+
+    case 0x9f36u:
+        dst_p->choice = ber_c_source_q_choice_c055_e;
+        dst_p->value.c055 = decoder_read_bool(decoder_p, 0x9f36u);
+        break;
+
+    case 0x9f37u:
+        dst_p->choice = ber_c_source_q_choice_c056_e;
+        dst_p->value.c056 = decoder_read_bool(decoder_p, 0x9f37u);
+        break;
+
+    case 0x9f38u:
+        dst_p->choice = ber_c_source_q_choice_c057_e;
+        dst_p->value.c057 = decoder_read_bool(decoder_p, 0x9f38u);
+        break;
+
+    case 0x9f39u:
+        dst_p->choice = ber_c_source_q_choice_c058_e;
+        dst_p->value.c058 = decoder_read_bool(decoder_p, 0x9f39u);
+        break;
+
+    case 0x9f3au:
+        dst_p->choice = ber_c_source_q_choice_c059_e;
+        dst_p->value.c059 = decoder_read_bool(decoder_p, 0x9f3au);
+        break;
+
+    case 0x9f3bu:
+        dst_p->choice = ber_c_source_q_choice_c060_e;
+        dst_p->value.c060 = decoder_read_bool(decoder_p, 0x9f3bu);
+        break;
+
+    case 0x9f3cu:
+        dst_p->choice = ber_c_source_q_choice_c061_e;
+        dst_p->value.c061 = decoder_read_bool(decoder_p, 0x9f3cu);
+        break;
+
+    case 0x9f3du:
+        dst_p->choice = ber_c_source_q_choice_c062_e;
+        dst_p->value.c062 = decoder_read_bool(decoder_p, 0x9f3du);
+        break;
+
+    case 0x9f3eu:
+        dst_p->choice = ber_c_source_q_choice_c063_e;
+        dst_p->value.c063 = decoder_read_bool(decoder_p, 0x9f3eu);
+        break;
+
+    case 0x9f3fu:
+        dst_p->choice = ber_c_source_q_choice_c064_e;
+        dst_p->value.c064 = decoder_read_bool(decoder_p, 0x9f3fu);
+        break;
+
+    case 0x9f40u:
+        dst_p->choice = ber_c_source_q_choice_c065_e;
+        dst_p->value.c065 = decoder_read_bool(decoder_p, 0x9f40u);
+        break;
+
+    case 0x9f41u:
+        dst_p->choice = ber_c_source_q_choice_c066_e;
+        dst_p->value.c066 = decoder_read_bool(decoder_p, 0x9f41u);
+        break;
+
+    case 0x9f42u:
+        dst_p->choice = ber_c_source_q_choice_c067_e;
+        dst_p->value.c067 = decoder_read_bool(decoder_p, 0x9f42u);
+        break;
+
+    case 0x9f43u:
+        dst_p->choice = ber_c_source_q_choice_c068_e;
+        dst_p->value.c068 = decoder_read_bool(decoder_p, 0x9f43u);
+        break;
+
+    case 0x9f44u:
+        dst_p->choice = ber_c_source_q_choice_c069_e;
+        dst_p->value.c069 = decoder_read_bool(decoder_p, 0x9f44u);
+        break;
+
+    case 0x9f45u:
+        dst_p->choice = ber_c_source_q_choice_c070_e;
+        dst_p->value.c070 = decoder_read_bool(decoder_p, 0x9f45u);
+        break;
+
+    case 0x9f46u:
+        dst_p->choice = ber_c_source_q_choice_c071_e;
+        dst_p->value.c071 = decoder_read_bool(decoder_p, 0x9f46u);
+        break;
+
+    case 0x9f47u:
+        dst_p->choice = ber_c_source_q_choice_c072_e;
+        dst_p->value.c072 = decoder_read_bool(decoder_p, 0x9f47u);
+        break;
+
+    case 0x9f48u:
+        dst_p->choice = ber_c_source_q_choice_c073_e;
+        dst_p->value.c073 = decoder_read_bool(decoder_p, 0x9f48u);
+        break;
+
+    case 0x9f49u:
+        dst_p->choice = ber_c_source_q_choice_c074_e;
+        dst_p->value.c074 = decoder_read_bool(decoder_p, 0x9f49u);
+        break;
+
+    case 0x9f4au:
+        dst_p->choice = ber_c_source_q_choice_c075_e;
+        dst_p->value.c075 = decoder_read_bool(decoder_p, 0x9f4au);
+        break;
+
+    case 0x9f4bu:
+        dst_p->choice = ber_c_source_q_choice_c076_e;
+        dst_p->value.c076 = decoder_read_bool(decoder_p, 0x9f4bu);
+        break;
+
+    case 0x9f4cu:
+        dst_p->choice = ber_c_source_q_choice_c077_e;
+        dst_p->value.c077 = decoder_read_bool(decoder_p, 0x9f4cu);
+        break;
+
+    case 0x9f4du:
+        dst_p->choice = ber_c_source_q_choice_c078_e;
+        dst_p->value.c078 = decoder_read_bool(decoder_p, 0x9f4du);
+        break;
+
+    case 0x9f4eu:
+        dst_p->choice = ber_c_source_q_choice_c079_e;
+        dst_p->value.c079 = decoder_read_bool(decoder_p, 0x9f4eu);
+        break;
+
+    case 0x9f4fu:
+        dst_p->choice = ber_c_source_q_choice_c080_e;
+        dst_p->value.c080 = decoder_read_bool(decoder_p, 0x9f4fu);
+        break;
+
+    case 0x9f50u:
+        dst_p->choice = ber_c_source_q_choice_c081_e;
+        dst_p->value.c081 = decoder_read_bool(decoder_p, 0x9f50u);
+        break;
+
+    case 0x9f51u:
+        dst_p->choice = ber_c_source_q_choice_c082_e;
+        dst_p->value.c082 = decoder_read_bool(decoder_p, 0x9f51u);
+        break;
+
+    case 0x9f52u:
+        dst_p->choice = ber_c_source_q_choice_c083_e;
+        dst_p->value.c083 = decoder_read_bool(decoder_p, 0x9f52u);
+        break;
+
+    case 0x9f53u:
+        dst_p->choice = ber_c_source_q_choice_c084_e;
+        dst_p->value.c084 = decoder_read_bool(decoder_p, 0x9f53u);
+        break;
+
+    case 0x9f54u:
+        dst_p->choice = ber_c_source_q_choice_c085_e;
+        dst_p->value.c085 = decoder_read_bool(decoder_p, 0x9f54u);
+        break;
+
+    case 0x9f55u:
+        dst_p->choice = ber_c_source_q_choice_c086_e;
+        dst_p->value.c086 = decoder_read_bool(decoder_p, 0x9f55u);
+        break;
+
+    case 0x9f56u:
+        dst_p->choice = ber_c_source_q_choice_c087_e;
+        dst_p->value.c087 = decoder_read_bool(decoder_p, 0x9f56u);
+        break;
+
+    case 0x9f57u:
+        dst_p->choice = ber_c_source_q_choice_c088_e;
+        dst_p->value.c088 = decoder_read_bool(decoder_p, 0x9f57u);
+        break;
+
+    case 0x9f58u:
+        dst_p->choice = ber_c_source_q_choice_c089_e;
+        dst_p->value.c089 = decoder_read_bool(decoder_p, 0x9f58u);
+        break;
+
+    case 0x9f59u:
+        dst_p->choice = ber_c_source_q_choice_c090_e;
+        dst_p->value.c090 = decoder_read_bool(decoder_p, 0x9f59u);
+        break;
+
+    case 0x9f5au:
+        dst_p->choice = ber_c_source_q_choice_c091_e;
+        dst_p->value.c091 = decoder_read_bool(decoder_p, 0x9f5au);
+        break;
+
+    case 0x9f5bu:
+        dst_p->choice = ber_c_source_q_choice_c092_e;
+        dst_p->value.c092 = decoder_read_bool(decoder_p, 0x9f5bu);
+        break;
+
+    case 0x9f5cu:
+        dst_p->choice = ber_c_source_q_choice_c093_e;
+        dst_p->value.c093 = decoder_read_bool(decoder_p, 0x9f5cu);
+        break;
+
+    case 0x9f5du:
+        dst_p->choice = ber_c_source_q_choice_c094_e;
+        dst_p->value.c094 = decoder_read_bool(decoder_p, 0x9f5du);
+        break;
+
+    case 0x9f5eu:
+        dst_p->choice = ber_c_source_q_choice_c095_e;
+        dst_p->value.c095 = decoder_read_bool(decoder_p, 0x9f5eu);
+        break;
+
+    case 0x9f5fu:
+        dst_p->choice = ber_c_source_q_choice_c096_e;
+        dst_p->value.c096 = decoder_read_bool(decoder_p, 0x9f5fu);
+        break;
+
+    case 0x9f60u:
+        dst_p->choice = ber_c_source_q_choice_c097_e;
+        dst_p->value.c097 = decoder_read_bool(decoder_p, 0x9f60u);
+        break;
+
+    case 0x9f61u:
+        dst_p->choice = ber_c_source_q_choice_c098_e;
+        dst_p->value.c098 = decoder_read_bool(decoder_p, 0x9f61u);
+        break;
+
+    case 0x9f62u:
+        dst_p->choice = ber_c_source_q_choice_c099_e;
+        dst_p->value.c099 = decoder_read_bool(decoder_p, 0x9f62u);
+        break;
+
+    case 0x9f63u:
+        dst_p->choice = ber_c_source_q_choice_c100_e;
+        dst_p->value.c100 = decoder_read_bool(decoder_p, 0x9f63u);
+        break;
+
+    case 0x9f64u:
+        dst_p->choice = ber_c_source_q_choice_c101_e;
+        dst_p->value.c101 = decoder_read_bool(decoder_p, 0x9f64u);
+        break;
+
+    case 0x9f65u:
+        dst_p->choice = ber_c_source_q_choice_c102_e;
+        dst_p->value.c102 = decoder_read_bool(decoder_p, 0x9f65u);
+        break;
+
+    case 0x9f66u:
+        dst_p->choice = ber_c_source_q_choice_c103_e;
+        dst_p->value.c103 = decoder_read_bool(decoder_p, 0x9f66u);
+        break;
+
+    case 0x9f67u:
+        dst_p->choice = ber_c_source_q_choice_c104_e;
+        dst_p->value.c104 = decoder_read_bool(decoder_p, 0x9f67u);
+        break;
+
+    case 0x9f68u:
+        dst_p->choice = ber_c_source_q_choice_c105_e;
+        dst_p->value.c105 = decoder_read_bool(decoder_p, 0x9f68u);
+        break;
+
+    case 0x9f69u:
+        dst_p->choice = ber_c_source_q_choice_c106_e;
+        dst_p->value.c106 = decoder_read_bool(decoder_p, 0x9f69u);
+        break;
+
+    case 0x9f6au:
+        dst_p->choice = ber_c_source_q_choice_c107_e;
+        dst_p->value.c107 = decoder_read_bool(decoder_p, 0x9f6au);
+        break;
+
+    case 0x9f6bu:
+        dst_p->choice = ber_c_source_q_choice_c108_e;
+        dst_p->value.c108 = decoder_read_bool(decoder_p, 0x9f6bu);
+        break;
+
+    case 0x9f6cu:
+        dst_p->choice = ber_c_source_q_choice_c109_e;
+        dst_p->value.c109 = decoder_read_bool(decoder_p, 0x9f6cu);
+        break;
+
+    case 0x9f6du:
+        dst_p->choice = ber_c_source_q_choice_c110_e;
+        dst_p->value.c110 = decoder_read_bool(decoder_p, 0x9f6du);
+        break;
+
+    case 0x9f6eu:
+        dst_p->choice = ber_c_source_q_choice_c111_e;
+        dst_p->value.c111 = decoder_read_bool(decoder_p, 0x9f6eu);
+        break;
+
+    case 0x9f6fu:
+        dst_p->choice = ber_c_source_q_choice_c112_e;
+        dst_p->value.c112 = decoder_read_bool(decoder_p, 0x9f6fu);
+        break;
+
+    case 0x9f70u:
+        dst_p->choice = ber_c_source_q_choice_c113_e;
+        dst_p->value.c113 = decoder_read_bool(decoder_p, 0x9f70u);
+        break;
+
+    case 0x9f71u:
+        dst_p->choice = ber_c_source_q_choice_c114_e;
+        dst_p->value.c114 = decoder_read_bool(decoder_p, 0x9f71u);
+        break;
+
+    case 0x9f72u:
+        dst_p->choice = ber_c_source_q_choice_c115_e;
+        dst_p->value.c115 = decoder_read_bool(decoder_p, 0x9f72u);
+        break;
+
+    case 0x9f73u:
+        dst_p->choice = ber_c_source_q_choice_c116_e;
+        dst_p->value.c116 = decoder_read_bool(decoder_p, 0x9f73u);
+        break;
+
+    case 0x9f74u:
+        dst_p->choice = ber_c_source_q_choice_c117_e;
+        dst_p->value.c117 = decoder_read_bool(decoder_p, 0x9f74u);
+        break;
+
+    case 0x9f75u:
+        dst_p->choice = ber_c_source_q_choice_c118_e;
+        dst_p->value.c118 = decoder_read_bool(decoder_p, 0x9f75u);
+        break;
+
+    case 0x9f76u:
+        dst_p->choice = ber_c_source_q_choice_c119_e;
+        dst_p->value.c119 = decoder_read_bool(decoder_p, 0x9f76u);
+        break;
+
+    case 0x9f77u:
+        dst_p->choice = ber_c_source_q_choice_c120_e;
+        dst_p->value.c120 = decoder_read_bool(decoder_p, 0x9f77u);
+        break;
+
+    case 0x9f78u:
+        dst_p->choice = ber_c_source_q_choice_c121_e;
+        dst_p->value.c121 = decoder_read_bool(decoder_p, 0x9f78u);
+        break;
+
+    case 0x9f79u:
+        dst_p->choice = ber_c_source_q_choice_c122_e;
+        dst_p->value.c122 = decoder_read_bool(decoder_p, 0x9f79u);
+        break;
+
+    case 0x9f7au:
+        dst_p->choice = ber_c_source_q_choice_c123_e;
+        dst_p->value.c123 = decoder_read_bool(decoder_p, 0x9f7au);
+        break;
+
+    case 0x9f7bu:
+        dst_p->choice = ber_c_source_q_choice_c124_e;
+        dst_p->value.c124 = decoder_read_bool(decoder_p, 0x9f7bu);
+        break;
+
+    case 0x9f7cu:
+        dst_p->choice = ber_c_source_q_choice_c125_e;
+        dst_p->value.c125 = decoder_read_bool(decoder_p, 0x9f7cu);
+        break;
+
+    case 0x9f7du:
+        dst_p->choice = ber_c_source_q_choice_c126_e;
+        dst_p->value.c126 = decoder_read_bool(decoder_p, 0x9f7du);
+        break;
+
+    case 0x9f7eu:
+        dst_p->choice = ber_c_source_q_choice_c127_e;
+        dst_p->value.c127 = decoder_read_bool(decoder_p, 0x9f7eu);
+        break;
+
+    case 0x9f7fu:
+        dst_p->choice = ber_c_source_q_choice_c128_e;
+        dst_p->value.c128 = decoder_read_bool(decoder_p, 0x9f7fu);
+        break;
+
+    case 0x9f8100u:
+        dst_p->choice = ber_c_source_q_choice_c129_e;
+        dst_p->value.c129 = decoder_read_bool(decoder_p, 0x9f8100u);
+        break;
+
+    case 0x9f8101u:
+        dst_p->choice = ber_c_source_q_choice_c130_e;
+        dst_p->value.c130 = decoder_read_bool(decoder_p, 0x9f8101u);
+        break;
+
+    case 0x9f8102u:
+        dst_p->choice = ber_c_source_q_choice_c131_e;
+        dst_p->value.c131 = decoder_read_bool(decoder_p, 0x9f8102u);
+        break;
+
+    case 0x9f8103u:
+        dst_p->choice = ber_c_source_q_choice_c132_e;
+        dst_p->value.c132 = decoder_read_bool(decoder_p, 0x9f8103u);
+        break;
+
+    case 0x9f8104u:
+        dst_p->choice = ber_c_source_q_choice_c133_e;
+        dst_p->value.c133 = decoder_read_bool(decoder_p, 0x9f8104u);
+        break;
+
+    case 0x9f8105u:
+        dst_p->choice = ber_c_source_q_choice_c134_e;
+        dst_p->value.c134 = decoder_read_bool(decoder_p, 0x9f8105u);
+        break;
+
+    case 0x9f8106u:
+        dst_p->choice = ber_c_source_q_choice_c135_e;
+        dst_p->value.c135 = decoder_read_bool(decoder_p, 0x9f8106u);
+        break;
+
+    case 0x9f8107u:
+        dst_p->choice = ber_c_source_q_choice_c136_e;
+        dst_p->value.c136 = decoder_read_bool(decoder_p, 0x9f8107u);
+        break;
+
+    case 0x9f8108u:
+        dst_p->choice = ber_c_source_q_choice_c137_e;
+        dst_p->value.c137 = decoder_read_bool(decoder_p, 0x9f8108u);
+        break;
+
+    case 0x9f8109u:
+        dst_p->choice = ber_c_source_q_choice_c138_e;
+        dst_p->value.c138 = decoder_read_bool(decoder_p, 0x9f8109u);
+        break;
+
+    case 0x9f810au:
+        dst_p->choice = ber_c_source_q_choice_c139_e;
+        dst_p->value.c139 = decoder_read_bool(decoder_p, 0x9f810au);
+        break;
+
+    case 0x9f810bu:
+        dst_p->choice = ber_c_source_q_choice_c140_e;
+        dst_p->value.c140 = decoder_read_bool(decoder_p, 0x9f810bu);
+        break;
+
+    case 0x9f810cu:
+        dst_p->choice = ber_c_source_q_choice_c141_e;
+        dst_p->value.c141 = decoder_read_bool(decoder_p, 0x9f810cu);
+        break;
+
+    case 0x9f810du:
+        dst_p->choice = ber_c_source_q_choice_c142_e;
+        dst_p->value.c142 = decoder_read_bool(decoder_p, 0x9f810du);
+        break;
+
+    case 0x9f810eu:
+        dst_p->choice = ber_c_source_q_choice_c143_e;
+        dst_p->value.c143 = decoder_read_bool(decoder_p, 0x9f810eu);
+        break;
+
+    case 0x9f810fu:
+        dst_p->choice = ber_c_source_q_choice_c144_e;
+        dst_p->value.c144 = decoder_read_bool(decoder_p, 0x9f810fu);
+        break;
+
+    case 0x9f8110u:
+        dst_p->choice = ber_c_source_q_choice_c145_e;
+        dst_p->value.c145 = decoder_read_bool(decoder_p, 0x9f8110u);
+        break;
+
+    case 0x9f8111u:
+        dst_p->choice = ber_c_source_q_choice_c146_e;
+        dst_p->value.c146 = decoder_read_bool(decoder_p, 0x9f8111u);
+        break;
+
+    case 0x9f8112u:
+        dst_p->choice = ber_c_source_q_choice_c147_e;
+        dst_p->value.c147 = decoder_read_bool(decoder_p, 0x9f8112u);
+        break;
+
+    case 0x9f8113u:
+        dst_p->choice = ber_c_source_q_choice_c148_e;
+        dst_p->value.c148 = decoder_read_bool(decoder_p, 0x9f8113u);
+        break;
+
+    case 0x9f8114u:
+        dst_p->choice = ber_c_source_q_choice_c149_e;
+        dst_p->value.c149 = decoder_read_bool(decoder_p, 0x9f8114u);
+        break;
+
+    case 0x9f8115u:
+        dst_p->choice = ber_c_source_q_choice_c150_e;
+        dst_p->value.c150 = decoder_read_bool(decoder_p, 0x9f8115u);
+        break;
+
+    case 0x9f8116u:
+        dst_p->choice = ber_c_source_q_choice_c151_e;
+        dst_p->value.c151 = decoder_read_bool(decoder_p, 0x9f8116u);
+        break;
+
+    case 0x9f8117u:
+        dst_p->choice = ber_c_source_q_choice_c152_e;
+        dst_p->value.c152 = decoder_read_bool(decoder_p, 0x9f8117u);
+        break;
+
+    case 0x9f8118u:
+        dst_p->choice = ber_c_source_q_choice_c153_e;
+        dst_p->value.c153 = decoder_read_bool(decoder_p, 0x9f8118u);
+        break;
+
+    case 0x9f8119u:
+        dst_p->choice = ber_c_source_q_choice_c154_e;
+        dst_p->value.c154 = decoder_read_bool(decoder_p, 0x9f8119u);
+        break;
+
+    case 0x9f811au:
+        dst_p->choice = ber_c_source_q_choice_c155_e;
+        dst_p->value.c155 = decoder_read_bool(decoder_p, 0x9f811au);
+        break;
+
+    case 0x9f811bu:
+        dst_p->choice = ber_c_source_q_choice_c156_e;
+        dst_p->value.c156 = decoder_read_bool(decoder_p, 0x9f811bu);
+        break;
+
+    case 0x9f811cu:
+        dst_p->choice = ber_c_source_q_choice_c157_e;
+        dst_p->value.c157 = decoder_read_bool(decoder_p, 0x9f811cu);
+        break;
+
+    case 0x9f811du:
+        dst_p->choice = ber_c_source_q_choice_c158_e;
+        dst_p->value.c158 = decoder_read_bool(decoder_p, 0x9f811du);
+        break;
+
+    case 0x9f811eu:
+        dst_p->choice = ber_c_source_q_choice_c159_e;
+        dst_p->value.c159 = decoder_read_bool(decoder_p, 0x9f811eu);
+        break;
+
+    case 0x9f811fu:
+        dst_p->choice = ber_c_source_q_choice_c160_e;
+        dst_p->value.c160 = decoder_read_bool(decoder_p, 0x9f811fu);
+        break;
+
+    case 0x9f8120u:
+        dst_p->choice = ber_c_source_q_choice_c161_e;
+        dst_p->value.c161 = decoder_read_bool(decoder_p, 0x9f8120u);
+        break;
+
+    case 0x9f8121u:
+        dst_p->choice = ber_c_source_q_choice_c162_e;
+        dst_p->value.c162 = decoder_read_bool(decoder_p, 0x9f8121u);
+        break;
+
+    case 0x9f8122u:
+        dst_p->choice = ber_c_source_q_choice_c163_e;
+        dst_p->value.c163 = decoder_read_bool(decoder_p, 0x9f8122u);
+        break;
+
+    case 0x9f8123u:
+        dst_p->choice = ber_c_source_q_choice_c164_e;
+        dst_p->value.c164 = decoder_read_bool(decoder_p, 0x9f8123u);
+        break;
+
+    case 0x9f8124u:
+        dst_p->choice = ber_c_source_q_choice_c165_e;
+        dst_p->value.c165 = decoder_read_bool(decoder_p, 0x9f8124u);
+        break;
+
+    case 0x9f8125u:
+        dst_p->choice = ber_c_source_q_choice_c166_e;
+        dst_p->value.c166 = decoder_read_bool(decoder_p, 0x9f8125u);
+        break;
+
+    case 0x9f8126u:
+        dst_p->choice = ber_c_source_q_choice_c167_e;
+        dst_p->value.c167 = decoder_read_bool(decoder_p, 0x9f8126u);
+        break;
+
+    case 0x9f8127u:
+        dst_p->choice = ber_c_source_q_choice_c168_e;
+        dst_p->value.c168 = decoder_read_bool(decoder_p, 0x9f8127u);
+        break;
+
+    case 0x9f8128u:
+        dst_p->choice = ber_c_source_q_choice_c169_e;
+        dst_p->value.c169 = decoder_read_bool(decoder_p, 0x9f8128u);
+        break;
+
+    case 0x9f8129u:
+        dst_p->choice = ber_c_source_q_choice_c170_e;
+        dst_p->value.c170 = decoder_read_bool(decoder_p, 0x9f8129u);
+        break;
+
+    case 0x9f812au:
+        dst_p->choice = ber_c_source_q_choice_c171_e;
+        dst_p->value.c171 = decoder_read_bool(decoder_p, 0x9f812au);
+        break;
+
+    case 0x9f812bu:
+        dst_p->choice = ber_c_source_q_choice_c172_e;
+        dst_p->value.c172 = decoder_read_bool(decoder_p, 0x9f812bu);
+        break;
+
+    case 0x9f812cu:
+        dst_p->choice = ber_c_source_q_choice_c173_e;
+        dst_p->value.c173 = decoder_read_bool(decoder_p, 0x9f812cu);
+        break;
+
+    case 0x9f812du:
+        dst_p->choice = ber_c_source_q_choice_c174_e;
+        dst_p->value.c174 = decoder_read_bool(decoder_p, 0x9f812du);
+        break;
+
+    case 0x9f812eu:
+        dst_p->choice = ber_c_source_q_choice_c175_e;
+        dst_p->value.c175 = decoder_read_bool(decoder_p, 0x9f812eu);
+        break;
+
+    case 0x9f812fu:
+        dst_p->choice = ber_c_source_q_choice_c176_e;
+        dst_p->value.c176 = decoder_read_bool(decoder_p, 0x9f812fu);
+        break;
+
+    case 0x9f8130u:
+        dst_p->choice = ber_c_source_q_choice_c177_e;
+        dst_p->value.c177 = decoder_read_bool(decoder_p, 0x9f8130u);
+        break;
+
+    case 0x9f8131u:
+        dst_p->choice = ber_c_source_q_choice_c178_e;
+        dst_p->value.c178 = decoder_read_bool(decoder_p, 0x9f8131u);
+        break;
+
+    case 0x9f8132u:
+        dst_p->choice = ber_c_source_q_choice_c179_e;
+        dst_p->value.c179 = decoder_read_bool(decoder_p, 0x9f8132u);
+        break;
+
+    case 0x9f8133u:
+        dst_p->choice = ber_c_source_q_choice_c180_e;
+        dst_p->value.c180 = decoder_read_bool(decoder_p, 0x9f8133u);
+        break;
+
+    case 0x9f8134u:
+        dst_p->choice = ber_c_source_q_choice_c181_e;
+        dst_p->value.c181 = decoder_read_bool(decoder_p, 0x9f8134u);
+        break;
+
+    case 0x9f8135u:
+        dst_p->choice = ber_c_source_q_choice_c182_e;
+        dst_p->value.c182 = decoder_read_bool(decoder_p, 0x9f8135u);
+        break;
+
+    case 0x9f8136u:
+        dst_p->choice = ber_c_source_q_choice_c183_e;
+        dst_p->value.c183 = decoder_read_bool(decoder_p, 0x9f8136u);
+        break;
+
+    case 0x9f8137u:
+        dst_p->choice = ber_c_source_q_choice_c184_e;
+        dst_p->value.c184 = decoder_read_bool(decoder_p, 0x9f8137u);
+        break;
+
+    case 0x9f8138u:
+        dst_p->choice = ber_c_source_q_choice_c185_e;
+        dst_p->value.c185 = decoder_read_bool(decoder_p, 0x9f8138u);
+        break;
+
+    case 0x9f8139u:
+        dst_p->choice = ber_c_source_q_choice_c186_e;
+        dst_p->value.c186 = decoder_read_bool(decoder_p, 0x9f8139u);
+        break;
+
+    case 0x9f813au:
+        dst_p->choice = ber_c_source_q_choice_c187_e;
+        dst_p->value.c187 = decoder_read_bool(decoder_p, 0x9f813au);
+        break;
+
+    case 0x9f813bu:
+        dst_p->choice = ber_c_source_q_choice_c188_e;
+        dst_p->value.c188 = decoder_read_bool(decoder_p, 0x9f813bu);
+        break;
+
+    case 0x9f813cu:
+        dst_p->choice = ber_c_source_q_choice_c189_e;
+        dst_p->value.c189 = decoder_read_bool(decoder_p, 0x9f813cu);
+        break;
+
+    case 0x9f813du:
+        dst_p->choice = ber_c_source_q_choice_c190_e;
+        dst_p->value.c190 = decoder_read_bool(decoder_p, 0x9f813du);
+        break;
+
+    case 0x9f813eu:
+        dst_p->choice = ber_c_source_q_choice_c191_e;
+        dst_p->value.c191 = decoder_read_bool(decoder_p, 0x9f813eu);
+        break;
+
+    case 0x9f813fu:
+        dst_p->choice = ber_c_source_q_choice_c192_e;
+        dst_p->value.c192 = decoder_read_bool(decoder_p, 0x9f813fu);
+        break;
+
+    case 0x9f8140u:
+        dst_p->choice = ber_c_source_q_choice_c193_e;
+        dst_p->value.c193 = decoder_read_bool(decoder_p, 0x9f8140u);
+        break;
+
+    case 0x9f8141u:
+        dst_p->choice = ber_c_source_q_choice_c194_e;
+        dst_p->value.c194 = decoder_read_bool(decoder_p, 0x9f8141u);
+        break;
+
+    case 0x9f8142u:
+        dst_p->choice = ber_c_source_q_choice_c195_e;
+        dst_p->value.c195 = decoder_read_bool(decoder_p, 0x9f8142u);
+        break;
+
+    case 0x9f8143u:
+        dst_p->choice = ber_c_source_q_choice_c196_e;
+        dst_p->value.c196 = decoder_read_bool(decoder_p, 0x9f8143u);
+        break;
+
+    case 0x9f8144u:
+        dst_p->choice = ber_c_source_q_choice_c197_e;
+        dst_p->value.c197 = decoder_read_bool(decoder_p, 0x9f8144u);
+        break;
+
+    case 0x9f8145u:
+        dst_p->choice = ber_c_source_q_choice_c198_e;
+        dst_p->value.c198 = decoder_read_bool(decoder_p, 0x9f8145u);
+        break;
+
+    case 0x9f8146u:
+        dst_p->choice = ber_c_source_q_choice_c199_e;
+        dst_p->value.c199 = decoder_read_bool(decoder_p, 0x9f8146u);
+        break;
+
+    case 0x9f8147u:
+        dst_p->choice = ber_c_source_q_choice_c200_e;
+        dst_p->value.c200 = decoder_read_bool(decoder_p, 0x9f8147u);
+        break;
+
+    case 0x9f8148u:
+        dst_p->choice = ber_c_source_q_choice_c201_e;
+        dst_p->value.c201 = decoder_read_bool(decoder_p, 0x9f8148u);
+        break;
+
+    case 0x9f8149u:
+        dst_p->choice = ber_c_source_q_choice_c202_e;
+        dst_p->value.c202 = decoder_read_bool(decoder_p, 0x9f8149u);
+        break;
+
+    case 0x9f814au:
+        dst_p->choice = ber_c_source_q_choice_c203_e;
+        dst_p->value.c203 = decoder_read_bool(decoder_p, 0x9f814au);
+        break;
+
+    case 0x9f814bu:
+        dst_p->choice = ber_c_source_q_choice_c204_e;
+        dst_p->value.c204 = decoder_read_bool(decoder_p, 0x9f814bu);
+        break;
+
+    case 0x9f814cu:
+        dst_p->choice = ber_c_source_q_choice_c205_e;
+        dst_p->value.c205 = decoder_read_bool(decoder_p, 0x9f814cu);
+        break;
+
+    case 0x9f814du:
+        dst_p->choice = ber_c_source_q_choice_c206_e;
+        dst_p->value.c206 = decoder_read_bool(decoder_p, 0x9f814du);
+        break;
+
+    case 0x9f814eu:
+        dst_p->choice = ber_c_source_q_choice_c207_e;
+        dst_p->value.c207 = decoder_read_bool(decoder_p, 0x9f814eu);
+        break;
+
+    case 0x9f814fu:
+        dst_p->choice = ber_c_source_q_choice_c208_e;
+        dst_p->value.c208 = decoder_read_bool(decoder_p, 0x9f814fu);
+        break;
+
+    case 0x9f8150u:
+        dst_p->choice = ber_c_source_q_choice_c209_e;
+        dst_p->value.c209 = decoder_read_bool(decoder_p, 0x9f8150u);
+        break;
+
+    case 0x9f8151u:
+        dst_p->choice = ber_c_source_q_choice_c210_e;
+        dst_p->value.c210 = decoder_read_bool(decoder_p, 0x9f8151u);
+        break;
+
+    case 0x9f8152u:
+        dst_p->choice = ber_c_source_q_choice_c211_e;
+        dst_p->value.c211 = decoder_read_bool(decoder_p, 0x9f8152u);
+        break;
+
+    case 0x9f8153u:
+        dst_p->choice = ber_c_source_q_choice_c212_e;
+        dst_p->value.c212 = decoder_read_bool(decoder_p, 0x9f8153u);
+        break;
+
+    case 0x9f8154u:
+        dst_p->choice = ber_c_source_q_choice_c213_e;
+        dst_p->value.c213 = decoder_read_bool(decoder_p, 0x9f8154u);
+        break;
+
+    case 0x9f8155u:
+        dst_p->choice = ber_c_source_q_choice_c214_e;
+        dst_p->value.c214 = decoder_read_bool(decoder_p, 0x9f8155u);
+        break;
+
+    case 0x9f8156u:
+        dst_p->choice = ber_c_source_q_choice_c215_e;
+        dst_p->value.c215 = decoder_read_bool(decoder_p, 0x9f8156u);
+        break;
+
+    case 0x9f8157u:
+        dst_p->choice = ber_c_source_q_choice_c216_e;
+        dst_p->value.c216 = decoder_read_bool(decoder_p, 0x9f8157u);
+        break;
+
+    case 0x9f8158u:
+        dst_p->choice = ber_c_source_q_choice_c217_e;
+        dst_p->value.c217 = decoder_read_bool(decoder_p, 0x9f8158u);
+        break;
+
+    case 0x9f8159u:
+        dst_p->choice = ber_c_source_q_choice_c218_e;
+        dst_p->value.c218 = decoder_read_bool(decoder_p, 0x9f8159u);
+        break;
+
+    case 0x9f815au:
+        dst_p->choice = ber_c_source_q_choice_c219_e;
+        dst_p->value.c219 = decoder_read_bool(decoder_p, 0x9f815au);
+        break;
+
+    case 0x9f815bu:
+        dst_p->choice = ber_c_source_q_choice_c220_e;
+        dst_p->value.c220 = decoder_read_bool(decoder_p, 0x9f815bu);
+        break;
+
+    case 0x9f815cu:
+        dst_p->choice = ber_c_source_q_choice_c221_e;
+        dst_p->value.c221 = decoder_read_bool(decoder_p, 0x9f815cu);
+        break;
+
+    case 0x9f815du:
+        dst_p->choice = ber_c_source_q_choice_c222_e;
+        dst_p->value.c222 = decoder_read_bool(decoder_p, 0x9f815du);
+        break;
+
+    case 0x9f815eu:
+        dst_p->choice = ber_c_source_q_choice_c223_e;
+        dst_p->value.c223 = decoder_read_bool(decoder_p, 0x9f815eu);
+        break;
+
+    case 0x9f815fu:
+        dst_p->choice = ber_c_source_q_choice_c224_e;
+        dst_p->value.c224 = decoder_read_bool(decoder_p, 0x9f815fu);
+        break;
+
+    case 0x9f8160u:
+        dst_p->choice = ber_c_source_q_choice_c225_e;
+        dst_p->value.c225 = decoder_read_bool(decoder_p, 0x9f8160u);
+        break;
+
+    case 0x9f8161u:
+        dst_p->choice = ber_c_source_q_choice_c226_e;
+        dst_p->value.c226 = decoder_read_bool(decoder_p, 0x9f8161u);
+        break;
+
+    case 0x9f8162u:
+        dst_p->choice = ber_c_source_q_choice_c227_e;
+        dst_p->value.c227 = decoder_read_bool(decoder_p, 0x9f8162u);
+        break;
+
+    case 0x9f8163u:
+        dst_p->choice = ber_c_source_q_choice_c228_e;
+        dst_p->value.c228 = decoder_read_bool(decoder_p, 0x9f8163u);
+        break;
+
+    case 0x9f8164u:
+        dst_p->choice = ber_c_source_q_choice_c229_e;
+        dst_p->value.c229 = decoder_read_bool(decoder_p, 0x9f8164u);
+        break;
+
+    case 0x9f8165u:
+        dst_p->choice = ber_c_source_q_choice_c230_e;
+        dst_p->value.c230 = decoder_read_bool(decoder_p, 0x9f8165u);
+        break;
+
+    case 0x9f8166u:
+        dst_p->choice = ber_c_source_q_choice_c231_e;
+        dst_p->value.c231 = decoder_read_bool(decoder_p, 0x9f8166u);
+        break;
+
+    case 0x9f8167u:
+        dst_p->choice = ber_c_source_q_choice_c232_e;
+        dst_p->value.c232 = decoder_read_bool(decoder_p, 0x9f8167u);
+        break;
+
+    case 0x9f8168u:
+        dst_p->choice = ber_c_source_q_choice_c233_e;
+        dst_p->value.c233 = decoder_read_bool(decoder_p, 0x9f8168u);
+        break;
+
+    case 0x9f8169u:
+        dst_p->choice = ber_c_source_q_choice_c234_e;
+        dst_p->value.c234 = decoder_read_bool(decoder_p, 0x9f8169u);
+        break;
+
+    case 0x9f816au:
+        dst_p->choice = ber_c_source_q_choice_c235_e;
+        dst_p->value.c235 = decoder_read_bool(decoder_p, 0x9f816au);
+        break;
+
+    case 0x9f816bu:
+        dst_p->choice = ber_c_source_q_choice_c236_e;
+        dst_p->value.c236 = decoder_read_bool(decoder_p, 0x9f816bu);
+        break;
+
+    case 0x9f816cu:
+        dst_p->choice = ber_c_source_q_choice_c237_e;
+        dst_p->value.c237 = decoder_read_bool(decoder_p, 0x9f816cu);
+        break;
+
+    case 0x9f816du:
+        dst_p->choice = ber_c_source_q_choice_c238_e;
+        dst_p->value.c238 = decoder_read_bool(decoder_p, 0x9f816du);
+        break;
+
+    case 0x9f816eu:
+        dst_p->choice = ber_c_source_q_choice_c239_e;
+        dst_p->value.c239 = decoder_read_bool(decoder_p, 0x9f816eu);
+        break;
+
+    case 0x9f816fu:
+        dst_p->choice = ber_c_source_q_choice_c240_e;
+        dst_p->value.c240 = decoder_read_bool(decoder_p, 0x9f816fu);
+        break;
+
+    case 0x9f8170u:
+        dst_p->choice = ber_c_source_q_choice_c241_e;
+        dst_p->value.c241 = decoder_read_bool(decoder_p, 0x9f8170u);
+        break;
+
+    case 0x9f8171u:
+        dst_p->choice = ber_c_source_q_choice_c242_e;
+        dst_p->value.c242 = decoder_read_bool(decoder_p, 0x9f8171u);
+        break;
+
+    case 0x9f8172u:
+        dst_p->choice = ber_c_source_q_choice_c243_e;
+        dst_p->value.c243 = decoder_read_bool(decoder_p, 0x9f8172u);
+        break;
+
+    case 0x9f8173u:
+        dst_p->choice = ber_c_source_q_choice_c244_e;
+        dst_p->value.c244 = decoder_read_bool(decoder_p, 0x9f8173u);
+        break;
+
+    case 0x9f8174u:
+        dst_p->choice = ber_c_source_q_choice_c245_e;
+        dst_p->value.c245 = decoder_read_bool(decoder_p, 0x9f8174u);
+        break;
+
+    case 0x9f8175u:
+        dst_p->choice = ber_c_source_q_choice_c246_e;
+        dst_p->value.c246 = decoder_read_bool(decoder_p, 0x9f8175u);
+        break;
+
+    case 0x9f8176u:
+        dst_p->choice = ber_c_source_q_choice_c247_e;
+        dst_p->value.c247 = decoder_read_bool(decoder_p, 0x9f8176u);
+        break;
+
+    case 0x9f8177u:
+        dst_p->choice = ber_c_source_q_choice_c248_e;
+        dst_p->value.c248 = decoder_read_bool(decoder_p, 0x9f8177u);
+        break;
+
+    case 0x9f8178u:
+        dst_p->choice = ber_c_source_q_choice_c249_e;
+        dst_p->value.c249 = decoder_read_bool(decoder_p, 0x9f8178u);
+        break;
+
+    case 0x9f8179u:
+        dst_p->choice = ber_c_source_q_choice_c250_e;
+        dst_p->value.c250 = decoder_read_bool(decoder_p, 0x9f8179u);
+        break;
+
+    case 0x9f817au:
+        dst_p->choice = ber_c_source_q_choice_c251_e;
+        dst_p->value.c251 = decoder_read_bool(decoder_p, 0x9f817au);
+        break;
+
+    case 0x9f817bu:
+        dst_p->choice = ber_c_source_q_choice_c252_e;
+        dst_p->value.c252 = decoder_read_bool(decoder_p, 0x9f817bu);
+        break;
+
+    case 0x9f817cu:
+        dst_p->choice = ber_c_source_q_choice_c253_e;
+        dst_p->value.c253 = decoder_read_bool(decoder_p, 0x9f817cu);
+        break;
+
+    case 0x9f817du:
+        dst_p->choice = ber_c_source_q_choice_c254_e;
+        dst_p->value.c254 = decoder_read_bool(decoder_p, 0x9f817du);
+        break;
+
+    case 0x9f817eu:
+        dst_p->choice = ber_c_source_q_choice_c255_e;
+        dst_p->value.c255 = decoder_read_bool(decoder_p, 0x9f817eu);
+        break;
+
+    case 0x9f817fu:
+        dst_p->choice = ber_c_source_q_choice_c256_e;
+        dst_p->value.c256 = decoder_read_bool(decoder_p, 0x9f817fu);
+        break;
+
+    case 0x9f8200u:
+        dst_p->choice = ber_c_source_q_choice_c257_e;
+        dst_p->value.c257 = decoder_read_bool(decoder_p, 0x9f8200u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_q_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_peek_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80u:
+    case 0x81u:
+    case 0x82u:
+    case 0x83u:
+    case 0x84u:
+    case 0x85u:
+    case 0x86u:
+    case 0x87u:
+    case 0x88u:
+    case 0x89u:
+    case 0x8au:
+    case 0x8bu:
+    case 0x8cu:
+    case 0x8du:
+    case 0x8eu:
+    case 0x8fu:
+    case 0x90u:
+    case 0x91u:
+    case 0x92u:
+    case 0x93u:
+    case 0x94u:
+    case 0x95u:
+    case 0x96u:
+    case 0x97u:
+    case 0x98u:
+    case 0x99u:
+    case 0x9au:
+    case 0x9bu:
+    case 0x9cu:
+    case 0x9du:
+    case 0x9eu:
+    case 0x9f1fu:
+    case 0x9f20u:
+    case 0x9f21u:
+    case 0x9f22u:
+    case 0x9f23u:
+    case 0x9f24u:
+    case 0x9f25u:
+    case 0x9f26u:
+    case 0x9f27u:
+    case 0x9f28u:
+    case 0x9f29u:
+    case 0x9f2au:
+    case 0x9f2bu:
+    case 0x9f2cu:
+    case 0x9f2du:
+    case 0x9f2eu:
+    case 0x9f2fu:
+    case 0x9f30u:
+    case 0x9f31u:
+    case 0x9f32u:
+    case 0x9f33u:
+    case 0x9f34u:
+    case 0x9f35u:
+    case 0x9f36u:
+    case 0x9f37u:
+    case 0x9f38u:
+    case 0x9f39u:
+    case 0x9f3au:
+    case 0x9f3bu:
+    case 0x9f3cu:
+    case 0x9f3du:
+    case 0x9f3eu:
+    case 0x9f3fu:
+    case 0x9f40u:
+    case 0x9f41u:
+    case 0x9f42u:
+    case 0x9f43u:
+    case 0x9f44u:
+    case 0x9f45u:
+    case 0x9f46u:
+    case 0x9f47u:
+    case 0x9f48u:
+    case 0x9f49u:
+    case 0x9f4au:
+    case 0x9f4bu:
+    case 0x9f4cu:
+    case 0x9f4du:
+    case 0x9f4eu:
+    case 0x9f4fu:
+    case 0x9f50u:
+    case 0x9f51u:
+    case 0x9f52u:
+    case 0x9f53u:
+    case 0x9f54u:
+    case 0x9f55u:
+    case 0x9f56u:
+    case 0x9f57u:
+    case 0x9f58u:
+    case 0x9f59u:
+    case 0x9f5au:
+    case 0x9f5bu:
+    case 0x9f5cu:
+    case 0x9f5du:
+    case 0x9f5eu:
+    case 0x9f5fu:
+    case 0x9f60u:
+    case 0x9f61u:
+    case 0x9f62u:
+    case 0x9f63u:
+    case 0x9f64u:
+    case 0x9f65u:
+    case 0x9f66u:
+    case 0x9f67u:
+    case 0x9f68u:
+    case 0x9f69u:
+    case 0x9f6au:
+    case 0x9f6bu:
+    case 0x9f6cu:
+    case 0x9f6du:
+    case 0x9f6eu:
+    case 0x9f6fu:
+    case 0x9f70u:
+    case 0x9f71u:
+    case 0x9f72u:
+    case 0x9f73u:
+    case 0x9f74u:
+    case 0x9f75u:
+    case 0x9f76u:
+    case 0x9f77u:
+    case 0x9f78u:
+    case 0x9f79u:
+    case 0x9f7au:
+    case 0x9f7bu:
+    case 0x9f7cu:
+    case 0x9f7du:
+    case 0x9f7eu:
+    case 0x9f7fu:
+    case 0x9f8100u:
+    case 0x9f8101u:
+    case 0x9f8102u:
+    case 0x9f8103u:
+    case 0x9f8104u:
+    case 0x9f8105u:
+    case 0x9f8106u:
+    case 0x9f8107u:
+    case 0x9f8108u:
+    case 0x9f8109u:
+    case 0x9f810au:
+    case 0x9f810bu:
+    case 0x9f810cu:
+    case 0x9f810du:
+    case 0x9f810eu:
+    case 0x9f810fu:
+    case 0x9f8110u:
+    case 0x9f8111u:
+    case 0x9f8112u:
+    case 0x9f8113u:
+    case 0x9f8114u:
+    case 0x9f8115u:
+    case 0x9f8116u:
+    case 0x9f8117u:
+    case 0x9f8118u:
+    case 0x9f8119u:
+    case 0x9f811au:
+    case 0x9f811bu:
+    case 0x9f811cu:
+    case 0x9f811du:
+    case 0x9f811eu:
+    case 0x9f811fu:
+    case 0x9f8120u:
+    case 0x9f8121u:
+    case 0x9f8122u:
+    case 0x9f8123u:
+    case 0x9f8124u:
+    case 0x9f8125u:
+    case 0x9f8126u:
+    case 0x9f8127u:
+    case 0x9f8128u:
+    case 0x9f8129u:
+    case 0x9f812au:
+    case 0x9f812bu:
+    case 0x9f812cu:
+    case 0x9f812du:
+    case 0x9f812eu:
+    case 0x9f812fu:
+    case 0x9f8130u:
+    case 0x9f8131u:
+    case 0x9f8132u:
+    case 0x9f8133u:
+    case 0x9f8134u:
+    case 0x9f8135u:
+    case 0x9f8136u:
+    case 0x9f8137u:
+    case 0x9f8138u:
+    case 0x9f8139u:
+    case 0x9f813au:
+    case 0x9f813bu:
+    case 0x9f813cu:
+    case 0x9f813du:
+    case 0x9f813eu:
+    case 0x9f813fu:
+    case 0x9f8140u:
+    case 0x9f8141u:
+    case 0x9f8142u:
+    case 0x9f8143u:
+    case 0x9f8144u:
+    case 0x9f8145u:
+    case 0x9f8146u:
+    case 0x9f8147u:
+    case 0x9f8148u:
+    case 0x9f8149u:
+    case 0x9f814au:
+    case 0x9f814bu:
+    case 0x9f814cu:
+    case 0x9f814du:
+    case 0x9f814eu:
+    case 0x9f814fu:
+    case 0x9f8150u:
+    case 0x9f8151u:
+    case 0x9f8152u:
+    case 0x9f8153u:
+    case 0x9f8154u:
+    case 0x9f8155u:
+    case 0x9f8156u:
+    case 0x9f8157u:
+    case 0x9f8158u:
+    case 0x9f8159u:
+    case 0x9f815au:
+    case 0x9f815bu:
+    case 0x9f815cu:
+    case 0x9f815du:
+    case 0x9f815eu:
+    case 0x9f815fu:
+    case 0x9f8160u:
+    case 0x9f8161u:
+    case 0x9f8162u:
+    case 0x9f8163u:
+    case 0x9f8164u:
+    case 0x9f8165u:
+    case 0x9f8166u:
+    case 0x9f8167u:
+    case 0x9f8168u:
+    case 0x9f8169u:
+    case 0x9f816au:
+    case 0x9f816bu:
+    case 0x9f816cu:
+    case 0x9f816du:
+    case 0x9f816eu:
+    case 0x9f816fu:
+    case 0x9f8170u:
+    case 0x9f8171u:
+    case 0x9f8172u:
+    case 0x9f8173u:
+    case 0x9f8174u:
+    case 0x9f8175u:
+    case 0x9f8176u:
+    case 0x9f8177u:
+    case 0x9f8178u:
+    case 0x9f8179u:
+    case 0x9f817au:
+    case 0x9f817bu:
+    case 0x9f817cu:
+    case 0x9f817du:
+    case 0x9f817eu:
+    case 0x9f817fu:
+    case 0x9f8200u:
+        decoder_skip(decoder_p, tag);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_d_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_d_t *src_p)
+{
+    uint8_t i;
+    ssize_t start;
+    uint8_t i_2;
+    ssize_t start_2;
+    ssize_t start_3;
+    ssize_t start_4;
+    ssize_t start_5;
+    ssize_t start_6;
+    ssize_t start_7;
+
+    i = src_p->length;
+
+    while (i > 0u) {
+        i--;
+        start_7 = encoder_p->pos;
+        start_6 = encoder_p->pos;
+
+        if (src_p->elements[i].m.s != false) {
+            encoder_prepend_bool(encoder_p, 0x83u, src_p->elements[i].m.s);
+        }
+
+        if (src_p->elements[i].m.is_p_present) {
+            start_5 = encoder_p->pos;
+
+            if (src_p->elements[i].m.p.is_r_present) {
+                encoder_prepend_bool(encoder_p, 0x81u, src_p->elements[i].m.p.r);
+            }
+
+            encoder_prepend_octet_string(encoder_p,
+                                         0x80u,
+                                         &src_p->elements[i].m.p.q.buf[0],
+                                         5u);
+            encoder_prepend_tag_length(encoder_p, 0xa2u, start_5);
+        }
+
+        if (src_p->elements[i].m.o != 3) {
+            encoder_prepend_integer(encoder_p, 0x81u, src_p->elements[i].m.o);
+        }
+
+        if (src_p->elements[i].m.is_n_present) {
+            encoder_prepend_bool(encoder_p, 0x80u, src_p->elements[i].m.n);
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa2u, start_6);
+        start_4 = encoder_p->pos;
+        encoder_prepend_octet_string(encoder_p,
+                                     0x81u,
+                                     &src_p->elements[i].g.l.buf[0],
+                                     src_p->elements[i].g.l.length);
+
+        if (src_p->elements[i].g.h != ber_c_source_d_g_h_j_e) {
+            encoder_prepend_integer(encoder_p, 0x80u, (int64_t)src_p->elements[i].g.h);
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa1u, start_4);
+        start_3 = encoder_p->pos;
+        encoder_prepend_null(encoder_p, 0x82u);
+        start_2 = encoder_p->pos;
+        i_2 = src_p->elements[i].a.e.length;
+
+        while (i_2 > 0u) {
+            i_2--;
+            encoder_prepend_null(encoder_p, 0x05u);
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa1u, start_2);
+        start = encoder_p->pos;
+
+        switch (src_p->elements[i].a.b.choice) {
+
+        case ber_c_source_d_a_b_choice_c_e:
+            encoder_prepend_unsigned_integer(encoder_p, 0x80u, src_p->elements[i].a.b.value.c);
+            break;
+
+        case ber_c_source_d_a_b_choice_d_e:
+            encoder_prepend_bool(encoder_p, 0x81u, src_p->elements[i].a.b.value.d);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+        encoder_prepend_tag_length(encoder_p, 0xa0u, start_3);
+        encoder_prepend_tag_length(encoder_p, 0x30u, start_7);
+    }
+}
+
+static void ber_c_source_d_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_d_t *dst_p)
+{
+    uint8_t i;
+    uint32_t length;
+    ssize_t outer_size;
+    uint8_t i_2;
+    uint32_t length_2;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+    int64_t enum_value;
+    uint32_t length_3;
+    ssize_t outer_size_4;
+    uint32_t length_4;
+    ssize_t outer_size_5;
+    ssize_t outer_size_6;
+    ssize_t outer_size_7;
+
+    length = decoder_count_elements(decoder_p);
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = (uint8_t)length;
+
+    for (i = 0; i < length; i++) {
+        outer_size_7 = decoder_enter(decoder_p, 0x30u);
+        outer_size_3 = decoder_enter(decoder_p, 0xa0u);
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+
+        switch (decoder_peek_tag(decoder_p)) {
+
+        case 0x80u:
+            dst_p->elements[i].a.b.choice = ber_c_source_d_a_b_choice_c_e;
+            dst_p->elements[i].a.b.value.c = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x80u);
+            break;
+
+        case 0x81u:
+            dst_p->elements[i].a.b.choice = ber_c_source_d_a_b_choice_d_e;
+            dst_p->elements[i].a.b.value.d = decoder_read_bool(decoder_p, 0x81u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_leave(decoder_p, outer_size);
+        outer_size_2 = decoder_enter(decoder_p, 0xa1u);
+        length_2 = decoder_count_elements(decoder_p);
+
+        if (length_2 > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->elements[i].a.e.length = (uint8_t)length_2;
+
+        for (i_2 = 0; i_2 < length_2; i_2++) {
+            decoder_read_null(decoder_p, 0x05u);
+        }
+
+        decoder_leave(decoder_p, outer_size_2);
+        decoder_read_null(decoder_p, 0x82u);
+        decoder_leave(decoder_p, outer_size_3);
+        outer_size_4 = decoder_enter(decoder_p, 0xa1u);
+
+        if (decoder_peek_tag(decoder_p) == 0x80u) {
+            enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+            switch (enum_value) {
+
+            case 0:
+            case 4:
+            case 512:
+                dst_p->elements[i].g.h = (enum ber_c_source_d_g_h_e)enum_value;
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADENUM);
+                break;
+            }
+        } else {
+            dst_p->elements[i].g.h = ber_c_source_d_g_h_j_e;
+        }
+
+        length_3 = decoder_read_tag_length(decoder_p, 0x81u);
+
+        if (length_3 > 2u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->elements[i].g.l.length = (uint8_t)length_3;
+        decoder_read_bytes(decoder_p,
+                           &dst_p->elements[i].g.l.buf[0],
+                           length_3);
+        decoder_leave(decoder_p, outer_size_4);
+        outer_size_6 = decoder_enter(decoder_p, 0xa2u);
+
+        dst_p->elements[i].m.is_n_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+        if (dst_p->elements[i].m.is_n_present) {
+            dst_p->elements[i].m.n = decoder_read_bool(decoder_p, 0x80u);
+        }
+
+        if (decoder_peek_tag(decoder_p) == 0x81u) {
+            dst_p->elements[i].m.o = (int8_t)decoder_read_integer(decoder_p, 0x81u);
+        } else {
+            dst_p->elements[i].m.o = 3;
+        }
+
+        dst_p->elements[i].m.is_p_present = (decoder_peek_tag(decoder_p) == 0xa2u);
+
+        if (dst_p->elements[i].m.is_p_present) {
+            outer_size_5 = decoder_enter(decoder_p, 0xa2u);
+            length_4 = decoder_read_tag_length(decoder_p, 0x80u);
+
+            if (length_4 != 5u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->elements[i].m.p.q.buf[0],
+                               length_4);
+
+            dst_p->elements[i].m.p.is_r_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+            if (dst_p->elements[i].m.p.is_r_present) {
+                dst_p->elements[i].m.p.r = decoder_read_bool(decoder_p, 0x81u);
+            }
+
+            decoder_leave(decoder_p, outer_size_5);
+        }
+
+        if (decoder_peek_tag(decoder_p) == 0x83u) {
+            dst_p->elements[i].m.s = decoder_read_bool(decoder_p, 0x83u);
+        } else {
+            dst_p->elements[i].m.s = false;
+        }
+
+        decoder_leave(decoder_p, outer_size_6);
+        decoder_leave(decoder_p, outer_size_7);
+    }
+}
+
+static void ber_c_source_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_d_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_d_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_d_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_d_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_ac_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ac_t *src_p)
+{
+    ssize_t start;
+    ssize_t start_2;
+    ssize_t start_3;
+
+    start_3 = encoder_p->pos;
+    start_2 = encoder_p->pos;
+    ber_c_source_d_encode_content(encoder_p, &src_p->b);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start_2);
+    encoder_prepend_tag_length(encoder_p, 0xa1u, start_3);
+    start = encoder_p->pos;
+    ber_c_source_q_encode_inner(encoder_p, &src_p->a);
+    encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+}
+
+static void ber_c_source_ac_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ac_t *dst_p)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+
+    outer_size = decoder_enter(decoder_p, 0xa0u);
+    ber_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    decoder_leave(decoder_p, outer_size);
+    outer_size_3 = decoder_enter(decoder_p, 0xa1u);
+    outer_size_2 = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_d_decode_content(decoder_p, &dst_p->b);
+    decoder_leave(decoder_p, outer_size_2);
+    decoder_leave(decoder_p, outer_size_3);
+}
+
+static void ber_c_source_ac_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ac_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ac_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ac_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ac_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ac_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ac_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ac_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+    ssize_t outer_size_4;
+
+    outer_size_4 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AC_FIELD_A) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+        ber_c_source_q_decode_inner(decoder_p, &dst_p->a);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa0u);
+    }
+    if ((fields & BER_C_SOURCE_AC_FIELD_B) != 0u) {
+        outer_size_3 = decoder_enter(decoder_p, 0xa1u);
+        outer_size_2 = decoder_enter(decoder_p, 0x30u);
+        ber_c_source_d_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size_2);
+        decoder_leave(decoder_p, outer_size_3);
+    } else {
+        decoder_skip(decoder_p, 0xa1u);
+    }
+    decoder_leave(decoder_p, outer_size_4);
+}
+
+static void ber_c_source_ac_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_ad_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ad_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x0au, (int64_t)src_p->value);
+}
+
+static void ber_c_source_ad_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ad_t *dst_p)
+{
+    int64_t enum_value;
+
+    enum_value = decoder_read_integer(decoder_p, 0x0au);
+
+    switch (enum_value) {
+
+    case 0:
+    case 1:
+        dst_p->value = (enum ber_c_source_ad_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+}
+
+static void ber_c_source_ad_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x0au);
+}
+
+static void ber_c_source_ae_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ae_t *src_p)
+{
+    encoder_prepend_bool(encoder_p, 0x82u, src_p->c);
+
+    if (src_p->b != true) {
+        encoder_prepend_bool(encoder_p, 0x81u, src_p->b);
+    }
+
+    if (src_p->is_a_present) {
+        encoder_prepend_bool(encoder_p, 0x80u, src_p->a);
+    }
+}
+
+static void ber_c_source_ae_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ae_t *dst_p)
+{
+    dst_p->is_a_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+    }
+
+    if (decoder_peek_tag(decoder_p) == 0x81u) {
+        dst_p->b = decoder_read_bool(decoder_p, 0x81u);
+    } else {
+        dst_p->b = true;
+    }
+
+    dst_p->c = decoder_read_bool(decoder_p, 0x82u);
+
+    decoder_skip_additions(decoder_p);
+}
+
+static void ber_c_source_ae_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ae_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ae_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ae_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ae_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ae_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ae_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ae_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+
+    dst_p->is_a_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & BER_C_SOURCE_AE_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+        } else {
+            decoder_skip(decoder_p, 0x80u);
+        }
+    }
+
+    if (decoder_peek_tag(decoder_p) == 0x81u) {
+        if ((fields & BER_C_SOURCE_AE_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p, 0x81u);
+        } else {
+            decoder_skip(decoder_p, 0x81u);
+        }
+    } else {
+        dst_p->b = true;
+    }
+
+    if ((fields & BER_C_SOURCE_AE_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p, 0x82u);
+    } else {
+        decoder_skip(decoder_p, 0x82u);
+    }
+
+    decoder_skip_additions(decoder_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ae_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_ah_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ah_t *src_p)
+{
+    if (src_p->is_e_addition_present) {
+        encoder_prepend_integer(encoder_p, 0x82u, (int64_t)src_p->e);
+    }
+
+    if (src_p->is_d_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x81u, src_p->d);
+    }
+
+    encoder_prepend_bool(encoder_p, 0x80u, src_p->c);
+}
+
+static void ber_c_source_ah_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ah_t *dst_p)
+{
+    int64_t enum_value;
+
+    dst_p->c = decoder_read_bool(decoder_p, 0x80u);
+
+    dst_p->is_d_addition_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_d_addition_present) {
+        dst_p->d = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x81u);
+    }
+
+    dst_p->is_e_addition_present = (decoder_peek_tag(decoder_p) == 0x82u);
+
+    if (dst_p->is_e_addition_present) {
+        enum_value = decoder_read_integer(decoder_p, 0x82u);
+
+        switch (enum_value) {
+
+        case 0:
+        case 1:
+        case 2:
+            dst_p->e = (enum ber_c_source_ah_e_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    }
+
+    decoder_skip_additions(decoder_p);
+}
+
+static void ber_c_source_ah_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ah_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ah_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ah_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ah_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ah_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ah_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ah_t *dst_p,
+    uint64_t fields)
+{
+    int64_t enum_value;
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AH_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p, 0x80u);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+
+    dst_p->is_d_addition_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_d_addition_present) {
+        dst_p->d = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x81u);
+    }
+
+    dst_p->is_e_addition_present = (decoder_peek_tag(decoder_p) == 0x82u);
+
+    if (dst_p->is_e_addition_present) {
+        enum_value = decoder_read_integer(decoder_p, 0x82u);
+
+        switch (enum_value) {
+
+        case 0:
+        case 1:
+        case 2:
+            dst_p->e = (enum ber_c_source_ah_e_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    }
+
+    decoder_skip_additions(decoder_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ah_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_af_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_af_t *src_p)
+{
+    ssize_t start;
+
+    if (src_p->is_l_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x89u, src_p->l);
+    }
+
+    if (src_p->is_k_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x88u, src_p->k);
+    }
+
+    if (src_p->is_j_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x87u, src_p->j);
+    }
+
+    if (src_p->is_i_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x86u, src_p->i);
+    }
+
+    if (src_p->is_h_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x85u, src_p->h);
+    }
+
+    if (src_p->is_g_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x84u, src_p->g);
+    }
+
+    if (src_p->is_f_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x83u, src_p->f);
+    }
+
+    if (src_p->is_e_addition_present) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x82u, src_p->e);
+    }
+
+    if (src_p->is_b_addition_present) {
+        start = encoder_p->pos;
+        ber_c_source_ah_encode_content(encoder_p, &src_p->b);
+        encoder_prepend_tag_length(encoder_p, 0xa1u, start);
+    }
+
+    encoder_prepend_bool(encoder_p, 0x80u, src_p->a);
+}
+
+static void ber_c_source_af_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_af_t *dst_p)
+{
+    ssize_t outer_size;
+
+    dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+
+    dst_p->is_b_addition_present = (decoder_peek_tag(decoder_p) == 0xa1u);
+
+    if (dst_p->is_b_addition_present) {
+        outer_size = decoder_enter(decoder_p, 0xa1u);
+        ber_c_source_ah_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size);
+    }
+
+    dst_p->is_e_addition_present = (decoder_peek_tag(decoder_p) == 0x82u);
+
+    if (dst_p->is_e_addition_present) {
+        dst_p->e = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x82u);
+    }
+
+    dst_p->is_f_addition_present = (decoder_peek_tag(decoder_p) == 0x83u);
+
+    if (dst_p->is_f_addition_present) {
+        dst_p->f = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x83u);
+    }
+
+    dst_p->is_g_addition_present = (decoder_peek_tag(decoder_p) == 0x84u);
+
+    if (dst_p->is_g_addition_present) {
+        dst_p->g = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x84u);
+    }
+
+    dst_p->is_h_addition_present = (decoder_peek_tag(decoder_p) == 0x85u);
+
+    if (dst_p->is_h_addition_present) {
+        dst_p->h = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x85u);
+    }
+
+    dst_p->is_i_addition_present = (decoder_peek_tag(decoder_p) == 0x86u);
+
+    if (dst_p->is_i_addition_present) {
+        dst_p->i = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x86u);
+    }
+
+    dst_p->is_j_addition_present = (decoder_peek_tag(decoder_p) == 0x87u);
+
+    if (dst_p->is_j_addition_present) {
+        dst_p->j = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x87u);
+    }
+
+    dst_p->is_k_addition_present = (decoder_peek_tag(decoder_p) == 0x88u);
+
+    if (dst_p->is_k_addition_present) {
+        dst_p->k = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x88u);
+    }
+
+    dst_p->is_l_addition_present = (decoder_peek_tag(decoder_p) == 0x89u);
+
+    if (dst_p->is_l_addition_present) {
+        dst_p->l = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x89u);
+    }
+
+    decoder_skip_additions(decoder_p);
+}
+
+static void ber_c_source_af_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_af_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_af_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_af_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_af_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_af_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_af_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_af_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    outer_size_2 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AF_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+
+    dst_p->is_b_addition_present = (decoder_peek_tag(decoder_p) == 0xa1u);
+
+    if (dst_p->is_b_addition_present) {
+        outer_size = decoder_enter(decoder_p, 0xa1u);
+        ber_c_source_ah_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size);
+    }
+
+    dst_p->is_e_addition_present = (decoder_peek_tag(decoder_p) == 0x82u);
+
+    if (dst_p->is_e_addition_present) {
+        dst_p->e = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x82u);
+    }
+
+    dst_p->is_f_addition_present = (decoder_peek_tag(decoder_p) == 0x83u);
+
+    if (dst_p->is_f_addition_present) {
+        dst_p->f = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x83u);
+    }
+
+    dst_p->is_g_addition_present = (decoder_peek_tag(decoder_p) == 0x84u);
+
+    if (dst_p->is_g_addition_present) {
+        dst_p->g = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x84u);
+    }
+
+    dst_p->is_h_addition_present = (decoder_peek_tag(decoder_p) == 0x85u);
+
+    if (dst_p->is_h_addition_present) {
+        dst_p->h = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x85u);
+    }
+
+    dst_p->is_i_addition_present = (decoder_peek_tag(decoder_p) == 0x86u);
+
+    if (dst_p->is_i_addition_present) {
+        dst_p->i = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x86u);
+    }
+
+    dst_p->is_j_addition_present = (decoder_peek_tag(decoder_p) == 0x87u);
+
+    if (dst_p->is_j_addition_present) {
+        dst_p->j = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x87u);
+    }
+
+    dst_p->is_k_addition_present = (decoder_peek_tag(decoder_p) == 0x88u);
+
+    if (dst_p->is_k_addition_present) {
+        dst_p->k = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x88u);
+    }
+
+    dst_p->is_l_addition_present = (decoder_peek_tag(decoder_p) == 0x89u);
+
+    if (dst_p->is_l_addition_present) {
+        dst_p->l = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x89u);
+    }
+
+    decoder_skip_additions(decoder_p);
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_af_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_ag_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ag_t *src_p)
+{
+    uint8_t i;
+    ssize_t start;
+    ssize_t start_2;
+
+    if (src_p->is_m_addition_present) {
+        encoder_prepend_octet_string(encoder_p,
+                                     0x87u,
+                                     &src_p->m.buf[0],
+                                     5u);
+    }
+
+    if (src_p->is_j_addition_present) {
+        start_2 = encoder_p->pos;
+
+        switch (src_p->j.choice) {
+
+        case ber_c_source_ag_j_choice_k_e:
+            encoder_prepend_unsigned_integer(encoder_p, 0x80u, src_p->j.value.k);
+            break;
+
+        case ber_c_source_ag_j_choice_l_e:
+            encoder_prepend_bool(encoder_p, 0x81u, src_p->j.value.l);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa6u, start_2);
+    }
+
+    if (src_p->is_i_addition_present) {
+        encoder_prepend_real(encoder_p, 0x85u, src_p->i);
+    }
+
+    if (src_p->is_h_addition_present) {
+        encoder_prepend_null(encoder_p, 0x84u);
+    }
+
+    if (src_p->is_d_addition_present) {
+        encoder_prepend_integer(encoder_p, 0x83u, (int64_t)src_p->d);
+    }
+
+    if (src_p->is_c_addition_present) {
+        start = encoder_p->pos;
+        i = src_p->c.length;
+
+        while (i > 0u) {
+            i--;
+            encoder_prepend_bool(encoder_p, 0x01u, src_p->c.elements[i]);
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa2u, start);
+    }
+
+    if (src_p->is_b_addition_present) {
+        encoder_prepend_octet_string(encoder_p,
+                                     0x81u,
+                                     &src_p->b.buf[0],
+                                     src_p->b.length);
+    }
+
+    encoder_prepend_bool(encoder_p, 0x80u, src_p->a);
+}
+
+static void ber_c_source_ag_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ag_t *dst_p)
+{
+    uint32_t length;
+    uint8_t i;
+    uint32_t length_2;
+    ssize_t outer_size;
+    int64_t enum_value;
+    ssize_t outer_size_2;
+    uint32_t length_3;
+
+    dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+
+    dst_p->is_b_addition_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_addition_present) {
+        length = decoder_read_tag_length(decoder_p, 0x81u);
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->b.length = (uint8_t)length;
+        decoder_read_bytes(decoder_p,
+                           &dst_p->b.buf[0],
+                           length);
+    }
+
+    dst_p->is_c_addition_present = (decoder_peek_tag(decoder_p) == 0xa2u);
+
+    if (dst_p->is_c_addition_present) {
+        outer_size = decoder_enter(decoder_p, 0xa2u);
+        length_2 = decoder_count_elements(decoder_p);
+
+        if (length_2 > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->c.length = (uint8_t)length_2;
+
+        for (i = 0; i < length_2; i++) {
+            dst_p->c.elements[i] = decoder_read_bool(decoder_p, 0x01u);
+        }
+
+        decoder_leave(decoder_p, outer_size);
+    }
+
+    dst_p->is_d_addition_present = (decoder_peek_tag(decoder_p) == 0x83u);
+
+    if (dst_p->is_d_addition_present) {
+        enum_value = decoder_read_integer(decoder_p, 0x83u);
+
+        switch (enum_value) {
+
+        case 0:
+        case 256:
+        case 65536:
+            dst_p->d = (enum ber_c_source_ag_d_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    }
+
+    dst_p->is_h_addition_present = (decoder_peek_tag(decoder_p) == 0x84u);
+
+    if (dst_p->is_h_addition_present) {
+        decoder_read_null(decoder_p, 0x84u);
+    }
+
+    dst_p->is_i_addition_present = (decoder_peek_tag(decoder_p) == 0x85u);
+
+    if (dst_p->is_i_addition_present) {
+        dst_p->i = decoder_read_real(decoder_p, 0x85u);
+    }
+
+    dst_p->is_j_addition_present = (decoder_peek_tag(decoder_p) == 0xa6u);
+
+    if (dst_p->is_j_addition_present) {
+        outer_size_2 = decoder_enter(decoder_p, 0xa6u);
+
+        switch (decoder_peek_tag(decoder_p)) {
+
+        case 0x80u:
+            dst_p->j.choice = ber_c_source_ag_j_choice_k_e;
+            dst_p->j.value.k = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x80u);
+            break;
+
+        case 0x81u:
+            dst_p->j.choice = ber_c_source_ag_j_choice_l_e;
+            dst_p->j.value.l = decoder_read_bool(decoder_p, 0x81u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_leave(decoder_p, outer_size_2);
+    }
+
+    dst_p->is_m_addition_present = (decoder_peek_tag(decoder_p) == 0x87u);
+
+    if (dst_p->is_m_addition_present) {
+        length_3 = decoder_read_tag_length(decoder_p, 0x87u);
+
+        if (length_3 != 5u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->m.buf[0],
+                           length_3);
+    }
+
+    decoder_skip_additions(decoder_p);
+}
+
+static void ber_c_source_ag_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ag_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ag_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ag_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ag_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ag_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ag_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ag_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+    uint8_t i;
+    uint32_t length_2;
+    ssize_t outer_size;
+    int64_t enum_value;
+    ssize_t outer_size_2;
+    uint32_t length_3;
+    ssize_t outer_size_3;
+
+    outer_size_3 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AG_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+
+    dst_p->is_b_addition_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_addition_present) {
+        length = decoder_read_tag_length(decoder_p, 0x81u);
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->b.length = (uint8_t)length;
+        decoder_read_bytes(decoder_p,
+                           &dst_p->b.buf[0],
+                           length);
+    }
+
+    dst_p->is_c_addition_present = (decoder_peek_tag(decoder_p) == 0xa2u);
+
+    if (dst_p->is_c_addition_present) {
+        outer_size = decoder_enter(decoder_p, 0xa2u);
+        length_2 = decoder_count_elements(decoder_p);
+
+        if (length_2 > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->c.length = (uint8_t)length_2;
+
+        for (i = 0; i < length_2; i++) {
+            dst_p->c.elements[i] = decoder_read_bool(decoder_p, 0x01u);
+        }
+
+        decoder_leave(decoder_p, outer_size);
+    }
+
+    dst_p->is_d_addition_present = (decoder_peek_tag(decoder_p) == 0x83u);
+
+    if (dst_p->is_d_addition_present) {
+        enum_value = decoder_read_integer(decoder_p, 0x83u);
+
+        switch (enum_value) {
+
+        case 0:
+        case 256:
+        case 65536:
+            dst_p->d = (enum ber_c_source_ag_d_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    }
+
+    dst_p->is_h_addition_present = (decoder_peek_tag(decoder_p) == 0x84u);
+
+    if (dst_p->is_h_addition_present) {
+        decoder_read_null(decoder_p, 0x84u);
+    }
+
+    dst_p->is_i_addition_present = (decoder_peek_tag(decoder_p) == 0x85u);
+
+    if (dst_p->is_i_addition_present) {
+        dst_p->i = decoder_read_real(decoder_p, 0x85u);
+    }
+
+    dst_p->is_j_addition_present = (decoder_peek_tag(decoder_p) == 0xa6u);
+
+    if (dst_p->is_j_addition_present) {
+        outer_size_2 = decoder_enter(decoder_p, 0xa6u);
+
+        switch (decoder_peek_tag(decoder_p)) {
+
+        case 0x80u:
+            dst_p->j.choice = ber_c_source_ag_j_choice_k_e;
+            dst_p->j.value.k = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x80u);
+            break;
+
+        case 0x81u:
+            dst_p->j.choice = ber_c_source_ag_j_choice_l_e;
+            dst_p->j.value.l = decoder_read_bool(decoder_p, 0x81u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_leave(decoder_p, outer_size_2);
+    }
+
+    dst_p->is_m_addition_present = (decoder_peek_tag(decoder_p) == 0x87u);
+
+    if (dst_p->is_m_addition_present) {
+        length_3 = decoder_read_tag_length(decoder_p, 0x87u);
+
+        if (length_3 != 5u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->m.buf[0],
+                           length_3);
+    }
+
+    decoder_skip_additions(decoder_p);
+    decoder_leave(decoder_p, outer_size_3);
+}
+
+static void ber_c_source_ag_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_aj_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_aj_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x80u, (int64_t)src_p->a);
+}
+
+static void ber_c_source_aj_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_aj_t *dst_p)
+{
+    int64_t enum_value;
+
+    enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+    switch (enum_value) {
+
+    case 0:
+    case 1:
+        dst_p->a = (enum ber_c_source_aj_a_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+}
+
+static void ber_c_source_aj_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_aj_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_aj_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_aj_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_aj_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_aj_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_aj_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_aj_t *dst_p,
+    uint64_t fields)
+{
+    int64_t enum_value;
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AJ_FIELD_A) != 0u) {
+        enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+        switch (enum_value) {
+
+        case 0:
+        case 1:
+            dst_p->a = (enum ber_c_source_aj_a_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_aj_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_ak_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ak_t *src_p)
+{
+    ssize_t start;
+
+    switch (src_p->choice) {
+
+    case ber_c_source_ak_choice_a_e:
+        start = encoder_p->pos;
+        ber_c_source_aj_encode_content(encoder_p, &src_p->value.a);
+        encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_ak_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ak_t *dst_p)
+{
+    ssize_t outer_size;
+
+    switch (decoder_peek_tag(decoder_p)) {
+
+    case 0xa0u:
+        dst_p->choice = ber_c_source_ak_choice_a_e;
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+        ber_c_source_aj_decode_content(decoder_p, &dst_p->value.a);
+        decoder_leave(decoder_p, outer_size);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_ak_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_peek_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0xa0u:
+        decoder_skip(decoder_p, tag);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_ai_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ai_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ak_encode_inner(encoder_p, &src_p->a);
+    encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+}
+
+static void ber_c_source_ai_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ai_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0xa0u);
+    ber_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ai_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ai_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ai_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ai_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ai_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ai_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ai_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ai_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    outer_size_2 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AI_FIELD_A) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+        ber_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa0u);
+    }
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_ai_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_al_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_al_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_al_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_al_t *dst_p)
+{
+    dst_p->value = (int16_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_al_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_am_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_am_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_am_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_am_t *dst_p)
+{
+    dst_p->value = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_am_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_an_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_an_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x0au, (int64_t)src_p->value);
+}
+
+static void ber_c_source_an_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_an_t *dst_p)
+{
+    int64_t enum_value;
+
+    enum_value = decoder_read_integer(decoder_p, 0x0au);
+
+    switch (enum_value) {
+
+    case -16777216:
+    case -8388608:
+    case -65536:
+    case -32768:
+    case -128:
+    case 0:
+    case 127:
+    case 128:
+    case 32767:
+    case 65536:
+    case 16777216:
+        dst_p->value = (enum ber_c_source_an_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+}
+
+static void ber_c_source_an_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x0au);
+}
+
+static void ber_c_source_ao_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ao_t *src_p)
+{
+    encoder_prepend_bit_string(encoder_p,
+                               0x84u,
+                               (uint64_t)src_p->e,
+                               64);
+    encoder_prepend_bit_string(encoder_p,
+                               0x83u,
+                               (uint64_t)src_p->d,
+                               32);
+    encoder_prepend_bit_string(encoder_p,
+                               0x82u,
+                               (uint64_t)src_p->c >> 4,
+                               4);
+    encoder_prepend_bit_string(encoder_p,
+                               0x81u,
+                               (uint64_t)src_p->b,
+                               24);
+    encoder_prepend_bit_string(encoder_p,
+                               0x80u,
+                               (uint64_t)src_p->a,
+                               8);
+}
+
+static void ber_c_source_ao_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ao_t *dst_p)
+{
+    dst_p->a = (uint8_t)decoder_read_bit_string(decoder_p, 0x80u, 8);
+    dst_p->b = (uint32_t)decoder_read_bit_string(decoder_p, 0x81u, 24);
+    dst_p->c = (uint8_t)(decoder_read_bit_string(decoder_p, 0x82u, 4) << 4);
+    dst_p->d = (uint32_t)decoder_read_bit_string(decoder_p, 0x83u, 32);
+    dst_p->e = (uint64_t)decoder_read_bit_string(decoder_p, 0x84u, 64);
+}
+
+static void ber_c_source_ao_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ao_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ao_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ao_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ao_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ao_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ao_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ao_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AO_FIELD_A) != 0u) {
+        dst_p->a = (uint8_t)decoder_read_bit_string(decoder_p, 0x80u, 8);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+    if ((fields & BER_C_SOURCE_AO_FIELD_B) != 0u) {
+        dst_p->b = (uint32_t)decoder_read_bit_string(decoder_p, 0x81u, 24);
+    } else {
+        decoder_skip(decoder_p, 0x81u);
+    }
+    if ((fields & BER_C_SOURCE_AO_FIELD_C) != 0u) {
+        dst_p->c = (uint8_t)(decoder_read_bit_string(decoder_p, 0x82u, 4) << 4);
+    } else {
+        decoder_skip(decoder_p, 0x82u);
+    }
+    if ((fields & BER_C_SOURCE_AO_FIELD_D) != 0u) {
+        dst_p->d = (uint32_t)decoder_read_bit_string(decoder_p, 0x83u, 32);
+    } else {
+        decoder_skip(decoder_p, 0x83u);
+    }
+    if ((fields & BER_C_SOURCE_AO_FIELD_E) != 0u) {
+        dst_p->e = (uint64_t)decoder_read_bit_string(decoder_p, 0x84u, 64);
+    } else {
+        decoder_skip(decoder_p, 0x84u);
+    }
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ao_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_ref_referenced_sequence_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_ref_referenced_sequence_t *src_p)
+{
+    encoder_prepend_unsigned_integer(encoder_p, 0x80u, src_p->a);
+}
+
+static void ber_c_ref_referenced_sequence_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_ref_referenced_sequence_t *dst_p)
+{
+    dst_p->a = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x80u);
+}
+
+static void ber_c_ref_referenced_sequence_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_ref_referenced_sequence_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_ref_referenced_sequence_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_ref_referenced_sequence_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_ref_referenced_sequence_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_ref_referenced_sequence_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_ref_referenced_sequence_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_ref_referenced_sequence_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_REF_REFERENCED_SEQUENCE_FIELD_A) != 0u) {
+        dst_p->a = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x80u);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_ref_referenced_sequence_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_ref_referenced_enum_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_ref_referenced_enum_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x0au, (int64_t)src_p->value);
+}
+
+static void ber_c_ref_referenced_enum_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_ref_referenced_enum_t *dst_p)
+{
+    int64_t enum_value;
+
+    enum_value = decoder_read_integer(decoder_p, 0x0au);
+
+    switch (enum_value) {
+
+    case 0:
+    case 1:
+    case 2:
+        dst_p->value = (enum ber_c_ref_referenced_enum_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+}
+
+static void ber_c_ref_referenced_enum_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x0au);
+}
+
+static void ber_c_source_ap_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ap_t *src_p)
+{
+    ssize_t start;
+
+    if (src_p->d != 1) {
+        encoder_prepend_unsigned_integer(encoder_p, 0x82u, src_p->d);
+    }
+
+    if (src_p->c.value != ber_c_ref_referenced_enum_a_e) {
+        encoder_prepend_integer(encoder_p, 0x81u, (int64_t)src_p->c.value);
+    }
+
+    start = encoder_p->pos;
+    ber_c_ref_referenced_sequence_encode_content(encoder_p, &src_p->b);
+    encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+}
+
+static void ber_c_source_ap_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ap_t *dst_p)
+{
+    ssize_t outer_size;
+    int64_t enum_value;
+
+    outer_size = decoder_enter(decoder_p, 0xa0u);
+    ber_c_ref_referenced_sequence_decode_content(decoder_p, &dst_p->b);
+    decoder_leave(decoder_p, outer_size);
+
+    if (decoder_peek_tag(decoder_p) == 0x81u) {
+        enum_value = decoder_read_integer(decoder_p, 0x81u);
+
+        switch (enum_value) {
+
+        case 0:
+        case 1:
+        case 2:
+            dst_p->c.value = (enum ber_c_ref_referenced_enum_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    } else {
+        dst_p->c.value = ber_c_ref_referenced_enum_a_e;
+    }
+
+    if (decoder_peek_tag(decoder_p) == 0x82u) {
+        dst_p->d = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x82u);
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void ber_c_source_ap_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ap_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ap_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ap_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ap_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ap_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ap_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ap_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    int64_t enum_value;
+    ssize_t outer_size_2;
+
+    outer_size_2 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_AP_FIELD_B) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+        ber_c_ref_referenced_sequence_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa0u);
+    }
+
+    if (decoder_peek_tag(decoder_p) == 0x81u) {
+        if ((fields & BER_C_SOURCE_AP_FIELD_C) != 0u) {
+            enum_value = decoder_read_integer(decoder_p, 0x81u);
+
+            switch (enum_value) {
+
+            case 0:
+            case 1:
+            case 2:
+                dst_p->c.value = (enum ber_c_ref_referenced_enum_e)enum_value;
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADENUM);
+                break;
+            }
+        } else {
+            decoder_skip(decoder_p, 0x81u);
+        }
+    } else {
+        dst_p->c.value = ber_c_ref_referenced_enum_a_e;
+    }
+
+    if (decoder_peek_tag(decoder_p) == 0x82u) {
+        if ((fields & BER_C_SOURCE_AP_FIELD_D) != 0u) {
+            dst_p->d = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x82u);
+        } else {
+            decoder_skip(decoder_p, 0x82u);
+        }
+    } else {
+        dst_p->d = 1;
+    }
+
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_ap_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_aq_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_aq_t *src_p)
+{
+    encoder_prepend_unsigned_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_aq_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_aq_t *dst_p)
+{
+    dst_p->value = (uint32_t)decoder_read_unsigned_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_aq_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_ar_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ar_t *src_p)
+{
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+        (src_p->a.length != sizeof(a_default))) {
+        encoder_prepend_octet_string(encoder_p,
+                                     0x80u,
+                                     &src_p->a.buf[0],
+                                     src_p->a.length);
+    }
+}
+
+static void ber_c_source_ar_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ar_t *dst_p)
+{
+    uint32_t length;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    if (decoder_peek_tag(decoder_p) == 0x80u) {
+        length = decoder_read_tag_length(decoder_p, 0x80u);
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->a.length = (uint8_t)length;
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           length);
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void ber_c_source_ar_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_ar_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_ar_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_ar_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ar_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_ar_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ar_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_ar_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+
+    if (decoder_peek_tag(decoder_p) == 0x80u) {
+        if ((fields & BER_C_SOURCE_AR_FIELD_A) != 0u) {
+            length = decoder_read_tag_length(decoder_p, 0x80u);
+
+            if (length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            dst_p->a.length = (uint8_t)length;
+            decoder_read_bytes(decoder_p,
+                               &dst_p->a.buf[0],
+                               length);
+        } else {
+            decoder_skip(decoder_p, 0x80u);
+        }
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_ar_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_as_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_as_t *src_p)
+{
+    ssize_t start;
+
+    if (src_p->a_c != true) {
+        encoder_prepend_bool(encoder_p, 0x82u, src_p->a_c);
+    }
+
+    start = encoder_p->pos;
+
+    switch (src_p->a_b.choice) {
+
+    case ber_c_source_as_a_b_choice_b_a_e:
+        encoder_prepend_bool(encoder_p, 0x80u, src_p->a_b.value.b_a);
+        break;
+
+    case ber_c_source_as_a_b_choice_b_b_e:
+        encoder_prepend_bool(encoder_p, 0x81u, src_p->a_b.value.b_b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+
+    encoder_prepend_tag_length(encoder_p, 0xa1u, start);
+
+    if (src_p->is_a_a_present) {
+        encoder_prepend_bool(encoder_p, 0x80u, src_p->a_a);
+    }
+}
+
+static void ber_c_source_as_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_as_t *dst_p)
+{
+    ssize_t outer_size;
+
+    dst_p->is_a_a_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+    if (dst_p->is_a_a_present) {
+        dst_p->a_a = decoder_read_bool(decoder_p, 0x80u);
+    }
+
+    outer_size = decoder_enter(decoder_p, 0xa1u);
+
+    switch (decoder_peek_tag(decoder_p)) {
+
+    case 0x80u:
+        dst_p->a_b.choice = ber_c_source_as_a_b_choice_b_a_e;
+        dst_p->a_b.value.b_a = decoder_read_bool(decoder_p, 0x80u);
+        break;
+
+    case 0x81u:
+        dst_p->a_b.choice = ber_c_source_as_a_b_choice_b_b_e;
+        dst_p->a_b.value.b_b = decoder_read_bool(decoder_p, 0x81u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+
+    decoder_leave(decoder_p, outer_size);
+
+    if (decoder_peek_tag(decoder_p) == 0x82u) {
+        dst_p->a_c = decoder_read_bool(decoder_p, 0x82u);
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void ber_c_source_as_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_as_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_as_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_as_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_as_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_as_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_as_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_as_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    outer_size_2 = decoder_enter(decoder_p, 0x30u);
+
+    dst_p->is_a_a_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+    if (dst_p->is_a_a_present) {
+        if ((fields & BER_C_SOURCE_AS_FIELD_A_A) != 0u) {
+            dst_p->a_a = decoder_read_bool(decoder_p, 0x80u);
+        } else {
+            decoder_skip(decoder_p, 0x80u);
+        }
+    }
+
+    if ((fields & BER_C_SOURCE_AS_FIELD_A_B) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa1u);
+
+        switch (decoder_peek_tag(decoder_p)) {
+
+        case 0x80u:
+            dst_p->a_b.choice = ber_c_source_as_a_b_choice_b_a_e;
+            dst_p->a_b.value.b_a = decoder_read_bool(decoder_p, 0x80u);
+            break;
+
+        case 0x81u:
+            dst_p->a_b.choice = ber_c_source_as_a_b_choice_b_b_e;
+            dst_p->a_b.value.b_b = decoder_read_bool(decoder_p, 0x81u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa1u);
+    }
+
+    if (decoder_peek_tag(decoder_p) == 0x82u) {
+        if ((fields & BER_C_SOURCE_AS_FIELD_A_C) != 0u) {
+            dst_p->a_c = decoder_read_bool(decoder_p, 0x82u);
+        } else {
+            decoder_skip(decoder_p, 0x82u);
+        }
+    } else {
+        dst_p->a_c = true;
+    }
+
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_as_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_ref_at_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_ref_at_t *src_p)
+{
+    encoder_prepend_bit_string(encoder_p,
+                               0x03u,
+                               (uint64_t)src_p->value >> 6,
+                               2);
+}
+
+static void ber_c_ref_at_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_ref_at_t *dst_p)
+{
+    dst_p->value = (uint8_t)(decoder_read_bit_string(decoder_p, 0x03u, 2) << 6);
+}
+
+static void ber_c_ref_at_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x03u);
+}
+
+static void ber_c_source_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_b_t *src_p)
+{
+    ssize_t start;
+
+    switch (src_p->choice) {
+
+    case ber_c_source_b_choice_a_e:
+        encoder_prepend_integer(encoder_p, 0x80u, src_p->value.a);
+        break;
+
+    case ber_c_source_b_choice_b_e:
+        start = encoder_p->pos;
+        ber_c_source_a_encode_content(encoder_p, &src_p->value.b);
+        encoder_prepend_tag_length(encoder_p, 0xa1u, start);
+        break;
+
+    case ber_c_source_b_choice_c_e:
+        encoder_prepend_null(encoder_p, 0x82u);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_b_t *dst_p)
+{
+    ssize_t outer_size;
+
+    switch (decoder_peek_tag(decoder_p)) {
+
+    case 0x80u:
+        dst_p->choice = ber_c_source_b_choice_a_e;
+        dst_p->value.a = (int8_t)decoder_read_integer(decoder_p, 0x80u);
+        break;
+
+    case 0xa1u:
+        dst_p->choice = ber_c_source_b_choice_b_e;
+        outer_size = decoder_enter(decoder_p, 0xa1u);
+        ber_c_source_a_decode_content(decoder_p, &dst_p->value.b);
+        decoder_leave(decoder_p, outer_size);
+        break;
+
+    case 0x82u:
+        dst_p->choice = ber_c_source_b_choice_c_e;
+        decoder_read_null(decoder_p, 0x82u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_peek_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80u:
+    case 0xa1u:
+    case 0x82u:
+        decoder_skip(decoder_p, tag);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_c_source_c_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_c_t *src_p)
+{
+    uint8_t i;
+
+    i = src_p->length;
+
+    while (i > 0u) {
+        i--;
+        ber_c_source_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void ber_c_source_c_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_c_t *dst_p)
+{
+    uint8_t i;
+    uint32_t length;
+
+    length = decoder_count_elements(decoder_p);
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = (uint8_t)length;
+
+    for (i = 0; i < length; i++) {
+        ber_c_source_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void ber_c_source_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_c_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_c_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_c_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_c_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_e_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_e_t *src_p)
+{
+    ssize_t start;
+    ssize_t start_2;
+
+    start_2 = encoder_p->pos;
+
+    switch (src_p->a.choice) {
+
+    case ber_c_source_e_a_choice_b_e:
+        start = encoder_p->pos;
+
+        switch (src_p->a.value.b.choice) {
+
+        case ber_c_source_e_a_b_choice_c_e:
+            encoder_prepend_bool(encoder_p, 0x80u, src_p->a.value.b.value.c);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+
+    encoder_prepend_tag_length(encoder_p, 0xa0u, start_2);
+}
+
+static void ber_c_source_e_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_e_t *dst_p)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    outer_size_2 = decoder_enter(decoder_p, 0xa0u);
+
+    switch (decoder_peek_tag(decoder_p)) {
+
+    case 0xa0u:
+        dst_p->a.choice = ber_c_source_e_a_choice_b_e;
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+
+        switch (decoder_peek_tag(decoder_p)) {
+
+        case 0x80u:
+            dst_p->a.value.b.choice = ber_c_source_e_a_b_choice_c_e;
+            dst_p->a.value.b.value.c = decoder_read_bool(decoder_p, 0x80u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_leave(decoder_p, outer_size);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_e_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_e_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_e_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_e_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_e_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+
+    outer_size_3 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_E_FIELD_A) != 0u) {
+        outer_size_2 = decoder_enter(decoder_p, 0xa0u);
+
+        switch (decoder_peek_tag(decoder_p)) {
+
+        case 0xa0u:
+            dst_p->a.choice = ber_c_source_e_a_choice_b_e;
+            outer_size = decoder_enter(decoder_p, 0xa0u);
+
+            switch (decoder_peek_tag(decoder_p)) {
+
+            case 0x80u:
+                dst_p->a.value.b.choice = ber_c_source_e_a_b_choice_c_e;
+                dst_p->a.value.b.value.c = decoder_read_bool(decoder_p, 0x80u);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+
+            decoder_leave(decoder_p, outer_size);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_leave(decoder_p, outer_size_2);
+    } else {
+        decoder_skip(decoder_p, 0xa0u);
+    }
+    decoder_leave(decoder_p, outer_size_3);
+}
+
+static void ber_c_source_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_f_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_f_t *src_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+    ssize_t start;
+
+    i = src_p->length;
+
+    while (i > 0u) {
+        i--;
+        start = encoder_p->pos;
+        i_2 = 1u;
+
+        while (i_2 > 0u) {
+            i_2--;
+            encoder_prepend_bool(encoder_p, 0x01u, src_p->elements[i].elements[i_2]);
+        }
+
+        encoder_prepend_tag_length(encoder_p, 0x30u, start);
+    }
+}
+
+static void ber_c_source_f_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_f_t *dst_p)
+{
+    uint8_t i;
+    uint32_t length;
+    uint8_t i_2;
+    uint32_t length_2;
+    ssize_t outer_size;
+
+    length = decoder_count_elements(decoder_p);
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = (uint8_t)length;
+
+    for (i = 0; i < length; i++) {
+        outer_size = decoder_enter(decoder_p, 0x30u);
+        length_2 = decoder_count_elements(decoder_p);
+
+        if (length_2 != 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_2 = 0; i_2 < length_2; i_2++) {
+            dst_p->elements[i].elements[i_2] = decoder_read_bool(decoder_p, 0x01u);
+        }
+
+        decoder_leave(decoder_p, outer_size);
+    }
+}
+
+static void ber_c_source_f_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_f_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_f_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_f_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_f_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_f_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_f_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_g_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_g_t *src_p)
+{
+    if (src_p->is_i_present) {
+        encoder_prepend_bool(encoder_p, 0x88u, src_p->i);
+    }
+
+    if (src_p->is_h_present) {
+        encoder_prepend_bool(encoder_p, 0x87u, src_p->h);
+    }
+
+    if (src_p->is_g_present) {
+        encoder_prepend_bool(encoder_p, 0x86u, src_p->g);
+    }
+
+    if (src_p->is_f_present) {
+        encoder_prepend_bool(encoder_p, 0x85u, src_p->f);
+    }
+
+    if (src_p->is_e_present) {
+        encoder_prepend_bool(encoder_p, 0x84u, src_p->e);
+    }
+
+    if (src_p->is_d_present) {
+        encoder_prepend_bool(encoder_p, 0x83u, src_p->d);
+    }
+
+    if (src_p->is_c_present) {
+        encoder_prepend_bool(encoder_p, 0x82u, src_p->c);
+    }
+
+    if (src_p->is_b_present) {
+        encoder_prepend_bool(encoder_p, 0x81u, src_p->b);
+    }
+
+    if (src_p->is_a_present) {
+        encoder_prepend_bool(encoder_p, 0x80u, src_p->a);
+    }
+}
+
+static void ber_c_source_g_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_g_t *dst_p)
+{
+    dst_p->is_a_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+    }
+
+    dst_p->is_b_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_present) {
+        dst_p->b = decoder_read_bool(decoder_p, 0x81u);
+    }
+
+    dst_p->is_c_present = (decoder_peek_tag(decoder_p) == 0x82u);
+
+    if (dst_p->is_c_present) {
+        dst_p->c = decoder_read_bool(decoder_p, 0x82u);
+    }
+
+    dst_p->is_d_present = (decoder_peek_tag(decoder_p) == 0x83u);
+
+    if (dst_p->is_d_present) {
+        dst_p->d = decoder_read_bool(decoder_p, 0x83u);
+    }
+
+    dst_p->is_e_present = (decoder_peek_tag(decoder_p) == 0x84u);
+
+    if (dst_p->is_e_present) {
+        dst_p->e = decoder_read_bool(decoder_p, 0x84u);
+    }
+
+    dst_p->is_f_present = (decoder_peek_tag(decoder_p) == 0x85u);
+
+    if (dst_p->is_f_present) {
+        dst_p->f = decoder_read_bool(decoder_p, 0x85u);
+    }
+
+    dst_p->is_g_present = (decoder_peek_tag(decoder_p) == 0x86u);
+
+    if (dst_p->is_g_present) {
+        dst_p->g = decoder_read_bool(decoder_p, 0x86u);
+    }
+
+    dst_p->is_h_present = (decoder_peek_tag(decoder_p) == 0x87u);
+
+    if (dst_p->is_h_present) {
+        dst_p->h = decoder_read_bool(decoder_p, 0x87u);
+    }
+
+    dst_p->is_i_present = (decoder_peek_tag(decoder_p) == 0x88u);
+
+    if (dst_p->is_i_present) {
+        dst_p->i = decoder_read_bool(decoder_p, 0x88u);
+    }
+}
+
+static void ber_c_source_g_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_g_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_g_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_g_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_g_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_g_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_g_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_g_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+
+    dst_p->is_a_present = (decoder_peek_tag(decoder_p) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+        } else {
+            decoder_skip(decoder_p, 0x80u);
+        }
+    }
+
+    dst_p->is_b_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p, 0x81u);
+        } else {
+            decoder_skip(decoder_p, 0x81u);
+        }
+    }
+
+    dst_p->is_c_present = (decoder_peek_tag(decoder_p) == 0x82u);
+
+    if (dst_p->is_c_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_C) != 0u) {
+            dst_p->c = decoder_read_bool(decoder_p, 0x82u);
+        } else {
+            decoder_skip(decoder_p, 0x82u);
+        }
+    }
+
+    dst_p->is_d_present = (decoder_peek_tag(decoder_p) == 0x83u);
+
+    if (dst_p->is_d_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_D) != 0u) {
+            dst_p->d = decoder_read_bool(decoder_p, 0x83u);
+        } else {
+            decoder_skip(decoder_p, 0x83u);
+        }
+    }
+
+    dst_p->is_e_present = (decoder_peek_tag(decoder_p) == 0x84u);
+
+    if (dst_p->is_e_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_E) != 0u) {
+            dst_p->e = decoder_read_bool(decoder_p, 0x84u);
+        } else {
+            decoder_skip(decoder_p, 0x84u);
+        }
+    }
+
+    dst_p->is_f_present = (decoder_peek_tag(decoder_p) == 0x85u);
+
+    if (dst_p->is_f_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_F) != 0u) {
+            dst_p->f = decoder_read_bool(decoder_p, 0x85u);
+        } else {
+            decoder_skip(decoder_p, 0x85u);
+        }
+    }
+
+    dst_p->is_g_present = (decoder_peek_tag(decoder_p) == 0x86u);
+
+    if (dst_p->is_g_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_G) != 0u) {
+            dst_p->g = decoder_read_bool(decoder_p, 0x86u);
+        } else {
+            decoder_skip(decoder_p, 0x86u);
+        }
+    }
+
+    dst_p->is_h_present = (decoder_peek_tag(decoder_p) == 0x87u);
+
+    if (dst_p->is_h_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_H) != 0u) {
+            dst_p->h = decoder_read_bool(decoder_p, 0x87u);
+        } else {
+            decoder_skip(decoder_p, 0x87u);
+        }
+    }
+
+    dst_p->is_i_present = (decoder_peek_tag(decoder_p) == 0x88u);
+
+    if (dst_p->is_i_present) {
+        if ((fields & BER_C_SOURCE_G_FIELD_I) != 0u) {
+            dst_p->i = decoder_read_bool(decoder_p, 0x88u);
+        } else {
+            decoder_skip(decoder_p, 0x88u);
+        }
+    }
+
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_g_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_h_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_h_t *src_p)
+{
+    (void)src_p;
+    encoder_prepend_null(encoder_p, 0x05u);
+}
+
+static void ber_c_source_h_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_h_t *dst_p)
+{
+    (void)dst_p;
+    decoder_read_null(decoder_p, 0x05u);
+}
+
+static void ber_c_source_h_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x05u);
+}
+
+static void ber_c_source_i_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_i_t *src_p)
+{
+    encoder_prepend_octet_string(encoder_p,
+                                 0x04u,
+                                 &src_p->buf[0],
+                                 24u);
+}
+
+static void ber_c_source_i_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_i_t *dst_p)
+{
+    uint32_t length;
+
+    length = decoder_read_tag_length(decoder_p, 0x04u);
+
+    if (length != 24u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       length);
+}
+
+static void ber_c_source_i_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x04u);
+}
+
+static void ber_c_source_j_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_j_t *src_p)
+{
+    encoder_prepend_octet_string(encoder_p,
+                                 0x04u,
+                                 &src_p->buf[0],
+                                 src_p->length);
+}
+
+static void ber_c_source_j_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_j_t *dst_p)
+{
+    uint32_t length;
+
+    length = decoder_read_tag_length(decoder_p, 0x04u);
+
+    if (length > 23u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = (uint8_t)length;
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       length);
+}
+
+static void ber_c_source_j_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x04u);
+}
+
+static void ber_c_source_k_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_k_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x0au, (int64_t)src_p->value);
+}
+
+static void ber_c_source_k_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_k_t *dst_p)
+{
+    int64_t enum_value;
+
+    enum_value = decoder_read_integer(decoder_p, 0x0au);
+
+    switch (enum_value) {
+
+    case 0:
+        dst_p->value = (enum ber_c_source_k_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+}
+
+static void ber_c_source_k_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x0au);
+}
+
+static void ber_c_source_l_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_l_t *src_p)
+{
+    encoder_prepend_octet_string(encoder_p,
+                                 0x04u,
+                                 &src_p->buf[0],
+                                 src_p->length);
+}
+
+static void ber_c_source_l_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_l_t *dst_p)
+{
+    uint32_t length;
+
+    length = decoder_read_tag_length(decoder_p, 0x04u);
+
+    if (length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = length;
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       length);
+}
+
+static void ber_c_source_l_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x04u);
+}
+
+static void ber_c_source_o_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_o_t *src_p)
+{
+    uint16_t i;
+
+    i = src_p->length;
+
+    while (i > 0u) {
+        i--;
+        encoder_prepend_bool(encoder_p, 0x01u, src_p->elements[i]);
+    }
+}
+
+static void ber_c_source_o_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_o_t *dst_p)
+{
+    uint16_t i;
+    uint32_t length;
+
+    length = decoder_count_elements(decoder_p);
+
+    if (length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = length;
+
+    for (i = 0; i < length; i++) {
+        dst_p->elements[i] = decoder_read_bool(decoder_p, 0x01u);
+    }
+}
+
+static void ber_c_source_o_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_o_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_o_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_o_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_o_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_o_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_o_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_n_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_n_t *src_p)
+{
+    ssize_t start;
+    ssize_t start_2;
+
+    start_2 = encoder_p->pos;
+    ber_c_source_o_encode_content(encoder_p, &src_p->c);
+    encoder_prepend_tag_length(encoder_p, 0xa2u, start_2);
+    start = encoder_p->pos;
+    ber_c_source_a_encode_content(encoder_p, &src_p->b);
+    encoder_prepend_tag_length(encoder_p, 0xa1u, start);
+    encoder_prepend_integer(encoder_p, 0x80u, (int64_t)src_p->a.value);
+}
+
+static void ber_c_source_n_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_n_t *dst_p)
+{
+    int64_t enum_value;
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+    switch (enum_value) {
+
+    case 0:
+        dst_p->a.value = (enum ber_c_source_k_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+    outer_size = decoder_enter(decoder_p, 0xa1u);
+    ber_c_source_a_decode_content(decoder_p, &dst_p->b);
+    decoder_leave(decoder_p, outer_size);
+    outer_size_2 = decoder_enter(decoder_p, 0xa2u);
+    ber_c_source_o_decode_content(decoder_p, &dst_p->c);
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_n_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_n_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_n_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_n_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_n_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_n_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_n_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_n_t *dst_p,
+    uint64_t fields)
+{
+    int64_t enum_value;
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+
+    outer_size_3 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_N_FIELD_A) != 0u) {
+        enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+        switch (enum_value) {
+
+        case 0:
+            dst_p->a.value = (enum ber_c_source_k_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+    if ((fields & BER_C_SOURCE_N_FIELD_B) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa1u);
+        ber_c_source_a_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa1u);
+    }
+    if ((fields & BER_C_SOURCE_N_FIELD_C) != 0u) {
+        outer_size_2 = decoder_enter(decoder_p, 0xa2u);
+        ber_c_source_o_decode_content(decoder_p, &dst_p->c);
+        decoder_leave(decoder_p, outer_size_2);
+    } else {
+        decoder_skip(decoder_p, 0xa2u);
+    }
+    decoder_leave(decoder_p, outer_size_3);
+}
+
+static void ber_c_source_n_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_m_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_m_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_n_encode_content(encoder_p, &src_p->b);
+    encoder_prepend_tag_length(encoder_p, 0xa1u, start);
+    encoder_prepend_integer(encoder_p, 0x80u, (int64_t)src_p->a.value);
+}
+
+static void ber_c_source_m_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_m_t *dst_p)
+{
+    int64_t enum_value;
+    ssize_t outer_size;
+
+    enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+    switch (enum_value) {
+
+    case 0:
+        dst_p->a.value = (enum ber_c_source_k_e)enum_value;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        break;
+    }
+    outer_size = decoder_enter(decoder_p, 0xa1u);
+    ber_c_source_n_decode_content(decoder_p, &dst_p->b);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_m_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_m_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_m_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_m_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_m_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_m_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_m_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_m_t *dst_p,
+    uint64_t fields)
+{
+    int64_t enum_value;
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+
+    outer_size_2 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_M_FIELD_A) != 0u) {
+        enum_value = decoder_read_integer(decoder_p, 0x80u);
+
+        switch (enum_value) {
+
+        case 0:
+            dst_p->a.value = (enum ber_c_source_k_e)enum_value;
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADENUM);
+            break;
+        }
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+    if ((fields & BER_C_SOURCE_M_FIELD_B) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa1u);
+        ber_c_source_n_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa1u);
+    }
+    decoder_leave(decoder_p, outer_size_2);
+}
+
+static void ber_c_source_m_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_p_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_p_t *src_p)
+{
+    ssize_t start;
+    ssize_t start_2;
+    ssize_t start_3;
+
+    start_3 = encoder_p->pos;
+    ber_c_source_f_encode_content(encoder_p, &src_p->c);
+    encoder_prepend_tag_length(encoder_p, 0xa2u, start_3);
+    start_2 = encoder_p->pos;
+    ber_c_source_m_encode_content(encoder_p, &src_p->b);
+    encoder_prepend_tag_length(encoder_p, 0xa1u, start_2);
+    start = encoder_p->pos;
+    ber_c_source_a_encode_content(encoder_p, &src_p->a);
+    encoder_prepend_tag_length(encoder_p, 0xa0u, start);
+}
+
+static void ber_c_source_p_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_p_t *dst_p)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+
+    outer_size = decoder_enter(decoder_p, 0xa0u);
+    ber_c_source_a_decode_content(decoder_p, &dst_p->a);
+    decoder_leave(decoder_p, outer_size);
+    outer_size_2 = decoder_enter(decoder_p, 0xa1u);
+    ber_c_source_m_decode_content(decoder_p, &dst_p->b);
+    decoder_leave(decoder_p, outer_size_2);
+    outer_size_3 = decoder_enter(decoder_p, 0xa2u);
+    ber_c_source_f_decode_content(decoder_p, &dst_p->c);
+    decoder_leave(decoder_p, outer_size_3);
+}
+
+static void ber_c_source_p_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_p_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_c_source_p_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_c_source_p_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_p_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_c_source_p_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_c_source_p_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_p_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+    ssize_t outer_size_2;
+    ssize_t outer_size_3;
+    ssize_t outer_size_4;
+
+    outer_size_4 = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_C_SOURCE_P_FIELD_A) != 0u) {
+        outer_size = decoder_enter(decoder_p, 0xa0u);
+        ber_c_source_a_decode_content(decoder_p, &dst_p->a);
+        decoder_leave(decoder_p, outer_size);
+    } else {
+        decoder_skip(decoder_p, 0xa0u);
+    }
+    if ((fields & BER_C_SOURCE_P_FIELD_B) != 0u) {
+        outer_size_2 = decoder_enter(decoder_p, 0xa1u);
+        ber_c_source_m_decode_content(decoder_p, &dst_p->b);
+        decoder_leave(decoder_p, outer_size_2);
+    } else {
+        decoder_skip(decoder_p, 0xa1u);
+    }
+    if ((fields & BER_C_SOURCE_P_FIELD_C) != 0u) {
+        outer_size_3 = decoder_enter(decoder_p, 0xa2u);
+        ber_c_source_f_decode_content(decoder_p, &dst_p->c);
+        decoder_leave(decoder_p, outer_size_3);
+    } else {
+        decoder_skip(decoder_p, 0xa2u);
+    }
+    decoder_leave(decoder_p, outer_size_4);
+}
+
+static void ber_c_source_p_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_c_source_r_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_r_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_r_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_r_t *dst_p)
+{
+    dst_p->value = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_r_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_ref_referenced_int_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_ref_referenced_int_t *src_p)
+{
+    encoder_prepend_unsigned_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_ref_referenced_int_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_ref_referenced_int_t *dst_p)
+{
+    dst_p->value = (uint8_t)decoder_read_unsigned_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_ref_referenced_int_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_s_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_s_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_s_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_s_t *dst_p)
+{
+    dst_p->value = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_s_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_t_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_t_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_t_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_t_t *dst_p)
+{
+    dst_p->value = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_t_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_u_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_u_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_u_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_u_t *dst_p)
+{
+    dst_p->value = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_u_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_v_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_v_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_v_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_v_t *dst_p)
+{
+    dst_p->value = (int8_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_v_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_w_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_w_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_w_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_w_t *dst_p)
+{
+    dst_p->value = (int16_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_w_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_x_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_x_t *src_p)
+{
+    encoder_prepend_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_x_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_x_t *dst_p)
+{
+    dst_p->value = (int16_t)decoder_read_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_x_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_y_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_y_t *src_p)
+{
+    encoder_prepend_unsigned_integer(encoder_p, 0x02u, src_p->value);
+}
+
+static void ber_c_source_y_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_y_t *dst_p)
+{
+    dst_p->value = (uint16_t)decoder_read_unsigned_integer(decoder_p, 0x02u);
+}
+
+static void ber_c_source_y_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x02u);
+}
+
+static void ber_c_source_z_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_c_source_z_t *src_p)
+{
+    encoder_prepend_bool(encoder_p, 0x01u, src_p->value);
+}
+
+static void ber_c_source_z_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_c_source_z_t *dst_p)
+{
+    dst_p->value = decoder_read_bool(decoder_p, 0x01u);
+}
+
+static void ber_c_source_z_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x01u);
+}
+
+ssize_t ber_c_source_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_a_encoded_size(
+    const struct ber_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_a_decode(
+    struct ber_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_a_decode_batch(
+    struct ber_c_source_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_a_decode_fields(
+    struct ber_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ab_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ab_encoded_size(
+    const struct ber_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ab_decode(
+    struct ber_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ab_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ab_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ab_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ab_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ab_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ab_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ab_decode_batch(
+    struct ber_c_source_ab_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ab_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ab_decode_fields(
+    struct ber_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ab_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_q_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_q_encoded_size(
+    const struct ber_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_q_decode(
+    struct ber_c_source_q_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_q_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_q_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_q_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_q_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_q_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_q_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_q_decode_batch(
+    struct ber_c_source_q_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_q_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_d_encoded_size(
+    const struct ber_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_d_decode(
+    struct ber_c_source_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_d_decode_batch(
+    struct ber_c_source_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ac_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ac_encoded_size(
+    const struct ber_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ac_decode(
+    struct ber_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ac_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ac_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ac_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ac_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ac_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ac_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ac_decode_batch(
+    struct ber_c_source_ac_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ac_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ac_decode_fields(
+    struct ber_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ac_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ad_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ad_encoded_size(
+    const struct ber_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ad_decode(
+    struct ber_c_source_ad_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ad_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ad_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ad_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ad_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ad_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ad_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ad_decode_batch(
+    struct ber_c_source_ad_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ad_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ae_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ae_encoded_size(
+    const struct ber_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ae_decode(
+    struct ber_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ae_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ae_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ae_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ae_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ae_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ae_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ae_decode_batch(
+    struct ber_c_source_ae_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ae_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ae_decode_fields(
+    struct ber_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ae_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ah_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ah_encoded_size(
+    const struct ber_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ah_decode(
+    struct ber_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ah_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ah_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ah_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ah_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ah_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ah_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ah_decode_batch(
+    struct ber_c_source_ah_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ah_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ah_decode_fields(
+    struct ber_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ah_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_af_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_af_encoded_size(
+    const struct ber_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_af_decode(
+    struct ber_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_af_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_af_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_af_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_af_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_af_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_af_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_af_decode_batch(
+    struct ber_c_source_af_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_af_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_af_decode_fields(
+    struct ber_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_af_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ag_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ag_encoded_size(
+    const struct ber_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ag_decode(
+    struct ber_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ag_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ag_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ag_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ag_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ag_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ag_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ag_decode_batch(
+    struct ber_c_source_ag_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ag_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ag_decode_fields(
+    struct ber_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ag_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_aj_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_aj_encoded_size(
+    const struct ber_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_aj_decode(
+    struct ber_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_aj_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_aj_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_aj_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_aj_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_aj_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_aj_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_aj_decode_batch(
+    struct ber_c_source_aj_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_aj_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_aj_decode_fields(
+    struct ber_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_aj_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ak_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ak_encoded_size(
+    const struct ber_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ak_decode(
+    struct ber_c_source_ak_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ak_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ak_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ak_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ak_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ak_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ak_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ak_decode_batch(
+    struct ber_c_source_ak_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ak_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ai_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ai_encoded_size(
+    const struct ber_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ai_decode(
+    struct ber_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ai_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ai_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ai_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ai_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ai_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ai_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ai_decode_batch(
+    struct ber_c_source_ai_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ai_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ai_decode_fields(
+    struct ber_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ai_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_al_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_al_encoded_size(
+    const struct ber_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_al_decode(
+    struct ber_c_source_al_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_al_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_al_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_al_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_al_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_al_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_al_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_al_decode_batch(
+    struct ber_c_source_al_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_al_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_am_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_am_encoded_size(
+    const struct ber_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_am_decode(
+    struct ber_c_source_am_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_am_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_am_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_am_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_am_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_am_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_am_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_am_decode_batch(
+    struct ber_c_source_am_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_am_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_an_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_an_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_an_encoded_size(
+    const struct ber_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_an_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_an_decode(
+    struct ber_c_source_an_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_an_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_an_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_an_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_an_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_an_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_an_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_an_decode_batch(
+    struct ber_c_source_an_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_an_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ao_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ao_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ao_encoded_size(
+    const struct ber_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ao_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ao_decode(
+    struct ber_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ao_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ao_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ao_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ao_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ao_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ao_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ao_decode_batch(
+    struct ber_c_source_ao_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ao_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ao_decode_fields(
+    struct ber_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ao_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_sequence_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_referenced_sequence_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_referenced_sequence_encoded_size(
+    const struct ber_c_ref_referenced_sequence_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_referenced_sequence_decode(
+    struct ber_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_sequence_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_sequence_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_sequence_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_sequence_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_referenced_sequence_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_ref_referenced_sequence_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_ref_referenced_sequence_decode_batch(
+    struct ber_c_ref_referenced_sequence_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_ref_referenced_sequence_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_ref_referenced_sequence_decode_fields(
+    struct ber_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_sequence_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_enum_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_referenced_enum_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_referenced_enum_encoded_size(
+    const struct ber_c_ref_referenced_enum_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_referenced_enum_decode(
+    struct ber_c_ref_referenced_enum_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_enum_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_enum_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_enum_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_enum_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_referenced_enum_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_ref_referenced_enum_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_ref_referenced_enum_decode_batch(
+    struct ber_c_ref_referenced_enum_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_ref_referenced_enum_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ap_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ap_encoded_size(
+    const struct ber_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ap_decode(
+    struct ber_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ap_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ap_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ap_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ap_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ap_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ap_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ap_decode_batch(
+    struct ber_c_source_ap_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ap_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ap_decode_fields(
+    struct ber_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ap_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_aq_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_aq_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_aq_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_aq_encoded_size(
+    const struct ber_c_source_aq_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_aq_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_aq_decode(
+    struct ber_c_source_aq_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_aq_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_aq_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_aq_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_aq_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_aq_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_aq_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_aq_decode_batch(
+    struct ber_c_source_aq_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_aq_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ar_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ar_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_ar_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ar_encoded_size(
+    const struct ber_c_source_ar_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_ar_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_ar_decode(
+    struct ber_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ar_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ar_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ar_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_ar_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_ar_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_ar_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ar_decode_batch(
+    struct ber_c_source_ar_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_ar_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_ar_decode_fields(
+    struct ber_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_ar_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_as_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_as_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_as_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_as_encoded_size(
+    const struct ber_c_source_as_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_as_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_as_decode(
+    struct ber_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_as_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_as_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_as_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_as_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_as_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_as_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_as_decode_batch(
+    struct ber_c_source_as_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_as_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_as_decode_fields(
+    struct ber_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_as_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_at_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_at_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_ref_at_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_at_encoded_size(
+    const struct ber_c_ref_at_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_ref_at_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_at_decode(
+    struct ber_c_ref_at_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_at_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_at_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_at_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_at_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_at_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_ref_at_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_ref_at_decode_batch(
+    struct ber_c_ref_at_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_ref_at_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_b_encoded_size(
+    const struct ber_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_b_decode(
+    struct ber_c_source_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_b_decode_batch(
+    struct ber_c_source_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_c_encoded_size(
+    const struct ber_c_source_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_c_decode(
+    struct ber_c_source_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_c_decode_batch(
+    struct ber_c_source_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_e_encoded_size(
+    const struct ber_c_source_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_e_decode(
+    struct ber_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_e_decode_batch(
+    struct ber_c_source_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_e_decode_fields(
+    struct ber_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_f_encoded_size(
+    const struct ber_c_source_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_f_decode(
+    struct ber_c_source_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_f_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_f_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_f_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_f_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_f_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_f_decode_batch(
+    struct ber_c_source_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_f_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_g_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_g_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_g_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_g_encoded_size(
+    const struct ber_c_source_g_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_g_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_g_decode(
+    struct ber_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_g_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_g_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_g_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_g_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_g_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_g_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_g_decode_batch(
+    struct ber_c_source_g_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_g_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_g_decode_fields(
+    struct ber_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_g_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_h_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_h_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_h_encoded_size(
+    const struct ber_c_source_h_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_h_decode(
+    struct ber_c_source_h_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_h_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_h_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_h_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_h_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_h_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_h_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_h_decode_batch(
+    struct ber_c_source_h_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_h_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_i_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_i_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_i_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_i_encoded_size(
+    const struct ber_c_source_i_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_i_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_i_decode(
+    struct ber_c_source_i_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_i_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_i_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_i_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_i_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_i_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_i_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_i_decode_batch(
+    struct ber_c_source_i_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_i_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_j_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_j_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_j_encoded_size(
+    const struct ber_c_source_j_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_j_decode(
+    struct ber_c_source_j_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_j_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_j_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_j_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_j_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_j_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_j_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_j_decode_batch(
+    struct ber_c_source_j_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_j_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_k_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_k_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_k_encoded_size(
+    const struct ber_c_source_k_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_k_decode(
+    struct ber_c_source_k_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_k_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_k_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_k_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_k_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_k_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_k_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_k_decode_batch(
+    struct ber_c_source_k_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_k_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_l_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_l_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_l_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_l_encoded_size(
+    const struct ber_c_source_l_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_l_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_l_decode(
+    struct ber_c_source_l_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_l_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_l_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_l_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_l_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_l_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_l_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_l_decode_batch(
+    struct ber_c_source_l_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_l_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_o_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_o_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_o_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_o_encoded_size(
+    const struct ber_c_source_o_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_o_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_o_decode(
+    struct ber_c_source_o_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_o_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_o_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_o_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_o_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_o_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_o_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_o_decode_batch(
+    struct ber_c_source_o_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_o_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_n_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_n_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_n_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_n_encoded_size(
+    const struct ber_c_source_n_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_n_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_n_decode(
+    struct ber_c_source_n_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_n_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_n_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_n_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_n_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_n_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_n_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_n_decode_batch(
+    struct ber_c_source_n_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_n_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_n_decode_fields(
+    struct ber_c_source_n_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_n_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_m_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_m_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_m_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_m_encoded_size(
+    const struct ber_c_source_m_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_m_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_m_decode(
+    struct ber_c_source_m_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_m_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_m_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_m_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_m_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_m_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_m_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_m_decode_batch(
+    struct ber_c_source_m_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_m_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_m_decode_fields(
+    struct ber_c_source_m_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_m_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_p_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_p_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_p_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_p_encoded_size(
+    const struct ber_c_source_p_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_p_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_p_decode(
+    struct ber_c_source_p_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_p_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_p_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_p_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_p_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_p_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_p_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_p_decode_batch(
+    struct ber_c_source_p_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_p_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_p_decode_fields(
+    struct ber_c_source_p_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_p_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_r_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_r_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_r_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_r_encoded_size(
+    const struct ber_c_source_r_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_r_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_r_decode(
+    struct ber_c_source_r_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_r_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_r_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_r_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_r_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_r_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_r_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_r_decode_batch(
+    struct ber_c_source_r_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_r_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_ref_referenced_int_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_referenced_int_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_ref_referenced_int_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_referenced_int_encoded_size(
+    const struct ber_c_ref_referenced_int_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_ref_referenced_int_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_ref_referenced_int_decode(
+    struct ber_c_ref_referenced_int_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_int_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_int_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_ref_referenced_int_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_ref_referenced_int_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_ref_referenced_int_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_ref_referenced_int_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_ref_referenced_int_decode_batch(
+    struct ber_c_ref_referenced_int_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_ref_referenced_int_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_s_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_s_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_s_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_s_encoded_size(
+    const struct ber_c_source_s_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_s_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_s_decode(
+    struct ber_c_source_s_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_s_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_s_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_s_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_s_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_s_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_s_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_s_decode_batch(
+    struct ber_c_source_s_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_s_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_t_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_t_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_t_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_t_encoded_size(
+    const struct ber_c_source_t_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_t_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_t_decode(
+    struct ber_c_source_t_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_t_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_t_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_t_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_t_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_t_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_t_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_t_decode_batch(
+    struct ber_c_source_t_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_t_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_u_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_u_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_u_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_u_encoded_size(
+    const struct ber_c_source_u_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_u_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_u_decode(
+    struct ber_c_source_u_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_u_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_u_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_u_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_u_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_u_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_u_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_u_decode_batch(
+    struct ber_c_source_u_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_u_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_v_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_v_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_v_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_v_encoded_size(
+    const struct ber_c_source_v_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_v_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_v_decode(
+    struct ber_c_source_v_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_v_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_v_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_v_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_v_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_v_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_v_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_v_decode_batch(
+    struct ber_c_source_v_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_v_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_w_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_w_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_w_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_w_encoded_size(
+    const struct ber_c_source_w_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_w_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_w_decode(
+    struct ber_c_source_w_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_w_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_w_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_w_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_w_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_w_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_w_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_w_decode_batch(
+    struct ber_c_source_w_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_w_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_x_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_x_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_x_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_x_encoded_size(
+    const struct ber_c_source_x_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_x_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_x_decode(
+    struct ber_c_source_x_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_x_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_x_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_x_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_x_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_x_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_x_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_x_decode_batch(
+    struct ber_c_source_x_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_x_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_y_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_y_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_y_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_y_encoded_size(
+    const struct ber_c_source_y_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_y_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_y_decode(
+    struct ber_c_source_y_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_y_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_y_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_y_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_y_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_y_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_y_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_y_decode_batch(
+    struct ber_c_source_y_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_y_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_z_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_z_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_c_source_z_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_z_encoded_size(
+    const struct ber_c_source_z_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_c_source_z_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_c_source_z_decode(
+    struct ber_c_source_z_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_z_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_z_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_c_source_z_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_c_source_z_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_c_source_z_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_c_source_z_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_c_source_z_decode_batch(
+    struct ber_c_source_z_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_c_source_z_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
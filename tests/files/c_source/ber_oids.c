@@ -0,0 +1,2000 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 15:02:13 2026.
+ */
+
+#include <string.h>
+
+#include "ber_oids.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+const struct ber_oids_oid_t ber_oids_oids_id_example_oid = {
+    .length = 3,
+    .arcs = { 2u, 999u, 1u }
+};
+
+const struct ber_oids_oid_t ber_oids_oids_id_pkcs_1_oid = {
+    .length = 6,
+    .arcs = { 1u, 2u, 840u, 113549u, 1u, 1u }
+};
+
+const struct ber_oids_oid_t ber_oids_oids_id_rsa_encryption_oid = {
+    .length = 7,
+    .arcs = { 1u, 2u, 840u, 113549u, 1u, 1u, 1u }
+};
+
+const struct ber_oids_oid_t ber_oids_oids_id_rsadsi_oid = {
+    .length = 4,
+    .arcs = { 1u, 2u, 840u, 113549u }
+};
+
+const struct ber_oids_oid_t ber_oids_oids_id_sha256_with_rsa_encryption_oid = {
+    .length = 7,
+    .arcs = { 1u, 2u, 840u, 113549u, 1u, 1u, 11u }
+};
+
+static const uint8_t oids_id_example_oid_encoded[] = {
+    0x88, 0x37, 0x01
+};
+
+static const uint8_t oids_id_pkcs_1_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01
+};
+
+static const uint8_t oids_id_rsa_encryption_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01
+};
+
+static const uint8_t oids_id_rsadsi_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d
+};
+
+static const uint8_t oids_id_sha256_with_rsa_encryption_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b
+};
+
+static const uint8_t *oid_lookup_encoded(const uint32_t *arcs_p,
+                                         uint8_t length,
+                                         size_t *size_p)
+{
+    const uint8_t *buf_p;
+
+    buf_p = NULL;
+
+    switch (length) {
+
+    case 3:
+        if (memcmp(arcs_p, &ber_oids_oids_id_example_oid.arcs[0], 3 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_example_oid_encoded[0];
+            *size_p = sizeof(oids_id_example_oid_encoded);
+        }
+        break;
+
+    case 4:
+        if (memcmp(arcs_p, &ber_oids_oids_id_rsadsi_oid.arcs[0], 4 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_rsadsi_oid_encoded[0];
+            *size_p = sizeof(oids_id_rsadsi_oid_encoded);
+        }
+        break;
+
+    case 6:
+        if (memcmp(arcs_p, &ber_oids_oids_id_pkcs_1_oid.arcs[0], 6 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_pkcs_1_oid_encoded[0];
+            *size_p = sizeof(oids_id_pkcs_1_oid_encoded);
+        }
+        break;
+
+    case 7:
+        if (memcmp(arcs_p, &ber_oids_oids_id_rsa_encryption_oid.arcs[0], 7 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_rsa_encryption_oid_encoded[0];
+            *size_p = sizeof(oids_id_rsa_encryption_oid_encoded);
+        } else if (memcmp(arcs_p, &ber_oids_oids_id_sha256_with_rsa_encryption_oid.arcs[0], 7 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_sha256_with_rsa_encryption_oid_encoded[0];
+            *size_p = sizeof(oids_id_sha256_with_rsa_encryption_oid_encoded);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return (buf_p);
+}
+
+static bool oid_lookup_arcs(uint32_t *arcs_p,
+                            uint8_t *length_p,
+                            const uint8_t *buf_p,
+                            size_t size)
+{
+    const struct ber_oids_oid_t *oid_p;
+
+    oid_p = NULL;
+
+    switch (size) {
+
+    case 3:
+        if (memcmp(buf_p, &oids_id_example_oid_encoded[0], 3) == 0) {
+            oid_p = &ber_oids_oids_id_example_oid;
+        }
+        break;
+
+    case 6:
+        if (memcmp(buf_p, &oids_id_rsadsi_oid_encoded[0], 6) == 0) {
+            oid_p = &ber_oids_oids_id_rsadsi_oid;
+        }
+        break;
+
+    case 8:
+        if (memcmp(buf_p, &oids_id_pkcs_1_oid_encoded[0], 8) == 0) {
+            oid_p = &ber_oids_oids_id_pkcs_1_oid;
+        }
+        break;
+
+    case 9:
+        if (memcmp(buf_p, &oids_id_rsa_encryption_oid_encoded[0], 9) == 0) {
+            oid_p = &ber_oids_oids_id_rsa_encryption_oid;
+        } else if (memcmp(buf_p, &oids_id_sha256_with_rsa_encryption_oid_encoded[0], 9) == 0) {
+            oid_p = &ber_oids_oids_id_sha256_with_rsa_encryption_oid;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (oid_p == NULL) {
+        return (false);
+    }
+
+    memcpy(arcs_p, &oid_p->arcs[0], (size_t)oid_p->length * sizeof(uint32_t));
+    *length_p = oid_p->length;
+
+    return (true);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = (ssize_t)size;
+    self_p->size_only = false;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    ssize_t length;
+
+    if (self_p->size < 0) {
+        return (self_p->size);
+    }
+
+    length = (self_p->size - self_p->pos);
+
+    /* Encoded backwards from the end of the buffer, move to the start. */
+    if ((self_p->buf_p != NULL) && (self_p->pos > 0)) {
+        (void)memmove(&self_p->buf_p[0],
+                      &self_p->buf_p[self_p->pos],
+                      (size_t)length);
+    }
+
+    return (length);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if (self_p->size_only) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos -= (ssize_t)size;
+    } else if (self_p->pos >= (ssize_t)size) {
+        self_p->pos -= (ssize_t)size;
+        pos = self_p->pos;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_prepend_bytes(struct encoder_t *self_p,
+                                  const uint8_t *buf_p,
+                                  size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_prepend_uint8(struct encoder_t *self_p,
+                                  uint8_t value)
+{
+    encoder_prepend_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_prepend_long_uint(struct encoder_t *self_p,
+                                      uint64_t value,
+                                      uint8_t number_of_bytes)
+{
+    uint8_t buf[8];
+    uint8_t i;
+
+    for (i = number_of_bytes; i > 0u; i--) {
+        buf[i - 1u] = (uint8_t)value;
+        value >>= 8;
+    }
+
+    encoder_prepend_bytes(self_p, &buf[0], number_of_bytes);
+}
+
+static void encoder_prepend_tag(struct encoder_t *self_p,
+                                uint32_t tag)
+{
+    do {
+        encoder_prepend_uint8(self_p, (uint8_t)tag);
+        tag >>= 8;
+    } while (tag != 0u);
+}
+
+static void encoder_prepend_length(struct encoder_t *self_p,
+                                   uint32_t length)
+{
+    uint8_t number_of_bytes;
+
+    if (length < 128u) {
+        encoder_prepend_uint8(self_p, (uint8_t)length);
+    } else {
+        number_of_bytes = 1;
+
+        while ((number_of_bytes < 4u)
+               && ((length >> (8u * number_of_bytes)) != 0u)) {
+            number_of_bytes++;
+        }
+
+        encoder_prepend_long_uint(self_p, length, number_of_bytes);
+        encoder_prepend_uint8(self_p, (uint8_t)(0x80u | number_of_bytes));
+    }
+}
+
+static void encoder_prepend_tag_length(struct encoder_t *self_p,
+                                       uint32_t tag,
+                                       ssize_t start)
+{
+    encoder_prepend_length(self_p, (uint32_t)(start - self_p->pos));
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void encoder_prepend_bool(struct encoder_t *self_p,
+                                 uint32_t tag,
+                                 bool value)
+{
+    encoder_prepend_uint8(self_p, value ? 0xffu : 0x00u);
+    encoder_prepend_uint8(self_p, 1);
+    encoder_prepend_tag(self_p, tag);
+}
+
+static void encoder_prepend_octet_string(struct encoder_t *self_p,
+                                         uint32_t tag,
+                                         const uint8_t *buf_p,
+                                         uint32_t length)
+{
+    encoder_prepend_bytes(self_p, buf_p, length);
+    encoder_prepend_length(self_p, length);
+    encoder_prepend_tag(self_p, tag);
+}
+
+static ssize_t oid_encode(uint8_t *buf_p,
+                          const uint32_t *arcs_p,
+                          uint8_t length)
+{
+    const uint8_t *encoded_p;
+    uint64_t value;
+    size_t size;
+    uint8_t i;
+    unsigned int shift;
+
+    if ((length < 2) || (length > 16)) {
+        return (-EBADLENGTH);
+    }
+
+    /* Named values are copied as they are. */
+    encoded_p = oid_lookup_encoded(arcs_p, length, &size);
+
+    if (encoded_p != NULL) {
+        memcpy(buf_p, encoded_p, size);
+
+        return ((ssize_t)size);
+    }
+
+    if ((arcs_p[0] > 2) || ((arcs_p[0] < 2) && (arcs_p[1] > 39))) {
+        return (-EBADOID);
+    }
+
+    size = 0;
+
+    for (i = 1; i < length; i++) {
+        if (i == 1) {
+            value = (40u * (uint64_t)arcs_p[0] + arcs_p[1]);
+        } else {
+            value = arcs_p[i];
+        }
+
+        shift = 28;
+
+        while ((shift > 0) && ((value >> shift) == 0)) {
+            shift -= 7;
+        }
+
+        while (shift > 0) {
+            buf_p[size] = (uint8_t)(0x80u | ((value >> shift) & 0x7fu));
+            size++;
+            shift -= 7;
+        }
+
+        buf_p[size] = (uint8_t)(value & 0x7fu);
+        size++;
+    }
+
+    return ((ssize_t)size);
+}
+
+static void encoder_prepend_oid(struct encoder_t *self_p,
+                                uint32_t tag,
+                                const uint32_t *arcs_p,
+                                uint8_t length)
+{
+    uint8_t buf[75];
+    ssize_t size;
+
+    size = oid_encode(&buf[0], arcs_p, length);
+
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    encoder_prepend_octet_string(self_p, tag, &buf[0], (uint32_t)size);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint64_t decoder_read_long_uint(struct decoder_t *self_p,
+                                       uint8_t number_of_bytes)
+{
+    uint64_t value;
+    uint8_t i;
+
+    value = 0;
+
+    for (i = 0; i < number_of_bytes; i++) {
+        value <<= 8;
+        value |= decoder_read_uint8(self_p);
+    }
+
+    return (value);
+}
+
+static uint32_t decoder_read_tag(struct decoder_t *self_p)
+{
+    uint32_t tag;
+    uint8_t i;
+
+    tag = decoder_read_uint8(self_p);
+
+    if ((tag & 0x1fu) == 0x1fu) {
+        i = 1;
+
+        do {
+            if (i == 4u) {
+                decoder_abort(self_p, EBADTAG);
+
+                return (0);
+            }
+
+            tag <<= 8;
+            tag |= (uint32_t)decoder_read_uint8(self_p);
+            i++;
+        } while ((tag & 0x80u) == 0x80u);
+    }
+
+    return (tag);
+}
+
+static uint32_t decoder_peek_tag(const struct decoder_t *self_p)
+{
+    struct decoder_t decoder;
+
+    decoder = *self_p;
+
+    return (decoder_read_tag(&decoder));
+}
+
+static uint32_t decoder_read_length(struct decoder_t *self_p)
+{
+    uint32_t length;
+    uint8_t number_of_bytes;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        number_of_bytes = (uint8_t)(length & 0x7fu);
+
+        /* Indefinite lengths are not supported. */
+        if ((number_of_bytes == 0u) || (number_of_bytes > 4u)) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = (uint32_t)decoder_read_long_uint(self_p, number_of_bytes);
+    }
+
+    if ((size_t)length > (size_t)(self_p->size - self_p->pos)) {
+        decoder_abort(self_p, EOUTOFDATA);
+
+        return (0);
+    }
+
+    return (length);
+}
+
+static uint32_t decoder_read_tag_length(struct decoder_t *self_p,
+                                        uint32_t tag)
+{
+    if (decoder_read_tag(self_p) != tag) {
+        decoder_abort(self_p, EBADTAG);
+
+        return (0);
+    }
+
+    return (decoder_read_length(self_p));
+}
+
+static ssize_t decoder_enter(struct decoder_t *self_p,
+                             uint32_t tag)
+{
+    ssize_t size;
+    uint32_t length;
+
+    length = decoder_read_tag_length(self_p, tag);
+    size = self_p->size;
+
+    /* Limit decoding to the contents of the constructed value. */
+    if (size >= 0) {
+        self_p->size = (self_p->pos + (ssize_t)length);
+    }
+
+    return (size);
+}
+
+static void decoder_leave(struct decoder_t *self_p,
+                          ssize_t size)
+{
+    if (self_p->size < 0) {
+        return;
+    }
+
+    if (self_p->pos != self_p->size) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    self_p->size = size;
+}
+
+static void decoder_skip(struct decoder_t *self_p,
+                         uint32_t tag)
+{
+    (void)decoder_free(self_p, decoder_read_tag_length(self_p, tag));
+}
+
+static void decoder_skip_additions(struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        self_p->pos = self_p->size;
+    }
+}
+
+static uint32_t decoder_count_elements(const struct decoder_t *self_p)
+{
+    struct decoder_t decoder;
+    uint32_t count;
+
+    decoder = *self_p;
+    count = 0;
+
+    while (decoder.pos < decoder.size) {
+        (void)decoder_read_tag(&decoder);
+        (void)decoder_free(&decoder, decoder_read_length(&decoder));
+        count++;
+    }
+
+    return (count);
+}
+
+static bool decoder_read_bool(struct decoder_t *self_p,
+                              uint32_t tag)
+{
+    if (decoder_read_tag_length(self_p, tag) != 1u) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (false);
+    }
+
+    return (decoder_read_uint8(self_p) != 0u);
+}
+
+static int oid_decode(uint32_t *arcs_p,
+                      uint8_t *length_p,
+                      const uint8_t *buf_p,
+                      size_t size)
+{
+    uint64_t value;
+    uint8_t length;
+    size_t i;
+
+    /* Named values are matched on their encoding. */
+    if (oid_lookup_arcs(arcs_p, length_p, buf_p, size)) {
+        return (0);
+    }
+
+    if (size == 0) {
+        return (-EBADLENGTH);
+    }
+
+    if ((buf_p[size - 1] & 0x80u) != 0) {
+        return (-EBADOID);
+    }
+
+    length = 0;
+    value = 0;
+
+    for (i = 0; i < size; i++) {
+        value <<= 7;
+        value |= (buf_p[i] & 0x7fu);
+
+        if (value > 0x10000004full) {
+            return (-EBADOID);
+        }
+
+        if ((buf_p[i] & 0x80u) != 0) {
+            continue;
+        }
+
+        if (length == 0) {
+            if (value < 80) {
+                arcs_p[0] = (uint32_t)(value / 40);
+                arcs_p[1] = (uint32_t)(value % 40);
+            } else {
+                arcs_p[0] = 2;
+                arcs_p[1] = (uint32_t)(value - 80);
+            }
+
+            length = 2;
+        } else {
+            if (length == 16) {
+                return (-EBADLENGTH);
+            }
+
+            if (value > 0xffffffffu) {
+                return (-EBADOID);
+            }
+
+            arcs_p[length] = (uint32_t)value;
+            length++;
+        }
+
+        value = 0;
+    }
+
+    *length_p = length;
+
+    return (0);
+}
+
+static void decoder_read_oid(struct decoder_t *self_p,
+                             uint32_t tag,
+                             uint32_t *arcs_p,
+                             uint8_t *length_p)
+{
+    uint32_t size;
+    ssize_t pos;
+    int res;
+
+    size = decoder_read_tag_length(self_p, tag);
+    pos = decoder_free(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    /* Decoded directly from the encoded data. */
+    res = oid_decode(arcs_p, length_p, &self_p->buf_p[pos], size);
+
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+    }
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_uint(struct jer_encoder_t *self_p,
+                                    uint64_t value)
+{
+    static const char digits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    uint8_t *buf_p;
+    uint64_t power;
+    size_t number_of_digits;
+    size_t i;
+
+    number_of_digits = 1;
+    power = 10;
+
+    while ((number_of_digits < 20) && (value >= power)) {
+        number_of_digits++;
+        power *= 10;
+    }
+
+    buf_p = jer_encoder_alloc(self_p, number_of_digits);
+
+    if (buf_p == NULL) {
+        return;
+    }
+
+    /* Two digits at a time from the end. */
+    i = number_of_digits;
+
+    while (value >= 100) {
+        i -= 2;
+        (void)memcpy(&buf_p[i], &digits[2 * (value % 100)], 2);
+        value /= 100;
+    }
+
+    if (value >= 10) {
+        (void)memcpy(&buf_p[0], &digits[2 * value], 2);
+    } else {
+        buf_p[0] = (uint8_t)('0' + value);
+    }
+}
+
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}
+
+static void jer_encoder_append_oid(struct jer_encoder_t *self_p,
+                                   const uint32_t *arcs_p,
+                                   uint8_t length)
+{
+    uint8_t i;
+
+    if (length > 16) {
+        jer_encoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    jer_encoder_append_char(self_p, '"');
+
+    for (i = 0; i < length; i++) {
+        if (i > 0) {
+            jer_encoder_append_char(self_p, '.');
+        }
+
+        jer_encoder_append_uint(self_p, arcs_p[i]);
+    }
+
+    jer_encoder_append_char(self_p, '"');
+}
+
+static void ber_oids_oids_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_a_t *src_p)
+{
+    encoder_prepend_oid(encoder_p,
+                        0x06u,
+                        &src_p->value.arcs[0],
+                        src_p->value.length);
+}
+
+static void ber_oids_oids_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_a_t *dst_p)
+{
+    decoder_read_oid(decoder_p,
+                     0x06u,
+                     &dst_p->value.arcs[0],
+                     &dst_p->value.length);
+}
+
+static void ber_oids_oids_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x06u);
+}
+
+static void ber_oids_oids_b_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_b_t *src_p)
+{
+    encoder_prepend_bool(encoder_p, 0x82u, src_p->c);
+
+    if (src_p->is_b_present) {
+        encoder_prepend_oid(encoder_p,
+                            0x81u,
+                            &src_p->b.arcs[0],
+                            src_p->b.length);
+    }
+
+    encoder_prepend_oid(encoder_p,
+                        0x80u,
+                        &src_p->a.arcs[0],
+                        src_p->a.length);
+}
+
+static void ber_oids_oids_b_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_b_t *dst_p)
+{
+    decoder_read_oid(decoder_p,
+                     0x80u,
+                     &dst_p->a.arcs[0],
+                     &dst_p->a.length);
+
+    dst_p->is_b_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_present) {
+        decoder_read_oid(decoder_p,
+                         0x81u,
+                         &dst_p->b.arcs[0],
+                         &dst_p->b.length);
+    }
+
+    dst_p->c = decoder_read_bool(decoder_p, 0x82u);
+}
+
+static void ber_oids_oids_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_b_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_oids_oids_b_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_oids_oids_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_b_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_oids_oids_b_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_oids_oids_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_b_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_OIDS_OIDS_B_FIELD_A) != 0u) {
+        decoder_read_oid(decoder_p,
+                         0x80u,
+                         &dst_p->a.arcs[0],
+                         &dst_p->a.length);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+
+    dst_p->is_b_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_present) {
+        if ((fields & BER_OIDS_OIDS_B_FIELD_B) != 0u) {
+            decoder_read_oid(decoder_p,
+                             0x81u,
+                             &dst_p->b.arcs[0],
+                             &dst_p->b.length);
+        } else {
+            decoder_skip(decoder_p, 0x81u);
+        }
+    }
+
+    if ((fields & BER_OIDS_OIDS_B_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p, 0x82u);
+    } else {
+        decoder_skip(decoder_p, 0x82u);
+    }
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_oids_oids_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_oids_oids_c_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_c_t *src_p)
+{
+    uint8_t i;
+
+    i = src_p->length;
+
+    while (i > 0u) {
+        i--;
+        encoder_prepend_oid(encoder_p,
+                            0x06u,
+                            &src_p->elements[i].value.arcs[0],
+                            src_p->elements[i].value.length);
+    }
+}
+
+static void ber_oids_oids_c_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_c_t *dst_p)
+{
+    uint8_t i;
+    uint32_t length;
+
+    length = decoder_count_elements(decoder_p);
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->length = (uint8_t)length;
+
+    for (i = 0; i < length; i++) {
+        decoder_read_oid(decoder_p,
+                         0x06u,
+                         &dst_p->elements[i].value.arcs[0],
+                         &dst_p->elements[i].value.length);
+    }
+}
+
+static void ber_oids_oids_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_c_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_oids_oids_c_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_oids_oids_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_c_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_oids_oids_c_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_oids_oids_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+static void ber_oids_oids_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case ber_oids_oids_d_choice_a_e:
+        encoder_prepend_oid(encoder_p,
+                            0x80u,
+                            &src_p->value.a.arcs[0],
+                            src_p->value.a.length);
+        break;
+
+    case ber_oids_oids_d_choice_b_e:
+        encoder_prepend_bool(encoder_p, 0x81u, src_p->value.b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_oids_oids_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_d_t *dst_p)
+{
+    switch (decoder_peek_tag(decoder_p)) {
+
+    case 0x80u:
+        dst_p->choice = ber_oids_oids_d_choice_a_e;
+        decoder_read_oid(decoder_p,
+                         0x80u,
+                         &dst_p->value.a.arcs[0],
+                         &dst_p->value.a.length);
+        break;
+
+    case 0x81u:
+        dst_p->choice = ber_oids_oids_d_choice_b_e;
+        dst_p->value.b = decoder_read_bool(decoder_p, 0x81u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_oids_oids_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_peek_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80u:
+    case 0x81u:
+        decoder_skip(decoder_p, tag);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_oids_oids_e_encode_content(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_e_t *src_p)
+{
+    if (src_p->is_b_addition_present) {
+        encoder_prepend_oid(encoder_p,
+                            0x81u,
+                            &src_p->b.arcs[0],
+                            src_p->b.length);
+    }
+
+    encoder_prepend_bool(encoder_p, 0x80u, src_p->a);
+}
+
+static void ber_oids_oids_e_decode_content(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_e_t *dst_p)
+{
+    dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+
+    dst_p->is_b_addition_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_addition_present) {
+        decoder_read_oid(decoder_p,
+                         0x81u,
+                         &dst_p->b.arcs[0],
+                         &dst_p->b.length);
+    }
+
+    decoder_skip_additions(decoder_p);
+}
+
+static void ber_oids_oids_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct ber_oids_oids_e_t *src_p)
+{
+    ssize_t start;
+
+    start = encoder_p->pos;
+    ber_oids_oids_e_encode_content(encoder_p, src_p);
+    encoder_prepend_tag_length(encoder_p, 0x30u, start);
+}
+
+static void ber_oids_oids_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_e_t *dst_p)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    ber_oids_oids_e_decode_content(decoder_p, dst_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_oids_oids_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct ber_oids_oids_e_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t outer_size;
+
+    outer_size = decoder_enter(decoder_p, 0x30u);
+    if ((fields & BER_OIDS_OIDS_E_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p, 0x80u);
+    } else {
+        decoder_skip(decoder_p, 0x80u);
+    }
+
+    dst_p->is_b_addition_present = (decoder_peek_tag(decoder_p) == 0x81u);
+
+    if (dst_p->is_b_addition_present) {
+        decoder_read_oid(decoder_p,
+                         0x81u,
+                         &dst_p->b.arcs[0],
+                         &dst_p->b.length);
+    }
+
+    decoder_skip_additions(decoder_p);
+    decoder_leave(decoder_p, outer_size);
+}
+
+static void ber_oids_oids_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip(decoder_p, 0x30u);
+}
+
+ssize_t ber_oids_oids_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_a_encoded_size(
+    const struct ber_oids_oids_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_oids_oids_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_a_decode(
+    struct ber_oids_oids_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_oids_oids_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_a_decode_batch(
+    struct ber_oids_oids_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_oids_oids_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_b_encoded_size(
+    const struct ber_oids_oids_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_oids_oids_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_b_decode(
+    struct ber_oids_oids_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_oids_oids_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_b_decode_batch(
+    struct ber_oids_oids_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_oids_oids_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_b_decode_fields(
+    struct ber_oids_oids_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_c_encoded_size(
+    const struct ber_oids_oids_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_oids_oids_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_c_decode(
+    struct ber_oids_oids_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_oids_oids_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_c_decode_batch(
+    struct ber_oids_oids_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_oids_oids_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_d_encoded_size(
+    const struct ber_oids_oids_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_oids_oids_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_d_decode(
+    struct ber_oids_oids_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_oids_oids_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_d_decode_batch(
+    struct ber_oids_oids_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_oids_oids_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_e_encoded_size(
+    const struct ber_oids_oids_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    ber_oids_oids_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_e_decode(
+    struct ber_oids_oids_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t ber_oids_oids_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        ber_oids_oids_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_e_decode_batch(
+    struct ber_oids_oids_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        ber_oids_oids_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t ber_oids_oids_e_decode_fields(
+    struct ber_oids_oids_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    ber_oids_oids_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+static void ber_oids_oids_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct ber_oids_oids_a_t *src_p)
+{
+    jer_encoder_append_oid(encoder_p,
+                           &src_p->value.arcs[0],
+                           src_p->value.length);
+}
+
+static void ber_oids_oids_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct ber_oids_oids_b_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_oid(encoder_p,
+                           &src_p->a.arcs[0],
+                           src_p->a.length);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+        jer_encoder_append_oid(encoder_p,
+                               &src_p->b.arcs[0],
+                               src_p->b.length);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_append_string(encoder_p, "\"c\":", 4);
+    jer_encoder_append_bool(encoder_p, src_p->c);
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void ber_oids_oids_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct ber_oids_oids_c_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_char(encoder_p, '[');
+
+    for (i = 0; i < src_p->length; i++) {
+        ber_oids_oids_a_encode_jer_inner(encoder_p, &src_p->elements[i]);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+}
+
+static void ber_oids_oids_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct ber_oids_oids_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case ber_oids_oids_d_choice_a_e:
+        jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+        jer_encoder_append_oid(encoder_p,
+                               &src_p->value.a.arcs[0],
+                               src_p->value.a.length);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    case ber_oids_oids_d_choice_b_e:
+        jer_encoder_append_string(encoder_p, "{\"b\":", 5);
+        jer_encoder_append_bool(encoder_p, src_p->value.b);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    default:
+        jer_encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void ber_oids_oids_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct ber_oids_oids_e_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_bool(encoder_p, src_p->a);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_addition_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+        jer_encoder_append_oid(encoder_p,
+                               &src_p->b.arcs[0],
+                               src_p->b.length);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+ssize_t ber_oids_oids_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t ber_oids_oids_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct ber_oids_oids_e_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    ber_oids_oids_e_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
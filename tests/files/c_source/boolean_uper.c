@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.147.0 Wed Apr 15 07:30:29 2020.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:10 2026.
  */
 
 #include <string.h>
@@ -36,6 +36,10 @@ struct encoder_t {
     uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
 };
 
 struct decoder_t {
@@ -44,6 +48,29 @@ struct decoder_t {
     ssize_t pos;
 };
 
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
 static void encoder_init(struct encoder_t *self_p,
                          uint8_t *buf_p,
                          size_t size)
@@ -51,11 +78,23 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (8 * (ssize_t)size);
     self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
 }
 
-static ssize_t encoder_get_result(const struct encoder_t *self_p)
+static ssize_t encoder_get_result(struct encoder_t *self_p)
 {
+    size_t i;
+
     if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
         return ((self_p->pos + 7) / 8);
     } else {
         return (self_p->pos);
@@ -71,14 +110,18 @@ static void encoder_abort(struct encoder_t *self_p,
     }
 }
 
-static ssize_t encoder_alloc(struct encoder_t *self_p,
-                             size_t size)
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
 {
     ssize_t pos;
 
     if ((self_p->pos + (ssize_t)size) <= self_p->size) {
         pos = self_p->pos;
         self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
     } else {
         pos = -ENOMEM;
         encoder_abort(self_p, ENOMEM);
@@ -87,25 +130,59 @@ static ssize_t encoder_alloc(struct encoder_t *self_p,
     return (pos);
 }
 
-static void encoder_append_bit(struct encoder_t *self_p,
-                               int value)
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
 {
-    ssize_t pos;
+    size_t number_of_bits;
 
-    pos = encoder_alloc(self_p, 1);
-
-    if (pos < 0) {
+    if (size == 0) {
         return;
     }
 
-    if ((pos % 8) == 0) {
-        self_p->buf_p[pos / 8] = 0;
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
     }
 
-    self_p->buf_p[pos / 8] |= (uint8_t)(value << (7 - (pos % 8)));
+    self_p->number_of_bits = number_of_bits;
 }
 
-static void encoder_append_bool(struct encoder_t *self_p, bool value)
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
 {
     encoder_append_bit(self_p, value ? 1 : 0);
 }
@@ -137,8 +214,8 @@ static void decoder_abort(struct decoder_t *self_p,
     }
 }
 
-static ssize_t decoder_free(struct decoder_t *self_p,
-                            size_t size)
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
 {
     ssize_t pos;
 
@@ -153,7 +230,7 @@ static ssize_t decoder_free(struct decoder_t *self_p,
     return (pos);
 }
 
-static int decoder_read_bit(struct decoder_t *self_p)
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
 {
     ssize_t pos;
     int value;
@@ -161,7 +238,7 @@ static int decoder_read_bit(struct decoder_t *self_p)
     pos = decoder_free(self_p, 1);
 
     if (pos >= 0) {
-        value = ((self_p->buf_p[pos / 8] >> (7 - (pos % 8))) & 1);
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
     } else {
         value = 0;
     }
@@ -169,7 +246,7 @@ static int decoder_read_bit(struct decoder_t *self_p)
     return (value);
 }
 
-static bool decoder_read_bool(struct decoder_t *self_p)
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
 {
     return (decoder_read_bit(self_p) != 0);
 }
@@ -188,6 +265,12 @@ static void boolean_uper_boolean_a_decode_inner(
     dst_p->value = decoder_read_bool(decoder_p);
 }
 
+static void boolean_uper_boolean_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
 ssize_t boolean_uper_boolean_a_encode(
     uint8_t *dst_p,
     size_t size,
@@ -201,6 +284,18 @@ ssize_t boolean_uper_boolean_a_encode(
     return (encoder_get_result(&encoder));
 }
 
+ssize_t boolean_uper_boolean_a_encoded_size(
+    const struct boolean_uper_boolean_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    boolean_uper_boolean_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
 ssize_t boolean_uper_boolean_a_decode(
     struct boolean_uper_boolean_a_t *dst_p,
     const uint8_t *src_p,
@@ -213,3 +308,75 @@ ssize_t boolean_uper_boolean_a_decode(
 
     return (decoder_get_result(&decoder));
 }
+
+ssize_t boolean_uper_boolean_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    boolean_uper_boolean_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t boolean_uper_boolean_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct boolean_uper_boolean_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        boolean_uper_boolean_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t boolean_uper_boolean_a_decode_batch(
+    struct boolean_uper_boolean_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        boolean_uper_boolean_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
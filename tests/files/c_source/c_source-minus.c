@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.146.6 Tue Apr 14 16:08:00 2020.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 15:02:00 2026.
  */
 
 #include <string.h>
@@ -36,6 +36,7 @@ struct encoder_t {
     uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
+    bool size_only;
 };
 
 struct decoder_t {
@@ -51,6 +52,7 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (ssize_t)size;
     self_p->pos = 0;
+    self_p->size_only = false;
 }
 
 static ssize_t encoder_get_result(const struct encoder_t *self_p)
@@ -88,6 +90,12 @@ static void c_source_minus_foo_a_decode_inner(
     (void)dst_p;
 }
 
+static void c_source_minus_foo_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
 ssize_t c_source_minus_foo_a_encode(
     uint8_t *dst_p,
     size_t size,
@@ -101,6 +109,18 @@ ssize_t c_source_minus_foo_a_encode(
     return (encoder_get_result(&encoder));
 }
 
+ssize_t c_source_minus_foo_a_encoded_size(
+    const struct c_source_minus_foo_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    c_source_minus_foo_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
 ssize_t c_source_minus_foo_a_decode(
     struct c_source_minus_foo_a_t *dst_p,
     const uint8_t *src_p,
@@ -113,3 +133,75 @@ ssize_t c_source_minus_foo_a_decode(
 
     return (decoder_get_result(&decoder));
 }
+
+ssize_t c_source_minus_foo_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    c_source_minus_foo_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t c_source_minus_foo_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct c_source_minus_foo_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        c_source_minus_foo_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t c_source_minus_foo_a_decode_batch(
+    struct c_source_minus_foo_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        c_source_minus_foo_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.146.6 Tue Apr 14 16:08:00 2020.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:36:13 2026.
  */
 
 #ifndef C_SOURCE_MINUS_H
@@ -59,6 +59,22 @@
 #    define EBADENUM 503
 #endif
 
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
 /**
  * Type A in module Foo.
  */
@@ -66,6 +82,12 @@ struct c_source_minus_foo_a_t {
     uint8_t dummy;
 };
 
+/**
+ * Maximum encoded size of type A defined in module
+ * Foo, in bytes.
+ */
+#define C_SOURCE_MINUS_FOO_A_MAX_ENCODED_SIZE 0u
+
 /**
  * Encode type A defined in module Foo.
  *
@@ -80,6 +102,17 @@ ssize_t c_source_minus_foo_a_encode(
     size_t size,
     const struct c_source_minus_foo_a_t *src_p);
 
+/**
+ * Calculate the encoded size of type A defined in module
+ * Foo, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t c_source_minus_foo_a_encoded_size(
+    const struct c_source_minus_foo_a_t *src_p);
+
 /**
  * Decode type A defined in module Foo.
  *
@@ -94,4 +127,55 @@ ssize_t c_source_minus_foo_a_decode(
     const uint8_t *src_p,
     size_t size);
 
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Foo, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t c_source_minus_foo_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Foo after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t c_source_minus_foo_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct c_source_minus_foo_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Foo encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t c_source_minus_foo_a_decode_batch(
+    struct c_source_minus_foo_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
 #endif
@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.147.0 Wed Apr 15 07:30:29 2020.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:11 2026.
  */
 
 #include <string.h>
@@ -36,6 +36,10 @@ struct encoder_t {
     uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
 };
 
 struct decoder_t {
@@ -44,6 +48,41 @@ struct decoder_t {
     ssize_t pos;
 };
 
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
 static void encoder_init(struct encoder_t *self_p,
                          uint8_t *buf_p,
                          size_t size)
@@ -51,11 +90,23 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (8 * (ssize_t)size);
     self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
 }
 
-static ssize_t encoder_get_result(const struct encoder_t *self_p)
+static ssize_t encoder_get_result(struct encoder_t *self_p)
 {
+    size_t i;
+
     if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
         return ((self_p->pos + 7) / 8);
     } else {
         return (self_p->pos);
@@ -71,14 +122,18 @@ static void encoder_abort(struct encoder_t *self_p,
     }
 }
 
-static ssize_t encoder_alloc(struct encoder_t *self_p,
-                             size_t size)
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
 {
     ssize_t pos;
 
     if ((self_p->pos + (ssize_t)size) <= self_p->size) {
         pos = self_p->pos;
         self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
     } else {
         pos = -ENOMEM;
         encoder_abort(self_p, ENOMEM);
@@ -87,32 +142,78 @@ static ssize_t encoder_alloc(struct encoder_t *self_p,
     return (pos);
 }
 
-static void encoder_append_bytes(struct encoder_t *self_p,
-                                 const uint8_t *buf_p,
-                                 size_t size)
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
 {
-    size_t i;
-    ssize_t pos;
-    size_t byte_pos;
-    size_t pos_in_byte;
-
-    pos = encoder_alloc(self_p, 8u * size);
+    size_t number_of_bits;
 
-    if (pos < 0) {
+    if (size == 0) {
         return;
     }
 
-    byte_pos = ((size_t)pos / 8u);
-    pos_in_byte = ((size_t)pos % 8u);
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
 
-    if (pos_in_byte == 0u) {
-        (void)memcpy(&self_p->buf_p[byte_pos], buf_p, size);
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
     } else {
-        for (i = 0; i < size; i++) {
-            self_p->buf_p[byte_pos + i] |= (buf_p[i] >> pos_in_byte);
-            self_p->buf_p[byte_pos + i + 1] = (buf_p[i] << (8u - pos_in_byte));
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
         }
     }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
 }
 
 static void decoder_init(struct decoder_t *self_p,
@@ -142,8 +243,8 @@ static void decoder_abort(struct decoder_t *self_p,
     }
 }
 
-static ssize_t decoder_free(struct decoder_t *self_p,
-                            size_t size)
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
 {
     ssize_t pos;
 
@@ -158,14 +259,48 @@ static ssize_t decoder_free(struct decoder_t *self_p,
     return (pos);
 }
 
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
 static void decoder_read_bytes(struct decoder_t *self_p,
                                uint8_t *buf_p,
                                size_t size)
 {
     size_t i;
     ssize_t pos;
-    size_t byte_pos;
-    size_t pos_in_byte;
+    size_t bit_pos;
+    uint64_t value;
 
     pos = decoder_free(self_p, 8u * size);
 
@@ -173,15 +308,29 @@ static void decoder_read_bytes(struct decoder_t *self_p,
         return;
     }
 
-    byte_pos = ((size_t)pos / 8u);
-    pos_in_byte = ((size_t)pos % 8u);
+    bit_pos = (size_t)pos;
 
-    if (pos_in_byte == 0) {
-        (void)memcpy(buf_p, &self_p->buf_p[byte_pos], size);
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
     } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
         for (i = 0; i < size; i++) {
-            buf_p[i] = (self_p->buf_p[byte_pos + i] << pos_in_byte);
-            buf_p[i] |= (self_p->buf_p[byte_pos + i + 1] >> (8u - pos_in_byte));
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
         }
     }
 }
@@ -204,6 +353,12 @@ static void octet_string_uper_octet_string_a_decode_inner(
                        3);
 }
 
+static void octet_string_uper_octet_string_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 24u);
+}
+
 ssize_t octet_string_uper_octet_string_a_encode(
     uint8_t *dst_p,
     size_t size,
@@ -217,6 +372,18 @@ ssize_t octet_string_uper_octet_string_a_encode(
     return (encoder_get_result(&encoder));
 }
 
+ssize_t octet_string_uper_octet_string_a_encoded_size(
+    const struct octet_string_uper_octet_string_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    octet_string_uper_octet_string_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
 ssize_t octet_string_uper_octet_string_a_decode(
     struct octet_string_uper_octet_string_a_t *dst_p,
     const uint8_t *src_p,
@@ -229,3 +396,75 @@ ssize_t octet_string_uper_octet_string_a_decode(
 
     return (decoder_get_result(&decoder));
 }
+
+ssize_t octet_string_uper_octet_string_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    octet_string_uper_octet_string_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t octet_string_uper_octet_string_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct octet_string_uper_octet_string_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        octet_string_uper_octet_string_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t octet_string_uper_octet_string_a_decode_batch(
+    struct octet_string_uper_octet_string_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        octet_string_uper_octet_string_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
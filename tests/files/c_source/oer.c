@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.162.0 Thu May  5 20:47:02 2022.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:08 2026.
  */
 
 #include <string.h>
@@ -36,6 +36,7 @@ struct encoder_t {
     uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
+    bool size_only;
 };
 
 struct decoder_t {
@@ -45,6 +46,68 @@ struct decoder_t {
 };
 
 
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint16(uint8_t *buf_p, uint16_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 8);
+    buf_p[1] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE void store_uint32(uint8_t *buf_p, uint32_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 24);
+    buf_p[1] = (uint8_t)(value >> 16);
+    buf_p[2] = (uint8_t)(value >> 8);
+    buf_p[3] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint16_t load_uint16(const uint8_t *buf_p)
+{
+    return ((uint16_t)(((uint16_t)buf_p[0] << 8) | (uint16_t)buf_p[1]));
+}
+
+static ALWAYS_INLINE uint32_t load_uint32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | (uint32_t)buf_p[3]);
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+
 static uint8_t enumerated_value_length(int32_t value)
 {
     uint8_t length;
@@ -106,6 +169,7 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (ssize_t)size;
     self_p->pos = 0;
+    self_p->size_only = false;
 }
 
 static ssize_t encoder_get_result(const struct encoder_t *self_p)
@@ -130,6 +194,10 @@ static ssize_t encoder_alloc(struct encoder_t *self_p,
     if ((self_p->pos + (ssize_t)size) <= self_p->size) {
         pos = self_p->pos;
         self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
     } else {
         pos = -ENOMEM;
         encoder_abort(self_p, ENOMEM);
@@ -153,6 +221,27 @@ static void encoder_append_bytes(struct encoder_t *self_p,
     (void)memcpy(&self_p->buf_p[pos], buf_p, size);
 }
 
+static void encoder_append_bool_array(struct encoder_t *self_p,
+                                      const bool *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        buf_p[i] = (values_p[i] ? 255u : 0u);
+    }
+}
+
 static void encoder_append_uint8(struct encoder_t *self_p,
                                  uint8_t value)
 {
@@ -384,6 +473,29 @@ static void decoder_read_bytes(struct decoder_t *self_p,
     }
 }
 
+static void decoder_read_bool_array(struct decoder_t *self_p,
+                                    bool *values_p,
+                                    size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = (buf_p[i] != 0u);
+    }
+}
+
 static uint8_t decoder_read_uint8(struct decoder_t *self_p)
 {
     uint8_t value;
@@ -610,6 +722,46 @@ static uint32_t decoder_read_tag(struct decoder_t *self_p)
 
     return (tag);
 }
+
+static void decoder_skip_additions(struct decoder_t *self_p)
+{
+    uint32_t length;
+    uint32_t number_of_additions;
+    uint32_t i;
+    uint8_t mask;
+    ssize_t pos;
+
+    length = decoder_read_length_determinant(self_p);
+
+    if (length <= 1u) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(self_p, length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    number_of_additions = 0;
+
+    /* First byte is the number of unused bits in the presence bitmap. */
+    for (i = 1; i < length; i++) {
+        for (mask = self_p->buf_p[pos + (ssize_t)i]; mask != 0u; mask >>= 1) {
+            number_of_additions += (mask & 1u);
+        }
+    }
+
+    for (i = 0; i < number_of_additions; i++) {
+        length = decoder_read_length_determinant(self_p);
+
+        if (decoder_free(self_p, length) < 0) {
+            return;
+        }
+    }
+}
 static uint32_t get_choice_j_length(const struct oer_c_source_ag_t *src_p) {
     uint32_t length;
 
@@ -634,52 +786,164 @@ static void oer_c_source_a_encode_inner(
     struct encoder_t *encoder_p,
     const struct oer_c_source_a_t *src_p)
 {
-    encoder_append_int8(encoder_p, src_p->a);
-    encoder_append_int16(encoder_p, src_p->b);
-    encoder_append_int32(encoder_p, src_p->c);
-    encoder_append_int64(encoder_p, src_p->d);
-    encoder_append_uint8(encoder_p, src_p->e);
-    encoder_append_uint16(encoder_p, src_p->f);
-    encoder_append_uint32(encoder_p, src_p->g);
-    encoder_append_uint64(encoder_p, src_p->h);
-    encoder_append_bool(encoder_p, src_p->i);
-    encoder_append_bytes(encoder_p,
-                         &src_p->j.buf[0],
-                         11);
+    ssize_t pos;
+
+    pos = encoder_alloc(encoder_p, 42);
+
+    if (pos >= 0) {
+        encoder_p->buf_p[pos] = (uint8_t)src_p->a;
+        store_uint16(&encoder_p->buf_p[pos + 1], (uint16_t)src_p->b);
+        store_uint32(&encoder_p->buf_p[pos + 3], (uint32_t)src_p->c);
+        store_uint64(&encoder_p->buf_p[pos + 7], (uint64_t)src_p->d);
+        encoder_p->buf_p[pos + 15] = (uint8_t)src_p->e;
+        store_uint16(&encoder_p->buf_p[pos + 16], (uint16_t)src_p->f);
+        store_uint32(&encoder_p->buf_p[pos + 18], (uint32_t)src_p->g);
+        store_uint64(&encoder_p->buf_p[pos + 22], (uint64_t)src_p->h);
+        encoder_p->buf_p[pos + 30] = (src_p->i ? 255u : 0u);
+        (void)memcpy(&encoder_p->buf_p[pos + 31],
+                     &src_p->j.buf[0],
+                     11);
+    }
 }
 
 static void oer_c_source_a_decode_inner(
     struct decoder_t *decoder_p,
     struct oer_c_source_a_t *dst_p)
 {
-    dst_p->a = decoder_read_int8(decoder_p);
-    dst_p->b = decoder_read_int16(decoder_p);
-    dst_p->c = decoder_read_int32(decoder_p);
-    dst_p->d = decoder_read_int64(decoder_p);
-    dst_p->e = decoder_read_uint8(decoder_p);
-    dst_p->f = decoder_read_uint16(decoder_p);
-    dst_p->g = decoder_read_uint32(decoder_p);
-    dst_p->h = decoder_read_uint64(decoder_p);
-    dst_p->i = decoder_read_bool(decoder_p);
-    decoder_read_bytes(decoder_p,
-                       &dst_p->j.buf[0],
-                       11);
+    ssize_t pos;
+
+    pos = decoder_free(decoder_p, 42);
+
+    if (pos >= 0) {
+        dst_p->a = (int8_t)decoder_p->buf_p[pos];
+        dst_p->b = (int16_t)load_uint16(&decoder_p->buf_p[pos + 1]);
+        dst_p->c = (int32_t)load_uint32(&decoder_p->buf_p[pos + 3]);
+        dst_p->d = (int64_t)load_uint64(&decoder_p->buf_p[pos + 7]);
+        dst_p->e = decoder_p->buf_p[pos + 15];
+        dst_p->f = load_uint16(&decoder_p->buf_p[pos + 16]);
+        dst_p->g = load_uint32(&decoder_p->buf_p[pos + 18]);
+        dst_p->h = load_uint64(&decoder_p->buf_p[pos + 22]);
+        dst_p->i = (decoder_p->buf_p[pos + 30] != 0u);
+        (void)memcpy(&dst_p->j.buf[0],
+                     &decoder_p->buf_p[pos + 31],
+                     11);
+    }
+}
+
+static void oer_c_source_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_a_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_A_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_int8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_int16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_int32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_int64(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_F) != 0u) {
+        dst_p->f = decoder_read_uint16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_G) != 0u) {
+        dst_p->g = decoder_read_uint32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_H) != 0u) {
+        dst_p->h = decoder_read_uint64(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_I) != 0u) {
+        dst_p->i = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_C_SOURCE_A_FIELD_J) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           &dst_p->j.buf[0],
+                           11);
+    } else {
+        (void)decoder_free(decoder_p, 11u);
+    }
+}
+
+static void oer_c_source_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 42u);
 }
 
 static void oer_c_source_ab_encode_inner(
     struct encoder_t *encoder_p,
     const struct oer_c_source_ab_t *src_p)
 {
-    encoder_append_int8(encoder_p, src_p->a);
-    encoder_append_uint16(encoder_p, src_p->b);
+    ssize_t pos;
+
+    pos = encoder_alloc(encoder_p, 3);
+
+    if (pos >= 0) {
+        encoder_p->buf_p[pos] = (uint8_t)src_p->a;
+        store_uint16(&encoder_p->buf_p[pos + 1], (uint16_t)src_p->b);
+    }
 }
 
 static void oer_c_source_ab_decode_inner(
     struct decoder_t *decoder_p,
     struct oer_c_source_ab_t *dst_p)
 {
-    dst_p->a = decoder_read_int8(decoder_p);
-    dst_p->b = decoder_read_uint16(decoder_p);
+    ssize_t pos;
+
+    pos = decoder_free(decoder_p, 3);
+
+    if (pos >= 0) {
+        dst_p->a = (int8_t)decoder_p->buf_p[pos];
+        dst_p->b = load_uint16(&decoder_p->buf_p[pos + 1]);
+    }
+}
+
+static void oer_c_source_ab_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ab_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_AB_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_int8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_C_SOURCE_AB_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_uint16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+}
+
+static void oer_c_source_ab_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 3u);
 }
 
 static void oer_c_source_q_encode_inner(
@@ -3280,4017 +3544,12037 @@ static void oer_c_source_q_decode_inner(
     }
 }
 
-static void oer_c_source_d_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_d_t *src_p)
+static void oer_c_source_q_skip_inner(
+    struct decoder_t *decoder_p)
 {
-    uint8_t number_of_length_bytes;
-    uint8_t i;
-    uint8_t number_of_length_bytes_2;
-    uint8_t i_2;
-    uint8_t present_mask[1];
-    uint8_t enum_length;
-    uint8_t present_mask_2[1];
-    uint8_t present_mask_3[1];
-
-    number_of_length_bytes = minimum_uint_length(src_p->length);
-    encoder_append_uint8(encoder_p, number_of_length_bytes);
-    encoder_append_uint(encoder_p,
-                        src_p->length,
-                        number_of_length_bytes);
+    uint32_t tag;
 
-    for (i = 0; i < src_p->length; i++) {
-        switch (src_p->elements[i].a.b.choice) {
+    tag = decoder_read_tag(decoder_p);
 
-        case oer_c_source_d_a_b_choice_c_e:
-            encoder_append_uint(encoder_p, 0x80, 1);
-            encoder_append_uint8(encoder_p, src_p->elements[i].a.b.value.c);
-            break;
+    switch (tag) {
 
-        case oer_c_source_d_a_b_choice_d_e:
-            encoder_append_uint(encoder_p, 0x81, 1);
-            encoder_append_bool(encoder_p, src_p->elements[i].a.b.value.d);
-            break;
+    case 0x80:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        default:
-            encoder_abort(encoder_p, EBADCHOICE);
-            break;
-        }
+    case 0x81:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        number_of_length_bytes_2 = minimum_uint_length(src_p->elements[i].a.e.length);
-        encoder_append_uint8(encoder_p, number_of_length_bytes_2);
-        encoder_append_uint(encoder_p,
-                            src_p->elements[i].a.e.length,
-                            number_of_length_bytes_2);
+    case 0x82:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        for (i_2 = 0; i_2 < src_p->elements[i].a.e.length; i_2++) {
-        }
+    case 0x83:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        present_mask[0] = 0;
+    case 0x84:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].g.h != oer_c_source_d_g_h_j_e) {
-            present_mask[0] |= 0x80u;
-        }
+    case 0x85:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        encoder_append_bytes(encoder_p,
-                             &present_mask[0],
-                             sizeof(present_mask));
+    case 0x86:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].g.h != oer_c_source_d_g_h_j_e) {
-            enum_length = enumerated_value_length(src_p->elements[i].g.h);
+    case 0x87:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-            if (enum_length != 0u) {
-                encoder_append_uint8(encoder_p, 0x80u | enum_length);
-                encoder_append_int(encoder_p, (int32_t)src_p->elements[i].g.h, enum_length);
-            }
-            else {
-                encoder_append_uint8(encoder_p, (uint8_t)src_p->elements[i].g.h);
-            }
-        }
+    case 0x88:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        encoder_append_uint8(encoder_p, src_p->elements[i].g.l.length);
-        encoder_append_bytes(encoder_p,
-                             &src_p->elements[i].g.l.buf[0],
-                             src_p->elements[i].g.l.length);
-        present_mask_2[0] = 0;
+    case 0x89:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.is_n_present) {
-            present_mask_2[0] |= 0x80u;
-        }
+    case 0x8a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.o != 3) {
-            present_mask_2[0] |= 0x40u;
-        }
+    case 0x8b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.is_p_present) {
-            present_mask_2[0] |= 0x20u;
-        }
+    case 0x8c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.s != false) {
-            present_mask_2[0] |= 0x10u;
-        }
+    case 0x8d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        encoder_append_bytes(encoder_p,
-                             &present_mask_2[0],
-                             sizeof(present_mask_2));
+    case 0x8e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.is_n_present) {
-            encoder_append_bool(encoder_p, src_p->elements[i].m.n);
-        }
+    case 0x8f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.o != 3) {
-            encoder_append_int8(encoder_p, src_p->elements[i].m.o);
-        }
+    case 0x90:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x91:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x92:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x93:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x94:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x95:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x96:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x97:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x98:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x99:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x9a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x9b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x9c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x9d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x9e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x9f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa2:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa3:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa4:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa5:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa6:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa7:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa8:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xa9:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xaa:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xab:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xac:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xad:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xae:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xaf:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb2:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb3:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb4:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb5:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb6:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb7:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb8:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xb9:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xba:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbb:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbc:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbd:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbe:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf3f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf40:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf41:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf42:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf43:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf44:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf45:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf46:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf47:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf48:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf49:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf4a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf4b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf4c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf4d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf4e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf4f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf50:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf51:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf52:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf53:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf54:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf55:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf56:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf57:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf58:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf59:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf5a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf5b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf5c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf5d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf5e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf5f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf60:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf61:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf62:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf63:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf64:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf65:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf66:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf67:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf68:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf69:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf6a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf6b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf6c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf6d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf6e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf6f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf70:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf71:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf72:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf73:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf74:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf75:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf76:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf77:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf78:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf79:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf7a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf7b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf7c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf7d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf7e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf7f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8100:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8101:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8102:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8103:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8104:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8105:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8106:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8107:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8108:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8109:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf810a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf810b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf810c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf810d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf810e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf810f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8110:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8111:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8112:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8113:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8114:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8115:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8116:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8117:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8118:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8119:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf811a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf811b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf811c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf811d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf811e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf811f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8120:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8121:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8122:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8123:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8124:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8125:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8126:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8127:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8128:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8129:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf812a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf812b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf812c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf812d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf812e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf812f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8130:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8131:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8132:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8133:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8134:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8135:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8136:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8137:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8138:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8139:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf813a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf813b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf813c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf813d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf813e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf813f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8140:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8141:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8142:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8143:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8144:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8145:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8146:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8147:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8148:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8149:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf814a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf814b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf814c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf814d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf814e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf814f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8150:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8151:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8152:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8153:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8154:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8155:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8156:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8157:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8158:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8159:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf815a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf815b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf815c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf815d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf815e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf815f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8160:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8161:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8162:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8163:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8164:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8165:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8166:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8167:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8168:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8169:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf816a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf816b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf816c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf816d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf816e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf816f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8170:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8171:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8172:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8173:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8174:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8175:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8176:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8177:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8178:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8179:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf817a:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf817b:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf817c:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf817d:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf817e:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf817f:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0xbf8200:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_d_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t number_of_length_bytes_2;
+    uint8_t i_2;
+    uint8_t present_mask[1];
+    uint8_t enum_length;
+    uint8_t present_mask_2[1];
+    uint8_t present_mask_3[1];
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        switch (src_p->elements[i].a.b.choice) {
+
+        case oer_c_source_d_a_b_choice_c_e:
+            encoder_append_uint(encoder_p, 0x80, 1);
+            encoder_append_uint8(encoder_p, src_p->elements[i].a.b.value.c);
+            break;
+
+        case oer_c_source_d_a_b_choice_d_e:
+            encoder_append_uint(encoder_p, 0x81, 1);
+            encoder_append_bool(encoder_p, src_p->elements[i].a.b.value.d);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        number_of_length_bytes_2 = minimum_uint_length(src_p->elements[i].a.e.length);
+        encoder_append_uint8(encoder_p, number_of_length_bytes_2);
+        encoder_append_uint(encoder_p,
+                            src_p->elements[i].a.e.length,
+                            number_of_length_bytes_2);
+
+        for (i_2 = 0; i_2 < src_p->elements[i].a.e.length; i_2++) {
+        }
+
+        present_mask[0] = 0;
+
+        if (src_p->elements[i].g.h != oer_c_source_d_g_h_j_e) {
+            present_mask[0] |= 0x80u;
+        }
+
+        encoder_append_bytes(encoder_p,
+                             &present_mask[0],
+                             sizeof(present_mask));
+
+        if (src_p->elements[i].g.h != oer_c_source_d_g_h_j_e) {
+            enum_length = enumerated_value_length(src_p->elements[i].g.h);
+
+            if (enum_length != 0u) {
+                encoder_append_uint8(encoder_p, 0x80u | enum_length);
+                encoder_append_int(encoder_p, (int32_t)src_p->elements[i].g.h, enum_length);
+            }
+            else {
+                encoder_append_uint8(encoder_p, (uint8_t)src_p->elements[i].g.h);
+            }
+        }
+
+        encoder_append_uint8(encoder_p, src_p->elements[i].g.l.length);
+        encoder_append_bytes(encoder_p,
+                             &src_p->elements[i].g.l.buf[0],
+                             src_p->elements[i].g.l.length);
+        present_mask_2[0] = 0;
+
+        if (src_p->elements[i].m.is_n_present) {
+            present_mask_2[0] |= 0x80u;
+        }
+
+        if (src_p->elements[i].m.o != 3) {
+            present_mask_2[0] |= 0x40u;
+        }
+
+        if (src_p->elements[i].m.is_p_present) {
+            present_mask_2[0] |= 0x20u;
+        }
+
+        if (src_p->elements[i].m.s != false) {
+            present_mask_2[0] |= 0x10u;
+        }
+
+        encoder_append_bytes(encoder_p,
+                             &present_mask_2[0],
+                             sizeof(present_mask_2));
+
+        if (src_p->elements[i].m.is_n_present) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.n);
+        }
+
+        if (src_p->elements[i].m.o != 3) {
+            encoder_append_int8(encoder_p, src_p->elements[i].m.o);
+        }
 
         if (src_p->elements[i].m.is_p_present) {
             present_mask_3[0] = 0;
 
-            if (src_p->elements[i].m.p.is_r_present) {
-                present_mask_3[0] |= 0x80u;
-            }
+            if (src_p->elements[i].m.p.is_r_present) {
+                present_mask_3[0] |= 0x80u;
+            }
+
+            encoder_append_bytes(encoder_p,
+                                 &present_mask_3[0],
+                                 sizeof(present_mask_3));
+
+            encoder_append_bytes(encoder_p,
+                                 &src_p->elements[i].m.p.q.buf[0],
+                                 5);
+
+            if (src_p->elements[i].m.p.is_r_present) {
+                encoder_append_bool(encoder_p, src_p->elements[i].m.p.r);
+            }
+        }
+
+        if (src_p->elements[i].m.s != false) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.s);
+        }
+    }
+}
+
+static void oer_c_source_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_d_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint32_t tag;
+    uint8_t number_of_length_bytes_2;
+    uint8_t i_2;
+    uint8_t present_mask[1];
+    uint8_t enum_length;
+    uint8_t present_mask_2[1];
+    uint8_t present_mask_3[1];
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        tag = decoder_read_tag(decoder_p);
+
+        switch (tag) {
+
+        case 0x80:
+            dst_p->elements[i].a.b.choice = oer_c_source_d_a_b_choice_c_e;
+            dst_p->elements[i].a.b.value.c = decoder_read_uint8(decoder_p);
+            break;
+
+        case 0x81:
+            dst_p->elements[i].a.b.choice = oer_c_source_d_a_b_choice_d_e;
+            dst_p->elements[i].a.b.value.d = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        dst_p->elements[i].a.e.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_2);
+
+        if (dst_p->elements[i].a.e.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_2 = 0; i_2 < dst_p->elements[i].a.e.length; i_2++) {
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &present_mask[0],
+                           sizeof(present_mask));
+
+        if ((present_mask[0] & 0x80u) == 0x80u) {
+            enum_length = decoder_read_uint8(decoder_p);
+
+            if ((enum_length & 0x80u) == 0x80u) {
+                enum_length &= 0x7fu;
+
+                if ((enum_length > 2u) || (enum_length == 0u)) {
+                    decoder_abort(decoder_p, EBADLENGTH);
+
+                    return;
+                }
+                dst_p->elements[i].g.h = (enum oer_c_source_d_g_h_e)decoder_read_int(decoder_p, enum_length);
+            }
+            else {
+                dst_p->elements[i].g.h = (enum oer_c_source_d_g_h_e)enum_length;
+            }
+        } else {
+            dst_p->elements[i].g.h = oer_c_source_d_g_h_j_e;
+        }
+
+        dst_p->elements[i].g.l.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->elements[i].g.l.length > 2u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->elements[i].g.l.buf[0],
+                           dst_p->elements[i].g.l.length);
+        decoder_read_bytes(decoder_p,
+                           &present_mask_2[0],
+                           sizeof(present_mask_2));
+
+        dst_p->elements[i].m.is_n_present = ((present_mask_2[0] & 0x80u) == 0x80u);
+        dst_p->elements[i].m.is_p_present = ((present_mask_2[0] & 0x20u) == 0x20u);
+
+        if (dst_p->elements[i].m.is_n_present) {
+            dst_p->elements[i].m.n = decoder_read_bool(decoder_p);
+        }
+
+        if ((present_mask_2[0] & 0x40u) == 0x40u) {
+            dst_p->elements[i].m.o = decoder_read_int8(decoder_p);
+        } else {
+            dst_p->elements[i].m.o = 3;
+        }
+
+        if (dst_p->elements[i].m.is_p_present) {
+            decoder_read_bytes(decoder_p,
+                               &present_mask_3[0],
+                               sizeof(present_mask_3));
+
+            dst_p->elements[i].m.p.is_r_present = ((present_mask_3[0] & 0x80u) == 0x80u);
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->elements[i].m.p.q.buf[0],
+                               5);
+
+            if (dst_p->elements[i].m.p.is_r_present) {
+                dst_p->elements[i].m.p.r = decoder_read_bool(decoder_p);
+            }
+        }
+
+        if ((present_mask_2[0] & 0x10u) == 0x10u) {
+            dst_p->elements[i].m.s = decoder_read_bool(decoder_p);
+        } else {
+            dst_p->elements[i].m.s = false;
+        }
+    }
+}
+
+static void oer_c_source_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+    uint32_t tag;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length_2;
+    uint8_t present_mask[1];
+    uint8_t enum_length;
+    uint32_t length_3;
+    uint8_t present_mask_2[1];
+    uint8_t present_mask_3[1];
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        tag = decoder_read_tag(decoder_p);
+
+        switch (tag) {
+
+        case 0x80:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        case 0x81:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length_2 = decoder_read_uint(decoder_p, number_of_length_bytes_2);
+
+        if (length_2 > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &present_mask[0],
+                           sizeof(present_mask));
+
+        if ((present_mask[0] & 0x80u) == 0x80u) {
+            enum_length = decoder_read_uint8(decoder_p);
+
+            if ((enum_length & 0x80u) == 0x80u) {
+                enum_length &= 0x7fu;
+
+                if ((enum_length > 2u) || (enum_length == 0u)) {
+                    decoder_abort(decoder_p, EBADLENGTH);
+
+                    return;
+                }
+
+                (void)decoder_free(decoder_p, enum_length);
+            }
+        }
+        length_3 = decoder_read_uint8(decoder_p);
+
+        if (length_3 > 2u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3);
+        decoder_read_bytes(decoder_p,
+                           &present_mask_2[0],
+                           sizeof(present_mask_2));
+
+        if ((present_mask_2[0] & 0x80u) == 0x80u) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+        if ((present_mask_2[0] & 0x40u) == 0x40u) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+        if ((present_mask_2[0] & 0x20u) == 0x20u) {
+            decoder_read_bytes(decoder_p,
+                               &present_mask_3[0],
+                               sizeof(present_mask_3));
+
+            (void)decoder_free(decoder_p, 5u);
+            if ((present_mask_3[0] & 0x80u) == 0x80u) {
+                (void)decoder_free(decoder_p, 1u);
+            }
+        }
+        if ((present_mask_2[0] & 0x10u) == 0x10u) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+}
+
+static void oer_c_source_ac_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ac_t *src_p)
+{
+    oer_c_source_q_encode_inner(encoder_p, &src_p->a);
+    oer_c_source_d_encode_inner(encoder_p, &src_p->b);
+}
+
+static void oer_c_source_ac_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ac_t *dst_p)
+{
+    oer_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    oer_c_source_d_decode_inner(decoder_p, &dst_p->b);
+}
+
+static void oer_c_source_ac_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ac_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_AC_FIELD_A) != 0u) {
+        oer_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        oer_c_source_q_skip_inner(decoder_p);
+    }
+    if ((fields & OER_C_SOURCE_AC_FIELD_B) != 0u) {
+        oer_c_source_d_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        oer_c_source_d_skip_inner(decoder_p);
+    }
+}
+
+static void oer_c_source_ac_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    oer_c_source_q_skip_inner(decoder_p);
+    oer_c_source_d_skip_inner(decoder_p);
+}
+
+static void oer_c_source_ad_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ad_t *src_p)
+{
+    uint8_t enum_length;
+
+    enum_length = enumerated_value_length(src_p->value);
+
+    if (enum_length != 0u) {
+        encoder_append_uint8(encoder_p, 0x80u | enum_length);
+        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
+    }
+    else {
+        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
+    }
+}
+
+static void oer_c_source_ad_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ad_t *dst_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        dst_p->value = (enum oer_c_source_ad_e)decoder_read_int(decoder_p, enum_length);
+    }
+    else {
+        dst_p->value = (enum oer_c_source_ad_e)enum_length;
+    }
+}
+
+static void oer_c_source_ad_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, enum_length);
+    }
+}
+
+static void oer_c_source_ae_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ae_t *src_p)
+{
+    uint8_t present_mask[1];
+
+    present_mask[0] = 0;
+
+    if (src_p->is_a_present) {
+        present_mask[0] |= 0x40u;
+    }
+
+    if (src_p->b != true) {
+        present_mask[0] |= 0x20u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->b != true) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    encoder_append_bool(encoder_p, src_p->c);
+}
+
+static void oer_c_source_ae_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ae_t *dst_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x40u) == 0x40u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if ((present_mask[0] & 0x20u) == 0x20u) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    } else {
+        dst_p->b = true;
+    }
+
+    dst_p->c = decoder_read_bool(decoder_p);
+}
+
+static void oer_c_source_ae_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ae_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x40u) == 0x40u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & OER_C_SOURCE_AE_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((present_mask[0] & 0x20u) == 0x20u) {
+        if ((fields & OER_C_SOURCE_AE_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->b = true;
+    }
+
+    if ((fields & OER_C_SOURCE_AE_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_c_source_ae_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x20u) == 0x20u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 1u);
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        decoder_skip_additions(decoder_p);
+    }
+}
+
+static void oer_c_source_ah_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ah_t *src_p)
+{
+    uint8_t present_mask[1];
+    uint8_t addition_mask[1];
+    uint8_t enum_length;
+
+    if(src_p->is_d_addition_present || src_p->is_e_addition_present) {
+        present_mask[0] = 0x80;
+    }
+    else {
+        present_mask[0] = 0x0;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_bool(encoder_p, src_p->c);
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        encoder_append_length_determinant(encoder_p, 2);
+        encoder_append_uint8(encoder_p, 6);
+        addition_mask[0] = 0;
+
+        if (src_p->is_d_addition_present) {
+            addition_mask[0] |= 0x80u;
+        }
+
+        if (src_p->is_e_addition_present) {
+            addition_mask[0] |= 0x40u;
+        }
+        encoder_append_bytes(encoder_p,
+                             &addition_mask[0],
+                             sizeof(addition_mask));
+
+        if (src_p->is_d_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->d);
+        }
+
+        if (src_p->is_e_addition_present) {
+            encoder_append_length_determinant(encoder_p, (uint32_t)enumerated_value_length((int32_t)src_p->e) +
+                1u);
+            enum_length = enumerated_value_length(src_p->e);
+
+            if (enum_length != 0u) {
+                encoder_append_uint8(encoder_p, 0x80u | enum_length);
+                encoder_append_int(encoder_p, (int32_t)src_p->e, enum_length);
+            }
+            else {
+                encoder_append_uint8(encoder_p, (uint8_t)src_p->e);
+            }
+        }
+    }
+}
+
+static void oer_c_source_ah_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ah_t *dst_p)
+{
+    uint8_t present_mask[1];
+    uint32_t addition_length;
+    uint8_t addition_unused_bits;
+    uint32_t addition_bits;
+    uint8_t addition_mask[1];
+    uint32_t i;
+    uint8_t tmp_addition_mask;
+    uint32_t unknown_addition_bits;
+    uint8_t mask;
+    uint8_t enum_length;
+    uint32_t tmp_length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->c = decoder_read_bool(decoder_p);
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        addition_length = decoder_read_length_determinant(decoder_p);
+
+        if(addition_length <= 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_length -= 1u;
+        addition_unused_bits = decoder_read_uint8(decoder_p);
+
+        if (addition_unused_bits > 7u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_bits = ((addition_length * 8u) - addition_unused_bits);
+        decoder_read_bytes(decoder_p,
+                           addition_mask,
+                           (addition_length < 1u) ? addition_length : 1u);
+
+        tmp_addition_mask = addition_mask[0];
+        mask = 0x20;
+        unknown_addition_bits = 0;
+
+        for (i = 2; i < addition_bits; i++) {
+
+            if (mask == 0u) {
+                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+
+                if (decoder_get_result(decoder_p) < 0) {
+
+                    return;
+                }
+                mask = 0x80;
+            }
+
+            if( (tmp_addition_mask & mask) == mask) {
+                unknown_addition_bits += 1u;
+            };
+            mask >>= 1;
+        }
+        dst_p->is_d_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+
+        if (dst_p->is_d_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->d = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_e_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+
+        if (dst_p->is_e_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            enum_length = decoder_read_uint8(decoder_p);
+
+            if ((enum_length & 0x80u) == 0x80u) {
+                enum_length &= 0x7fu;
+
+                if ((enum_length > 1u) || (enum_length == 0u)) {
+                    decoder_abort(decoder_p, EBADLENGTH);
+
+                    return;
+                }
+                dst_p->e = (enum oer_c_source_ah_e_e)decoder_read_int(decoder_p, enum_length);
+            }
+            else {
+                dst_p->e = (enum oer_c_source_ah_e_e)enum_length;
+            }
+        }
+
+        for (i = 0; i < unknown_addition_bits; i++) {
+            tmp_length = decoder_read_length_determinant(decoder_p);
+
+            if (decoder_free(decoder_p, tmp_length) < 0) {
+
+                return;
+            }
+        }
+    }
+    else {
+        dst_p->is_d_addition_present = false;
+        dst_p->is_e_addition_present = false;
+    }
+}
+
+static void oer_c_source_ah_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ah_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t addition_length;
+    uint8_t addition_unused_bits;
+    uint32_t addition_bits;
+    uint8_t addition_mask[1];
+    uint32_t i;
+    uint8_t tmp_addition_mask;
+    uint32_t unknown_addition_bits;
+    uint8_t mask;
+    uint8_t enum_length;
+    uint32_t tmp_length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((fields & OER_C_SOURCE_AH_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        addition_length = decoder_read_length_determinant(decoder_p);
+
+        if(addition_length <= 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_length -= 1u;
+        addition_unused_bits = decoder_read_uint8(decoder_p);
+
+        if (addition_unused_bits > 7u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_bits = ((addition_length * 8u) - addition_unused_bits);
+        decoder_read_bytes(decoder_p,
+                           addition_mask,
+                           (addition_length < 1u) ? addition_length : 1u);
+
+        tmp_addition_mask = addition_mask[0];
+        mask = 0x20;
+        unknown_addition_bits = 0;
+
+        for (i = 2; i < addition_bits; i++) {
+
+            if (mask == 0u) {
+                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+
+                if (decoder_get_result(decoder_p) < 0) {
+
+                    return;
+                }
+                mask = 0x80;
+            }
+
+            if( (tmp_addition_mask & mask) == mask) {
+                unknown_addition_bits += 1u;
+            };
+            mask >>= 1;
+        }
+        dst_p->is_d_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+
+        if (dst_p->is_d_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->d = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_e_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+
+        if (dst_p->is_e_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            enum_length = decoder_read_uint8(decoder_p);
+
+            if ((enum_length & 0x80u) == 0x80u) {
+                enum_length &= 0x7fu;
+
+                if ((enum_length > 1u) || (enum_length == 0u)) {
+                    decoder_abort(decoder_p, EBADLENGTH);
+
+                    return;
+                }
+                dst_p->e = (enum oer_c_source_ah_e_e)decoder_read_int(decoder_p, enum_length);
+            }
+            else {
+                dst_p->e = (enum oer_c_source_ah_e_e)enum_length;
+            }
+        }
+
+        for (i = 0; i < unknown_addition_bits; i++) {
+            tmp_length = decoder_read_length_determinant(decoder_p);
+
+            if (decoder_free(decoder_p, tmp_length) < 0) {
+
+                return;
+            }
+        }
+    }
+    else {
+        dst_p->is_d_addition_present = false;
+        dst_p->is_e_addition_present = false;
+    }
+}
+
+static void oer_c_source_ah_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 1u);
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        decoder_skip_additions(decoder_p);
+    }
+}
+
+static void oer_c_source_af_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_af_t *src_p)
+{
+    uint8_t present_mask[1];
+    uint8_t addition_mask[2];
+
+    if(src_p->is_b_addition_present || src_p->is_e_addition_present || src_p->is_f_addition_present ||
+       src_p->is_g_addition_present || src_p->is_h_addition_present || src_p->is_i_addition_present ||
+       src_p->is_j_addition_present || src_p->is_k_addition_present || src_p->is_l_addition_present) {
+        present_mask[0] = 0x80;
+    }
+    else {
+        present_mask[0] = 0x0;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_bool(encoder_p, src_p->a);
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        encoder_append_length_determinant(encoder_p, 3);
+        encoder_append_uint8(encoder_p, 7);
+        addition_mask[0] = 0;
+        addition_mask[1] = 0;
+
+        if (src_p->is_b_addition_present) {
+            addition_mask[0] |= 0x80u;
+        }
+
+        if (src_p->is_e_addition_present) {
+            addition_mask[0] |= 0x40u;
+        }
+
+        if (src_p->is_f_addition_present) {
+            addition_mask[0] |= 0x20u;
+        }
+
+        if (src_p->is_g_addition_present) {
+            addition_mask[0] |= 0x10u;
+        }
+
+        if (src_p->is_h_addition_present) {
+            addition_mask[0] |= 0x08u;
+        }
+
+        if (src_p->is_i_addition_present) {
+            addition_mask[0] |= 0x04u;
+        }
+
+        if (src_p->is_j_addition_present) {
+            addition_mask[0] |= 0x02u;
+        }
+
+        if (src_p->is_k_addition_present) {
+            addition_mask[0] |= 0x01u;
+        }
+
+        if (src_p->is_l_addition_present) {
+            addition_mask[1] |= 0x80u;
+        }
+        encoder_append_bytes(encoder_p,
+                             &addition_mask[0],
+                             sizeof(addition_mask));
+
+        if (src_p->is_b_addition_present) {
+            encoder_append_length_determinant(encoder_p, length_determinant_length(7u) +
+                (uint32_t)enumerated_value_length((int32_t)src_p->e) + 8u);
+            oer_c_source_ah_encode_inner(encoder_p, &src_p->b);
+        }
+
+        if (src_p->is_e_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->e);
+        }
+
+        if (src_p->is_f_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->f);
+        }
+
+        if (src_p->is_g_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->g);
+        }
+
+        if (src_p->is_h_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->h);
+        }
+
+        if (src_p->is_i_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->i);
+        }
+
+        if (src_p->is_j_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->j);
+        }
+
+        if (src_p->is_k_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->k);
+        }
+
+        if (src_p->is_l_addition_present) {
+            encoder_append_length_determinant(encoder_p, 1u);
+            encoder_append_uint8(encoder_p, src_p->l);
+        }
+    }
+}
+
+static void oer_c_source_af_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_af_t *dst_p)
+{
+    uint8_t present_mask[1];
+    uint32_t addition_length;
+    uint8_t addition_unused_bits;
+    uint32_t addition_bits;
+    uint8_t addition_mask[2];
+    uint32_t i;
+    uint8_t tmp_addition_mask;
+    uint32_t unknown_addition_bits;
+    uint8_t mask;
+    uint32_t tmp_length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->a = decoder_read_bool(decoder_p);
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        addition_length = decoder_read_length_determinant(decoder_p);
+
+        if(addition_length <= 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_length -= 1u;
+        addition_unused_bits = decoder_read_uint8(decoder_p);
+
+        if (addition_unused_bits > 7u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_bits = ((addition_length * 8u) - addition_unused_bits);
+        decoder_read_bytes(decoder_p,
+                           addition_mask,
+                           (addition_length < 2u) ? addition_length : 2u);
+
+        tmp_addition_mask = addition_mask[1];
+        mask = 0x40;
+        unknown_addition_bits = 0;
+
+        for (i = 9; i < addition_bits; i++) {
+
+            if (mask == 0u) {
+                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+
+                if (decoder_get_result(decoder_p) < 0) {
+
+                    return;
+                }
+                mask = 0x80;
+            }
+
+            if( (tmp_addition_mask & mask) == mask) {
+                unknown_addition_bits += 1u;
+            };
+            mask >>= 1;
+        }
+        dst_p->is_b_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+
+        if (dst_p->is_b_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            oer_c_source_ah_decode_inner(decoder_p, &dst_p->b);
+        }
+
+        dst_p->is_e_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+
+        if (dst_p->is_e_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->e = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_f_addition_present = ((addition_bits > 2u) && ((addition_mask[0] & 0x20u) == 0x20u));
+
+        if (dst_p->is_f_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->f = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_g_addition_present = ((addition_bits > 3u) && ((addition_mask[0] & 0x10u) == 0x10u));
+
+        if (dst_p->is_g_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->g = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_h_addition_present = ((addition_bits > 4u) && ((addition_mask[0] & 0x08u) == 0x08u));
+
+        if (dst_p->is_h_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->h = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_i_addition_present = ((addition_bits > 5u) && ((addition_mask[0] & 0x04u) == 0x04u));
+
+        if (dst_p->is_i_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->i = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_j_addition_present = ((addition_bits > 6u) && ((addition_mask[0] & 0x02u) == 0x02u));
+
+        if (dst_p->is_j_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->j = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_k_addition_present = ((addition_bits > 7u) && ((addition_mask[0] & 0x01u) == 0x01u));
+
+        if (dst_p->is_k_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->k = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_l_addition_present = ((addition_bits > 8u) && ((addition_mask[1] & 0x80u) == 0x80u));
+
+        if (dst_p->is_l_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->l = decoder_read_uint8(decoder_p);
+        }
+
+        for (i = 0; i < unknown_addition_bits; i++) {
+            tmp_length = decoder_read_length_determinant(decoder_p);
+
+            if (decoder_free(decoder_p, tmp_length) < 0) {
+
+                return;
+            }
+        }
+    }
+    else {
+        dst_p->is_b_addition_present = false;
+        dst_p->is_e_addition_present = false;
+        dst_p->is_f_addition_present = false;
+        dst_p->is_g_addition_present = false;
+        dst_p->is_h_addition_present = false;
+        dst_p->is_i_addition_present = false;
+        dst_p->is_j_addition_present = false;
+        dst_p->is_k_addition_present = false;
+        dst_p->is_l_addition_present = false;
+    }
+}
+
+static void oer_c_source_af_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_af_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t addition_length;
+    uint8_t addition_unused_bits;
+    uint32_t addition_bits;
+    uint8_t addition_mask[2];
+    uint32_t i;
+    uint8_t tmp_addition_mask;
+    uint32_t unknown_addition_bits;
+    uint8_t mask;
+    uint32_t tmp_length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((fields & OER_C_SOURCE_AF_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        addition_length = decoder_read_length_determinant(decoder_p);
+
+        if(addition_length <= 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_length -= 1u;
+        addition_unused_bits = decoder_read_uint8(decoder_p);
+
+        if (addition_unused_bits > 7u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_bits = ((addition_length * 8u) - addition_unused_bits);
+        decoder_read_bytes(decoder_p,
+                           addition_mask,
+                           (addition_length < 2u) ? addition_length : 2u);
+
+        tmp_addition_mask = addition_mask[1];
+        mask = 0x40;
+        unknown_addition_bits = 0;
+
+        for (i = 9; i < addition_bits; i++) {
+
+            if (mask == 0u) {
+                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+
+                if (decoder_get_result(decoder_p) < 0) {
+
+                    return;
+                }
+                mask = 0x80;
+            }
+
+            if( (tmp_addition_mask & mask) == mask) {
+                unknown_addition_bits += 1u;
+            };
+            mask >>= 1;
+        }
+        dst_p->is_b_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+
+        if (dst_p->is_b_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            oer_c_source_ah_decode_inner(decoder_p, &dst_p->b);
+        }
+
+        dst_p->is_e_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+
+        if (dst_p->is_e_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->e = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_f_addition_present = ((addition_bits > 2u) && ((addition_mask[0] & 0x20u) == 0x20u));
+
+        if (dst_p->is_f_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->f = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_g_addition_present = ((addition_bits > 3u) && ((addition_mask[0] & 0x10u) == 0x10u));
+
+        if (dst_p->is_g_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->g = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_h_addition_present = ((addition_bits > 4u) && ((addition_mask[0] & 0x08u) == 0x08u));
+
+        if (dst_p->is_h_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->h = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_i_addition_present = ((addition_bits > 5u) && ((addition_mask[0] & 0x04u) == 0x04u));
+
+        if (dst_p->is_i_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->i = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_j_addition_present = ((addition_bits > 6u) && ((addition_mask[0] & 0x02u) == 0x02u));
+
+        if (dst_p->is_j_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->j = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_k_addition_present = ((addition_bits > 7u) && ((addition_mask[0] & 0x01u) == 0x01u));
+
+        if (dst_p->is_k_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->k = decoder_read_uint8(decoder_p);
+        }
+
+        dst_p->is_l_addition_present = ((addition_bits > 8u) && ((addition_mask[1] & 0x80u) == 0x80u));
+
+        if (dst_p->is_l_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->l = decoder_read_uint8(decoder_p);
+        }
+
+        for (i = 0; i < unknown_addition_bits; i++) {
+            tmp_length = decoder_read_length_determinant(decoder_p);
+
+            if (decoder_free(decoder_p, tmp_length) < 0) {
+
+                return;
+            }
+        }
+    }
+    else {
+        dst_p->is_b_addition_present = false;
+        dst_p->is_e_addition_present = false;
+        dst_p->is_f_addition_present = false;
+        dst_p->is_g_addition_present = false;
+        dst_p->is_h_addition_present = false;
+        dst_p->is_i_addition_present = false;
+        dst_p->is_j_addition_present = false;
+        dst_p->is_k_addition_present = false;
+        dst_p->is_l_addition_present = false;
+    }
+}
+
+static void oer_c_source_af_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 1u);
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        decoder_skip_additions(decoder_p);
+    }
+}
+
+static void oer_c_source_ag_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ag_t *src_p)
+{
+    uint8_t present_mask[1];
+    uint8_t addition_mask[1];
+    uint8_t number_of_length_bytes;
+    uint8_t enum_length;
+
+    if(src_p->is_b_addition_present || src_p->is_c_addition_present || src_p->is_d_addition_present ||
+       src_p->is_h_addition_present || src_p->is_i_addition_present || src_p->is_j_addition_present ||
+       src_p->is_m_addition_present) {
+        present_mask[0] = 0x80;
+    }
+    else {
+        present_mask[0] = 0x0;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_bool(encoder_p, src_p->a);
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        encoder_append_length_determinant(encoder_p, 2);
+        encoder_append_uint8(encoder_p, 1);
+        addition_mask[0] = 0;
+
+        if (src_p->is_b_addition_present) {
+            addition_mask[0] |= 0x80u;
+        }
+
+        if (src_p->is_c_addition_present) {
+            addition_mask[0] |= 0x40u;
+        }
+
+        if (src_p->is_d_addition_present) {
+            addition_mask[0] |= 0x20u;
+        }
+
+        if (src_p->is_h_addition_present) {
+            addition_mask[0] |= 0x10u;
+        }
+
+        if (src_p->is_i_addition_present) {
+            addition_mask[0] |= 0x08u;
+        }
+
+        if (src_p->is_j_addition_present) {
+            addition_mask[0] |= 0x04u;
+        }
+
+        if (src_p->is_m_addition_present) {
+            addition_mask[0] |= 0x02u;
+        }
+        encoder_append_bytes(encoder_p,
+                             &addition_mask[0],
+                             sizeof(addition_mask));
+
+        if (src_p->is_b_addition_present) {
+            encoder_append_length_determinant(encoder_p, length_determinant_length(src_p->b.length) +
+                src_p->b.length);
+            encoder_append_uint8(encoder_p, src_p->b.length);
+            encoder_append_bytes(encoder_p,
+                                 &src_p->b.buf[0],
+                                 src_p->b.length);
+        }
+
+        if (src_p->is_c_addition_present) {
+            encoder_append_length_determinant(encoder_p, (uint32_t)minimum_uint_length(src_p->c.length) +
+                (uint32_t)(src_p->c.length * (1u)) + 1u);
+            number_of_length_bytes = minimum_uint_length(src_p->c.length);
+            encoder_append_uint8(encoder_p, number_of_length_bytes);
+            encoder_append_uint(encoder_p,
+                                src_p->c.length,
+                                number_of_length_bytes);
+
+            encoder_append_bool_array(encoder_p,
+                                      src_p->c.elements,
+                                      src_p->c.length);
+        }
+
+        if (src_p->is_d_addition_present) {
+            encoder_append_length_determinant(encoder_p, (uint32_t)enumerated_value_length((int32_t)src_p->d) +
+                1u);
+            enum_length = enumerated_value_length(src_p->d);
+
+            if (enum_length != 0u) {
+                encoder_append_uint8(encoder_p, 0x80u | enum_length);
+                encoder_append_int(encoder_p, (int32_t)src_p->d, enum_length);
+            }
+            else {
+                encoder_append_uint8(encoder_p, (uint8_t)src_p->d);
+            }
+        }
+
+        if (src_p->is_h_addition_present) {
+            encoder_append_length_determinant(encoder_p, 0u);
+        }
+
+        if (src_p->is_i_addition_present) {
+            encoder_append_length_determinant(encoder_p, 4u);
+            encoder_append_float(encoder_p, src_p->i);
+        }
+
+        if (src_p->is_j_addition_present) {
+            encoder_append_length_determinant(encoder_p, get_choice_j_length(src_p));
+
+            switch (src_p->j.choice) {
+
+            case oer_c_source_ag_j_choice_k_e:
+                encoder_append_uint(encoder_p, 0x80, 1);
+                encoder_append_uint16(encoder_p, src_p->j.value.k);
+                break;
+
+            case oer_c_source_ag_j_choice_l_e:
+                encoder_append_uint(encoder_p, 0x81, 1);
+                encoder_append_bool(encoder_p, src_p->j.value.l);
+                break;
+
+            default:
+                encoder_abort(encoder_p, EBADCHOICE);
+                break;
+            }
+        }
+
+        if (src_p->is_m_addition_present) {
+            encoder_append_length_determinant(encoder_p, 5u);
+            encoder_append_bytes(encoder_p,
+                                 &src_p->m.buf[0],
+                                 5);
+        }
+    }
+}
+
+static void oer_c_source_ag_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ag_t *dst_p)
+{
+    uint8_t present_mask[1];
+    uint32_t addition_length;
+    uint8_t addition_unused_bits;
+    uint32_t addition_bits;
+    uint8_t addition_mask[1];
+    uint32_t i;
+    uint8_t tmp_addition_mask;
+    uint32_t unknown_addition_bits;
+    uint8_t mask;
+    uint8_t number_of_length_bytes;
+    uint8_t enum_length;
+    uint32_t tag;
+    uint32_t tmp_length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->a = decoder_read_bool(decoder_p);
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        addition_length = decoder_read_length_determinant(decoder_p);
+
+        if(addition_length <= 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_length -= 1u;
+        addition_unused_bits = decoder_read_uint8(decoder_p);
+
+        if (addition_unused_bits > 7u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_bits = ((addition_length * 8u) - addition_unused_bits);
+        decoder_read_bytes(decoder_p,
+                           addition_mask,
+                           (addition_length < 1u) ? addition_length : 1u);
+
+        tmp_addition_mask = addition_mask[0];
+        mask = 0x01;
+        unknown_addition_bits = 0;
+
+        for (i = 7; i < addition_bits; i++) {
+
+            if (mask == 0u) {
+                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+
+                if (decoder_get_result(decoder_p) < 0) {
+
+                    return;
+                }
+                mask = 0x80;
+            }
+
+            if( (tmp_addition_mask & mask) == mask) {
+                unknown_addition_bits += 1u;
+            };
+            mask >>= 1;
+        }
+        dst_p->is_b_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+
+        if (dst_p->is_b_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->b.length = decoder_read_uint8(decoder_p);
+
+            if (dst_p->b.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->b.buf[0],
+                               dst_p->b.length);
+        }
+
+        dst_p->is_c_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+
+        if (dst_p->is_c_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            number_of_length_bytes = decoder_read_uint8(decoder_p);
+            dst_p->c.length = (uint8_t)decoder_read_uint(
+                decoder_p,
+                number_of_length_bytes);
+
+            if (dst_p->c.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bool_array(decoder_p,
+                                    dst_p->c.elements,
+                                    dst_p->c.length);
+        }
+
+        dst_p->is_d_addition_present = ((addition_bits > 2u) && ((addition_mask[0] & 0x20u) == 0x20u));
+
+        if (dst_p->is_d_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            enum_length = decoder_read_uint8(decoder_p);
+
+            if ((enum_length & 0x80u) == 0x80u) {
+                enum_length &= 0x7fu;
+
+                if ((enum_length > 3u) || (enum_length == 0u)) {
+                    decoder_abort(decoder_p, EBADLENGTH);
+
+                    return;
+                }
+                dst_p->d = (enum oer_c_source_ag_d_e)decoder_read_int(decoder_p, enum_length);
+            }
+            else {
+                dst_p->d = (enum oer_c_source_ag_d_e)enum_length;
+            }
+        }
+
+        dst_p->is_h_addition_present = ((addition_bits > 3u) && ((addition_mask[0] & 0x10u) == 0x10u));
+
+        if (dst_p->is_h_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+        }
+
+        dst_p->is_i_addition_present = ((addition_bits > 4u) && ((addition_mask[0] & 0x08u) == 0x08u));
+
+        if (dst_p->is_i_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->i = decoder_read_float(decoder_p);
+        }
+
+        dst_p->is_j_addition_present = ((addition_bits > 5u) && ((addition_mask[0] & 0x04u) == 0x04u));
+
+        if (dst_p->is_j_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            tag = decoder_read_tag(decoder_p);
+
+            switch (tag) {
+
+            case 0x80:
+                dst_p->j.choice = oer_c_source_ag_j_choice_k_e;
+                dst_p->j.value.k = decoder_read_uint16(decoder_p);
+                break;
+
+            case 0x81:
+                dst_p->j.choice = oer_c_source_ag_j_choice_l_e;
+                dst_p->j.value.l = decoder_read_bool(decoder_p);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+        }
+
+        dst_p->is_m_addition_present = ((addition_bits > 6u) && ((addition_mask[0] & 0x02u) == 0x02u));
+
+        if (dst_p->is_m_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            decoder_read_bytes(decoder_p,
+                               &dst_p->m.buf[0],
+                               5);
+        }
+
+        for (i = 0; i < unknown_addition_bits; i++) {
+            tmp_length = decoder_read_length_determinant(decoder_p);
+
+            if (decoder_free(decoder_p, tmp_length) < 0) {
+
+                return;
+            }
+        }
+    }
+    else {
+        dst_p->is_b_addition_present = false;
+        dst_p->is_c_addition_present = false;
+        dst_p->is_d_addition_present = false;
+        dst_p->is_h_addition_present = false;
+        dst_p->is_i_addition_present = false;
+        dst_p->is_j_addition_present = false;
+        dst_p->is_m_addition_present = false;
+    }
+}
+
+static void oer_c_source_ag_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ag_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t addition_length;
+    uint8_t addition_unused_bits;
+    uint32_t addition_bits;
+    uint8_t addition_mask[1];
+    uint32_t i;
+    uint8_t tmp_addition_mask;
+    uint32_t unknown_addition_bits;
+    uint8_t mask;
+    uint8_t number_of_length_bytes;
+    uint8_t enum_length;
+    uint32_t tag;
+    uint32_t tmp_length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((fields & OER_C_SOURCE_AG_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+
+    if((present_mask[0] & 0x80u) == 0x80u) {
+        addition_length = decoder_read_length_determinant(decoder_p);
+
+        if(addition_length <= 1u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_length -= 1u;
+        addition_unused_bits = decoder_read_uint8(decoder_p);
+
+        if (addition_unused_bits > 7u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        addition_bits = ((addition_length * 8u) - addition_unused_bits);
+        decoder_read_bytes(decoder_p,
+                           addition_mask,
+                           (addition_length < 1u) ? addition_length : 1u);
+
+        tmp_addition_mask = addition_mask[0];
+        mask = 0x01;
+        unknown_addition_bits = 0;
+
+        for (i = 7; i < addition_bits; i++) {
+
+            if (mask == 0u) {
+                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+
+                if (decoder_get_result(decoder_p) < 0) {
+
+                    return;
+                }
+                mask = 0x80;
+            }
+
+            if( (tmp_addition_mask & mask) == mask) {
+                unknown_addition_bits += 1u;
+            };
+            mask >>= 1;
+        }
+        dst_p->is_b_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+
+        if (dst_p->is_b_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->b.length = decoder_read_uint8(decoder_p);
+
+            if (dst_p->b.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->b.buf[0],
+                               dst_p->b.length);
+        }
+
+        dst_p->is_c_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+
+        if (dst_p->is_c_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            number_of_length_bytes = decoder_read_uint8(decoder_p);
+            dst_p->c.length = (uint8_t)decoder_read_uint(
+                decoder_p,
+                number_of_length_bytes);
+
+            if (dst_p->c.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bool_array(decoder_p,
+                                    dst_p->c.elements,
+                                    dst_p->c.length);
+        }
+
+        dst_p->is_d_addition_present = ((addition_bits > 2u) && ((addition_mask[0] & 0x20u) == 0x20u));
+
+        if (dst_p->is_d_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            enum_length = decoder_read_uint8(decoder_p);
+
+            if ((enum_length & 0x80u) == 0x80u) {
+                enum_length &= 0x7fu;
+
+                if ((enum_length > 3u) || (enum_length == 0u)) {
+                    decoder_abort(decoder_p, EBADLENGTH);
+
+                    return;
+                }
+                dst_p->d = (enum oer_c_source_ag_d_e)decoder_read_int(decoder_p, enum_length);
+            }
+            else {
+                dst_p->d = (enum oer_c_source_ag_d_e)enum_length;
+            }
+        }
+
+        dst_p->is_h_addition_present = ((addition_bits > 3u) && ((addition_mask[0] & 0x10u) == 0x10u));
+
+        if (dst_p->is_h_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+        }
+
+        dst_p->is_i_addition_present = ((addition_bits > 4u) && ((addition_mask[0] & 0x08u) == 0x08u));
+
+        if (dst_p->is_i_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            dst_p->i = decoder_read_float(decoder_p);
+        }
+
+        dst_p->is_j_addition_present = ((addition_bits > 5u) && ((addition_mask[0] & 0x04u) == 0x04u));
+
+        if (dst_p->is_j_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            tag = decoder_read_tag(decoder_p);
+
+            switch (tag) {
+
+            case 0x80:
+                dst_p->j.choice = oer_c_source_ag_j_choice_k_e;
+                dst_p->j.value.k = decoder_read_uint16(decoder_p);
+                break;
+
+            case 0x81:
+                dst_p->j.choice = oer_c_source_ag_j_choice_l_e;
+                dst_p->j.value.l = decoder_read_bool(decoder_p);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+        }
+
+        dst_p->is_m_addition_present = ((addition_bits > 6u) && ((addition_mask[0] & 0x02u) == 0x02u));
+
+        if (dst_p->is_m_addition_present) {
+            (void)decoder_read_length_determinant(decoder_p);
+            decoder_read_bytes(decoder_p,
+                               &dst_p->m.buf[0],
+                               5);
+        }
+
+        for (i = 0; i < unknown_addition_bits; i++) {
+            tmp_length = decoder_read_length_determinant(decoder_p);
+
+            if (decoder_free(decoder_p, tmp_length) < 0) {
+
+                return;
+            }
+        }
+    }
+    else {
+        dst_p->is_b_addition_present = false;
+        dst_p->is_c_addition_present = false;
+        dst_p->is_d_addition_present = false;
+        dst_p->is_h_addition_present = false;
+        dst_p->is_i_addition_present = false;
+        dst_p->is_j_addition_present = false;
+        dst_p->is_m_addition_present = false;
+    }
+}
+
+static void oer_c_source_ag_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 1u);
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        decoder_skip_additions(decoder_p);
+    }
+}
+
+static void oer_c_source_aj_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_aj_t *src_p)
+{
+    uint8_t enum_length;
+
+    enum_length = enumerated_value_length(src_p->a);
+
+    if (enum_length != 0u) {
+        encoder_append_uint8(encoder_p, 0x80u | enum_length);
+        encoder_append_int(encoder_p, (int32_t)src_p->a, enum_length);
+    }
+    else {
+        encoder_append_uint8(encoder_p, (uint8_t)src_p->a);
+    }
+}
+
+static void oer_c_source_aj_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_aj_t *dst_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        dst_p->a = (enum oer_c_source_aj_a_e)decoder_read_int(decoder_p, enum_length);
+    }
+    else {
+        dst_p->a = (enum oer_c_source_aj_a_e)enum_length;
+    }
+}
+
+static void oer_c_source_aj_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_aj_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t enum_length;
+    uint8_t enum_length_2;
+
+    if ((fields & OER_C_SOURCE_AJ_FIELD_A) != 0u) {
+        enum_length = decoder_read_uint8(decoder_p);
+
+        if ((enum_length & 0x80u) == 0x80u) {
+            enum_length &= 0x7fu;
+
+            if ((enum_length > 1u) || (enum_length == 0u)) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+            dst_p->a = (enum oer_c_source_aj_a_e)decoder_read_int(decoder_p, enum_length);
+        }
+        else {
+            dst_p->a = (enum oer_c_source_aj_a_e)enum_length;
+        }
+    } else {
+        enum_length_2 = decoder_read_uint8(decoder_p);
+
+        if ((enum_length_2 & 0x80u) == 0x80u) {
+            enum_length_2 &= 0x7fu;
+
+            if ((enum_length_2 > 1u) || (enum_length_2 == 0u)) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, enum_length_2);
+        }
+    }
+}
+
+static void oer_c_source_aj_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, enum_length);
+    }
+}
+
+static void oer_c_source_ak_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ak_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case oer_c_source_ak_choice_a_e:
+        encoder_append_uint(encoder_p, 0x80, 1);
+        oer_c_source_aj_encode_inner(encoder_p, &src_p->value.a);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_ak_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ak_t *dst_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        dst_p->choice = oer_c_source_ak_choice_a_e;
+        oer_c_source_aj_decode_inner(decoder_p, &dst_p->value.a);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_ak_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        oer_c_source_aj_skip_inner(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_ai_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ai_t *src_p)
+{
+    oer_c_source_ak_encode_inner(encoder_p, &src_p->a);
+}
+
+static void oer_c_source_ai_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ai_t *dst_p)
+{
+    oer_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+}
+
+static void oer_c_source_ai_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ai_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_AI_FIELD_A) != 0u) {
+        oer_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        oer_c_source_ak_skip_inner(decoder_p);
+    }
+}
+
+static void oer_c_source_ai_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    oer_c_source_ak_skip_inner(decoder_p);
+}
+
+static void oer_c_source_al_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_al_t *src_p)
+{
+    encoder_append_int16(encoder_p, src_p->value);
+}
+
+static void oer_c_source_al_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_al_t *dst_p)
+{
+    dst_p->value = decoder_read_int16(decoder_p);
+}
+
+static void oer_c_source_al_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void oer_c_source_am_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_am_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_c_source_am_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_am_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_c_source_am_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_an_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_an_t *src_p)
+{
+    uint8_t enum_length;
+
+    enum_length = enumerated_value_length(src_p->value);
+
+    if (enum_length != 0u) {
+        encoder_append_uint8(encoder_p, 0x80u | enum_length);
+        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
+    }
+    else {
+        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
+    }
+}
+
+static void oer_c_source_an_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_an_t *dst_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 4u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        dst_p->value = (enum oer_c_source_an_e)decoder_read_int(decoder_p, enum_length);
+    }
+    else {
+        dst_p->value = (enum oer_c_source_an_e)enum_length;
+    }
+}
+
+static void oer_c_source_an_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 4u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, enum_length);
+    }
+}
+
+static void oer_c_source_ao_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ao_t *src_p)
+{
+    encoder_append_uint(encoder_p, (uint32_t)src_p->a, 1);
+    encoder_append_uint(encoder_p, (uint32_t)src_p->b, 3);
+    encoder_append_uint(encoder_p, (uint32_t)src_p->c, 1);
+    encoder_append_uint(encoder_p, (uint32_t)src_p->d, 4);
+    encoder_append_long_uint(encoder_p, (uint64_t)src_p->e, 8);
+}
+
+static void oer_c_source_ao_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ao_t *dst_p)
+{
+    dst_p->a = (uint8_t)decoder_read_uint(decoder_p, 1);
+    dst_p->b = (uint32_t)decoder_read_uint(decoder_p, 3);
+    dst_p->b &= 0x00ffffffu;
+    dst_p->c = (uint8_t)decoder_read_uint(decoder_p, 1);
+    dst_p->d = (uint32_t)decoder_read_uint(decoder_p, 4);
+    dst_p->e = (uint64_t)decoder_read_long_uint(decoder_p, 8);
+}
+
+static void oer_c_source_ao_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ao_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_AO_FIELD_A) != 0u) {
+        dst_p->a = (uint8_t)decoder_read_uint(decoder_p, 1);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_C_SOURCE_AO_FIELD_B) != 0u) {
+        dst_p->b = (uint32_t)decoder_read_uint(decoder_p, 3);
+        dst_p->b &= 0x00ffffffu;
+    } else {
+        (void)decoder_free(decoder_p, 3u);
+    }
+    if ((fields & OER_C_SOURCE_AO_FIELD_C) != 0u) {
+        dst_p->c = (uint8_t)decoder_read_uint(decoder_p, 1);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_C_SOURCE_AO_FIELD_D) != 0u) {
+        dst_p->d = (uint32_t)decoder_read_uint(decoder_p, 4);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_C_SOURCE_AO_FIELD_E) != 0u) {
+        dst_p->e = (uint64_t)decoder_read_long_uint(decoder_p, 8);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+}
+
+static void oer_c_source_ao_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 17u);
+}
+
+static void oer_c_ref_referenced_sequence_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_ref_referenced_sequence_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->a);
+}
+
+static void oer_c_ref_referenced_sequence_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_ref_referenced_sequence_t *dst_p)
+{
+    dst_p->a = decoder_read_uint8(decoder_p);
+}
+
+static void oer_c_ref_referenced_sequence_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_REF_REFERENCED_SEQUENCE_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_c_ref_referenced_sequence_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_ref_referenced_enum_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_ref_referenced_enum_t *src_p)
+{
+    uint8_t enum_length;
+
+    enum_length = enumerated_value_length(src_p->value);
+
+    if (enum_length != 0u) {
+        encoder_append_uint8(encoder_p, 0x80u | enum_length);
+        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
+    }
+    else {
+        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
+    }
+}
+
+static void oer_c_ref_referenced_enum_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_ref_referenced_enum_t *dst_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        dst_p->value = (enum oer_c_ref_referenced_enum_e)decoder_read_int(decoder_p, enum_length);
+    }
+    else {
+        dst_p->value = (enum oer_c_ref_referenced_enum_e)enum_length;
+    }
+}
+
+static void oer_c_ref_referenced_enum_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, enum_length);
+    }
+}
+
+static void oer_c_source_ap_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ap_t *src_p)
+{
+    uint8_t present_mask[1];
+
+    present_mask[0] = 0;
+
+    if (src_p->c.value != oer_c_ref_referenced_enum_a_e) {
+        present_mask[0] |= 0x80u;
+    }
+
+    if (src_p->d != 1) {
+        present_mask[0] |= 0x40u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    oer_c_ref_referenced_sequence_encode_inner(encoder_p, &src_p->b);
+
+    if (src_p->c.value != oer_c_ref_referenced_enum_a_e) {
+        oer_c_ref_referenced_enum_encode_inner(encoder_p, &src_p->c);
+    }
+
+    if (src_p->d != 1) {
+        encoder_append_uint8(encoder_p, src_p->d);
+    }
+}
+
+static void oer_c_source_ap_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ap_t *dst_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    oer_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        oer_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        dst_p->c.value = oer_c_ref_referenced_enum_a_e;
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        dst_p->d = decoder_read_uint8(decoder_p);
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void oer_c_source_ap_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ap_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((fields & OER_C_SOURCE_AP_FIELD_B) != 0u) {
+        oer_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        if ((fields & OER_C_SOURCE_AP_FIELD_C) != 0u) {
+            oer_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
+        } else {
+            oer_c_ref_referenced_enum_skip_inner(decoder_p);
+        }
+    } else {
+        dst_p->c.value = oer_c_ref_referenced_enum_a_e;
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        if ((fields & OER_C_SOURCE_AP_FIELD_D) != 0u) {
+            dst_p->d = decoder_read_uint8(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void oer_c_source_ap_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 1u);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        oer_c_ref_referenced_enum_skip_inner(decoder_p);
+    }
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_c_source_aq_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_aq_t *src_p)
+{
+    encoder_append_uint32(encoder_p, src_p->value);
+}
+
+static void oer_c_source_aq_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_aq_t *dst_p)
+{
+    dst_p->value = decoder_read_uint32(decoder_p);
+}
+
+static void oer_c_source_aq_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 4u);
+}
+
+static void oer_c_source_ar_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_ar_t *src_p)
+{
+    uint8_t present_mask[1];
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    present_mask[0] = 0;
+
+    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+        (src_p->a.length != sizeof(a_default))) {
+        present_mask[0] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+        (src_p->a.length != sizeof(a_default))) {
+        encoder_append_uint8(encoder_p, src_p->a.length);
+        encoder_append_bytes(encoder_p,
+                             &src_p->a.buf[0],
+                             src_p->a.length);
+    }
+}
+
+static void oer_c_source_ar_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ar_t *dst_p)
+{
+    uint8_t present_mask[1];
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        dst_p->a.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void oer_c_source_ar_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_ar_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        if ((fields & OER_C_SOURCE_AR_FIELD_A) != 0u) {
+            dst_p->a.length = decoder_read_uint8(decoder_p);
+
+            if (dst_p->a.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->a.buf[0],
+                               dst_p->a.length);
+        } else {
+            length = decoder_read_uint8(decoder_p);
+
+            if (length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length);
+        }
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void oer_c_source_ar_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        length = decoder_read_uint8(decoder_p);
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+    }
+}
+
+static void oer_c_source_as_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_as_t *src_p)
+{
+    uint8_t present_mask[1];
+
+    present_mask[0] = 0;
+
+    if (src_p->is_a_a_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    if (src_p->a_c != true) {
+        present_mask[0] |= 0x40u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    if (src_p->is_a_a_present) {
+        encoder_append_bool(encoder_p, src_p->a_a);
+    }
+
+    switch (src_p->a_b.choice) {
+
+    case oer_c_source_as_a_b_choice_b_a_e:
+        encoder_append_uint(encoder_p, 0x80, 1);
+        encoder_append_bool(encoder_p, src_p->a_b.value.b_a);
+        break;
+
+    case oer_c_source_as_a_b_choice_b_b_e:
+        encoder_append_uint(encoder_p, 0x81, 1);
+        encoder_append_bool(encoder_p, src_p->a_b.value.b_b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+
+    if (src_p->a_c != true) {
+        encoder_append_bool(encoder_p, src_p->a_c);
+    }
+}
+
+static void oer_c_source_as_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_as_t *dst_p)
+{
+    uint8_t present_mask[1];
+    uint32_t tag;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if (dst_p->is_a_a_present) {
+        dst_p->a_a = decoder_read_bool(decoder_p);
+    }
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        dst_p->a_b.choice = oer_c_source_as_a_b_choice_b_a_e;
+        dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
+        break;
+
+    case 0x81:
+        dst_p->a_b.choice = oer_c_source_as_a_b_choice_b_b_e;
+        dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        dst_p->a_c = decoder_read_bool(decoder_p);
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void oer_c_source_as_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_as_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t tag;
+    uint32_t tag_2;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if (dst_p->is_a_a_present) {
+        if ((fields & OER_C_SOURCE_AS_FIELD_A_A) != 0u) {
+            dst_p->a_a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & OER_C_SOURCE_AS_FIELD_A_B) != 0u) {
+        tag = decoder_read_tag(decoder_p);
+
+        switch (tag) {
+
+        case 0x80:
+            dst_p->a_b.choice = oer_c_source_as_a_b_choice_b_a_e;
+            dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
+            break;
+
+        case 0x81:
+            dst_p->a_b.choice = oer_c_source_as_a_b_choice_b_b_e;
+            dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    } else {
+        tag_2 = decoder_read_tag(decoder_p);
+
+        switch (tag_2) {
+
+        case 0x80:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        case 0x81:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        if ((fields & OER_C_SOURCE_AS_FIELD_A_C) != 0u) {
+            dst_p->a_c = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void oer_c_source_as_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t tag;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x81:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_c_ref_at_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_ref_at_t *src_p)
+{
+    encoder_append_uint(encoder_p, (uint32_t)src_p->value, 1);
+}
+
+static void oer_c_ref_at_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_ref_at_t *dst_p)
+{
+    dst_p->value = (uint8_t)decoder_read_uint(decoder_p, 1);
+}
+
+static void oer_c_ref_at_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_b_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case oer_c_source_b_choice_a_e:
+        encoder_append_uint(encoder_p, 0x80, 1);
+        encoder_append_int8(encoder_p, src_p->value.a);
+        break;
+
+    case oer_c_source_b_choice_b_e:
+        encoder_append_uint(encoder_p, 0x81, 1);
+        oer_c_source_a_encode_inner(encoder_p, &src_p->value.b);
+        break;
+
+    case oer_c_source_b_choice_c_e:
+        encoder_append_uint(encoder_p, 0x82, 1);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_b_t *dst_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        dst_p->choice = oer_c_source_b_choice_a_e;
+        dst_p->value.a = decoder_read_int8(decoder_p);
+        break;
+
+    case 0x81:
+        dst_p->choice = oer_c_source_b_choice_b_e;
+        oer_c_source_a_decode_inner(decoder_p, &dst_p->value.b);
+        break;
+
+    case 0x82:
+        dst_p->choice = oer_c_source_b_choice_c_e;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x81:
+        (void)decoder_free(decoder_p, 42u);
+        break;
+
+    case 0x82:
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_programming_types_bool_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_bool_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_bool_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_bool_t *dst_p)
+{
+    dst_p->value = decoder_read_bool(decoder_p);
+}
+
+static void oer_programming_types_bool_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_c_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        oer_c_source_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void oer_c_source_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_c_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        oer_c_source_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void oer_c_source_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        oer_c_source_b_skip_inner(decoder_p);
+    }
+}
+
+static void oer_programming_types_double_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_double_t *src_p)
+{
+    encoder_append_double(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_double_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_double_t *dst_p)
+{
+    dst_p->value = decoder_read_double(decoder_p);
+}
+
+static void oer_programming_types_double_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void oer_c_source_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_e_t *src_p)
+{
+    switch (src_p->a.choice) {
+
+    case oer_c_source_e_a_choice_b_e:
+        encoder_append_uint(encoder_p, 0x80, 1);
+
+        switch (src_p->a.value.b.choice) {
+
+        case oer_c_source_e_a_b_choice_c_e:
+            encoder_append_uint(encoder_p, 0x80, 1);
+            encoder_append_bool(encoder_p, src_p->a.value.b.value.c);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_e_t *dst_p)
+{
+    uint32_t tag;
+    uint32_t tag_2;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        dst_p->a.choice = oer_c_source_e_a_choice_b_e;
+        tag_2 = decoder_read_tag(decoder_p);
+
+        switch (tag_2) {
+
+        case 0x80:
+            dst_p->a.value.b.choice = oer_c_source_e_a_b_choice_c_e;
+            dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_e_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t tag;
+    uint32_t tag_2;
+    uint32_t tag_3;
+    uint32_t tag_4;
+
+    if ((fields & OER_C_SOURCE_E_FIELD_A) != 0u) {
+        tag = decoder_read_tag(decoder_p);
+
+        switch (tag) {
+
+        case 0x80:
+            dst_p->a.choice = oer_c_source_e_a_choice_b_e;
+            tag_2 = decoder_read_tag(decoder_p);
+
+            switch (tag_2) {
+
+            case 0x80:
+                dst_p->a.value.b.choice = oer_c_source_e_a_b_choice_c_e;
+                dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    } else {
+        tag_3 = decoder_read_tag(decoder_p);
+
+        switch (tag_3) {
+
+        case 0x80:
+            tag_4 = decoder_read_tag(decoder_p);
+
+            switch (tag_4) {
+
+            case 0x80:
+                (void)decoder_free(decoder_p, 1u);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    }
+}
+
+static void oer_c_source_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+    uint32_t tag_2;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        tag_2 = decoder_read_tag(decoder_p);
+
+        switch (tag_2) {
+
+        case 0x80:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_c_source_f_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_f_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t number_of_length_bytes_2;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        number_of_length_bytes_2 = minimum_uint_length(1);
+        encoder_append_uint8(encoder_p, number_of_length_bytes_2);
+        encoder_append_uint(encoder_p,
+                            1,
+                            number_of_length_bytes_2);
+
+        encoder_append_bool_array(encoder_p,
+                                  src_p->elements[i].elements,
+                                  1u);
+    }
+}
+
+static void oer_c_source_f_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_f_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t number_of_length_bytes_2;
+    uint8_t length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length = decoder_read_uint8(decoder_p);
+
+        if ((number_of_length_bytes_2 != 1u) || (length > 1u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bool_array(decoder_p,
+                                dst_p->elements[i].elements,
+                                1u);
+    }
+}
+
+static void oer_c_source_f_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length_2;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length_2 = decoder_read_uint8(decoder_p);
+
+        if ((number_of_length_bytes_2 != 1u) || (length_2 > 1u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 1u * 1u);
+    }
+}
+
+static void oer_programming_types_float_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_float_t *src_p)
+{
+    encoder_append_float(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_float_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_float_t *dst_p)
+{
+    dst_p->value = decoder_read_float(decoder_p);
+}
+
+static void oer_programming_types_float_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 4u);
+}
+
+static void oer_c_source_g_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_g_t *src_p)
+{
+    uint8_t present_mask[2];
+
+    present_mask[0] = 0;
+    present_mask[1] = 0;
+
+    if (src_p->is_a_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    if (src_p->is_b_present) {
+        present_mask[0] |= 0x40u;
+    }
+
+    if (src_p->is_c_present) {
+        present_mask[0] |= 0x20u;
+    }
+
+    if (src_p->is_d_present) {
+        present_mask[0] |= 0x10u;
+    }
+
+    if (src_p->is_e_present) {
+        present_mask[0] |= 0x08u;
+    }
+
+    if (src_p->is_f_present) {
+        present_mask[0] |= 0x04u;
+    }
+
+    if (src_p->is_g_present) {
+        present_mask[0] |= 0x02u;
+    }
+
+    if (src_p->is_h_present) {
+        present_mask[0] |= 0x01u;
+    }
+
+    if (src_p->is_i_present) {
+        present_mask[1] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->is_b_present) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    if (src_p->is_c_present) {
+        encoder_append_bool(encoder_p, src_p->c);
+    }
+
+    if (src_p->is_d_present) {
+        encoder_append_bool(encoder_p, src_p->d);
+    }
+
+    if (src_p->is_e_present) {
+        encoder_append_bool(encoder_p, src_p->e);
+    }
+
+    if (src_p->is_f_present) {
+        encoder_append_bool(encoder_p, src_p->f);
+    }
+
+    if (src_p->is_g_present) {
+        encoder_append_bool(encoder_p, src_p->g);
+    }
+
+    if (src_p->is_h_present) {
+        encoder_append_bool(encoder_p, src_p->h);
+    }
+
+    if (src_p->is_i_present) {
+        encoder_append_bool(encoder_p, src_p->i);
+    }
+}
+
+static void oer_c_source_g_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_g_t *dst_p)
+{
+    uint8_t present_mask[2];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+    dst_p->is_b_present = ((present_mask[0] & 0x40u) == 0x40u);
+    dst_p->is_c_present = ((present_mask[0] & 0x20u) == 0x20u);
+    dst_p->is_d_present = ((present_mask[0] & 0x10u) == 0x10u);
+    dst_p->is_e_present = ((present_mask[0] & 0x08u) == 0x08u);
+    dst_p->is_f_present = ((present_mask[0] & 0x04u) == 0x04u);
+    dst_p->is_g_present = ((present_mask[0] & 0x02u) == 0x02u);
+    dst_p->is_h_present = ((present_mask[0] & 0x01u) == 0x01u);
+    dst_p->is_i_present = ((present_mask[1] & 0x80u) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_b_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_c_present) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_d_present) {
+        dst_p->d = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_e_present) {
+        dst_p->e = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_f_present) {
+        dst_p->f = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_g_present) {
+        dst_p->g = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_h_present) {
+        dst_p->h = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_i_present) {
+        dst_p->i = decoder_read_bool(decoder_p);
+    }
+}
+
+static void oer_c_source_g_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_g_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[2];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+    dst_p->is_b_present = ((present_mask[0] & 0x40u) == 0x40u);
+    dst_p->is_c_present = ((present_mask[0] & 0x20u) == 0x20u);
+    dst_p->is_d_present = ((present_mask[0] & 0x10u) == 0x10u);
+    dst_p->is_e_present = ((present_mask[0] & 0x08u) == 0x08u);
+    dst_p->is_f_present = ((present_mask[0] & 0x04u) == 0x04u);
+    dst_p->is_g_present = ((present_mask[0] & 0x02u) == 0x02u);
+    dst_p->is_h_present = ((present_mask[0] & 0x01u) == 0x01u);
+    dst_p->is_i_present = ((present_mask[1] & 0x80u) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_c_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_C) != 0u) {
+            dst_p->c = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_d_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_D) != 0u) {
+            dst_p->d = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_e_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_E) != 0u) {
+            dst_p->e = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_f_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_F) != 0u) {
+            dst_p->f = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_g_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_G) != 0u) {
+            dst_p->g = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_h_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_H) != 0u) {
+            dst_p->h = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_i_present) {
+        if ((fields & OER_C_SOURCE_G_FIELD_I) != 0u) {
+            dst_p->i = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+}
+
+static void oer_c_source_g_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[2];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x20u) == 0x20u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x10u) == 0x10u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x08u) == 0x08u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x04u) == 0x04u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x02u) == 0x02u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x01u) == 0x01u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[1] & 0x80u) == 0x80u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_c_source_h_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_h_t *src_p)
+{
+    (void)encoder_p;
+    (void)src_p;
+}
+
+static void oer_c_source_h_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_h_t *dst_p)
+{
+    (void)decoder_p;
+    (void)dst_p;
+}
+
+static void oer_c_source_h_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
+static void oer_c_source_i_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_i_t *src_p)
+{
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         24);
+}
+
+static void oer_c_source_i_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_i_t *dst_p)
+{
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       24);
+}
+
+static void oer_c_source_i_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 24u);
+}
+
+static void oer_programming_types_int16_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_int16_t *src_p)
+{
+    encoder_append_int16(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_int16_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_int16_t *dst_p)
+{
+    dst_p->value = decoder_read_int16(decoder_p);
+}
+
+static void oer_programming_types_int16_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void oer_programming_types_int32_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_int32_t *src_p)
+{
+    encoder_append_int32(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_int32_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_int32_t *dst_p)
+{
+    dst_p->value = decoder_read_int32(decoder_p);
+}
+
+static void oer_programming_types_int32_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 4u);
+}
+
+static void oer_programming_types_int64_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_int64_t *src_p)
+{
+    encoder_append_int64(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_int64_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_int64_t *dst_p)
+{
+    dst_p->value = decoder_read_int64(decoder_p);
+}
+
+static void oer_programming_types_int64_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void oer_programming_types_int8_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_int8_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_int8_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_int8_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_programming_types_int8_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_j_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_j_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->length);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void oer_c_source_j_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_j_t *dst_p)
+{
+    dst_p->length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->length > 23u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void oer_c_source_j_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 23u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+}
+
+static void oer_c_source_k_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_k_t *src_p)
+{
+    uint8_t enum_length;
+
+    enum_length = enumerated_value_length(src_p->value);
+
+    if (enum_length != 0u) {
+        encoder_append_uint8(encoder_p, 0x80u | enum_length);
+        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
+    }
+    else {
+        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
+    }
+}
+
+static void oer_c_source_k_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_k_t *dst_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+        dst_p->value = (enum oer_c_source_k_e)decoder_read_int(decoder_p, enum_length);
+    }
+    else {
+        dst_p->value = (enum oer_c_source_k_e)enum_length;
+    }
+}
+
+static void oer_c_source_k_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t enum_length;
+
+    enum_length = decoder_read_uint8(decoder_p);
+
+    if ((enum_length & 0x80u) == 0x80u) {
+        enum_length &= 0x7fu;
+
+        if ((enum_length > 1u) || (enum_length == 0u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, enum_length);
+    }
+}
+
+static void oer_c_source_l_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_l_t *src_p)
+{
+    encoder_append_length_determinant(encoder_p, src_p->length);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void oer_c_source_l_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_l_t *dst_p)
+{
+    dst_p->length = decoder_read_length_determinant(decoder_p);
+
+    if (dst_p->length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void oer_c_source_l_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = decoder_read_length_determinant(decoder_p);
+
+    if (length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+}
+
+static void oer_c_source_o_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_o_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    encoder_append_bool_array(encoder_p,
+                              src_p->elements,
+                              src_p->length);
+}
+
+static void oer_c_source_o_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_o_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bool_array(decoder_p,
+                            dst_p->elements,
+                            dst_p->length);
+}
+
+static void oer_c_source_o_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 1u);
+}
+
+static void oer_c_source_n_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_n_t *src_p)
+{
+    oer_c_source_k_encode_inner(encoder_p, &src_p->a);
+    oer_c_source_a_encode_inner(encoder_p, &src_p->b);
+    oer_c_source_o_encode_inner(encoder_p, &src_p->c);
+}
+
+static void oer_c_source_n_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_n_t *dst_p)
+{
+    oer_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    oer_c_source_a_decode_inner(decoder_p, &dst_p->b);
+    oer_c_source_o_decode_inner(decoder_p, &dst_p->c);
+}
+
+static void oer_c_source_n_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_n_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_N_FIELD_A) != 0u) {
+        oer_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        oer_c_source_k_skip_inner(decoder_p);
+    }
+    if ((fields & OER_C_SOURCE_N_FIELD_B) != 0u) {
+        oer_c_source_a_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        (void)decoder_free(decoder_p, 42u);
+    }
+    if ((fields & OER_C_SOURCE_N_FIELD_C) != 0u) {
+        oer_c_source_o_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        oer_c_source_o_skip_inner(decoder_p);
+    }
+}
+
+static void oer_c_source_n_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    oer_c_source_k_skip_inner(decoder_p);
+    (void)decoder_free(decoder_p, 42u);
+    oer_c_source_o_skip_inner(decoder_p);
+}
+
+static void oer_c_source_m_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_m_t *src_p)
+{
+    oer_c_source_k_encode_inner(encoder_p, &src_p->a);
+    oer_c_source_n_encode_inner(encoder_p, &src_p->b);
+}
+
+static void oer_c_source_m_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_m_t *dst_p)
+{
+    oer_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    oer_c_source_n_decode_inner(decoder_p, &dst_p->b);
+}
+
+static void oer_c_source_m_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_m_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_M_FIELD_A) != 0u) {
+        oer_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        oer_c_source_k_skip_inner(decoder_p);
+    }
+    if ((fields & OER_C_SOURCE_M_FIELD_B) != 0u) {
+        oer_c_source_n_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        oer_c_source_n_skip_inner(decoder_p);
+    }
+}
+
+static void oer_c_source_m_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    oer_c_source_k_skip_inner(decoder_p);
+    oer_c_source_n_skip_inner(decoder_p);
+}
+
+static void oer_c_source_p_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_p_t *src_p)
+{
+    oer_c_source_a_encode_inner(encoder_p, &src_p->a);
+    oer_c_source_m_encode_inner(encoder_p, &src_p->b);
+    oer_c_source_f_encode_inner(encoder_p, &src_p->c);
+}
+
+static void oer_c_source_p_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_p_t *dst_p)
+{
+    oer_c_source_a_decode_inner(decoder_p, &dst_p->a);
+    oer_c_source_m_decode_inner(decoder_p, &dst_p->b);
+    oer_c_source_f_decode_inner(decoder_p, &dst_p->c);
+}
+
+static void oer_c_source_p_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_p_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & OER_C_SOURCE_P_FIELD_A) != 0u) {
+        oer_c_source_a_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        (void)decoder_free(decoder_p, 42u);
+    }
+    if ((fields & OER_C_SOURCE_P_FIELD_B) != 0u) {
+        oer_c_source_m_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        oer_c_source_m_skip_inner(decoder_p);
+    }
+    if ((fields & OER_C_SOURCE_P_FIELD_C) != 0u) {
+        oer_c_source_f_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        oer_c_source_f_skip_inner(decoder_p);
+    }
+}
+
+static void oer_c_source_p_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 42u);
+    oer_c_source_m_skip_inner(decoder_p);
+    oer_c_source_f_skip_inner(decoder_p);
+}
+
+static void oer_c_source_r_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_r_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_c_source_r_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_r_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_c_source_r_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_ref_referenced_int_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_ref_referenced_int_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->value);
+}
+
+static void oer_c_ref_referenced_int_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_ref_referenced_int_t *dst_p)
+{
+    dst_p->value = decoder_read_uint8(decoder_p);
+}
+
+static void oer_c_ref_referenced_int_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_s_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_s_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_c_source_s_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_s_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_c_source_s_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_t_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_t_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_c_source_t_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_t_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_c_source_t_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_u_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_u_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_c_source_u_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_u_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_c_source_u_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_programming_types_uint16_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_uint16_t *src_p)
+{
+    encoder_append_uint16(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_uint16_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_uint16_t *dst_p)
+{
+    dst_p->value = decoder_read_uint16(decoder_p);
+}
+
+static void oer_programming_types_uint16_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void oer_programming_types_uint32_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_uint32_t *src_p)
+{
+    encoder_append_uint32(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_uint32_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_uint32_t *dst_p)
+{
+    dst_p->value = decoder_read_uint32(decoder_p);
+}
+
+static void oer_programming_types_uint32_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 4u);
+}
+
+static void oer_programming_types_uint64_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_uint64_t *src_p)
+{
+    encoder_append_uint64(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_uint64_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_uint64_t *dst_p)
+{
+    dst_p->value = decoder_read_uint64(decoder_p);
+}
+
+static void oer_programming_types_uint64_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void oer_programming_types_uint8_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_programming_types_uint8_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->value);
+}
+
+static void oer_programming_types_uint8_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_programming_types_uint8_t *dst_p)
+{
+    dst_p->value = decoder_read_uint8(decoder_p);
+}
+
+static void oer_programming_types_uint8_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_v_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_v_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void oer_c_source_v_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_v_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void oer_c_source_v_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_c_source_w_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_w_t *src_p)
+{
+    encoder_append_int16(encoder_p, src_p->value);
+}
+
+static void oer_c_source_w_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_w_t *dst_p)
+{
+    dst_p->value = decoder_read_int16(decoder_p);
+}
+
+static void oer_c_source_w_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void oer_c_source_x_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_x_t *src_p)
+{
+    encoder_append_int16(encoder_p, src_p->value);
+}
+
+static void oer_c_source_x_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_x_t *dst_p)
+{
+    dst_p->value = decoder_read_int16(decoder_p);
+}
+
+static void oer_c_source_x_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void oer_c_source_y_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_y_t *src_p)
+{
+    encoder_append_uint16(encoder_p, src_p->value);
+}
+
+static void oer_c_source_y_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_y_t *dst_p)
+{
+    dst_p->value = decoder_read_uint16(decoder_p);
+}
+
+static void oer_c_source_y_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void oer_c_source_z_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_c_source_z_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->value);
+}
+
+static void oer_c_source_z_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_c_source_z_t *dst_p)
+{
+    dst_p->value = decoder_read_bool(decoder_p);
+}
+
+static void oer_c_source_z_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+ssize_t oer_c_source_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_a_encoded_size(
+    const struct oer_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_a_decode(
+    struct oer_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_a_decode_batch(
+    struct oer_c_source_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_a_decode_fields(
+    struct oer_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ab_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ab_encoded_size(
+    const struct oer_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ab_decode(
+    struct oer_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ab_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ab_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ab_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ab_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ab_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ab_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ab_decode_batch(
+    struct oer_c_source_ab_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ab_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ab_decode_fields(
+    struct oer_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ab_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_q_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_q_encoded_size(
+    const struct oer_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_q_decode(
+    struct oer_c_source_q_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_q_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_q_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_q_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_q_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_q_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_q_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_q_decode_batch(
+    struct oer_c_source_q_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_q_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_d_encoded_size(
+    const struct oer_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_d_decode(
+    struct oer_c_source_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_d_decode_batch(
+    struct oer_c_source_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ac_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ac_encoded_size(
+    const struct oer_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ac_decode(
+    struct oer_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ac_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ac_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ac_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ac_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ac_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ac_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ac_decode_batch(
+    struct oer_c_source_ac_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ac_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ac_decode_fields(
+    struct oer_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ac_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ad_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ad_encoded_size(
+    const struct oer_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ad_decode(
+    struct oer_c_source_ad_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ad_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ad_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ad_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ad_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ad_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ad_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ad_decode_batch(
+    struct oer_c_source_ad_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ad_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ae_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ae_encoded_size(
+    const struct oer_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ae_decode(
+    struct oer_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ae_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ae_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ae_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ae_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ae_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ae_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ae_decode_batch(
+    struct oer_c_source_ae_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ae_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ae_decode_fields(
+    struct oer_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ae_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ah_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ah_encoded_size(
+    const struct oer_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ah_decode(
+    struct oer_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ah_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ah_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ah_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ah_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ah_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ah_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ah_decode_batch(
+    struct oer_c_source_ah_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ah_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ah_decode_fields(
+    struct oer_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ah_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_af_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_af_encoded_size(
+    const struct oer_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_af_decode(
+    struct oer_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_af_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_af_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_af_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_af_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_af_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_af_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_af_decode_batch(
+    struct oer_c_source_af_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_af_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_af_decode_fields(
+    struct oer_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_af_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ag_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ag_encoded_size(
+    const struct oer_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ag_decode(
+    struct oer_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ag_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ag_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ag_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ag_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ag_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ag_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ag_decode_batch(
+    struct oer_c_source_ag_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ag_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ag_decode_fields(
+    struct oer_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ag_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_aj_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_aj_encoded_size(
+    const struct oer_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_aj_decode(
+    struct oer_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_aj_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_aj_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_aj_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_aj_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aj_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_aj_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_aj_decode_batch(
+    struct oer_c_source_aj_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_aj_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_aj_decode_fields(
+    struct oer_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_aj_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ak_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ak_encoded_size(
+    const struct oer_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ak_decode(
+    struct oer_c_source_ak_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ak_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ak_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ak_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ak_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ak_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ak_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ak_decode_batch(
+    struct oer_c_source_ak_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ak_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ai_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ai_encoded_size(
+    const struct oer_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_ai_decode(
+    struct oer_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ai_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ai_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ai_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ai_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ai_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ai_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ai_decode_batch(
+    struct oer_c_source_ai_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ai_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ai_decode_fields(
+    struct oer_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ai_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_al_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_al_encoded_size(
+    const struct oer_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_al_decode(
+    struct oer_c_source_al_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_al_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_al_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_al_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_al_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_al_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_al_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_al_decode_batch(
+    struct oer_c_source_al_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_al_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_am_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_am_encoded_size(
+    const struct oer_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_am_decode(
+    struct oer_c_source_am_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_am_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_am_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_am_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_am_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_am_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_am_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_am_decode_batch(
+    struct oer_c_source_am_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-            encoder_append_bytes(encoder_p,
-                                 &present_mask_3[0],
-                                 sizeof(present_mask_3));
+    pos = 0;
 
-            encoder_append_bytes(encoder_p,
-                                 &src_p->elements[i].m.p.q.buf[0],
-                                 5);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_am_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-            if (src_p->elements[i].m.p.is_r_present) {
-                encoder_append_bool(encoder_p, src_p->elements[i].m.p.r);
-            }
+        if (res < 0) {
+            return (res);
         }
 
-        if (src_p->elements[i].m.s != false) {
-            encoder_append_bool(encoder_p, src_p->elements[i].m.s);
-        }
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_d_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_d_t *dst_p)
+ssize_t oer_c_source_an_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_an_t *src_p)
 {
-    uint8_t number_of_length_bytes;
-    uint8_t i;
-    uint32_t tag;
-    uint8_t number_of_length_bytes_2;
-    uint8_t i_2;
-    uint8_t present_mask[1];
-    uint8_t enum_length;
-    uint8_t present_mask_2[1];
-    uint8_t present_mask_3[1];
+    struct encoder_t encoder;
 
-    number_of_length_bytes = decoder_read_uint8(decoder_p);
-    dst_p->length = (uint8_t)decoder_read_uint(
-        decoder_p,
-        number_of_length_bytes);
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_an_encode_inner(&encoder, src_p);
 
-    if (dst_p->length > 10u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    return (encoder_get_result(&encoder));
+}
 
-        return;
-    }
+ssize_t oer_c_source_an_encoded_size(
+    const struct oer_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
 
-    for (i = 0; i < dst_p->length; i++) {
-        tag = decoder_read_tag(decoder_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_an_encode_inner(&encoder, src_p);
 
-        switch (tag) {
+    return (encoder_get_result(&encoder));
+}
 
-        case 0x80:
-            dst_p->elements[i].a.b.choice = oer_c_source_d_a_b_choice_c_e;
-            dst_p->elements[i].a.b.value.c = decoder_read_uint8(decoder_p);
-            break;
+ssize_t oer_c_source_an_decode(
+    struct oer_c_source_an_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        case 0x81:
-            dst_p->elements[i].a.b.choice = oer_c_source_d_a_b_choice_d_e;
-            dst_p->elements[i].a.b.value.d = decoder_read_bool(decoder_p);
-            break;
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_an_decode_inner(&decoder, dst_p);
 
-        default:
-            decoder_abort(decoder_p, EBADCHOICE);
-            break;
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
-        dst_p->elements[i].a.e.length = (uint8_t)decoder_read_uint(
-            decoder_p,
-            number_of_length_bytes_2);
+ssize_t oer_c_source_an_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (dst_p->elements[i].a.e.length > 4u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_an_skip_inner(&decoder);
 
-            return;
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        for (i_2 = 0; i_2 < dst_p->elements[i].a.e.length; i_2++) {
+ssize_t oer_c_source_an_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_an_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_an_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        decoder_read_bytes(decoder_p,
-                           &present_mask[0],
-                           sizeof(present_mask));
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        if ((present_mask[0] & 0x80u) == 0x80u) {
-            enum_length = decoder_read_uint8(decoder_p);
+    return ((ssize_t)pos);
+}
 
-            if ((enum_length & 0x80u) == 0x80u) {
-                enum_length &= 0x7fu;
+ssize_t oer_c_source_an_decode_batch(
+    struct oer_c_source_an_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-                if ((enum_length > 2u) || (enum_length == 0u)) {
-                    decoder_abort(decoder_p, EBADLENGTH);
+    pos = 0;
 
-                    return;
-                }
-                dst_p->elements[i].g.h = (enum oer_c_source_d_g_h_e)decoder_read_int(decoder_p, enum_length);
-            }
-            else {
-                dst_p->elements[i].g.h = (enum oer_c_source_d_g_h_e)enum_length;
-            }
-        } else {
-            dst_p->elements[i].g.h = oer_c_source_d_g_h_j_e;
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_an_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        dst_p->elements[i].g.l.length = decoder_read_uint8(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        if (dst_p->elements[i].g.l.length > 2u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    return ((ssize_t)pos);
+}
 
-            return;
-        }
+ssize_t oer_c_source_ao_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
 
-        decoder_read_bytes(decoder_p,
-                           &dst_p->elements[i].g.l.buf[0],
-                           dst_p->elements[i].g.l.length);
-        decoder_read_bytes(decoder_p,
-                           &present_mask_2[0],
-                           sizeof(present_mask_2));
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ao_encode_inner(&encoder, src_p);
 
-        dst_p->elements[i].m.is_n_present = ((present_mask_2[0] & 0x80u) == 0x80u);
-        dst_p->elements[i].m.is_p_present = ((present_mask_2[0] & 0x20u) == 0x20u);
+    return (encoder_get_result(&encoder));
+}
 
-        if (dst_p->elements[i].m.is_n_present) {
-            dst_p->elements[i].m.n = decoder_read_bool(decoder_p);
-        }
+ssize_t oer_c_source_ao_encoded_size(
+    const struct oer_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
 
-        if ((present_mask_2[0] & 0x40u) == 0x40u) {
-            dst_p->elements[i].m.o = decoder_read_int8(decoder_p);
-        } else {
-            dst_p->elements[i].m.o = 3;
-        }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ao_encode_inner(&encoder, src_p);
 
-        if (dst_p->elements[i].m.is_p_present) {
-            decoder_read_bytes(decoder_p,
-                               &present_mask_3[0],
-                               sizeof(present_mask_3));
+    return (encoder_get_result(&encoder));
+}
 
-            dst_p->elements[i].m.p.is_r_present = ((present_mask_3[0] & 0x80u) == 0x80u);
+ssize_t oer_c_source_ao_decode(
+    struct oer_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            decoder_read_bytes(decoder_p,
-                               &dst_p->elements[i].m.p.q.buf[0],
-                               5);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ao_decode_inner(&decoder, dst_p);
 
-            if (dst_p->elements[i].m.p.is_r_present) {
-                dst_p->elements[i].m.p.r = decoder_read_bool(decoder_p);
-            }
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ao_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ao_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_ao_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ao_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ao_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        if ((present_mask_2[0] & 0x10u) == 0x10u) {
-            dst_p->elements[i].m.s = decoder_read_bool(decoder_p);
-        } else {
-            dst_p->elements[i].m.s = false;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_ao_decode_batch(
+    struct oer_c_source_ao_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ao_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ac_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ac_t *src_p)
+ssize_t oer_c_source_ao_decode_fields(
+    struct oer_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    oer_c_source_q_encode_inner(encoder_p, &src_p->a);
-    oer_c_source_d_encode_inner(encoder_p, &src_p->b);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ao_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_ref_referenced_sequence_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_sequence_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_ref_referenced_sequence_encoded_size(
+    const struct oer_c_ref_referenced_sequence_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_ac_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ac_t *dst_p)
+ssize_t oer_c_ref_referenced_sequence_decode(
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    oer_c_source_q_decode_inner(decoder_p, &dst_p->a);
-    oer_c_source_d_decode_inner(decoder_p, &dst_p->b);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_referenced_sequence_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_ad_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ad_t *src_p)
+ssize_t oer_c_ref_referenced_sequence_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t enum_length;
+    struct decoder_t decoder;
 
-    enum_length = enumerated_value_length(src_p->value);
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_referenced_sequence_skip_inner(&decoder);
 
-    if (enum_length != 0u) {
-        encoder_append_uint8(encoder_p, 0x80u | enum_length);
-        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
-    }
-    else {
-        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_ad_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ad_t *dst_p)
+ssize_t oer_c_ref_referenced_sequence_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_sequence_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t enum_length;
-
-    enum_length = decoder_read_uint8(decoder_p);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if ((enum_length & 0x80u) == 0x80u) {
-        enum_length &= 0x7fu;
+    pos = 0;
 
-        if ((enum_length > 1u) || (enum_length == 0u)) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_ref_referenced_sequence_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-            return;
+        if (res < 0) {
+            return (res);
         }
-        dst_p->value = (enum oer_c_source_ad_e)decoder_read_int(decoder_p, enum_length);
-    }
-    else {
-        dst_p->value = (enum oer_c_source_ad_e)enum_length;
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ae_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ae_t *src_p)
+ssize_t oer_c_ref_referenced_sequence_decode_batch(
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t present_mask[1];
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    present_mask[0] = 0;
+    pos = 0;
 
-    if (src_p->is_a_present) {
-        present_mask[0] |= 0x40u;
-    }
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_ref_referenced_sequence_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    if (src_p->b != true) {
-        present_mask[0] |= 0x20u;
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    return ((ssize_t)pos);
+}
 
-    if (src_p->is_a_present) {
-        encoder_append_bool(encoder_p, src_p->a);
-    }
+ssize_t oer_c_ref_referenced_sequence_decode_fields(
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
 
-    if (src_p->b != true) {
-        encoder_append_bool(encoder_p, src_p->b);
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_referenced_sequence_decode_fields_inner(&decoder, dst_p, fields);
 
-    encoder_append_bool(encoder_p, src_p->c);
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_ae_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ae_t *dst_p)
+ssize_t oer_c_ref_referenced_enum_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_enum_t *src_p)
 {
-    uint8_t present_mask[1];
+    struct encoder_t encoder;
 
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
+    encoder_init(&encoder, dst_p, size);
+    oer_c_ref_referenced_enum_encode_inner(&encoder, src_p);
 
-    dst_p->is_a_present = ((present_mask[0] & 0x40u) == 0x40u);
+    return (encoder_get_result(&encoder));
+}
 
-    if (dst_p->is_a_present) {
-        dst_p->a = decoder_read_bool(decoder_p);
-    }
+ssize_t oer_c_ref_referenced_enum_encoded_size(
+    const struct oer_c_ref_referenced_enum_t *src_p)
+{
+    struct encoder_t encoder;
 
-    if ((present_mask[0] & 0x20u) == 0x20u) {
-        dst_p->b = decoder_read_bool(decoder_p);
-    } else {
-        dst_p->b = true;
-    }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_ref_referenced_enum_encode_inner(&encoder, src_p);
 
-    dst_p->c = decoder_read_bool(decoder_p);
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_ah_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ah_t *src_p)
+ssize_t oer_c_ref_referenced_enum_decode(
+    struct oer_c_ref_referenced_enum_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t present_mask[1];
-    uint8_t addition_mask[1];
-    uint8_t enum_length;
+    struct decoder_t decoder;
 
-    if(src_p->is_d_addition_present || src_p->is_e_addition_present) {
-        present_mask[0] = 0x80;
-    }
-    else {
-        present_mask[0] = 0x0;
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_referenced_enum_decode_inner(&decoder, dst_p);
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    return (decoder_get_result(&decoder));
+}
 
-    encoder_append_bool(encoder_p, src_p->c);
+ssize_t oer_c_ref_referenced_enum_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    if((present_mask[0] & 0x80u) == 0x80u) {
-        encoder_append_length_determinant(encoder_p, 2);
-        encoder_append_uint8(encoder_p, 6);
-        addition_mask[0] = 0;
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_referenced_enum_skip_inner(&decoder);
 
-        if (src_p->is_d_addition_present) {
-            addition_mask[0] |= 0x80u;
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        if (src_p->is_e_addition_present) {
-            addition_mask[0] |= 0x40u;
-        }
-        encoder_append_bytes(encoder_p,
-                             &addition_mask[0],
-                             sizeof(addition_mask));
+ssize_t oer_c_ref_referenced_enum_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_enum_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        if (src_p->is_d_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->d);
-        }
+    pos = 0;
 
-        if (src_p->is_e_addition_present) {
-            encoder_append_length_determinant(encoder_p, (uint32_t)enumerated_value_length((int32_t)src_p->e) +
-                1u);
-            enum_length = enumerated_value_length(src_p->e);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_ref_referenced_enum_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-            if (enum_length != 0u) {
-                encoder_append_uint8(encoder_p, 0x80u | enum_length);
-                encoder_append_int(encoder_p, (int32_t)src_p->e, enum_length);
-            }
-            else {
-                encoder_append_uint8(encoder_p, (uint8_t)src_p->e);
-            }
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ah_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ah_t *dst_p)
+ssize_t oer_c_ref_referenced_enum_decode_batch(
+    struct oer_c_ref_referenced_enum_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t present_mask[1];
-    uint32_t addition_length;
-    uint8_t addition_unused_bits;
-    uint32_t addition_bits;
-    uint8_t addition_mask[1];
-    uint32_t i;
-    uint8_t tmp_addition_mask;
-    uint32_t unknown_addition_bits;
-    uint8_t mask;
-    uint8_t enum_length;
-    uint32_t tmp_length;
-
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
-
-    dst_p->c = decoder_read_bool(decoder_p);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if((present_mask[0] & 0x80u) == 0x80u) {
-        addition_length = decoder_read_length_determinant(decoder_p);
+    pos = 0;
 
-        if(addition_length <= 1u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_ref_referenced_enum_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-            return;
+        if (res < 0) {
+            return (res);
         }
-        addition_length -= 1u;
-        addition_unused_bits = decoder_read_uint8(decoder_p);
 
-        if (addition_unused_bits > 7u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-            return;
-        }
-        addition_bits = ((addition_length * 8u) - addition_unused_bits);
-        decoder_read_bytes(decoder_p,
-                           addition_mask,
-                           (addition_length < 1u) ? addition_length : 1u);
+    return ((ssize_t)pos);
+}
 
-        tmp_addition_mask = addition_mask[0];
-        mask = 0x20;
-        unknown_addition_bits = 0;
+ssize_t oer_c_source_ap_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
 
-        for (i = 2; i < addition_bits; i++) {
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ap_encode_inner(&encoder, src_p);
 
-            if (mask == 0u) {
-                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+    return (encoder_get_result(&encoder));
+}
 
-                if (decoder_get_result(decoder_p) < 0) {
+ssize_t oer_c_source_ap_encoded_size(
+    const struct oer_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
 
-                    return;
-                }
-                mask = 0x80;
-            }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
 
-            if( (tmp_addition_mask & mask) == mask) {
-                unknown_addition_bits += 1u;
-            };
-            mask >>= 1;
-        }
-        dst_p->is_d_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+ssize_t oer_c_source_ap_decode(
+    struct oer_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (dst_p->is_d_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->d = decoder_read_uint8(decoder_p);
-        }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ap_decode_inner(&decoder, dst_p);
 
-        dst_p->is_e_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+    return (decoder_get_result(&decoder));
+}
 
-        if (dst_p->is_e_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            enum_length = decoder_read_uint8(decoder_p);
+ssize_t oer_c_source_ap_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            if ((enum_length & 0x80u) == 0x80u) {
-                enum_length &= 0x7fu;
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ap_skip_inner(&decoder);
 
-                if ((enum_length > 1u) || (enum_length == 0u)) {
-                    decoder_abort(decoder_p, EBADLENGTH);
+    return (decoder_get_result(&decoder));
+}
 
-                    return;
-                }
-                dst_p->e = (enum oer_c_source_ah_e_e)decoder_read_int(decoder_p, enum_length);
-            }
-            else {
-                dst_p->e = (enum oer_c_source_ah_e_e)enum_length;
-            }
-        }
+ssize_t oer_c_source_ap_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ap_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        for (i = 0; i < unknown_addition_bits; i++) {
-            tmp_length = decoder_read_length_determinant(decoder_p);
+    pos = 0;
 
-            if (decoder_free(decoder_p, tmp_length) < 0) {
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ap_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-                return;
-            }
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-    else {
-        dst_p->is_d_addition_present = false;
-        dst_p->is_e_addition_present = false;
-    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_af_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_af_t *src_p)
+ssize_t oer_c_source_ap_decode_batch(
+    struct oer_c_source_ap_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t present_mask[1];
-    uint8_t addition_mask[2];
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if(src_p->is_b_addition_present || src_p->is_e_addition_present || src_p->is_f_addition_present ||
-       src_p->is_g_addition_present || src_p->is_h_addition_present || src_p->is_i_addition_present ||
-       src_p->is_j_addition_present || src_p->is_k_addition_present || src_p->is_l_addition_present) {
-        present_mask[0] = 0x80;
-    }
-    else {
-        present_mask[0] = 0x0;
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ap_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    return ((ssize_t)pos);
+}
 
-    encoder_append_bool(encoder_p, src_p->a);
+ssize_t oer_c_source_ap_decode_fields(
+    struct oer_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
 
-    if((present_mask[0] & 0x80u) == 0x80u) {
-        encoder_append_length_determinant(encoder_p, 3);
-        encoder_append_uint8(encoder_p, 7);
-        addition_mask[0] = 0;
-        addition_mask[1] = 0;
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ap_decode_fields_inner(&decoder, dst_p, fields);
 
-        if (src_p->is_b_addition_present) {
-            addition_mask[0] |= 0x80u;
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        if (src_p->is_e_addition_present) {
-            addition_mask[0] |= 0x40u;
-        }
+ssize_t oer_c_source_aq_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aq_t *src_p)
+{
+    struct encoder_t encoder;
 
-        if (src_p->is_f_addition_present) {
-            addition_mask[0] |= 0x20u;
-        }
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_aq_encode_inner(&encoder, src_p);
 
-        if (src_p->is_g_addition_present) {
-            addition_mask[0] |= 0x10u;
-        }
+    return (encoder_get_result(&encoder));
+}
 
-        if (src_p->is_h_addition_present) {
-            addition_mask[0] |= 0x08u;
-        }
+ssize_t oer_c_source_aq_encoded_size(
+    const struct oer_c_source_aq_t *src_p)
+{
+    struct encoder_t encoder;
 
-        if (src_p->is_i_addition_present) {
-            addition_mask[0] |= 0x04u;
-        }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_aq_encode_inner(&encoder, src_p);
 
-        if (src_p->is_j_addition_present) {
-            addition_mask[0] |= 0x02u;
-        }
+    return (encoder_get_result(&encoder));
+}
 
-        if (src_p->is_k_addition_present) {
-            addition_mask[0] |= 0x01u;
-        }
+ssize_t oer_c_source_aq_decode(
+    struct oer_c_source_aq_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (src_p->is_l_addition_present) {
-            addition_mask[1] |= 0x80u;
-        }
-        encoder_append_bytes(encoder_p,
-                             &addition_mask[0],
-                             sizeof(addition_mask));
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_aq_decode_inner(&decoder, dst_p);
 
-        if (src_p->is_b_addition_present) {
-            encoder_append_length_determinant(encoder_p, length_determinant_length(7u) +
-                (uint32_t)enumerated_value_length((int32_t)src_p->e) + 8u);
-            oer_c_source_ah_encode_inner(encoder_p, &src_p->b);
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        if (src_p->is_e_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->e);
-        }
+ssize_t oer_c_source_aq_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (src_p->is_f_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->f);
-        }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_aq_skip_inner(&decoder);
 
-        if (src_p->is_g_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->g);
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        if (src_p->is_h_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->h);
-        }
+ssize_t oer_c_source_aq_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aq_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        if (src_p->is_i_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->i);
-        }
+    pos = 0;
 
-        if (src_p->is_j_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->j);
-        }
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_aq_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-        if (src_p->is_k_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->k);
+        if (res < 0) {
+            return (res);
         }
 
-        if (src_p->is_l_addition_present) {
-            encoder_append_length_determinant(encoder_p, 1u);
-            encoder_append_uint8(encoder_p, src_p->l);
-        }
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_af_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_af_t *dst_p)
+ssize_t oer_c_source_aq_decode_batch(
+    struct oer_c_source_aq_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t present_mask[1];
-    uint32_t addition_length;
-    uint8_t addition_unused_bits;
-    uint32_t addition_bits;
-    uint8_t addition_mask[2];
-    uint32_t i;
-    uint8_t tmp_addition_mask;
-    uint32_t unknown_addition_bits;
-    uint8_t mask;
-    uint32_t tmp_length;
-
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
-
-    dst_p->a = decoder_read_bool(decoder_p);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if((present_mask[0] & 0x80u) == 0x80u) {
-        addition_length = decoder_read_length_determinant(decoder_p);
+    pos = 0;
 
-        if(addition_length <= 1u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_aq_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-            return;
+        if (res < 0) {
+            return (res);
         }
-        addition_length -= 1u;
-        addition_unused_bits = decoder_read_uint8(decoder_p);
-
-        if (addition_unused_bits > 7u) {
-            decoder_abort(decoder_p, EBADLENGTH);
 
-            return;
-        }
-        addition_bits = ((addition_length * 8u) - addition_unused_bits);
-        decoder_read_bytes(decoder_p,
-                           addition_mask,
-                           (addition_length < 2u) ? addition_length : 2u);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        tmp_addition_mask = addition_mask[1];
-        mask = 0x40;
-        unknown_addition_bits = 0;
+    return ((ssize_t)pos);
+}
 
-        for (i = 9; i < addition_bits; i++) {
+ssize_t oer_c_source_ar_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ar_t *src_p)
+{
+    struct encoder_t encoder;
 
-            if (mask == 0u) {
-                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_ar_encode_inner(&encoder, src_p);
 
-                if (decoder_get_result(decoder_p) < 0) {
+    return (encoder_get_result(&encoder));
+}
 
-                    return;
-                }
-                mask = 0x80;
-            }
+ssize_t oer_c_source_ar_encoded_size(
+    const struct oer_c_source_ar_t *src_p)
+{
+    struct encoder_t encoder;
 
-            if( (tmp_addition_mask & mask) == mask) {
-                unknown_addition_bits += 1u;
-            };
-            mask >>= 1;
-        }
-        dst_p->is_b_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_ar_encode_inner(&encoder, src_p);
 
-        if (dst_p->is_b_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            oer_c_source_ah_decode_inner(decoder_p, &dst_p->b);
-        }
+    return (encoder_get_result(&encoder));
+}
 
-        dst_p->is_e_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+ssize_t oer_c_source_ar_decode(
+    struct oer_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (dst_p->is_e_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->e = decoder_read_uint8(decoder_p);
-        }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ar_decode_inner(&decoder, dst_p);
 
-        dst_p->is_f_addition_present = ((addition_bits > 2u) && ((addition_mask[0] & 0x20u) == 0x20u));
+    return (decoder_get_result(&decoder));
+}
 
-        if (dst_p->is_f_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->f = decoder_read_uint8(decoder_p);
-        }
+ssize_t oer_c_source_ar_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        dst_p->is_g_addition_present = ((addition_bits > 3u) && ((addition_mask[0] & 0x10u) == 0x10u));
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ar_skip_inner(&decoder);
 
-        if (dst_p->is_g_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->g = decoder_read_uint8(decoder_p);
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        dst_p->is_h_addition_present = ((addition_bits > 4u) && ((addition_mask[0] & 0x08u) == 0x08u));
+ssize_t oer_c_source_ar_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ar_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        if (dst_p->is_h_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->h = decoder_read_uint8(decoder_p);
-        }
+    pos = 0;
 
-        dst_p->is_i_addition_present = ((addition_bits > 5u) && ((addition_mask[0] & 0x04u) == 0x04u));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_ar_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-        if (dst_p->is_i_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->i = decoder_read_uint8(decoder_p);
+        if (res < 0) {
+            return (res);
         }
 
-        dst_p->is_j_addition_present = ((addition_bits > 6u) && ((addition_mask[0] & 0x02u) == 0x02u));
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        if (dst_p->is_j_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->j = decoder_read_uint8(decoder_p);
-        }
+    return ((ssize_t)pos);
+}
 
-        dst_p->is_k_addition_present = ((addition_bits > 7u) && ((addition_mask[0] & 0x01u) == 0x01u));
+ssize_t oer_c_source_ar_decode_batch(
+    struct oer_c_source_ar_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        if (dst_p->is_k_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->k = decoder_read_uint8(decoder_p);
-        }
+    pos = 0;
 
-        dst_p->is_l_addition_present = ((addition_bits > 8u) && ((addition_mask[1] & 0x80u) == 0x80u));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_ar_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        if (dst_p->is_l_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->l = decoder_read_uint8(decoder_p);
+        if (res < 0) {
+            return (res);
         }
 
-        for (i = 0; i < unknown_addition_bits; i++) {
-            tmp_length = decoder_read_length_determinant(decoder_p);
-
-            if (decoder_free(decoder_p, tmp_length) < 0) {
-
-                return;
-            }
-        }
-    }
-    else {
-        dst_p->is_b_addition_present = false;
-        dst_p->is_e_addition_present = false;
-        dst_p->is_f_addition_present = false;
-        dst_p->is_g_addition_present = false;
-        dst_p->is_h_addition_present = false;
-        dst_p->is_i_addition_present = false;
-        dst_p->is_j_addition_present = false;
-        dst_p->is_k_addition_present = false;
-        dst_p->is_l_addition_present = false;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ag_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ag_t *src_p)
+ssize_t oer_c_source_ar_decode_fields(
+    struct oer_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    uint8_t present_mask[1];
-    uint8_t addition_mask[1];
-    uint8_t number_of_length_bytes;
-    uint8_t i_2;
-    uint8_t enum_length;
+    struct decoder_t decoder;
 
-    if(src_p->is_b_addition_present || src_p->is_c_addition_present || src_p->is_d_addition_present ||
-       src_p->is_h_addition_present || src_p->is_i_addition_present || src_p->is_j_addition_present ||
-       src_p->is_m_addition_present) {
-        present_mask[0] = 0x80;
-    }
-    else {
-        present_mask[0] = 0x0;
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_ar_decode_fields_inner(&decoder, dst_p, fields);
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    return (decoder_get_result(&decoder));
+}
 
-    encoder_append_bool(encoder_p, src_p->a);
+ssize_t oer_c_source_as_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_as_t *src_p)
+{
+    struct encoder_t encoder;
 
-    if((present_mask[0] & 0x80u) == 0x80u) {
-        encoder_append_length_determinant(encoder_p, 2);
-        encoder_append_uint8(encoder_p, 1);
-        addition_mask[0] = 0;
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_as_encode_inner(&encoder, src_p);
 
-        if (src_p->is_b_addition_present) {
-            addition_mask[0] |= 0x80u;
-        }
+    return (encoder_get_result(&encoder));
+}
 
-        if (src_p->is_c_addition_present) {
-            addition_mask[0] |= 0x40u;
-        }
+ssize_t oer_c_source_as_encoded_size(
+    const struct oer_c_source_as_t *src_p)
+{
+    struct encoder_t encoder;
 
-        if (src_p->is_d_addition_present) {
-            addition_mask[0] |= 0x20u;
-        }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_as_encode_inner(&encoder, src_p);
 
-        if (src_p->is_h_addition_present) {
-            addition_mask[0] |= 0x10u;
-        }
+    return (encoder_get_result(&encoder));
+}
 
-        if (src_p->is_i_addition_present) {
-            addition_mask[0] |= 0x08u;
-        }
+ssize_t oer_c_source_as_decode(
+    struct oer_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (src_p->is_j_addition_present) {
-            addition_mask[0] |= 0x04u;
-        }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_as_decode_inner(&decoder, dst_p);
 
-        if (src_p->is_m_addition_present) {
-            addition_mask[0] |= 0x02u;
-        }
-        encoder_append_bytes(encoder_p,
-                             &addition_mask[0],
-                             sizeof(addition_mask));
+    return (decoder_get_result(&decoder));
+}
 
-        if (src_p->is_b_addition_present) {
-            encoder_append_length_determinant(encoder_p, length_determinant_length(src_p->b.length) +
-                src_p->b.length);
-            encoder_append_uint8(encoder_p, src_p->b.length);
-            encoder_append_bytes(encoder_p,
-                                 &src_p->b.buf[0],
-                                 src_p->b.length);
-        }
+ssize_t oer_c_source_as_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        if (src_p->is_c_addition_present) {
-            encoder_append_length_determinant(encoder_p, (uint32_t)minimum_uint_length(src_p->c.length) +
-                (uint32_t)(src_p->c.length * (1u)) + 1u);
-            number_of_length_bytes = minimum_uint_length(src_p->c.length);
-            encoder_append_uint8(encoder_p, number_of_length_bytes);
-            encoder_append_uint(encoder_p,
-                                src_p->c.length,
-                                number_of_length_bytes);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_as_skip_inner(&decoder);
 
-            for (i_2 = 0; i_2 < src_p->c.length; i_2++) {
-                encoder_append_bool(encoder_p, src_p->c.elements[i_2]);
-            }
-        }
+    return (decoder_get_result(&decoder));
+}
 
-        if (src_p->is_d_addition_present) {
-            encoder_append_length_determinant(encoder_p, (uint32_t)enumerated_value_length((int32_t)src_p->d) +
-                1u);
-            enum_length = enumerated_value_length(src_p->d);
+ssize_t oer_c_source_as_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_as_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-            if (enum_length != 0u) {
-                encoder_append_uint8(encoder_p, 0x80u | enum_length);
-                encoder_append_int(encoder_p, (int32_t)src_p->d, enum_length);
-            }
-            else {
-                encoder_append_uint8(encoder_p, (uint8_t)src_p->d);
-            }
-        }
+    pos = 0;
 
-        if (src_p->is_h_addition_present) {
-            encoder_append_length_determinant(encoder_p, 0u);
-        }
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_as_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-        if (src_p->is_i_addition_present) {
-            encoder_append_length_determinant(encoder_p, 4u);
-            encoder_append_float(encoder_p, src_p->i);
+        if (res < 0) {
+            return (res);
         }
 
-        if (src_p->is_j_addition_present) {
-            encoder_append_length_determinant(encoder_p, get_choice_j_length(src_p));
-
-            switch (src_p->j.choice) {
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-            case oer_c_source_ag_j_choice_k_e:
-                encoder_append_uint(encoder_p, 0x80, 1);
-                encoder_append_uint16(encoder_p, src_p->j.value.k);
-                break;
+    return ((ssize_t)pos);
+}
 
-            case oer_c_source_ag_j_choice_l_e:
-                encoder_append_uint(encoder_p, 0x81, 1);
-                encoder_append_bool(encoder_p, src_p->j.value.l);
-                break;
+ssize_t oer_c_source_as_decode_batch(
+    struct oer_c_source_as_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-            default:
-                encoder_abort(encoder_p, EBADCHOICE);
-                break;
-            }
-        }
+    pos = 0;
 
-        if (src_p->is_m_addition_present) {
-            encoder_append_length_determinant(encoder_p, 5u);
-            encoder_append_bytes(encoder_p,
-                                 &src_p->m.buf[0],
-                                 5);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_as_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ag_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ag_t *dst_p)
+ssize_t oer_c_source_as_decode_fields(
+    struct oer_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    uint8_t present_mask[1];
-    uint32_t addition_length;
-    uint8_t addition_unused_bits;
-    uint32_t addition_bits;
-    uint8_t addition_mask[1];
-    uint32_t i;
-    uint8_t tmp_addition_mask;
-    uint32_t unknown_addition_bits;
-    uint8_t mask;
-    uint8_t number_of_length_bytes;
-    uint8_t i_2;
-    uint8_t enum_length;
-    uint32_t tag;
-    uint32_t tmp_length;
+    struct decoder_t decoder;
 
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_as_decode_fields_inner(&decoder, dst_p, fields);
 
-    dst_p->a = decoder_read_bool(decoder_p);
+    return (decoder_get_result(&decoder));
+}
 
-    if((present_mask[0] & 0x80u) == 0x80u) {
-        addition_length = decoder_read_length_determinant(decoder_p);
+ssize_t oer_c_ref_at_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_at_t *src_p)
+{
+    struct encoder_t encoder;
 
-        if(addition_length <= 1u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    encoder_init(&encoder, dst_p, size);
+    oer_c_ref_at_encode_inner(&encoder, src_p);
 
-            return;
-        }
-        addition_length -= 1u;
-        addition_unused_bits = decoder_read_uint8(decoder_p);
+    return (encoder_get_result(&encoder));
+}
 
-        if (addition_unused_bits > 7u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_c_ref_at_encoded_size(
+    const struct oer_c_ref_at_t *src_p)
+{
+    struct encoder_t encoder;
 
-            return;
-        }
-        addition_bits = ((addition_length * 8u) - addition_unused_bits);
-        decoder_read_bytes(decoder_p,
-                           addition_mask,
-                           (addition_length < 1u) ? addition_length : 1u);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_ref_at_encode_inner(&encoder, src_p);
 
-        tmp_addition_mask = addition_mask[0];
-        mask = 0x01;
-        unknown_addition_bits = 0;
+    return (encoder_get_result(&encoder));
+}
 
-        for (i = 7; i < addition_bits; i++) {
+ssize_t oer_c_ref_at_decode(
+    struct oer_c_ref_at_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            if (mask == 0u) {
-                decoder_read_bytes(decoder_p, &tmp_addition_mask, 1);
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_at_decode_inner(&decoder, dst_p);
 
-                if (decoder_get_result(decoder_p) < 0) {
+    return (decoder_get_result(&decoder));
+}
 
-                    return;
-                }
-                mask = 0x80;
-            }
+ssize_t oer_c_ref_at_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            if( (tmp_addition_mask & mask) == mask) {
-                unknown_addition_bits += 1u;
-            };
-            mask >>= 1;
-        }
-        dst_p->is_b_addition_present = ((addition_bits > 0u) && ((addition_mask[0] & 0x80u) == 0x80u));
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_at_skip_inner(&decoder);
 
-        if (dst_p->is_b_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->b.length = decoder_read_uint8(decoder_p);
+    return (decoder_get_result(&decoder));
+}
 
-            if (dst_p->b.length > 10u) {
-                decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_c_ref_at_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_at_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-                return;
-            }
+    pos = 0;
 
-            decoder_read_bytes(decoder_p,
-                               &dst_p->b.buf[0],
-                               dst_p->b.length);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_ref_at_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        dst_p->is_c_addition_present = ((addition_bits > 1u) && ((addition_mask[0] & 0x40u) == 0x40u));
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        if (dst_p->is_c_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            number_of_length_bytes = decoder_read_uint8(decoder_p);
-            dst_p->c.length = (uint8_t)decoder_read_uint(
-                decoder_p,
-                number_of_length_bytes);
+    return ((ssize_t)pos);
+}
 
-            if (dst_p->c.length > 10u) {
-                decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_c_ref_at_decode_batch(
+    struct oer_c_ref_at_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-                return;
-            }
+    pos = 0;
 
-            for (i_2 = 0; i_2 < dst_p->c.length; i_2++) {
-                dst_p->c.elements[i_2] = decoder_read_bool(decoder_p);
-            }
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_ref_at_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        dst_p->is_d_addition_present = ((addition_bits > 2u) && ((addition_mask[0] & 0x20u) == 0x20u));
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        if (dst_p->is_d_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            enum_length = decoder_read_uint8(decoder_p);
+    return ((ssize_t)pos);
+}
 
-            if ((enum_length & 0x80u) == 0x80u) {
-                enum_length &= 0x7fu;
+ssize_t oer_c_source_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
 
-                if ((enum_length > 3u) || (enum_length == 0u)) {
-                    decoder_abort(decoder_p, EBADLENGTH);
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_b_encode_inner(&encoder, src_p);
 
-                    return;
-                }
-                dst_p->d = (enum oer_c_source_ag_d_e)decoder_read_int(decoder_p, enum_length);
-            }
-            else {
-                dst_p->d = (enum oer_c_source_ag_d_e)enum_length;
-            }
-        }
+    return (encoder_get_result(&encoder));
+}
 
-        dst_p->is_h_addition_present = ((addition_bits > 3u) && ((addition_mask[0] & 0x10u) == 0x10u));
+ssize_t oer_c_source_b_encoded_size(
+    const struct oer_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
 
-        if (dst_p->is_h_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-        }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_b_encode_inner(&encoder, src_p);
 
-        dst_p->is_i_addition_present = ((addition_bits > 4u) && ((addition_mask[0] & 0x08u) == 0x08u));
+    return (encoder_get_result(&encoder));
+}
 
-        if (dst_p->is_i_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            dst_p->i = decoder_read_float(decoder_p);
-        }
+ssize_t oer_c_source_b_decode(
+    struct oer_c_source_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        dst_p->is_j_addition_present = ((addition_bits > 5u) && ((addition_mask[0] & 0x04u) == 0x04u));
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_b_decode_inner(&decoder, dst_p);
 
-        if (dst_p->is_j_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            tag = decoder_read_tag(decoder_p);
+    return (decoder_get_result(&decoder));
+}
 
-            switch (tag) {
+ssize_t oer_c_source_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            case 0x80:
-                dst_p->j.choice = oer_c_source_ag_j_choice_k_e;
-                dst_p->j.value.k = decoder_read_uint16(decoder_p);
-                break;
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_b_skip_inner(&decoder);
 
-            case 0x81:
-                dst_p->j.choice = oer_c_source_ag_j_choice_l_e;
-                dst_p->j.value.l = decoder_read_bool(decoder_p);
-                break;
+    return (decoder_get_result(&decoder));
+}
 
-            default:
-                decoder_abort(decoder_p, EBADCHOICE);
-                break;
-            }
-        }
+ssize_t oer_c_source_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        dst_p->is_m_addition_present = ((addition_bits > 6u) && ((addition_mask[0] & 0x02u) == 0x02u));
+    pos = 0;
 
-        if (dst_p->is_m_addition_present) {
-            (void)decoder_read_length_determinant(decoder_p);
-            decoder_read_bytes(decoder_p,
-                               &dst_p->m.buf[0],
-                               5);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        for (i = 0; i < unknown_addition_bits; i++) {
-            tmp_length = decoder_read_length_determinant(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-            if (decoder_free(decoder_p, tmp_length) < 0) {
+    return ((ssize_t)pos);
+}
 
-                return;
-            }
+ssize_t oer_c_source_b_decode_batch(
+    struct oer_c_source_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-    else {
-        dst_p->is_b_addition_present = false;
-        dst_p->is_c_addition_present = false;
-        dst_p->is_d_addition_present = false;
-        dst_p->is_h_addition_present = false;
-        dst_p->is_i_addition_present = false;
-        dst_p->is_j_addition_present = false;
-        dst_p->is_m_addition_present = false;
-    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_aj_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_aj_t *src_p)
+ssize_t oer_programming_types_bool_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_bool_t *src_p)
 {
-    uint8_t enum_length;
+    struct encoder_t encoder;
 
-    enum_length = enumerated_value_length(src_p->a);
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_bool_encode_inner(&encoder, src_p);
 
-    if (enum_length != 0u) {
-        encoder_append_uint8(encoder_p, 0x80u | enum_length);
-        encoder_append_int(encoder_p, (int32_t)src_p->a, enum_length);
-    }
-    else {
-        encoder_append_uint8(encoder_p, (uint8_t)src_p->a);
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_aj_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_aj_t *dst_p)
+ssize_t oer_programming_types_bool_encoded_size(
+    const struct oer_programming_types_bool_t *src_p)
 {
-    uint8_t enum_length;
+    struct encoder_t encoder;
 
-    enum_length = decoder_read_uint8(decoder_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_bool_encode_inner(&encoder, src_p);
 
-    if ((enum_length & 0x80u) == 0x80u) {
-        enum_length &= 0x7fu;
+    return (encoder_get_result(&encoder));
+}
 
-        if ((enum_length > 1u) || (enum_length == 0u)) {
-            decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_programming_types_bool_decode(
+    struct oer_programming_types_bool_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            return;
-        }
-        dst_p->a = (enum oer_c_source_aj_a_e)decoder_read_int(decoder_p, enum_length);
-    }
-    else {
-        dst_p->a = (enum oer_c_source_aj_a_e)enum_length;
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_bool_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_ak_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ak_t *src_p)
+ssize_t oer_programming_types_bool_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    switch (src_p->choice) {
+    struct decoder_t decoder;
 
-    case oer_c_source_ak_choice_a_e:
-        encoder_append_uint(encoder_p, 0x80, 1);
-        oer_c_source_aj_encode_inner(encoder_p, &src_p->value.a);
-        break;
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_bool_skip_inner(&decoder);
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_ak_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ak_t *dst_p)
+ssize_t oer_programming_types_bool_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_bool_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint32_t tag;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    tag = decoder_read_tag(decoder_p);
+    pos = 0;
 
-    switch (tag) {
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_bool_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    case 0x80:
-        dst_p->choice = oer_c_source_ak_choice_a_e;
-        oer_c_source_aj_decode_inner(decoder_p, &dst_p->value.a);
-        break;
+        if (res < 0) {
+            return (res);
+        }
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-}
 
-static void oer_c_source_ai_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ai_t *src_p)
-{
-    oer_c_source_ak_encode_inner(encoder_p, &src_p->a);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ai_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ai_t *dst_p)
+ssize_t oer_programming_types_bool_decode_batch(
+    struct oer_programming_types_bool_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    oer_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_bool_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_al_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_al_t *src_p)
+ssize_t oer_c_source_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_c_t *src_p)
 {
-    encoder_append_int16(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_al_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_al_t *dst_p)
+ssize_t oer_c_source_c_encoded_size(
+    const struct oer_c_source_c_t *src_p)
 {
-    dst_p->value = decoder_read_int16(decoder_p);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_am_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_am_t *src_p)
+ssize_t oer_c_source_c_decode(
+    struct oer_c_source_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_int8(encoder_p, src_p->value);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_am_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_am_t *dst_p)
+ssize_t oer_c_source_c_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_int8(decoder_p);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_an_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_an_t *src_p)
+ssize_t oer_c_source_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t enum_length;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    enum_length = enumerated_value_length(src_p->value);
+    pos = 0;
 
-    if (enum_length != 0u) {
-        encoder_append_uint8(encoder_p, 0x80u | enum_length);
-        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
-    }
-    else {
-        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_an_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_an_t *dst_p)
+ssize_t oer_c_source_c_decode_batch(
+    struct oer_c_source_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t enum_length;
-
-    enum_length = decoder_read_uint8(decoder_p);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if ((enum_length & 0x80u) == 0x80u) {
-        enum_length &= 0x7fu;
+    pos = 0;
 
-        if ((enum_length > 4u) || (enum_length == 0u)) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-            return;
+        if (res < 0) {
+            return (res);
         }
-        dst_p->value = (enum oer_c_source_an_e)decoder_read_int(decoder_p, enum_length);
-    }
-    else {
-        dst_p->value = (enum oer_c_source_an_e)enum_length;
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-}
 
-static void oer_c_source_ao_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ao_t *src_p)
-{
-    encoder_append_uint(encoder_p, (uint32_t)src_p->a, 1);
-    encoder_append_uint(encoder_p, (uint32_t)src_p->b, 3);
-    encoder_append_uint(encoder_p, (uint32_t)src_p->c, 1);
-    encoder_append_uint(encoder_p, (uint32_t)src_p->d, 4);
-    encoder_append_long_uint(encoder_p, (uint64_t)src_p->e, 8);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ao_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ao_t *dst_p)
+ssize_t oer_programming_types_double_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_double_t *src_p)
 {
-    dst_p->a = (uint8_t)decoder_read_uint(decoder_p, 1);
-    dst_p->b = (uint32_t)decoder_read_uint(decoder_p, 3);
-    dst_p->b &= 0x00ffffffu;
-    dst_p->c = (uint8_t)decoder_read_uint(decoder_p, 1);
-    dst_p->d = (uint32_t)decoder_read_uint(decoder_p, 4);
-    dst_p->e = (uint64_t)decoder_read_long_uint(decoder_p, 8);
-}
+    struct encoder_t encoder;
 
-static void oer_c_ref_referenced_sequence_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_ref_referenced_sequence_t *src_p)
-{
-    encoder_append_uint8(encoder_p, src_p->a);
-}
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_double_encode_inner(&encoder, src_p);
 
-static void oer_c_ref_referenced_sequence_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_ref_referenced_sequence_t *dst_p)
-{
-    dst_p->a = decoder_read_uint8(decoder_p);
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_ref_referenced_enum_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_ref_referenced_enum_t *src_p)
+ssize_t oer_programming_types_double_encoded_size(
+    const struct oer_programming_types_double_t *src_p)
 {
-    uint8_t enum_length;
+    struct encoder_t encoder;
 
-    enum_length = enumerated_value_length(src_p->value);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_double_encode_inner(&encoder, src_p);
 
-    if (enum_length != 0u) {
-        encoder_append_uint8(encoder_p, 0x80u | enum_length);
-        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
-    }
-    else {
-        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_ref_referenced_enum_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_ref_referenced_enum_t *dst_p)
+ssize_t oer_programming_types_double_decode(
+    struct oer_programming_types_double_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t enum_length;
-
-    enum_length = decoder_read_uint8(decoder_p);
-
-    if ((enum_length & 0x80u) == 0x80u) {
-        enum_length &= 0x7fu;
+    struct decoder_t decoder;
 
-        if ((enum_length > 1u) || (enum_length == 0u)) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_double_decode_inner(&decoder, dst_p);
 
-            return;
-        }
-        dst_p->value = (enum oer_c_ref_referenced_enum_e)decoder_read_int(decoder_p, enum_length);
-    }
-    else {
-        dst_p->value = (enum oer_c_ref_referenced_enum_e)enum_length;
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_ap_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ap_t *src_p)
+ssize_t oer_programming_types_double_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t present_mask[1];
+    struct decoder_t decoder;
 
-    present_mask[0] = 0;
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_double_skip_inner(&decoder);
 
-    if (src_p->c.value != oer_c_ref_referenced_enum_a_e) {
-        present_mask[0] |= 0x80u;
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    if (src_p->d != 1) {
-        present_mask[0] |= 0x40u;
-    }
+ssize_t oer_programming_types_double_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_double_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    pos = 0;
 
-    oer_c_ref_referenced_sequence_encode_inner(encoder_p, &src_p->b);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_double_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    if (src_p->c.value != oer_c_ref_referenced_enum_a_e) {
-        oer_c_ref_referenced_enum_encode_inner(encoder_p, &src_p->c);
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    if (src_p->d != 1) {
-        encoder_append_uint8(encoder_p, src_p->d);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_ap_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ap_t *dst_p)
+ssize_t oer_programming_types_double_decode_batch(
+    struct oer_programming_types_double_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t present_mask[1];
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
+    pos = 0;
 
-    oer_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_double_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    if ((present_mask[0] & 0x80u) == 0x80u) {
-        oer_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
-    } else {
-        dst_p->c.value = oer_c_ref_referenced_enum_a_e;
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    if ((present_mask[0] & 0x40u) == 0x40u) {
-        dst_p->d = decoder_read_uint8(decoder_p);
-    } else {
-        dst_p->d = 1;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-}
 
-static void oer_c_source_aq_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_aq_t *src_p)
-{
-    encoder_append_uint32(encoder_p, src_p->value);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_aq_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_aq_t *dst_p)
+ssize_t oer_c_source_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_e_t *src_p)
 {
-    dst_p->value = decoder_read_uint32(decoder_p);
-}
+    struct encoder_t encoder;
 
-static void oer_c_source_ar_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_ar_t *src_p)
-{
-    uint8_t present_mask[1];
-    static const uint8_t a_default[] = {0xAB, 0xCD};
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_e_encode_inner(&encoder, src_p);
 
-    present_mask[0] = 0;
+    return (encoder_get_result(&encoder));
+}
 
-    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
-        (src_p->a.length != sizeof(a_default))) {
-        present_mask[0] |= 0x80u;
-    }
+ssize_t oer_c_source_e_encoded_size(
+    const struct oer_c_source_e_t *src_p)
+{
+    struct encoder_t encoder;
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_e_encode_inner(&encoder, src_p);
 
-    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
-        (src_p->a.length != sizeof(a_default))) {
-        encoder_append_uint8(encoder_p, src_p->a.length);
-        encoder_append_bytes(encoder_p,
-                             &src_p->a.buf[0],
-                             src_p->a.length);
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_ar_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_ar_t *dst_p)
+ssize_t oer_c_source_e_decode(
+    struct oer_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t present_mask[1];
-    static const uint8_t a_default[] = {0xAB, 0xCD};
+    struct decoder_t decoder;
 
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_e_decode_inner(&decoder, dst_p);
 
-    if ((present_mask[0] & 0x80u) == 0x80u) {
-        dst_p->a.length = decoder_read_uint8(decoder_p);
+    return (decoder_get_result(&decoder));
+}
 
-        if (dst_p->a.length > 10u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_c_source_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-            return;
-        }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_e_skip_inner(&decoder);
 
-        decoder_read_bytes(decoder_p,
-                           &dst_p->a.buf[0],
-                           dst_p->a.length);
-    } else {
-        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
-        dst_p->a.length = sizeof(a_default);
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_as_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_as_t *src_p)
+ssize_t oer_c_source_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t present_mask[1];
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    present_mask[0] = 0;
+    pos = 0;
 
-    if (src_p->is_a_a_present) {
-        present_mask[0] |= 0x80u;
-    }
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    if (src_p->a_c != true) {
-        present_mask[0] |= 0x40u;
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    return ((ssize_t)pos);
+}
 
-    if (src_p->is_a_a_present) {
-        encoder_append_bool(encoder_p, src_p->a_a);
-    }
+ssize_t oer_c_source_e_decode_batch(
+    struct oer_c_source_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    switch (src_p->a_b.choice) {
+    pos = 0;
 
-    case oer_c_source_as_a_b_choice_b_a_e:
-        encoder_append_uint(encoder_p, 0x80, 1);
-        encoder_append_bool(encoder_p, src_p->a_b.value.b_a);
-        break;
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    case oer_c_source_as_a_b_choice_b_b_e:
-        encoder_append_uint(encoder_p, 0x81, 1);
-        encoder_append_bool(encoder_p, src_p->a_b.value.b_b);
-        break;
+        if (res < 0) {
+            return (res);
+        }
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    if (src_p->a_c != true) {
-        encoder_append_bool(encoder_p, src_p->a_c);
-    }
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_as_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_as_t *dst_p)
+ssize_t oer_c_source_e_decode_fields(
+    struct oer_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    uint8_t present_mask[1];
-    uint32_t tag;
-
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
+    struct decoder_t decoder;
 
-    dst_p->is_a_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_e_decode_fields_inner(&decoder, dst_p, fields);
 
-    if (dst_p->is_a_a_present) {
-        dst_p->a_a = decoder_read_bool(decoder_p);
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    tag = decoder_read_tag(decoder_p);
+ssize_t oer_c_source_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_f_t *src_p)
+{
+    struct encoder_t encoder;
 
-    switch (tag) {
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_f_encode_inner(&encoder, src_p);
 
-    case 0x80:
-        dst_p->a_b.choice = oer_c_source_as_a_b_choice_b_a_e;
-        dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
-        break;
+    return (encoder_get_result(&encoder));
+}
 
-    case 0x81:
-        dst_p->a_b.choice = oer_c_source_as_a_b_choice_b_b_e;
-        dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
-        break;
+ssize_t oer_c_source_f_encoded_size(
+    const struct oer_c_source_f_t *src_p)
+{
+    struct encoder_t encoder;
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
-    }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_f_encode_inner(&encoder, src_p);
 
-    if ((present_mask[0] & 0x40u) == 0x40u) {
-        dst_p->a_c = decoder_read_bool(decoder_p);
-    } else {
-        dst_p->a_c = true;
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_ref_at_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_ref_at_t *src_p)
+ssize_t oer_c_source_f_decode(
+    struct oer_c_source_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_uint(encoder_p, (uint32_t)src_p->value, 1);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_f_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_ref_at_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_ref_at_t *dst_p)
+ssize_t oer_c_source_f_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = (uint8_t)decoder_read_uint(decoder_p, 1);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_f_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_b_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_b_t *src_p)
+ssize_t oer_c_source_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_f_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    switch (src_p->choice) {
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    case oer_c_source_b_choice_a_e:
-        encoder_append_uint(encoder_p, 0x80, 1);
-        encoder_append_int8(encoder_p, src_p->value.a);
-        break;
+    pos = 0;
 
-    case oer_c_source_b_choice_b_e:
-        encoder_append_uint(encoder_p, 0x81, 1);
-        oer_c_source_a_encode_inner(encoder_p, &src_p->value.b);
-        break;
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_f_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    case oer_c_source_b_choice_c_e:
-        encoder_append_uint(encoder_p, 0x82, 1);
-        break;
+        if (res < 0) {
+            return (res);
+        }
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_b_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_b_t *dst_p)
+ssize_t oer_c_source_f_decode_batch(
+    struct oer_c_source_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint32_t tag;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    tag = decoder_read_tag(decoder_p);
+    pos = 0;
 
-    switch (tag) {
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_f_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    case 0x80:
-        dst_p->choice = oer_c_source_b_choice_a_e;
-        dst_p->value.a = decoder_read_int8(decoder_p);
-        break;
+        if (res < 0) {
+            return (res);
+        }
 
-    case 0x81:
-        dst_p->choice = oer_c_source_b_choice_b_e;
-        oer_c_source_a_decode_inner(decoder_p, &dst_p->value.b);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    case 0x82:
-        dst_p->choice = oer_c_source_b_choice_c_e;
-        break;
+    return ((ssize_t)pos);
+}
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
-    }
+ssize_t oer_programming_types_float_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_float_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_float_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_bool_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_bool_t *src_p)
+ssize_t oer_programming_types_float_encoded_size(
+    const struct oer_programming_types_float_t *src_p)
 {
-    encoder_append_bool(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_float_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_bool_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_bool_t *dst_p)
+ssize_t oer_programming_types_float_decode(
+    struct oer_programming_types_float_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_bool(decoder_p);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_float_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_c_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_c_t *src_p)
+ssize_t oer_programming_types_float_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t number_of_length_bytes;
-    uint8_t i;
+    struct decoder_t decoder;
 
-    number_of_length_bytes = minimum_uint_length(src_p->length);
-    encoder_append_uint8(encoder_p, number_of_length_bytes);
-    encoder_append_uint(encoder_p,
-                        src_p->length,
-                        number_of_length_bytes);
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_float_skip_inner(&decoder);
 
-    for (i = 0; i < src_p->length; i++) {
-        oer_c_source_b_encode_inner(encoder_p, &src_p->elements[i]);
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_c_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_c_t *dst_p)
+ssize_t oer_programming_types_float_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_float_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t number_of_length_bytes;
-    uint8_t i;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    number_of_length_bytes = decoder_read_uint8(decoder_p);
-    dst_p->length = (uint8_t)decoder_read_uint(
-        decoder_p,
-        number_of_length_bytes);
+    pos = 0;
 
-    if (dst_p->length > 2u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_float_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-        return;
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    for (i = 0; i < dst_p->length; i++) {
-        oer_c_source_b_decode_inner(decoder_p, &dst_p->elements[i]);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-}
-
-static void oer_programming_types_double_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_double_t *src_p)
-{
-    encoder_append_double(encoder_p, src_p->value);
-}
 
-static void oer_programming_types_double_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_double_t *dst_p)
-{
-    dst_p->value = decoder_read_double(decoder_p);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_e_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_e_t *src_p)
+ssize_t oer_programming_types_float_decode_batch(
+    struct oer_programming_types_float_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    switch (src_p->a.choice) {
-
-    case oer_c_source_e_a_choice_b_e:
-        encoder_append_uint(encoder_p, 0x80, 1);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        switch (src_p->a.value.b.choice) {
+    pos = 0;
 
-        case oer_c_source_e_a_b_choice_c_e:
-            encoder_append_uint(encoder_p, 0x80, 1);
-            encoder_append_bool(encoder_p, src_p->a.value.b.value.c);
-            break;
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_float_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        default:
-            encoder_abort(encoder_p, EBADCHOICE);
-            break;
+        if (res < 0) {
+            return (res);
         }
 
-        break;
-
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_e_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_e_t *dst_p)
+ssize_t oer_c_source_g_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_g_t *src_p)
 {
-    uint32_t tag;
-    uint32_t tag_2;
+    struct encoder_t encoder;
 
-    tag = decoder_read_tag(decoder_p);
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_g_encode_inner(&encoder, src_p);
 
-    switch (tag) {
+    return (encoder_get_result(&encoder));
+}
 
-    case 0x80:
-        dst_p->a.choice = oer_c_source_e_a_choice_b_e;
-        tag_2 = decoder_read_tag(decoder_p);
+ssize_t oer_c_source_g_encoded_size(
+    const struct oer_c_source_g_t *src_p)
+{
+    struct encoder_t encoder;
 
-        switch (tag_2) {
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_g_encode_inner(&encoder, src_p);
 
-        case 0x80:
-            dst_p->a.value.b.choice = oer_c_source_e_a_b_choice_c_e;
-            dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
-            break;
+    return (encoder_get_result(&encoder));
+}
 
-        default:
-            decoder_abort(decoder_p, EBADCHOICE);
-            break;
-        }
+ssize_t oer_c_source_g_decode(
+    struct oer_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        break;
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_g_decode_inner(&decoder, dst_p);
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_f_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_f_t *src_p)
+ssize_t oer_c_source_g_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t number_of_length_bytes;
-    uint8_t i;
-    uint8_t number_of_length_bytes_2;
-    uint8_t i_2;
+    struct decoder_t decoder;
 
-    number_of_length_bytes = minimum_uint_length(src_p->length);
-    encoder_append_uint8(encoder_p, number_of_length_bytes);
-    encoder_append_uint(encoder_p,
-                        src_p->length,
-                        number_of_length_bytes);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_g_skip_inner(&decoder);
 
-    for (i = 0; i < src_p->length; i++) {
-        number_of_length_bytes_2 = minimum_uint_length(1);
-        encoder_append_uint8(encoder_p, number_of_length_bytes_2);
-        encoder_append_uint(encoder_p,
-                            1,
-                            number_of_length_bytes_2);
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_g_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_g_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
 
-        for (i_2 = 0; i_2 < 1u; i_2++) {
-            encoder_append_bool(encoder_p, src_p->elements[i].elements[i_2]);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_g_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_f_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_f_t *dst_p)
+ssize_t oer_c_source_g_decode_batch(
+    struct oer_c_source_g_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t number_of_length_bytes;
-    uint8_t i;
-    uint8_t number_of_length_bytes_2;
-    uint8_t i_2;
-    uint8_t length;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    number_of_length_bytes = decoder_read_uint8(decoder_p);
-    dst_p->length = (uint8_t)decoder_read_uint(
-        decoder_p,
-        number_of_length_bytes);
+    pos = 0;
 
-    if (dst_p->length > 2u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_g_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        return;
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    for (i = 0; i < dst_p->length; i++) {
-        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
-        length = decoder_read_uint8(decoder_p);
+    return ((ssize_t)pos);
+}
 
-        if ((number_of_length_bytes_2 != 1u) || (length > 1u)) {
-            decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_c_source_g_decode_fields(
+    struct oer_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
 
-            return;
-        }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_g_decode_fields_inner(&decoder, dst_p, fields);
 
-        for (i_2 = 0; i_2 < 1u; i_2++) {
-            dst_p->elements[i].elements[i_2] = decoder_read_bool(decoder_p);
-        }
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_programming_types_float_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_float_t *src_p)
+ssize_t oer_c_source_h_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_h_t *src_p)
 {
-    encoder_append_float(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_float_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_float_t *dst_p)
+ssize_t oer_c_source_h_encoded_size(
+    const struct oer_c_source_h_t *src_p)
 {
-    dst_p->value = decoder_read_float(decoder_p);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_g_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_g_t *src_p)
+ssize_t oer_c_source_h_decode(
+    struct oer_c_source_h_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t present_mask[2];
+    struct decoder_t decoder;
 
-    present_mask[0] = 0;
-    present_mask[1] = 0;
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_h_decode_inner(&decoder, dst_p);
 
-    if (src_p->is_a_present) {
-        present_mask[0] |= 0x80u;
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    if (src_p->is_b_present) {
-        present_mask[0] |= 0x40u;
-    }
+ssize_t oer_c_source_h_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    if (src_p->is_c_present) {
-        present_mask[0] |= 0x20u;
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_h_skip_inner(&decoder);
 
-    if (src_p->is_d_present) {
-        present_mask[0] |= 0x10u;
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    if (src_p->is_e_present) {
-        present_mask[0] |= 0x08u;
-    }
+ssize_t oer_c_source_h_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_h_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (src_p->is_f_present) {
-        present_mask[0] |= 0x04u;
-    }
+    pos = 0;
 
-    if (src_p->is_g_present) {
-        present_mask[0] |= 0x02u;
-    }
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_h_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    if (src_p->is_h_present) {
-        present_mask[0] |= 0x01u;
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    if (src_p->is_i_present) {
-        present_mask[1] |= 0x80u;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    encoder_append_bytes(encoder_p,
-                         &present_mask[0],
-                         sizeof(present_mask));
+    return ((ssize_t)pos);
+}
 
-    if (src_p->is_a_present) {
-        encoder_append_bool(encoder_p, src_p->a);
-    }
+ssize_t oer_c_source_h_decode_batch(
+    struct oer_c_source_h_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (src_p->is_b_present) {
-        encoder_append_bool(encoder_p, src_p->b);
-    }
+    pos = 0;
 
-    if (src_p->is_c_present) {
-        encoder_append_bool(encoder_p, src_p->c);
-    }
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_h_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    if (src_p->is_d_present) {
-        encoder_append_bool(encoder_p, src_p->d);
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    if (src_p->is_e_present) {
-        encoder_append_bool(encoder_p, src_p->e);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    if (src_p->is_f_present) {
-        encoder_append_bool(encoder_p, src_p->f);
-    }
+    return ((ssize_t)pos);
+}
 
-    if (src_p->is_g_present) {
-        encoder_append_bool(encoder_p, src_p->g);
-    }
+ssize_t oer_c_source_i_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_i_t *src_p)
+{
+    struct encoder_t encoder;
 
-    if (src_p->is_h_present) {
-        encoder_append_bool(encoder_p, src_p->h);
-    }
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_i_encode_inner(&encoder, src_p);
 
-    if (src_p->is_i_present) {
-        encoder_append_bool(encoder_p, src_p->i);
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_g_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_g_t *dst_p)
+ssize_t oer_c_source_i_encoded_size(
+    const struct oer_c_source_i_t *src_p)
 {
-    uint8_t present_mask[2];
+    struct encoder_t encoder;
 
-    decoder_read_bytes(decoder_p,
-                       &present_mask[0],
-                       sizeof(present_mask));
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_i_encode_inner(&encoder, src_p);
 
-    dst_p->is_a_present = ((present_mask[0] & 0x80u) == 0x80u);
-    dst_p->is_b_present = ((present_mask[0] & 0x40u) == 0x40u);
-    dst_p->is_c_present = ((present_mask[0] & 0x20u) == 0x20u);
-    dst_p->is_d_present = ((present_mask[0] & 0x10u) == 0x10u);
-    dst_p->is_e_present = ((present_mask[0] & 0x08u) == 0x08u);
-    dst_p->is_f_present = ((present_mask[0] & 0x04u) == 0x04u);
-    dst_p->is_g_present = ((present_mask[0] & 0x02u) == 0x02u);
-    dst_p->is_h_present = ((present_mask[0] & 0x01u) == 0x01u);
-    dst_p->is_i_present = ((present_mask[1] & 0x80u) == 0x80u);
+    return (encoder_get_result(&encoder));
+}
 
-    if (dst_p->is_a_present) {
-        dst_p->a = decoder_read_bool(decoder_p);
-    }
+ssize_t oer_c_source_i_decode(
+    struct oer_c_source_i_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    if (dst_p->is_b_present) {
-        dst_p->b = decoder_read_bool(decoder_p);
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_i_decode_inner(&decoder, dst_p);
 
-    if (dst_p->is_c_present) {
-        dst_p->c = decoder_read_bool(decoder_p);
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    if (dst_p->is_d_present) {
-        dst_p->d = decoder_read_bool(decoder_p);
-    }
+ssize_t oer_c_source_i_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    if (dst_p->is_e_present) {
-        dst_p->e = decoder_read_bool(decoder_p);
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_i_skip_inner(&decoder);
 
-    if (dst_p->is_f_present) {
-        dst_p->f = decoder_read_bool(decoder_p);
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    if (dst_p->is_g_present) {
-        dst_p->g = decoder_read_bool(decoder_p);
-    }
+ssize_t oer_c_source_i_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_i_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (dst_p->is_h_present) {
-        dst_p->h = decoder_read_bool(decoder_p);
-    }
+    pos = 0;
 
-    if (dst_p->is_i_present) {
-        dst_p->i = decoder_read_bool(decoder_p);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_i_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_h_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_h_t *src_p)
+ssize_t oer_c_source_i_decode_batch(
+    struct oer_c_source_i_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    (void)encoder_p;
-    (void)src_p;
-}
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_i_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-static void oer_c_source_h_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_h_t *dst_p)
-{
-    (void)decoder_p;
-    (void)dst_p;
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_i_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_i_t *src_p)
+ssize_t oer_programming_types_int16_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int16_t *src_p)
 {
-    encoder_append_bytes(encoder_p,
-                         &src_p->buf[0],
-                         24);
-}
+    struct encoder_t encoder;
 
-static void oer_c_source_i_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_i_t *dst_p)
-{
-    decoder_read_bytes(decoder_p,
-                       &dst_p->buf[0],
-                       24);
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_int16_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_int16_encode_inner(
-    struct encoder_t *encoder_p,
+ssize_t oer_programming_types_int16_encoded_size(
     const struct oer_programming_types_int16_t *src_p)
 {
-    encoder_append_int16(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_int16_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_int16_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_int16_t *dst_p)
+ssize_t oer_programming_types_int16_decode(
+    struct oer_programming_types_int16_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_int16(decoder_p);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int16_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_programming_types_int32_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_int32_t *src_p)
+ssize_t oer_programming_types_int16_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_int32(encoder_p, src_p->value);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int16_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_programming_types_int32_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_int32_t *dst_p)
+ssize_t oer_programming_types_int16_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int16_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->value = decoder_read_int32(decoder_p);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_int16_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_programming_types_int64_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_int64_t *src_p)
+ssize_t oer_programming_types_int16_decode_batch(
+    struct oer_programming_types_int16_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_int64(encoder_p, src_p->value);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_int16_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_programming_types_int64_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_int64_t *dst_p)
+ssize_t oer_programming_types_int32_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int32_t *src_p)
 {
-    dst_p->value = decoder_read_int64(decoder_p);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_int32_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_int8_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_int8_t *src_p)
+ssize_t oer_programming_types_int32_encoded_size(
+    const struct oer_programming_types_int32_t *src_p)
 {
-    encoder_append_int8(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_int32_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_int8_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_int8_t *dst_p)
+ssize_t oer_programming_types_int32_decode(
+    struct oer_programming_types_int32_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_int8(decoder_p);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int32_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_j_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_j_t *src_p)
+ssize_t oer_programming_types_int32_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_uint8(encoder_p, src_p->length);
-    encoder_append_bytes(encoder_p,
-                         &src_p->buf[0],
-                         src_p->length);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int32_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_j_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_j_t *dst_p)
+ssize_t oer_programming_types_int32_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int32_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->length = decoder_read_uint8(decoder_p);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (dst_p->length > 23u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    pos = 0;
 
-        return;
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_int32_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    decoder_read_bytes(decoder_p,
-                       &dst_p->buf[0],
-                       dst_p->length);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_k_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_k_t *src_p)
+ssize_t oer_programming_types_int32_decode_batch(
+    struct oer_programming_types_int32_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t enum_length;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    enum_length = enumerated_value_length(src_p->value);
+    pos = 0;
 
-    if (enum_length != 0u) {
-        encoder_append_uint8(encoder_p, 0x80u | enum_length);
-        encoder_append_int(encoder_p, (int32_t)src_p->value, enum_length);
-    }
-    else {
-        encoder_append_uint8(encoder_p, (uint8_t)src_p->value);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_int32_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_k_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_k_t *dst_p)
+ssize_t oer_programming_types_int64_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int64_t *src_p)
 {
-    uint8_t enum_length;
+    struct encoder_t encoder;
 
-    enum_length = decoder_read_uint8(decoder_p);
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_int64_encode_inner(&encoder, src_p);
 
-    if ((enum_length & 0x80u) == 0x80u) {
-        enum_length &= 0x7fu;
+    return (encoder_get_result(&encoder));
+}
 
-        if ((enum_length > 1u) || (enum_length == 0u)) {
-            decoder_abort(decoder_p, EBADLENGTH);
+ssize_t oer_programming_types_int64_encoded_size(
+    const struct oer_programming_types_int64_t *src_p)
+{
+    struct encoder_t encoder;
 
-            return;
-        }
-        dst_p->value = (enum oer_c_source_k_e)decoder_read_int(decoder_p, enum_length);
-    }
-    else {
-        dst_p->value = (enum oer_c_source_k_e)enum_length;
-    }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_int64_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_l_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_l_t *src_p)
+ssize_t oer_programming_types_int64_decode(
+    struct oer_programming_types_int64_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_length_determinant(encoder_p, src_p->length);
-    encoder_append_bytes(encoder_p,
-                         &src_p->buf[0],
-                         src_p->length);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int64_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_l_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_l_t *dst_p)
+ssize_t oer_programming_types_int64_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->length = decoder_read_length_determinant(decoder_p);
-
-    if (dst_p->length > 500u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    struct decoder_t decoder;
 
-        return;
-    }
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int64_skip_inner(&decoder);
 
-    decoder_read_bytes(decoder_p,
-                       &dst_p->buf[0],
-                       dst_p->length);
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_o_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_o_t *src_p)
+ssize_t oer_programming_types_int64_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int64_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t number_of_length_bytes;
-    uint16_t i;
-
-    number_of_length_bytes = minimum_uint_length(src_p->length);
-    encoder_append_uint8(encoder_p, number_of_length_bytes);
-    encoder_append_uint(encoder_p,
-                        src_p->length,
-                        number_of_length_bytes);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    for (i = 0; i < src_p->length; i++) {
-        encoder_append_bool(encoder_p, src_p->elements[i]);
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_int64_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_o_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_o_t *dst_p)
+ssize_t oer_programming_types_int64_decode_batch(
+    struct oer_programming_types_int64_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t number_of_length_bytes;
-    uint16_t i;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    number_of_length_bytes = decoder_read_uint8(decoder_p);
-    dst_p->length = decoder_read_uint(
-        decoder_p,
-        number_of_length_bytes);
+    pos = 0;
 
-    if (dst_p->length > 260u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_int64_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        return;
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    for (i = 0; i < dst_p->length; i++) {
-        dst_p->elements[i] = decoder_read_bool(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-}
 
-static void oer_c_source_n_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_n_t *src_p)
-{
-    oer_c_source_k_encode_inner(encoder_p, &src_p->a);
-    oer_c_source_a_encode_inner(encoder_p, &src_p->b);
-    oer_c_source_o_encode_inner(encoder_p, &src_p->c);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_n_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_n_t *dst_p)
+ssize_t oer_programming_types_int8_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int8_t *src_p)
 {
-    oer_c_source_k_decode_inner(decoder_p, &dst_p->a);
-    oer_c_source_a_decode_inner(decoder_p, &dst_p->b);
-    oer_c_source_o_decode_inner(decoder_p, &dst_p->c);
-}
+    struct encoder_t encoder;
 
-static void oer_c_source_m_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_m_t *src_p)
-{
-    oer_c_source_k_encode_inner(encoder_p, &src_p->a);
-    oer_c_source_n_encode_inner(encoder_p, &src_p->b);
-}
+    encoder_init(&encoder, dst_p, size);
+    oer_programming_types_int8_encode_inner(&encoder, src_p);
 
-static void oer_c_source_m_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_m_t *dst_p)
-{
-    oer_c_source_k_decode_inner(decoder_p, &dst_p->a);
-    oer_c_source_n_decode_inner(decoder_p, &dst_p->b);
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_p_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_p_t *src_p)
+ssize_t oer_programming_types_int8_encoded_size(
+    const struct oer_programming_types_int8_t *src_p)
 {
-    oer_c_source_a_encode_inner(encoder_p, &src_p->a);
-    oer_c_source_m_encode_inner(encoder_p, &src_p->b);
-    oer_c_source_f_encode_inner(encoder_p, &src_p->c);
-}
+    struct encoder_t encoder;
 
-static void oer_c_source_p_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_p_t *dst_p)
-{
-    oer_c_source_a_decode_inner(decoder_p, &dst_p->a);
-    oer_c_source_m_decode_inner(decoder_p, &dst_p->b);
-    oer_c_source_f_decode_inner(decoder_p, &dst_p->c);
-}
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_int8_encode_inner(&encoder, src_p);
 
-static void oer_c_source_r_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_r_t *src_p)
-{
-    encoder_append_int8(encoder_p, src_p->value);
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_r_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_r_t *dst_p)
+ssize_t oer_programming_types_int8_decode(
+    struct oer_programming_types_int8_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_int8(decoder_p);
-}
+    struct decoder_t decoder;
 
-static void oer_c_ref_referenced_int_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_ref_referenced_int_t *src_p)
-{
-    encoder_append_uint8(encoder_p, src_p->value);
-}
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int8_decode_inner(&decoder, dst_p);
 
-static void oer_c_ref_referenced_int_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_ref_referenced_int_t *dst_p)
-{
-    dst_p->value = decoder_read_uint8(decoder_p);
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_s_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_s_t *src_p)
+ssize_t oer_programming_types_int8_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_int8(encoder_p, src_p->value);
-}
+    struct decoder_t decoder;
 
-static void oer_c_source_s_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_s_t *dst_p)
-{
-    dst_p->value = decoder_read_int8(decoder_p);
-}
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_int8_skip_inner(&decoder);
 
-static void oer_c_source_t_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_t_t *src_p)
-{
-    encoder_append_int8(encoder_p, src_p->value);
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_t_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_t_t *dst_p)
+ssize_t oer_programming_types_int8_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int8_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->value = decoder_read_int8(decoder_p);
-}
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-static void oer_c_source_u_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_u_t *src_p)
-{
-    encoder_append_int8(encoder_p, src_p->value);
-}
+    pos = 0;
 
-static void oer_c_source_u_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_u_t *dst_p)
-{
-    dst_p->value = decoder_read_int8(decoder_p);
-}
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_int8_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-static void oer_programming_types_uint16_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_uint16_t *src_p)
-{
-    encoder_append_uint16(encoder_p, src_p->value);
-}
+        if (res < 0) {
+            return (res);
+        }
 
-static void oer_programming_types_uint16_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_uint16_t *dst_p)
-{
-    dst_p->value = decoder_read_uint16(decoder_p);
-}
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-static void oer_programming_types_uint32_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_uint32_t *src_p)
-{
-    encoder_append_uint32(encoder_p, src_p->value);
+    return ((ssize_t)pos);
 }
 
-static void oer_programming_types_uint32_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_uint32_t *dst_p)
+ssize_t oer_programming_types_int8_decode_batch(
+    struct oer_programming_types_int8_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    dst_p->value = decoder_read_uint32(decoder_p);
-}
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-static void oer_programming_types_uint64_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_uint64_t *src_p)
-{
-    encoder_append_uint64(encoder_p, src_p->value);
-}
+    pos = 0;
 
-static void oer_programming_types_uint64_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_uint64_t *dst_p)
-{
-    dst_p->value = decoder_read_uint64(decoder_p);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_int8_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_programming_types_uint8_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_programming_types_uint8_t *src_p)
+ssize_t oer_c_source_j_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_j_t *src_p)
 {
-    encoder_append_uint8(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_programming_types_uint8_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_programming_types_uint8_t *dst_p)
+ssize_t oer_c_source_j_encoded_size(
+    const struct oer_c_source_j_t *src_p)
 {
-    dst_p->value = decoder_read_uint8(decoder_p);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_v_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_v_t *src_p)
+ssize_t oer_c_source_j_decode(
+    struct oer_c_source_j_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_int8(encoder_p, src_p->value);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_j_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_v_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_v_t *dst_p)
+ssize_t oer_c_source_j_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_int8(decoder_p);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_j_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_w_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_w_t *src_p)
+ssize_t oer_c_source_j_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_j_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    encoder_append_int16(encoder_p, src_p->value);
-}
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_j_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-static void oer_c_source_w_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_w_t *dst_p)
-{
-    dst_p->value = decoder_read_int16(decoder_p);
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_x_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_x_t *src_p)
+ssize_t oer_c_source_j_decode_batch(
+    struct oer_c_source_j_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_int16(encoder_p, src_p->value);
-}
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-static void oer_c_source_x_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_x_t *dst_p)
-{
-    dst_p->value = decoder_read_int16(decoder_p);
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_j_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void oer_c_source_y_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_y_t *src_p)
+ssize_t oer_c_source_k_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_k_t *src_p)
 {
-    encoder_append_uint16(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_y_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_y_t *dst_p)
+ssize_t oer_c_source_k_encoded_size(
+    const struct oer_c_source_k_t *src_p)
 {
-    dst_p->value = decoder_read_uint16(decoder_p);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void oer_c_source_z_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct oer_c_source_z_t *src_p)
+ssize_t oer_c_source_k_decode(
+    struct oer_c_source_k_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_bool(encoder_p, src_p->value);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_k_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void oer_c_source_z_decode_inner(
-    struct decoder_t *decoder_p,
-    struct oer_c_source_z_t *dst_p)
+ssize_t oer_c_source_k_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_bool(decoder_p);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_k_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_a_encode(
+ssize_t oer_c_source_k_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_a_t *src_p)
+    const struct oer_c_source_k_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_a_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_k_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_a_decode(
-    struct oer_c_source_a_t *dst_p,
+ssize_t oer_c_source_k_decode_batch(
+    struct oer_c_source_k_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_a_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_k_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ab_encode(
+ssize_t oer_c_source_l_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ab_t *src_p)
+    const struct oer_c_source_l_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_ab_encode_inner(&encoder, src_p);
+    oer_c_source_l_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_ab_decode(
-    struct oer_c_source_ab_t *dst_p,
+ssize_t oer_c_source_l_encoded_size(
+    const struct oer_c_source_l_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_l_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_l_decode(
+    struct oer_c_source_l_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_ab_decode_inner(&decoder, dst_p);
+    oer_c_source_l_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_q_encode(
+ssize_t oer_c_source_l_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_l_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_l_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_q_t *src_p)
+    const struct oer_c_source_l_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_q_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_l_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_q_decode(
-    struct oer_c_source_q_t *dst_p,
+ssize_t oer_c_source_l_decode_batch(
+    struct oer_c_source_l_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_q_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_l_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_d_encode(
+ssize_t oer_c_source_o_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_d_t *src_p)
+    const struct oer_c_source_o_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_d_encode_inner(&encoder, src_p);
+    oer_c_source_o_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_d_decode(
-    struct oer_c_source_d_t *dst_p,
+ssize_t oer_c_source_o_encoded_size(
+    const struct oer_c_source_o_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_o_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_o_decode(
+    struct oer_c_source_o_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_d_decode_inner(&decoder, dst_p);
+    oer_c_source_o_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ac_encode(
+ssize_t oer_c_source_o_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_o_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_o_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ac_t *src_p)
+    const struct oer_c_source_o_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_ac_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_o_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ac_decode(
-    struct oer_c_source_ac_t *dst_p,
+ssize_t oer_c_source_o_decode_batch(
+    struct oer_c_source_o_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_ac_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_o_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ad_encode(
+ssize_t oer_c_source_n_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ad_t *src_p)
+    const struct oer_c_source_n_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_ad_encode_inner(&encoder, src_p);
+    oer_c_source_n_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_ad_decode(
-    struct oer_c_source_ad_t *dst_p,
+ssize_t oer_c_source_n_encoded_size(
+    const struct oer_c_source_n_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_n_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_n_decode(
+    struct oer_c_source_n_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_ad_decode_inner(&decoder, dst_p);
+    oer_c_source_n_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ae_encode(
+ssize_t oer_c_source_n_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_n_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_n_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ae_t *src_p)
+    const struct oer_c_source_n_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_n_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_c_source_n_decode_batch(
+    struct oer_c_source_n_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_n_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_ae_encode_inner(&encoder, src_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    return (encoder_get_result(&encoder));
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ae_decode(
-    struct oer_c_source_ae_t *dst_p,
+ssize_t oer_c_source_n_decode_fields(
+    struct oer_c_source_n_t *dst_p,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    uint64_t fields)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_ae_decode_inner(&decoder, dst_p);
+    oer_c_source_n_decode_fields_inner(&decoder, dst_p, fields);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ah_encode(
+ssize_t oer_c_source_m_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ah_t *src_p)
+    const struct oer_c_source_m_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_ah_encode_inner(&encoder, src_p);
+    oer_c_source_m_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_ah_decode(
-    struct oer_c_source_ah_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
-{
-    struct decoder_t decoder;
-
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_ah_decode_inner(&decoder, dst_p);
-
-    return (decoder_get_result(&decoder));
-}
-
-ssize_t oer_c_source_af_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_af_t *src_p)
+ssize_t oer_c_source_m_encoded_size(
+    const struct oer_c_source_m_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_af_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_m_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_af_decode(
-    struct oer_c_source_af_t *dst_p,
+ssize_t oer_c_source_m_decode(
+    struct oer_c_source_m_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_af_decode_inner(&decoder, dst_p);
+    oer_c_source_m_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ag_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_ag_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_ag_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t oer_c_source_ag_decode(
-    struct oer_c_source_ag_t *dst_p,
+ssize_t oer_c_source_m_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_ag_decode_inner(&decoder, dst_p);
+    oer_c_source_m_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_aj_encode(
+ssize_t oer_c_source_m_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_aj_t *src_p)
+    const struct oer_c_source_m_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_aj_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_m_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_aj_decode(
-    struct oer_c_source_aj_t *dst_p,
+ssize_t oer_c_source_m_decode_batch(
+    struct oer_c_source_m_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_aj_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
-}
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_m_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-ssize_t oer_c_source_ak_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_ak_t *src_p)
-{
-    struct encoder_t encoder;
+        if (res < 0) {
+            return (res);
+        }
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_ak_encode_inner(&encoder, src_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    return (encoder_get_result(&encoder));
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ak_decode(
-    struct oer_c_source_ak_t *dst_p,
+ssize_t oer_c_source_m_decode_fields(
+    struct oer_c_source_m_t *dst_p,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    uint64_t fields)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_ak_decode_inner(&decoder, dst_p);
+    oer_c_source_m_decode_fields_inner(&decoder, dst_p, fields);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ai_encode(
+ssize_t oer_c_source_p_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ai_t *src_p)
+    const struct oer_c_source_p_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_ai_encode_inner(&encoder, src_p);
+    oer_c_source_p_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_ai_decode(
-    struct oer_c_source_ai_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_p_encoded_size(
+    const struct oer_c_source_p_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_ai_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_p_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_al_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_al_t *src_p)
+ssize_t oer_c_source_p_decode(
+    struct oer_c_source_p_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_al_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_p_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_al_decode(
-    struct oer_c_source_al_t *dst_p,
+ssize_t oer_c_source_p_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_al_decode_inner(&decoder, dst_p);
+    oer_c_source_p_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_am_encode(
+ssize_t oer_c_source_p_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_am_t *src_p)
+    const struct oer_c_source_p_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_am_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_p_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_am_decode(
-    struct oer_c_source_am_t *dst_p,
+ssize_t oer_c_source_p_decode_batch(
+    struct oer_c_source_p_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_am_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
-}
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_p_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-ssize_t oer_c_source_an_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_an_t *src_p)
-{
-    struct encoder_t encoder;
+        if (res < 0) {
+            return (res);
+        }
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_an_encode_inner(&encoder, src_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    return (encoder_get_result(&encoder));
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_an_decode(
-    struct oer_c_source_an_t *dst_p,
+ssize_t oer_c_source_p_decode_fields(
+    struct oer_c_source_p_t *dst_p,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    uint64_t fields)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_an_decode_inner(&decoder, dst_p);
+    oer_c_source_p_decode_fields_inner(&decoder, dst_p, fields);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ao_encode(
+ssize_t oer_c_source_r_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ao_t *src_p)
+    const struct oer_c_source_r_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_ao_encode_inner(&encoder, src_p);
+    oer_c_source_r_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_ao_decode(
-    struct oer_c_source_ao_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_r_encoded_size(
+    const struct oer_c_source_r_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_ao_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_r_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_ref_referenced_sequence_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_ref_referenced_sequence_t *src_p)
+ssize_t oer_c_source_r_decode(
+    struct oer_c_source_r_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_r_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_ref_referenced_sequence_decode(
-    struct oer_c_ref_referenced_sequence_t *dst_p,
+ssize_t oer_c_source_r_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_ref_referenced_sequence_decode_inner(&decoder, dst_p);
+    oer_c_source_r_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_ref_referenced_enum_encode(
+ssize_t oer_c_source_r_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_ref_referenced_enum_t *src_p)
+    const struct oer_c_source_r_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_r_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_ref_referenced_enum_decode(
-    struct oer_c_ref_referenced_enum_t *dst_p,
+ssize_t oer_c_source_r_decode_batch(
+    struct oer_c_source_r_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_ref_referenced_enum_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_r_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ap_encode(
+ssize_t oer_c_ref_referenced_int_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ap_t *src_p)
+    const struct oer_c_ref_referenced_int_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_ap_encode_inner(&encoder, src_p);
+    oer_c_ref_referenced_int_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_ap_decode(
-    struct oer_c_source_ap_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_ref_referenced_int_encoded_size(
+    const struct oer_c_ref_referenced_int_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_ap_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_ref_referenced_int_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_aq_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_aq_t *src_p)
+ssize_t oer_c_ref_referenced_int_decode(
+    struct oer_c_ref_referenced_int_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_aq_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_ref_referenced_int_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_aq_decode(
-    struct oer_c_source_aq_t *dst_p,
+ssize_t oer_c_ref_referenced_int_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_aq_decode_inner(&decoder, dst_p);
+    oer_c_ref_referenced_int_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_ar_encode(
+ssize_t oer_c_ref_referenced_int_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ar_t *src_p)
+    const struct oer_c_ref_referenced_int_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_ar_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_ref_referenced_int_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_ar_decode(
-    struct oer_c_source_ar_t *dst_p,
+ssize_t oer_c_ref_referenced_int_decode_batch(
+    struct oer_c_ref_referenced_int_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_ar_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_ref_referenced_int_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_as_encode(
+ssize_t oer_c_source_s_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_as_t *src_p)
+    const struct oer_c_source_s_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_as_encode_inner(&encoder, src_p);
+    oer_c_source_s_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_as_decode(
-    struct oer_c_source_as_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
-{
-    struct decoder_t decoder;
-
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_as_decode_inner(&decoder, dst_p);
-
-    return (decoder_get_result(&decoder));
-}
-
-ssize_t oer_c_ref_at_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_ref_at_t *src_p)
+ssize_t oer_c_source_s_encoded_size(
+    const struct oer_c_source_s_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_ref_at_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_s_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_ref_at_decode(
-    struct oer_c_ref_at_t *dst_p,
+ssize_t oer_c_source_s_decode(
+    struct oer_c_source_s_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_ref_at_decode_inner(&decoder, dst_p);
+    oer_c_source_s_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_b_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_b_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_b_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t oer_c_source_b_decode(
-    struct oer_c_source_b_t *dst_p,
+ssize_t oer_c_source_s_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_b_decode_inner(&decoder, dst_p);
+    oer_c_source_s_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_bool_encode(
+ssize_t oer_c_source_s_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_bool_t *src_p)
+    const struct oer_c_source_s_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_bool_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_s_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_programming_types_bool_decode(
-    struct oer_programming_types_bool_t *dst_p,
+ssize_t oer_c_source_s_decode_batch(
+    struct oer_c_source_s_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_programming_types_bool_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_s_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_c_encode(
+ssize_t oer_c_source_t_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_c_t *src_p)
+    const struct oer_c_source_t_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_c_encode_inner(&encoder, src_p);
+    oer_c_source_t_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_c_decode(
-    struct oer_c_source_c_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_t_encoded_size(
+    const struct oer_c_source_t_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_c_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_t_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_programming_types_double_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_programming_types_double_t *src_p)
+ssize_t oer_c_source_t_decode(
+    struct oer_c_source_t_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_double_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_t_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_double_decode(
-    struct oer_programming_types_double_t *dst_p,
+ssize_t oer_c_source_t_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_programming_types_double_decode_inner(&decoder, dst_p);
+    oer_c_source_t_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_e_encode(
+ssize_t oer_c_source_t_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_e_t *src_p)
+    const struct oer_c_source_t_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_e_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_t_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_e_decode(
-    struct oer_c_source_e_t *dst_p,
+ssize_t oer_c_source_t_decode_batch(
+    struct oer_c_source_t_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_e_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_t_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_f_encode(
+ssize_t oer_c_source_u_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_f_t *src_p)
+    const struct oer_c_source_u_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_f_encode_inner(&encoder, src_p);
+    oer_c_source_u_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_f_decode(
-    struct oer_c_source_f_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_u_encoded_size(
+    const struct oer_c_source_u_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_f_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_u_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_programming_types_float_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_programming_types_float_t *src_p)
+ssize_t oer_c_source_u_decode(
+    struct oer_c_source_u_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_float_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_u_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_float_decode(
-    struct oer_programming_types_float_t *dst_p,
+ssize_t oer_c_source_u_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_programming_types_float_decode_inner(&decoder, dst_p);
+    oer_c_source_u_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_g_encode(
+ssize_t oer_c_source_u_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_g_t *src_p)
+    const struct oer_c_source_u_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_g_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_u_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_g_decode(
-    struct oer_c_source_g_t *dst_p,
+ssize_t oer_c_source_u_decode_batch(
+    struct oer_c_source_u_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_g_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_u_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_h_encode(
+ssize_t oer_programming_types_uint16_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_h_t *src_p)
+    const struct oer_programming_types_uint16_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_h_encode_inner(&encoder, src_p);
+    oer_programming_types_uint16_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_h_decode(
-    struct oer_c_source_h_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_programming_types_uint16_encoded_size(
+    const struct oer_programming_types_uint16_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_h_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_uint16_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_i_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_i_t *src_p)
+ssize_t oer_programming_types_uint16_decode(
+    struct oer_programming_types_uint16_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_i_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_uint16_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_i_decode(
-    struct oer_c_source_i_t *dst_p,
+ssize_t oer_programming_types_uint16_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_i_decode_inner(&decoder, dst_p);
+    oer_programming_types_uint16_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_int16_encode(
+ssize_t oer_programming_types_uint16_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_int16_t *src_p)
+    const struct oer_programming_types_uint16_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_int16_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_uint16_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_programming_types_int16_decode(
-    struct oer_programming_types_int16_t *dst_p,
+ssize_t oer_programming_types_uint16_decode_batch(
+    struct oer_programming_types_uint16_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_programming_types_int16_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_uint16_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_programming_types_int32_encode(
+ssize_t oer_programming_types_uint32_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_int32_t *src_p)
+    const struct oer_programming_types_uint32_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_programming_types_int32_encode_inner(&encoder, src_p);
+    oer_programming_types_uint32_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_programming_types_int32_decode(
-    struct oer_programming_types_int32_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
-{
-    struct decoder_t decoder;
-
-    decoder_init(&decoder, src_p, size);
-    oer_programming_types_int32_decode_inner(&decoder, dst_p);
-
-    return (decoder_get_result(&decoder));
-}
-
-ssize_t oer_programming_types_int64_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_programming_types_int64_t *src_p)
+ssize_t oer_programming_types_uint32_encoded_size(
+    const struct oer_programming_types_uint32_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_int64_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_uint32_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_programming_types_int64_decode(
-    struct oer_programming_types_int64_t *dst_p,
+ssize_t oer_programming_types_uint32_decode(
+    struct oer_programming_types_uint32_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_programming_types_int64_decode_inner(&decoder, dst_p);
+    oer_programming_types_uint32_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_int8_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_programming_types_int8_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_int8_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t oer_programming_types_int8_decode(
-    struct oer_programming_types_int8_t *dst_p,
+ssize_t oer_programming_types_uint32_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_programming_types_int8_decode_inner(&decoder, dst_p);
+    oer_programming_types_uint32_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_j_encode(
+ssize_t oer_programming_types_uint32_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_j_t *src_p)
+    const struct oer_programming_types_uint32_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_j_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_uint32_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_j_decode(
-    struct oer_c_source_j_t *dst_p,
+ssize_t oer_programming_types_uint32_decode_batch(
+    struct oer_programming_types_uint32_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_j_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_uint32_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_k_encode(
+ssize_t oer_programming_types_uint64_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_k_t *src_p)
+    const struct oer_programming_types_uint64_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_k_encode_inner(&encoder, src_p);
+    oer_programming_types_uint64_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_k_decode(
-    struct oer_c_source_k_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_programming_types_uint64_encoded_size(
+    const struct oer_programming_types_uint64_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_k_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_uint64_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_l_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_l_t *src_p)
+ssize_t oer_programming_types_uint64_decode(
+    struct oer_programming_types_uint64_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_l_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_uint64_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_l_decode(
-    struct oer_c_source_l_t *dst_p,
+ssize_t oer_programming_types_uint64_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_l_decode_inner(&decoder, dst_p);
+    oer_programming_types_uint64_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_o_encode(
+ssize_t oer_programming_types_uint64_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_o_t *src_p)
+    const struct oer_programming_types_uint64_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_o_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_uint64_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_o_decode(
-    struct oer_c_source_o_t *dst_p,
+ssize_t oer_programming_types_uint64_decode_batch(
+    struct oer_programming_types_uint64_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_o_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_uint64_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_n_encode(
+ssize_t oer_programming_types_uint8_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_n_t *src_p)
+    const struct oer_programming_types_uint8_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_n_encode_inner(&encoder, src_p);
+    oer_programming_types_uint8_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_n_decode(
-    struct oer_c_source_n_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_programming_types_uint8_encoded_size(
+    const struct oer_programming_types_uint8_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_n_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_programming_types_uint8_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_m_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_m_t *src_p)
+ssize_t oer_programming_types_uint8_decode(
+    struct oer_programming_types_uint8_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_m_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_programming_types_uint8_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_m_decode(
-    struct oer_c_source_m_t *dst_p,
+ssize_t oer_programming_types_uint8_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_m_decode_inner(&decoder, dst_p);
+    oer_programming_types_uint8_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_p_encode(
+ssize_t oer_programming_types_uint8_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_p_t *src_p)
+    const struct oer_programming_types_uint8_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_p_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_programming_types_uint8_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_p_decode(
-    struct oer_c_source_p_t *dst_p,
+ssize_t oer_programming_types_uint8_decode_batch(
+    struct oer_programming_types_uint8_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_p_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_programming_types_uint8_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_r_encode(
+ssize_t oer_c_source_v_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_r_t *src_p)
+    const struct oer_c_source_v_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_r_encode_inner(&encoder, src_p);
+    oer_c_source_v_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_r_decode(
-    struct oer_c_source_r_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_v_encoded_size(
+    const struct oer_c_source_v_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_r_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_v_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_ref_referenced_int_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_ref_referenced_int_t *src_p)
+ssize_t oer_c_source_v_decode(
+    struct oer_c_source_v_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_ref_referenced_int_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_v_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_ref_referenced_int_decode(
-    struct oer_c_ref_referenced_int_t *dst_p,
+ssize_t oer_c_source_v_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_ref_referenced_int_decode_inner(&decoder, dst_p);
+    oer_c_source_v_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_s_encode(
+ssize_t oer_c_source_v_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_s_t *src_p)
+    const struct oer_c_source_v_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_s_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_v_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_s_decode(
-    struct oer_c_source_s_t *dst_p,
+ssize_t oer_c_source_v_decode_batch(
+    struct oer_c_source_v_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_s_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_v_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_t_encode(
+ssize_t oer_c_source_w_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_t_t *src_p)
+    const struct oer_c_source_w_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_t_encode_inner(&encoder, src_p);
+    oer_c_source_w_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_t_decode(
-    struct oer_c_source_t_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_w_encoded_size(
+    const struct oer_c_source_w_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_t_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_w_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_u_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_u_t *src_p)
+ssize_t oer_c_source_w_decode(
+    struct oer_c_source_w_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_u_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_w_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_u_decode(
-    struct oer_c_source_u_t *dst_p,
+ssize_t oer_c_source_w_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_u_decode_inner(&decoder, dst_p);
+    oer_c_source_w_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_uint16_encode(
+ssize_t oer_c_source_w_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint16_t *src_p)
+    const struct oer_c_source_w_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_uint16_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_w_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_programming_types_uint16_decode(
-    struct oer_programming_types_uint16_t *dst_p,
+ssize_t oer_c_source_w_decode_batch(
+    struct oer_c_source_w_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_programming_types_uint16_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_w_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_programming_types_uint32_encode(
+ssize_t oer_c_source_x_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint32_t *src_p)
+    const struct oer_c_source_x_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_programming_types_uint32_encode_inner(&encoder, src_p);
+    oer_c_source_x_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_programming_types_uint32_decode(
-    struct oer_programming_types_uint32_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_x_encoded_size(
+    const struct oer_c_source_x_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_programming_types_uint32_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_x_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_programming_types_uint64_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_programming_types_uint64_t *src_p)
+ssize_t oer_c_source_x_decode(
+    struct oer_c_source_x_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_uint64_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_x_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_uint64_decode(
-    struct oer_programming_types_uint64_t *dst_p,
+ssize_t oer_c_source_x_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_programming_types_uint64_decode_inner(&decoder, dst_p);
+    oer_c_source_x_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_programming_types_uint8_encode(
+ssize_t oer_c_source_x_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint8_t *src_p)
+    const struct oer_c_source_x_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_programming_types_uint8_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_x_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_programming_types_uint8_decode(
-    struct oer_programming_types_uint8_t *dst_p,
+ssize_t oer_c_source_x_decode_batch(
+    struct oer_c_source_x_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_programming_types_uint8_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_x_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_v_encode(
+ssize_t oer_c_source_y_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_v_t *src_p)
+    const struct oer_c_source_y_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_v_encode_inner(&encoder, src_p);
+    oer_c_source_y_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_v_decode(
-    struct oer_c_source_v_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t oer_c_source_y_encoded_size(
+    const struct oer_c_source_y_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_v_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_y_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_w_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_w_t *src_p)
+ssize_t oer_c_source_y_decode(
+    struct oer_c_source_y_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_w_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_y_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_w_decode(
-    struct oer_c_source_w_t *dst_p,
+ssize_t oer_c_source_y_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_w_decode_inner(&decoder, dst_p);
+    oer_c_source_y_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_x_encode(
+ssize_t oer_c_source_y_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_x_t *src_p)
+    const struct oer_c_source_y_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_x_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_y_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_x_decode(
-    struct oer_c_source_x_t *dst_p,
+ssize_t oer_c_source_y_decode_batch(
+    struct oer_c_source_y_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_x_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_y_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_y_encode(
+ssize_t oer_c_source_z_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_y_t *src_p)
+    const struct oer_c_source_z_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    oer_c_source_y_encode_inner(&encoder, src_p);
+    oer_c_source_z_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t oer_c_source_y_decode(
-    struct oer_c_source_y_t *dst_p,
+ssize_t oer_c_source_z_encoded_size(
+    const struct oer_c_source_z_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_c_source_z_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_c_source_z_decode(
+    struct oer_c_source_z_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    oer_c_source_y_decode_inner(&decoder, dst_p);
+    oer_c_source_z_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t oer_c_source_z_encode(
+ssize_t oer_c_source_z_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_c_source_z_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_c_source_z_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_z_t *src_p)
+    const struct oer_c_source_z_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    oer_c_source_z_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_c_source_z_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t oer_c_source_z_decode(
+ssize_t oer_c_source_z_decode_batch(
     struct oer_c_source_z_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    oer_c_source_z_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_c_source_z_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
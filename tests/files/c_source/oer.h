@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.162.0 Thu May  5 07:21:29 2022.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:36:12 2026.
  */
 
 #ifndef OER_H
@@ -59,6 +59,22 @@
 #    define EBADENUM 503
 #endif
 
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
 /**
  * Type A in module CSource.
  */
@@ -1252,6 +1268,12 @@ struct oer_c_source_z_t {
     bool value;
 };
 
+/**
+ * Maximum encoded size of type A defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_A_MAX_ENCODED_SIZE 42u
+
 /**
  * Encode type A defined in module CSource.
  *
@@ -1266,6 +1288,17 @@ ssize_t oer_c_source_a_encode(
     size_t size,
     const struct oer_c_source_a_t *src_p);
 
+/**
+ * Calculate the encoded size of type A defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_a_encoded_size(
+    const struct oer_c_source_a_t *src_p);
+
 /**
  * Decode type A defined in module CSource.
  *
@@ -1281,91 +1314,98 @@ ssize_t oer_c_source_a_decode(
     size_t size);
 
 /**
- * Encode type AB defined in module CSource.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
- */
-ssize_t oer_c_source_ab_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_ab_t *src_p);
-
-/**
- * Decode type AB defined in module CSource.
+ * Find the end of an encoded value of type A defined in
+ * module CSource, without decoding it.
  *
- * @param[out] dst_p Decoded data.
- * @param[in] src_p Data to decode.
+ * @param[in] src_p Data to skip.
  * @param[in] size Size of src_p.
  *
- * @return Number of bytes decoded or negative error code.
+ * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ab_decode(
-    struct oer_c_source_ab_t *dst_p,
+ssize_t oer_c_source_a_skip(
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Q defined in module CSource.
+ * Encode given number of values of type A defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_q_encode(
+ssize_t oer_c_source_a_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_q_t *src_p);
+    const struct oer_c_source_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type Q defined in module CSource.
+ * Decode given number of values of type A defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_q_decode(
-    struct oer_c_source_q_t *dst_p,
+ssize_t oer_c_source_a_decode_batch(
+    struct oer_c_source_a_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type D defined in module CSource.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
+ * Fields of type A defined in module CSource, to decode
+ * with oer_c_source_a_decode_fields().
  */
-ssize_t oer_c_source_d_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_d_t *src_p);
+#define OER_C_SOURCE_A_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_A_FIELD_B (1ull << 1)
+#define OER_C_SOURCE_A_FIELD_C (1ull << 2)
+#define OER_C_SOURCE_A_FIELD_D (1ull << 3)
+#define OER_C_SOURCE_A_FIELD_E (1ull << 4)
+#define OER_C_SOURCE_A_FIELD_F (1ull << 5)
+#define OER_C_SOURCE_A_FIELD_G (1ull << 6)
+#define OER_C_SOURCE_A_FIELD_H (1ull << 7)
+#define OER_C_SOURCE_A_FIELD_I (1ull << 8)
+#define OER_C_SOURCE_A_FIELD_J (1ull << 9)
 
 /**
- * Decode type D defined in module CSource.
+ * Decode given fields of type A defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_d_decode(
-    struct oer_c_source_d_t *dst_p,
+ssize_t oer_c_source_a_decode_fields(
+    struct oer_c_source_a_t *dst_p,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    uint64_t fields);
 
 /**
- * Encode type AC defined in module CSource.
+ * Maximum encoded size of type AB defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AB_MAX_ENCODED_SIZE 3u
+
+/**
+ * Encode type AB defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1373,13 +1413,24 @@ ssize_t oer_c_source_d_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ac_encode(
+ssize_t oer_c_source_ab_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ac_t *src_p);
+    const struct oer_c_source_ab_t *src_p);
 
 /**
- * Decode type AC defined in module CSource.
+ * Calculate the encoded size of type AB defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ab_encoded_size(
+    const struct oer_c_source_ab_t *src_p);
+
+/**
+ * Decode type AB defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1387,97 +1438,96 @@ ssize_t oer_c_source_ac_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ac_decode(
-    struct oer_c_source_ac_t *dst_p,
+ssize_t oer_c_source_ab_decode(
+    struct oer_c_source_ab_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AD defined in module CSource.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
- */
-ssize_t oer_c_source_ad_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_ad_t *src_p);
-
-/**
- * Decode type AD defined in module CSource.
+ * Find the end of an encoded value of type AB defined in
+ * module CSource, without decoding it.
  *
- * @param[out] dst_p Decoded data.
- * @param[in] src_p Data to decode.
+ * @param[in] src_p Data to skip.
  * @param[in] size Size of src_p.
  *
- * @return Number of bytes decoded or negative error code.
+ * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ad_decode(
-    struct oer_c_source_ad_t *dst_p,
+ssize_t oer_c_source_ab_skip(
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AE defined in module CSource.
+ * Encode given number of values of type AB defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ae_encode(
+ssize_t oer_c_source_ab_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ae_t *src_p);
+    const struct oer_c_source_ab_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AE defined in module CSource.
+ * Decode given number of values of type AB defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ae_decode(
-    struct oer_c_source_ae_t *dst_p,
+ssize_t oer_c_source_ab_decode_batch(
+    struct oer_c_source_ab_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AH defined in module CSource.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
+ * Fields of type AB defined in module CSource, to decode
+ * with oer_c_source_ab_decode_fields().
  */
-ssize_t oer_c_source_ah_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_ah_t *src_p);
+#define OER_C_SOURCE_AB_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_AB_FIELD_B (1ull << 1)
 
 /**
- * Decode type AH defined in module CSource.
+ * Decode given fields of type AB defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ah_decode(
-    struct oer_c_source_ah_t *dst_p,
+ssize_t oer_c_source_ab_decode_fields(
+    struct oer_c_source_ab_t *dst_p,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    uint64_t fields);
 
 /**
- * Encode type AF defined in module CSource.
+ * Maximum encoded size of type Q defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_Q_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type Q defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1485,13 +1535,24 @@ ssize_t oer_c_source_ah_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_af_encode(
+ssize_t oer_c_source_q_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_af_t *src_p);
+    const struct oer_c_source_q_t *src_p);
 
 /**
- * Decode type AF defined in module CSource.
+ * Calculate the encoded size of type Q defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_q_encoded_size(
+    const struct oer_c_source_q_t *src_p);
+
+/**
+ * Decode type Q defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1499,41 +1560,70 @@ ssize_t oer_c_source_af_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_af_decode(
-    struct oer_c_source_af_t *dst_p,
+ssize_t oer_c_source_q_decode(
+    struct oer_c_source_q_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AG defined in module CSource.
+ * Find the end of an encoded value of type Q defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_q_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Q defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ag_encode(
+ssize_t oer_c_source_q_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ag_t *src_p);
+    const struct oer_c_source_q_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AG defined in module CSource.
+ * Decode given number of values of type Q defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ag_decode(
-    struct oer_c_source_ag_t *dst_p,
+ssize_t oer_c_source_q_decode_batch(
+    struct oer_c_source_q_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AJ defined in module CSource.
+ * Maximum encoded size of type D defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_D_MAX_ENCODED_SIZE 222u
+
+/**
+ * Encode type D defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1541,13 +1631,24 @@ ssize_t oer_c_source_ag_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_aj_encode(
+ssize_t oer_c_source_d_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_aj_t *src_p);
+    const struct oer_c_source_d_t *src_p);
 
 /**
- * Decode type AJ defined in module CSource.
+ * Calculate the encoded size of type D defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_d_encoded_size(
+    const struct oer_c_source_d_t *src_p);
+
+/**
+ * Decode type D defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1555,41 +1656,70 @@ ssize_t oer_c_source_aj_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_aj_decode(
-    struct oer_c_source_aj_t *dst_p,
+ssize_t oer_c_source_d_decode(
+    struct oer_c_source_d_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AK defined in module CSource.
+ * Find the end of an encoded value of type D defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ak_encode(
+ssize_t oer_c_source_d_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ak_t *src_p);
+    const struct oer_c_source_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AK defined in module CSource.
+ * Decode given number of values of type D defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ak_decode(
-    struct oer_c_source_ak_t *dst_p,
+ssize_t oer_c_source_d_decode_batch(
+    struct oer_c_source_d_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AI defined in module CSource.
+ * Maximum encoded size of type AC defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AC_MAX_ENCODED_SIZE 226u
+
+/**
+ * Encode type AC defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1597,13 +1727,24 @@ ssize_t oer_c_source_ak_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ai_encode(
+ssize_t oer_c_source_ac_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ai_t *src_p);
+    const struct oer_c_source_ac_t *src_p);
 
 /**
- * Decode type AI defined in module CSource.
+ * Calculate the encoded size of type AC defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ac_encoded_size(
+    const struct oer_c_source_ac_t *src_p);
+
+/**
+ * Decode type AC defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1611,41 +1752,3511 @@ ssize_t oer_c_source_ai_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ai_decode(
-    struct oer_c_source_ai_t *dst_p,
+ssize_t oer_c_source_ac_decode(
+    struct oer_c_source_ac_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AL defined in module CSource.
+ * Find the end of an encoded value of type AC defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ac_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AC defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_al_encode(
+ssize_t oer_c_source_ac_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_al_t *src_p);
+    const struct oer_c_source_ac_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AL defined in module CSource.
+ * Decode given number of values of type AC defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_al_decode(
-    struct oer_c_source_al_t *dst_p,
+ssize_t oer_c_source_ac_decode_batch(
+    struct oer_c_source_ac_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AC defined in module CSource, to decode
+ * with oer_c_source_ac_decode_fields().
+ */
+#define OER_C_SOURCE_AC_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_AC_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type AC defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ac_decode_fields(
+    struct oer_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AD defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AD_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type AD defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ad_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ad_t *src_p);
+
+/**
+ * Calculate the encoded size of type AD defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ad_encoded_size(
+    const struct oer_c_source_ad_t *src_p);
+
+/**
+ * Decode type AD defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ad_decode(
+    struct oer_c_source_ad_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AD defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ad_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AD defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ad_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ad_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AD defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ad_decode_batch(
+    struct oer_c_source_ad_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AE defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AE_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type AE defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ae_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ae_t *src_p);
+
+/**
+ * Calculate the encoded size of type AE defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ae_encoded_size(
+    const struct oer_c_source_ae_t *src_p);
+
+/**
+ * Decode type AE defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ae_decode(
+    struct oer_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AE defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ae_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AE defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ae_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ae_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AE defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ae_decode_batch(
+    struct oer_c_source_ae_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AE defined in module CSource, to decode
+ * with oer_c_source_ae_decode_fields().
+ */
+#define OER_C_SOURCE_AE_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_AE_FIELD_B (1ull << 1)
+#define OER_C_SOURCE_AE_FIELD_C (1ull << 2)
+
+/**
+ * Decode given fields of type AE defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ae_decode_fields(
+    struct oer_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AH defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AH_MAX_ENCODED_SIZE 9u
+
+/**
+ * Encode type AH defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ah_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ah_t *src_p);
+
+/**
+ * Calculate the encoded size of type AH defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ah_encoded_size(
+    const struct oer_c_source_ah_t *src_p);
+
+/**
+ * Decode type AH defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ah_decode(
+    struct oer_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AH defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ah_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AH defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ah_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ah_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AH defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ah_decode_batch(
+    struct oer_c_source_ah_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AH defined in module CSource, to decode
+ * with oer_c_source_ah_decode_fields().
+ */
+#define OER_C_SOURCE_AH_FIELD_C (1ull << 0)
+
+/**
+ * Decode given fields of type AH defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ah_decode_fields(
+    struct oer_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AF defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AF_MAX_ENCODED_SIZE 32u
+
+/**
+ * Encode type AF defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_af_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_af_t *src_p);
+
+/**
+ * Calculate the encoded size of type AF defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_af_encoded_size(
+    const struct oer_c_source_af_t *src_p);
+
+/**
+ * Decode type AF defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_af_decode(
+    struct oer_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AF defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_af_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AF defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_af_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_af_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AF defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_af_decode_batch(
+    struct oer_c_source_af_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AF defined in module CSource, to decode
+ * with oer_c_source_af_decode_fields().
+ */
+#define OER_C_SOURCE_AF_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type AF defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_af_decode_fields(
+    struct oer_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AG defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AG_MAX_ENCODED_SIZE 51u
+
+/**
+ * Encode type AG defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ag_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ag_t *src_p);
+
+/**
+ * Calculate the encoded size of type AG defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ag_encoded_size(
+    const struct oer_c_source_ag_t *src_p);
+
+/**
+ * Decode type AG defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ag_decode(
+    struct oer_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AG defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ag_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AG defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ag_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ag_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AG defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ag_decode_batch(
+    struct oer_c_source_ag_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AG defined in module CSource, to decode
+ * with oer_c_source_ag_decode_fields().
+ */
+#define OER_C_SOURCE_AG_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type AG defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ag_decode_fields(
+    struct oer_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AJ defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AJ_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type AJ defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aj_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aj_t *src_p);
+
+/**
+ * Calculate the encoded size of type AJ defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aj_encoded_size(
+    const struct oer_c_source_aj_t *src_p);
+
+/**
+ * Decode type AJ defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_aj_decode(
+    struct oer_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AJ defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aj_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AJ defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aj_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aj_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AJ defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_aj_decode_batch(
+    struct oer_c_source_aj_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AJ defined in module CSource, to decode
+ * with oer_c_source_aj_decode_fields().
+ */
+#define OER_C_SOURCE_AJ_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type AJ defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_aj_decode_fields(
+    struct oer_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AK defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AK_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type AK defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ak_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ak_t *src_p);
+
+/**
+ * Calculate the encoded size of type AK defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ak_encoded_size(
+    const struct oer_c_source_ak_t *src_p);
+
+/**
+ * Decode type AK defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ak_decode(
+    struct oer_c_source_ak_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AK defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ak_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AK defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ak_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ak_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AK defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ak_decode_batch(
+    struct oer_c_source_ak_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AI defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AI_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type AI defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ai_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ai_t *src_p);
+
+/**
+ * Calculate the encoded size of type AI defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ai_encoded_size(
+    const struct oer_c_source_ai_t *src_p);
+
+/**
+ * Decode type AI defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ai_decode(
+    struct oer_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AI defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ai_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AI defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ai_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ai_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AI defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ai_decode_batch(
+    struct oer_c_source_ai_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AI defined in module CSource, to decode
+ * with oer_c_source_ai_decode_fields().
+ */
+#define OER_C_SOURCE_AI_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type AI defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ai_decode_fields(
+    struct oer_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AL defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AL_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type AL defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_al_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_al_t *src_p);
+
+/**
+ * Calculate the encoded size of type AL defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_al_encoded_size(
+    const struct oer_c_source_al_t *src_p);
+
+/**
+ * Decode type AL defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_al_decode(
+    struct oer_c_source_al_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AL defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_al_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AL defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_al_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_al_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AL defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_al_decode_batch(
+    struct oer_c_source_al_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AM defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AM_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type AM defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_am_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_am_t *src_p);
+
+/**
+ * Calculate the encoded size of type AM defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_am_encoded_size(
+    const struct oer_c_source_am_t *src_p);
+
+/**
+ * Decode type AM defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_am_decode(
+    struct oer_c_source_am_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AM defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_am_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AM defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_am_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_am_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AM defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_am_decode_batch(
+    struct oer_c_source_am_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AN defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AN_MAX_ENCODED_SIZE 5u
+
+/**
+ * Encode type AN defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_an_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_an_t *src_p);
+
+/**
+ * Calculate the encoded size of type AN defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_an_encoded_size(
+    const struct oer_c_source_an_t *src_p);
+
+/**
+ * Decode type AN defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_an_decode(
+    struct oer_c_source_an_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AN defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_an_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AN defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_an_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_an_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AN defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_an_decode_batch(
+    struct oer_c_source_an_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AO defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AO_MAX_ENCODED_SIZE 17u
+
+/**
+ * Encode type AO defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ao_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ao_t *src_p);
+
+/**
+ * Calculate the encoded size of type AO defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ao_encoded_size(
+    const struct oer_c_source_ao_t *src_p);
+
+/**
+ * Decode type AO defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ao_decode(
+    struct oer_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AO defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ao_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AO defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ao_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ao_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AO defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ao_decode_batch(
+    struct oer_c_source_ao_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AO defined in module CSource, to decode
+ * with oer_c_source_ao_decode_fields().
+ */
+#define OER_C_SOURCE_AO_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_AO_FIELD_B (1ull << 1)
+#define OER_C_SOURCE_AO_FIELD_C (1ull << 2)
+#define OER_C_SOURCE_AO_FIELD_D (1ull << 3)
+#define OER_C_SOURCE_AO_FIELD_E (1ull << 4)
+
+/**
+ * Decode given fields of type AO defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ao_decode_fields(
+    struct oer_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type REFERENCED-SEQUENCE defined in module
+ * CRef, in bytes.
+ */
+#define OER_C_REF_REFERENCED_SEQUENCE_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type REFERENCED-SEQUENCE defined in module CRef.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_sequence_t *src_p);
+
+/**
+ * Calculate the encoded size of type REFERENCED-SEQUENCE defined in module
+ * CRef, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_encoded_size(
+    const struct oer_c_ref_referenced_sequence_t *src_p);
+
+/**
+ * Decode type REFERENCED-SEQUENCE defined in module CRef.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_decode(
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type REFERENCED-SEQUENCE defined in
+ * module CRef, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type REFERENCED-SEQUENCE defined in module
+ * CRef after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_sequence_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type REFERENCED-SEQUENCE defined in module
+ * CRef encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_decode_batch(
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type REFERENCED-SEQUENCE defined in module CRef, to decode
+ * with oer_c_ref_referenced_sequence_decode_fields().
+ */
+#define OER_C_REF_REFERENCED_SEQUENCE_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type REFERENCED-SEQUENCE defined in module
+ * CRef. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_referenced_sequence_decode_fields(
+    struct oer_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type REFERENCED-ENUM defined in module
+ * CRef, in bytes.
+ */
+#define OER_C_REF_REFERENCED_ENUM_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type REFERENCED-ENUM defined in module CRef.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_enum_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_enum_t *src_p);
+
+/**
+ * Calculate the encoded size of type REFERENCED-ENUM defined in module
+ * CRef, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_enum_encoded_size(
+    const struct oer_c_ref_referenced_enum_t *src_p);
+
+/**
+ * Decode type REFERENCED-ENUM defined in module CRef.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_referenced_enum_decode(
+    struct oer_c_ref_referenced_enum_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type REFERENCED-ENUM defined in
+ * module CRef, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_enum_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type REFERENCED-ENUM defined in module
+ * CRef after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_enum_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_referenced_enum_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type REFERENCED-ENUM defined in module
+ * CRef encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_referenced_enum_decode_batch(
+    struct oer_c_ref_referenced_enum_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AP defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AP_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type AP defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ap_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ap_t *src_p);
+
+/**
+ * Calculate the encoded size of type AP defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ap_encoded_size(
+    const struct oer_c_source_ap_t *src_p);
+
+/**
+ * Decode type AP defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ap_decode(
+    struct oer_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AP defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ap_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AP defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ap_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ap_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AP defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ap_decode_batch(
+    struct oer_c_source_ap_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AP defined in module CSource, to decode
+ * with oer_c_source_ap_decode_fields().
+ */
+#define OER_C_SOURCE_AP_FIELD_B (1ull << 0)
+#define OER_C_SOURCE_AP_FIELD_C (1ull << 1)
+#define OER_C_SOURCE_AP_FIELD_D (1ull << 2)
+
+/**
+ * Decode given fields of type AP defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ap_decode_fields(
+    struct oer_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AQ defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AQ_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type AQ defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aq_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aq_t *src_p);
+
+/**
+ * Calculate the encoded size of type AQ defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aq_encoded_size(
+    const struct oer_c_source_aq_t *src_p);
+
+/**
+ * Decode type AQ defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_aq_decode(
+    struct oer_c_source_aq_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AQ defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aq_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AQ defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_aq_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_aq_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AQ defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_aq_decode_batch(
+    struct oer_c_source_aq_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type AR defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AR_MAX_ENCODED_SIZE 12u
+
+/**
+ * Encode type AR defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ar_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ar_t *src_p);
+
+/**
+ * Calculate the encoded size of type AR defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ar_encoded_size(
+    const struct oer_c_source_ar_t *src_p);
+
+/**
+ * Decode type AR defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ar_decode(
+    struct oer_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AR defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ar_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AR defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_ar_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_ar_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AR defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ar_decode_batch(
+    struct oer_c_source_ar_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AR defined in module CSource, to decode
+ * with oer_c_source_ar_decode_fields().
+ */
+#define OER_C_SOURCE_AR_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type AR defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_ar_decode_fields(
+    struct oer_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AS defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_AS_MAX_ENCODED_SIZE 5u
+
+/**
+ * Encode type AS defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_as_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_as_t *src_p);
+
+/**
+ * Calculate the encoded size of type AS defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_as_encoded_size(
+    const struct oer_c_source_as_t *src_p);
+
+/**
+ * Decode type AS defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_as_decode(
+    struct oer_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AS defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_as_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AS defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_as_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_as_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AS defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_as_decode_batch(
+    struct oer_c_source_as_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type AS defined in module CSource, to decode
+ * with oer_c_source_as_decode_fields().
+ */
+#define OER_C_SOURCE_AS_FIELD_A_A (1ull << 0)
+#define OER_C_SOURCE_AS_FIELD_A_B (1ull << 1)
+#define OER_C_SOURCE_AS_FIELD_A_C (1ull << 2)
+
+/**
+ * Decode given fields of type AS defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_as_decode_fields(
+    struct oer_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type AT defined in module
+ * CRef, in bytes.
+ */
+#define OER_C_REF_AT_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type AT defined in module CRef.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_at_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_at_t *src_p);
+
+/**
+ * Calculate the encoded size of type AT defined in module
+ * CRef, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_at_encoded_size(
+    const struct oer_c_ref_at_t *src_p);
+
+/**
+ * Decode type AT defined in module CRef.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_at_decode(
+    struct oer_c_ref_at_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type AT defined in
+ * module CRef, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_at_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type AT defined in module
+ * CRef after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_at_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_ref_at_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type AT defined in module
+ * CRef encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_ref_at_decode_batch(
+    struct oer_c_ref_at_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_B_MAX_ENCODED_SIZE 43u
+
+/**
+ * Encode type B defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_b_encoded_size(
+    const struct oer_c_source_b_t *src_p);
+
+/**
+ * Decode type B defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_b_decode(
+    struct oer_c_source_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_b_decode_batch(
+    struct oer_c_source_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type Bool defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_BOOL_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type Bool defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_bool_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_bool_t *src_p);
+
+/**
+ * Calculate the encoded size of type Bool defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_bool_encoded_size(
+    const struct oer_programming_types_bool_t *src_p);
+
+/**
+ * Decode type Bool defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_bool_decode(
+    struct oer_programming_types_bool_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Bool defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_bool_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Bool defined in module
+ * ProgrammingTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_bool_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_bool_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Bool defined in module
+ * ProgrammingTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_bool_decode_batch(
+    struct oer_programming_types_bool_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_C_MAX_ENCODED_SIZE 88u
+
+/**
+ * Encode type C defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_c_encoded_size(
+    const struct oer_c_source_c_t *src_p);
+
+/**
+ * Decode type C defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_c_decode(
+    struct oer_c_source_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_c_decode_batch(
+    struct oer_c_source_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type Double defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_DOUBLE_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type Double defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_double_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_double_t *src_p);
+
+/**
+ * Calculate the encoded size of type Double defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_double_encoded_size(
+    const struct oer_programming_types_double_t *src_p);
+
+/**
+ * Decode type Double defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_double_decode(
+    struct oer_programming_types_double_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Double defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_double_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Double defined in module
+ * ProgrammingTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_double_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_double_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Double defined in module
+ * ProgrammingTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_double_decode_batch(
+    struct oer_programming_types_double_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type E defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_E_MAX_ENCODED_SIZE 3u
+
+/**
+ * Encode type E defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_e_t *src_p);
+
+/**
+ * Calculate the encoded size of type E defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_e_encoded_size(
+    const struct oer_c_source_e_t *src_p);
+
+/**
+ * Decode type E defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_e_decode(
+    struct oer_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type E defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_e_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type E defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_e_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type E defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_e_decode_batch(
+    struct oer_c_source_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type E defined in module CSource, to decode
+ * with oer_c_source_e_decode_fields().
+ */
+#define OER_C_SOURCE_E_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type E defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_e_decode_fields(
+    struct oer_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type F defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_F_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type F defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_f_t *src_p);
+
+/**
+ * Calculate the encoded size of type F defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_f_encoded_size(
+    const struct oer_c_source_f_t *src_p);
+
+/**
+ * Decode type F defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_f_decode(
+    struct oer_c_source_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type F defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_f_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type F defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_f_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type F defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_f_decode_batch(
+    struct oer_c_source_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type Float defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_FLOAT_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type Float defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_float_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_float_t *src_p);
+
+/**
+ * Calculate the encoded size of type Float defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_float_encoded_size(
+    const struct oer_programming_types_float_t *src_p);
+
+/**
+ * Decode type Float defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_float_decode(
+    struct oer_programming_types_float_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Float defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_float_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Float defined in module
+ * ProgrammingTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_float_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_float_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Float defined in module
+ * ProgrammingTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_float_decode_batch(
+    struct oer_programming_types_float_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type G defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_G_MAX_ENCODED_SIZE 11u
+
+/**
+ * Encode type G defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_g_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_g_t *src_p);
+
+/**
+ * Calculate the encoded size of type G defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_g_encoded_size(
+    const struct oer_c_source_g_t *src_p);
+
+/**
+ * Decode type G defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_g_decode(
+    struct oer_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type G defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_g_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type G defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_g_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_g_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type G defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_g_decode_batch(
+    struct oer_c_source_g_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type G defined in module CSource, to decode
+ * with oer_c_source_g_decode_fields().
+ */
+#define OER_C_SOURCE_G_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_G_FIELD_B (1ull << 1)
+#define OER_C_SOURCE_G_FIELD_C (1ull << 2)
+#define OER_C_SOURCE_G_FIELD_D (1ull << 3)
+#define OER_C_SOURCE_G_FIELD_E (1ull << 4)
+#define OER_C_SOURCE_G_FIELD_F (1ull << 5)
+#define OER_C_SOURCE_G_FIELD_G (1ull << 6)
+#define OER_C_SOURCE_G_FIELD_H (1ull << 7)
+#define OER_C_SOURCE_G_FIELD_I (1ull << 8)
+
+/**
+ * Decode given fields of type G defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_g_decode_fields(
+    struct oer_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type H defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_H_MAX_ENCODED_SIZE 0u
+
+/**
+ * Encode type H defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_h_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_h_t *src_p);
+
+/**
+ * Calculate the encoded size of type H defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_h_encoded_size(
+    const struct oer_c_source_h_t *src_p);
+
+/**
+ * Decode type H defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_h_decode(
+    struct oer_c_source_h_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type H defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_h_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type H defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_h_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_h_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type H defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_h_decode_batch(
+    struct oer_c_source_h_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type I defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_I_MAX_ENCODED_SIZE 24u
+
+/**
+ * Encode type I defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_i_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_i_t *src_p);
+
+/**
+ * Calculate the encoded size of type I defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_i_encoded_size(
+    const struct oer_c_source_i_t *src_p);
+
+/**
+ * Decode type I defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_i_decode(
+    struct oer_c_source_i_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type I defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_i_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type I defined in module
+ * CSource after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_i_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_i_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type I defined in module
+ * CSource encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_i_decode_batch(
+    struct oer_c_source_i_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type Int16 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_INT16_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type Int16 defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int16_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int16_t *src_p);
+
+/**
+ * Calculate the encoded size of type Int16 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int16_encoded_size(
+    const struct oer_programming_types_int16_t *src_p);
+
+/**
+ * Decode type Int16 defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_int16_decode(
+    struct oer_programming_types_int16_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Int16 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int16_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Int16 defined in module
+ * ProgrammingTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int16_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int16_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Int16 defined in module
+ * ProgrammingTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_int16_decode_batch(
+    struct oer_programming_types_int16_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type Int32 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_INT32_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type Int32 defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int32_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int32_t *src_p);
+
+/**
+ * Calculate the encoded size of type Int32 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int32_encoded_size(
+    const struct oer_programming_types_int32_t *src_p);
+
+/**
+ * Decode type Int32 defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_int32_decode(
+    struct oer_programming_types_int32_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Int32 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int32_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Int32 defined in module
+ * ProgrammingTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int32_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int32_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Int32 defined in module
+ * ProgrammingTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_int32_decode_batch(
+    struct oer_programming_types_int32_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type Int64 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_INT64_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type Int64 defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int64_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int64_t *src_p);
+
+/**
+ * Calculate the encoded size of type Int64 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int64_encoded_size(
+    const struct oer_programming_types_int64_t *src_p);
+
+/**
+ * Decode type Int64 defined in module ProgrammingTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_int64_decode(
+    struct oer_programming_types_int64_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Int64 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int64_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Int64 defined in module
+ * ProgrammingTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int64_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_programming_types_int64_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Int64 defined in module
+ * ProgrammingTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_programming_types_int64_decode_batch(
+    struct oer_programming_types_int64_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AM defined in module CSource.
+ * Maximum encoded size of type Int8 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_INT8_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type Int8 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1653,13 +5264,24 @@ ssize_t oer_c_source_al_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_am_encode(
+ssize_t oer_programming_types_int8_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_am_t *src_p);
+    const struct oer_programming_types_int8_t *src_p);
 
 /**
- * Decode type AM defined in module CSource.
+ * Calculate the encoded size of type Int8 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int8_encoded_size(
+    const struct oer_programming_types_int8_t *src_p);
+
+/**
+ * Decode type Int8 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1667,41 +5289,70 @@ ssize_t oer_c_source_am_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_am_decode(
-    struct oer_c_source_am_t *dst_p,
+ssize_t oer_programming_types_int8_decode(
+    struct oer_programming_types_int8_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AN defined in module CSource.
+ * Find the end of an encoded value of type Int8 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_int8_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Int8 defined in module
+ * ProgrammingTypes after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_an_encode(
+ssize_t oer_programming_types_int8_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_an_t *src_p);
+    const struct oer_programming_types_int8_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AN defined in module CSource.
+ * Decode given number of values of type Int8 defined in module
+ * ProgrammingTypes encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_an_decode(
-    struct oer_c_source_an_t *dst_p,
+ssize_t oer_programming_types_int8_decode_batch(
+    struct oer_programming_types_int8_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AO defined in module CSource.
+ * Maximum encoded size of type J defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_J_MAX_ENCODED_SIZE 24u
+
+/**
+ * Encode type J defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1709,13 +5360,24 @@ ssize_t oer_c_source_an_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ao_encode(
+ssize_t oer_c_source_j_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ao_t *src_p);
+    const struct oer_c_source_j_t *src_p);
 
 /**
- * Decode type AO defined in module CSource.
+ * Calculate the encoded size of type J defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_j_encoded_size(
+    const struct oer_c_source_j_t *src_p);
+
+/**
+ * Decode type J defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1723,125 +5385,358 @@ ssize_t oer_c_source_ao_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ao_decode(
-    struct oer_c_source_ao_t *dst_p,
+ssize_t oer_c_source_j_decode(
+    struct oer_c_source_j_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type REFERENCED-SEQUENCE defined in module CRef.
+ * Find the end of an encoded value of type J defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_j_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type J defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_ref_referenced_sequence_encode(
+ssize_t oer_c_source_j_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_ref_referenced_sequence_t *src_p);
+    const struct oer_c_source_j_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type REFERENCED-SEQUENCE defined in module CRef.
+ * Decode given number of values of type J defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_ref_referenced_sequence_decode(
-    struct oer_c_ref_referenced_sequence_t *dst_p,
+ssize_t oer_c_source_j_decode_batch(
+    struct oer_c_source_j_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type K defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_K_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type K defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_k_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_k_t *src_p);
+
+/**
+ * Calculate the encoded size of type K defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_k_encoded_size(
+    const struct oer_c_source_k_t *src_p);
+
+/**
+ * Decode type K defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_k_decode(
+    struct oer_c_source_k_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type REFERENCED-ENUM defined in module CRef.
+ * Find the end of an encoded value of type K defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_k_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type K defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_ref_referenced_enum_encode(
+ssize_t oer_c_source_k_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_ref_referenced_enum_t *src_p);
+    const struct oer_c_source_k_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type REFERENCED-ENUM defined in module CRef.
+ * Decode given number of values of type K defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_ref_referenced_enum_decode(
-    struct oer_c_ref_referenced_enum_t *dst_p,
+ssize_t oer_c_source_k_decode_batch(
+    struct oer_c_source_k_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type L defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_L_MAX_ENCODED_SIZE 503u
+
+/**
+ * Encode type L defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_l_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_l_t *src_p);
+
+/**
+ * Calculate the encoded size of type L defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_l_encoded_size(
+    const struct oer_c_source_l_t *src_p);
+
+/**
+ * Decode type L defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_l_decode(
+    struct oer_c_source_l_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AP defined in module CSource.
+ * Find the end of an encoded value of type L defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_l_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type L defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ap_encode(
+ssize_t oer_c_source_l_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ap_t *src_p);
+    const struct oer_c_source_l_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AP defined in module CSource.
+ * Decode given number of values of type L defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ap_decode(
-    struct oer_c_source_ap_t *dst_p,
+ssize_t oer_c_source_l_decode_batch(
+    struct oer_c_source_l_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type O defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_O_MAX_ENCODED_SIZE 263u
+
+/**
+ * Encode type O defined in module CSource.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_o_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_c_source_o_t *src_p);
+
+/**
+ * Calculate the encoded size of type O defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_o_encoded_size(
+    const struct oer_c_source_o_t *src_p);
+
+/**
+ * Decode type O defined in module CSource.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_c_source_o_decode(
+    struct oer_c_source_o_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type O defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_o_skip(
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AQ defined in module CSource.
+ * Encode given number of values of type O defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_aq_encode(
+ssize_t oer_c_source_o_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_aq_t *src_p);
+    const struct oer_c_source_o_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AQ defined in module CSource.
+ * Decode given number of values of type O defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_aq_decode(
-    struct oer_c_source_aq_t *dst_p,
+ssize_t oer_c_source_o_decode_batch(
+    struct oer_c_source_o_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AR defined in module CSource.
+ * Maximum encoded size of type N defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_N_MAX_ENCODED_SIZE 306u
+
+/**
+ * Encode type N defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1849,13 +5744,24 @@ ssize_t oer_c_source_aq_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_ar_encode(
+ssize_t oer_c_source_n_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_ar_t *src_p);
+    const struct oer_c_source_n_t *src_p);
 
 /**
- * Decode type AR defined in module CSource.
+ * Calculate the encoded size of type N defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_n_encoded_size(
+    const struct oer_c_source_n_t *src_p);
+
+/**
+ * Decode type N defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1863,69 +5769,97 @@ ssize_t oer_c_source_ar_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_ar_decode(
-    struct oer_c_source_ar_t *dst_p,
+ssize_t oer_c_source_n_decode(
+    struct oer_c_source_n_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type AS defined in module CSource.
+ * Find the end of an encoded value of type N defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_n_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type N defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_as_encode(
+ssize_t oer_c_source_n_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_as_t *src_p);
+    const struct oer_c_source_n_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type AS defined in module CSource.
+ * Decode given number of values of type N defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_as_decode(
-    struct oer_c_source_as_t *dst_p,
+ssize_t oer_c_source_n_decode_batch(
+    struct oer_c_source_n_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type AT defined in module CRef.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
+ * Fields of type N defined in module CSource, to decode
+ * with oer_c_source_n_decode_fields().
  */
-ssize_t oer_c_ref_at_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_ref_at_t *src_p);
+#define OER_C_SOURCE_N_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_N_FIELD_B (1ull << 1)
+#define OER_C_SOURCE_N_FIELD_C (1ull << 2)
 
 /**
- * Decode type AT defined in module CRef.
+ * Decode given fields of type N defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_ref_at_decode(
-    struct oer_c_ref_at_t *dst_p,
+ssize_t oer_c_source_n_decode_fields(
+    struct oer_c_source_n_t *dst_p,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    uint64_t fields);
 
 /**
- * Encode type B defined in module CSource.
+ * Maximum encoded size of type M defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_M_MAX_ENCODED_SIZE 307u
+
+/**
+ * Encode type M defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -1933,13 +5867,24 @@ ssize_t oer_c_ref_at_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_b_encode(
+ssize_t oer_c_source_m_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_b_t *src_p);
+    const struct oer_c_source_m_t *src_p);
 
 /**
- * Decode type B defined in module CSource.
+ * Calculate the encoded size of type M defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_m_encoded_size(
+    const struct oer_c_source_m_t *src_p);
+
+/**
+ * Decode type M defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -1947,69 +5892,96 @@ ssize_t oer_c_source_b_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_b_decode(
-    struct oer_c_source_b_t *dst_p,
+ssize_t oer_c_source_m_decode(
+    struct oer_c_source_m_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Bool defined in module ProgrammingTypes.
+ * Find the end of an encoded value of type M defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_m_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type M defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_bool_encode(
+ssize_t oer_c_source_m_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_bool_t *src_p);
+    const struct oer_c_source_m_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type Bool defined in module ProgrammingTypes.
+ * Decode given number of values of type M defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_bool_decode(
-    struct oer_programming_types_bool_t *dst_p,
+ssize_t oer_c_source_m_decode_batch(
+    struct oer_c_source_m_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type C defined in module CSource.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
+ * Fields of type M defined in module CSource, to decode
+ * with oer_c_source_m_decode_fields().
  */
-ssize_t oer_c_source_c_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_c_t *src_p);
+#define OER_C_SOURCE_M_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_M_FIELD_B (1ull << 1)
 
 /**
- * Decode type C defined in module CSource.
+ * Decode given fields of type M defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_c_decode(
-    struct oer_c_source_c_t *dst_p,
+ssize_t oer_c_source_m_decode_fields(
+    struct oer_c_source_m_t *dst_p,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    uint64_t fields);
 
 /**
- * Encode type Double defined in module ProgrammingTypes.
+ * Maximum encoded size of type P defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_P_MAX_ENCODED_SIZE 357u
+
+/**
+ * Encode type P defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2017,13 +5989,24 @@ ssize_t oer_c_source_c_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_double_encode(
+ssize_t oer_c_source_p_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_double_t *src_p);
+    const struct oer_c_source_p_t *src_p);
 
 /**
- * Decode type Double defined in module ProgrammingTypes.
+ * Calculate the encoded size of type P defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_p_encoded_size(
+    const struct oer_c_source_p_t *src_p);
+
+/**
+ * Decode type P defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2031,69 +6014,97 @@ ssize_t oer_programming_types_double_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_double_decode(
-    struct oer_programming_types_double_t *dst_p,
+ssize_t oer_c_source_p_decode(
+    struct oer_c_source_p_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type E defined in module CSource.
+ * Find the end of an encoded value of type P defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_p_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type P defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_e_encode(
+ssize_t oer_c_source_p_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_e_t *src_p);
+    const struct oer_c_source_p_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type E defined in module CSource.
+ * Decode given number of values of type P defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_e_decode(
-    struct oer_c_source_e_t *dst_p,
+ssize_t oer_c_source_p_decode_batch(
+    struct oer_c_source_p_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type F defined in module CSource.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
+ * Fields of type P defined in module CSource, to decode
+ * with oer_c_source_p_decode_fields().
  */
-ssize_t oer_c_source_f_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_c_source_f_t *src_p);
+#define OER_C_SOURCE_P_FIELD_A (1ull << 0)
+#define OER_C_SOURCE_P_FIELD_B (1ull << 1)
+#define OER_C_SOURCE_P_FIELD_C (1ull << 2)
 
 /**
- * Decode type F defined in module CSource.
+ * Decode given fields of type P defined in module
+ * CSource. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_f_decode(
-    struct oer_c_source_f_t *dst_p,
+ssize_t oer_c_source_p_decode_fields(
+    struct oer_c_source_p_t *dst_p,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    uint64_t fields);
 
 /**
- * Encode type Float defined in module ProgrammingTypes.
+ * Maximum encoded size of type R defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_R_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type R defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2101,13 +6112,24 @@ ssize_t oer_c_source_f_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_float_encode(
+ssize_t oer_c_source_r_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_float_t *src_p);
+    const struct oer_c_source_r_t *src_p);
 
 /**
- * Decode type Float defined in module ProgrammingTypes.
+ * Calculate the encoded size of type R defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_r_encoded_size(
+    const struct oer_c_source_r_t *src_p);
+
+/**
+ * Decode type R defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2115,41 +6137,70 @@ ssize_t oer_programming_types_float_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_float_decode(
-    struct oer_programming_types_float_t *dst_p,
+ssize_t oer_c_source_r_decode(
+    struct oer_c_source_r_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type G defined in module CSource.
+ * Find the end of an encoded value of type R defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_r_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type R defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_g_encode(
+ssize_t oer_c_source_r_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_g_t *src_p);
+    const struct oer_c_source_r_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type G defined in module CSource.
+ * Decode given number of values of type R defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_g_decode(
-    struct oer_c_source_g_t *dst_p,
+ssize_t oer_c_source_r_decode_batch(
+    struct oer_c_source_r_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type H defined in module CSource.
+ * Maximum encoded size of type REFERENCED-INT defined in module
+ * CRef, in bytes.
+ */
+#define OER_C_REF_REFERENCED_INT_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type REFERENCED-INT defined in module CRef.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2157,13 +6208,24 @@ ssize_t oer_c_source_g_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_h_encode(
+ssize_t oer_c_ref_referenced_int_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_h_t *src_p);
+    const struct oer_c_ref_referenced_int_t *src_p);
 
 /**
- * Decode type H defined in module CSource.
+ * Calculate the encoded size of type REFERENCED-INT defined in module
+ * CRef, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_int_encoded_size(
+    const struct oer_c_ref_referenced_int_t *src_p);
+
+/**
+ * Decode type REFERENCED-INT defined in module CRef.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2171,41 +6233,70 @@ ssize_t oer_c_source_h_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_h_decode(
-    struct oer_c_source_h_t *dst_p,
+ssize_t oer_c_ref_referenced_int_decode(
+    struct oer_c_ref_referenced_int_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type REFERENCED-INT defined in
+ * module CRef, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_ref_referenced_int_skip(
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type I defined in module CSource.
+ * Encode given number of values of type REFERENCED-INT defined in module
+ * CRef after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_i_encode(
+ssize_t oer_c_ref_referenced_int_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_i_t *src_p);
+    const struct oer_c_ref_referenced_int_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type I defined in module CSource.
+ * Decode given number of values of type REFERENCED-INT defined in module
+ * CRef encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_i_decode(
-    struct oer_c_source_i_t *dst_p,
+ssize_t oer_c_ref_referenced_int_decode_batch(
+    struct oer_c_ref_referenced_int_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type Int16 defined in module ProgrammingTypes.
+ * Maximum encoded size of type S defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_S_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type S defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2213,13 +6304,24 @@ ssize_t oer_c_source_i_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_int16_encode(
+ssize_t oer_c_source_s_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_int16_t *src_p);
+    const struct oer_c_source_s_t *src_p);
 
 /**
- * Decode type Int16 defined in module ProgrammingTypes.
+ * Calculate the encoded size of type S defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_s_encoded_size(
+    const struct oer_c_source_s_t *src_p);
+
+/**
+ * Decode type S defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2227,69 +6329,70 @@ ssize_t oer_programming_types_int16_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_int16_decode(
-    struct oer_programming_types_int16_t *dst_p,
+ssize_t oer_c_source_s_decode(
+    struct oer_c_source_s_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Int32 defined in module ProgrammingTypes.
- *
- * @param[out] dst_p Buffer to encode into.
- * @param[in] size Size of dst_p.
- * @param[in] src_p Data to encode.
- *
- * @return Encoded data length or negative error code.
- */
-ssize_t oer_programming_types_int32_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct oer_programming_types_int32_t *src_p);
-
-/**
- * Decode type Int32 defined in module ProgrammingTypes.
+ * Find the end of an encoded value of type S defined in
+ * module CSource, without decoding it.
  *
- * @param[out] dst_p Decoded data.
- * @param[in] src_p Data to decode.
+ * @param[in] src_p Data to skip.
  * @param[in] size Size of src_p.
  *
- * @return Number of bytes decoded or negative error code.
+ * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_int32_decode(
-    struct oer_programming_types_int32_t *dst_p,
+ssize_t oer_c_source_s_skip(
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Int64 defined in module ProgrammingTypes.
+ * Encode given number of values of type S defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_int64_encode(
+ssize_t oer_c_source_s_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_int64_t *src_p);
+    const struct oer_c_source_s_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type Int64 defined in module ProgrammingTypes.
+ * Decode given number of values of type S defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_int64_decode(
-    struct oer_programming_types_int64_t *dst_p,
+ssize_t oer_c_source_s_decode_batch(
+    struct oer_c_source_s_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type Int8 defined in module ProgrammingTypes.
+ * Maximum encoded size of type T defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_T_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type T defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2297,13 +6400,24 @@ ssize_t oer_programming_types_int64_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_int8_encode(
+ssize_t oer_c_source_t_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_int8_t *src_p);
+    const struct oer_c_source_t_t *src_p);
 
 /**
- * Decode type Int8 defined in module ProgrammingTypes.
+ * Calculate the encoded size of type T defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_t_encoded_size(
+    const struct oer_c_source_t_t *src_p);
+
+/**
+ * Decode type T defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2311,41 +6425,70 @@ ssize_t oer_programming_types_int8_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_int8_decode(
-    struct oer_programming_types_int8_t *dst_p,
+ssize_t oer_c_source_t_decode(
+    struct oer_c_source_t_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type J defined in module CSource.
+ * Find the end of an encoded value of type T defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_t_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type T defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_j_encode(
+ssize_t oer_c_source_t_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_j_t *src_p);
+    const struct oer_c_source_t_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type J defined in module CSource.
+ * Decode given number of values of type T defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_j_decode(
-    struct oer_c_source_j_t *dst_p,
+ssize_t oer_c_source_t_decode_batch(
+    struct oer_c_source_t_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type K defined in module CSource.
+ * Maximum encoded size of type U defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_U_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type U defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2353,13 +6496,24 @@ ssize_t oer_c_source_j_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_k_encode(
+ssize_t oer_c_source_u_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_k_t *src_p);
+    const struct oer_c_source_u_t *src_p);
 
 /**
- * Decode type K defined in module CSource.
+ * Calculate the encoded size of type U defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_u_encoded_size(
+    const struct oer_c_source_u_t *src_p);
+
+/**
+ * Decode type U defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2367,41 +6521,70 @@ ssize_t oer_c_source_k_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_k_decode(
-    struct oer_c_source_k_t *dst_p,
+ssize_t oer_c_source_u_decode(
+    struct oer_c_source_u_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type L defined in module CSource.
+ * Find the end of an encoded value of type U defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_u_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type U defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_l_encode(
+ssize_t oer_c_source_u_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_l_t *src_p);
+    const struct oer_c_source_u_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type L defined in module CSource.
+ * Decode given number of values of type U defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_l_decode(
-    struct oer_c_source_l_t *dst_p,
+ssize_t oer_c_source_u_decode_batch(
+    struct oer_c_source_u_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type O defined in module CSource.
+ * Maximum encoded size of type Uint16 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_UINT16_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type Uint16 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2409,13 +6592,24 @@ ssize_t oer_c_source_l_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_o_encode(
+ssize_t oer_programming_types_uint16_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_o_t *src_p);
+    const struct oer_programming_types_uint16_t *src_p);
 
 /**
- * Decode type O defined in module CSource.
+ * Calculate the encoded size of type Uint16 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint16_encoded_size(
+    const struct oer_programming_types_uint16_t *src_p);
+
+/**
+ * Decode type Uint16 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2423,41 +6617,70 @@ ssize_t oer_c_source_o_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_o_decode(
-    struct oer_c_source_o_t *dst_p,
+ssize_t oer_programming_types_uint16_decode(
+    struct oer_programming_types_uint16_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type N defined in module CSource.
+ * Find the end of an encoded value of type Uint16 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint16_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Uint16 defined in module
+ * ProgrammingTypes after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_n_encode(
+ssize_t oer_programming_types_uint16_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_n_t *src_p);
+    const struct oer_programming_types_uint16_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type N defined in module CSource.
+ * Decode given number of values of type Uint16 defined in module
+ * ProgrammingTypes encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_n_decode(
-    struct oer_c_source_n_t *dst_p,
+ssize_t oer_programming_types_uint16_decode_batch(
+    struct oer_programming_types_uint16_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type M defined in module CSource.
+ * Maximum encoded size of type Uint32 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_UINT32_MAX_ENCODED_SIZE 4u
+
+/**
+ * Encode type Uint32 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2465,13 +6688,24 @@ ssize_t oer_c_source_n_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_m_encode(
+ssize_t oer_programming_types_uint32_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_m_t *src_p);
+    const struct oer_programming_types_uint32_t *src_p);
 
 /**
- * Decode type M defined in module CSource.
+ * Calculate the encoded size of type Uint32 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint32_encoded_size(
+    const struct oer_programming_types_uint32_t *src_p);
+
+/**
+ * Decode type Uint32 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2479,41 +6713,70 @@ ssize_t oer_c_source_m_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_m_decode(
-    struct oer_c_source_m_t *dst_p,
+ssize_t oer_programming_types_uint32_decode(
+    struct oer_programming_types_uint32_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type P defined in module CSource.
+ * Find the end of an encoded value of type Uint32 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint32_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Uint32 defined in module
+ * ProgrammingTypes after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_p_encode(
+ssize_t oer_programming_types_uint32_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_p_t *src_p);
+    const struct oer_programming_types_uint32_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type P defined in module CSource.
+ * Decode given number of values of type Uint32 defined in module
+ * ProgrammingTypes encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_p_decode(
-    struct oer_c_source_p_t *dst_p,
+ssize_t oer_programming_types_uint32_decode_batch(
+    struct oer_programming_types_uint32_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type R defined in module CSource.
+ * Maximum encoded size of type Uint64 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_UINT64_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type Uint64 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2521,13 +6784,24 @@ ssize_t oer_c_source_p_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_r_encode(
+ssize_t oer_programming_types_uint64_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_r_t *src_p);
+    const struct oer_programming_types_uint64_t *src_p);
 
 /**
- * Decode type R defined in module CSource.
+ * Calculate the encoded size of type Uint64 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint64_encoded_size(
+    const struct oer_programming_types_uint64_t *src_p);
+
+/**
+ * Decode type Uint64 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2535,41 +6809,70 @@ ssize_t oer_c_source_r_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_r_decode(
-    struct oer_c_source_r_t *dst_p,
+ssize_t oer_programming_types_uint64_decode(
+    struct oer_programming_types_uint64_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Uint64 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint64_skip(
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type REFERENCED-INT defined in module CRef.
+ * Encode given number of values of type Uint64 defined in module
+ * ProgrammingTypes after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_ref_referenced_int_encode(
+ssize_t oer_programming_types_uint64_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_ref_referenced_int_t *src_p);
+    const struct oer_programming_types_uint64_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type REFERENCED-INT defined in module CRef.
+ * Decode given number of values of type Uint64 defined in module
+ * ProgrammingTypes encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_ref_referenced_int_decode(
-    struct oer_c_ref_referenced_int_t *dst_p,
+ssize_t oer_programming_types_uint64_decode_batch(
+    struct oer_programming_types_uint64_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type S defined in module CSource.
+ * Maximum encoded size of type Uint8 defined in module
+ * ProgrammingTypes, in bytes.
+ */
+#define OER_PROGRAMMING_TYPES_UINT8_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type Uint8 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2577,13 +6880,24 @@ ssize_t oer_c_ref_referenced_int_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_s_encode(
+ssize_t oer_programming_types_uint8_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_s_t *src_p);
+    const struct oer_programming_types_uint8_t *src_p);
 
 /**
- * Decode type S defined in module CSource.
+ * Calculate the encoded size of type Uint8 defined in module
+ * ProgrammingTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint8_encoded_size(
+    const struct oer_programming_types_uint8_t *src_p);
+
+/**
+ * Decode type Uint8 defined in module ProgrammingTypes.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2591,41 +6905,70 @@ ssize_t oer_c_source_s_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_s_decode(
-    struct oer_c_source_s_t *dst_p,
+ssize_t oer_programming_types_uint8_decode(
+    struct oer_programming_types_uint8_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type T defined in module CSource.
+ * Find the end of an encoded value of type Uint8 defined in
+ * module ProgrammingTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_programming_types_uint8_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Uint8 defined in module
+ * ProgrammingTypes after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_t_encode(
+ssize_t oer_programming_types_uint8_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_t_t *src_p);
+    const struct oer_programming_types_uint8_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type T defined in module CSource.
+ * Decode given number of values of type Uint8 defined in module
+ * ProgrammingTypes encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_t_decode(
-    struct oer_c_source_t_t *dst_p,
+ssize_t oer_programming_types_uint8_decode_batch(
+    struct oer_programming_types_uint8_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type U defined in module CSource.
+ * Maximum encoded size of type V defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_V_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type V defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2633,13 +6976,24 @@ ssize_t oer_c_source_t_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_u_encode(
+ssize_t oer_c_source_v_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_u_t *src_p);
+    const struct oer_c_source_v_t *src_p);
 
 /**
- * Decode type U defined in module CSource.
+ * Calculate the encoded size of type V defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_v_encoded_size(
+    const struct oer_c_source_v_t *src_p);
+
+/**
+ * Decode type V defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2647,41 +7001,70 @@ ssize_t oer_c_source_u_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_u_decode(
-    struct oer_c_source_u_t *dst_p,
+ssize_t oer_c_source_v_decode(
+    struct oer_c_source_v_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Uint16 defined in module ProgrammingTypes.
+ * Find the end of an encoded value of type V defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_v_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type V defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_uint16_encode(
+ssize_t oer_c_source_v_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint16_t *src_p);
+    const struct oer_c_source_v_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type Uint16 defined in module ProgrammingTypes.
+ * Decode given number of values of type V defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_uint16_decode(
-    struct oer_programming_types_uint16_t *dst_p,
+ssize_t oer_c_source_v_decode_batch(
+    struct oer_c_source_v_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type Uint32 defined in module ProgrammingTypes.
+ * Maximum encoded size of type W defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_W_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type W defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2689,13 +7072,24 @@ ssize_t oer_programming_types_uint16_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_uint32_encode(
+ssize_t oer_c_source_w_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint32_t *src_p);
+    const struct oer_c_source_w_t *src_p);
 
 /**
- * Decode type Uint32 defined in module ProgrammingTypes.
+ * Calculate the encoded size of type W defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_w_encoded_size(
+    const struct oer_c_source_w_t *src_p);
+
+/**
+ * Decode type W defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2703,41 +7097,70 @@ ssize_t oer_programming_types_uint32_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_uint32_decode(
-    struct oer_programming_types_uint32_t *dst_p,
+ssize_t oer_c_source_w_decode(
+    struct oer_c_source_w_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Uint64 defined in module ProgrammingTypes.
+ * Find the end of an encoded value of type W defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_w_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type W defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_uint64_encode(
+ssize_t oer_c_source_w_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint64_t *src_p);
+    const struct oer_c_source_w_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type Uint64 defined in module ProgrammingTypes.
+ * Decode given number of values of type W defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_uint64_decode(
-    struct oer_programming_types_uint64_t *dst_p,
+ssize_t oer_c_source_w_decode_batch(
+    struct oer_c_source_w_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type Uint8 defined in module ProgrammingTypes.
+ * Maximum encoded size of type X defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_X_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type X defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2745,13 +7168,24 @@ ssize_t oer_programming_types_uint64_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_programming_types_uint8_encode(
+ssize_t oer_c_source_x_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_programming_types_uint8_t *src_p);
+    const struct oer_c_source_x_t *src_p);
 
 /**
- * Decode type Uint8 defined in module ProgrammingTypes.
+ * Calculate the encoded size of type X defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_x_encoded_size(
+    const struct oer_c_source_x_t *src_p);
+
+/**
+ * Decode type X defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2759,41 +7193,70 @@ ssize_t oer_programming_types_uint8_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_programming_types_uint8_decode(
-    struct oer_programming_types_uint8_t *dst_p,
+ssize_t oer_c_source_x_decode(
+    struct oer_c_source_x_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type V defined in module CSource.
+ * Find the end of an encoded value of type X defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_x_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type X defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_v_encode(
+ssize_t oer_c_source_x_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_v_t *src_p);
+    const struct oer_c_source_x_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type V defined in module CSource.
+ * Decode given number of values of type X defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_v_decode(
-    struct oer_c_source_v_t *dst_p,
+ssize_t oer_c_source_x_decode_batch(
+    struct oer_c_source_x_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type W defined in module CSource.
+ * Maximum encoded size of type Y defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_Y_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type Y defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2801,13 +7264,24 @@ ssize_t oer_c_source_v_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_w_encode(
+ssize_t oer_c_source_y_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_w_t *src_p);
+    const struct oer_c_source_y_t *src_p);
 
 /**
- * Decode type W defined in module CSource.
+ * Calculate the encoded size of type Y defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_y_encoded_size(
+    const struct oer_c_source_y_t *src_p);
+
+/**
+ * Decode type Y defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2815,41 +7289,70 @@ ssize_t oer_c_source_w_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_w_decode(
-    struct oer_c_source_w_t *dst_p,
+ssize_t oer_c_source_y_decode(
+    struct oer_c_source_y_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type X defined in module CSource.
+ * Find the end of an encoded value of type Y defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_y_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Y defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_x_encode(
+ssize_t oer_c_source_y_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_x_t *src_p);
+    const struct oer_c_source_y_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type X defined in module CSource.
+ * Decode given number of values of type Y defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_x_decode(
-    struct oer_c_source_x_t *dst_p,
+ssize_t oer_c_source_y_decode_batch(
+    struct oer_c_source_y_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 /**
- * Encode type Y defined in module CSource.
+ * Maximum encoded size of type Z defined in module
+ * CSource, in bytes.
+ */
+#define OER_C_SOURCE_Z_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type Z defined in module CSource.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
@@ -2857,13 +7360,24 @@ ssize_t oer_c_source_x_decode(
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_y_encode(
+ssize_t oer_c_source_z_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_y_t *src_p);
+    const struct oer_c_source_z_t *src_p);
 
 /**
- * Decode type Y defined in module CSource.
+ * Calculate the encoded size of type Z defined in module
+ * CSource, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_z_encoded_size(
+    const struct oer_c_source_z_t *src_p);
+
+/**
+ * Decode type Z defined in module CSource.
  *
  * @param[out] dst_p Decoded data.
  * @param[in] src_p Data to decode.
@@ -2871,37 +7385,60 @@ ssize_t oer_c_source_y_encode(
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_y_decode(
-    struct oer_c_source_y_t *dst_p,
+ssize_t oer_c_source_z_decode(
+    struct oer_c_source_z_t *dst_p,
     const uint8_t *src_p,
     size_t size);
 
 /**
- * Encode type Z defined in module CSource.
+ * Find the end of an encoded value of type Z defined in
+ * module CSource, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_c_source_z_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Z defined in module
+ * CSource after each other.
  *
  * @param[out] dst_p Buffer to encode into.
  * @param[in] size Size of dst_p.
  * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
  *
  * @return Encoded data length or negative error code.
  */
-ssize_t oer_c_source_z_encode(
+ssize_t oer_c_source_z_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct oer_c_source_z_t *src_p);
+    const struct oer_c_source_z_t *src_p,
+    size_t count,
+    size_t *offsets_p);
 
 /**
- * Decode type Z defined in module CSource.
+ * Decode given number of values of type Z defined in module
+ * CSource encoded after each other.
  *
  * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
  * @param[in] src_p Data to decode.
  * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
  *
  * @return Number of bytes decoded or negative error code.
  */
-ssize_t oer_c_source_z_decode(
+ssize_t oer_c_source_z_decode_batch(
     struct oer_c_source_z_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size);
+    size_t size,
+    size_t *offsets_p);
 
 #endif
@@ -0,0 +1,1543 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:12 2026.
+ */
+
+#include <string.h>
+
+#include "oer_arena.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    struct oer_arena_arena_t *arena_p;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint16(uint8_t *buf_p, uint16_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 8);
+    buf_p[1] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint16_t load_uint16(const uint8_t *buf_p)
+{
+    return ((uint16_t)(((uint16_t)buf_p[0] << 8) | (uint16_t)buf_p[1]));
+}
+
+static uint8_t minimum_uint_length(uint32_t value)
+{
+    uint8_t length;
+
+    if (value < 256u) {
+        length = 1;
+    } else if (value < 65536u) {
+        length = 2;
+    } else if (value < 16777216u) {
+        length = 3;
+    } else {
+        length = 4;
+    }
+
+    return (length);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_append_uint16_array(struct encoder_t *self_p,
+                                        const uint16_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 2 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint16(&buf_p[2 * i], values_p[i]);
+    }
+}
+
+static void encoder_append_uint8(struct encoder_t *self_p,
+                                 uint8_t value)
+{
+    encoder_append_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_append_uint16(struct encoder_t *self_p,
+                                  uint16_t value)
+{
+    uint8_t buf[2];
+
+    buf[0] = (uint8_t)(value >> 8);
+    buf[1] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_uint32(struct encoder_t *self_p,
+                                  uint32_t value)
+{
+    uint8_t buf[4];
+
+    buf[0] = (uint8_t)(value >> 24);
+    buf[1] = (uint8_t)(value >> 16);
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_int8(struct encoder_t *self_p,
+                                int8_t value)
+{
+    encoder_append_uint8(self_p, (uint8_t)value);
+}
+
+static void encoder_append_uint(struct encoder_t *self_p,
+                                uint32_t value,
+                                uint8_t number_of_bytes)
+{
+    switch (number_of_bytes) {
+
+    case 1:
+        encoder_append_uint8(self_p, (uint8_t)value);
+        break;
+
+    case 2:
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    case 3:
+        encoder_append_uint8(self_p, (uint8_t)(value >> 16));
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    default:
+        encoder_append_uint32(self_p, value);
+        break;
+    }
+}
+
+static void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_uint8(self_p, value ? 255u : 0u);
+}
+
+static void encoder_append_length_determinant(struct encoder_t *self_p,
+                                              uint32_t length)
+{
+    if (length < 128u) {
+        encoder_append_int8(self_p, (int8_t)length);
+    } else if (length < 256u) {
+        encoder_append_uint8(self_p, 0x81u);
+        encoder_append_uint8(self_p, (uint8_t)length);
+    } else if (length < 65536u) {
+        encoder_append_uint8(self_p, 0x82u);
+        encoder_append_uint16(self_p, (uint16_t)length);
+    } else if (length < 16777216u) {
+        encoder_append_uint32(self_p, length | (0x83u << 24u));
+    } else {
+        encoder_append_uint8(self_p, 0x84u);
+        encoder_append_uint32(self_p, length);
+    }
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static void *decoder_arena_alloc(struct decoder_t *self_p, size_t size)
+{
+    size_t pos;
+
+    /* Keep all allocations aligned for any member type. */
+    pos = ((self_p->arena_p->pos + 7u) & ~(size_t)7u);
+
+    if ((pos > self_p->arena_p->size)
+        || (size > (self_p->arena_p->size - pos))) {
+        decoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    self_p->arena_p->pos = (pos + size);
+
+    return (&self_p->arena_p->buf[pos]);
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static void decoder_read_uint16_array(struct decoder_t *self_p,
+                                      uint16_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 2 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 2 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint16(&buf_p[2 * i]);
+    }
+}
+
+static const uint8_t *decoder_read_bytes_arena(struct decoder_t *self_p,
+                                               size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = decoder_arena_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        decoder_read_bytes(self_p, buf_p, size);
+    }
+
+    return (buf_p);
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    uint8_t buf[2];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (uint16_t)(((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+}
+
+static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    uint8_t buf[4];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (((uint32_t)buf[0] << 24)
+            | ((uint32_t)buf[1] << 16)
+            | ((uint32_t)buf[2] << 8)
+            | (uint32_t)buf[3]);
+}
+
+static uint32_t decoder_read_uint(struct decoder_t *self_p,
+                                  uint8_t number_of_bytes)
+{
+    uint32_t value;
+
+    switch (number_of_bytes) {
+
+    case 1:
+        value = decoder_read_uint8(self_p);
+        break;
+
+    case 2:
+        value = decoder_read_uint16(self_p);
+        break;
+
+    case 3:
+        value = ((uint32_t)decoder_read_uint8(self_p) << 16u);
+        value |= decoder_read_uint16(self_p);
+        break;
+
+    case 4:
+        value = decoder_read_uint32(self_p);
+        break;
+
+    default:
+        value = 0xffffffffu;
+        break;
+    }
+
+    return (value);
+}
+
+static bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_uint8(self_p) != 0u);
+}
+
+static uint32_t decoder_read_length_determinant(struct decoder_t *self_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        switch (length & 0x7fu) {
+
+        case 1:
+            length = decoder_read_uint8(self_p);
+            break;
+
+        case 2:
+            length = decoder_read_uint16(self_p);
+            break;
+
+        case 3:
+            length = (((uint32_t)decoder_read_uint8(self_p) << 16)
+                      | decoder_read_uint16(self_p));
+            break;
+
+        case 4:
+            length = decoder_read_uint32(self_p);
+            break;
+
+        default:
+            length = 0xffffffffu;
+            break;
+        }
+    }
+
+    return (length);
+}
+
+static void oer_arena_arena_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arena_arena_a_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    encoder_append_uint16_array(encoder_p,
+                                src_p->elements,
+                                src_p->length);
+}
+
+static void oer_arena_arena_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arena_arena_a_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->elements = decoder_arena_alloc(
+        decoder_p,
+        dst_p->length * sizeof(dst_p->elements[0]));
+
+    if (dst_p->elements == NULL) {
+        return;
+    }
+
+    decoder_read_uint16_array(decoder_p,
+                              dst_p->elements,
+                              dst_p->length);
+}
+
+static void oer_arena_arena_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 2u);
+}
+
+static void oer_arena_arena_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arena_arena_b_t *src_p)
+{
+    uint8_t present_mask[1];
+    static const uint8_t c_default[] = {0x01, 0x02};
+
+    present_mask[0] = 0;
+
+    if (src_p->is_b_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    if ((src_p->c.length != sizeof(c_default)) ||
+        (memcmp(src_p->c.buf, c_default, sizeof(c_default)) != 0)) {
+        present_mask[0] |= 0x40u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_uint8(encoder_p, src_p->a.length);
+    encoder_append_bytes(encoder_p,
+                         &src_p->a.buf[0],
+                         src_p->a.length);
+
+    if (src_p->is_b_present) {
+        encoder_append_length_determinant(encoder_p, src_p->b.length);
+        encoder_append_bytes(encoder_p,
+                             src_p->b.buf,
+                             src_p->b.length);
+    }
+
+    if ((src_p->c.length != sizeof(c_default)) ||
+        (memcmp(src_p->c.buf, c_default, sizeof(c_default)) != 0)) {
+        encoder_append_length_determinant(encoder_p, src_p->c.length);
+        encoder_append_bytes(encoder_p,
+                             src_p->c.buf,
+                             src_p->c.length);
+    }
+
+    encoder_append_uint8(encoder_p, src_p->d);
+}
+
+static void oer_arena_arena_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arena_arena_b_t *dst_p)
+{
+    uint8_t present_mask[1];
+    static const uint8_t c_default[] = {0x01, 0x02};
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_b_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    dst_p->a.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->a.length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->a.buf[0],
+                       dst_p->a.length);
+
+    if (dst_p->is_b_present) {
+        dst_p->b.length = decoder_read_length_determinant(decoder_p);
+
+        if (dst_p->b.length > 500u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->b.buf = decoder_read_bytes_arena(decoder_p,
+                                                dst_p->b.length);
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        dst_p->c.length = decoder_read_length_determinant(decoder_p);
+
+        if (dst_p->c.length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->c.buf = decoder_read_bytes_arena(decoder_p,
+                                                dst_p->c.length);
+    } else {
+        dst_p->c.buf = &c_default[0];
+        dst_p->c.length = sizeof(c_default);
+    }
+
+    dst_p->d = decoder_read_uint8(decoder_p);
+}
+
+static void oer_arena_arena_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arena_arena_b_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    static const uint8_t c_default[] = {0x01, 0x02};
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_b_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if ((fields & OER_ARENA_ARENA_B_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        length = decoder_read_uint8(decoder_p);
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & OER_ARENA_ARENA_B_FIELD_B) != 0u) {
+            dst_p->b.length = decoder_read_length_determinant(decoder_p);
+
+            if (dst_p->b.length > 500u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            dst_p->b.buf = decoder_read_bytes_arena(decoder_p,
+                                                    dst_p->b.length);
+        } else {
+            length_2 = decoder_read_length_determinant(decoder_p);
+
+            if (length_2 > 500u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length_2);
+        }
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        if ((fields & OER_ARENA_ARENA_B_FIELD_C) != 0u) {
+            dst_p->c.length = decoder_read_length_determinant(decoder_p);
+
+            if (dst_p->c.length > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            dst_p->c.buf = decoder_read_bytes_arena(decoder_p,
+                                                    dst_p->c.length);
+        } else {
+            length_3 = decoder_read_length_determinant(decoder_p);
+
+            if (length_3 > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length_3);
+        }
+    } else {
+        dst_p->c.buf = &c_default[0];
+        dst_p->c.length = sizeof(c_default);
+    }
+
+    if ((fields & OER_ARENA_ARENA_B_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_arena_arena_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        length_2 = decoder_read_length_determinant(decoder_p);
+
+        if (length_2 > 500u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2);
+    }
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        length_3 = decoder_read_length_determinant(decoder_p);
+
+        if (length_3 > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3);
+    }
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void oer_arena_arena_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arena_arena_c_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        oer_arena_arena_a_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void oer_arena_arena_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arena_arena_c_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        oer_arena_arena_a_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void oer_arena_arena_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        oer_arena_arena_a_skip_inner(decoder_p);
+    }
+}
+
+static void oer_arena_arena_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arena_arena_d_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        encoder_append_bool(encoder_p, src_p->elements[i].a);
+        encoder_append_uint8(encoder_p, (uint8_t)src_p->elements[i].b.length);
+        encoder_append_bytes(encoder_p,
+                             src_p->elements[i].b.buf,
+                             src_p->elements[i].b.length);
+    }
+}
+
+static void oer_arena_arena_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arena_arena_d_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 200u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->elements = decoder_arena_alloc(
+        decoder_p,
+        dst_p->length * sizeof(dst_p->elements[0]));
+
+    if (dst_p->elements == NULL) {
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        dst_p->elements[i].a = decoder_read_bool(decoder_p);
+        dst_p->elements[i].b.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->elements[i].b.length > 100u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->elements[i].b.buf = decoder_read_bytes_arena(decoder_p,
+                                                            dst_p->elements[i].b.length);
+    }
+}
+
+static void oer_arena_arena_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+    uint32_t length_2;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 200u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        (void)decoder_free(decoder_p, 1u);
+        length_2 = decoder_read_uint8(decoder_p);
+
+        if (length_2 > 100u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2);
+    }
+}
+
+static void oer_arena_arena_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arena_arena_e_t *src_p)
+{
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         500);
+}
+
+static void oer_arena_arena_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arena_arena_e_t *dst_p)
+{
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       500);
+}
+
+static void oer_arena_arena_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 500u);
+}
+
+ssize_t oer_arena_arena_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arena_arena_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_a_encoded_size(
+    const struct oer_arena_arena_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arena_arena_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_a_decode(
+    struct oer_arena_arena_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_arena_arena_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arena_arena_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arena_arena_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_a_decode_batch(
+    struct oer_arena_arena_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_arena_arena_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arena_arena_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_b_encoded_size(
+    const struct oer_arena_arena_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arena_arena_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_b_decode(
+    struct oer_arena_arena_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_arena_arena_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arena_arena_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arena_arena_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_b_decode_batch(
+    struct oer_arena_arena_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_arena_arena_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_b_decode_fields(
+    struct oer_arena_arena_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_arena_arena_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arena_arena_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_c_encoded_size(
+    const struct oer_arena_arena_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arena_arena_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_c_decode(
+    struct oer_arena_arena_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_arena_arena_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arena_arena_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arena_arena_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_c_decode_batch(
+    struct oer_arena_arena_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_arena_arena_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arena_arena_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_d_encoded_size(
+    const struct oer_arena_arena_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arena_arena_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_d_decode(
+    struct oer_arena_arena_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_arena_arena_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arena_arena_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arena_arena_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_d_decode_batch(
+    struct oer_arena_arena_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_arena_arena_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arena_arena_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_e_encoded_size(
+    const struct oer_arena_arena_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arena_arena_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arena_arena_e_decode(
+    struct oer_arena_arena_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_arena_arena_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arena_arena_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arena_arena_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arena_arena_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arena_arena_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arena_arena_e_decode_batch(
+    struct oer_arena_arena_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_arena_arena_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
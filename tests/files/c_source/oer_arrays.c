@@ -0,0 +1,2312 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:32 2026.
+ */
+
+#include <string.h>
+
+#include "oer_arrays.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint16(uint8_t *buf_p, uint16_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 8);
+    buf_p[1] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE void store_uint32(uint8_t *buf_p, uint32_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 24);
+    buf_p[1] = (uint8_t)(value >> 16);
+    buf_p[2] = (uint8_t)(value >> 8);
+    buf_p[3] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint16_t load_uint16(const uint8_t *buf_p)
+{
+    return ((uint16_t)(((uint16_t)buf_p[0] << 8) | (uint16_t)buf_p[1]));
+}
+
+static ALWAYS_INLINE uint32_t load_uint32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | (uint32_t)buf_p[3]);
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+
+static uint8_t enumerated_value_length(int32_t value)
+{
+    uint8_t length;
+
+    if ((value >=0) && (value < 128)) {
+        length = 0;
+    } else if ((value >= -128) && (value < 128)) {
+        length = 1;
+    } else if ((value >= -32768) && (value < 32768)) {
+        length = 2;
+    } else if ((value >= -8388608) && (value < 8388608)) {
+        length = 3;
+    } else {
+        length = 4;
+    }
+
+    return length;
+}
+
+static uint8_t minimum_uint_length(uint32_t value)
+{
+    uint8_t length;
+
+    if (value < 256u) {
+        length = 1;
+    } else if (value < 65536u) {
+        length = 2;
+    } else if (value < 16777216u) {
+        length = 3;
+    } else {
+        length = 4;
+    }
+
+    return (length);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_append_bool_array(struct encoder_t *self_p,
+                                      const bool *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        buf_p[i] = (values_p[i] ? 255u : 0u);
+    }
+}
+
+static void encoder_append_uint16_array(struct encoder_t *self_p,
+                                        const uint16_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 2 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint16(&buf_p[2 * i], values_p[i]);
+    }
+}
+
+static void encoder_append_uint32_array(struct encoder_t *self_p,
+                                        const uint32_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 4 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint32(&buf_p[4 * i], values_p[i]);
+    }
+}
+
+static void encoder_append_uint64_array(struct encoder_t *self_p,
+                                        const uint64_t *values_p,
+                                        size_t length)
+{
+    ssize_t pos;
+    uint8_t *buf_p;
+    size_t i;
+
+    pos = encoder_alloc(self_p, 8 * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        store_uint64(&buf_p[8 * i], values_p[i]);
+    }
+}
+
+static void encoder_append_uint8(struct encoder_t *self_p,
+                                 uint8_t value)
+{
+    encoder_append_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_append_uint16(struct encoder_t *self_p,
+                                  uint16_t value)
+{
+    uint8_t buf[2];
+
+    buf[0] = (uint8_t)(value >> 8);
+    buf[1] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_uint32(struct encoder_t *self_p,
+                                  uint32_t value)
+{
+    uint8_t buf[4];
+
+    buf[0] = (uint8_t)(value >> 24);
+    buf[1] = (uint8_t)(value >> 16);
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_int8(struct encoder_t *self_p,
+                                int8_t value)
+{
+    encoder_append_uint8(self_p, (uint8_t)value);
+}
+
+static void encoder_append_int16(struct encoder_t *self_p,
+                                 int16_t value)
+{
+    encoder_append_uint16(self_p, (uint16_t)value);
+}
+
+static void encoder_append_int32(struct encoder_t *self_p,
+                                 int32_t value)
+{
+    encoder_append_uint32(self_p, (uint32_t)value);
+}
+
+static void encoder_append_uint(struct encoder_t *self_p,
+                                uint32_t value,
+                                uint8_t number_of_bytes)
+{
+    switch (number_of_bytes) {
+
+    case 1:
+        encoder_append_uint8(self_p, (uint8_t)value);
+        break;
+
+    case 2:
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    case 3:
+        encoder_append_uint8(self_p, (uint8_t)(value >> 16));
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    default:
+        encoder_append_uint32(self_p, value);
+        break;
+    }
+}
+
+static void encoder_append_int(struct encoder_t *self_p,
+                               int32_t value,
+                               uint8_t number_of_bytes)
+{
+    switch (number_of_bytes) {
+
+    case 1:
+        encoder_append_int8(self_p, (int8_t)value);
+        break;
+
+    case 2:
+        encoder_append_int16(self_p, (int16_t)value);
+        break;
+
+    case 3:
+        encoder_append_uint8(self_p, (uint8_t)((uint32_t)value >> 16));
+        encoder_append_int16(self_p, (int16_t)value);
+        break;
+
+    default:
+        encoder_append_int32(self_p, value);
+        break;
+    }
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static void decoder_read_bool_array(struct decoder_t *self_p,
+                                    bool *values_p,
+                                    size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = (buf_p[i] != 0u);
+    }
+}
+
+static void decoder_read_uint16_array(struct decoder_t *self_p,
+                                      uint16_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 2 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 2 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint16(&buf_p[2 * i]);
+    }
+}
+
+static void decoder_read_uint32_array(struct decoder_t *self_p,
+                                      uint32_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 4 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 4 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint32(&buf_p[4 * i]);
+    }
+}
+
+static void decoder_read_uint64_array(struct decoder_t *self_p,
+                                      uint64_t *values_p,
+                                      size_t length)
+{
+    ssize_t pos;
+    const uint8_t *buf_p;
+    size_t i;
+
+    pos = decoder_free(self_p, 8 * length);
+
+    if (pos < 0) {
+        (void)memset(values_p, 0, 8 * length);
+
+        return;
+    }
+
+    buf_p = &self_p->buf_p[pos];
+
+    for (i = 0; i < length; i++) {
+        values_p[i] = load_uint64(&buf_p[8 * i]);
+    }
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    uint8_t buf[2];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (uint16_t)(((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+}
+
+static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    uint8_t buf[4];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (((uint32_t)buf[0] << 24)
+            | ((uint32_t)buf[1] << 16)
+            | ((uint32_t)buf[2] << 8)
+            | (uint32_t)buf[3]);
+}
+
+static int8_t decoder_read_int8(struct decoder_t *self_p)
+{
+    return ((int8_t)decoder_read_uint8(self_p));
+}
+
+static int16_t decoder_read_int16(struct decoder_t *self_p)
+{
+    return ((int16_t)decoder_read_uint16(self_p));
+}
+
+static int32_t decoder_read_int32(struct decoder_t *self_p)
+{
+    return ((int32_t)decoder_read_uint32(self_p));
+}
+
+static uint32_t decoder_read_uint(struct decoder_t *self_p,
+                                  uint8_t number_of_bytes)
+{
+    uint32_t value;
+
+    switch (number_of_bytes) {
+
+    case 1:
+        value = decoder_read_uint8(self_p);
+        break;
+
+    case 2:
+        value = decoder_read_uint16(self_p);
+        break;
+
+    case 3:
+        value = ((uint32_t)decoder_read_uint8(self_p) << 16u);
+        value |= decoder_read_uint16(self_p);
+        break;
+
+    case 4:
+        value = decoder_read_uint32(self_p);
+        break;
+
+    default:
+        value = 0xffffffffu;
+        break;
+    }
+
+    return (value);
+}
+
+static int32_t decoder_read_int(struct decoder_t *self_p,
+                                uint8_t number_of_bytes)
+{
+    int32_t value;
+    uint32_t tmp;
+
+    switch (number_of_bytes) {
+
+    case 1:
+        value = decoder_read_int8(self_p);
+        break;
+
+    case 2:
+        value = decoder_read_int16(self_p);
+        break;
+
+    case 3:
+        tmp = ((uint32_t)decoder_read_uint8(self_p) << 16u);
+        tmp |= decoder_read_uint16(self_p);
+        if((tmp & 0x800000u) == 0x800000u) {
+            tmp += 0xff000000u;
+        }
+        value = (int32_t)tmp;
+        break;
+
+    case 4:
+        value = decoder_read_int32(self_p);
+        break;
+
+    default:
+        value = 2147483647;
+        break;
+    }
+
+    return (value);
+}
+
+static void oer_arrays_arrays_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arrays_arrays_a_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t number_of_length_bytes_2;
+    uint8_t number_of_length_bytes_3;
+    uint8_t number_of_length_bytes_4;
+    uint8_t number_of_length_bytes_5;
+    uint8_t number_of_length_bytes_6;
+    uint8_t number_of_length_bytes_7;
+    uint8_t number_of_length_bytes_8;
+    uint8_t number_of_length_bytes_9;
+
+    number_of_length_bytes = minimum_uint_length(src_p->a.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->a.length,
+                        number_of_length_bytes);
+
+    encoder_append_bytes(encoder_p,
+                         src_p->a.elements,
+                         src_p->a.length);
+
+    number_of_length_bytes_2 = minimum_uint_length(src_p->b.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_2);
+    encoder_append_uint(encoder_p,
+                        src_p->b.length,
+                        number_of_length_bytes_2);
+
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)src_p->b.elements,
+                         src_p->b.length);
+
+    number_of_length_bytes_3 = minimum_uint_length(src_p->c.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_3);
+    encoder_append_uint(encoder_p,
+                        src_p->c.length,
+                        number_of_length_bytes_3);
+
+    encoder_append_uint16_array(encoder_p,
+                                src_p->c.elements,
+                                src_p->c.length);
+
+    number_of_length_bytes_4 = minimum_uint_length(src_p->d.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_4);
+    encoder_append_uint(encoder_p,
+                        src_p->d.length,
+                        number_of_length_bytes_4);
+
+    encoder_append_uint16_array(encoder_p,
+                                (const uint16_t *)src_p->d.elements,
+                                src_p->d.length);
+
+    number_of_length_bytes_5 = minimum_uint_length(src_p->e.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_5);
+    encoder_append_uint(encoder_p,
+                        src_p->e.length,
+                        number_of_length_bytes_5);
+
+    encoder_append_uint32_array(encoder_p,
+                                src_p->e.elements,
+                                src_p->e.length);
+
+    number_of_length_bytes_6 = minimum_uint_length(src_p->f.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_6);
+    encoder_append_uint(encoder_p,
+                        src_p->f.length,
+                        number_of_length_bytes_6);
+
+    encoder_append_uint32_array(encoder_p,
+                                (const uint32_t *)src_p->f.elements,
+                                src_p->f.length);
+
+    number_of_length_bytes_7 = minimum_uint_length(src_p->g.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_7);
+    encoder_append_uint(encoder_p,
+                        src_p->g.length,
+                        number_of_length_bytes_7);
+
+    encoder_append_uint64_array(encoder_p,
+                                src_p->g.elements,
+                                src_p->g.length);
+
+    number_of_length_bytes_8 = minimum_uint_length(src_p->h.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_8);
+    encoder_append_uint(encoder_p,
+                        src_p->h.length,
+                        number_of_length_bytes_8);
+
+    encoder_append_uint64_array(encoder_p,
+                                (const uint64_t *)src_p->h.elements,
+                                src_p->h.length);
+
+    number_of_length_bytes_9 = minimum_uint_length(3);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_9);
+    encoder_append_uint(encoder_p,
+                        3,
+                        number_of_length_bytes_9);
+
+    encoder_append_bool_array(encoder_p,
+                              src_p->i.elements,
+                              3u);
+}
+
+static void oer_arrays_arrays_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_a_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t number_of_length_bytes_2;
+    uint8_t number_of_length_bytes_3;
+    uint8_t number_of_length_bytes_4;
+    uint8_t number_of_length_bytes_5;
+    uint8_t number_of_length_bytes_6;
+    uint8_t number_of_length_bytes_7;
+    uint8_t number_of_length_bytes_8;
+    uint8_t number_of_length_bytes_9;
+    uint8_t length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->a.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->a.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       dst_p->a.elements,
+                       dst_p->a.length);
+
+    number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+    dst_p->b.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_2);
+
+    if (dst_p->b.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)dst_p->b.elements,
+                       dst_p->b.length);
+
+    number_of_length_bytes_3 = decoder_read_uint8(decoder_p);
+    dst_p->c.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_3);
+
+    if (dst_p->c.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint16_array(decoder_p,
+                              dst_p->c.elements,
+                              dst_p->c.length);
+
+    number_of_length_bytes_4 = decoder_read_uint8(decoder_p);
+    dst_p->d.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_4);
+
+    if (dst_p->d.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint16_array(decoder_p,
+                              (uint16_t *)dst_p->d.elements,
+                              dst_p->d.length);
+
+    number_of_length_bytes_5 = decoder_read_uint8(decoder_p);
+    dst_p->e.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_5);
+
+    if (dst_p->e.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint32_array(decoder_p,
+                              dst_p->e.elements,
+                              dst_p->e.length);
+
+    number_of_length_bytes_6 = decoder_read_uint8(decoder_p);
+    dst_p->f.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_6);
+
+    if (dst_p->f.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint32_array(decoder_p,
+                              (uint32_t *)dst_p->f.elements,
+                              dst_p->f.length);
+
+    number_of_length_bytes_7 = decoder_read_uint8(decoder_p);
+    dst_p->g.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_7);
+
+    if (dst_p->g.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint64_array(decoder_p,
+                              dst_p->g.elements,
+                              dst_p->g.length);
+
+    number_of_length_bytes_8 = decoder_read_uint8(decoder_p);
+    dst_p->h.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_8);
+
+    if (dst_p->h.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint64_array(decoder_p,
+                              (uint64_t *)dst_p->h.elements,
+                              dst_p->h.length);
+
+    number_of_length_bytes_9 = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint8(decoder_p);
+
+    if ((number_of_length_bytes_9 != 1u) || (length > 3u)) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bool_array(decoder_p,
+                            dst_p->i.elements,
+                            3u);
+}
+
+static void oer_arrays_arrays_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_a_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length;
+    uint8_t number_of_length_bytes_3;
+    uint8_t number_of_length_bytes_4;
+    uint32_t length_2;
+    uint8_t number_of_length_bytes_5;
+    uint8_t number_of_length_bytes_6;
+    uint32_t length_3;
+    uint8_t number_of_length_bytes_7;
+    uint8_t number_of_length_bytes_8;
+    uint32_t length_4;
+    uint8_t number_of_length_bytes_9;
+    uint8_t number_of_length_bytes_10;
+    uint32_t length_5;
+    uint8_t number_of_length_bytes_11;
+    uint8_t number_of_length_bytes_12;
+    uint32_t length_6;
+    uint8_t number_of_length_bytes_13;
+    uint8_t number_of_length_bytes_14;
+    uint32_t length_7;
+    uint8_t number_of_length_bytes_15;
+    uint8_t number_of_length_bytes_16;
+    uint32_t length_8;
+    uint8_t number_of_length_bytes_17;
+    uint8_t length_9;
+    uint8_t number_of_length_bytes_18;
+    uint32_t length_10;
+
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_A) != 0u) {
+        number_of_length_bytes = decoder_read_uint8(decoder_p);
+        dst_p->a.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes);
+
+        if (dst_p->a.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           dst_p->a.elements,
+                           dst_p->a.length);
+    } else {
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length = decoder_read_uint(decoder_p, number_of_length_bytes_2);
+
+        if (length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length * 1u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_B) != 0u) {
+        number_of_length_bytes_3 = decoder_read_uint8(decoder_p);
+        dst_p->b.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_3);
+
+        if (dst_p->b.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)dst_p->b.elements,
+                           dst_p->b.length);
+    } else {
+        number_of_length_bytes_4 = decoder_read_uint8(decoder_p);
+        length_2 = decoder_read_uint(decoder_p, number_of_length_bytes_4);
+
+        if (length_2 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2 * 1u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_C) != 0u) {
+        number_of_length_bytes_5 = decoder_read_uint8(decoder_p);
+        dst_p->c.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_5);
+
+        if (dst_p->c.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint16_array(decoder_p,
+                                  dst_p->c.elements,
+                                  dst_p->c.length);
+    } else {
+        number_of_length_bytes_6 = decoder_read_uint8(decoder_p);
+        length_3 = decoder_read_uint(decoder_p, number_of_length_bytes_6);
+
+        if (length_3 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3 * 2u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_D) != 0u) {
+        number_of_length_bytes_7 = decoder_read_uint8(decoder_p);
+        dst_p->d.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_7);
+
+        if (dst_p->d.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint16_array(decoder_p,
+                                  (uint16_t *)dst_p->d.elements,
+                                  dst_p->d.length);
+    } else {
+        number_of_length_bytes_8 = decoder_read_uint8(decoder_p);
+        length_4 = decoder_read_uint(decoder_p, number_of_length_bytes_8);
+
+        if (length_4 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_4 * 2u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_E) != 0u) {
+        number_of_length_bytes_9 = decoder_read_uint8(decoder_p);
+        dst_p->e.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_9);
+
+        if (dst_p->e.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint32_array(decoder_p,
+                                  dst_p->e.elements,
+                                  dst_p->e.length);
+    } else {
+        number_of_length_bytes_10 = decoder_read_uint8(decoder_p);
+        length_5 = decoder_read_uint(decoder_p, number_of_length_bytes_10);
+
+        if (length_5 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_5 * 4u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_F) != 0u) {
+        number_of_length_bytes_11 = decoder_read_uint8(decoder_p);
+        dst_p->f.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_11);
+
+        if (dst_p->f.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint32_array(decoder_p,
+                                  (uint32_t *)dst_p->f.elements,
+                                  dst_p->f.length);
+    } else {
+        number_of_length_bytes_12 = decoder_read_uint8(decoder_p);
+        length_6 = decoder_read_uint(decoder_p, number_of_length_bytes_12);
+
+        if (length_6 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_6 * 4u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_G) != 0u) {
+        number_of_length_bytes_13 = decoder_read_uint8(decoder_p);
+        dst_p->g.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_13);
+
+        if (dst_p->g.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint64_array(decoder_p,
+                                  dst_p->g.elements,
+                                  dst_p->g.length);
+    } else {
+        number_of_length_bytes_14 = decoder_read_uint8(decoder_p);
+        length_7 = decoder_read_uint(decoder_p, number_of_length_bytes_14);
+
+        if (length_7 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_7 * 8u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_H) != 0u) {
+        number_of_length_bytes_15 = decoder_read_uint8(decoder_p);
+        dst_p->h.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_15);
+
+        if (dst_p->h.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint64_array(decoder_p,
+                                  (uint64_t *)dst_p->h.elements,
+                                  dst_p->h.length);
+    } else {
+        number_of_length_bytes_16 = decoder_read_uint8(decoder_p);
+        length_8 = decoder_read_uint(decoder_p, number_of_length_bytes_16);
+
+        if (length_8 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_8 * 8u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_A_FIELD_I) != 0u) {
+        number_of_length_bytes_17 = decoder_read_uint8(decoder_p);
+        length_9 = decoder_read_uint8(decoder_p);
+
+        if ((number_of_length_bytes_17 != 1u) || (length_9 > 3u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bool_array(decoder_p,
+                                dst_p->i.elements,
+                                3u);
+    } else {
+        number_of_length_bytes_18 = decoder_read_uint8(decoder_p);
+        length_10 = decoder_read_uint8(decoder_p);
+
+        if ((number_of_length_bytes_18 != 1u) || (length_10 > 3u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 3u * 1u);
+    }
+}
+
+static void oer_arrays_arrays_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length_2;
+    uint8_t number_of_length_bytes_3;
+    uint32_t length_3;
+    uint8_t number_of_length_bytes_4;
+    uint32_t length_4;
+    uint8_t number_of_length_bytes_5;
+    uint32_t length_5;
+    uint8_t number_of_length_bytes_6;
+    uint32_t length_6;
+    uint8_t number_of_length_bytes_7;
+    uint32_t length_7;
+    uint8_t number_of_length_bytes_8;
+    uint32_t length_8;
+    uint8_t number_of_length_bytes_9;
+    uint32_t length_9;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 1u);
+    number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+    length_2 = decoder_read_uint(decoder_p, number_of_length_bytes_2);
+
+    if (length_2 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2 * 1u);
+    number_of_length_bytes_3 = decoder_read_uint8(decoder_p);
+    length_3 = decoder_read_uint(decoder_p, number_of_length_bytes_3);
+
+    if (length_3 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_3 * 2u);
+    number_of_length_bytes_4 = decoder_read_uint8(decoder_p);
+    length_4 = decoder_read_uint(decoder_p, number_of_length_bytes_4);
+
+    if (length_4 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_4 * 2u);
+    number_of_length_bytes_5 = decoder_read_uint8(decoder_p);
+    length_5 = decoder_read_uint(decoder_p, number_of_length_bytes_5);
+
+    if (length_5 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_5 * 4u);
+    number_of_length_bytes_6 = decoder_read_uint8(decoder_p);
+    length_6 = decoder_read_uint(decoder_p, number_of_length_bytes_6);
+
+    if (length_6 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_6 * 4u);
+    number_of_length_bytes_7 = decoder_read_uint8(decoder_p);
+    length_7 = decoder_read_uint(decoder_p, number_of_length_bytes_7);
+
+    if (length_7 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_7 * 8u);
+    number_of_length_bytes_8 = decoder_read_uint8(decoder_p);
+    length_8 = decoder_read_uint(decoder_p, number_of_length_bytes_8);
+
+    if (length_8 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_8 * 8u);
+    number_of_length_bytes_9 = decoder_read_uint8(decoder_p);
+    length_9 = decoder_read_uint8(decoder_p);
+
+    if ((number_of_length_bytes_9 != 1u) || (length_9 > 3u)) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 3u * 1u);
+}
+
+static void oer_arrays_arrays_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arrays_arrays_b_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    encoder_append_uint16_array(encoder_p,
+                                src_p->elements,
+                                src_p->length);
+}
+
+static void oer_arrays_arrays_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_b_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 4096u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint16_array(decoder_p,
+                              dst_p->elements,
+                              dst_p->length);
+}
+
+static void oer_arrays_arrays_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 4096u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 2u);
+}
+
+static void oer_arrays_arrays_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arrays_arrays_c_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    encoder_append_bytes(encoder_p,
+                         src_p->elements,
+                         src_p->length);
+}
+
+static void oer_arrays_arrays_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_c_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       dst_p->elements,
+                       dst_p->length);
+}
+
+static void oer_arrays_arrays_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 1u);
+}
+
+static void oer_arrays_arrays_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arrays_arrays_d_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t enum_length;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        enum_length = enumerated_value_length(src_p->elements[i]);
+
+        if (enum_length != 0u) {
+            encoder_append_uint8(encoder_p, 0x80u | enum_length);
+            encoder_append_int(encoder_p, (int32_t)src_p->elements[i], enum_length);
+        }
+        else {
+            encoder_append_uint8(encoder_p, (uint8_t)src_p->elements[i]);
+        }
+    }
+}
+
+static void oer_arrays_arrays_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_d_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t enum_length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 100u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        enum_length = decoder_read_uint8(decoder_p);
+
+        if ((enum_length & 0x80u) == 0x80u) {
+            enum_length &= 0x7fu;
+
+            if ((enum_length > 1u) || (enum_length == 0u)) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+            dst_p->elements[i] = (enum oer_arrays_arrays_d_e)decoder_read_int(decoder_p, enum_length);
+        }
+        else {
+            dst_p->elements[i] = (enum oer_arrays_arrays_d_e)enum_length;
+        }
+    }
+}
+
+static void oer_arrays_arrays_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+    uint8_t enum_length;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 100u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        enum_length = decoder_read_uint8(decoder_p);
+
+        if ((enum_length & 0x80u) == 0x80u) {
+            enum_length &= 0x7fu;
+
+            if ((enum_length > 1u) || (enum_length == 0u)) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, enum_length);
+        }
+    }
+}
+
+static void oer_arrays_arrays_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_arrays_arrays_e_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t number_of_length_bytes_2;
+    uint8_t number_of_length_bytes_3;
+
+    number_of_length_bytes = minimum_uint_length(20);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        20,
+                        number_of_length_bytes);
+
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)src_p->a.elements,
+                         20u);
+
+    number_of_length_bytes_2 = minimum_uint_length(src_p->b.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_2);
+    encoder_append_uint(encoder_p,
+                        src_p->b.length,
+                        number_of_length_bytes_2);
+
+    encoder_append_bool_array(encoder_p,
+                              src_p->b.elements,
+                              src_p->b.length);
+
+    number_of_length_bytes_3 = minimum_uint_length(src_p->c.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes_3);
+    encoder_append_uint(encoder_p,
+                        src_p->c.length,
+                        number_of_length_bytes_3);
+
+    encoder_append_uint16_array(encoder_p,
+                                src_p->c.elements,
+                                src_p->c.length);
+}
+
+static void oer_arrays_arrays_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_e_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t length;
+    uint8_t number_of_length_bytes_2;
+    uint8_t number_of_length_bytes_3;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint8(decoder_p);
+
+    if ((number_of_length_bytes != 1u) || (length > 20u)) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)dst_p->a.elements,
+                       20u);
+
+    number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+    dst_p->b.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_2);
+
+    if (dst_p->b.length > 70u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bool_array(decoder_p,
+                            dst_p->b.elements,
+                            dst_p->b.length);
+
+    number_of_length_bytes_3 = decoder_read_uint8(decoder_p);
+    dst_p->c.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes_3);
+
+    if (dst_p->c.length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_uint16_array(decoder_p,
+                              dst_p->c.elements,
+                              dst_p->c.length);
+}
+
+static void oer_arrays_arrays_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_arrays_arrays_e_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t length;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length_2;
+    uint8_t number_of_length_bytes_3;
+    uint8_t number_of_length_bytes_4;
+    uint32_t length_3;
+    uint8_t number_of_length_bytes_5;
+    uint8_t number_of_length_bytes_6;
+    uint32_t length_4;
+
+    if ((fields & OER_ARRAYS_ARRAYS_E_FIELD_A) != 0u) {
+        number_of_length_bytes = decoder_read_uint8(decoder_p);
+        length = decoder_read_uint8(decoder_p);
+
+        if ((number_of_length_bytes != 1u) || (length > 20u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)dst_p->a.elements,
+                           20u);
+    } else {
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length_2 = decoder_read_uint8(decoder_p);
+
+        if ((number_of_length_bytes_2 != 1u) || (length_2 > 20u)) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 20u * 1u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_E_FIELD_B) != 0u) {
+        number_of_length_bytes_3 = decoder_read_uint8(decoder_p);
+        dst_p->b.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_3);
+
+        if (dst_p->b.length > 70u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bool_array(decoder_p,
+                                dst_p->b.elements,
+                                dst_p->b.length);
+    } else {
+        number_of_length_bytes_4 = decoder_read_uint8(decoder_p);
+        length_3 = decoder_read_uint(decoder_p, number_of_length_bytes_4);
+
+        if (length_3 > 70u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3 * 1u);
+    }
+    if ((fields & OER_ARRAYS_ARRAYS_E_FIELD_C) != 0u) {
+        number_of_length_bytes_5 = decoder_read_uint8(decoder_p);
+        dst_p->c.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes_5);
+
+        if (dst_p->c.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_uint16_array(decoder_p,
+                                  dst_p->c.elements,
+                                  dst_p->c.length);
+    } else {
+        number_of_length_bytes_6 = decoder_read_uint8(decoder_p);
+        length_4 = decoder_read_uint(decoder_p, number_of_length_bytes_6);
+
+        if (length_4 > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_4 * 2u);
+    }
+}
+
+static void oer_arrays_arrays_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length_2;
+    uint8_t number_of_length_bytes_3;
+    uint32_t length_3;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint8(decoder_p);
+
+    if ((number_of_length_bytes != 1u) || (length > 20u)) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 20u * 1u);
+    number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+    length_2 = decoder_read_uint(decoder_p, number_of_length_bytes_2);
+
+    if (length_2 > 70u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2 * 1u);
+    number_of_length_bytes_3 = decoder_read_uint8(decoder_p);
+    length_3 = decoder_read_uint(decoder_p, number_of_length_bytes_3);
+
+    if (length_3 > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_3 * 2u);
+}
+
+ssize_t oer_arrays_arrays_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arrays_arrays_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_a_encoded_size(
+    const struct oer_arrays_arrays_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arrays_arrays_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_a_decode(
+    struct oer_arrays_arrays_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arrays_arrays_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_a_decode_batch(
+    struct oer_arrays_arrays_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_arrays_arrays_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_a_decode_fields(
+    struct oer_arrays_arrays_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arrays_arrays_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_b_encoded_size(
+    const struct oer_arrays_arrays_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arrays_arrays_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_b_decode(
+    struct oer_arrays_arrays_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arrays_arrays_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_b_decode_batch(
+    struct oer_arrays_arrays_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_arrays_arrays_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arrays_arrays_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_c_encoded_size(
+    const struct oer_arrays_arrays_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arrays_arrays_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_c_decode(
+    struct oer_arrays_arrays_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arrays_arrays_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_c_decode_batch(
+    struct oer_arrays_arrays_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_arrays_arrays_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arrays_arrays_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_d_encoded_size(
+    const struct oer_arrays_arrays_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arrays_arrays_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_d_decode(
+    struct oer_arrays_arrays_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arrays_arrays_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_d_decode_batch(
+    struct oer_arrays_arrays_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_arrays_arrays_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_arrays_arrays_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_e_encoded_size(
+    const struct oer_arrays_arrays_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_arrays_arrays_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_arrays_arrays_e_decode(
+    struct oer_arrays_arrays_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_arrays_arrays_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_arrays_arrays_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_arrays_arrays_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_e_decode_batch(
+    struct oer_arrays_arrays_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_arrays_arrays_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_arrays_arrays_e_decode_fields(
+    struct oer_arrays_arrays_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_arrays_arrays_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
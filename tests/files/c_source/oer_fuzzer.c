@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.162.0 Thu May  5 07:13:05 2022.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 10:27:52 2026.
  */
 
 #include <stdint.h>
@@ -44,6 +44,16 @@ static void assert_first_encode(ssize_t res)
     }
 }
 
+static void assert_encoded_size(ssize_t res, ssize_t size)
+{
+    if (res != size) {
+        printf("Encoded size %ld does not match first encode result %ld.\n",
+               size,
+               res);
+        __builtin_trap();
+    }
+}
+
 static void assert_second_decode(ssize_t res)
 {
     if (res < 0) {
@@ -115,6 +125,7 @@ static void test_oer_c_ref_at(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_ref_at_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -164,6 +175,7 @@ static void test_oer_c_ref_referenced_enum(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_ref_referenced_enum_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -213,6 +225,7 @@ static void test_oer_c_ref_referenced_int(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_ref_referenced_int_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -262,6 +275,7 @@ static void test_oer_c_ref_referenced_sequence(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_ref_referenced_sequence_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -311,6 +325,7 @@ static void test_oer_c_source_a(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_a_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -360,6 +375,7 @@ static void test_oer_c_source_ab(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ab_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -409,6 +425,7 @@ static void test_oer_c_source_ac(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ac_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -458,6 +475,7 @@ static void test_oer_c_source_ad(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ad_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -507,6 +525,7 @@ static void test_oer_c_source_ae(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ae_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -556,6 +575,7 @@ static void test_oer_c_source_af(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_af_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -605,6 +625,7 @@ static void test_oer_c_source_ag(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ag_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -654,6 +675,7 @@ static void test_oer_c_source_ah(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ah_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -703,6 +725,7 @@ static void test_oer_c_source_ai(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ai_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -752,6 +775,7 @@ static void test_oer_c_source_aj(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_aj_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -801,6 +825,7 @@ static void test_oer_c_source_ak(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ak_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -850,6 +875,7 @@ static void test_oer_c_source_al(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_al_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -899,6 +925,7 @@ static void test_oer_c_source_am(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_am_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -948,6 +975,7 @@ static void test_oer_c_source_an(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_an_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -997,6 +1025,7 @@ static void test_oer_c_source_ao(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ao_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1046,6 +1075,7 @@ static void test_oer_c_source_ap(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ap_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1095,6 +1125,7 @@ static void test_oer_c_source_aq(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_aq_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1144,6 +1175,7 @@ static void test_oer_c_source_ar(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_ar_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1193,6 +1225,7 @@ static void test_oer_c_source_as(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_as_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1242,6 +1275,7 @@ static void test_oer_c_source_b(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_b_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1291,6 +1325,7 @@ static void test_oer_c_source_c(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_c_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1340,6 +1375,7 @@ static void test_oer_c_source_d(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_d_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1389,6 +1425,7 @@ static void test_oer_c_source_e(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_e_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1438,6 +1475,7 @@ static void test_oer_c_source_f(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_f_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1487,6 +1525,7 @@ static void test_oer_c_source_g(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_g_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1536,6 +1575,7 @@ static void test_oer_c_source_h(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_h_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1585,6 +1625,7 @@ static void test_oer_c_source_i(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_i_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1634,6 +1675,7 @@ static void test_oer_c_source_j(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_j_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1683,6 +1725,7 @@ static void test_oer_c_source_k(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_k_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1732,6 +1775,7 @@ static void test_oer_c_source_l(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_l_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1781,6 +1825,7 @@ static void test_oer_c_source_m(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_m_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1830,6 +1875,7 @@ static void test_oer_c_source_n(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_n_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1879,6 +1925,7 @@ static void test_oer_c_source_o(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_o_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1928,6 +1975,7 @@ static void test_oer_c_source_p(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_p_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -1977,6 +2025,7 @@ static void test_oer_c_source_q(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_q_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2026,6 +2075,7 @@ static void test_oer_c_source_r(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_r_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2075,6 +2125,7 @@ static void test_oer_c_source_s(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_s_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2124,6 +2175,7 @@ static void test_oer_c_source_t(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_t_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2173,6 +2225,7 @@ static void test_oer_c_source_u(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_u_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2222,6 +2275,7 @@ static void test_oer_c_source_v(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_v_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2271,6 +2325,7 @@ static void test_oer_c_source_w(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_w_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2320,6 +2375,7 @@ static void test_oer_c_source_x(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_x_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2369,6 +2425,7 @@ static void test_oer_c_source_y(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_y_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2418,6 +2475,7 @@ static void test_oer_c_source_z(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_c_source_z_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2467,6 +2525,7 @@ static void test_oer_programming_types_bool(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_bool_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2516,6 +2575,7 @@ static void test_oer_programming_types_double(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_double_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2565,6 +2625,7 @@ static void test_oer_programming_types_float(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_float_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2614,6 +2675,7 @@ static void test_oer_programming_types_int16(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_int16_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2663,6 +2725,7 @@ static void test_oer_programming_types_int32(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_int32_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2712,6 +2775,7 @@ static void test_oer_programming_types_int64(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_int64_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2761,6 +2825,7 @@ static void test_oer_programming_types_int8(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_int8_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2810,6 +2875,7 @@ static void test_oer_programming_types_uint16(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_uint16_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2859,6 +2925,7 @@ static void test_oer_programming_types_uint32(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_uint32_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2908,6 +2975,7 @@ static void test_oer_programming_types_uint64(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_uint64_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
@@ -2957,6 +3025,7 @@ static void test_oer_programming_types_uint8(
             &decoded);
 
         assert_first_encode(res);
+        assert_encoded_size(res, oer_programming_types_uint8_encoded_size(&decoded));
 
         memset(&decoded2, 0, sizeof(decoded2));
 
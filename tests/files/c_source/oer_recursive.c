@@ -0,0 +1,2123 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:21 2026.
+ */
+
+#include <string.h>
+
+#include "oer_recursive.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    int remaining_depth;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    struct oer_recursive_arena_t *arena_p;
+    int remaining_depth;
+};
+
+
+static uint8_t minimum_uint_length(uint32_t value)
+{
+    uint8_t length;
+
+    if (value < 256u) {
+        length = 1;
+    } else if (value < 65536u) {
+        length = 2;
+    } else if (value < 16777216u) {
+        length = 3;
+    } else {
+        length = 4;
+    }
+
+    return (length);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->remaining_depth = OER_RECURSIVE_MAX_RECURSION_DEPTH;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static bool encoder_enter(struct encoder_t *self_p, const void *value_p)
+{
+    if (value_p == NULL) {
+        encoder_abort(self_p, EINVAL);
+
+        return (false);
+    }
+
+    if (self_p->remaining_depth == 0) {
+        encoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}
+
+static void encoder_leave(struct encoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_append_uint8(struct encoder_t *self_p,
+                                 uint8_t value)
+{
+    encoder_append_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_append_uint16(struct encoder_t *self_p,
+                                  uint16_t value)
+{
+    uint8_t buf[2];
+
+    buf[0] = (uint8_t)(value >> 8);
+    buf[1] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_uint32(struct encoder_t *self_p,
+                                  uint32_t value)
+{
+    uint8_t buf[4];
+
+    buf[0] = (uint8_t)(value >> 24);
+    buf[1] = (uint8_t)(value >> 16);
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_uint(struct encoder_t *self_p,
+                                uint32_t value,
+                                uint8_t number_of_bytes)
+{
+    switch (number_of_bytes) {
+
+    case 1:
+        encoder_append_uint8(self_p, (uint8_t)value);
+        break;
+
+    case 2:
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    case 3:
+        encoder_append_uint8(self_p, (uint8_t)(value >> 16));
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    default:
+        encoder_append_uint32(self_p, value);
+        break;
+    }
+}
+
+static void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_uint8(self_p, value ? 255u : 0u);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->remaining_depth = OER_RECURSIVE_MAX_RECURSION_DEPTH;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static void *decoder_arena_alloc(struct decoder_t *self_p, size_t size)
+{
+    size_t pos;
+
+    /* Keep all allocations aligned for any member type. */
+    pos = ((self_p->arena_p->pos + 7u) & ~(size_t)7u);
+
+    if ((pos > self_p->arena_p->size)
+        || (size > (self_p->arena_p->size - pos))) {
+        decoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    self_p->arena_p->pos = (pos + size);
+
+    return (&self_p->arena_p->buf[pos]);
+}
+
+static bool decoder_enter(struct decoder_t *self_p)
+{
+    if (self_p->remaining_depth == 0) {
+        decoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}
+
+static void decoder_leave(struct decoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    uint8_t buf[2];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (uint16_t)(((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+}
+
+static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    uint8_t buf[4];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (((uint32_t)buf[0] << 24)
+            | ((uint32_t)buf[1] << 16)
+            | ((uint32_t)buf[2] << 8)
+            | (uint32_t)buf[3]);
+}
+
+static uint32_t decoder_read_uint(struct decoder_t *self_p,
+                                  uint8_t number_of_bytes)
+{
+    uint32_t value;
+
+    switch (number_of_bytes) {
+
+    case 1:
+        value = decoder_read_uint8(self_p);
+        break;
+
+    case 2:
+        value = decoder_read_uint16(self_p);
+        break;
+
+    case 3:
+        value = ((uint32_t)decoder_read_uint8(self_p) << 16u);
+        value |= decoder_read_uint16(self_p);
+        break;
+
+    case 4:
+        value = decoder_read_uint32(self_p);
+        break;
+
+    default:
+        value = 0xffffffffu;
+        break;
+    }
+
+    return (value);
+}
+
+static bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_uint8(self_p) != 0u);
+}
+
+static uint32_t decoder_read_tag(struct decoder_t *self_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_uint8(self_p);
+
+    if ((tag & 0x3fu) == 0x3fu) {
+        do {
+            tag <<= 8;
+            tag |= (uint32_t)decoder_read_uint8(self_p);
+        } while ((tag & 0x80u) == 0x80u);
+    }
+
+    return (tag);
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    int remaining_depth;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->remaining_depth = OER_RECURSIVE_MAX_RECURSION_DEPTH;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static bool jer_encoder_enter(struct jer_encoder_t *self_p,
+                              const void *value_p)
+{
+    if (value_p == NULL) {
+        jer_encoder_abort(self_p, EINVAL);
+
+        return (false);
+    }
+
+    if (self_p->remaining_depth == 0) {
+        jer_encoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}
+
+static void jer_encoder_leave(struct jer_encoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_uint(struct jer_encoder_t *self_p,
+                                    uint64_t value)
+{
+    static const char digits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    uint8_t *buf_p;
+    uint64_t power;
+    size_t number_of_digits;
+    size_t i;
+
+    number_of_digits = 1;
+    power = 10;
+
+    while ((number_of_digits < 20) && (value >= power)) {
+        number_of_digits++;
+        power *= 10;
+    }
+
+    buf_p = jer_encoder_alloc(self_p, number_of_digits);
+
+    if (buf_p == NULL) {
+        return;
+    }
+
+    /* Two digits at a time from the end. */
+    i = number_of_digits;
+
+    while (value >= 100) {
+        i -= 2;
+        (void)memcpy(&buf_p[i], &digits[2 * (value % 100)], 2);
+        value /= 100;
+    }
+
+    if (value >= 10) {
+        (void)memcpy(&buf_p[0], &digits[2 * value], 2);
+    } else {
+        buf_p[0] = (uint8_t)('0' + value);
+    }
+}
+
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}
+
+static void jer_encoder_append_hex(struct jer_encoder_t *self_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    uint8_t *dst_p;
+    size_t i;
+
+    dst_p = jer_encoder_alloc(self_p, 2 * size + 2);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    dst_p[0] = '"';
+
+    for (i = 0; i < size; i++) {
+        dst_p[2 * i + 1] = (uint8_t)digits[buf_p[i] >> 4];
+        dst_p[2 * i + 2] = (uint8_t)digits[buf_p[i] & 0xf];
+    }
+
+    dst_p[2 * size + 1] = '"';
+}
+
+static void oer_recursive_recursive_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_a_t *src_p);
+
+static void oer_recursive_recursive_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_a_t *dst_p);
+
+static void oer_recursive_recursive_a_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void oer_recursive_recursive_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_b_t *src_p);
+
+static void oer_recursive_recursive_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_b_t *dst_p);
+
+static void oer_recursive_recursive_b_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void oer_recursive_recursive_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_c_t *src_p);
+
+static void oer_recursive_recursive_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_c_t *dst_p);
+
+static void oer_recursive_recursive_c_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void oer_recursive_recursive_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_d_t *src_p);
+
+static void oer_recursive_recursive_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_d_t *dst_p);
+
+static void oer_recursive_recursive_d_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void oer_recursive_recursive_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_e_t *src_p);
+
+static void oer_recursive_recursive_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_e_t *dst_p);
+
+static void oer_recursive_recursive_e_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void oer_recursive_recursive_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_a_t *src_p)
+{
+    uint8_t present_mask[1];
+
+    present_mask[0] = 0;
+
+    if (src_p->is_b_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_uint8(encoder_p, src_p->a);
+
+    if (src_p->is_b_present) {
+        if (encoder_enter(encoder_p, src_p->b)) {
+            oer_recursive_recursive_a_encode_inner(encoder_p, src_p->b);
+            encoder_leave(encoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_a_t *dst_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_b_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    dst_p->a = decoder_read_uint8(decoder_p);
+
+    if (dst_p->is_b_present) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->b = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->b));
+
+            if (dst_p->b != NULL) {
+                oer_recursive_recursive_a_decode_inner(decoder_p, dst_p->b);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_a_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_b_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if ((fields & OER_RECURSIVE_RECURSIVE_A_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & OER_RECURSIVE_RECURSIVE_A_FIELD_B) != 0u) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->b = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->b));
+
+                if (dst_p->b != NULL) {
+                    oer_recursive_recursive_a_decode_inner(decoder_p, dst_p->b);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        } else {
+            if (decoder_enter(decoder_p)) {
+                oer_recursive_recursive_a_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+}
+
+static void oer_recursive_recursive_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 1u);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        if (decoder_enter(decoder_p)) {
+            oer_recursive_recursive_a_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_b_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    encoder_append_bool(encoder_p, src_p->a);
+    number_of_length_bytes = minimum_uint_length(src_p->b.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->b.length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->b.length; i++) {
+        if (encoder_enter(encoder_p, src_p->b.elements[i])) {
+            oer_recursive_recursive_b_encode_inner(encoder_p, src_p->b.elements[i]);
+            encoder_leave(encoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_b_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    dst_p->a = decoder_read_bool(decoder_p);
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->b.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->b.length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->b.length; i++) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->b.elements[i] = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->b.elements[i]));
+
+            if (dst_p->b.elements[i] != NULL) {
+                oer_recursive_recursive_b_decode_inner(decoder_p, dst_p->b.elements[i]);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_b_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length;
+    uint32_t i_2;
+
+    if ((fields & OER_RECURSIVE_RECURSIVE_B_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_RECURSIVE_RECURSIVE_B_FIELD_B) != 0u) {
+        number_of_length_bytes = decoder_read_uint8(decoder_p);
+        dst_p->b.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes);
+
+        if (dst_p->b.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i = 0; i < dst_p->b.length; i++) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->b.elements[i] = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->b.elements[i]));
+
+                if (dst_p->b.elements[i] != NULL) {
+                    oer_recursive_recursive_b_decode_inner(decoder_p, dst_p->b.elements[i]);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        }
+    } else {
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length = decoder_read_uint(decoder_p, number_of_length_bytes_2);
+
+        if (length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_2 = 0; i_2 < length; i_2++) {
+            if (decoder_enter(decoder_p)) {
+                oer_recursive_recursive_b_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+}
+
+static void oer_recursive_recursive_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+
+    (void)decoder_free(decoder_p, 1u);
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        if (decoder_enter(decoder_p)) {
+            oer_recursive_recursive_b_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_c_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case oer_recursive_recursive_c_choice_a_e:
+        encoder_append_uint(encoder_p, 0x80, 1);
+        encoder_append_uint8(encoder_p, src_p->value.a);
+        break;
+
+    case oer_recursive_recursive_c_choice_b_e:
+        encoder_append_uint(encoder_p, 0x81, 1);
+
+        if (encoder_enter(encoder_p, src_p->value.b.a)) {
+            oer_recursive_recursive_c_encode_inner(encoder_p, src_p->value.b.a);
+            encoder_leave(encoder_p);
+        }
+
+        if (encoder_enter(encoder_p, src_p->value.b.b)) {
+            oer_recursive_recursive_c_encode_inner(encoder_p, src_p->value.b.b);
+            encoder_leave(encoder_p);
+        }
+
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_recursive_recursive_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_c_t *dst_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        dst_p->choice = oer_recursive_recursive_c_choice_a_e;
+        dst_p->value.a = decoder_read_uint8(decoder_p);
+        break;
+
+    case 0x81:
+        dst_p->choice = oer_recursive_recursive_c_choice_b_e;
+
+        if (decoder_enter(decoder_p)) {
+            dst_p->value.b.a = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->value.b.a));
+
+            if (dst_p->value.b.a != NULL) {
+                oer_recursive_recursive_c_decode_inner(decoder_p, dst_p->value.b.a);
+            }
+
+            decoder_leave(decoder_p);
+        }
+
+        if (decoder_enter(decoder_p)) {
+            dst_p->value.b.b = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->value.b.b));
+
+            if (dst_p->value.b.b != NULL) {
+                oer_recursive_recursive_c_decode_inner(decoder_p, dst_p->value.b.b);
+            }
+
+            decoder_leave(decoder_p);
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_recursive_recursive_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 0x81:
+        if (decoder_enter(decoder_p)) {
+            oer_recursive_recursive_c_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+
+        if (decoder_enter(decoder_p)) {
+            oer_recursive_recursive_c_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_recursive_recursive_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_d_t *src_p)
+{
+    uint8_t present_mask[1];
+
+    present_mask[0] = 0;
+
+    if (src_p->is_b_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_uint8(encoder_p, src_p->a.length);
+    encoder_append_bytes(encoder_p,
+                         &src_p->a.buf[0],
+                         src_p->a.length);
+
+    if (src_p->is_b_present) {
+        if (encoder_enter(encoder_p, src_p->b)) {
+            oer_recursive_recursive_e_encode_inner(encoder_p, src_p->b);
+            encoder_leave(encoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_d_t *dst_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_b_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    dst_p->a.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->a.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->a.buf[0],
+                       dst_p->a.length);
+
+    if (dst_p->is_b_present) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->b = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->b));
+
+            if (dst_p->b != NULL) {
+                oer_recursive_recursive_e_decode_inner(decoder_p, dst_p->b);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_d_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_d_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_b_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if ((fields & OER_RECURSIVE_RECURSIVE_D_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->a.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        length = decoder_read_uint8(decoder_p);
+
+        if (length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & OER_RECURSIVE_RECURSIVE_D_FIELD_B) != 0u) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->b = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->b));
+
+                if (dst_p->b != NULL) {
+                    oer_recursive_recursive_e_decode_inner(decoder_p, dst_p->b);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        } else {
+            if (decoder_enter(decoder_p)) {
+                oer_recursive_recursive_e_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+}
+
+static void oer_recursive_recursive_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        if (decoder_enter(decoder_p)) {
+            oer_recursive_recursive_e_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void oer_recursive_recursive_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_recursive_recursive_e_t *src_p)
+{
+    uint8_t present_mask[1];
+
+    present_mask[0] = 0;
+
+    if (src_p->is_a_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    if (src_p->is_a_present) {
+        if (encoder_enter(encoder_p, src_p->a)) {
+            oer_recursive_recursive_d_encode_inner(encoder_p, src_p->a);
+            encoder_leave(encoder_p);
+        }
+    }
+
+    encoder_append_uint8(encoder_p, src_p->b);
+}
+
+static void oer_recursive_recursive_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_e_t *dst_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->a = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->a));
+
+            if (dst_p->a != NULL) {
+                oer_recursive_recursive_d_decode_inner(decoder_p, dst_p->a);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+
+    dst_p->b = decoder_read_uint8(decoder_p);
+}
+
+static void oer_recursive_recursive_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_recursive_recursive_e_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & OER_RECURSIVE_RECURSIVE_E_FIELD_A) != 0u) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->a = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->a));
+
+                if (dst_p->a != NULL) {
+                    oer_recursive_recursive_d_decode_inner(decoder_p, dst_p->a);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        } else {
+            if (decoder_enter(decoder_p)) {
+                oer_recursive_recursive_d_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+
+    if ((fields & OER_RECURSIVE_RECURSIVE_E_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_recursive_recursive_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        if (decoder_enter(decoder_p)) {
+            oer_recursive_recursive_d_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+    (void)decoder_free(decoder_p, 1u);
+}
+
+ssize_t oer_recursive_recursive_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_a_encoded_size(
+    const struct oer_recursive_recursive_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_recursive_recursive_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_a_decode(
+    struct oer_recursive_recursive_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_recursive_recursive_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_recursive_recursive_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_a_decode_batch(
+    struct oer_recursive_recursive_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_recursive_recursive_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_a_decode_fields(
+    struct oer_recursive_recursive_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_b_encoded_size(
+    const struct oer_recursive_recursive_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_recursive_recursive_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_b_decode(
+    struct oer_recursive_recursive_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_recursive_recursive_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_recursive_recursive_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_b_decode_batch(
+    struct oer_recursive_recursive_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_recursive_recursive_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_b_decode_fields(
+    struct oer_recursive_recursive_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_c_encoded_size(
+    const struct oer_recursive_recursive_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_recursive_recursive_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_c_decode(
+    struct oer_recursive_recursive_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_recursive_recursive_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_recursive_recursive_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_c_decode_batch(
+    struct oer_recursive_recursive_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_recursive_recursive_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_d_encoded_size(
+    const struct oer_recursive_recursive_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_recursive_recursive_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_d_decode(
+    struct oer_recursive_recursive_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_recursive_recursive_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_recursive_recursive_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_d_decode_batch(
+    struct oer_recursive_recursive_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_recursive_recursive_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_d_decode_fields(
+    struct oer_recursive_recursive_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_d_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_e_encoded_size(
+    const struct oer_recursive_recursive_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_recursive_recursive_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_e_decode(
+    struct oer_recursive_recursive_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_recursive_recursive_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_recursive_recursive_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_recursive_recursive_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_e_decode_batch(
+    struct oer_recursive_recursive_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        oer_recursive_recursive_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_recursive_recursive_e_decode_fields(
+    struct oer_recursive_recursive_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    oer_recursive_recursive_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+static void oer_recursive_recursive_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_a_t *src_p);
+
+static void oer_recursive_recursive_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_b_t *src_p);
+
+static void oer_recursive_recursive_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_c_t *src_p);
+
+static void oer_recursive_recursive_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_d_t *src_p);
+
+static void oer_recursive_recursive_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_e_t *src_p);
+
+static void oer_recursive_recursive_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_a_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_uint(encoder_p, (uint64_t)src_p->a);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+
+        if (jer_encoder_enter(encoder_p, src_p->b)) {
+            oer_recursive_recursive_a_encode_jer_inner(encoder_p, src_p->b);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void oer_recursive_recursive_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_b_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_bool(encoder_p, src_p->a);
+    jer_encoder_append_string(encoder_p, ",\"b\":[", 6);
+
+    for (i = 0; i < src_p->b.length; i++) {
+        if (jer_encoder_enter(encoder_p, src_p->b.elements[i])) {
+            oer_recursive_recursive_b_encode_jer_inner(encoder_p, src_p->b.elements[i]);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void oer_recursive_recursive_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_c_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case oer_recursive_recursive_c_choice_a_e:
+        jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+        jer_encoder_append_uint(encoder_p, (uint64_t)src_p->value.a);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    case oer_recursive_recursive_c_choice_b_e:
+        jer_encoder_append_string(encoder_p, "{\"b\":{\"a\":", 10);
+
+        if (jer_encoder_enter(encoder_p, src_p->value.b.a)) {
+            oer_recursive_recursive_c_encode_jer_inner(encoder_p, src_p->value.b.a);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_string(encoder_p, ",\"b\":", 5);
+
+        if (jer_encoder_enter(encoder_p, src_p->value.b.b)) {
+            oer_recursive_recursive_c_encode_jer_inner(encoder_p, src_p->value.b.b);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+        jer_encoder_close(encoder_p, '}');
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    default:
+        jer_encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_recursive_recursive_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_d_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_hex(encoder_p, src_p->a.buf, src_p->a.length);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+
+        if (jer_encoder_enter(encoder_p, src_p->b)) {
+            oer_recursive_recursive_e_encode_jer_inner(encoder_p, src_p->b);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void oer_recursive_recursive_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_recursive_recursive_e_t *src_p)
+{
+    jer_encoder_append_char(encoder_p, '{');
+
+    if (src_p->is_a_present) {
+        jer_encoder_append_string(encoder_p, "\"a\":", 4);
+
+        if (jer_encoder_enter(encoder_p, src_p->a)) {
+            oer_recursive_recursive_d_encode_jer_inner(encoder_p, src_p->a);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_append_string(encoder_p, "\"b\":", 4);
+    jer_encoder_append_uint(encoder_p, (uint64_t)src_p->b);
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+ssize_t oer_recursive_recursive_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_recursive_recursive_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_e_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_recursive_recursive_e_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
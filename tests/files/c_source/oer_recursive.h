@@ -0,0 +1,813 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:36:23 2026.
+ */
+
+#ifndef OER_RECURSIVE_H
+#define OER_RECURSIVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Maximum nesting depth of recursive types. Deeper values are neither
+ * encoded nor decoded, but fail with EBADDEPTH.
+ */
+#ifndef OER_RECURSIVE_MAX_RECURSION_DEPTH
+#    define OER_RECURSIVE_MAX_RECURSION_DEPTH 32
+#endif
+
+/**
+ * Memory the decoders allocate SEQUENCE OF elements and OCTET STRING
+ * data from. Reset pos to zero to free everything allocated from it.
+ */
+struct oer_recursive_arena_t {
+    uint8_t *buf;
+    size_t size;
+    size_t pos;
+};
+
+/**
+ * Type A in module Recursive.
+ */
+struct oer_recursive_recursive_a_t {
+    uint8_t a;
+    bool is_b_present;
+    struct oer_recursive_recursive_a_t *b;
+};
+
+/**
+ * Type B in module Recursive.
+ */
+struct oer_recursive_recursive_b_t {
+    bool a;
+    struct {
+        uint8_t length;
+        struct oer_recursive_recursive_b_t *elements[4];
+    } b;
+};
+
+/**
+ * Type C in module Recursive.
+ */
+enum oer_recursive_recursive_c_choice_e {
+    oer_recursive_recursive_c_choice_a_e,
+    oer_recursive_recursive_c_choice_b_e
+};
+
+struct oer_recursive_recursive_c_t {
+    enum oer_recursive_recursive_c_choice_e choice;
+    union {
+        uint8_t a;
+        struct {
+            struct oer_recursive_recursive_c_t *a;
+            struct oer_recursive_recursive_c_t *b;
+        } b;
+    } value;
+};
+
+/**
+ * Type D in module Recursive.
+ */
+struct oer_recursive_recursive_d_t {
+    struct {
+        uint8_t length;
+        uint8_t buf[8];
+    } a;
+    bool is_b_present;
+    struct oer_recursive_recursive_e_t *b;
+};
+
+/**
+ * Type E in module Recursive.
+ */
+struct oer_recursive_recursive_e_t {
+    bool is_a_present;
+    struct oer_recursive_recursive_d_t *a;
+    uint8_t b;
+};
+
+/**
+ * Encode type A defined in module Recursive.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Recursive, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_encoded_size(
+    const struct oer_recursive_recursive_a_t *src_p);
+
+/**
+ * Decode type A defined in module Recursive.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_decode(
+    struct oer_recursive_recursive_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Recursive, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Recursive after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Recursive encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_decode_batch(
+    struct oer_recursive_recursive_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Fields of type A defined in module Recursive, to decode
+ * with oer_recursive_recursive_a_decode_fields().
+ */
+#define OER_RECURSIVE_RECURSIVE_A_FIELD_A (1ull << 0)
+#define OER_RECURSIVE_RECURSIVE_A_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type A defined in module
+ * Recursive. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_decode_fields(
+    struct oer_recursive_recursive_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Encode type A defined in module Recursive as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_a_t *src_p);
+
+/**
+ * Encode type B defined in module Recursive.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Recursive, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_encoded_size(
+    const struct oer_recursive_recursive_b_t *src_p);
+
+/**
+ * Decode type B defined in module Recursive.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_decode(
+    struct oer_recursive_recursive_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Recursive, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Recursive after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Recursive encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_decode_batch(
+    struct oer_recursive_recursive_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Fields of type B defined in module Recursive, to decode
+ * with oer_recursive_recursive_b_decode_fields().
+ */
+#define OER_RECURSIVE_RECURSIVE_B_FIELD_A (1ull << 0)
+#define OER_RECURSIVE_RECURSIVE_B_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type B defined in module
+ * Recursive. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_decode_fields(
+    struct oer_recursive_recursive_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Encode type B defined in module Recursive as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_b_t *src_p);
+
+/**
+ * Encode type C defined in module Recursive.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * Recursive, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_encoded_size(
+    const struct oer_recursive_recursive_c_t *src_p);
+
+/**
+ * Decode type C defined in module Recursive.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_decode(
+    struct oer_recursive_recursive_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module Recursive, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * Recursive after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * Recursive encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_decode_batch(
+    struct oer_recursive_recursive_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Encode type C defined in module Recursive as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_c_t *src_p);
+
+/**
+ * Encode type D defined in module Recursive.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_d_t *src_p);
+
+/**
+ * Calculate the encoded size of type D defined in module
+ * Recursive, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_encoded_size(
+    const struct oer_recursive_recursive_d_t *src_p);
+
+/**
+ * Decode type D defined in module Recursive.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_decode(
+    struct oer_recursive_recursive_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type D defined in
+ * module Recursive, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * Recursive after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type D defined in module
+ * Recursive encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_decode_batch(
+    struct oer_recursive_recursive_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Fields of type D defined in module Recursive, to decode
+ * with oer_recursive_recursive_d_decode_fields().
+ */
+#define OER_RECURSIVE_RECURSIVE_D_FIELD_A (1ull << 0)
+#define OER_RECURSIVE_RECURSIVE_D_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type D defined in module
+ * Recursive. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_decode_fields(
+    struct oer_recursive_recursive_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Encode type D defined in module Recursive as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_d_t *src_p);
+
+/**
+ * Encode type E defined in module Recursive.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_e_t *src_p);
+
+/**
+ * Calculate the encoded size of type E defined in module
+ * Recursive, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_encoded_size(
+    const struct oer_recursive_recursive_e_t *src_p);
+
+/**
+ * Decode type E defined in module Recursive.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_decode(
+    struct oer_recursive_recursive_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type E defined in
+ * module Recursive, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type E defined in module
+ * Recursive after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_e_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type E defined in module
+ * Recursive encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_decode_batch(
+    struct oer_recursive_recursive_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Fields of type E defined in module Recursive, to decode
+ * with oer_recursive_recursive_e_decode_fields().
+ */
+#define OER_RECURSIVE_RECURSIVE_E_FIELD_A (1ull << 0)
+#define OER_RECURSIVE_RECURSIVE_E_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type E defined in module
+ * Recursive. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_decode_fields(
+    struct oer_recursive_recursive_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct oer_recursive_arena_t *arena_p);
+
+/**
+ * Encode type E defined in module Recursive as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_recursive_recursive_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_recursive_recursive_e_t *src_p);
+
+#endif
@@ -0,0 +1,954 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:29 2026.
+ */
+
+#include <string.h>
+
+#include "oer_regions.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint16(uint8_t *buf_p, uint16_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 8);
+    buf_p[1] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE void store_uint32(uint8_t *buf_p, uint32_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 24);
+    buf_p[1] = (uint8_t)(value >> 16);
+    buf_p[2] = (uint8_t)(value >> 8);
+    buf_p[3] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint16_t load_uint16(const uint8_t *buf_p)
+{
+    return ((uint16_t)(((uint16_t)buf_p[0] << 8) | (uint16_t)buf_p[1]));
+}
+
+static ALWAYS_INLINE uint32_t load_uint32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | (uint32_t)buf_p[3]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_append_uint8(struct encoder_t *self_p,
+                                 uint8_t value)
+{
+    encoder_append_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_uint8(self_p, value ? 255u : 0u);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    uint8_t buf[2];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (uint16_t)(((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+}
+
+static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    uint8_t buf[4];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (((uint32_t)buf[0] << 24)
+            | ((uint32_t)buf[1] << 16)
+            | ((uint32_t)buf[2] << 8)
+            | (uint32_t)buf[3]);
+}
+
+static int8_t decoder_read_int8(struct decoder_t *self_p)
+{
+    return ((int8_t)decoder_read_uint8(self_p));
+}
+
+static int16_t decoder_read_int16(struct decoder_t *self_p)
+{
+    return ((int16_t)decoder_read_uint16(self_p));
+}
+
+static int32_t decoder_read_int32(struct decoder_t *self_p)
+{
+    return ((int32_t)decoder_read_uint32(self_p));
+}
+
+static bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_uint8(self_p) != 0u);
+}
+
+static uint32_t decoder_read_length_determinant(struct decoder_t *self_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        switch (length & 0x7fu) {
+
+        case 1:
+            length = decoder_read_uint8(self_p);
+            break;
+
+        case 2:
+            length = decoder_read_uint16(self_p);
+            break;
+
+        case 3:
+            length = (((uint32_t)decoder_read_uint8(self_p) << 16)
+                      | decoder_read_uint16(self_p));
+            break;
+
+        case 4:
+            length = decoder_read_uint32(self_p);
+            break;
+
+        default:
+            length = 0xffffffffu;
+            break;
+        }
+    }
+
+    return (length);
+}
+
+static void decoder_skip_additions(struct decoder_t *self_p)
+{
+    uint32_t length;
+    uint32_t number_of_additions;
+    uint32_t i;
+    uint8_t mask;
+    ssize_t pos;
+
+    length = decoder_read_length_determinant(self_p);
+
+    if (length <= 1u) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(self_p, length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    number_of_additions = 0;
+
+    /* First byte is the number of unused bits in the presence bitmap. */
+    for (i = 1; i < length; i++) {
+        for (mask = self_p->buf_p[pos + (ssize_t)i]; mask != 0u; mask >>= 1) {
+            number_of_additions += (mask & 1u);
+        }
+    }
+
+    for (i = 0; i < number_of_additions; i++) {
+        length = decoder_read_length_determinant(self_p);
+
+        if (decoder_free(self_p, length) < 0) {
+            return;
+        }
+    }
+}
+
+static void oer_regions_regions_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_regions_regions_a_t *src_p)
+{
+    uint8_t present_mask[1];
+    ssize_t pos;
+    ssize_t pos_2;
+    ssize_t pos_3;
+
+    present_mask[0] = 0;
+
+    if (src_p->is_h_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    pos = encoder_alloc(encoder_p, 3);
+
+    if (pos >= 0) {
+        encoder_p->buf_p[pos] = (uint8_t)src_p->a;
+        encoder_p->buf_p[pos + 1] = (src_p->b ? 255u : 0u);
+        encoder_p->buf_p[pos + 2] = (uint8_t)src_p->c;
+    }
+
+    encoder_append_uint8(encoder_p, src_p->d.length);
+    encoder_append_bytes(encoder_p,
+                         &src_p->d.buf[0],
+                         src_p->d.length);
+
+    pos_2 = encoder_alloc(encoder_p, 5);
+
+    if (pos_2 >= 0) {
+        store_uint16(&encoder_p->buf_p[pos_2], (uint16_t)src_p->e);
+        encoder_p->buf_p[pos_2 + 2] = (src_p->f ? 255u : 0u);
+        (void)memcpy(&encoder_p->buf_p[pos_2 + 3],
+                     &src_p->g.buf[0],
+                     2);
+    }
+
+    if (src_p->is_h_present) {
+        encoder_append_uint8(encoder_p, src_p->h);
+    }
+
+    pos_3 = encoder_alloc(encoder_p, 3);
+
+    if (pos_3 >= 0) {
+        store_uint16(&encoder_p->buf_p[pos_3], (uint16_t)src_p->i);
+        encoder_p->buf_p[pos_3 + 2] = (src_p->j ? 255u : 0u);
+    }
+}
+
+static void oer_regions_regions_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_regions_regions_a_t *dst_p)
+{
+    uint8_t present_mask[1];
+    ssize_t pos;
+    ssize_t pos_2;
+    ssize_t pos_3;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_h_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    pos = decoder_free(decoder_p, 3);
+
+    if (pos >= 0) {
+        dst_p->a = decoder_p->buf_p[pos];
+        dst_p->b = (decoder_p->buf_p[pos + 1] != 0u);
+        dst_p->c = (int8_t)decoder_p->buf_p[pos + 2];
+    }
+
+    dst_p->d.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->d.length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->d.buf[0],
+                       dst_p->d.length);
+
+    pos_2 = decoder_free(decoder_p, 5);
+
+    if (pos_2 >= 0) {
+        dst_p->e = load_uint16(&decoder_p->buf_p[pos_2]);
+        dst_p->f = (decoder_p->buf_p[pos_2 + 2] != 0u);
+        (void)memcpy(&dst_p->g.buf[0],
+                     &decoder_p->buf_p[pos_2 + 3],
+                     2);
+    }
+
+    if (dst_p->is_h_present) {
+        dst_p->h = decoder_read_uint8(decoder_p);
+    }
+
+    pos_3 = decoder_free(decoder_p, 3);
+
+    if (pos_3 >= 0) {
+        dst_p->i = (int16_t)load_uint16(&decoder_p->buf_p[pos_3]);
+        dst_p->j = (decoder_p->buf_p[pos_3 + 2] != 0u);
+    }
+}
+
+static void oer_regions_regions_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_regions_regions_a_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_h_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_int8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_D) != 0u) {
+        dst_p->d.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->d.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->d.buf[0],
+                           dst_p->d.length);
+    } else {
+        length = decoder_read_uint8(decoder_p);
+
+        if (length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_uint16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_F) != 0u) {
+        dst_p->f = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_G) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           &dst_p->g.buf[0],
+                           2);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+
+    if (dst_p->is_h_present) {
+        if ((fields & OER_REGIONS_REGIONS_A_FIELD_H) != 0u) {
+            dst_p->h = decoder_read_uint8(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_I) != 0u) {
+        dst_p->i = decoder_read_int16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_A_FIELD_J) != 0u) {
+        dst_p->j = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_regions_regions_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 3u);
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+    (void)decoder_free(decoder_p, 5u);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 3u);
+}
+
+static void oer_regions_regions_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_regions_regions_b_t *src_p)
+{
+    uint8_t present_mask[1];
+    ssize_t pos;
+
+    present_mask[0] = 0;
+
+    if (src_p->is_a_present) {
+        present_mask[0] |= 0x40u;
+    }
+
+    if (src_p->is_b_present) {
+        present_mask[0] |= 0x20u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->is_b_present) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    pos = encoder_alloc(encoder_p, 13);
+
+    if (pos >= 0) {
+        store_uint32(&encoder_p->buf_p[pos], (uint32_t)src_p->c);
+        store_uint32(&encoder_p->buf_p[pos + 4], (uint32_t)src_p->d);
+        store_uint32(&encoder_p->buf_p[pos + 8], (uint32_t)src_p->e);
+        encoder_p->buf_p[pos + 12] = (uint8_t)src_p->f;
+    }
+}
+
+static void oer_regions_regions_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_regions_regions_b_t *dst_p)
+{
+    uint8_t present_mask[1];
+    ssize_t pos;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x40u) == 0x40u);
+    dst_p->is_b_present = ((present_mask[0] & 0x20u) == 0x20u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_b_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    }
+
+    pos = decoder_free(decoder_p, 13);
+
+    if (pos >= 0) {
+        dst_p->c = load_uint32(&decoder_p->buf_p[pos]);
+        dst_p->d = load_uint32(&decoder_p->buf_p[pos + 4]);
+        dst_p->e = (int32_t)load_uint32(&decoder_p->buf_p[pos + 8]);
+        dst_p->f = decoder_p->buf_p[pos + 12];
+    }
+}
+
+static void oer_regions_regions_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_regions_regions_b_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_a_present = ((present_mask[0] & 0x40u) == 0x40u);
+    dst_p->is_b_present = ((present_mask[0] & 0x20u) == 0x20u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & OER_REGIONS_REGIONS_B_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & OER_REGIONS_REGIONS_B_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & OER_REGIONS_REGIONS_B_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_uint32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_B_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_uint32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_B_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_int32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_REGIONS_REGIONS_B_FIELD_F) != 0u) {
+        dst_p->f = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void oer_regions_regions_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((present_mask[0] & 0x20u) == 0x20u) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 13u);
+
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        decoder_skip_additions(decoder_p);
+    }
+}
+
+ssize_t oer_regions_regions_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_regions_regions_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_regions_regions_a_encoded_size(
+    const struct oer_regions_regions_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_regions_regions_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_regions_regions_a_decode(
+    struct oer_regions_regions_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_regions_regions_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_regions_regions_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_regions_regions_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_regions_regions_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_regions_regions_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_regions_regions_a_decode_batch(
+    struct oer_regions_regions_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_regions_regions_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_regions_regions_a_decode_fields(
+    struct oer_regions_regions_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_regions_regions_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_regions_regions_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_regions_regions_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_regions_regions_b_encoded_size(
+    const struct oer_regions_regions_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_regions_regions_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_regions_regions_b_decode(
+    struct oer_regions_regions_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_regions_regions_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_regions_regions_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_regions_regions_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_regions_regions_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_regions_regions_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_regions_regions_b_decode_batch(
+    struct oer_regions_regions_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_regions_regions_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_regions_regions_b_decode_fields(
+    struct oer_regions_regions_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_regions_regions_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
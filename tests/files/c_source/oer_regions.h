@@ -0,0 +1,370 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 13:53:51 2026.
+ */
+
+#ifndef OER_REGIONS_H
+#define OER_REGIONS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Type A in module Regions.
+ */
+struct oer_regions_regions_a_t {
+    uint8_t a;
+    bool b;
+    int8_t c;
+    struct {
+        uint8_t length;
+        uint8_t buf[4];
+    } d;
+    uint16_t e;
+    bool f;
+    struct {
+        uint8_t buf[2];
+    } g;
+    bool is_h_present;
+    uint8_t h;
+    int16_t i;
+    bool j;
+};
+
+/**
+ * Type B in module Regions.
+ */
+struct oer_regions_regions_b_t {
+    bool is_a_present;
+    bool a;
+    bool is_b_present;
+    bool b;
+    uint32_t c;
+    uint32_t d;
+    int32_t e;
+    uint8_t f;
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Regions, in bytes.
+ */
+#define OER_REGIONS_REGIONS_A_MAX_ENCODED_SIZE 18u
+
+/**
+ * Encode type A defined in module Regions.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Regions, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_a_encoded_size(
+    const struct oer_regions_regions_a_t *src_p);
+
+/**
+ * Decode type A defined in module Regions.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_regions_regions_a_decode(
+    struct oer_regions_regions_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Regions, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Regions after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Regions encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_regions_regions_a_decode_batch(
+    struct oer_regions_regions_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type A defined in module Regions, to decode
+ * with oer_regions_regions_a_decode_fields().
+ */
+#define OER_REGIONS_REGIONS_A_FIELD_A (1ull << 0)
+#define OER_REGIONS_REGIONS_A_FIELD_B (1ull << 1)
+#define OER_REGIONS_REGIONS_A_FIELD_C (1ull << 2)
+#define OER_REGIONS_REGIONS_A_FIELD_D (1ull << 3)
+#define OER_REGIONS_REGIONS_A_FIELD_E (1ull << 4)
+#define OER_REGIONS_REGIONS_A_FIELD_F (1ull << 5)
+#define OER_REGIONS_REGIONS_A_FIELD_G (1ull << 6)
+#define OER_REGIONS_REGIONS_A_FIELD_H (1ull << 7)
+#define OER_REGIONS_REGIONS_A_FIELD_I (1ull << 8)
+#define OER_REGIONS_REGIONS_A_FIELD_J (1ull << 9)
+
+/**
+ * Decode given fields of type A defined in module
+ * Regions. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_regions_regions_a_decode_fields(
+    struct oer_regions_regions_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Regions, in bytes.
+ */
+#define OER_REGIONS_REGIONS_B_MAX_ENCODED_SIZE 16u
+
+/**
+ * Encode type B defined in module Regions.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Regions, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_b_encoded_size(
+    const struct oer_regions_regions_b_t *src_p);
+
+/**
+ * Decode type B defined in module Regions.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_regions_regions_b_decode(
+    struct oer_regions_regions_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Regions, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Regions after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_regions_regions_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_regions_regions_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Regions encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_regions_regions_b_decode_batch(
+    struct oer_regions_regions_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type B defined in module Regions, to decode
+ * with oer_regions_regions_b_decode_fields().
+ */
+#define OER_REGIONS_REGIONS_B_FIELD_A (1ull << 0)
+#define OER_REGIONS_REGIONS_B_FIELD_B (1ull << 1)
+#define OER_REGIONS_REGIONS_B_FIELD_C (1ull << 2)
+#define OER_REGIONS_REGIONS_B_FIELD_D (1ull << 3)
+#define OER_REGIONS_REGIONS_B_FIELD_E (1ull << 4)
+#define OER_REGIONS_REGIONS_B_FIELD_F (1ull << 5)
+
+/**
+ * Decode given fields of type B defined in module
+ * Regions. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_regions_regions_b_decode_fields(
+    struct oer_regions_regions_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+#endif
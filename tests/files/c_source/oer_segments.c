@@ -0,0 +1,1198 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:33 2026.
+ */
+
+#include <string.h>
+
+#include "oer_segments.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    struct iovec *iov_p;
+    ssize_t iov_size;
+    ssize_t iov_pos;
+    size_t iov_threshold;
+    ssize_t segment_pos;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint16(uint8_t *buf_p, uint16_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 8);
+    buf_p[1] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint16_t load_uint16(const uint8_t *buf_p)
+{
+    return ((uint16_t)(((uint16_t)buf_p[0] << 8) | (uint16_t)buf_p[1]));
+}
+
+static uint8_t minimum_uint_length(uint32_t value)
+{
+    uint8_t length;
+
+    if (value < 256u) {
+        length = 1;
+    } else if (value < 65536u) {
+        length = 2;
+    } else if (value < 16777216u) {
+        length = 3;
+    } else {
+        length = 4;
+    }
+
+    return (length);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->iov_p = NULL;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_append_uint8(struct encoder_t *self_p,
+                                 uint8_t value)
+{
+    encoder_append_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_append_uint16(struct encoder_t *self_p,
+                                  uint16_t value)
+{
+    uint8_t buf[2];
+
+    buf[0] = (uint8_t)(value >> 8);
+    buf[1] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_uint32(struct encoder_t *self_p,
+                                  uint32_t value)
+{
+    uint8_t buf[4];
+
+    buf[0] = (uint8_t)(value >> 24);
+    buf[1] = (uint8_t)(value >> 16);
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_int8(struct encoder_t *self_p,
+                                int8_t value)
+{
+    encoder_append_uint8(self_p, (uint8_t)value);
+}
+
+static void encoder_append_uint(struct encoder_t *self_p,
+                                uint32_t value,
+                                uint8_t number_of_bytes)
+{
+    switch (number_of_bytes) {
+
+    case 1:
+        encoder_append_uint8(self_p, (uint8_t)value);
+        break;
+
+    case 2:
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    case 3:
+        encoder_append_uint8(self_p, (uint8_t)(value >> 16));
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    default:
+        encoder_append_uint32(self_p, value);
+        break;
+    }
+}
+
+static void encoder_append_length_determinant(struct encoder_t *self_p,
+                                              uint32_t length)
+{
+    if (length < 128u) {
+        encoder_append_int8(self_p, (int8_t)length);
+    } else if (length < 256u) {
+        encoder_append_uint8(self_p, 0x81u);
+        encoder_append_uint8(self_p, (uint8_t)length);
+    } else if (length < 65536u) {
+        encoder_append_uint8(self_p, 0x82u);
+        encoder_append_uint16(self_p, (uint16_t)length);
+    } else if (length < 16777216u) {
+        encoder_append_uint32(self_p, length | (0x83u << 24u));
+    } else {
+        encoder_append_uint8(self_p, 0x84u);
+        encoder_append_uint32(self_p, length);
+    }
+}
+
+static void encoder_append_iovec(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (self_p->iov_pos == self_p->iov_size) {
+        encoder_abort(self_p, ENOMEM);
+
+        return;
+    }
+
+    /* The payload is only read by writev() and friends. */
+    self_p->iov_p[self_p->iov_pos].iov_base = (void *)(uintptr_t)buf_p;
+    self_p->iov_p[self_p->iov_pos].iov_len = size;
+    self_p->iov_pos++;
+}
+
+static void encoder_append_segment(struct encoder_t *self_p)
+{
+    if (self_p->pos > self_p->segment_pos) {
+        encoder_append_iovec(self_p,
+                             &self_p->buf_p[self_p->segment_pos],
+                             (size_t)(self_p->pos - self_p->segment_pos));
+        self_p->segment_pos = self_p->pos;
+    }
+}
+
+static void encoder_append_payload(struct encoder_t *self_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    if ((self_p->iov_p == NULL) || (size < self_p->iov_threshold)) {
+        encoder_append_bytes(self_p, buf_p, size);
+
+        return;
+    }
+
+    /* Close the scratch buffer segment and reference the payload
+       instead of copying it. */
+    encoder_append_segment(self_p);
+
+    if (self_p->pos >= 0) {
+        encoder_append_iovec(self_p, buf_p, size);
+    }
+}
+
+static ssize_t encoder_get_iovec_result(struct encoder_t *self_p)
+{
+    encoder_append_segment(self_p);
+
+    if (self_p->pos < 0) {
+        return (self_p->pos);
+    }
+
+    return (self_p->iov_pos);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static const uint8_t *decoder_read_bytes_view(struct decoder_t *self_p,
+                                              size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos < 0) {
+        return (NULL);
+    }
+
+    return (&self_p->buf_p[pos]);
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    uint8_t buf[2];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (uint16_t)(((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+}
+
+static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    uint8_t buf[4];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (((uint32_t)buf[0] << 24)
+            | ((uint32_t)buf[1] << 16)
+            | ((uint32_t)buf[2] << 8)
+            | (uint32_t)buf[3]);
+}
+
+static uint32_t decoder_read_uint(struct decoder_t *self_p,
+                                  uint8_t number_of_bytes)
+{
+    uint32_t value;
+
+    switch (number_of_bytes) {
+
+    case 1:
+        value = decoder_read_uint8(self_p);
+        break;
+
+    case 2:
+        value = decoder_read_uint16(self_p);
+        break;
+
+    case 3:
+        value = ((uint32_t)decoder_read_uint8(self_p) << 16u);
+        value |= decoder_read_uint16(self_p);
+        break;
+
+    case 4:
+        value = decoder_read_uint32(self_p);
+        break;
+
+    default:
+        value = 0xffffffffu;
+        break;
+    }
+
+    return (value);
+}
+
+static uint32_t decoder_read_length_determinant(struct decoder_t *self_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        switch (length & 0x7fu) {
+
+        case 1:
+            length = decoder_read_uint8(self_p);
+            break;
+
+        case 2:
+            length = decoder_read_uint16(self_p);
+            break;
+
+        case 3:
+            length = (((uint32_t)decoder_read_uint8(self_p) << 16)
+                      | decoder_read_uint16(self_p));
+            break;
+
+        case 4:
+            length = decoder_read_uint32(self_p);
+            break;
+
+        default:
+            length = 0xffffffffu;
+            break;
+        }
+    }
+
+    return (length);
+}
+
+static void oer_segments_segments_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_segments_segments_a_t *src_p)
+{
+    uint8_t present_mask[1];
+    ssize_t pos;
+
+    present_mask[0] = 0;
+
+    if (src_p->is_trailer_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    pos = encoder_alloc(encoder_p, 6);
+
+    if (pos >= 0) {
+        store_uint16(&encoder_p->buf_p[pos], (uint16_t)src_p->id);
+        (void)memcpy(&encoder_p->buf_p[pos + 2],
+                     &src_p->header.buf[0],
+                     4);
+    }
+
+    encoder_append_length_determinant(encoder_p, src_p->body.length);
+    encoder_append_payload(encoder_p,
+                           &src_p->body.buf[0],
+                           src_p->body.length);
+    encoder_append_payload(encoder_p,
+                           &src_p->digest.buf[0],
+                           64);
+    encoder_append_uint8(encoder_p, src_p->name.length);
+    encoder_append_payload(encoder_p,
+                           (const uint8_t *)&src_p->name.buf[0],
+                           src_p->name.length);
+
+    if (src_p->is_trailer_present) {
+        encoder_append_uint8(encoder_p, src_p->trailer.length);
+        encoder_append_payload(encoder_p,
+                               &src_p->trailer.buf[0],
+                               src_p->trailer.length);
+    }
+}
+
+static void oer_segments_segments_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_segments_segments_a_t *dst_p)
+{
+    uint8_t present_mask[1];
+    ssize_t pos;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_trailer_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    pos = decoder_free(decoder_p, 6);
+
+    if (pos >= 0) {
+        dst_p->id = load_uint16(&decoder_p->buf_p[pos]);
+        (void)memcpy(&dst_p->header.buf[0],
+                     &decoder_p->buf_p[pos + 2],
+                     4);
+    }
+
+    dst_p->body.length = decoder_read_length_determinant(decoder_p);
+
+    if (dst_p->body.length > 512u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->body.buf[0],
+                       dst_p->body.length);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->digest.buf[0],
+                       64);
+    dst_p->name.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->name.length > 100u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->name.buf[0],
+                       dst_p->name.length);
+    dst_p->name.buf[dst_p->name.length] = '\0';
+
+    if (dst_p->is_trailer_present) {
+        dst_p->trailer.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->trailer.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->trailer.buf[0],
+                           dst_p->trailer.length);
+    }
+}
+
+static void oer_segments_segments_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_segments_segments_a_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_trailer_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if ((fields & OER_SEGMENTS_SEGMENTS_A_FIELD_ID) != 0u) {
+        dst_p->id = decoder_read_uint16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+    if ((fields & OER_SEGMENTS_SEGMENTS_A_FIELD_HEADER) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           &dst_p->header.buf[0],
+                           4);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & OER_SEGMENTS_SEGMENTS_A_FIELD_BODY) != 0u) {
+        dst_p->body.length = decoder_read_length_determinant(decoder_p);
+
+        if (dst_p->body.length > 512u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->body.buf[0],
+                           dst_p->body.length);
+    } else {
+        length = decoder_read_length_determinant(decoder_p);
+
+        if (length > 512u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+    }
+    if ((fields & OER_SEGMENTS_SEGMENTS_A_FIELD_DIGEST) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           &dst_p->digest.buf[0],
+                           64);
+    } else {
+        (void)decoder_free(decoder_p, 64u);
+    }
+    if ((fields & OER_SEGMENTS_SEGMENTS_A_FIELD_NAME) != 0u) {
+        dst_p->name.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->name.length > 100u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->name.buf[0],
+                           dst_p->name.length);
+        dst_p->name.buf[dst_p->name.length] = '\0';
+    } else {
+        length_2 = decoder_read_uint8(decoder_p);
+
+        if (length_2 > 100u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2);
+    }
+
+    if (dst_p->is_trailer_present) {
+        if ((fields & OER_SEGMENTS_SEGMENTS_A_FIELD_TRAILER) != 0u) {
+            dst_p->trailer.length = decoder_read_uint8(decoder_p);
+
+            if (dst_p->trailer.length > 8u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->trailer.buf[0],
+                               dst_p->trailer.length);
+        } else {
+            length_3 = decoder_read_uint8(decoder_p);
+
+            if (length_3 > 8u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length_3);
+        }
+    }
+}
+
+static void oer_segments_segments_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    (void)decoder_free(decoder_p, 6u);
+    length = decoder_read_length_determinant(decoder_p);
+
+    if (length > 512u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+    (void)decoder_free(decoder_p, 64u);
+    length_2 = decoder_read_uint8(decoder_p);
+
+    if (length_2 > 100u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        length_3 = decoder_read_uint8(decoder_p);
+
+        if (length_3 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3);
+    }
+}
+
+static void oer_segments_segments_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_segments_segments_b_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = minimum_uint_length(src_p->messages.length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->messages.length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->messages.length; i++) {
+        encoder_append_length_determinant(encoder_p, src_p->messages.elements[i].length);
+        encoder_append_payload(encoder_p,
+                               &src_p->messages.elements[i].buf[0],
+                               src_p->messages.elements[i].length);
+    }
+
+    encoder_append_length_determinant(encoder_p, src_p->payload.length);
+    encoder_append_payload(encoder_p,
+                           src_p->payload.buf,
+                           src_p->payload.length);
+}
+
+static void oer_segments_segments_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_segments_segments_b_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->messages.length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->messages.length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->messages.length; i++) {
+        dst_p->messages.elements[i].length = decoder_read_length_determinant(decoder_p);
+
+        if (dst_p->messages.elements[i].length > 256u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->messages.elements[i].buf[0],
+                           dst_p->messages.elements[i].length);
+    }
+
+    dst_p->payload.length = decoder_read_length_determinant(decoder_p);
+
+    if (dst_p->payload.length > 65535u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->payload.buf = decoder_read_bytes_view(decoder_p,
+                                                 dst_p->payload.length);
+}
+
+static void oer_segments_segments_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_segments_segments_b_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+    uint8_t number_of_length_bytes_2;
+    uint32_t length;
+    uint32_t i_2;
+    uint32_t length_2;
+    uint32_t length_3;
+
+    if ((fields & OER_SEGMENTS_SEGMENTS_B_FIELD_MESSAGES) != 0u) {
+        number_of_length_bytes = decoder_read_uint8(decoder_p);
+        dst_p->messages.length = (uint8_t)decoder_read_uint(
+            decoder_p,
+            number_of_length_bytes);
+
+        if (dst_p->messages.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i = 0; i < dst_p->messages.length; i++) {
+            dst_p->messages.elements[i].length = decoder_read_length_determinant(decoder_p);
+
+            if (dst_p->messages.elements[i].length > 256u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->messages.elements[i].buf[0],
+                               dst_p->messages.elements[i].length);
+        }
+    } else {
+        number_of_length_bytes_2 = decoder_read_uint8(decoder_p);
+        length = decoder_read_uint(decoder_p, number_of_length_bytes_2);
+
+        if (length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_2 = 0; i_2 < length; i_2++) {
+            length_2 = decoder_read_length_determinant(decoder_p);
+
+            if (length_2 > 256u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length_2);
+        }
+    }
+    if ((fields & OER_SEGMENTS_SEGMENTS_B_FIELD_PAYLOAD) != 0u) {
+        dst_p->payload.length = decoder_read_length_determinant(decoder_p);
+
+        if (dst_p->payload.length > 65535u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->payload.buf = decoder_read_bytes_view(decoder_p,
+                                                     dst_p->payload.length);
+    } else {
+        length_3 = decoder_read_length_determinant(decoder_p);
+
+        if (length_3 > 65535u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3);
+    }
+}
+
+static void oer_segments_segments_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+    uint32_t length_2;
+    uint32_t length_3;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        length_2 = decoder_read_length_determinant(decoder_p);
+
+        if (length_2 > 256u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2);
+    }
+    length_3 = decoder_read_length_determinant(decoder_p);
+
+    if (length_3 > 65535u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_3);
+}
+
+ssize_t oer_segments_segments_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_segments_segments_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_segments_segments_a_encoded_size(
+    const struct oer_segments_segments_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_segments_segments_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_segments_segments_a_decode(
+    struct oer_segments_segments_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_segments_segments_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_segments_segments_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_segments_segments_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_segments_segments_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_segments_segments_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_segments_segments_a_decode_batch(
+    struct oer_segments_segments_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_segments_segments_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_segments_segments_a_decode_fields(
+    struct oer_segments_segments_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_segments_segments_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_segments_segments_a_encode_iovec(
+    struct iovec *iov_p,
+    size_t iovcnt,
+    uint8_t *scratch_p,
+    size_t size,
+    const struct oer_segments_segments_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, scratch_p, size);
+    encoder.iov_p = iov_p;
+    encoder.iov_size = (ssize_t)iovcnt;
+    encoder.iov_pos = 0;
+    encoder.iov_threshold = OER_SEGMENTS_IOVEC_MIN_REFERENCE_SIZE;
+    encoder.segment_pos = 0;
+    oer_segments_segments_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_iovec_result(&encoder));
+}
+
+ssize_t oer_segments_segments_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_segments_segments_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_segments_segments_b_encoded_size(
+    const struct oer_segments_segments_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_segments_segments_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_segments_segments_b_decode(
+    struct oer_segments_segments_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_segments_segments_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_segments_segments_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_segments_segments_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_segments_segments_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_segments_segments_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_segments_segments_b_decode_batch(
+    struct oer_segments_segments_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_segments_segments_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_segments_segments_b_decode_fields(
+    struct oer_segments_segments_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_segments_segments_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_segments_segments_b_encode_iovec(
+    struct iovec *iov_p,
+    size_t iovcnt,
+    uint8_t *scratch_p,
+    size_t size,
+    const struct oer_segments_segments_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, scratch_p, size);
+    encoder.iov_p = iov_p;
+    encoder.iov_size = (ssize_t)iovcnt;
+    encoder.iov_pos = 0;
+    encoder.iov_threshold = OER_SEGMENTS_IOVEC_MIN_REFERENCE_SIZE;
+    encoder.segment_pos = 0;
+    oer_segments_segments_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_iovec_result(&encoder));
+}
@@ -0,0 +1,423 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 14:24:03 2026.
+ */
+
+#ifndef OER_SEGMENTS_H
+#define OER_SEGMENTS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Minimum size, in bytes, of OCTET STRING and character string values
+ * referenced by the iovec encoders instead of copied into their
+ * scratch buffer.
+ */
+#ifndef OER_SEGMENTS_IOVEC_MIN_REFERENCE_SIZE
+#    define OER_SEGMENTS_IOVEC_MIN_REFERENCE_SIZE 64
+#endif
+
+/**
+ * Type A in module Segments.
+ */
+struct oer_segments_segments_a_t {
+    uint16_t id;
+    struct {
+        uint8_t buf[4];
+    } header;
+    struct {
+        uint32_t length;
+        uint8_t buf[512];
+    } body;
+    struct {
+        uint8_t buf[64];
+    } digest;
+    struct {
+        uint8_t length;
+        char buf[101];
+    } name;
+    bool is_trailer_present;
+    struct {
+        uint8_t length;
+        uint8_t buf[8];
+    } trailer;
+};
+
+/**
+ * Type B in module Segments.
+ */
+struct oer_segments_segments_b_t {
+    struct {
+        uint8_t length;
+        struct {
+            uint32_t length;
+            uint8_t buf[256];
+        } elements[4];
+    } messages;
+    struct {
+        const uint8_t *buf;
+        uint32_t length;
+    } payload;
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Segments, in bytes.
+ */
+#define OER_SEGMENTS_SEGMENTS_A_MAX_ENCODED_SIZE 696u
+
+/**
+ * Encode type A defined in module Segments.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Segments, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_a_encoded_size(
+    const struct oer_segments_segments_a_t *src_p);
+
+/**
+ * Decode type A defined in module Segments.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_segments_segments_a_decode(
+    struct oer_segments_segments_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Segments, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Segments after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Segments encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_segments_segments_a_decode_batch(
+    struct oer_segments_segments_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type A defined in module Segments, to decode
+ * with oer_segments_segments_a_decode_fields().
+ */
+#define OER_SEGMENTS_SEGMENTS_A_FIELD_ID (1ull << 0)
+#define OER_SEGMENTS_SEGMENTS_A_FIELD_HEADER (1ull << 1)
+#define OER_SEGMENTS_SEGMENTS_A_FIELD_BODY (1ull << 2)
+#define OER_SEGMENTS_SEGMENTS_A_FIELD_DIGEST (1ull << 3)
+#define OER_SEGMENTS_SEGMENTS_A_FIELD_NAME (1ull << 4)
+#define OER_SEGMENTS_SEGMENTS_A_FIELD_TRAILER (1ull << 5)
+
+/**
+ * Decode given fields of type A defined in module
+ * Segments. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_segments_segments_a_decode_fields(
+    struct oer_segments_segments_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type A defined in module Segments as segments
+ * to write with writev() or sendmsg(). Large OCTET STRING and
+ * character string values are referenced in src_p instead of copied,
+ * everything else is encoded into the scratch buffer. The segments
+ * are valid as long as src_p and scratch_p are.
+ *
+ * @param[out] iov_p Segments of the encoded data.
+ * @param[in] iovcnt Number of elements in iov_p.
+ * @param[out] scratch_p Buffer to encode copied data into.
+ * @param[in] size Size of scratch_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Number of used segments or negative error code.
+ */
+ssize_t oer_segments_segments_a_encode_iovec(
+    struct iovec *iov_p,
+    size_t iovcnt,
+    uint8_t *scratch_p,
+    size_t size,
+    const struct oer_segments_segments_a_t *src_p);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Segments, in bytes.
+ */
+#define OER_SEGMENTS_SEGMENTS_B_MAX_ENCODED_SIZE 66576u
+
+/**
+ * Encode type B defined in module Segments.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Segments, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_b_encoded_size(
+    const struct oer_segments_segments_b_t *src_p);
+
+/**
+ * Decode type B defined in module Segments.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_segments_segments_b_decode(
+    struct oer_segments_segments_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Segments, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Segments after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t oer_segments_segments_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_segments_segments_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Segments encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_segments_segments_b_decode_batch(
+    struct oer_segments_segments_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type B defined in module Segments, to decode
+ * with oer_segments_segments_b_decode_fields().
+ */
+#define OER_SEGMENTS_SEGMENTS_B_FIELD_MESSAGES (1ull << 0)
+#define OER_SEGMENTS_SEGMENTS_B_FIELD_PAYLOAD (1ull << 1)
+
+/**
+ * Decode given fields of type B defined in module
+ * Segments. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t oer_segments_segments_b_decode_fields(
+    struct oer_segments_segments_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type B defined in module Segments as segments
+ * to write with writev() or sendmsg(). Large OCTET STRING and
+ * character string values are referenced in src_p instead of copied,
+ * everything else is encoded into the scratch buffer. The segments
+ * are valid as long as src_p and scratch_p are.
+ *
+ * @param[out] iov_p Segments of the encoded data.
+ * @param[in] iovcnt Number of elements in iov_p.
+ * @param[out] scratch_p Buffer to encode copied data into.
+ * @param[in] size Size of scratch_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Number of used segments or negative error code.
+ */
+ssize_t oer_segments_segments_b_encode_iovec(
+    struct iovec *iov_p,
+    size_t iovcnt,
+    uint8_t *scratch_p,
+    size_t size,
+    const struct oer_segments_segments_b_t *src_p);
+
+#endif
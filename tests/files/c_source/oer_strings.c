@@ -0,0 +1,2046 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:18 2026.
+ */
+
+#include <string.h>
+
+#include "oer_strings.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+static uint8_t minimum_uint_length(uint32_t value)
+{
+    uint8_t length;
+
+    if (value < 256u) {
+        length = 1;
+    } else if (value < 65536u) {
+        length = 2;
+    } else if (value < 16777216u) {
+        length = 3;
+    } else {
+        length = 4;
+    }
+
+    return (length);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->size_only = false;
+}
+
+static ssize_t encoder_get_result(const struct encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t encoder_alloc(struct encoder_t *self_p,
+                             size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    ssize_t pos;
+
+    pos = encoder_alloc(self_p, size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    (void)memcpy(&self_p->buf_p[pos], buf_p, size);
+}
+
+static void encoder_append_uint8(struct encoder_t *self_p,
+                                 uint8_t value)
+{
+    encoder_append_bytes(self_p, &value, sizeof(value));
+}
+
+static void encoder_append_uint16(struct encoder_t *self_p,
+                                  uint16_t value)
+{
+    uint8_t buf[2];
+
+    buf[0] = (uint8_t)(value >> 8);
+    buf[1] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_uint32(struct encoder_t *self_p,
+                                  uint32_t value)
+{
+    uint8_t buf[4];
+
+    buf[0] = (uint8_t)(value >> 24);
+    buf[1] = (uint8_t)(value >> 16);
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+
+    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+}
+
+static void encoder_append_int8(struct encoder_t *self_p,
+                                int8_t value)
+{
+    encoder_append_uint8(self_p, (uint8_t)value);
+}
+
+static void encoder_append_uint(struct encoder_t *self_p,
+                                uint32_t value,
+                                uint8_t number_of_bytes)
+{
+    switch (number_of_bytes) {
+
+    case 1:
+        encoder_append_uint8(self_p, (uint8_t)value);
+        break;
+
+    case 2:
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    case 3:
+        encoder_append_uint8(self_p, (uint8_t)(value >> 16));
+        encoder_append_uint16(self_p, (uint16_t)value);
+        break;
+
+    default:
+        encoder_append_uint32(self_p, value);
+        break;
+    }
+}
+
+static void encoder_append_length_determinant(struct encoder_t *self_p,
+                                              uint32_t length)
+{
+    if (length < 128u) {
+        encoder_append_int8(self_p, (int8_t)length);
+    } else if (length < 256u) {
+        encoder_append_uint8(self_p, 0x81u);
+        encoder_append_uint8(self_p, (uint8_t)length);
+    } else if (length < 65536u) {
+        encoder_append_uint8(self_p, 0x82u);
+        encoder_append_uint16(self_p, (uint16_t)length);
+    } else if (length < 16777216u) {
+        encoder_append_uint32(self_p, length | (0x83u << 24u));
+    } else {
+        encoder_append_uint8(self_p, 0x84u);
+        encoder_append_uint32(self_p, length);
+    }
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ssize_t decoder_free(struct decoder_t *self_p,
+                            size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    ssize_t pos;
+
+    pos = decoder_free(self_p, size);
+
+    if (pos >= 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[pos], size);
+    } else {
+        (void)memset(buf_p, 0, size);
+    }
+}
+
+static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    uint8_t value;
+
+    decoder_read_bytes(self_p, &value, sizeof(value));
+
+    return (value);
+}
+
+static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    uint8_t buf[2];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (uint16_t)(((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+}
+
+static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    uint8_t buf[4];
+
+    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+
+    return (((uint32_t)buf[0] << 24)
+            | ((uint32_t)buf[1] << 16)
+            | ((uint32_t)buf[2] << 8)
+            | (uint32_t)buf[3]);
+}
+
+static uint32_t decoder_read_uint(struct decoder_t *self_p,
+                                  uint8_t number_of_bytes)
+{
+    uint32_t value;
+
+    switch (number_of_bytes) {
+
+    case 1:
+        value = decoder_read_uint8(self_p);
+        break;
+
+    case 2:
+        value = decoder_read_uint16(self_p);
+        break;
+
+    case 3:
+        value = ((uint32_t)decoder_read_uint8(self_p) << 16u);
+        value |= decoder_read_uint16(self_p);
+        break;
+
+    case 4:
+        value = decoder_read_uint32(self_p);
+        break;
+
+    default:
+        value = 0xffffffffu;
+        break;
+    }
+
+    return (value);
+}
+
+static uint32_t decoder_read_length_determinant(struct decoder_t *self_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0u) {
+        switch (length & 0x7fu) {
+
+        case 1:
+            length = decoder_read_uint8(self_p);
+            break;
+
+        case 2:
+            length = decoder_read_uint16(self_p);
+            break;
+
+        case 3:
+            length = (((uint32_t)decoder_read_uint8(self_p) << 16)
+                      | decoder_read_uint16(self_p));
+            break;
+
+        case 4:
+            length = decoder_read_uint32(self_p);
+            break;
+
+        default:
+            length = 0xffffffffu;
+            break;
+        }
+    }
+
+    return (length);
+}
+
+static uint32_t decoder_read_tag(struct decoder_t *self_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_uint8(self_p);
+
+    if ((tag & 0x3fu) == 0x3fu) {
+        do {
+            tag <<= 8;
+            tag |= (uint32_t)decoder_read_uint8(self_p);
+        } while ((tag & 0x80u) == 0x80u);
+    }
+
+    return (tag);
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_quoted_string(struct jer_encoder_t *self_p,
+                                             const char *buf_p,
+                                             size_t size)
+{
+    /* Short escapes of control characters, or 'u' for \u00XX. */
+    static const char escapes[] = "uuuuuuuubtnufruuuuuuuuuuuuuuuuuu";
+    static const char digits[] = "0123456789abcdef";
+    uint8_t *dst_p;
+    size_t length;
+    size_t i;
+    uint8_t value;
+
+    length = size + 2;
+
+    for (i = 0; i < size; i++) {
+        value = (uint8_t)buf_p[i];
+
+        if ((value == '"') || (value == '\\')) {
+            length++;
+        } else if ((value < 0x20) && (escapes[value] != 'u')) {
+            length++;
+        } else if ((value < 0x20) || (value >= 0x7f)) {
+            length += 5;
+        }
+    }
+
+    dst_p = jer_encoder_alloc(self_p, length);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    *dst_p++ = '"';
+
+    for (i = 0; i < size; i++) {
+        value = (uint8_t)buf_p[i];
+
+        if ((value == '"') || (value == '\\')) {
+            *dst_p++ = '\\';
+            *dst_p++ = value;
+        } else if ((value < 0x20) && (escapes[value] != 'u')) {
+            *dst_p++ = '\\';
+            *dst_p++ = (uint8_t)escapes[value];
+        } else if ((value < 0x20) || (value >= 0x7f)) {
+            *dst_p++ = '\\';
+            *dst_p++ = 'u';
+            *dst_p++ = '0';
+            *dst_p++ = '0';
+            *dst_p++ = (uint8_t)digits[value >> 4];
+            *dst_p++ = (uint8_t)digits[value & 0xf];
+        } else {
+            *dst_p++ = value;
+        }
+    }
+
+    *dst_p = '"';
+}
+
+static void oer_strings_strings_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_strings_strings_a_t *src_p)
+{
+    uint8_t present_mask[1];
+    static const char h_default[] = "abc";
+
+    present_mask[0] = 0;
+
+    if (src_p->is_g_present) {
+        present_mask[0] |= 0x80u;
+    }
+
+    if ((src_p->h.length != 3u) || (memcmp(&src_p->h.buf[0], h_default, 3u) != 0)) {
+        present_mask[0] |= 0x40u;
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &present_mask[0],
+                         sizeof(present_mask));
+
+    encoder_append_uint8(encoder_p, src_p->a.length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->a.buf[0],
+                         src_p->a.length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->b.buf[0],
+                         5);
+    encoder_append_uint8(encoder_p, src_p->c.length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->c.buf[0],
+                         src_p->c.length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->d.buf[0],
+                         2);
+    encoder_append_uint8(encoder_p, src_p->e.length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->e.buf[0],
+                         src_p->e.length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->f.buf[0],
+                         12);
+
+    if (src_p->is_g_present) {
+        encoder_append_length_determinant(encoder_p, src_p->g.length);
+        encoder_append_bytes(encoder_p,
+                             (const uint8_t *)&src_p->g.buf[0],
+                             src_p->g.length);
+    }
+
+    if ((src_p->h.length != 3u) || (memcmp(&src_p->h.buf[0], h_default, 3u) != 0)) {
+        encoder_append_uint8(encoder_p, src_p->h.length);
+        encoder_append_bytes(encoder_p,
+                             (const uint8_t *)&src_p->h.buf[0],
+                             src_p->h.length);
+    }
+}
+
+static void oer_strings_strings_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_a_t *dst_p)
+{
+    uint8_t present_mask[1];
+    static const char h_default[] = "abc";
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_g_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    dst_p->a.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->a.length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->a.buf[0],
+                       dst_p->a.length);
+    dst_p->a.buf[dst_p->a.length] = '\0';
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->b.buf[0],
+                       5);
+    dst_p->b.buf[5] = '\0';
+    dst_p->c.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->c.length > 16u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->c.buf[0],
+                       dst_p->c.length);
+    dst_p->c.buf[dst_p->c.length] = '\0';
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->d.buf[0],
+                       2);
+    dst_p->d.buf[2] = '\0';
+    dst_p->e.length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->e.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->e.buf[0],
+                       dst_p->e.length);
+    dst_p->e.buf[dst_p->e.length] = '\0';
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->f.buf[0],
+                       12);
+    dst_p->f.buf[12] = '\0';
+
+    if (dst_p->is_g_present) {
+        dst_p->g.length = decoder_read_length_determinant(decoder_p);
+
+        if (dst_p->g.length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->g.buf[0],
+                           dst_p->g.length);
+        dst_p->g.buf[dst_p->g.length] = '\0';
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        dst_p->h.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->h.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->h.buf[0],
+                           dst_p->h.length);
+        dst_p->h.buf[dst_p->h.length] = '\0';
+    } else {
+        (void)memcpy(&dst_p->h.buf[0], h_default, sizeof(h_default));
+        dst_p->h.length = 3u;
+    }
+}
+
+static void oer_strings_strings_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_a_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    uint32_t length_4;
+    uint32_t length_5;
+    static const char h_default[] = "abc";
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    dst_p->is_g_present = ((present_mask[0] & 0x80u) == 0x80u);
+
+    if ((fields & OER_STRINGS_STRINGS_A_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->a.buf[0],
+                           dst_p->a.length);
+        dst_p->a.buf[dst_p->a.length] = '\0';
+    } else {
+        length = decoder_read_uint8(decoder_p);
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+    }
+    if ((fields & OER_STRINGS_STRINGS_A_FIELD_B) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->b.buf[0],
+                           5);
+        dst_p->b.buf[5] = '\0';
+    } else {
+        (void)decoder_free(decoder_p, 5u);
+    }
+    if ((fields & OER_STRINGS_STRINGS_A_FIELD_C) != 0u) {
+        dst_p->c.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->c.length > 16u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->c.buf[0],
+                           dst_p->c.length);
+        dst_p->c.buf[dst_p->c.length] = '\0';
+    } else {
+        length_2 = decoder_read_uint8(decoder_p);
+
+        if (length_2 > 16u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2);
+    }
+    if ((fields & OER_STRINGS_STRINGS_A_FIELD_D) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->d.buf[0],
+                           2);
+        dst_p->d.buf[2] = '\0';
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+    if ((fields & OER_STRINGS_STRINGS_A_FIELD_E) != 0u) {
+        dst_p->e.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->e.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->e.buf[0],
+                           dst_p->e.length);
+        dst_p->e.buf[dst_p->e.length] = '\0';
+    } else {
+        length_3 = decoder_read_uint8(decoder_p);
+
+        if (length_3 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3);
+    }
+    if ((fields & OER_STRINGS_STRINGS_A_FIELD_F) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->f.buf[0],
+                           12);
+        dst_p->f.buf[12] = '\0';
+    } else {
+        (void)decoder_free(decoder_p, 12u);
+    }
+
+    if (dst_p->is_g_present) {
+        if ((fields & OER_STRINGS_STRINGS_A_FIELD_G) != 0u) {
+            dst_p->g.length = decoder_read_length_determinant(decoder_p);
+
+            if (dst_p->g.length > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               (uint8_t *)&dst_p->g.buf[0],
+                               dst_p->g.length);
+            dst_p->g.buf[dst_p->g.length] = '\0';
+        } else {
+            length_4 = decoder_read_length_determinant(decoder_p);
+
+            if (length_4 > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length_4);
+        }
+    }
+
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        if ((fields & OER_STRINGS_STRINGS_A_FIELD_H) != 0u) {
+            dst_p->h.length = decoder_read_uint8(decoder_p);
+
+            if (dst_p->h.length > 4u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               (uint8_t *)&dst_p->h.buf[0],
+                               dst_p->h.length);
+            dst_p->h.buf[dst_p->h.length] = '\0';
+        } else {
+            length_5 = decoder_read_uint8(decoder_p);
+
+            if (length_5 > 4u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, length_5);
+        }
+    } else {
+        (void)memcpy(&dst_p->h.buf[0], h_default, sizeof(h_default));
+        dst_p->h.length = 3u;
+    }
+}
+
+static void oer_strings_strings_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t present_mask[1];
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    uint32_t length_4;
+    uint32_t length_5;
+
+    decoder_read_bytes(decoder_p,
+                       &present_mask[0],
+                       sizeof(present_mask));
+
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+    (void)decoder_free(decoder_p, 5u);
+    length_2 = decoder_read_uint8(decoder_p);
+
+    if (length_2 > 16u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2);
+    (void)decoder_free(decoder_p, 2u);
+    length_3 = decoder_read_uint8(decoder_p);
+
+    if (length_3 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_3);
+    (void)decoder_free(decoder_p, 12u);
+    if ((present_mask[0] & 0x80u) == 0x80u) {
+        length_4 = decoder_read_length_determinant(decoder_p);
+
+        if (length_4 > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_4);
+    }
+    if ((present_mask[0] & 0x40u) == 0x40u) {
+        length_5 = decoder_read_uint8(decoder_p);
+
+        if (length_5 > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_5);
+    }
+}
+
+static void oer_strings_strings_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_strings_strings_b_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->buf[0],
+                         src_p->length);
+}
+
+static void oer_strings_strings_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_b_t *dst_p)
+{
+    dst_p->length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->length > 6u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->buf[0],
+                       dst_p->length);
+    dst_p->buf[dst_p->length] = '\0';
+}
+
+static void oer_strings_strings_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 6u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+}
+
+static void oer_strings_strings_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_strings_strings_c_t *src_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = minimum_uint_length(src_p->length);
+    encoder_append_uint8(encoder_p, number_of_length_bytes);
+    encoder_append_uint(encoder_p,
+                        src_p->length,
+                        number_of_length_bytes);
+
+    for (i = 0; i < src_p->length; i++) {
+        oer_strings_strings_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void oer_strings_strings_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_c_t *dst_p)
+{
+    uint8_t number_of_length_bytes;
+    uint8_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    dst_p->length = (uint8_t)decoder_read_uint(
+        decoder_p,
+        number_of_length_bytes);
+
+    if (dst_p->length > 3u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        oer_strings_strings_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void oer_strings_strings_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t number_of_length_bytes;
+    uint32_t length;
+    uint32_t i;
+
+    number_of_length_bytes = decoder_read_uint8(decoder_p);
+    length = decoder_read_uint(decoder_p, number_of_length_bytes);
+
+    if (length > 3u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        oer_strings_strings_b_skip_inner(decoder_p);
+    }
+}
+
+static void oer_strings_strings_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_strings_strings_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case oer_strings_strings_d_choice_a_e:
+        encoder_append_uint(encoder_p, 0x80, 1);
+        encoder_append_uint8(encoder_p, src_p->value.a.length);
+        encoder_append_bytes(encoder_p,
+                             (const uint8_t *)&src_p->value.a.buf[0],
+                             src_p->value.a.length);
+        break;
+
+    case oer_strings_strings_d_choice_b_e:
+        encoder_append_uint(encoder_p, 0x81, 1);
+        oer_strings_strings_b_encode_inner(encoder_p, &src_p->value.b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_strings_strings_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_d_t *dst_p)
+{
+    uint32_t tag;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        dst_p->choice = oer_strings_strings_d_choice_a_e;
+        dst_p->value.a.length = decoder_read_uint8(decoder_p);
+
+        if (dst_p->value.a.length > 3u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           (uint8_t *)&dst_p->value.a.buf[0],
+                           dst_p->value.a.length);
+        dst_p->value.a.buf[dst_p->value.a.length] = '\0';
+        break;
+
+    case 0x81:
+        dst_p->choice = oer_strings_strings_d_choice_b_e;
+        oer_strings_strings_b_decode_inner(decoder_p, &dst_p->value.b);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_strings_strings_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t tag;
+    uint32_t length;
+
+    tag = decoder_read_tag(decoder_p);
+
+    switch (tag) {
+
+    case 0x80:
+        length = decoder_read_uint8(decoder_p);
+
+        if (length > 3u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length);
+        break;
+
+    case 0x81:
+        oer_strings_strings_b_skip_inner(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_strings_strings_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_strings_strings_e_t *src_p)
+{
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->buf[0],
+                         3);
+}
+
+static void oer_strings_strings_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_e_t *dst_p)
+{
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->buf[0],
+                       3);
+    dst_p->buf[3] = '\0';
+}
+
+static void oer_strings_strings_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 3u);
+}
+
+static void oer_strings_strings_f_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct oer_strings_strings_f_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->length);
+    encoder_append_bytes(encoder_p,
+                         (const uint8_t *)&src_p->buf[0],
+                         src_p->length);
+}
+
+static void oer_strings_strings_f_decode_inner(
+    struct decoder_t *decoder_p,
+    struct oer_strings_strings_f_t *dst_p)
+{
+    dst_p->length = decoder_read_uint8(decoder_p);
+
+    if (dst_p->length > 1u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       (uint8_t *)&dst_p->buf[0],
+                       dst_p->length);
+    dst_p->buf[dst_p->length] = '\0';
+}
+
+static void oer_strings_strings_f_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = decoder_read_uint8(decoder_p);
+
+    if (length > 1u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length);
+}
+
+ssize_t oer_strings_strings_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_a_encoded_size(
+    const struct oer_strings_strings_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_strings_strings_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_a_decode(
+    struct oer_strings_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_strings_strings_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_a_decode_batch(
+    struct oer_strings_strings_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_strings_strings_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_a_decode_fields(
+    struct oer_strings_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_b_encoded_size(
+    const struct oer_strings_strings_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_strings_strings_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_b_decode(
+    struct oer_strings_strings_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_strings_strings_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_b_decode_batch(
+    struct oer_strings_strings_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_strings_strings_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_c_encoded_size(
+    const struct oer_strings_strings_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_strings_strings_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_c_decode(
+    struct oer_strings_strings_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_strings_strings_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_c_decode_batch(
+    struct oer_strings_strings_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_strings_strings_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_d_encoded_size(
+    const struct oer_strings_strings_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_strings_strings_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_d_decode(
+    struct oer_strings_strings_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_strings_strings_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_d_decode_batch(
+    struct oer_strings_strings_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_strings_strings_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_e_encoded_size(
+    const struct oer_strings_strings_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_strings_strings_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_e_decode(
+    struct oer_strings_strings_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_strings_strings_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_e_decode_batch(
+    struct oer_strings_strings_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_strings_strings_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_f_encoded_size(
+    const struct oer_strings_strings_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    oer_strings_strings_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_f_decode(
+    struct oer_strings_strings_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_f_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_f_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    oer_strings_strings_f_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t oer_strings_strings_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_f_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        oer_strings_strings_f_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t oer_strings_strings_f_decode_batch(
+    struct oer_strings_strings_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        oer_strings_strings_f_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+static void oer_strings_strings_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_strings_strings_a_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->a.buf[0],
+                                     src_p->a.length);
+    jer_encoder_append_string(encoder_p, ",\"b\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->b.buf[0],
+                                     5u);
+    jer_encoder_append_string(encoder_p, ",\"c\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->c.buf[0],
+                                     src_p->c.length);
+    jer_encoder_append_string(encoder_p, ",\"d\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->d.buf[0],
+                                     2u);
+    jer_encoder_append_string(encoder_p, ",\"e\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->e.buf[0],
+                                     src_p->e.length);
+    jer_encoder_append_string(encoder_p, ",\"f\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->f.buf[0],
+                                     12u);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_g_present) {
+        jer_encoder_append_string(encoder_p, "\"g\":", 4);
+        jer_encoder_append_quoted_string(encoder_p,
+                                         &src_p->g.buf[0],
+                                         src_p->g.length);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_append_string(encoder_p, "\"h\":", 4);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->h.buf[0],
+                                     src_p->h.length);
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void oer_strings_strings_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_strings_strings_b_t *src_p)
+{
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->buf[0],
+                                     src_p->length);
+}
+
+static void oer_strings_strings_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_strings_strings_c_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_char(encoder_p, '[');
+
+    for (i = 0; i < src_p->length; i++) {
+        oer_strings_strings_b_encode_jer_inner(encoder_p, &src_p->elements[i]);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+}
+
+static void oer_strings_strings_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_strings_strings_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case oer_strings_strings_d_choice_a_e:
+        jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+        jer_encoder_append_quoted_string(encoder_p,
+                                         &src_p->value.a.buf[0],
+                                         src_p->value.a.length);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    case oer_strings_strings_d_choice_b_e:
+        jer_encoder_append_string(encoder_p, "{\"b\":", 5);
+        oer_strings_strings_b_encode_jer_inner(encoder_p, &src_p->value.b);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    default:
+        jer_encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void oer_strings_strings_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_strings_strings_e_t *src_p)
+{
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->buf[0],
+                                     3u);
+}
+
+static void oer_strings_strings_f_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct oer_strings_strings_f_t *src_p)
+{
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->buf[0],
+                                     src_p->length);
+}
+
+ssize_t oer_strings_strings_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_e_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_e_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t oer_strings_strings_f_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct oer_strings_strings_f_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    oer_strings_strings_f_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
@@ -0,0 +1,13096 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:15 2026.
+ */
+
+#include <string.h>
+
+#include "per.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
+}
+
+static ALWAYS_INLINE void encoder_append_uint16(struct encoder_t *self_p,
+                                                uint16_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 16);
+}
+
+static ALWAYS_INLINE void encoder_append_int8(struct encoder_t *self_p,
+                                              int8_t value)
+{
+    encoder_append_uint8(self_p, (uint8_t)value + 128);
+}
+
+static ALWAYS_INLINE void encoder_append_int16(struct encoder_t *self_p,
+                                               int16_t value)
+{
+    encoder_append_uint16(self_p, (uint16_t)value + 32768);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
+}
+
+static ALWAYS_INLINE uint16_t decoder_read_uint16(struct decoder_t *self_p)
+{
+    return ((uint16_t)decoder_read_non_negative_binary_integer(self_p, 16));
+}
+
+static ALWAYS_INLINE int8_t decoder_read_int8(struct decoder_t *self_p)
+{
+    int8_t value;
+
+    value = (int8_t)decoder_read_uint8(self_p);
+    value -= 128;
+
+    return (value);
+}
+
+static ALWAYS_INLINE int16_t decoder_read_int16(struct decoder_t *self_p)
+{
+    int16_t value;
+
+    value = (int16_t)decoder_read_uint16(self_p);
+    value -= 32768;
+
+    return (value);
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static ALWAYS_INLINE void encoder_align(struct encoder_t *self_p)
+{
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static void encoder_append_indefinite_whole_number(struct encoder_t *self_p,
+                                                   uint64_t value,
+                                                   size_t number_of_length_bits)
+{
+    size_t number_of_bytes;
+
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8) && ((value >> (8 * number_of_bytes)) != 0)) {
+        number_of_bytes++;
+    }
+
+    encoder_append_non_negative_binary_integer(self_p,
+                                               number_of_bytes - 1,
+                                               number_of_length_bits);
+    encoder_align(self_p);
+    encoder_append_non_negative_binary_integer(self_p,
+                                               value,
+                                               8 * number_of_bytes);
+}
+
+static ALWAYS_INLINE void decoder_align(struct decoder_t *self_p)
+{
+    (void)decoder_free(self_p, (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static uint64_t decoder_read_indefinite_whole_number(struct decoder_t *self_p,
+                                                     size_t number_of_length_bits,
+                                                     size_t maximum_number_of_bytes)
+{
+    size_t number_of_bytes;
+
+    number_of_bytes = (size_t)decoder_read_non_negative_binary_integer(
+        self_p,
+        number_of_length_bits);
+    number_of_bytes++;
+
+    if (number_of_bytes > maximum_number_of_bytes) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    decoder_align(self_p);
+
+    return (decoder_read_non_negative_binary_integer(self_p,
+                                                     8 * number_of_bytes));
+}
+
+static void per_c_source_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_a_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_int8(encoder_p, src_p->a);
+    encoder_align(encoder_p);
+    encoder_append_int16(encoder_p, src_p->b);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->c + 2147483648u,
+        2);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->d + 9223372036854775808u,
+        3);
+    encoder_align(encoder_p);
+    encoder_append_uint8(encoder_p, src_p->e);
+    encoder_align(encoder_p);
+    encoder_append_uint16(encoder_p, src_p->f);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->g,
+        2);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->h,
+        3);
+    encoder_append_bool(encoder_p, src_p->i);
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->j.buf[0],
+                         11);
+}
+
+static void per_c_source_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_a_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->a = decoder_read_int8(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->b = decoder_read_int16(decoder_p);
+    dst_p->c = (int32_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        2,
+        4) - 2147483648u);
+    dst_p->d = (int64_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        3,
+        8) - 9223372036854775808u);
+    decoder_align(decoder_p);
+    dst_p->e = decoder_read_uint8(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->f = decoder_read_uint16(decoder_p);
+    dst_p->g = (uint32_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        2,
+        4));
+    dst_p->h = (uint64_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        3,
+        8));
+    dst_p->i = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->j.buf[0],
+                       11);
+}
+
+static void per_c_source_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_a_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_A_FIELD_A) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->a = decoder_read_int8(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->b = decoder_read_int16(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 16u);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_C) != 0u) {
+        dst_p->c = (int32_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            2,
+            4) - 2147483648u);
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 2, 4);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_D) != 0u) {
+        dst_p->d = (int64_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            3,
+            8) - 9223372036854775808u);
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 3, 8);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_E) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->e = decoder_read_uint8(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_F) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->f = decoder_read_uint16(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 16u);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_G) != 0u) {
+        dst_p->g = (uint32_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            2,
+            4));
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 2, 4);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_H) != 0u) {
+        dst_p->h = (uint64_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            3,
+            8));
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 3, 8);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_I) != 0u) {
+        dst_p->i = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_C_SOURCE_A_FIELD_J) != 0u) {
+        decoder_align(decoder_p);
+        decoder_read_bytes(decoder_p,
+                           &dst_p->j.buf[0],
+                           11);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 88u);
+    }
+}
+
+static void per_c_source_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 2, 4);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 3, 8);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 2, 4);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 3, 8);
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 88u);
+}
+
+static void per_c_source_ab_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ab_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->a - -1),
+        1);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->b - 10000),
+        16);
+}
+
+static void per_c_source_ab_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ab_t *dst_p)
+{
+    dst_p->a = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->a += -1;
+    decoder_align(decoder_p);
+    dst_p->b = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->b += 10000;
+}
+
+static void per_c_source_ab_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ab_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_AB_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->a += -1;
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_C_SOURCE_AB_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->b = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        dst_p->b += 10000;
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 16u);
+    }
+}
+
+static void per_c_source_ab_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+}
+
+static void per_c_source_q_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_q_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_c_source_q_choice_c001_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 16);
+        encoder_append_bool(encoder_p, src_p->value.c001);
+        break;
+
+    case per_c_source_q_choice_c002_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 16);
+        encoder_append_bool(encoder_p, src_p->value.c002);
+        break;
+
+    case per_c_source_q_choice_c003_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 2, 16);
+        encoder_append_bool(encoder_p, src_p->value.c003);
+        break;
+
+    case per_c_source_q_choice_c004_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 3, 16);
+        encoder_append_bool(encoder_p, src_p->value.c004);
+        break;
+
+    case per_c_source_q_choice_c005_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 4, 16);
+        encoder_append_bool(encoder_p, src_p->value.c005);
+        break;
+
+    case per_c_source_q_choice_c006_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 5, 16);
+        encoder_append_bool(encoder_p, src_p->value.c006);
+        break;
+
+    case per_c_source_q_choice_c007_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 6, 16);
+        encoder_append_bool(encoder_p, src_p->value.c007);
+        break;
+
+    case per_c_source_q_choice_c008_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 7, 16);
+        encoder_append_bool(encoder_p, src_p->value.c008);
+        break;
+
+    case per_c_source_q_choice_c009_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 8, 16);
+        encoder_append_bool(encoder_p, src_p->value.c009);
+        break;
+
+    case per_c_source_q_choice_c010_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 9, 16);
+        encoder_append_bool(encoder_p, src_p->value.c010);
+        break;
+
+    case per_c_source_q_choice_c011_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 10, 16);
+        encoder_append_bool(encoder_p, src_p->value.c011);
+        break;
+
+    case per_c_source_q_choice_c012_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 11, 16);
+        encoder_append_bool(encoder_p, src_p->value.c012);
+        break;
+
+    case per_c_source_q_choice_c013_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 12, 16);
+        encoder_append_bool(encoder_p, src_p->value.c013);
+        break;
+
+    case per_c_source_q_choice_c014_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 13, 16);
+        encoder_append_bool(encoder_p, src_p->value.c014);
+        break;
+
+    case per_c_source_q_choice_c015_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 14, 16);
+        encoder_append_bool(encoder_p, src_p->value.c015);
+        break;
+
+    case per_c_source_q_choice_c016_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 15, 16);
+        encoder_append_bool(encoder_p, src_p->value.c016);
+        break;
+
+    case per_c_source_q_choice_c017_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 16, 16);
+        encoder_append_bool(encoder_p, src_p->value.c017);
+        break;
+
+    case per_c_source_q_choice_c018_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 17, 16);
+        encoder_append_bool(encoder_p, src_p->value.c018);
+        break;
+
+    case per_c_source_q_choice_c019_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 18, 16);
+        encoder_append_bool(encoder_p, src_p->value.c019);
+        break;
+
+    case per_c_source_q_choice_c020_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 19, 16);
+        encoder_append_bool(encoder_p, src_p->value.c020);
+        break;
+
+    case per_c_source_q_choice_c021_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 20, 16);
+        encoder_append_bool(encoder_p, src_p->value.c021);
+        break;
+
+    case per_c_source_q_choice_c022_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 21, 16);
+        encoder_append_bool(encoder_p, src_p->value.c022);
+        break;
+
+    case per_c_source_q_choice_c023_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 22, 16);
+        encoder_append_bool(encoder_p, src_p->value.c023);
+        break;
+
+    case per_c_source_q_choice_c024_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 23, 16);
+        encoder_append_bool(encoder_p, src_p->value.c024);
+        break;
+
+    case per_c_source_q_choice_c025_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 24, 16);
+        encoder_append_bool(encoder_p, src_p->value.c025);
+        break;
+
+    case per_c_source_q_choice_c026_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 25, 16);
+        encoder_append_bool(encoder_p, src_p->value.c026);
+        break;
+
+    case per_c_source_q_choice_c027_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 26, 16);
+        encoder_append_bool(encoder_p, src_p->value.c027);
+        break;
+
+    case per_c_source_q_choice_c028_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 27, 16);
+        encoder_append_bool(encoder_p, src_p->value.c028);
+        break;
+
+    case per_c_source_q_choice_c029_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 28, 16);
+        encoder_append_bool(encoder_p, src_p->value.c029);
+        break;
+
+    case per_c_source_q_choice_c030_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 29, 16);
+        encoder_append_bool(encoder_p, src_p->value.c030);
+        break;
+
+    case per_c_source_q_choice_c031_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 30, 16);
+        encoder_append_bool(encoder_p, src_p->value.c031);
+        break;
+
+    case per_c_source_q_choice_c032_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 31, 16);
+        encoder_append_bool(encoder_p, src_p->value.c032);
+        break;
+
+    case per_c_source_q_choice_c033_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 32, 16);
+        encoder_append_bool(encoder_p, src_p->value.c033);
+        break;
+
+    case per_c_source_q_choice_c034_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 33, 16);
+        encoder_append_bool(encoder_p, src_p->value.c034);
+        break;
+
+    case per_c_source_q_choice_c035_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 34, 16);
+        encoder_append_bool(encoder_p, src_p->value.c035);
+        break;
+
+    case per_c_source_q_choice_c036_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 35, 16);
+        encoder_append_bool(encoder_p, src_p->value.c036);
+        break;
+
+    case per_c_source_q_choice_c037_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 36, 16);
+        encoder_append_bool(encoder_p, src_p->value.c037);
+        break;
+
+    case per_c_source_q_choice_c038_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 37, 16);
+        encoder_append_bool(encoder_p, src_p->value.c038);
+        break;
+
+    case per_c_source_q_choice_c039_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 38, 16);
+        encoder_append_bool(encoder_p, src_p->value.c039);
+        break;
+
+    case per_c_source_q_choice_c040_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 39, 16);
+        encoder_append_bool(encoder_p, src_p->value.c040);
+        break;
+
+    case per_c_source_q_choice_c041_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 40, 16);
+        encoder_append_bool(encoder_p, src_p->value.c041);
+        break;
+
+    case per_c_source_q_choice_c042_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 41, 16);
+        encoder_append_bool(encoder_p, src_p->value.c042);
+        break;
+
+    case per_c_source_q_choice_c043_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 42, 16);
+        encoder_append_bool(encoder_p, src_p->value.c043);
+        break;
+
+    case per_c_source_q_choice_c044_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 43, 16);
+        encoder_append_bool(encoder_p, src_p->value.c044);
+        break;
+
+    case per_c_source_q_choice_c045_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 44, 16);
+        encoder_append_bool(encoder_p, src_p->value.c045);
+        break;
+
+    case per_c_source_q_choice_c046_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 45, 16);
+        encoder_append_bool(encoder_p, src_p->value.c046);
+        break;
+
+    case per_c_source_q_choice_c047_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 46, 16);
+        encoder_append_bool(encoder_p, src_p->value.c047);
+        break;
+
+    case per_c_source_q_choice_c048_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 47, 16);
+        encoder_append_bool(encoder_p, src_p->value.c048);
+        break;
+
+    case per_c_source_q_choice_c049_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 48, 16);
+        encoder_append_bool(encoder_p, src_p->value.c049);
+        break;
+
+    case per_c_source_q_choice_c050_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 49, 16);
+        encoder_append_bool(encoder_p, src_p->value.c050);
+        break;
+
+    case per_c_source_q_choice_c051_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 50, 16);
+        encoder_append_bool(encoder_p, src_p->value.c051);
+        break;
+
+    case per_c_source_q_choice_c052_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 51, 16);
+        encoder_append_bool(encoder_p, src_p->value.c052);
+        break;
+
+    case per_c_source_q_choice_c053_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 52, 16);
+        encoder_append_bool(encoder_p, src_p->value.c053);
+        break;
+
+    case per_c_source_q_choice_c054_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 53, 16);
+        encoder_append_bool(encoder_p, src_p->value.c054);
+        break;
+
+    case per_c_source_q_choice_c055_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 54, 16);
+        encoder_append_bool(encoder_p, src_p->value.c055);
+        break;
+
+    case per_c_source_q_choice_c056_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 55, 16);
+        encoder_append_bool(encoder_p, src_p->value.c056);
+        break;
+
+    case per_c_source_q_choice_c057_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 56, 16);
+        encoder_append_bool(encoder_p, src_p->value.c057);
+        break;
+
+    case per_c_source_q_choice_c058_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 57, 16);
+        encoder_append_bool(encoder_p, src_p->value.c058);
+        break;
+
+    case per_c_source_q_choice_c059_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 58, 16);
+        encoder_append_bool(encoder_p, src_p->value.c059);
+        break;
+
+    case per_c_source_q_choice_c060_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 59, 16);
+        encoder_append_bool(encoder_p, src_p->value.c060);
+        break;
+
+    case per_c_source_q_choice_c061_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 60, 16);
+        encoder_append_bool(encoder_p, src_p->value.c061);
+        break;
+
+    case per_c_source_q_choice_c062_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 61, 16);
+        encoder_append_bool(encoder_p, src_p->value.c062);
+        break;
+
+    case per_c_source_q_choice_c063_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 62, 16);
+        encoder_append_bool(encoder_p, src_p->value.c063);
+        break;
+
+    case per_c_source_q_choice_c064_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 63, 16);
+        encoder_append_bool(encoder_p, src_p->value.c064);
+        break;
+
+    case per_c_source_q_choice_c065_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 64, 16);
+        encoder_append_bool(encoder_p, src_p->value.c065);
+        break;
+
+    case per_c_source_q_choice_c066_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 65, 16);
+        encoder_append_bool(encoder_p, src_p->value.c066);
+        break;
+
+    case per_c_source_q_choice_c067_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 66, 16);
+        encoder_append_bool(encoder_p, src_p->value.c067);
+        break;
+
+    case per_c_source_q_choice_c068_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 67, 16);
+        encoder_append_bool(encoder_p, src_p->value.c068);
+        break;
+
+    case per_c_source_q_choice_c069_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 68, 16);
+        encoder_append_bool(encoder_p, src_p->value.c069);
+        break;
+
+    case per_c_source_q_choice_c070_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 69, 16);
+        encoder_append_bool(encoder_p, src_p->value.c070);
+        break;
+
+    case per_c_source_q_choice_c071_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 70, 16);
+        encoder_append_bool(encoder_p, src_p->value.c071);
+        break;
+
+    case per_c_source_q_choice_c072_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 71, 16);
+        encoder_append_bool(encoder_p, src_p->value.c072);
+        break;
+
+    case per_c_source_q_choice_c073_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 72, 16);
+        encoder_append_bool(encoder_p, src_p->value.c073);
+        break;
+
+    case per_c_source_q_choice_c074_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 73, 16);
+        encoder_append_bool(encoder_p, src_p->value.c074);
+        break;
+
+    case per_c_source_q_choice_c075_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 74, 16);
+        encoder_append_bool(encoder_p, src_p->value.c075);
+        break;
+
+    case per_c_source_q_choice_c076_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 75, 16);
+        encoder_append_bool(encoder_p, src_p->value.c076);
+        break;
+
+    case per_c_source_q_choice_c077_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 76, 16);
+        encoder_append_bool(encoder_p, src_p->value.c077);
+        break;
+
+    case per_c_source_q_choice_c078_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 77, 16);
+        encoder_append_bool(encoder_p, src_p->value.c078);
+        break;
+
+    case per_c_source_q_choice_c079_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 78, 16);
+        encoder_append_bool(encoder_p, src_p->value.c079);
+        break;
+
+    case per_c_source_q_choice_c080_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 79, 16);
+        encoder_append_bool(encoder_p, src_p->value.c080);
+        break;
+
+    case per_c_source_q_choice_c081_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 80, 16);
+        encoder_append_bool(encoder_p, src_p->value.c081);
+        break;
+
+    case per_c_source_q_choice_c082_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 81, 16);
+        encoder_append_bool(encoder_p, src_p->value.c082);
+        break;
+
+    case per_c_source_q_choice_c083_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 82, 16);
+        encoder_append_bool(encoder_p, src_p->value.c083);
+        break;
+
+    case per_c_source_q_choice_c084_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 83, 16);
+        encoder_append_bool(encoder_p, src_p->value.c084);
+        break;
+
+    case per_c_source_q_choice_c085_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 84, 16);
+        encoder_append_bool(encoder_p, src_p->value.c085);
+        break;
+
+    case per_c_source_q_choice_c086_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 85, 16);
+        encoder_append_bool(encoder_p, src_p->value.c086);
+        break;
+
+    case per_c_source_q_choice_c087_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 86, 16);
+        encoder_append_bool(encoder_p, src_p->value.c087);
+        break;
+
+    case per_c_source_q_choice_c088_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 87, 16);
+        encoder_append_bool(encoder_p, src_p->value.c088);
+        break;
+
+    case per_c_source_q_choice_c089_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 88, 16);
+        encoder_append_bool(encoder_p, src_p->value.c089);
+        break;
+
+    case per_c_source_q_choice_c090_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 89, 16);
+        encoder_append_bool(encoder_p, src_p->value.c090);
+        break;
+
+    case per_c_source_q_choice_c091_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 90, 16);
+        encoder_append_bool(encoder_p, src_p->value.c091);
+        break;
+
+    case per_c_source_q_choice_c092_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 91, 16);
+        encoder_append_bool(encoder_p, src_p->value.c092);
+        break;
+
+    case per_c_source_q_choice_c093_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 92, 16);
+        encoder_append_bool(encoder_p, src_p->value.c093);
+        break;
+
+    case per_c_source_q_choice_c094_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 93, 16);
+        encoder_append_bool(encoder_p, src_p->value.c094);
+        break;
+
+    case per_c_source_q_choice_c095_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 94, 16);
+        encoder_append_bool(encoder_p, src_p->value.c095);
+        break;
+
+    case per_c_source_q_choice_c096_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 95, 16);
+        encoder_append_bool(encoder_p, src_p->value.c096);
+        break;
+
+    case per_c_source_q_choice_c097_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 96, 16);
+        encoder_append_bool(encoder_p, src_p->value.c097);
+        break;
+
+    case per_c_source_q_choice_c098_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 97, 16);
+        encoder_append_bool(encoder_p, src_p->value.c098);
+        break;
+
+    case per_c_source_q_choice_c099_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 98, 16);
+        encoder_append_bool(encoder_p, src_p->value.c099);
+        break;
+
+    case per_c_source_q_choice_c100_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 99, 16);
+        encoder_append_bool(encoder_p, src_p->value.c100);
+        break;
+
+    case per_c_source_q_choice_c101_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 100, 16);
+        encoder_append_bool(encoder_p, src_p->value.c101);
+        break;
+
+    case per_c_source_q_choice_c102_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 101, 16);
+        encoder_append_bool(encoder_p, src_p->value.c102);
+        break;
+
+    case per_c_source_q_choice_c103_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 102, 16);
+        encoder_append_bool(encoder_p, src_p->value.c103);
+        break;
+
+    case per_c_source_q_choice_c104_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 103, 16);
+        encoder_append_bool(encoder_p, src_p->value.c104);
+        break;
+
+    case per_c_source_q_choice_c105_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 104, 16);
+        encoder_append_bool(encoder_p, src_p->value.c105);
+        break;
+
+    case per_c_source_q_choice_c106_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 105, 16);
+        encoder_append_bool(encoder_p, src_p->value.c106);
+        break;
+
+    case per_c_source_q_choice_c107_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 106, 16);
+        encoder_append_bool(encoder_p, src_p->value.c107);
+        break;
+
+    case per_c_source_q_choice_c108_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 107, 16);
+        encoder_append_bool(encoder_p, src_p->value.c108);
+        break;
+
+    case per_c_source_q_choice_c109_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 108, 16);
+        encoder_append_bool(encoder_p, src_p->value.c109);
+        break;
+
+    case per_c_source_q_choice_c110_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 109, 16);
+        encoder_append_bool(encoder_p, src_p->value.c110);
+        break;
+
+    case per_c_source_q_choice_c111_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 110, 16);
+        encoder_append_bool(encoder_p, src_p->value.c111);
+        break;
+
+    case per_c_source_q_choice_c112_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 111, 16);
+        encoder_append_bool(encoder_p, src_p->value.c112);
+        break;
+
+    case per_c_source_q_choice_c113_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 112, 16);
+        encoder_append_bool(encoder_p, src_p->value.c113);
+        break;
+
+    case per_c_source_q_choice_c114_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 113, 16);
+        encoder_append_bool(encoder_p, src_p->value.c114);
+        break;
+
+    case per_c_source_q_choice_c115_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 114, 16);
+        encoder_append_bool(encoder_p, src_p->value.c115);
+        break;
+
+    case per_c_source_q_choice_c116_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 115, 16);
+        encoder_append_bool(encoder_p, src_p->value.c116);
+        break;
+
+    case per_c_source_q_choice_c117_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 116, 16);
+        encoder_append_bool(encoder_p, src_p->value.c117);
+        break;
+
+    case per_c_source_q_choice_c118_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 117, 16);
+        encoder_append_bool(encoder_p, src_p->value.c118);
+        break;
+
+    case per_c_source_q_choice_c119_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 118, 16);
+        encoder_append_bool(encoder_p, src_p->value.c119);
+        break;
+
+    case per_c_source_q_choice_c120_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 119, 16);
+        encoder_append_bool(encoder_p, src_p->value.c120);
+        break;
+
+    case per_c_source_q_choice_c121_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 120, 16);
+        encoder_append_bool(encoder_p, src_p->value.c121);
+        break;
+
+    case per_c_source_q_choice_c122_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 121, 16);
+        encoder_append_bool(encoder_p, src_p->value.c122);
+        break;
+
+    case per_c_source_q_choice_c123_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 122, 16);
+        encoder_append_bool(encoder_p, src_p->value.c123);
+        break;
+
+    case per_c_source_q_choice_c124_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 123, 16);
+        encoder_append_bool(encoder_p, src_p->value.c124);
+        break;
+
+    case per_c_source_q_choice_c125_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 124, 16);
+        encoder_append_bool(encoder_p, src_p->value.c125);
+        break;
+
+    case per_c_source_q_choice_c126_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 125, 16);
+        encoder_append_bool(encoder_p, src_p->value.c126);
+        break;
+
+    case per_c_source_q_choice_c127_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 126, 16);
+        encoder_append_bool(encoder_p, src_p->value.c127);
+        break;
+
+    case per_c_source_q_choice_c128_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 127, 16);
+        encoder_append_bool(encoder_p, src_p->value.c128);
+        break;
+
+    case per_c_source_q_choice_c129_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 128, 16);
+        encoder_append_bool(encoder_p, src_p->value.c129);
+        break;
+
+    case per_c_source_q_choice_c130_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 129, 16);
+        encoder_append_bool(encoder_p, src_p->value.c130);
+        break;
+
+    case per_c_source_q_choice_c131_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 130, 16);
+        encoder_append_bool(encoder_p, src_p->value.c131);
+        break;
+
+    case per_c_source_q_choice_c132_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 131, 16);
+        encoder_append_bool(encoder_p, src_p->value.c132);
+        break;
+
+    case per_c_source_q_choice_c133_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 132, 16);
+        encoder_append_bool(encoder_p, src_p->value.c133);
+        break;
+
+    case per_c_source_q_choice_c134_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 133, 16);
+        encoder_append_bool(encoder_p, src_p->value.c134);
+        break;
+
+    case per_c_source_q_choice_c135_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 134, 16);
+        encoder_append_bool(encoder_p, src_p->value.c135);
+        break;
+
+    case per_c_source_q_choice_c136_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 135, 16);
+        encoder_append_bool(encoder_p, src_p->value.c136);
+        break;
+
+    case per_c_source_q_choice_c137_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 136, 16);
+        encoder_append_bool(encoder_p, src_p->value.c137);
+        break;
+
+    case per_c_source_q_choice_c138_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 137, 16);
+        encoder_append_bool(encoder_p, src_p->value.c138);
+        break;
+
+    case per_c_source_q_choice_c139_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 138, 16);
+        encoder_append_bool(encoder_p, src_p->value.c139);
+        break;
+
+    case per_c_source_q_choice_c140_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 139, 16);
+        encoder_append_bool(encoder_p, src_p->value.c140);
+        break;
+
+    case per_c_source_q_choice_c141_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 140, 16);
+        encoder_append_bool(encoder_p, src_p->value.c141);
+        break;
+
+    case per_c_source_q_choice_c142_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 141, 16);
+        encoder_append_bool(encoder_p, src_p->value.c142);
+        break;
+
+    case per_c_source_q_choice_c143_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 142, 16);
+        encoder_append_bool(encoder_p, src_p->value.c143);
+        break;
+
+    case per_c_source_q_choice_c144_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 143, 16);
+        encoder_append_bool(encoder_p, src_p->value.c144);
+        break;
+
+    case per_c_source_q_choice_c145_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 144, 16);
+        encoder_append_bool(encoder_p, src_p->value.c145);
+        break;
+
+    case per_c_source_q_choice_c146_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 145, 16);
+        encoder_append_bool(encoder_p, src_p->value.c146);
+        break;
+
+    case per_c_source_q_choice_c147_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 146, 16);
+        encoder_append_bool(encoder_p, src_p->value.c147);
+        break;
+
+    case per_c_source_q_choice_c148_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 147, 16);
+        encoder_append_bool(encoder_p, src_p->value.c148);
+        break;
+
+    case per_c_source_q_choice_c149_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 148, 16);
+        encoder_append_bool(encoder_p, src_p->value.c149);
+        break;
+
+    case per_c_source_q_choice_c150_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 149, 16);
+        encoder_append_bool(encoder_p, src_p->value.c150);
+        break;
+
+    case per_c_source_q_choice_c151_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 150, 16);
+        encoder_append_bool(encoder_p, src_p->value.c151);
+        break;
+
+    case per_c_source_q_choice_c152_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 151, 16);
+        encoder_append_bool(encoder_p, src_p->value.c152);
+        break;
+
+    case per_c_source_q_choice_c153_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 152, 16);
+        encoder_append_bool(encoder_p, src_p->value.c153);
+        break;
+
+    case per_c_source_q_choice_c154_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 153, 16);
+        encoder_append_bool(encoder_p, src_p->value.c154);
+        break;
+
+    case per_c_source_q_choice_c155_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 154, 16);
+        encoder_append_bool(encoder_p, src_p->value.c155);
+        break;
+
+    case per_c_source_q_choice_c156_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 155, 16);
+        encoder_append_bool(encoder_p, src_p->value.c156);
+        break;
+
+    case per_c_source_q_choice_c157_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 156, 16);
+        encoder_append_bool(encoder_p, src_p->value.c157);
+        break;
+
+    case per_c_source_q_choice_c158_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 157, 16);
+        encoder_append_bool(encoder_p, src_p->value.c158);
+        break;
+
+    case per_c_source_q_choice_c159_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 158, 16);
+        encoder_append_bool(encoder_p, src_p->value.c159);
+        break;
+
+    case per_c_source_q_choice_c160_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 159, 16);
+        encoder_append_bool(encoder_p, src_p->value.c160);
+        break;
+
+    case per_c_source_q_choice_c161_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 160, 16);
+        encoder_append_bool(encoder_p, src_p->value.c161);
+        break;
+
+    case per_c_source_q_choice_c162_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 161, 16);
+        encoder_append_bool(encoder_p, src_p->value.c162);
+        break;
+
+    case per_c_source_q_choice_c163_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 162, 16);
+        encoder_append_bool(encoder_p, src_p->value.c163);
+        break;
+
+    case per_c_source_q_choice_c164_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 163, 16);
+        encoder_append_bool(encoder_p, src_p->value.c164);
+        break;
+
+    case per_c_source_q_choice_c165_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 164, 16);
+        encoder_append_bool(encoder_p, src_p->value.c165);
+        break;
+
+    case per_c_source_q_choice_c166_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 165, 16);
+        encoder_append_bool(encoder_p, src_p->value.c166);
+        break;
+
+    case per_c_source_q_choice_c167_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 166, 16);
+        encoder_append_bool(encoder_p, src_p->value.c167);
+        break;
+
+    case per_c_source_q_choice_c168_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 167, 16);
+        encoder_append_bool(encoder_p, src_p->value.c168);
+        break;
+
+    case per_c_source_q_choice_c169_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 168, 16);
+        encoder_append_bool(encoder_p, src_p->value.c169);
+        break;
+
+    case per_c_source_q_choice_c170_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 169, 16);
+        encoder_append_bool(encoder_p, src_p->value.c170);
+        break;
+
+    case per_c_source_q_choice_c171_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 170, 16);
+        encoder_append_bool(encoder_p, src_p->value.c171);
+        break;
+
+    case per_c_source_q_choice_c172_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 171, 16);
+        encoder_append_bool(encoder_p, src_p->value.c172);
+        break;
+
+    case per_c_source_q_choice_c173_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 172, 16);
+        encoder_append_bool(encoder_p, src_p->value.c173);
+        break;
+
+    case per_c_source_q_choice_c174_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 173, 16);
+        encoder_append_bool(encoder_p, src_p->value.c174);
+        break;
+
+    case per_c_source_q_choice_c175_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 174, 16);
+        encoder_append_bool(encoder_p, src_p->value.c175);
+        break;
+
+    case per_c_source_q_choice_c176_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 175, 16);
+        encoder_append_bool(encoder_p, src_p->value.c176);
+        break;
+
+    case per_c_source_q_choice_c177_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 176, 16);
+        encoder_append_bool(encoder_p, src_p->value.c177);
+        break;
+
+    case per_c_source_q_choice_c178_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 177, 16);
+        encoder_append_bool(encoder_p, src_p->value.c178);
+        break;
+
+    case per_c_source_q_choice_c179_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 178, 16);
+        encoder_append_bool(encoder_p, src_p->value.c179);
+        break;
+
+    case per_c_source_q_choice_c180_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 179, 16);
+        encoder_append_bool(encoder_p, src_p->value.c180);
+        break;
+
+    case per_c_source_q_choice_c181_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 180, 16);
+        encoder_append_bool(encoder_p, src_p->value.c181);
+        break;
+
+    case per_c_source_q_choice_c182_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 181, 16);
+        encoder_append_bool(encoder_p, src_p->value.c182);
+        break;
+
+    case per_c_source_q_choice_c183_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 182, 16);
+        encoder_append_bool(encoder_p, src_p->value.c183);
+        break;
+
+    case per_c_source_q_choice_c184_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 183, 16);
+        encoder_append_bool(encoder_p, src_p->value.c184);
+        break;
+
+    case per_c_source_q_choice_c185_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 184, 16);
+        encoder_append_bool(encoder_p, src_p->value.c185);
+        break;
+
+    case per_c_source_q_choice_c186_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 185, 16);
+        encoder_append_bool(encoder_p, src_p->value.c186);
+        break;
+
+    case per_c_source_q_choice_c187_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 186, 16);
+        encoder_append_bool(encoder_p, src_p->value.c187);
+        break;
+
+    case per_c_source_q_choice_c188_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 187, 16);
+        encoder_append_bool(encoder_p, src_p->value.c188);
+        break;
+
+    case per_c_source_q_choice_c189_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 188, 16);
+        encoder_append_bool(encoder_p, src_p->value.c189);
+        break;
+
+    case per_c_source_q_choice_c190_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 189, 16);
+        encoder_append_bool(encoder_p, src_p->value.c190);
+        break;
+
+    case per_c_source_q_choice_c191_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 190, 16);
+        encoder_append_bool(encoder_p, src_p->value.c191);
+        break;
+
+    case per_c_source_q_choice_c192_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 191, 16);
+        encoder_append_bool(encoder_p, src_p->value.c192);
+        break;
+
+    case per_c_source_q_choice_c193_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 192, 16);
+        encoder_append_bool(encoder_p, src_p->value.c193);
+        break;
+
+    case per_c_source_q_choice_c194_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 193, 16);
+        encoder_append_bool(encoder_p, src_p->value.c194);
+        break;
+
+    case per_c_source_q_choice_c195_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 194, 16);
+        encoder_append_bool(encoder_p, src_p->value.c195);
+        break;
+
+    case per_c_source_q_choice_c196_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 195, 16);
+        encoder_append_bool(encoder_p, src_p->value.c196);
+        break;
+
+    case per_c_source_q_choice_c197_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 196, 16);
+        encoder_append_bool(encoder_p, src_p->value.c197);
+        break;
+
+    case per_c_source_q_choice_c198_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 197, 16);
+        encoder_append_bool(encoder_p, src_p->value.c198);
+        break;
+
+    case per_c_source_q_choice_c199_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 198, 16);
+        encoder_append_bool(encoder_p, src_p->value.c199);
+        break;
+
+    case per_c_source_q_choice_c200_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 199, 16);
+        encoder_append_bool(encoder_p, src_p->value.c200);
+        break;
+
+    case per_c_source_q_choice_c201_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 200, 16);
+        encoder_append_bool(encoder_p, src_p->value.c201);
+        break;
+
+    case per_c_source_q_choice_c202_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 201, 16);
+        encoder_append_bool(encoder_p, src_p->value.c202);
+        break;
+
+    case per_c_source_q_choice_c203_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 202, 16);
+        encoder_append_bool(encoder_p, src_p->value.c203);
+        break;
+
+    case per_c_source_q_choice_c204_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 203, 16);
+        encoder_append_bool(encoder_p, src_p->value.c204);
+        break;
+
+    case per_c_source_q_choice_c205_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 204, 16);
+        encoder_append_bool(encoder_p, src_p->value.c205);
+        break;
+
+    case per_c_source_q_choice_c206_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 205, 16);
+        encoder_append_bool(encoder_p, src_p->value.c206);
+        break;
+
+    case per_c_source_q_choice_c207_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 206, 16);
+        encoder_append_bool(encoder_p, src_p->value.c207);
+        break;
+
+    case per_c_source_q_choice_c208_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 207, 16);
+        encoder_append_bool(encoder_p, src_p->value.c208);
+        break;
+
+    case per_c_source_q_choice_c209_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 208, 16);
+        encoder_append_bool(encoder_p, src_p->value.c209);
+        break;
+
+    case per_c_source_q_choice_c210_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 209, 16);
+        encoder_append_bool(encoder_p, src_p->value.c210);
+        break;
+
+    case per_c_source_q_choice_c211_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 210, 16);
+        encoder_append_bool(encoder_p, src_p->value.c211);
+        break;
+
+    case per_c_source_q_choice_c212_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 211, 16);
+        encoder_append_bool(encoder_p, src_p->value.c212);
+        break;
+
+    case per_c_source_q_choice_c213_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 212, 16);
+        encoder_append_bool(encoder_p, src_p->value.c213);
+        break;
+
+    case per_c_source_q_choice_c214_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 213, 16);
+        encoder_append_bool(encoder_p, src_p->value.c214);
+        break;
+
+    case per_c_source_q_choice_c215_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 214, 16);
+        encoder_append_bool(encoder_p, src_p->value.c215);
+        break;
+
+    case per_c_source_q_choice_c216_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 215, 16);
+        encoder_append_bool(encoder_p, src_p->value.c216);
+        break;
+
+    case per_c_source_q_choice_c217_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 216, 16);
+        encoder_append_bool(encoder_p, src_p->value.c217);
+        break;
+
+    case per_c_source_q_choice_c218_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 217, 16);
+        encoder_append_bool(encoder_p, src_p->value.c218);
+        break;
+
+    case per_c_source_q_choice_c219_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 218, 16);
+        encoder_append_bool(encoder_p, src_p->value.c219);
+        break;
+
+    case per_c_source_q_choice_c220_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 219, 16);
+        encoder_append_bool(encoder_p, src_p->value.c220);
+        break;
+
+    case per_c_source_q_choice_c221_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 220, 16);
+        encoder_append_bool(encoder_p, src_p->value.c221);
+        break;
+
+    case per_c_source_q_choice_c222_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 221, 16);
+        encoder_append_bool(encoder_p, src_p->value.c222);
+        break;
+
+    case per_c_source_q_choice_c223_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 222, 16);
+        encoder_append_bool(encoder_p, src_p->value.c223);
+        break;
+
+    case per_c_source_q_choice_c224_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 223, 16);
+        encoder_append_bool(encoder_p, src_p->value.c224);
+        break;
+
+    case per_c_source_q_choice_c225_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 224, 16);
+        encoder_append_bool(encoder_p, src_p->value.c225);
+        break;
+
+    case per_c_source_q_choice_c226_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 225, 16);
+        encoder_append_bool(encoder_p, src_p->value.c226);
+        break;
+
+    case per_c_source_q_choice_c227_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 226, 16);
+        encoder_append_bool(encoder_p, src_p->value.c227);
+        break;
+
+    case per_c_source_q_choice_c228_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 227, 16);
+        encoder_append_bool(encoder_p, src_p->value.c228);
+        break;
+
+    case per_c_source_q_choice_c229_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 228, 16);
+        encoder_append_bool(encoder_p, src_p->value.c229);
+        break;
+
+    case per_c_source_q_choice_c230_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 229, 16);
+        encoder_append_bool(encoder_p, src_p->value.c230);
+        break;
+
+    case per_c_source_q_choice_c231_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 230, 16);
+        encoder_append_bool(encoder_p, src_p->value.c231);
+        break;
+
+    case per_c_source_q_choice_c232_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 231, 16);
+        encoder_append_bool(encoder_p, src_p->value.c232);
+        break;
+
+    case per_c_source_q_choice_c233_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 232, 16);
+        encoder_append_bool(encoder_p, src_p->value.c233);
+        break;
+
+    case per_c_source_q_choice_c234_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 233, 16);
+        encoder_append_bool(encoder_p, src_p->value.c234);
+        break;
+
+    case per_c_source_q_choice_c235_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 234, 16);
+        encoder_append_bool(encoder_p, src_p->value.c235);
+        break;
+
+    case per_c_source_q_choice_c236_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 235, 16);
+        encoder_append_bool(encoder_p, src_p->value.c236);
+        break;
+
+    case per_c_source_q_choice_c237_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 236, 16);
+        encoder_append_bool(encoder_p, src_p->value.c237);
+        break;
+
+    case per_c_source_q_choice_c238_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 237, 16);
+        encoder_append_bool(encoder_p, src_p->value.c238);
+        break;
+
+    case per_c_source_q_choice_c239_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 238, 16);
+        encoder_append_bool(encoder_p, src_p->value.c239);
+        break;
+
+    case per_c_source_q_choice_c240_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 239, 16);
+        encoder_append_bool(encoder_p, src_p->value.c240);
+        break;
+
+    case per_c_source_q_choice_c241_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 240, 16);
+        encoder_append_bool(encoder_p, src_p->value.c241);
+        break;
+
+    case per_c_source_q_choice_c242_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 241, 16);
+        encoder_append_bool(encoder_p, src_p->value.c242);
+        break;
+
+    case per_c_source_q_choice_c243_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 242, 16);
+        encoder_append_bool(encoder_p, src_p->value.c243);
+        break;
+
+    case per_c_source_q_choice_c244_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 243, 16);
+        encoder_append_bool(encoder_p, src_p->value.c244);
+        break;
+
+    case per_c_source_q_choice_c245_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 244, 16);
+        encoder_append_bool(encoder_p, src_p->value.c245);
+        break;
+
+    case per_c_source_q_choice_c246_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 245, 16);
+        encoder_append_bool(encoder_p, src_p->value.c246);
+        break;
+
+    case per_c_source_q_choice_c247_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 246, 16);
+        encoder_append_bool(encoder_p, src_p->value.c247);
+        break;
+
+    case per_c_source_q_choice_c248_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 247, 16);
+        encoder_append_bool(encoder_p, src_p->value.c248);
+        break;
+
+    case per_c_source_q_choice_c249_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 248, 16);
+        encoder_append_bool(encoder_p, src_p->value.c249);
+        break;
+
+    case per_c_source_q_choice_c250_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 249, 16);
+        encoder_append_bool(encoder_p, src_p->value.c250);
+        break;
+
+    case per_c_source_q_choice_c251_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 250, 16);
+        encoder_append_bool(encoder_p, src_p->value.c251);
+        break;
+
+    case per_c_source_q_choice_c252_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 251, 16);
+        encoder_append_bool(encoder_p, src_p->value.c252);
+        break;
+
+    case per_c_source_q_choice_c253_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 252, 16);
+        encoder_append_bool(encoder_p, src_p->value.c253);
+        break;
+
+    case per_c_source_q_choice_c254_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 253, 16);
+        encoder_append_bool(encoder_p, src_p->value.c254);
+        break;
+
+    case per_c_source_q_choice_c255_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 254, 16);
+        encoder_append_bool(encoder_p, src_p->value.c255);
+        break;
+
+    case per_c_source_q_choice_c256_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 255, 16);
+        encoder_append_bool(encoder_p, src_p->value.c256);
+        break;
+
+    case per_c_source_q_choice_c257_e:
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(encoder_p, 256, 16);
+        encoder_append_bool(encoder_p, src_p->value.c257);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_q_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_q_t *dst_p)
+{
+    uint16_t choice;
+
+    decoder_align(decoder_p);
+    choice = (uint16_t)decoder_read_non_negative_binary_integer(decoder_p, 16);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = per_c_source_q_choice_c001_e;
+        dst_p->value.c001 = decoder_read_bool(decoder_p);
+        break;
+
+    case 1:
+        dst_p->choice = per_c_source_q_choice_c002_e;
+        dst_p->value.c002 = decoder_read_bool(decoder_p);
+        break;
+
+    case 2:
+        dst_p->choice = per_c_source_q_choice_c003_e;
+        dst_p->value.c003 = decoder_read_bool(decoder_p);
+        break;
+
+    case 3:
+        dst_p->choice = per_c_source_q_choice_c004_e;
+        dst_p->value.c004 = decoder_read_bool(decoder_p);
+        break;
+
+    case 4:
+        dst_p->choice = per_c_source_q_choice_c005_e;
+        dst_p->value.c005 = decoder_read_bool(decoder_p);
+        break;
+
+    case 5:
+        dst_p->choice = per_c_source_q_choice_c006_e;
+        dst_p->value.c006 = decoder_read_bool(decoder_p);
+        break;
+
+    case 6:
+        dst_p->choice = per_c_source_q_choice_c007_e;
+        dst_p->value.c007 = decoder_read_bool(decoder_p);
+        break;
+
+    case 7:
+        dst_p->choice = per_c_source_q_choice_c008_e;
+        dst_p->value.c008 = decoder_read_bool(decoder_p);
+        break;
+
+    case 8:
+        dst_p->choice = per_c_source_q_choice_c009_e;
+        dst_p->value.c009 = decoder_read_bool(decoder_p);
+        break;
+
+    case 9:
+        dst_p->choice = per_c_source_q_choice_c010_e;
+        dst_p->value.c010 = decoder_read_bool(decoder_p);
+        break;
+
+    case 10:
+        dst_p->choice = per_c_source_q_choice_c011_e;
+        dst_p->value.c011 = decoder_read_bool(decoder_p);
+        break;
+
+    case 11:
+        dst_p->choice = per_c_source_q_choice_c012_e;
+        dst_p->value.c012 = decoder_read_bool(decoder_p);
+        break;
+
+    case 12:
+        dst_p->choice = per_c_source_q_choice_c013_e;
+        dst_p->value.c013 = decoder_read_bool(decoder_p);
+        break;
+
+    case 13:
+        dst_p->choice = per_c_source_q_choice_c014_e;
+        dst_p->value.c014 = decoder_read_bool(decoder_p);
+        break;
+
+    case 14:
+        dst_p->choice = per_c_source_q_choice_c015_e;
+        dst_p->value.c015 = decoder_read_bool(decoder_p);
+        break;
+
+    case 15:
+        dst_p->choice = per_c_source_q_choice_c016_e;
+        dst_p->value.c016 = decoder_read_bool(decoder_p);
+        break;
+
+    case 16:
+        dst_p->choice = per_c_source_q_choice_c017_e;
+        dst_p->value.c017 = decoder_read_bool(decoder_p);
+        break;
+
+    case 17:
+        dst_p->choice = per_c_source_q_choice_c018_e;
+        dst_p->value.c018 = decoder_read_bool(decoder_p);
+        break;
+
+    case 18:
+        dst_p->choice = per_c_source_q_choice_c019_e;
+        dst_p->value.c019 = decoder_read_bool(decoder_p);
+        break;
+
+    case 19:
+        dst_p->choice = per_c_source_q_choice_c020_e;
+        dst_p->value.c020 = decoder_read_bool(decoder_p);
+        break;
+
+    case 20:
+        dst_p->choice = per_c_source_q_choice_c021_e;
+        dst_p->value.c021 = decoder_read_bool(decoder_p);
+        break;
+
+    case 21:
+        dst_p->choice = per_c_source_q_choice_c022_e;
+        dst_p->value.c022 = decoder_read_bool(decoder_p);
+        break;
+
+    case 22:
+        dst_p->choice = per_c_source_q_choice_c023_e;
+        dst_p->value.c023 = decoder_read_bool(decoder_p);
+        break;
+
+    case 23:
+        dst_p->choice = per_c_source_q_choice_c024_e;
+        dst_p->value.c024 = decoder_read_bool(decoder_p);
+        break;
+
+    case 24:
+        dst_p->choice = per_c_source_q_choice_c025_e;
+        dst_p->value.c025 = decoder_read_bool(decoder_p);
+        break;
+
+    case 25:
+        dst_p->choice = per_c_source_q_choice_c026_e;
+        dst_p->value.c026 = decoder_read_bool(decoder_p);
+        break;
+
+    case 26:
+        dst_p->choice = per_c_source_q_choice_c027_e;
+        dst_p->value.c027 = decoder_read_bool(decoder_p);
+        break;
+
+    case 27:
+        dst_p->choice = per_c_source_q_choice_c028_e;
+        dst_p->value.c028 = decoder_read_bool(decoder_p);
+        break;
+
+    case 28:
+        dst_p->choice = per_c_source_q_choice_c029_e;
+        dst_p->value.c029 = decoder_read_bool(decoder_p);
+        break;
+
+    case 29:
+        dst_p->choice = per_c_source_q_choice_c030_e;
+        dst_p->value.c030 = decoder_read_bool(decoder_p);
+        break;
+
+    case 30:
+        dst_p->choice = per_c_source_q_choice_c031_e;
+        dst_p->value.c031 = decoder_read_bool(decoder_p);
+        break;
+
+    case 31:
+        dst_p->choice = per_c_source_q_choice_c032_e;
+        dst_p->value.c032 = decoder_read_bool(decoder_p);
+        break;
+
+    case 32:
+        dst_p->choice = per_c_source_q_choice_c033_e;
+        dst_p->value.c033 = decoder_read_bool(decoder_p);
+        break;
+
+    case 33:
+        dst_p->choice = per_c_source_q_choice_c034_e;
+        dst_p->value.c034 = decoder_read_bool(decoder_p);
+        break;
+
+    case 34:
+        dst_p->choice = per_c_source_q_choice_c035_e;
+        dst_p->value.c035 = decoder_read_bool(decoder_p);
+        break;
+
+    case 35:
+        dst_p->choice = per_c_source_q_choice_c036_e;
+        dst_p->value.c036 = decoder_read_bool(decoder_p);
+        break;
+
+    case 36:
+        dst_p->choice = per_c_source_q_choice_c037_e;
+        dst_p->value.c037 = decoder_read_bool(decoder_p);
+        break;
+
+    case 37:
+        dst_p->choice = per_c_source_q_choice_c038_e;
+        dst_p->value.c038 = decoder_read_bool(decoder_p);
+        break;
+
+    case 38:
+        dst_p->choice = per_c_source_q_choice_c039_e;
+        dst_p->value.c039 = decoder_read_bool(decoder_p);
+        break;
+
+    case 39:
+        dst_p->choice = per_c_source_q_choice_c040_e;
+        dst_p->value.c040 = decoder_read_bool(decoder_p);
+        break;
+
+    case 40:
+        dst_p->choice = per_c_source_q_choice_c041_e;
+        dst_p->value.c041 = decoder_read_bool(decoder_p);
+        break;
+
+    case 41:
+        dst_p->choice = per_c_source_q_choice_c042_e;
+        dst_p->value.c042 = decoder_read_bool(decoder_p);
+        break;
+
+    case 42:
+        dst_p->choice = per_c_source_q_choice_c043_e;
+        dst_p->value.c043 = decoder_read_bool(decoder_p);
+        break;
+
+    case 43:
+        dst_p->choice = per_c_source_q_choice_c044_e;
+        dst_p->value.c044 = decoder_read_bool(decoder_p);
+        break;
+
+    case 44:
+        dst_p->choice = per_c_source_q_choice_c045_e;
+        dst_p->value.c045 = decoder_read_bool(decoder_p);
+        break;
+
+    case 45:
+        dst_p->choice = per_c_source_q_choice_c046_e;
+        dst_p->value.c046 = decoder_read_bool(decoder_p);
+        break;
+
+    case 46:
+        dst_p->choice = per_c_source_q_choice_c047_e;
+        dst_p->value.c047 = decoder_read_bool(decoder_p);
+        break;
+
+    case 47:
+        dst_p->choice = per_c_source_q_choice_c048_e;
+        dst_p->value.c048 = decoder_read_bool(decoder_p);
+        break;
+
+    case 48:
+        dst_p->choice = per_c_source_q_choice_c049_e;
+        dst_p->value.c049 = decoder_read_bool(decoder_p);
+        break;
+
+    case 49:
+        dst_p->choice = per_c_source_q_choice_c050_e;
+        dst_p->value.c050 = decoder_read_bool(decoder_p);
+        break;
+
+    case 50:
+        dst_p->choice = per_c_source_q_choice_c051_e;
+        dst_p->value.c051 = decoder_read_bool(decoder_p);
+        break;
+
+    case 51:
+        dst_p->choice = per_c_source_q_choice_c052_e;
+        dst_p->value.c052 = decoder_read_bool(decoder_p);
+        break;
+
+    case 52:
+        dst_p->choice = per_c_source_q_choice_c053_e;
+        dst_p->value.c053 = decoder_read_bool(decoder_p);
+        break;
+
+    case 53:
+        dst_p->choice = per_c_source_q_choice_c054_e;
+        dst_p->value.c054 = decoder_read_bool(decoder_p);
+        break;
+
+    case 54:
+        dst_p->choice = per_c_source_q_choice_c055_e;
+        dst_p->value.c055 = decoder_read_bool(decoder_p);
+        break;
+
+    case 55:
+        dst_p->choice = per_c_source_q_choice_c056_e;
+        dst_p->value.c056 = decoder_read_bool(decoder_p);
+        break;
+
+    case 56:
+        dst_p->choice = per_c_source_q_choice_c057_e;
+        dst_p->value.c057 = decoder_read_bool(decoder_p);
+        break;
+
+    case 57:
+        dst_p->choice = per_c_source_q_choice_c058_e;
+        dst_p->value.c058 = decoder_read_bool(decoder_p);
+        break;
+
+    case 58:
+        dst_p->choice = per_c_source_q_choice_c059_e;
+        dst_p->value.c059 = decoder_read_bool(decoder_p);
+        break;
+
+    case 59:
+        dst_p->choice = per_c_source_q_choice_c060_e;
+        dst_p->value.c060 = decoder_read_bool(decoder_p);
+        break;
+
+    case 60:
+        dst_p->choice = per_c_source_q_choice_c061_e;
+        dst_p->value.c061 = decoder_read_bool(decoder_p);
+        break;
+
+    case 61:
+        dst_p->choice = per_c_source_q_choice_c062_e;
+        dst_p->value.c062 = decoder_read_bool(decoder_p);
+        break;
+
+    case 62:
+        dst_p->choice = per_c_source_q_choice_c063_e;
+        dst_p->value.c063 = decoder_read_bool(decoder_p);
+        break;
+
+    case 63:
+        dst_p->choice = per_c_source_q_choice_c064_e;
+        dst_p->value.c064 = decoder_read_bool(decoder_p);
+        break;
+
+    case 64:
+        dst_p->choice = per_c_source_q_choice_c065_e;
+        dst_p->value.c065 = decoder_read_bool(decoder_p);
+        break;
+
+    case 65:
+        dst_p->choice = per_c_source_q_choice_c066_e;
+        dst_p->value.c066 = decoder_read_bool(decoder_p);
+        break;
+
+    case 66:
+        dst_p->choice = per_c_source_q_choice_c067_e;
+        dst_p->value.c067 = decoder_read_bool(decoder_p);
+        break;
+
+    case 67:
+        dst_p->choice = per_c_source_q_choice_c068_e;
+        dst_p->value.c068 = decoder_read_bool(decoder_p);
+        break;
+
+    case 68:
+        dst_p->choice = per_c_source_q_choice_c069_e;
+        dst_p->value.c069 = decoder_read_bool(decoder_p);
+        break;
+
+    case 69:
+        dst_p->choice = per_c_source_q_choice_c070_e;
+        dst_p->value.c070 = decoder_read_bool(decoder_p);
+        break;
+
+    case 70:
+        dst_p->choice = per_c_source_q_choice_c071_e;
+        dst_p->value.c071 = decoder_read_bool(decoder_p);
+        break;
+
+    case 71:
+        dst_p->choice = per_c_source_q_choice_c072_e;
+        dst_p->value.c072 = decoder_read_bool(decoder_p);
+        break;
+
+    case 72:
+        dst_p->choice = per_c_source_q_choice_c073_e;
+        dst_p->value.c073 = decoder_read_bool(decoder_p);
+        break;
+
+    case 73:
+        dst_p->choice = per_c_source_q_choice_c074_e;
+        dst_p->value.c074 = decoder_read_bool(decoder_p);
+        break;
+
+    case 74:
+        dst_p->choice = per_c_source_q_choice_c075_e;
+        dst_p->value.c075 = decoder_read_bool(decoder_p);
+        break;
+
+    case 75:
+        dst_p->choice = per_c_source_q_choice_c076_e;
+        dst_p->value.c076 = decoder_read_bool(decoder_p);
+        break;
+
+    case 76:
+        dst_p->choice = per_c_source_q_choice_c077_e;
+        dst_p->value.c077 = decoder_read_bool(decoder_p);
+        break;
+
+    case 77:
+        dst_p->choice = per_c_source_q_choice_c078_e;
+        dst_p->value.c078 = decoder_read_bool(decoder_p);
+        break;
+
+    case 78:
+        dst_p->choice = per_c_source_q_choice_c079_e;
+        dst_p->value.c079 = decoder_read_bool(decoder_p);
+        break;
+
+    case 79:
+        dst_p->choice = per_c_source_q_choice_c080_e;
+        dst_p->value.c080 = decoder_read_bool(decoder_p);
+        break;
+
+    case 80:
+        dst_p->choice = per_c_source_q_choice_c081_e;
+        dst_p->value.c081 = decoder_read_bool(decoder_p);
+        break;
+
+    case 81:
+        dst_p->choice = per_c_source_q_choice_c082_e;
+        dst_p->value.c082 = decoder_read_bool(decoder_p);
+        break;
+
+    case 82:
+        dst_p->choice = per_c_source_q_choice_c083_e;
+        dst_p->value.c083 = decoder_read_bool(decoder_p);
+        break;
+
+    case 83:
+        dst_p->choice = per_c_source_q_choice_c084_e;
+        dst_p->value.c084 = decoder_read_bool(decoder_p);
+        break;
+
+    case 84:
+        dst_p->choice = per_c_source_q_choice_c085_e;
+        dst_p->value.c085 = decoder_read_bool(decoder_p);
+        break;
+
+    case 85:
+        dst_p->choice = per_c_source_q_choice_c086_e;
+        dst_p->value.c086 = decoder_read_bool(decoder_p);
+        break;
+
+    case 86:
+        dst_p->choice = per_c_source_q_choice_c087_e;
+        dst_p->value.c087 = decoder_read_bool(decoder_p);
+        break;
+
+    case 87:
+        dst_p->choice = per_c_source_q_choice_c088_e;
+        dst_p->value.c088 = decoder_read_bool(decoder_p);
+        break;
+
+    case 88:
+        dst_p->choice = per_c_source_q_choice_c089_e;
+        dst_p->value.c089 = decoder_read_bool(decoder_p);
+        break;
+
+    case 89:
+        dst_p->choice = per_c_source_q_choice_c090_e;
+        dst_p->value.c090 = decoder_read_bool(decoder_p);
+        break;
+
+    case 90:
+        dst_p->choice = per_c_source_q_choice_c091_e;
+        dst_p->value.c091 = decoder_read_bool(decoder_p);
+        break;
+
+    case 91:
+        dst_p->choice = per_c_source_q_choice_c092_e;
+        dst_p->value.c092 = decoder_read_bool(decoder_p);
+        break;
+
+    case 92:
+        dst_p->choice = per_c_source_q_choice_c093_e;
+        dst_p->value.c093 = decoder_read_bool(decoder_p);
+        break;
+
+    case 93:
+        dst_p->choice = per_c_source_q_choice_c094_e;
+        dst_p->value.c094 = decoder_read_bool(decoder_p);
+        break;
+
+    case 94:
+        dst_p->choice = per_c_source_q_choice_c095_e;
+        dst_p->value.c095 = decoder_read_bool(decoder_p);
+        break;
+
+    case 95:
+        dst_p->choice = per_c_source_q_choice_c096_e;
+        dst_p->value.c096 = decoder_read_bool(decoder_p);
+        break;
+
+    case 96:
+        dst_p->choice = per_c_source_q_choice_c097_e;
+        dst_p->value.c097 = decoder_read_bool(decoder_p);
+        break;
+
+    case 97:
+        dst_p->choice = per_c_source_q_choice_c098_e;
+        dst_p->value.c098 = decoder_read_bool(decoder_p);
+        break;
+
+    case 98:
+        dst_p->choice = per_c_source_q_choice_c099_e;
+        dst_p->value.c099 = decoder_read_bool(decoder_p);
+        break;
+
+    case 99:
+        dst_p->choice = per_c_source_q_choice_c100_e;
+        dst_p->value.c100 = decoder_read_bool(decoder_p);
+        break;
+
+    case 100:
+        dst_p->choice = per_c_source_q_choice_c101_e;
+        dst_p->value.c101 = decoder_read_bool(decoder_p);
+        break;
+
+    case 101:
+        dst_p->choice = per_c_source_q_choice_c102_e;
+        dst_p->value.c102 = decoder_read_bool(decoder_p);
+        break;
+
+    case 102:
+        dst_p->choice = per_c_source_q_choice_c103_e;
+        dst_p->value.c103 = decoder_read_bool(decoder_p);
+        break;
+
+    case 103:
+        dst_p->choice = per_c_source_q_choice_c104_e;
+        dst_p->value.c104 = decoder_read_bool(decoder_p);
+        break;
+
+    case 104:
+        dst_p->choice = per_c_source_q_choice_c105_e;
+        dst_p->value.c105 = decoder_read_bool(decoder_p);
+        break;
+
+    case 105:
+        dst_p->choice = per_c_source_q_choice_c106_e;
+        dst_p->value.c106 = decoder_read_bool(decoder_p);
+        break;
+
+    case 106:
+        dst_p->choice = per_c_source_q_choice_c107_e;
+        dst_p->value.c107 = decoder_read_bool(decoder_p);
+        break;
+
+    case 107:
+        dst_p->choice = per_c_source_q_choice_c108_e;
+        dst_p->value.c108 = decoder_read_bool(decoder_p);
+        break;
+
+    case 108:
+        dst_p->choice = per_c_source_q_choice_c109_e;
+        dst_p->value.c109 = decoder_read_bool(decoder_p);
+        break;
+
+    case 109:
+        dst_p->choice = per_c_source_q_choice_c110_e;
+        dst_p->value.c110 = decoder_read_bool(decoder_p);
+        break;
+
+    case 110:
+        dst_p->choice = per_c_source_q_choice_c111_e;
+        dst_p->value.c111 = decoder_read_bool(decoder_p);
+        break;
+
+    case 111:
+        dst_p->choice = per_c_source_q_choice_c112_e;
+        dst_p->value.c112 = decoder_read_bool(decoder_p);
+        break;
+
+    case 112:
+        dst_p->choice = per_c_source_q_choice_c113_e;
+        dst_p->value.c113 = decoder_read_bool(decoder_p);
+        break;
+
+    case 113:
+        dst_p->choice = per_c_source_q_choice_c114_e;
+        dst_p->value.c114 = decoder_read_bool(decoder_p);
+        break;
+
+    case 114:
+        dst_p->choice = per_c_source_q_choice_c115_e;
+        dst_p->value.c115 = decoder_read_bool(decoder_p);
+        break;
+
+    case 115:
+        dst_p->choice = per_c_source_q_choice_c116_e;
+        dst_p->value.c116 = decoder_read_bool(decoder_p);
+        break;
+
+    case 116:
+        dst_p->choice = per_c_source_q_choice_c117_e;
+        dst_p->value.c117 = decoder_read_bool(decoder_p);
+        break;
+
+    case 117:
+        dst_p->choice = per_c_source_q_choice_c118_e;
+        dst_p->value.c118 = decoder_read_bool(decoder_p);
+        break;
+
+    case 118:
+        dst_p->choice = per_c_source_q_choice_c119_e;
+        dst_p->value.c119 = decoder_read_bool(decoder_p);
+        break;
+
+    case 119:
+        dst_p->choice = per_c_source_q_choice_c120_e;
+        dst_p->value.c120 = decoder_read_bool(decoder_p);
+        break;
+
+    case 120:
+        dst_p->choice = per_c_source_q_choice_c121_e;
+        dst_p->value.c121 = decoder_read_bool(decoder_p);
+        break;
+
+    case 121:
+        dst_p->choice = per_c_source_q_choice_c122_e;
+        dst_p->value.c122 = decoder_read_bool(decoder_p);
+        break;
+
+    case 122:
+        dst_p->choice = per_c_source_q_choice_c123_e;
+        dst_p->value.c123 = decoder_read_bool(decoder_p);
+        break;
+
+    case 123:
+        dst_p->choice = per_c_source_q_choice_c124_e;
+        dst_p->value.c124 = decoder_read_bool(decoder_p);
+        break;
+
+    case 124:
+        dst_p->choice = per_c_source_q_choice_c125_e;
+        dst_p->value.c125 = decoder_read_bool(decoder_p);
+        break;
+
+    case 125:
+        dst_p->choice = per_c_source_q_choice_c126_e;
+        dst_p->value.c126 = decoder_read_bool(decoder_p);
+        break;
+
+    case 126:
+        dst_p->choice = per_c_source_q_choice_c127_e;
+        dst_p->value.c127 = decoder_read_bool(decoder_p);
+        break;
+
+    case 127:
+        dst_p->choice = per_c_source_q_choice_c128_e;
+        dst_p->value.c128 = decoder_read_bool(decoder_p);
+        break;
+
+    case 128:
+        dst_p->choice = per_c_source_q_choice_c129_e;
+        dst_p->value.c129 = decoder_read_bool(decoder_p);
+        break;
+
+    case 129:
+        dst_p->choice = per_c_source_q_choice_c130_e;
+        dst_p->value.c130 = decoder_read_bool(decoder_p);
+        break;
+
+    case 130:
+        dst_p->choice = per_c_source_q_choice_c131_e;
+        dst_p->value.c131 = decoder_read_bool(decoder_p);
+        break;
+
+    case 131:
+        dst_p->choice = per_c_source_q_choice_c132_e;
+        dst_p->value.c132 = decoder_read_bool(decoder_p);
+        break;
+
+    case 132:
+        dst_p->choice = per_c_source_q_choice_c133_e;
+        dst_p->value.c133 = decoder_read_bool(decoder_p);
+        break;
+
+    case 133:
+        dst_p->choice = per_c_source_q_choice_c134_e;
+        dst_p->value.c134 = decoder_read_bool(decoder_p);
+        break;
+
+    case 134:
+        dst_p->choice = per_c_source_q_choice_c135_e;
+        dst_p->value.c135 = decoder_read_bool(decoder_p);
+        break;
+
+    case 135:
+        dst_p->choice = per_c_source_q_choice_c136_e;
+        dst_p->value.c136 = decoder_read_bool(decoder_p);
+        break;
+
+    case 136:
+        dst_p->choice = per_c_source_q_choice_c137_e;
+        dst_p->value.c137 = decoder_read_bool(decoder_p);
+        break;
+
+    case 137:
+        dst_p->choice = per_c_source_q_choice_c138_e;
+        dst_p->value.c138 = decoder_read_bool(decoder_p);
+        break;
+
+    case 138:
+        dst_p->choice = per_c_source_q_choice_c139_e;
+        dst_p->value.c139 = decoder_read_bool(decoder_p);
+        break;
+
+    case 139:
+        dst_p->choice = per_c_source_q_choice_c140_e;
+        dst_p->value.c140 = decoder_read_bool(decoder_p);
+        break;
+
+    case 140:
+        dst_p->choice = per_c_source_q_choice_c141_e;
+        dst_p->value.c141 = decoder_read_bool(decoder_p);
+        break;
+
+    case 141:
+        dst_p->choice = per_c_source_q_choice_c142_e;
+        dst_p->value.c142 = decoder_read_bool(decoder_p);
+        break;
+
+    case 142:
+        dst_p->choice = per_c_source_q_choice_c143_e;
+        dst_p->value.c143 = decoder_read_bool(decoder_p);
+        break;
+
+    case 143:
+        dst_p->choice = per_c_source_q_choice_c144_e;
+        dst_p->value.c144 = decoder_read_bool(decoder_p);
+        break;
+
+    case 144:
+        dst_p->choice = per_c_source_q_choice_c145_e;
+        dst_p->value.c145 = decoder_read_bool(decoder_p);
+        break;
+
+    case 145:
+        dst_p->choice = per_c_source_q_choice_c146_e;
+        dst_p->value.c146 = decoder_read_bool(decoder_p);
+        break;
+
+    case 146:
+        dst_p->choice = per_c_source_q_choice_c147_e;
+        dst_p->value.c147 = decoder_read_bool(decoder_p);
+        break;
+
+    case 147:
+        dst_p->choice = per_c_source_q_choice_c148_e;
+        dst_p->value.c148 = decoder_read_bool(decoder_p);
+        break;
+
+    case 148:
+        dst_p->choice = per_c_source_q_choice_c149_e;
+        dst_p->value.c149 = decoder_read_bool(decoder_p);
+        break;
+
+    case 149:
+        dst_p->choice = per_c_source_q_choice_c150_e;
+        dst_p->value.c150 = decoder_read_bool(decoder_p);
+        break;
+
+    case 150:
+        dst_p->choice = per_c_source_q_choice_c151_e;
+        dst_p->value.c151 = decoder_read_bool(decoder_p);
+        break;
+
+    case 151:
+        dst_p->choice = per_c_source_q_choice_c152_e;
+        dst_p->value.c152 = decoder_read_bool(decoder_p);
+        break;
+
+    case 152:
+        dst_p->choice = per_c_source_q_choice_c153_e;
+        dst_p->value.c153 = decoder_read_bool(decoder_p);
+        break;
+
+    case 153:
+        dst_p->choice = per_c_source_q_choice_c154_e;
+        dst_p->value.c154 = decoder_read_bool(decoder_p);
+        break;
+
+    case 154:
+        dst_p->choice = per_c_source_q_choice_c155_e;
+        dst_p->value.c155 = decoder_read_bool(decoder_p);
+        break;
+
+    case 155:
+        dst_p->choice = per_c_source_q_choice_c156_e;
+        dst_p->value.c156 = decoder_read_bool(decoder_p);
+        break;
+
+    case 156:
+        dst_p->choice = per_c_source_q_choice_c157_e;
+        dst_p->value.c157 = decoder_read_bool(decoder_p);
+        break;
+
+    case 157:
+        dst_p->choice = per_c_source_q_choice_c158_e;
+        dst_p->value.c158 = decoder_read_bool(decoder_p);
+        break;
+
+    case 158:
+        dst_p->choice = per_c_source_q_choice_c159_e;
+        dst_p->value.c159 = decoder_read_bool(decoder_p);
+        break;
+
+    case 159:
+        dst_p->choice = per_c_source_q_choice_c160_e;
+        dst_p->value.c160 = decoder_read_bool(decoder_p);
+        break;
+
+    case 160:
+        dst_p->choice = per_c_source_q_choice_c161_e;
+        dst_p->value.c161 = decoder_read_bool(decoder_p);
+        break;
+
+    case 161:
+        dst_p->choice = per_c_source_q_choice_c162_e;
+        dst_p->value.c162 = decoder_read_bool(decoder_p);
+        break;
+
+    case 162:
+        dst_p->choice = per_c_source_q_choice_c163_e;
+        dst_p->value.c163 = decoder_read_bool(decoder_p);
+        break;
+
+    case 163:
+        dst_p->choice = per_c_source_q_choice_c164_e;
+        dst_p->value.c164 = decoder_read_bool(decoder_p);
+        break;
+
+    case 164:
+        dst_p->choice = per_c_source_q_choice_c165_e;
+        dst_p->value.c165 = decoder_read_bool(decoder_p);
+        break;
+
+    case 165:
+        dst_p->choice = per_c_source_q_choice_c166_e;
+        dst_p->value.c166 = decoder_read_bool(decoder_p);
+        break;
+
+    case 166:
+        dst_p->choice = per_c_source_q_choice_c167_e;
+        dst_p->value.c167 = decoder_read_bool(decoder_p);
+        break;
+
+    case 167:
+        dst_p->choice = per_c_source_q_choice_c168_e;
+        dst_p->value.c168 = decoder_read_bool(decoder_p);
+        break;
+
+    case 168:
+        dst_p->choice = per_c_source_q_choice_c169_e;
+        dst_p->value.c169 = decoder_read_bool(decoder_p);
+        break;
+
+    case 169:
+        dst_p->choice = per_c_source_q_choice_c170_e;
+        dst_p->value.c170 = decoder_read_bool(decoder_p);
+        break;
+
+    case 170:
+        dst_p->choice = per_c_source_q_choice_c171_e;
+        dst_p->value.c171 = decoder_read_bool(decoder_p);
+        break;
+
+    case 171:
+        dst_p->choice = per_c_source_q_choice_c172_e;
+        dst_p->value.c172 = decoder_read_bool(decoder_p);
+        break;
+
+    case 172:
+        dst_p->choice = per_c_source_q_choice_c173_e;
+        dst_p->value.c173 = decoder_read_bool(decoder_p);
+        break;
+
+    case 173:
+        dst_p->choice = per_c_source_q_choice_c174_e;
+        dst_p->value.c174 = decoder_read_bool(decoder_p);
+        break;
+
+    case 174:
+        dst_p->choice = per_c_source_q_choice_c175_e;
+        dst_p->value.c175 = decoder_read_bool(decoder_p);
+        break;
+
+    case 175:
+        dst_p->choice = per_c_source_q_choice_c176_e;
+        dst_p->value.c176 = decoder_read_bool(decoder_p);
+        break;
+
+    case 176:
+        dst_p->choice = per_c_source_q_choice_c177_e;
+        dst_p->value.c177 = decoder_read_bool(decoder_p);
+        break;
+
+    case 177:
+        dst_p->choice = per_c_source_q_choice_c178_e;
+        dst_p->value.c178 = decoder_read_bool(decoder_p);
+        break;
+
+    case 178:
+        dst_p->choice = per_c_source_q_choice_c179_e;
+        dst_p->value.c179 = decoder_read_bool(decoder_p);
+        break;
+
+    case 179:
+        dst_p->choice = per_c_source_q_choice_c180_e;
+        dst_p->value.c180 = decoder_read_bool(decoder_p);
+        break;
+
+    case 180:
+        dst_p->choice = per_c_source_q_choice_c181_e;
+        dst_p->value.c181 = decoder_read_bool(decoder_p);
+        break;
+
+    case 181:
+        dst_p->choice = per_c_source_q_choice_c182_e;
+        dst_p->value.c182 = decoder_read_bool(decoder_p);
+        break;
+
+    case 182:
+        dst_p->choice = per_c_source_q_choice_c183_e;
+        dst_p->value.c183 = decoder_read_bool(decoder_p);
+        break;
+
+    case 183:
+        dst_p->choice = per_c_source_q_choice_c184_e;
+        dst_p->value.c184 = decoder_read_bool(decoder_p);
+        break;
+
+    case 184:
+        dst_p->choice = per_c_source_q_choice_c185_e;
+        dst_p->value.c185 = decoder_read_bool(decoder_p);
+        break;
+
+    case 185:
+        dst_p->choice = per_c_source_q_choice_c186_e;
+        dst_p->value.c186 = decoder_read_bool(decoder_p);
+        break;
+
+    case 186:
+        dst_p->choice = per_c_source_q_choice_c187_e;
+        dst_p->value.c187 = decoder_read_bool(decoder_p);
+        break;
+
+    case 187:
+        dst_p->choice = per_c_source_q_choice_c188_e;
+        dst_p->value.c188 = decoder_read_bool(decoder_p);
+        break;
+
+    case 188:
+        dst_p->choice = per_c_source_q_choice_c189_e;
+        dst_p->value.c189 = decoder_read_bool(decoder_p);
+        break;
+
+    case 189:
+        dst_p->choice = per_c_source_q_choice_c190_e;
+        dst_p->value.c190 = decoder_read_bool(decoder_p);
+        break;
+
+    case 190:
+        dst_p->choice = per_c_source_q_choice_c191_e;
+        dst_p->value.c191 = decoder_read_bool(decoder_p);
+        break;
+
+    case 191:
+        dst_p->choice = per_c_source_q_choice_c192_e;
+        dst_p->value.c192 = decoder_read_bool(decoder_p);
+        break;
+
+    case 192:
+        dst_p->choice = per_c_source_q_choice_c193_e;
+        dst_p->value.c193 = decoder_read_bool(decoder_p);
+        break;
+
+    case 193:
+        dst_p->choice = per_c_source_q_choice_c194_e;
+        dst_p->value.c194 = decoder_read_bool(decoder_p);
+        break;
+
+    case 194:
+        dst_p->choice = per_c_source_q_choice_c195_e;
+        dst_p->value.c195 = decoder_read_bool(decoder_p);
+        break;
+
+    case 195:
+        dst_p->choice = per_c_source_q_choice_c196_e;
+        dst_p->value.c196 = decoder_read_bool(decoder_p);
+        break;
+
+    case 196:
+        dst_p->choice = per_c_source_q_choice_c197_e;
+        dst_p->value.c197 = decoder_read_bool(decoder_p);
+        break;
+
+    case 197:
+        dst_p->choice = per_c_source_q_choice_c198_e;
+        dst_p->value.c198 = decoder_read_bool(decoder_p);
+        break;
+
+    case 198:
+        dst_p->choice = per_c_source_q_choice_c199_e;
+        dst_p->value.c199 = decoder_read_bool(decoder_p);
+        break;
+
+    case 199:
+        dst_p->choice = per_c_source_q_choice_c200_e;
+        dst_p->value.c200 = decoder_read_bool(decoder_p);
+        break;
+
+    case 200:
+        dst_p->choice = per_c_source_q_choice_c201_e;
+        dst_p->value.c201 = decoder_read_bool(decoder_p);
+        break;
+
+    case 201:
+        dst_p->choice = per_c_source_q_choice_c202_e;
+        dst_p->value.c202 = decoder_read_bool(decoder_p);
+        break;
+
+    case 202:
+        dst_p->choice = per_c_source_q_choice_c203_e;
+        dst_p->value.c203 = decoder_read_bool(decoder_p);
+        break;
+
+    case 203:
+        dst_p->choice = per_c_source_q_choice_c204_e;
+        dst_p->value.c204 = decoder_read_bool(decoder_p);
+        break;
+
+    case 204:
+        dst_p->choice = per_c_source_q_choice_c205_e;
+        dst_p->value.c205 = decoder_read_bool(decoder_p);
+        break;
+
+    case 205:
+        dst_p->choice = per_c_source_q_choice_c206_e;
+        dst_p->value.c206 = decoder_read_bool(decoder_p);
+        break;
+
+    case 206:
+        dst_p->choice = per_c_source_q_choice_c207_e;
+        dst_p->value.c207 = decoder_read_bool(decoder_p);
+        break;
+
+    case 207:
+        dst_p->choice = per_c_source_q_choice_c208_e;
+        dst_p->value.c208 = decoder_read_bool(decoder_p);
+        break;
+
+    case 208:
+        dst_p->choice = per_c_source_q_choice_c209_e;
+        dst_p->value.c209 = decoder_read_bool(decoder_p);
+        break;
+
+    case 209:
+        dst_p->choice = per_c_source_q_choice_c210_e;
+        dst_p->value.c210 = decoder_read_bool(decoder_p);
+        break;
+
+    case 210:
+        dst_p->choice = per_c_source_q_choice_c211_e;
+        dst_p->value.c211 = decoder_read_bool(decoder_p);
+        break;
+
+    case 211:
+        dst_p->choice = per_c_source_q_choice_c212_e;
+        dst_p->value.c212 = decoder_read_bool(decoder_p);
+        break;
+
+    case 212:
+        dst_p->choice = per_c_source_q_choice_c213_e;
+        dst_p->value.c213 = decoder_read_bool(decoder_p);
+        break;
+
+    case 213:
+        dst_p->choice = per_c_source_q_choice_c214_e;
+        dst_p->value.c214 = decoder_read_bool(decoder_p);
+        break;
+
+    case 214:
+        dst_p->choice = per_c_source_q_choice_c215_e;
+        dst_p->value.c215 = decoder_read_bool(decoder_p);
+        break;
+
+    case 215:
+        dst_p->choice = per_c_source_q_choice_c216_e;
+        dst_p->value.c216 = decoder_read_bool(decoder_p);
+        break;
+
+    case 216:
+        dst_p->choice = per_c_source_q_choice_c217_e;
+        dst_p->value.c217 = decoder_read_bool(decoder_p);
+        break;
+
+    case 217:
+        dst_p->choice = per_c_source_q_choice_c218_e;
+        dst_p->value.c218 = decoder_read_bool(decoder_p);
+        break;
+
+    case 218:
+        dst_p->choice = per_c_source_q_choice_c219_e;
+        dst_p->value.c219 = decoder_read_bool(decoder_p);
+        break;
+
+    case 219:
+        dst_p->choice = per_c_source_q_choice_c220_e;
+        dst_p->value.c220 = decoder_read_bool(decoder_p);
+        break;
+
+    case 220:
+        dst_p->choice = per_c_source_q_choice_c221_e;
+        dst_p->value.c221 = decoder_read_bool(decoder_p);
+        break;
+
+    case 221:
+        dst_p->choice = per_c_source_q_choice_c222_e;
+        dst_p->value.c222 = decoder_read_bool(decoder_p);
+        break;
+
+    case 222:
+        dst_p->choice = per_c_source_q_choice_c223_e;
+        dst_p->value.c223 = decoder_read_bool(decoder_p);
+        break;
+
+    case 223:
+        dst_p->choice = per_c_source_q_choice_c224_e;
+        dst_p->value.c224 = decoder_read_bool(decoder_p);
+        break;
+
+    case 224:
+        dst_p->choice = per_c_source_q_choice_c225_e;
+        dst_p->value.c225 = decoder_read_bool(decoder_p);
+        break;
+
+    case 225:
+        dst_p->choice = per_c_source_q_choice_c226_e;
+        dst_p->value.c226 = decoder_read_bool(decoder_p);
+        break;
+
+    case 226:
+        dst_p->choice = per_c_source_q_choice_c227_e;
+        dst_p->value.c227 = decoder_read_bool(decoder_p);
+        break;
+
+    case 227:
+        dst_p->choice = per_c_source_q_choice_c228_e;
+        dst_p->value.c228 = decoder_read_bool(decoder_p);
+        break;
+
+    case 228:
+        dst_p->choice = per_c_source_q_choice_c229_e;
+        dst_p->value.c229 = decoder_read_bool(decoder_p);
+        break;
+
+    case 229:
+        dst_p->choice = per_c_source_q_choice_c230_e;
+        dst_p->value.c230 = decoder_read_bool(decoder_p);
+        break;
+
+    case 230:
+        dst_p->choice = per_c_source_q_choice_c231_e;
+        dst_p->value.c231 = decoder_read_bool(decoder_p);
+        break;
+
+    case 231:
+        dst_p->choice = per_c_source_q_choice_c232_e;
+        dst_p->value.c232 = decoder_read_bool(decoder_p);
+        break;
+
+    case 232:
+        dst_p->choice = per_c_source_q_choice_c233_e;
+        dst_p->value.c233 = decoder_read_bool(decoder_p);
+        break;
+
+    case 233:
+        dst_p->choice = per_c_source_q_choice_c234_e;
+        dst_p->value.c234 = decoder_read_bool(decoder_p);
+        break;
+
+    case 234:
+        dst_p->choice = per_c_source_q_choice_c235_e;
+        dst_p->value.c235 = decoder_read_bool(decoder_p);
+        break;
+
+    case 235:
+        dst_p->choice = per_c_source_q_choice_c236_e;
+        dst_p->value.c236 = decoder_read_bool(decoder_p);
+        break;
+
+    case 236:
+        dst_p->choice = per_c_source_q_choice_c237_e;
+        dst_p->value.c237 = decoder_read_bool(decoder_p);
+        break;
+
+    case 237:
+        dst_p->choice = per_c_source_q_choice_c238_e;
+        dst_p->value.c238 = decoder_read_bool(decoder_p);
+        break;
+
+    case 238:
+        dst_p->choice = per_c_source_q_choice_c239_e;
+        dst_p->value.c239 = decoder_read_bool(decoder_p);
+        break;
+
+    case 239:
+        dst_p->choice = per_c_source_q_choice_c240_e;
+        dst_p->value.c240 = decoder_read_bool(decoder_p);
+        break;
+
+    case 240:
+        dst_p->choice = per_c_source_q_choice_c241_e;
+        dst_p->value.c241 = decoder_read_bool(decoder_p);
+        break;
+
+    case 241:
+        dst_p->choice = per_c_source_q_choice_c242_e;
+        dst_p->value.c242 = decoder_read_bool(decoder_p);
+        break;
+
+    case 242:
+        dst_p->choice = per_c_source_q_choice_c243_e;
+        dst_p->value.c243 = decoder_read_bool(decoder_p);
+        break;
+
+    case 243:
+        dst_p->choice = per_c_source_q_choice_c244_e;
+        dst_p->value.c244 = decoder_read_bool(decoder_p);
+        break;
+
+    case 244:
+        dst_p->choice = per_c_source_q_choice_c245_e;
+        dst_p->value.c245 = decoder_read_bool(decoder_p);
+        break;
+
+    case 245:
+        dst_p->choice = per_c_source_q_choice_c246_e;
+        dst_p->value.c246 = decoder_read_bool(decoder_p);
+        break;
+
+    case 246:
+        dst_p->choice = per_c_source_q_choice_c247_e;
+        dst_p->value.c247 = decoder_read_bool(decoder_p);
+        break;
+
+    case 247:
+        dst_p->choice = per_c_source_q_choice_c248_e;
+        dst_p->value.c248 = decoder_read_bool(decoder_p);
+        break;
+
+    case 248:
+        dst_p->choice = per_c_source_q_choice_c249_e;
+        dst_p->value.c249 = decoder_read_bool(decoder_p);
+        break;
+
+    case 249:
+        dst_p->choice = per_c_source_q_choice_c250_e;
+        dst_p->value.c250 = decoder_read_bool(decoder_p);
+        break;
+
+    case 250:
+        dst_p->choice = per_c_source_q_choice_c251_e;
+        dst_p->value.c251 = decoder_read_bool(decoder_p);
+        break;
+
+    case 251:
+        dst_p->choice = per_c_source_q_choice_c252_e;
+        dst_p->value.c252 = decoder_read_bool(decoder_p);
+        break;
+
+    case 252:
+        dst_p->choice = per_c_source_q_choice_c253_e;
+        dst_p->value.c253 = decoder_read_bool(decoder_p);
+        break;
+
+    case 253:
+        dst_p->choice = per_c_source_q_choice_c254_e;
+        dst_p->value.c254 = decoder_read_bool(decoder_p);
+        break;
+
+    case 254:
+        dst_p->choice = per_c_source_q_choice_c255_e;
+        dst_p->value.c255 = decoder_read_bool(decoder_p);
+        break;
+
+    case 255:
+        dst_p->choice = per_c_source_q_choice_c256_e;
+        dst_p->value.c256 = decoder_read_bool(decoder_p);
+        break;
+
+    case 256:
+        dst_p->choice = per_c_source_q_choice_c257_e;
+        dst_p->value.c257 = decoder_read_bool(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_q_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint16_t choice;
+
+    decoder_align(decoder_p);
+    choice = (uint16_t)decoder_read_non_negative_binary_integer(decoder_p, 16);
+
+    switch (choice) {
+
+    case 0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 2:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 3:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 4:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 5:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 6:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 7:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 8:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 9:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 10:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 11:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 12:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 13:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 14:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 15:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 16:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 17:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 18:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 19:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 20:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 21:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 22:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 23:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 24:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 25:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 26:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 27:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 28:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 29:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 30:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 31:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 32:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 33:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 34:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 35:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 36:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 37:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 38:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 39:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 40:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 41:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 42:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 43:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 44:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 45:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 46:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 47:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 48:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 49:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 50:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 51:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 52:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 53:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 54:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 55:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 56:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 57:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 58:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 59:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 60:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 61:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 62:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 63:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 64:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 65:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 66:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 67:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 68:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 69:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 70:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 71:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 72:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 73:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 74:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 75:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 76:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 77:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 78:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 79:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 80:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 81:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 82:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 83:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 84:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 85:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 86:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 87:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 88:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 89:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 90:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 91:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 92:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 93:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 94:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 95:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 96:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 97:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 98:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 99:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 100:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 101:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 102:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 103:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 104:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 105:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 106:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 107:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 108:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 109:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 110:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 111:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 112:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 113:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 114:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 115:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 116:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 117:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 118:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 119:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 120:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 121:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 122:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 123:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 124:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 125:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 126:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 127:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 128:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 129:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 130:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 131:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 132:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 133:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 134:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 135:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 136:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 137:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 138:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 139:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 140:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 141:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 142:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 143:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 144:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 145:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 146:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 147:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 148:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 149:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 150:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 151:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 152:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 153:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 154:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 155:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 156:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 157:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 158:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 159:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 160:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 161:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 162:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 163:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 164:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 165:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 166:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 167:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 168:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 169:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 170:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 171:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 172:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 173:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 174:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 175:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 176:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 177:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 178:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 179:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 180:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 181:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 182:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 183:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 184:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 185:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 186:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 187:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 188:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 189:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 190:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 191:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 192:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 193:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 194:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 195:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 196:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 197:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 198:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 199:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 200:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 201:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 202:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 203:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 204:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 205:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 206:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 207:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 208:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 209:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 210:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 211:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 212:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 213:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 214:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 215:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 216:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 217:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 218:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 219:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 220:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 221:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 222:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 223:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 224:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 225:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 226:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 227:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 228:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 229:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 230:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 231:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 232:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 233:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 234:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 235:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 236:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 237:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 238:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 239:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 240:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 241:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 242:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 243:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 244:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 245:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 246:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 247:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 248:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 249:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 250:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 251:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 252:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 253:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 254:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 255:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 256:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_d_t *src_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+    uint16_t value;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 1u,
+        4);
+
+    for (i = 0; i < src_p->length; i++) {
+        switch (src_p->elements[i].a.b.choice) {
+
+        case per_c_source_d_a_b_choice_c_e:
+            encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+            encoder_append_non_negative_binary_integer(
+                encoder_p,
+                (uint64_t)(src_p->elements[i].a.b.value.c - 0),
+                1);
+            break;
+
+        case per_c_source_d_a_b_choice_d_e:
+            encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+            encoder_append_bool(encoder_p, src_p->elements[i].a.b.value.d);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->elements[i].a.e.length - 3u,
+            1);
+
+        for (i_2 = 0; i_2 < src_p->elements[i].a.e.length; i_2++) {
+        }
+
+        encoder_append_bool(encoder_p, src_p->elements[i].g.h != per_c_source_d_g_h_j_e);
+
+        if (src_p->elements[i].g.h != per_c_source_d_g_h_j_e) {
+            switch (src_p->elements[i].g.h) {
+            case per_c_source_d_g_h_i_e:
+                value = 0;
+                break;
+            case per_c_source_d_g_h_j_e:
+                value = 1;
+                break;
+            case per_c_source_d_g_h_k_e:
+                value = 2;
+                break;
+            default:
+                encoder_abort(encoder_p, EBADENUM);
+                return;
+            }
+            encoder_append_non_negative_binary_integer(encoder_p, value, 2);
+        }
+
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->elements[i].g.l.length - 1u,
+            1);
+        encoder_align(encoder_p);
+        encoder_append_bytes(encoder_p,
+                             &src_p->elements[i].g.l.buf[0],
+                             src_p->elements[i].g.l.length);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.is_n_present);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.o != 3);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.is_p_present);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.s != false);
+
+        if (src_p->elements[i].m.is_n_present) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.n);
+        }
+
+        if (src_p->elements[i].m.o != 3) {
+            encoder_append_non_negative_binary_integer(
+                encoder_p,
+                (uint64_t)(src_p->elements[i].m.o - -2),
+                3);
+        }
+
+        if (src_p->elements[i].m.is_p_present) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.p.is_r_present);
+            encoder_align(encoder_p);
+            encoder_append_bytes(encoder_p,
+                                 &src_p->elements[i].m.p.q.buf[0],
+                                 5);
+
+            if (src_p->elements[i].m.p.is_r_present) {
+                encoder_append_bool(encoder_p, src_p->elements[i].m.p.r);
+            }
+        }
+
+        if (src_p->elements[i].m.s != false) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.s);
+        }
+    }
+}
+
+static void per_c_source_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_d_t *dst_p)
+{
+    uint8_t i;
+    uint8_t choice;
+    uint8_t i_2;
+    bool is_present;
+    uint16_t value;
+    bool is_present_2;
+    bool is_present_3;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->length += 1u;
+
+    if (dst_p->length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice) {
+
+        case 0:
+            dst_p->elements[i].a.b.choice = per_c_source_d_a_b_choice_c_e;
+            dst_p->elements[i].a.b.value.c = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                1);
+            dst_p->elements[i].a.b.value.c += 0;
+            break;
+
+        case 1:
+            dst_p->elements[i].a.b.choice = per_c_source_d_a_b_choice_d_e;
+            dst_p->elements[i].a.b.value.d = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        dst_p->elements[i].a.e.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->elements[i].a.e.length += 3u;
+
+        for (i_2 = 0; i_2 < dst_p->elements[i].a.e.length; i_2++) {
+        }
+
+        is_present = decoder_read_bool(decoder_p);
+
+        if (is_present) {
+            value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+            switch (value) {
+            case 0:
+                dst_p->elements[i].g.h = per_c_source_d_g_h_i_e;
+                break;
+            case 1:
+                dst_p->elements[i].g.h = per_c_source_d_g_h_j_e;
+                break;
+            case 2:
+                dst_p->elements[i].g.h = per_c_source_d_g_h_k_e;
+                break;
+            default:
+                decoder_abort(decoder_p, EBADENUM);
+                return;
+            }
+        } else {
+            dst_p->elements[i].g.h = per_c_source_d_g_h_j_e;
+        }
+
+        dst_p->elements[i].g.l.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->elements[i].g.l.length += 1u;
+
+        decoder_align(decoder_p);
+        decoder_read_bytes(decoder_p,
+                           &dst_p->elements[i].g.l.buf[0],
+                           dst_p->elements[i].g.l.length);
+        dst_p->elements[i].m.is_n_present = decoder_read_bool(decoder_p);
+        is_present_2 = decoder_read_bool(decoder_p);
+        dst_p->elements[i].m.is_p_present = decoder_read_bool(decoder_p);
+        is_present_3 = decoder_read_bool(decoder_p);
+
+        if (dst_p->elements[i].m.is_n_present) {
+            dst_p->elements[i].m.n = decoder_read_bool(decoder_p);
+        }
+
+        if (is_present_2) {
+            dst_p->elements[i].m.o = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                3);
+            dst_p->elements[i].m.o += -2;
+        } else {
+            dst_p->elements[i].m.o = 3;
+        }
+
+        if (dst_p->elements[i].m.is_p_present) {
+            dst_p->elements[i].m.p.is_r_present = decoder_read_bool(decoder_p);
+            decoder_align(decoder_p);
+            decoder_read_bytes(decoder_p,
+                               &dst_p->elements[i].m.p.q.buf[0],
+                               5);
+
+            if (dst_p->elements[i].m.p.is_r_present) {
+                dst_p->elements[i].m.p.r = decoder_read_bool(decoder_p);
+            }
+        }
+
+        if (is_present_3) {
+            dst_p->elements[i].m.s = decoder_read_bool(decoder_p);
+        } else {
+            dst_p->elements[i].m.s = false;
+        }
+    }
+}
+
+static void per_c_source_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+    uint8_t choice;
+    uint32_t length_2;
+    bool is_present;
+    uint16_t value;
+    uint32_t length_3;
+    bool is_present_2;
+    bool is_present_3;
+    bool is_present_4;
+    bool is_present_5;
+    bool is_present_6;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length += 1u;
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice) {
+
+        case 0:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        case 1:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        length_2 += 3u;
+
+        is_present = decoder_read_bool(decoder_p);
+        if (is_present) {
+            value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+            if (value > 2u) {
+                decoder_abort(decoder_p, EBADENUM);
+            }
+        }
+        length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        length_3 += 1u;
+
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u * length_3);
+        is_present_2 = decoder_read_bool(decoder_p);
+        is_present_3 = decoder_read_bool(decoder_p);
+        is_present_4 = decoder_read_bool(decoder_p);
+        is_present_5 = decoder_read_bool(decoder_p);
+        if (is_present_2) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+        if (is_present_3) {
+            (void)decoder_free(decoder_p, 3u);
+        }
+        if (is_present_4) {
+            is_present_6 = decoder_read_bool(decoder_p);
+            decoder_align(decoder_p);
+            (void)decoder_free(decoder_p, 40u);
+            if (is_present_6) {
+                (void)decoder_free(decoder_p, 1u);
+            }
+        }
+        if (is_present_5) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+}
+
+static void per_c_source_ac_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ac_t *src_p)
+{
+    per_c_source_q_encode_inner(encoder_p, &src_p->a);
+    per_c_source_d_encode_inner(encoder_p, &src_p->b);
+}
+
+static void per_c_source_ac_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ac_t *dst_p)
+{
+    per_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    per_c_source_d_decode_inner(decoder_p, &dst_p->b);
+}
+
+static void per_c_source_ac_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ac_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_AC_FIELD_A) != 0u) {
+        per_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        per_c_source_q_skip_inner(decoder_p);
+    }
+    if ((fields & PER_C_SOURCE_AC_FIELD_B) != 0u) {
+        per_c_source_d_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        per_c_source_d_skip_inner(decoder_p);
+    }
+}
+
+static void per_c_source_ac_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    per_c_source_q_skip_inner(decoder_p);
+    per_c_source_d_skip_inner(decoder_p);
+}
+
+static void per_c_source_ad_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ad_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->value;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 1);
+}
+
+static void per_c_source_ad_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ad_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 1);
+    dst_p->value = (enum per_c_source_ad_e)value;
+}
+
+static void per_c_source_ad_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_source_ae_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ae_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->is_a_present,
+                           2);
+    }
+
+    encoder_append_bool(encoder_p, src_p->b != true);
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->b != true) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    encoder_append_bool(encoder_p, src_p->c);
+}
+
+static void per_c_source_ae_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ae_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+    bool is_present;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits & 0x1u) != 0u);
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (is_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    } else {
+        dst_p->b = true;
+    }
+
+    dst_p->c = decoder_read_bool(decoder_p);
+}
+
+static void per_c_source_ae_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ae_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t pos;
+    uint64_t bits;
+    bool is_present;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits & 0x1u) != 0u);
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_present) {
+        if ((fields & PER_C_SOURCE_AE_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (is_present) {
+        if ((fields & PER_C_SOURCE_AE_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->b = true;
+    }
+
+    if ((fields & PER_C_SOURCE_AE_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void per_c_source_ae_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    (void)decoder_free(decoder_p, 1u);
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_source_ah_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ah_t *src_p)
+{
+    if(src_p->is_d_addition_present || src_p->is_e_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->c,
+                           2);
+    }
+}
+
+static void per_c_source_ah_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ah_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->c = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void per_c_source_ah_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ah_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_C_SOURCE_AH_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void per_c_source_ah_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_source_af_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_af_t *src_p)
+{
+    if(src_p->is_b_addition_present || src_p->is_e_addition_present || src_p->is_f_addition_present ||
+       src_p->is_g_addition_present || src_p->is_h_addition_present || src_p->is_i_addition_present ||
+       src_p->is_j_addition_present || src_p->is_k_addition_present || src_p->is_l_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->a,
+                           2);
+    }
+}
+
+static void per_c_source_af_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_af_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void per_c_source_af_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_af_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_C_SOURCE_AF_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void per_c_source_af_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_source_ag_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ag_t *src_p)
+{
+    if(src_p->is_b_addition_present || src_p->is_c_addition_present || src_p->is_d_addition_present ||
+       src_p->is_h_addition_present || src_p->is_i_addition_present || src_p->is_j_addition_present ||
+       src_p->is_m_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->a,
+                           2);
+    }
+}
+
+static void per_c_source_ag_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ag_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void per_c_source_ag_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ag_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_C_SOURCE_AG_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void per_c_source_ag_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_source_aj_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_aj_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->a;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 1);
+}
+
+static void per_c_source_aj_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_aj_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 1);
+    dst_p->a = (enum per_c_source_aj_a_e)value;
+}
+
+static void per_c_source_aj_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_aj_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t value;
+
+    if ((fields & PER_C_SOURCE_AJ_FIELD_A) != 0u) {
+        value = decoder_read_non_negative_binary_integer(decoder_p, 1);
+        dst_p->a = (enum per_c_source_aj_a_e)value;
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void per_c_source_aj_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_source_ak_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ak_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_c_source_ak_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+        per_c_source_aj_encode_inner(encoder_p, &src_p->value.a);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_ak_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ak_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = per_c_source_ak_choice_a_e;
+        per_c_source_aj_decode_inner(decoder_p, &dst_p->value.a);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_ak_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_ai_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ai_t *src_p)
+{
+    per_c_source_ak_encode_inner(encoder_p, &src_p->a);
+}
+
+static void per_c_source_ai_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ai_t *dst_p)
+{
+    per_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+}
+
+static void per_c_source_ai_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ai_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_AI_FIELD_A) != 0u) {
+        per_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        per_c_source_ak_skip_inner(decoder_p);
+    }
+}
+
+static void per_c_source_ai_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    per_c_source_ak_skip_inner(decoder_p);
+}
+
+static void per_c_source_al_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_al_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -129),
+        16);
+}
+
+static void per_c_source_al_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_al_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->value += -129;
+}
+
+static void per_c_source_al_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+}
+
+static void per_c_source_am_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_am_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -2),
+        8);
+}
+
+static void per_c_source_am_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_am_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    dst_p->value += -2;
+}
+
+static void per_c_source_am_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void per_c_source_an_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_an_t *src_p)
+{
+    uint32_t value;
+
+    switch (src_p->value) {
+    case per_c_source_an_a_e:
+        value = 0;
+        break;
+    case per_c_source_an_b_e:
+        value = 1;
+        break;
+    case per_c_source_an_c_e:
+        value = 2;
+        break;
+    case per_c_source_an_d_e:
+        value = 3;
+        break;
+    case per_c_source_an_e_e:
+        value = 4;
+        break;
+    case per_c_source_an_f_e:
+        value = 5;
+        break;
+    case per_c_source_an_g_e:
+        value = 6;
+        break;
+    case per_c_source_an_h_e:
+        value = 7;
+        break;
+    case per_c_source_an_i_e:
+        value = 8;
+        break;
+    case per_c_source_an_j_e:
+        value = 9;
+        break;
+    case per_c_source_an_k_e:
+        value = 10;
+        break;
+    default:
+        encoder_abort(encoder_p, EBADENUM);
+        return;
+    }
+    encoder_append_non_negative_binary_integer(encoder_p, value, 4);
+}
+
+static void per_c_source_an_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_an_t *dst_p)
+{
+    uint32_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 4);
+    switch (value) {
+    case 0:
+        dst_p->value = per_c_source_an_a_e;
+        break;
+    case 1:
+        dst_p->value = per_c_source_an_b_e;
+        break;
+    case 2:
+        dst_p->value = per_c_source_an_c_e;
+        break;
+    case 3:
+        dst_p->value = per_c_source_an_d_e;
+        break;
+    case 4:
+        dst_p->value = per_c_source_an_e_e;
+        break;
+    case 5:
+        dst_p->value = per_c_source_an_f_e;
+        break;
+    case 6:
+        dst_p->value = per_c_source_an_g_e;
+        break;
+    case 7:
+        dst_p->value = per_c_source_an_h_e;
+        break;
+    case 8:
+        dst_p->value = per_c_source_an_i_e;
+        break;
+    case 9:
+        dst_p->value = per_c_source_an_j_e;
+        break;
+    case 10:
+        dst_p->value = per_c_source_an_k_e;
+        break;
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        return;
+    }
+}
+
+static void per_c_source_an_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 4);
+
+    if (value > 10u) {
+        decoder_abort(decoder_p, EBADENUM);
+    }
+}
+
+static void per_c_source_ao_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ao_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->a),
+        8);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->b),
+        24);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->c),
+        4);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->d),
+        32);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->e),
+        64);
+}
+
+static void per_c_source_ao_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ao_t *dst_p)
+{
+    dst_p->a = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    decoder_align(decoder_p);
+    dst_p->b = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        24);
+    dst_p->c = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    decoder_align(decoder_p);
+    dst_p->d = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        32);
+    decoder_align(decoder_p);
+    dst_p->e = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        64);
+}
+
+static void per_c_source_ao_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ao_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_AO_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            8);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & PER_C_SOURCE_AO_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->b = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            24);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 24u);
+    }
+    if ((fields & PER_C_SOURCE_AO_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & PER_C_SOURCE_AO_FIELD_D) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->d = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            32);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 32u);
+    }
+    if ((fields & PER_C_SOURCE_AO_FIELD_E) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->e = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            64);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 64u);
+    }
+}
+
+static void per_c_source_ao_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 24u);
+    (void)decoder_free(decoder_p, 4u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 32u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 64u);
+}
+
+static void per_c_ref_referenced_sequence_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_ref_referenced_sequence_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->a - 0),
+        7);
+}
+
+static void per_c_ref_referenced_sequence_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_ref_referenced_sequence_t *dst_p)
+{
+    dst_p->a = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    dst_p->a += 0;
+}
+
+static void per_c_ref_referenced_sequence_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_ref_referenced_sequence_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_REF_REFERENCED_SEQUENCE_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        dst_p->a += 0;
+    } else {
+        (void)decoder_free(decoder_p, 7u);
+    }
+}
+
+static void per_c_ref_referenced_sequence_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 7u);
+}
+
+static void per_c_ref_referenced_enum_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_ref_referenced_enum_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->value;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 2);
+}
+
+static void per_c_ref_referenced_enum_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_ref_referenced_enum_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    if (value > 2u) {
+        decoder_abort(decoder_p, EBADENUM);
+
+        return;
+    }
+
+    dst_p->value = (enum per_c_ref_referenced_enum_e)value;
+}
+
+static void per_c_ref_referenced_enum_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    if (value > 2u) {
+        decoder_abort(decoder_p, EBADENUM);
+    }
+}
+
+static void per_c_source_ap_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ap_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->c.value != per_c_ref_referenced_enum_a_e);
+    encoder_append_bool(encoder_p, src_p->d != 1);
+    per_c_ref_referenced_sequence_encode_inner(encoder_p, &src_p->b);
+
+    if (src_p->c.value != per_c_ref_referenced_enum_a_e) {
+        per_c_ref_referenced_enum_encode_inner(encoder_p, &src_p->c);
+    }
+
+    if (src_p->d != 1) {
+        encoder_align(encoder_p);
+        encoder_append_uint8(encoder_p, src_p->d);
+    }
+}
+
+static void per_c_source_ap_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ap_t *dst_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    per_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+
+    if (is_present) {
+        per_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        dst_p->c.value = per_c_ref_referenced_enum_a_e;
+    }
+
+    if (is_present_2) {
+        decoder_align(decoder_p);
+        dst_p->d = decoder_read_uint8(decoder_p);
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void per_c_source_ap_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ap_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    bool is_present_2;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if ((fields & PER_C_SOURCE_AP_FIELD_B) != 0u) {
+        per_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        (void)decoder_free(decoder_p, 7u);
+    }
+
+    if (is_present) {
+        if ((fields & PER_C_SOURCE_AP_FIELD_C) != 0u) {
+            per_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
+        } else {
+            per_c_ref_referenced_enum_skip_inner(decoder_p);
+        }
+    } else {
+        dst_p->c.value = per_c_ref_referenced_enum_a_e;
+    }
+
+    if (is_present_2) {
+        if ((fields & PER_C_SOURCE_AP_FIELD_D) != 0u) {
+            decoder_align(decoder_p);
+            dst_p->d = decoder_read_uint8(decoder_p);
+        } else {
+            decoder_align(decoder_p);
+            (void)decoder_free(decoder_p, 8u);
+        }
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void per_c_source_ap_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    (void)decoder_free(decoder_p, 7u);
+    if (is_present) {
+        per_c_ref_referenced_enum_skip_inner(decoder_p);
+    }
+    if (is_present_2) {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+    }
+}
+
+static void per_c_source_aq_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_aq_t *src_p)
+{
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->value,
+        2);
+}
+
+static void per_c_source_aq_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_aq_t *dst_p)
+{
+    dst_p->value = (uint32_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        2,
+        3));
+}
+
+static void per_c_source_aq_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_read_indefinite_whole_number(decoder_p, 2, 3);
+}
+
+static void per_c_source_ar_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_ar_t *src_p)
+{
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    encoder_append_bool(encoder_p, (memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+                                   (src_p->a.length != sizeof(a_default)));
+
+    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+        (src_p->a.length != sizeof(a_default))) {
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->a.length - 0u,
+            4);
+        encoder_align(encoder_p);
+        encoder_append_bytes(encoder_p,
+                             &src_p->a.buf[0],
+                             src_p->a.length);
+    }
+}
+
+static void per_c_source_ar_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ar_t *dst_p)
+{
+    bool is_present;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (is_present) {
+        dst_p->a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->a.length += 0u;
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void per_c_source_ar_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_ar_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    uint32_t length;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (is_present) {
+        if ((fields & PER_C_SOURCE_AR_FIELD_A) != 0u) {
+            dst_p->a.length = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                4);
+            dst_p->a.length += 0u;
+
+            if (dst_p->a.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_align(decoder_p);
+            decoder_read_bytes(decoder_p,
+                               &dst_p->a.buf[0],
+                               dst_p->a.length);
+        } else {
+            length = (uint32_t)decoder_read_non_negative_binary_integer(
+                decoder_p,
+                4);
+            length += 0u;
+
+            if (length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_align(decoder_p);
+            (void)decoder_free(decoder_p, 8u * length);
+        }
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void per_c_source_ar_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    uint32_t length;
+
+    is_present = decoder_read_bool(decoder_p);
+    if (is_present) {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length += 0u;
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u * length);
+    }
+}
+
+static void per_c_source_as_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_as_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->is_a_a_present);
+    encoder_append_bool(encoder_p, src_p->a_c != true);
+
+    if (src_p->is_a_a_present) {
+        encoder_append_bool(encoder_p, src_p->a_a);
+    }
+
+    switch (src_p->a_b.choice) {
+
+    case per_c_source_as_a_b_choice_b_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+        encoder_append_bool(encoder_p, src_p->a_b.value.b_a);
+        break;
+
+    case per_c_source_as_a_b_choice_b_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+        encoder_append_bool(encoder_p, src_p->a_b.value.b_b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+
+    if (src_p->a_c != true) {
+        encoder_append_bool(encoder_p, src_p->a_c);
+    }
+}
+
+static void per_c_source_as_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_as_t *dst_p)
+{
+    bool is_present;
+    uint8_t choice;
+
+    dst_p->is_a_a_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_a_present) {
+        dst_p->a_a = decoder_read_bool(decoder_p);
+    }
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->a_b.choice = per_c_source_as_a_b_choice_b_a_e;
+        dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
+        break;
+
+    case 1:
+        dst_p->a_b.choice = per_c_source_as_a_b_choice_b_b_e;
+        dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+
+    if (is_present) {
+        dst_p->a_c = decoder_read_bool(decoder_p);
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void per_c_source_as_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_as_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    uint8_t choice;
+    uint8_t choice_2;
+
+    dst_p->is_a_a_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_a_present) {
+        if ((fields & PER_C_SOURCE_AS_FIELD_A_A) != 0u) {
+            dst_p->a_a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & PER_C_SOURCE_AS_FIELD_A_B) != 0u) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice) {
+
+        case 0:
+            dst_p->a_b.choice = per_c_source_as_a_b_choice_b_a_e;
+            dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
+            break;
+
+        case 1:
+            dst_p->a_b.choice = per_c_source_as_a_b_choice_b_b_e;
+            dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    } else {
+        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice_2) {
+
+        case 0:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        case 1:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    }
+
+    if (is_present) {
+        if ((fields & PER_C_SOURCE_AS_FIELD_A_C) != 0u) {
+            dst_p->a_c = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void per_c_source_as_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+    uint8_t choice;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void per_c_ref_at_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_ref_at_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value),
+        2);
+}
+
+static void per_c_ref_at_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_ref_at_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+}
+
+static void per_c_ref_at_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void per_c_source_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_b_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_c_source_b_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 2);
+        encoder_align(encoder_p);
+        encoder_append_int8(encoder_p, src_p->value.a);
+        break;
+
+    case per_c_source_b_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 2);
+        per_c_source_a_encode_inner(encoder_p, &src_p->value.b);
+        break;
+
+    case per_c_source_b_choice_c_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 2, 2);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_b_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = per_c_source_b_choice_a_e;
+        decoder_align(decoder_p);
+        dst_p->value.a = decoder_read_int8(decoder_p);
+        break;
+
+    case 1:
+        dst_p->choice = per_c_source_b_choice_b_e;
+        per_c_source_a_decode_inner(decoder_p, &dst_p->value.b);
+        break;
+
+    case 2:
+        dst_p->choice = per_c_source_b_choice_c_e;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    switch (choice) {
+
+    case 0:
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+        break;
+
+    case 1:
+        per_c_source_a_skip_inner(decoder_p);
+        break;
+
+    case 2:
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_c_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        2);
+
+    for (i = 0; i < src_p->length; i++) {
+        per_c_source_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void per_c_source_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_c_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        per_c_source_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void per_c_source_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    length += 0u;
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        per_c_source_b_skip_inner(decoder_p);
+    }
+}
+
+static void per_c_source_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_e_t *src_p)
+{
+    switch (src_p->a.choice) {
+
+    case per_c_source_e_a_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+
+        switch (src_p->a.value.b.choice) {
+
+        case per_c_source_e_a_b_choice_c_e:
+            encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+            encoder_append_bool(encoder_p, src_p->a.value.b.value.c);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_e_t *dst_p)
+{
+    uint8_t choice;
+    uint8_t choice_2;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->a.choice = per_c_source_e_a_choice_b_e;
+        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice_2) {
+
+        case 0:
+            dst_p->a.value.b.choice = per_c_source_e_a_b_choice_c_e;
+            dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_e_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t choice;
+    uint8_t choice_2;
+    uint8_t choice_3;
+    uint8_t choice_4;
+
+    if ((fields & PER_C_SOURCE_E_FIELD_A) != 0u) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice) {
+
+        case 0:
+            dst_p->a.choice = per_c_source_e_a_choice_b_e;
+            choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+            switch (choice_2) {
+
+            case 0:
+                dst_p->a.value.b.choice = per_c_source_e_a_b_choice_c_e;
+                dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    } else {
+        choice_3 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice_3) {
+
+        case 0:
+            choice_4 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+            switch (choice_4) {
+
+            case 0:
+                (void)decoder_free(decoder_p, 1u);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    }
+}
+
+static void per_c_source_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+    uint8_t choice_2;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice_2) {
+
+        case 0:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_c_source_f_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_f_t *src_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 1u,
+        1);
+
+    for (i = 0; i < src_p->length; i++) {
+        for (i_2 = 0; i_2 < 1; i_2++) {
+            encoder_append_bool(encoder_p, src_p->elements[i].elements[i_2]);
+        }
+    }
+}
+
+static void per_c_source_f_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_f_t *dst_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->length += 1u;
+
+    for (i = 0; i < dst_p->length; i++) {
+        for (i_2 = 0; i_2 < 1; i_2++) {
+            dst_p->elements[i].elements[i_2] = decoder_read_bool(decoder_p);
+        }
+    }
+}
+
+static void per_c_source_f_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    length += 1u;
+
+    (void)decoder_free(decoder_p, length * 1u);
+}
+
+static void per_c_source_g_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_g_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 9) >= 0) {
+        encoder_write_bits(encoder_p,
+                           ((uint64_t)src_p->is_a_present << 8)
+                           | ((uint64_t)src_p->is_b_present << 7)
+                           | ((uint64_t)src_p->is_c_present << 6)
+                           | ((uint64_t)src_p->is_d_present << 5)
+                           | ((uint64_t)src_p->is_e_present << 4)
+                           | ((uint64_t)src_p->is_f_present << 3)
+                           | ((uint64_t)src_p->is_g_present << 2)
+                           | ((uint64_t)src_p->is_h_present << 1)
+                           | (uint64_t)src_p->is_i_present,
+                           9);
+    }
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->is_b_present) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    if (src_p->is_c_present) {
+        encoder_append_bool(encoder_p, src_p->c);
+    }
+
+    if (src_p->is_d_present) {
+        encoder_append_bool(encoder_p, src_p->d);
+    }
+
+    if (src_p->is_e_present) {
+        encoder_append_bool(encoder_p, src_p->e);
+    }
+
+    if (src_p->is_f_present) {
+        encoder_append_bool(encoder_p, src_p->f);
+    }
+
+    if (src_p->is_g_present) {
+        encoder_append_bool(encoder_p, src_p->g);
+    }
+
+    if (src_p->is_h_present) {
+        encoder_append_bool(encoder_p, src_p->h);
+    }
+
+    if (src_p->is_i_present) {
+        encoder_append_bool(encoder_p, src_p->i);
+    }
+}
+
+static void per_c_source_g_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_g_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 9);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 9);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits >> 8) != 0u);
+    dst_p->is_b_present = (((bits >> 7) & 0x1u) != 0u);
+    dst_p->is_c_present = (((bits >> 6) & 0x1u) != 0u);
+    dst_p->is_d_present = (((bits >> 5) & 0x1u) != 0u);
+    dst_p->is_e_present = (((bits >> 4) & 0x1u) != 0u);
+    dst_p->is_f_present = (((bits >> 3) & 0x1u) != 0u);
+    dst_p->is_g_present = (((bits >> 2) & 0x1u) != 0u);
+    dst_p->is_h_present = (((bits >> 1) & 0x1u) != 0u);
+    dst_p->is_i_present = ((bits & 0x1u) != 0u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_b_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_c_present) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_d_present) {
+        dst_p->d = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_e_present) {
+        dst_p->e = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_f_present) {
+        dst_p->f = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_g_present) {
+        dst_p->g = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_h_present) {
+        dst_p->h = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_i_present) {
+        dst_p->i = decoder_read_bool(decoder_p);
+    }
+}
+
+static void per_c_source_g_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_g_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 9);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 9);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits >> 8) != 0u);
+    dst_p->is_b_present = (((bits >> 7) & 0x1u) != 0u);
+    dst_p->is_c_present = (((bits >> 6) & 0x1u) != 0u);
+    dst_p->is_d_present = (((bits >> 5) & 0x1u) != 0u);
+    dst_p->is_e_present = (((bits >> 4) & 0x1u) != 0u);
+    dst_p->is_f_present = (((bits >> 3) & 0x1u) != 0u);
+    dst_p->is_g_present = (((bits >> 2) & 0x1u) != 0u);
+    dst_p->is_h_present = (((bits >> 1) & 0x1u) != 0u);
+    dst_p->is_i_present = ((bits & 0x1u) != 0u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_c_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_C) != 0u) {
+            dst_p->c = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_d_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_D) != 0u) {
+            dst_p->d = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_e_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_E) != 0u) {
+            dst_p->e = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_f_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_F) != 0u) {
+            dst_p->f = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_g_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_G) != 0u) {
+            dst_p->g = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_h_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_H) != 0u) {
+            dst_p->h = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_i_present) {
+        if ((fields & PER_C_SOURCE_G_FIELD_I) != 0u) {
+            dst_p->i = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+}
+
+static void per_c_source_g_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+    bool is_present_3;
+    bool is_present_4;
+    bool is_present_5;
+    bool is_present_6;
+    bool is_present_7;
+    bool is_present_8;
+    bool is_present_9;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    is_present_3 = decoder_read_bool(decoder_p);
+    is_present_4 = decoder_read_bool(decoder_p);
+    is_present_5 = decoder_read_bool(decoder_p);
+    is_present_6 = decoder_read_bool(decoder_p);
+    is_present_7 = decoder_read_bool(decoder_p);
+    is_present_8 = decoder_read_bool(decoder_p);
+    is_present_9 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_3) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_4) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_5) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_6) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_7) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_8) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_9) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void per_c_source_h_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_h_t *src_p)
+{
+    (void)encoder_p;
+    (void)src_p;
+}
+
+static void per_c_source_h_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_h_t *dst_p)
+{
+    (void)decoder_p;
+    (void)dst_p;
+}
+
+static void per_c_source_h_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
+static void per_c_source_i_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_i_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         24);
+}
+
+static void per_c_source_i_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_i_t *dst_p)
+{
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       24);
+}
+
+static void per_c_source_i_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 192u);
+}
+
+static void per_c_source_j_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_j_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 22u,
+        1);
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void per_c_source_j_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_j_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->length += 22u;
+
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void per_c_source_j_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    length += 22u;
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u * length);
+}
+
+static void per_c_source_k_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_k_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->value;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 0);
+}
+
+static void per_c_source_k_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_k_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 0);
+    dst_p->value = (enum per_c_source_k_e)value;
+}
+
+static void per_c_source_k_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
+static void per_c_source_l_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_l_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        16);
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void per_c_source_l_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_l_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void per_c_source_l_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    decoder_align(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    length += 0u;
+
+    if (length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u * length);
+}
+
+static void per_c_source_o_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_o_t *src_p)
+{
+    uint16_t i;
+
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 1u,
+        16);
+
+    for (i = 0; i < src_p->length; i++) {
+        encoder_append_bool(encoder_p, src_p->elements[i]);
+    }
+}
+
+static void per_c_source_o_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_o_t *dst_p)
+{
+    uint16_t i;
+
+    decoder_align(decoder_p);
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->length += 1u;
+
+    if (dst_p->length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        dst_p->elements[i] = decoder_read_bool(decoder_p);
+    }
+}
+
+static void per_c_source_o_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    decoder_align(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    length += 1u;
+
+    if (length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 1u);
+}
+
+static void per_c_source_n_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_n_t *src_p)
+{
+    per_c_source_k_encode_inner(encoder_p, &src_p->a);
+    per_c_source_a_encode_inner(encoder_p, &src_p->b);
+    per_c_source_o_encode_inner(encoder_p, &src_p->c);
+}
+
+static void per_c_source_n_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_n_t *dst_p)
+{
+    per_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    per_c_source_a_decode_inner(decoder_p, &dst_p->b);
+    per_c_source_o_decode_inner(decoder_p, &dst_p->c);
+}
+
+static void per_c_source_n_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_n_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_N_FIELD_A) != 0u) {
+        per_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    }
+    if ((fields & PER_C_SOURCE_N_FIELD_B) != 0u) {
+        per_c_source_a_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        per_c_source_a_skip_inner(decoder_p);
+    }
+    if ((fields & PER_C_SOURCE_N_FIELD_C) != 0u) {
+        per_c_source_o_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        per_c_source_o_skip_inner(decoder_p);
+    }
+}
+
+static void per_c_source_n_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    per_c_source_a_skip_inner(decoder_p);
+    per_c_source_o_skip_inner(decoder_p);
+}
+
+static void per_c_source_m_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_m_t *src_p)
+{
+    per_c_source_k_encode_inner(encoder_p, &src_p->a);
+    per_c_source_n_encode_inner(encoder_p, &src_p->b);
+}
+
+static void per_c_source_m_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_m_t *dst_p)
+{
+    per_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    per_c_source_n_decode_inner(decoder_p, &dst_p->b);
+}
+
+static void per_c_source_m_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_m_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_M_FIELD_A) != 0u) {
+        per_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    }
+    if ((fields & PER_C_SOURCE_M_FIELD_B) != 0u) {
+        per_c_source_n_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        per_c_source_n_skip_inner(decoder_p);
+    }
+}
+
+static void per_c_source_m_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    per_c_source_n_skip_inner(decoder_p);
+}
+
+static void per_c_source_p_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_p_t *src_p)
+{
+    per_c_source_a_encode_inner(encoder_p, &src_p->a);
+    per_c_source_m_encode_inner(encoder_p, &src_p->b);
+    per_c_source_f_encode_inner(encoder_p, &src_p->c);
+}
+
+static void per_c_source_p_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_p_t *dst_p)
+{
+    per_c_source_a_decode_inner(decoder_p, &dst_p->a);
+    per_c_source_m_decode_inner(decoder_p, &dst_p->b);
+    per_c_source_f_decode_inner(decoder_p, &dst_p->c);
+}
+
+static void per_c_source_p_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_p_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_C_SOURCE_P_FIELD_A) != 0u) {
+        per_c_source_a_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        per_c_source_a_skip_inner(decoder_p);
+    }
+    if ((fields & PER_C_SOURCE_P_FIELD_B) != 0u) {
+        per_c_source_m_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        per_c_source_m_skip_inner(decoder_p);
+    }
+    if ((fields & PER_C_SOURCE_P_FIELD_C) != 0u) {
+        per_c_source_f_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        per_c_source_f_skip_inner(decoder_p);
+    }
+}
+
+static void per_c_source_p_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    per_c_source_a_skip_inner(decoder_p);
+    per_c_source_m_skip_inner(decoder_p);
+    per_c_source_f_skip_inner(decoder_p);
+}
+
+static void per_c_source_r_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_r_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -1),
+        1);
+}
+
+static void per_c_source_r_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_r_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->value += -1;
+}
+
+static void per_c_source_r_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_c_ref_referenced_int_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_ref_referenced_int_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_uint8(encoder_p, src_p->value);
+}
+
+static void per_c_ref_referenced_int_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_ref_referenced_int_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_uint8(decoder_p);
+}
+
+static void per_c_ref_referenced_int_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void per_c_source_s_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_s_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -2),
+        2);
+}
+
+static void per_c_source_s_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_s_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->value += -2;
+}
+
+static void per_c_source_s_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void per_c_source_t_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_t_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -1),
+        2);
+}
+
+static void per_c_source_t_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_t_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->value += -1;
+}
+
+static void per_c_source_t_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void per_c_source_u_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_u_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -64),
+        7);
+}
+
+static void per_c_source_u_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_u_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    dst_p->value += -64;
+}
+
+static void per_c_source_u_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 7u);
+}
+
+static void per_c_source_v_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_v_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void per_c_source_v_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_v_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void per_c_source_v_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void per_c_source_w_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_w_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -1),
+        16);
+}
+
+static void per_c_source_w_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_w_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->value += -1;
+}
+
+static void per_c_source_w_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+}
+
+static void per_c_source_x_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_x_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -2),
+        16);
+}
+
+static void per_c_source_x_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_x_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->value += -2;
+}
+
+static void per_c_source_x_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+}
+
+static void per_c_source_y_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_y_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - 10000),
+        16);
+}
+
+static void per_c_source_y_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_y_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->value += 10000;
+}
+
+static void per_c_source_y_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+}
+
+static void per_c_source_z_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_c_source_z_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->value);
+}
+
+static void per_c_source_z_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_c_source_z_t *dst_p)
+{
+    dst_p->value = decoder_read_bool(decoder_p);
+}
+
+static void per_c_source_z_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+ssize_t per_c_source_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_a_encoded_size(
+    const struct per_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_a_decode(
+    struct per_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_a_decode_batch(
+    struct per_c_source_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_a_decode_fields(
+    struct per_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ab_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ab_encoded_size(
+    const struct per_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ab_decode(
+    struct per_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ab_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ab_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ab_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ab_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ab_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ab_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ab_decode_batch(
+    struct per_c_source_ab_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ab_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ab_decode_fields(
+    struct per_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ab_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_q_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_q_encoded_size(
+    const struct per_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_q_decode(
+    struct per_c_source_q_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_q_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_q_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_q_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_q_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_q_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_q_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_q_decode_batch(
+    struct per_c_source_q_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_q_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_d_encoded_size(
+    const struct per_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_d_decode(
+    struct per_c_source_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_d_decode_batch(
+    struct per_c_source_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ac_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ac_encoded_size(
+    const struct per_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ac_decode(
+    struct per_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ac_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ac_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ac_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ac_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ac_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ac_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ac_decode_batch(
+    struct per_c_source_ac_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ac_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ac_decode_fields(
+    struct per_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ac_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ad_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ad_encoded_size(
+    const struct per_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ad_decode(
+    struct per_c_source_ad_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ad_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ad_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ad_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ad_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ad_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ad_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ad_decode_batch(
+    struct per_c_source_ad_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ad_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ae_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ae_encoded_size(
+    const struct per_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ae_decode(
+    struct per_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ae_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ae_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ae_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ae_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ae_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ae_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ae_decode_batch(
+    struct per_c_source_ae_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ae_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ae_decode_fields(
+    struct per_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ae_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ah_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ah_encoded_size(
+    const struct per_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ah_decode(
+    struct per_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ah_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ah_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ah_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ah_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ah_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ah_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ah_decode_batch(
+    struct per_c_source_ah_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ah_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ah_decode_fields(
+    struct per_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ah_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_af_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_af_encoded_size(
+    const struct per_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_af_decode(
+    struct per_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_af_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_af_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_af_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_af_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_af_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_af_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_af_decode_batch(
+    struct per_c_source_af_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_af_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_af_decode_fields(
+    struct per_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_af_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ag_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ag_encoded_size(
+    const struct per_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ag_decode(
+    struct per_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ag_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ag_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ag_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ag_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ag_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ag_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ag_decode_batch(
+    struct per_c_source_ag_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ag_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ag_decode_fields(
+    struct per_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ag_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_aj_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_aj_encoded_size(
+    const struct per_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_aj_decode(
+    struct per_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_aj_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_aj_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_aj_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_aj_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_aj_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_aj_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_aj_decode_batch(
+    struct per_c_source_aj_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_aj_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_aj_decode_fields(
+    struct per_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_aj_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ak_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ak_encoded_size(
+    const struct per_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ak_decode(
+    struct per_c_source_ak_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ak_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ak_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ak_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ak_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ak_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ak_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ak_decode_batch(
+    struct per_c_source_ak_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ak_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ai_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ai_encoded_size(
+    const struct per_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ai_decode(
+    struct per_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ai_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ai_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ai_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ai_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ai_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ai_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ai_decode_batch(
+    struct per_c_source_ai_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ai_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ai_decode_fields(
+    struct per_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ai_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_al_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_al_encoded_size(
+    const struct per_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_al_decode(
+    struct per_c_source_al_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_al_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_al_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_al_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_al_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_al_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_al_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_al_decode_batch(
+    struct per_c_source_al_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_al_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_am_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_am_encoded_size(
+    const struct per_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_am_decode(
+    struct per_c_source_am_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_am_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_am_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_am_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_am_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_am_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_am_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_am_decode_batch(
+    struct per_c_source_am_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_am_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_an_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_an_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_an_encoded_size(
+    const struct per_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_an_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_an_decode(
+    struct per_c_source_an_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_an_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_an_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_an_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_an_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_an_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_an_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_an_decode_batch(
+    struct per_c_source_an_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_an_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ao_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ao_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ao_encoded_size(
+    const struct per_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ao_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ao_decode(
+    struct per_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ao_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ao_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ao_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ao_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ao_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ao_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ao_decode_batch(
+    struct per_c_source_ao_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ao_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ao_decode_fields(
+    struct per_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ao_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_sequence_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_referenced_sequence_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_referenced_sequence_encoded_size(
+    const struct per_c_ref_referenced_sequence_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_referenced_sequence_decode(
+    struct per_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_sequence_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_sequence_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_sequence_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_sequence_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_referenced_sequence_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_ref_referenced_sequence_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_ref_referenced_sequence_decode_batch(
+    struct per_c_ref_referenced_sequence_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_ref_referenced_sequence_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_ref_referenced_sequence_decode_fields(
+    struct per_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_sequence_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_enum_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_referenced_enum_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_referenced_enum_encoded_size(
+    const struct per_c_ref_referenced_enum_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_referenced_enum_decode(
+    struct per_c_ref_referenced_enum_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_enum_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_enum_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_enum_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_enum_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_referenced_enum_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_ref_referenced_enum_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_ref_referenced_enum_decode_batch(
+    struct per_c_ref_referenced_enum_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_ref_referenced_enum_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ap_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ap_encoded_size(
+    const struct per_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ap_decode(
+    struct per_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ap_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ap_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ap_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ap_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ap_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ap_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ap_decode_batch(
+    struct per_c_source_ap_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ap_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ap_decode_fields(
+    struct per_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ap_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_aq_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_aq_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_aq_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_aq_encoded_size(
+    const struct per_c_source_aq_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_aq_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_aq_decode(
+    struct per_c_source_aq_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_aq_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_aq_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_aq_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_aq_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_aq_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_aq_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_aq_decode_batch(
+    struct per_c_source_aq_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_aq_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ar_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ar_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_ar_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ar_encoded_size(
+    const struct per_c_source_ar_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_ar_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_ar_decode(
+    struct per_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ar_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ar_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ar_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_ar_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_ar_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_ar_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ar_decode_batch(
+    struct per_c_source_ar_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_ar_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_ar_decode_fields(
+    struct per_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_ar_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_as_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_as_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_as_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_as_encoded_size(
+    const struct per_c_source_as_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_as_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_as_decode(
+    struct per_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_as_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_as_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_as_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_as_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_as_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_as_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_as_decode_batch(
+    struct per_c_source_as_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_as_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_as_decode_fields(
+    struct per_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_as_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_at_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_at_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_ref_at_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_at_encoded_size(
+    const struct per_c_ref_at_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_ref_at_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_at_decode(
+    struct per_c_ref_at_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_at_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_at_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_at_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_at_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_at_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_ref_at_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_ref_at_decode_batch(
+    struct per_c_ref_at_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_ref_at_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_b_encoded_size(
+    const struct per_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_b_decode(
+    struct per_c_source_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_b_decode_batch(
+    struct per_c_source_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_c_encoded_size(
+    const struct per_c_source_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_c_decode(
+    struct per_c_source_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_c_decode_batch(
+    struct per_c_source_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_e_encoded_size(
+    const struct per_c_source_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_e_decode(
+    struct per_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_e_decode_batch(
+    struct per_c_source_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_e_decode_fields(
+    struct per_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_f_encoded_size(
+    const struct per_c_source_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_f_decode(
+    struct per_c_source_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_f_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_f_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_f_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_f_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_f_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_f_decode_batch(
+    struct per_c_source_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_f_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_g_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_g_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_g_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_g_encoded_size(
+    const struct per_c_source_g_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_g_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_g_decode(
+    struct per_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_g_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_g_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_g_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_g_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_g_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_g_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_g_decode_batch(
+    struct per_c_source_g_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_g_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_g_decode_fields(
+    struct per_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_g_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_h_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_h_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_h_encoded_size(
+    const struct per_c_source_h_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_h_decode(
+    struct per_c_source_h_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_h_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_h_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_h_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_h_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_h_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_h_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_h_decode_batch(
+    struct per_c_source_h_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_h_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_i_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_i_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_i_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_i_encoded_size(
+    const struct per_c_source_i_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_i_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_i_decode(
+    struct per_c_source_i_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_i_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_i_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_i_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_i_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_i_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_i_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_i_decode_batch(
+    struct per_c_source_i_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_i_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_j_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_j_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_j_encoded_size(
+    const struct per_c_source_j_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_j_decode(
+    struct per_c_source_j_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_j_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_j_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_j_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_j_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_j_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_j_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_j_decode_batch(
+    struct per_c_source_j_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_j_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_k_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_k_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_k_encoded_size(
+    const struct per_c_source_k_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_k_decode(
+    struct per_c_source_k_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_k_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_k_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_k_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_k_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_k_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_k_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_k_decode_batch(
+    struct per_c_source_k_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_k_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_l_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_l_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_l_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_l_encoded_size(
+    const struct per_c_source_l_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_l_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_l_decode(
+    struct per_c_source_l_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_l_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_l_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_l_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_l_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_l_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_l_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_l_decode_batch(
+    struct per_c_source_l_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_l_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_o_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_o_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_o_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_o_encoded_size(
+    const struct per_c_source_o_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_o_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_o_decode(
+    struct per_c_source_o_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_o_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_o_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_o_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_o_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_o_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_o_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_o_decode_batch(
+    struct per_c_source_o_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_o_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_n_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_n_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_n_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_n_encoded_size(
+    const struct per_c_source_n_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_n_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_n_decode(
+    struct per_c_source_n_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_n_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_n_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_n_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_n_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_n_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_n_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_n_decode_batch(
+    struct per_c_source_n_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_n_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_n_decode_fields(
+    struct per_c_source_n_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_n_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_m_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_m_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_m_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_m_encoded_size(
+    const struct per_c_source_m_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_m_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_m_decode(
+    struct per_c_source_m_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_m_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_m_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_m_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_m_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_m_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_m_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_m_decode_batch(
+    struct per_c_source_m_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_m_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_m_decode_fields(
+    struct per_c_source_m_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_m_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_p_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_p_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_p_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_p_encoded_size(
+    const struct per_c_source_p_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_p_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_p_decode(
+    struct per_c_source_p_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_p_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_p_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_p_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_p_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_p_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_p_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_p_decode_batch(
+    struct per_c_source_p_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_p_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_p_decode_fields(
+    struct per_c_source_p_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_p_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_r_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_r_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_r_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_r_encoded_size(
+    const struct per_c_source_r_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_r_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_r_decode(
+    struct per_c_source_r_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_r_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_r_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_r_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_r_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_r_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_r_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_r_decode_batch(
+    struct per_c_source_r_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_r_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_ref_referenced_int_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_referenced_int_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_ref_referenced_int_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_referenced_int_encoded_size(
+    const struct per_c_ref_referenced_int_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_ref_referenced_int_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_ref_referenced_int_decode(
+    struct per_c_ref_referenced_int_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_int_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_int_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_ref_referenced_int_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_ref_referenced_int_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_ref_referenced_int_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_ref_referenced_int_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_ref_referenced_int_decode_batch(
+    struct per_c_ref_referenced_int_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_ref_referenced_int_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_s_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_s_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_s_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_s_encoded_size(
+    const struct per_c_source_s_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_s_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_s_decode(
+    struct per_c_source_s_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_s_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_s_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_s_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_s_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_s_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_s_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_s_decode_batch(
+    struct per_c_source_s_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_s_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_t_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_t_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_t_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_t_encoded_size(
+    const struct per_c_source_t_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_t_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_t_decode(
+    struct per_c_source_t_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_t_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_t_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_t_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_t_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_t_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_t_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_t_decode_batch(
+    struct per_c_source_t_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_t_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_u_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_u_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_u_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_u_encoded_size(
+    const struct per_c_source_u_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_u_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_u_decode(
+    struct per_c_source_u_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_u_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_u_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_u_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_u_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_u_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_u_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_u_decode_batch(
+    struct per_c_source_u_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_u_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_v_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_v_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_v_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_v_encoded_size(
+    const struct per_c_source_v_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_v_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_v_decode(
+    struct per_c_source_v_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_v_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_v_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_v_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_v_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_v_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_v_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_v_decode_batch(
+    struct per_c_source_v_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_v_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_w_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_w_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_w_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_w_encoded_size(
+    const struct per_c_source_w_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_w_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_w_decode(
+    struct per_c_source_w_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_w_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_w_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_w_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_w_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_w_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_w_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_w_decode_batch(
+    struct per_c_source_w_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_w_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_x_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_x_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_x_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_x_encoded_size(
+    const struct per_c_source_x_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_x_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_x_decode(
+    struct per_c_source_x_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_x_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_x_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_x_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_x_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_x_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_x_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_x_decode_batch(
+    struct per_c_source_x_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_x_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_y_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_y_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_y_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_y_encoded_size(
+    const struct per_c_source_y_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_y_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_y_decode(
+    struct per_c_source_y_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_y_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_y_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_y_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_y_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_y_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_y_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_y_decode_batch(
+    struct per_c_source_y_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_y_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_z_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_z_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_c_source_z_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_z_encoded_size(
+    const struct per_c_source_z_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_c_source_z_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_c_source_z_decode(
+    struct per_c_source_z_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_z_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_z_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_c_source_z_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_c_source_z_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_c_source_z_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_c_source_z_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_c_source_z_decode_batch(
+    struct per_c_source_z_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_c_source_z_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
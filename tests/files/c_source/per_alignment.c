@@ -0,0 +1,1691 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:52:12 2026.
+ */
+
+#include <string.h>
+
+#include "per_alignment.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
+}
+
+static ALWAYS_INLINE void encoder_append_uint16(struct encoder_t *self_p,
+                                                uint16_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 16);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static void encoder_append_open_type_length(struct encoder_t *self_p,
+                                            ssize_t size)
+{
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    /* An empty encoding is replaced by a single zero byte. */
+    if (size == 0) {
+        size = 1;
+    }
+
+    if (size < 128) {
+        encoder_append_uint8(self_p, (uint8_t)size);
+    } else if (size < 16384) {
+        encoder_append_uint16(self_p, (uint16_t)(0x8000 | size));
+    } else {
+        /* Fragmented encodings are not supported. */
+        encoder_abort(self_p, EBADLENGTH);
+    }
+}
+
+static void encoder_end_open_type(struct encoder_t *self_p,
+                                  ssize_t start_pos,
+                                  ssize_t size)
+{
+    if (self_p->size < 0) {
+        return;
+    }
+
+    if (size == 0) {
+        size = 1;
+    }
+
+    /* Pad with zero bits up to the end of the encoding. */
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)(start_pos + (8 * size) - self_p->pos));
+}
+
+static size_t decoder_read_open_type_length(struct decoder_t *self_p)
+{
+    size_t length;
+
+    length = decoder_read_uint8(self_p);
+
+    if ((length & 0x80u) != 0) {
+        /* Fragmented encodings are not supported. */
+        if ((length & 0x40u) != 0) {
+            decoder_abort(self_p, EBADLENGTH);
+
+            return (0);
+        }
+
+        length = (((length & 0x3fu) << 8) | decoder_read_uint8(self_p));
+    }
+
+    /* Empty values are encoded as a single zero byte, never as an
+       empty encoding. */
+    if (length == 0) {
+        decoder_abort(self_p, EBADLENGTH);
+    }
+
+    return (length);
+}
+
+static void decoder_end_open_type(struct decoder_t *self_p,
+                                  ssize_t start_pos,
+                                  size_t length)
+{
+    ssize_t end_pos;
+
+    if (self_p->size < 0) {
+        return;
+    }
+
+    end_pos = (start_pos + (8 * (ssize_t)length));
+
+    /* The value must fit in its encoding, and any padding is
+       skipped. */
+    if (self_p->pos > end_pos) {
+        decoder_abort(self_p, EBADLENGTH);
+    } else {
+        (void)decoder_free(self_p, (size_t)(end_pos - self_p->pos));
+    }
+}
+
+static ALWAYS_INLINE void encoder_align(struct encoder_t *self_p)
+{
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static void encoder_append_indefinite_whole_number(struct encoder_t *self_p,
+                                                   uint64_t value,
+                                                   size_t number_of_length_bits)
+{
+    size_t number_of_bytes;
+
+    number_of_bytes = 1;
+
+    while ((number_of_bytes < 8) && ((value >> (8 * number_of_bytes)) != 0)) {
+        number_of_bytes++;
+    }
+
+    encoder_append_non_negative_binary_integer(self_p,
+                                               number_of_bytes - 1,
+                                               number_of_length_bits);
+    encoder_align(self_p);
+    encoder_append_non_negative_binary_integer(self_p,
+                                               value,
+                                               8 * number_of_bytes);
+}
+
+static ALWAYS_INLINE void decoder_align(struct decoder_t *self_p)
+{
+    (void)decoder_free(self_p, (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static uint64_t decoder_read_indefinite_whole_number(struct decoder_t *self_p,
+                                                     size_t number_of_length_bits,
+                                                     size_t maximum_number_of_bytes)
+{
+    size_t number_of_bytes;
+
+    number_of_bytes = (size_t)decoder_read_non_negative_binary_integer(
+        self_p,
+        number_of_length_bits);
+    number_of_bytes++;
+
+    if (number_of_bytes > maximum_number_of_bytes) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0);
+    }
+
+    decoder_align(self_p);
+
+    return (decoder_read_non_negative_binary_integer(self_p,
+                                                     8 * number_of_bytes));
+}
+
+static void per_alignment_alignment_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_alignment_alignment_a_t *src_p)
+{
+    uint16_t i;
+
+    encoder_append_bool(encoder_p, src_p->a);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->b.length - 0u,
+        16);
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->b.buf[0],
+                         src_p->b.length);
+    encoder_append_bool(encoder_p, src_p->c);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->d - 0),
+        16);
+    encoder_append_bool(encoder_p, src_p->e);
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->f.length - 0u,
+        16);
+
+    for (i = 0; i < src_p->f.length; i++) {
+        encoder_append_bool(encoder_p, src_p->f.elements[i]);
+    }
+
+    encoder_append_bool(encoder_p, src_p->g);
+}
+
+static void per_alignment_alignment_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_a_t *dst_p)
+{
+    uint16_t i;
+
+    dst_p->a = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->b.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->b.length += 0u;
+
+    if (dst_p->b.length > 300u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->b.buf[0],
+                       dst_p->b.length);
+    dst_p->c = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->d = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->d += 0;
+    dst_p->e = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->f.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->f.length += 0u;
+
+    if (dst_p->f.length > 300u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->f.length; i++) {
+        dst_p->f.elements[i] = decoder_read_bool(decoder_p);
+    }
+
+    dst_p->g = decoder_read_bool(decoder_p);
+}
+
+static void per_alignment_alignment_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_a_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+    uint16_t i;
+    uint32_t length_2;
+
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        dst_p->b.length += 0u;
+
+        if (dst_p->b.length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        decoder_read_bytes(decoder_p,
+                           &dst_p->b.buf[0],
+                           dst_p->b.length);
+    } else {
+        decoder_align(decoder_p);
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        length += 0u;
+
+        if (length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u * length);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_D) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->d = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        dst_p->d += 0;
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 16u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_F) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->f.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        dst_p->f.length += 0u;
+
+        if (dst_p->f.length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i = 0; i < dst_p->f.length; i++) {
+            dst_p->f.elements[i] = decoder_read_bool(decoder_p);
+        }
+    } else {
+        decoder_align(decoder_p);
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        length_2 += 0u;
+
+        if (length_2 > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2 * 1u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_A_FIELD_G) != 0u) {
+        dst_p->g = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void per_alignment_alignment_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t length_2;
+
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    length += 0u;
+
+    if (length > 300u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u * length);
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 16u);
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    length_2 += 0u;
+
+    if (length_2 > 300u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2 * 1u);
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void per_alignment_alignment_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_alignment_alignment_b_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->a);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->b,
+        2);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->c + 2147483648u,
+        2);
+    encoder_append_indefinite_whole_number(
+        encoder_p,
+        (uint64_t)src_p->d,
+        3);
+}
+
+static void per_alignment_alignment_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_b_t *dst_p)
+{
+    dst_p->a = decoder_read_bool(decoder_p);
+    dst_p->b = (uint32_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        2,
+        3));
+    dst_p->c = (int32_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        2,
+        4) - 2147483648u);
+    dst_p->d = (uint64_t)(decoder_read_indefinite_whole_number(
+        decoder_p,
+        3,
+        8));
+}
+
+static void per_alignment_alignment_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_b_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_B_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_B_FIELD_B) != 0u) {
+        dst_p->b = (uint32_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            2,
+            3));
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 2, 3);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_B_FIELD_C) != 0u) {
+        dst_p->c = (int32_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            2,
+            4) - 2147483648u);
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 2, 4);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_B_FIELD_D) != 0u) {
+        dst_p->d = (uint64_t)(decoder_read_indefinite_whole_number(
+            decoder_p,
+            3,
+            8));
+    } else {
+        (void)decoder_read_indefinite_whole_number(decoder_p, 3, 8);
+    }
+}
+
+static void per_alignment_alignment_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 2, 3);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 2, 4);
+    (void)decoder_read_indefinite_whole_number(decoder_p, 3, 8);
+}
+
+static void per_alignment_alignment_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_alignment_alignment_c_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        8);
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void per_alignment_alignment_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_c_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 200u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void per_alignment_alignment_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    length += 0u;
+
+    if (length > 200u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u * length);
+}
+
+static void per_alignment_alignment_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_alignment_alignment_d_t *src_p)
+{
+    ssize_t size;
+    ssize_t start_pos;
+
+    encoder_append_bool(encoder_p, src_p->a);
+    encoder_align(encoder_p);
+    encoder_append_uint8(encoder_p, src_p->id);
+
+    switch (src_p->id) {
+
+    case 0:
+        size = per_alignment_alignment_b_encoded_size(&src_p->value.b);
+        break;
+
+    case 1:
+        size = per_alignment_alignment_c_encoded_size(&src_p->value.c);
+        break;
+
+    default:
+        size = -EBADCHOICE;
+        break;
+    }
+
+    encoder_align(encoder_p);
+    encoder_append_open_type_length(encoder_p, size);
+    start_pos = encoder_p->pos;
+
+    switch (src_p->id) {
+
+    case 0:
+        per_alignment_alignment_b_encode_inner(encoder_p, &src_p->value.b);
+        break;
+
+    case 1:
+        per_alignment_alignment_c_encode_inner(encoder_p, &src_p->value.c);
+        break;
+
+    default:
+        break;
+    }
+
+    encoder_end_open_type(encoder_p, start_pos, size);
+}
+
+static void per_alignment_alignment_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_d_t *dst_p)
+{
+    size_t length;
+    ssize_t start_pos;
+
+    dst_p->a = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->id = decoder_read_uint8(decoder_p);
+    decoder_align(decoder_p);
+    length = decoder_read_open_type_length(decoder_p);
+    start_pos = decoder_p->pos;
+
+    switch (dst_p->id) {
+
+    case 0:
+        per_alignment_alignment_b_decode_inner(decoder_p, &dst_p->value.b);
+        break;
+
+    case 1:
+        per_alignment_alignment_c_decode_inner(decoder_p, &dst_p->value.c);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+
+    decoder_end_open_type(decoder_p, start_pos, length);
+}
+
+static void per_alignment_alignment_d_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_d_t *dst_p,
+    uint64_t fields)
+{
+    size_t length;
+    ssize_t start_pos;
+    size_t length_2;
+
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_D_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & (PER_ALIGNMENT_ALIGNMENT_D_FIELD_ID | PER_ALIGNMENT_ALIGNMENT_D_FIELD_VALUE)) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->id = decoder_read_uint8(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & PER_ALIGNMENT_ALIGNMENT_D_FIELD_VALUE) != 0u) {
+        decoder_align(decoder_p);
+        length = decoder_read_open_type_length(decoder_p);
+        start_pos = decoder_p->pos;
+
+        switch (dst_p->id) {
+
+        case 0:
+            per_alignment_alignment_b_decode_inner(decoder_p, &dst_p->value.b);
+            break;
+
+        case 1:
+            per_alignment_alignment_c_decode_inner(decoder_p, &dst_p->value.c);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        decoder_end_open_type(decoder_p, start_pos, length);
+    } else {
+        decoder_align(decoder_p);
+        length_2 = decoder_read_open_type_length(decoder_p);
+        (void)decoder_free(decoder_p, 8u * length_2);
+    }
+}
+
+static void per_alignment_alignment_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    size_t length;
+
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+    decoder_align(decoder_p);
+    length = decoder_read_open_type_length(decoder_p);
+    (void)decoder_free(decoder_p, 8u * length);
+}
+
+static void per_alignment_alignment_id_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_alignment_alignment_id_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_uint8(encoder_p, src_p->value);
+}
+
+static void per_alignment_alignment_id_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_alignment_alignment_id_t *dst_p)
+{
+    decoder_align(decoder_p);
+    dst_p->value = decoder_read_uint8(decoder_p);
+}
+
+static void per_alignment_alignment_id_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+}
+
+ssize_t per_alignment_alignment_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_alignment_alignment_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_a_encoded_size(
+    const struct per_alignment_alignment_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_alignment_alignment_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_a_decode(
+    struct per_alignment_alignment_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_alignment_alignment_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_a_decode_batch(
+    struct per_alignment_alignment_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_alignment_alignment_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_a_decode_fields(
+    struct per_alignment_alignment_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_alignment_alignment_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_b_encoded_size(
+    const struct per_alignment_alignment_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_alignment_alignment_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_b_decode(
+    struct per_alignment_alignment_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_alignment_alignment_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_b_decode_batch(
+    struct per_alignment_alignment_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_alignment_alignment_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_b_decode_fields(
+    struct per_alignment_alignment_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_alignment_alignment_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_c_encoded_size(
+    const struct per_alignment_alignment_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_alignment_alignment_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_c_decode(
+    struct per_alignment_alignment_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_alignment_alignment_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_c_decode_batch(
+    struct per_alignment_alignment_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_alignment_alignment_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_alignment_alignment_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_d_encoded_size(
+    const struct per_alignment_alignment_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_alignment_alignment_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_d_decode(
+    struct per_alignment_alignment_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_alignment_alignment_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_d_decode_batch(
+    struct per_alignment_alignment_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_alignment_alignment_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_d_decode_fields(
+    struct per_alignment_alignment_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_d_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_id_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_id_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_alignment_alignment_id_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_id_encoded_size(
+    const struct per_alignment_alignment_id_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_alignment_alignment_id_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_alignment_alignment_id_decode(
+    struct per_alignment_alignment_id_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_id_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_id_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_alignment_alignment_id_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_alignment_alignment_id_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_id_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_alignment_alignment_id_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_alignment_alignment_id_decode_batch(
+    struct per_alignment_alignment_id_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_alignment_alignment_id_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
@@ -0,0 +1,694 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 15:11:32 2026.
+ */
+
+#ifndef PER_ALIGNMENT_H
+#define PER_ALIGNMENT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Type A in module Alignment.
+ */
+struct per_alignment_alignment_a_t {
+    bool a;
+    struct {
+        uint32_t length;
+        uint8_t buf[300];
+    } b;
+    bool c;
+    uint16_t d;
+    bool e;
+    struct {
+        uint32_t length;
+        bool elements[300];
+    } f;
+    bool g;
+};
+
+/**
+ * Type B in module Alignment.
+ */
+struct per_alignment_alignment_b_t {
+    bool a;
+    uint32_t b;
+    int32_t c;
+    uint64_t d;
+};
+
+/**
+ * Type C in module Alignment.
+ */
+struct per_alignment_alignment_c_t {
+    uint8_t length;
+    uint8_t buf[200];
+};
+
+/**
+ * Type D in module Alignment.
+ */
+struct per_alignment_alignment_d_t {
+    bool a;
+    uint8_t id;
+    union {
+        struct per_alignment_alignment_b_t b;
+        struct per_alignment_alignment_c_t c;
+    } value;
+};
+
+/**
+ * Type Id in module Alignment.
+ */
+struct per_alignment_alignment_id_t {
+    uint8_t value;
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Alignment, in bytes.
+ */
+#define PER_ALIGNMENT_ALIGNMENT_A_MAX_ENCODED_SIZE 348u
+
+/**
+ * Encode type A defined in module Alignment.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Alignment, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_a_encoded_size(
+    const struct per_alignment_alignment_a_t *src_p);
+
+/**
+ * Decode type A defined in module Alignment.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_a_decode(
+    struct per_alignment_alignment_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Alignment, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Alignment after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Alignment encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_a_decode_batch(
+    struct per_alignment_alignment_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type A defined in module Alignment, to decode
+ * with per_alignment_alignment_a_decode_fields().
+ */
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_A (1ull << 0)
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_B (1ull << 1)
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_C (1ull << 2)
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_D (1ull << 3)
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_E (1ull << 4)
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_F (1ull << 5)
+#define PER_ALIGNMENT_ALIGNMENT_A_FIELD_G (1ull << 6)
+
+/**
+ * Decode given fields of type A defined in module
+ * Alignment. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_a_decode_fields(
+    struct per_alignment_alignment_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Alignment, in bytes.
+ */
+#define PER_ALIGNMENT_ALIGNMENT_B_MAX_ENCODED_SIZE 19u
+
+/**
+ * Encode type B defined in module Alignment.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Alignment, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_b_encoded_size(
+    const struct per_alignment_alignment_b_t *src_p);
+
+/**
+ * Decode type B defined in module Alignment.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_b_decode(
+    struct per_alignment_alignment_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Alignment, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Alignment after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Alignment encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_b_decode_batch(
+    struct per_alignment_alignment_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type B defined in module Alignment, to decode
+ * with per_alignment_alignment_b_decode_fields().
+ */
+#define PER_ALIGNMENT_ALIGNMENT_B_FIELD_A (1ull << 0)
+#define PER_ALIGNMENT_ALIGNMENT_B_FIELD_B (1ull << 1)
+#define PER_ALIGNMENT_ALIGNMENT_B_FIELD_C (1ull << 2)
+#define PER_ALIGNMENT_ALIGNMENT_B_FIELD_D (1ull << 3)
+
+/**
+ * Decode given fields of type B defined in module
+ * Alignment. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_b_decode_fields(
+    struct per_alignment_alignment_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * Alignment, in bytes.
+ */
+#define PER_ALIGNMENT_ALIGNMENT_C_MAX_ENCODED_SIZE 202u
+
+/**
+ * Encode type C defined in module Alignment.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * Alignment, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_c_encoded_size(
+    const struct per_alignment_alignment_c_t *src_p);
+
+/**
+ * Decode type C defined in module Alignment.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_c_decode(
+    struct per_alignment_alignment_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module Alignment, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * Alignment after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * Alignment encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_c_decode_batch(
+    struct per_alignment_alignment_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type D defined in module Alignment.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_d_t *src_p);
+
+/**
+ * Calculate the encoded size of type D defined in module
+ * Alignment, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_d_encoded_size(
+    const struct per_alignment_alignment_d_t *src_p);
+
+/**
+ * Decode type D defined in module Alignment.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_d_decode(
+    struct per_alignment_alignment_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type D defined in
+ * module Alignment, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * Alignment after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type D defined in module
+ * Alignment encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_d_decode_batch(
+    struct per_alignment_alignment_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type D defined in module Alignment, to decode
+ * with per_alignment_alignment_d_decode_fields().
+ */
+#define PER_ALIGNMENT_ALIGNMENT_D_FIELD_A (1ull << 0)
+#define PER_ALIGNMENT_ALIGNMENT_D_FIELD_ID (1ull << 1)
+#define PER_ALIGNMENT_ALIGNMENT_D_FIELD_VALUE (1ull << 2)
+
+/**
+ * Decode given fields of type D defined in module
+ * Alignment. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_d_decode_fields(
+    struct per_alignment_alignment_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type Id defined in module
+ * Alignment, in bytes.
+ */
+#define PER_ALIGNMENT_ALIGNMENT_ID_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type Id defined in module Alignment.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_id_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_id_t *src_p);
+
+/**
+ * Calculate the encoded size of type Id defined in module
+ * Alignment, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_id_encoded_size(
+    const struct per_alignment_alignment_id_t *src_p);
+
+/**
+ * Decode type Id defined in module Alignment.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_id_decode(
+    struct per_alignment_alignment_id_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type Id defined in
+ * module Alignment, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_id_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Id defined in module
+ * Alignment after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_alignment_alignment_id_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_alignment_alignment_id_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Id defined in module
+ * Alignment encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_alignment_alignment_id_decode_batch(
+    struct per_alignment_alignment_id_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+#endif
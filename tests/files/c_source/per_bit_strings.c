@@ -0,0 +1,1541 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:27 2026.
+ */
+
+#include <string.h>
+
+#include "per_bit_strings.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static void encoder_append_bit_string(struct encoder_t *self_p,
+                                      const uint8_t *buf_p,
+                                      size_t number_of_bits)
+{
+    size_t size;
+    size_t rest;
+
+    if (encoder_alloc(self_p, number_of_bits) < 0) {
+        return;
+    }
+
+    size = (number_of_bits / 8u);
+    rest = (number_of_bits % 8u);
+    encoder_write_bytes(self_p, buf_p, size);
+
+    if (rest != 0) {
+        encoder_write_bits(self_p, (uint64_t)(buf_p[size] >> (8u - rest)), rest);
+    }
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static void decoder_read_bit_string(struct decoder_t *self_p,
+                                    uint8_t *buf_p,
+                                    size_t number_of_bits)
+{
+    size_t size;
+    size_t rest;
+
+    size = (number_of_bits / 8u);
+    rest = (number_of_bits % 8u);
+    decoder_read_bytes(self_p, buf_p, size);
+
+    if (rest != 0) {
+        buf_p[size] = (uint8_t)(
+            decoder_read_non_negative_binary_integer(self_p, rest) << (8u - rest));
+    }
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static ALWAYS_INLINE void encoder_align(struct encoder_t *self_p)
+{
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static ALWAYS_INLINE void decoder_align(struct decoder_t *self_p)
+{
+    (void)decoder_free(self_p, (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_uint(struct jer_encoder_t *self_p,
+                                    uint64_t value)
+{
+    static const char digits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    uint8_t *buf_p;
+    uint64_t power;
+    size_t number_of_digits;
+    size_t i;
+
+    number_of_digits = 1;
+    power = 10;
+
+    while ((number_of_digits < 20) && (value >= power)) {
+        number_of_digits++;
+        power *= 10;
+    }
+
+    buf_p = jer_encoder_alloc(self_p, number_of_digits);
+
+    if (buf_p == NULL) {
+        return;
+    }
+
+    /* Two digits at a time from the end. */
+    i = number_of_digits;
+
+    while (value >= 100) {
+        i -= 2;
+        (void)memcpy(&buf_p[i], &digits[2 * (value % 100)], 2);
+        value /= 100;
+    }
+
+    if (value >= 10) {
+        (void)memcpy(&buf_p[0], &digits[2 * value], 2);
+    } else {
+        buf_p[0] = (uint8_t)('0' + value);
+    }
+}
+
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}
+
+static void jer_encoder_append_hex(struct jer_encoder_t *self_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    uint8_t *dst_p;
+    size_t i;
+
+    dst_p = jer_encoder_alloc(self_p, 2 * size + 2);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    dst_p[0] = '"';
+
+    for (i = 0; i < size; i++) {
+        dst_p[2 * i + 1] = (uint8_t)digits[buf_p[i] >> 4];
+        dst_p[2 * i + 2] = (uint8_t)digits[buf_p[i] & 0xf];
+    }
+
+    dst_p[2 * size + 1] = '"';
+}
+
+static void jer_encoder_append_bit_string_buffer(struct jer_encoder_t *self_p,
+                                                 const uint8_t *buf_p,
+                                                 size_t number_of_bits)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    uint8_t *dst_p;
+    size_t size;
+    size_t i;
+    uint8_t value;
+
+    size = ((number_of_bits + 7) / 8);
+    dst_p = jer_encoder_alloc(self_p, 2 * size + 2);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    dst_p[0] = '"';
+
+    for (i = 0; i < size; i++) {
+        value = buf_p[i];
+
+        /* Unused bits in the last byte are zero. */
+        if ((8 * (i + 1)) > number_of_bits) {
+            value &= (uint8_t)(0xffu << (8 * (i + 1) - number_of_bits));
+        }
+
+        dst_p[2 * i + 1] = (uint8_t)digits[value >> 4];
+        dst_p[2 * i + 2] = (uint8_t)digits[value & 0xf];
+    }
+
+    dst_p[2 * size + 1] = '"';
+}
+
+static void jer_encoder_append_bit_string(struct jer_encoder_t *self_p,
+                                          uint64_t value,
+                                          size_t number_of_bits)
+{
+    uint8_t buf[8];
+    size_t i;
+
+    /* The value starts at the most significant bit. Unused bits in
+       the last byte are zero. */
+    if (number_of_bits < 64) {
+        value &= ~(UINT64_MAX >> number_of_bits);
+    }
+
+    for (i = 0; i < 8; i++) {
+        buf[i] = (uint8_t)(value >> (56 - 8 * i));
+    }
+
+    jer_encoder_append_hex(self_p, &buf[0], (number_of_bits + 7) / 8);
+}
+
+static void per_bit_strings_bit_strings_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_a_t *src_p)
+{
+    encoder_align(encoder_p);
+    encoder_append_bit_string(encoder_p,
+                              &src_p->buf[0],
+                              100);
+}
+
+static void per_bit_strings_bit_strings_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_bit_strings_bit_strings_a_t *dst_p)
+{
+    decoder_align(decoder_p);
+    decoder_read_bit_string(decoder_p,
+                            &dst_p->buf[0],
+                            100);
+}
+
+static void per_bit_strings_bit_strings_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 100u);
+}
+
+static void per_bit_strings_bit_strings_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_b_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        5);
+    encoder_align(encoder_p);
+    encoder_append_bit_string(encoder_p,
+                              &src_p->buf[0],
+                              src_p->length);
+}
+
+static void per_bit_strings_bit_strings_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_bit_strings_bit_strings_b_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        5);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 20u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    decoder_read_bit_string(decoder_p,
+                            &dst_p->buf[0],
+                            dst_p->length);
+}
+
+static void per_bit_strings_bit_strings_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        5);
+    length += 0u;
+
+    if (length > 20u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, length);
+}
+
+static void per_bit_strings_bit_strings_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_c_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           ((uint64_t)src_p->is_d_present << 1)
+                           | (uint64_t)src_p->a,
+                           2);
+    }
+
+    encoder_align(encoder_p);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->b.length - 1u,
+        16);
+    encoder_align(encoder_p);
+    encoder_append_bit_string(encoder_p,
+                              &src_p->b.buf[0],
+                              src_p->b.length);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->c),
+        12);
+
+    if (src_p->is_d_present) {
+        encoder_align(encoder_p);
+        encoder_append_bit_string(encoder_p,
+                                  &src_p->d.buf[0],
+                                  65);
+    }
+}
+
+static void per_bit_strings_bit_strings_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_bit_strings_bit_strings_c_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_d_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    decoder_align(decoder_p);
+    dst_p->b.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    dst_p->b.length += 1u;
+
+    if (dst_p->b.length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    decoder_read_bit_string(decoder_p,
+                            &dst_p->b.buf[0],
+                            dst_p->b.length);
+    dst_p->c = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        12);
+
+    if (dst_p->is_d_present) {
+        decoder_align(decoder_p);
+        decoder_read_bit_string(decoder_p,
+                                &dst_p->d.buf[0],
+                                65);
+    }
+}
+
+static void per_bit_strings_bit_strings_c_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_bit_strings_bit_strings_c_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+
+    dst_p->is_d_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_BIT_STRINGS_BIT_STRINGS_C_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_BIT_STRINGS_BIT_STRINGS_C_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        dst_p->b.length += 1u;
+
+        if (dst_p->b.length > 1000u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        decoder_read_bit_string(decoder_p,
+                                &dst_p->b.buf[0],
+                                dst_p->b.length);
+    } else {
+        decoder_align(decoder_p);
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        length += 1u;
+
+        if (length > 1000u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, length);
+    }
+    if ((fields & PER_BIT_STRINGS_BIT_STRINGS_C_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            12);
+    } else {
+        (void)decoder_free(decoder_p, 12u);
+    }
+
+    if (dst_p->is_d_present) {
+        if ((fields & PER_BIT_STRINGS_BIT_STRINGS_C_FIELD_D) != 0u) {
+            decoder_align(decoder_p);
+            decoder_read_bit_string(decoder_p,
+                                    &dst_p->d.buf[0],
+                                    65);
+        } else {
+            decoder_align(decoder_p);
+            (void)decoder_free(decoder_p, 65u);
+        }
+    }
+}
+
+static void per_bit_strings_bit_strings_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    uint32_t length;
+
+    is_present = decoder_read_bool(decoder_p);
+    (void)decoder_free(decoder_p, 1u);
+    decoder_align(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        16);
+    length += 1u;
+
+    if (length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, length);
+    (void)decoder_free(decoder_p, 12u);
+    if (is_present) {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 65u);
+    }
+}
+
+static void per_bit_strings_bit_strings_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_d_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        3);
+
+    for (i = 0; i < src_p->length; i++) {
+        per_bit_strings_bit_strings_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void per_bit_strings_bit_strings_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_bit_strings_bit_strings_d_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        per_bit_strings_bit_strings_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void per_bit_strings_bit_strings_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    length += 0u;
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        per_bit_strings_bit_strings_b_skip_inner(decoder_p);
+    }
+}
+
+ssize_t per_bit_strings_bit_strings_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_a_encoded_size(
+    const struct per_bit_strings_bit_strings_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_bit_strings_bit_strings_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_a_decode(
+    struct per_bit_strings_bit_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_bit_strings_bit_strings_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_a_decode_batch(
+    struct per_bit_strings_bit_strings_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_bit_strings_bit_strings_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_b_encoded_size(
+    const struct per_bit_strings_bit_strings_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_bit_strings_bit_strings_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_b_decode(
+    struct per_bit_strings_bit_strings_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_bit_strings_bit_strings_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_b_decode_batch(
+    struct per_bit_strings_bit_strings_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_bit_strings_bit_strings_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_c_encoded_size(
+    const struct per_bit_strings_bit_strings_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_bit_strings_bit_strings_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_c_decode(
+    struct per_bit_strings_bit_strings_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_bit_strings_bit_strings_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_c_decode_batch(
+    struct per_bit_strings_bit_strings_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_bit_strings_bit_strings_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_c_decode_fields(
+    struct per_bit_strings_bit_strings_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_c_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_d_encoded_size(
+    const struct per_bit_strings_bit_strings_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_bit_strings_bit_strings_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_d_decode(
+    struct per_bit_strings_bit_strings_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_bit_strings_bit_strings_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_bit_strings_bit_strings_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_bit_strings_bit_strings_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_bit_strings_bit_strings_d_decode_batch(
+    struct per_bit_strings_bit_strings_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_bit_strings_bit_strings_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+static void per_bit_strings_bit_strings_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_a_t *src_p)
+{
+    jer_encoder_append_bit_string_buffer(encoder_p,
+                                         &src_p->buf[0],
+                                         100u);
+}
+
+static void per_bit_strings_bit_strings_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_b_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"value\":", 9);
+    jer_encoder_append_bit_string_buffer(encoder_p,
+                                         &src_p->buf[0],
+                                         src_p->length);
+    jer_encoder_append_string(encoder_p, ",\"length\":", 10);
+    jer_encoder_append_uint(encoder_p, (uint64_t)src_p->length);
+    jer_encoder_append_char(encoder_p, '}');
+}
+
+static void per_bit_strings_bit_strings_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_c_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_bool(encoder_p, src_p->a);
+    jer_encoder_append_string(encoder_p, ",\"b\":{\"value\":", 14);
+    jer_encoder_append_bit_string_buffer(encoder_p,
+                                         &src_p->b.buf[0],
+                                         src_p->b.length);
+    jer_encoder_append_string(encoder_p, ",\"length\":", 10);
+    jer_encoder_append_uint(encoder_p, (uint64_t)src_p->b.length);
+    jer_encoder_append_string(encoder_p, "},\"c\":", 6);
+    jer_encoder_append_bit_string(encoder_p, (uint64_t)src_p->c << 52, 12);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_d_present) {
+        jer_encoder_append_string(encoder_p, "\"d\":", 4);
+        jer_encoder_append_bit_string_buffer(encoder_p,
+                                             &src_p->d.buf[0],
+                                             65u);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void per_bit_strings_bit_strings_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_bit_strings_bit_strings_d_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_char(encoder_p, '[');
+
+    for (i = 0; i < src_p->length; i++) {
+        per_bit_strings_bit_strings_b_encode_jer_inner(encoder_p, &src_p->elements[i]);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+}
+
+ssize_t per_bit_strings_bit_strings_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_bit_strings_bit_strings_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_bit_strings_bit_strings_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_bit_strings_bit_strings_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
@@ -0,0 +1,2181 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:22 2026.
+ */
+
+#include <string.h>
+
+#include "per_recursive.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+    int remaining_depth;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    struct per_recursive_arena_t *arena_p;
+    int remaining_depth;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+    self_p->remaining_depth = PER_RECURSIVE_MAX_RECURSION_DEPTH;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static bool encoder_enter(struct encoder_t *self_p, const void *value_p)
+{
+    if (value_p == NULL) {
+        encoder_abort(self_p, EINVAL);
+
+        return (false);
+    }
+
+    if (self_p->remaining_depth == 0) {
+        encoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}
+
+static void encoder_leave(struct encoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->remaining_depth = PER_RECURSIVE_MAX_RECURSION_DEPTH;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static void *decoder_arena_alloc(struct decoder_t *self_p, size_t size)
+{
+    size_t pos;
+
+    /* Keep all allocations aligned for any member type. */
+    pos = ((self_p->arena_p->pos + 7u) & ~(size_t)7u);
+
+    if ((pos > self_p->arena_p->size)
+        || (size > (self_p->arena_p->size - pos))) {
+        decoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    self_p->arena_p->pos = (pos + size);
+
+    return (&self_p->arena_p->buf[pos]);
+}
+
+static bool decoder_enter(struct decoder_t *self_p)
+{
+    if (self_p->remaining_depth == 0) {
+        decoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}
+
+static void decoder_leave(struct decoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static ALWAYS_INLINE void encoder_align(struct encoder_t *self_p)
+{
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static ALWAYS_INLINE void decoder_align(struct decoder_t *self_p)
+{
+    (void)decoder_free(self_p, (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    int remaining_depth;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+    self_p->remaining_depth = PER_RECURSIVE_MAX_RECURSION_DEPTH;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static bool jer_encoder_enter(struct jer_encoder_t *self_p,
+                              const void *value_p)
+{
+    if (value_p == NULL) {
+        jer_encoder_abort(self_p, EINVAL);
+
+        return (false);
+    }
+
+    if (self_p->remaining_depth == 0) {
+        jer_encoder_abort(self_p, EBADDEPTH);
+
+        return (false);
+    }
+
+    self_p->remaining_depth--;
+
+    return (true);
+}
+
+static void jer_encoder_leave(struct jer_encoder_t *self_p)
+{
+    self_p->remaining_depth++;
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_uint(struct jer_encoder_t *self_p,
+                                    uint64_t value)
+{
+    static const char digits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    uint8_t *buf_p;
+    uint64_t power;
+    size_t number_of_digits;
+    size_t i;
+
+    number_of_digits = 1;
+    power = 10;
+
+    while ((number_of_digits < 20) && (value >= power)) {
+        number_of_digits++;
+        power *= 10;
+    }
+
+    buf_p = jer_encoder_alloc(self_p, number_of_digits);
+
+    if (buf_p == NULL) {
+        return;
+    }
+
+    /* Two digits at a time from the end. */
+    i = number_of_digits;
+
+    while (value >= 100) {
+        i -= 2;
+        (void)memcpy(&buf_p[i], &digits[2 * (value % 100)], 2);
+        value /= 100;
+    }
+
+    if (value >= 10) {
+        (void)memcpy(&buf_p[0], &digits[2 * value], 2);
+    } else {
+        buf_p[0] = (uint8_t)('0' + value);
+    }
+}
+
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}
+
+static void jer_encoder_append_hex(struct jer_encoder_t *self_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    uint8_t *dst_p;
+    size_t i;
+
+    dst_p = jer_encoder_alloc(self_p, 2 * size + 2);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    dst_p[0] = '"';
+
+    for (i = 0; i < size; i++) {
+        dst_p[2 * i + 1] = (uint8_t)digits[buf_p[i] >> 4];
+        dst_p[2 * i + 2] = (uint8_t)digits[buf_p[i] & 0xf];
+    }
+
+    dst_p[2 * size + 1] = '"';
+}
+
+static void per_recursive_recursive_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_a_t *src_p);
+
+static void per_recursive_recursive_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_a_t *dst_p);
+
+static void per_recursive_recursive_a_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void per_recursive_recursive_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_b_t *src_p);
+
+static void per_recursive_recursive_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_b_t *dst_p);
+
+static void per_recursive_recursive_b_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void per_recursive_recursive_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_c_t *src_p);
+
+static void per_recursive_recursive_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_c_t *dst_p);
+
+static void per_recursive_recursive_c_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void per_recursive_recursive_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_d_t *src_p);
+
+static void per_recursive_recursive_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_d_t *dst_p);
+
+static void per_recursive_recursive_d_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void per_recursive_recursive_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_e_t *src_p);
+
+static void per_recursive_recursive_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_e_t *dst_p);
+
+static void per_recursive_recursive_e_skip_inner(
+    struct decoder_t *decoder_p);
+
+static void per_recursive_recursive_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_a_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->is_b_present);
+    encoder_align(encoder_p);
+    encoder_append_uint8(encoder_p, src_p->a);
+
+    if (src_p->is_b_present) {
+        if (encoder_enter(encoder_p, src_p->b)) {
+            per_recursive_recursive_a_encode_inner(encoder_p, src_p->b);
+            encoder_leave(encoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_a_t *dst_p)
+{
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    dst_p->a = decoder_read_uint8(decoder_p);
+
+    if (dst_p->is_b_present) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->b = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->b));
+
+            if (dst_p->b != NULL) {
+                per_recursive_recursive_a_decode_inner(decoder_p, dst_p->b);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_a_t *dst_p,
+    uint64_t fields)
+{
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_RECURSIVE_RECURSIVE_A_FIELD_A) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->a = decoder_read_uint8(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & PER_RECURSIVE_RECURSIVE_A_FIELD_B) != 0u) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->b = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->b));
+
+                if (dst_p->b != NULL) {
+                    per_recursive_recursive_a_decode_inner(decoder_p, dst_p->b);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        } else {
+            if (decoder_enter(decoder_p)) {
+                per_recursive_recursive_a_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+}
+
+static void per_recursive_recursive_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+
+    is_present = decoder_read_bool(decoder_p);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+    if (is_present) {
+        if (decoder_enter(decoder_p)) {
+            per_recursive_recursive_a_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_b_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_bool(encoder_p, src_p->a);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->b.length - 0u,
+        3);
+
+    for (i = 0; i < src_p->b.length; i++) {
+        if (encoder_enter(encoder_p, src_p->b.elements[i])) {
+            per_recursive_recursive_b_encode_inner(encoder_p, src_p->b.elements[i]);
+            encoder_leave(encoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_b_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->a = decoder_read_bool(decoder_p);
+    dst_p->b.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    dst_p->b.length += 0u;
+
+    if (dst_p->b.length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->b.length; i++) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->b.elements[i] = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->b.elements[i]));
+
+            if (dst_p->b.elements[i] != NULL) {
+                per_recursive_recursive_b_decode_inner(decoder_p, dst_p->b.elements[i]);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_b_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t i;
+    uint32_t length;
+    uint32_t i_2;
+
+    if ((fields & PER_RECURSIVE_RECURSIVE_B_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & PER_RECURSIVE_RECURSIVE_B_FIELD_B) != 0u) {
+        dst_p->b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            3);
+        dst_p->b.length += 0u;
+
+        if (dst_p->b.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i = 0; i < dst_p->b.length; i++) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->b.elements[i] = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->b.elements[i]));
+
+                if (dst_p->b.elements[i] != NULL) {
+                    per_recursive_recursive_b_decode_inner(decoder_p, dst_p->b.elements[i]);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        }
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            3);
+        length += 0u;
+
+        if (length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_2 = 0; i_2 < length; i_2++) {
+            if (decoder_enter(decoder_p)) {
+                per_recursive_recursive_b_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+}
+
+static void per_recursive_recursive_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    (void)decoder_free(decoder_p, 1u);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    length += 0u;
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        if (decoder_enter(decoder_p)) {
+            per_recursive_recursive_b_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_c_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_recursive_recursive_c_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+        encoder_align(encoder_p);
+        encoder_append_uint8(encoder_p, src_p->value.a);
+        break;
+
+    case per_recursive_recursive_c_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+
+        if (encoder_enter(encoder_p, src_p->value.b.a)) {
+            per_recursive_recursive_c_encode_inner(encoder_p, src_p->value.b.a);
+            encoder_leave(encoder_p);
+        }
+
+        if (encoder_enter(encoder_p, src_p->value.b.b)) {
+            per_recursive_recursive_c_encode_inner(encoder_p, src_p->value.b.b);
+            encoder_leave(encoder_p);
+        }
+
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_recursive_recursive_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_c_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = per_recursive_recursive_c_choice_a_e;
+        decoder_align(decoder_p);
+        dst_p->value.a = decoder_read_uint8(decoder_p);
+        break;
+
+    case 1:
+        dst_p->choice = per_recursive_recursive_c_choice_b_e;
+
+        if (decoder_enter(decoder_p)) {
+            dst_p->value.b.a = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->value.b.a));
+
+            if (dst_p->value.b.a != NULL) {
+                per_recursive_recursive_c_decode_inner(decoder_p, dst_p->value.b.a);
+            }
+
+            decoder_leave(decoder_p);
+        }
+
+        if (decoder_enter(decoder_p)) {
+            dst_p->value.b.b = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->value.b.b));
+
+            if (dst_p->value.b.b != NULL) {
+                per_recursive_recursive_c_decode_inner(decoder_p, dst_p->value.b.b);
+            }
+
+            decoder_leave(decoder_p);
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_recursive_recursive_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+        break;
+
+    case 1:
+        if (decoder_enter(decoder_p)) {
+            per_recursive_recursive_c_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+
+        if (decoder_enter(decoder_p)) {
+            per_recursive_recursive_c_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_recursive_recursive_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_d_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->is_b_present);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->a.length - 0u,
+        4);
+    encoder_align(encoder_p);
+    encoder_append_bytes(encoder_p,
+                         &src_p->a.buf[0],
+                         src_p->a.length);
+
+    if (src_p->is_b_present) {
+        if (encoder_enter(encoder_p, src_p->b)) {
+            per_recursive_recursive_e_encode_inner(encoder_p, src_p->b);
+            encoder_leave(encoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_d_t *dst_p)
+{
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    dst_p->a.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->a.length += 0u;
+
+    if (dst_p->a.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    decoder_read_bytes(decoder_p,
+                       &dst_p->a.buf[0],
+                       dst_p->a.length);
+
+    if (dst_p->is_b_present) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->b = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->b));
+
+            if (dst_p->b != NULL) {
+                per_recursive_recursive_e_decode_inner(decoder_p, dst_p->b);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_d_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_d_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_RECURSIVE_RECURSIVE_D_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->a.length += 0u;
+
+        if (dst_p->a.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length += 0u;
+
+        if (length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u * length);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & PER_RECURSIVE_RECURSIVE_D_FIELD_B) != 0u) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->b = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->b));
+
+                if (dst_p->b != NULL) {
+                    per_recursive_recursive_e_decode_inner(decoder_p, dst_p->b);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        } else {
+            if (decoder_enter(decoder_p)) {
+                per_recursive_recursive_e_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+}
+
+static void per_recursive_recursive_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    uint32_t length;
+
+    is_present = decoder_read_bool(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length += 0u;
+
+    if (length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u * length);
+    if (is_present) {
+        if (decoder_enter(decoder_p)) {
+            per_recursive_recursive_e_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+}
+
+static void per_recursive_recursive_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_recursive_recursive_e_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->is_a_present);
+
+    if (src_p->is_a_present) {
+        if (encoder_enter(encoder_p, src_p->a)) {
+            per_recursive_recursive_d_encode_inner(encoder_p, src_p->a);
+            encoder_leave(encoder_p);
+        }
+    }
+
+    encoder_align(encoder_p);
+    encoder_append_uint8(encoder_p, src_p->b);
+}
+
+static void per_recursive_recursive_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_e_t *dst_p)
+{
+    dst_p->is_a_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_present) {
+        if (decoder_enter(decoder_p)) {
+            dst_p->a = decoder_arena_alloc(
+                decoder_p,
+                sizeof(*dst_p->a));
+
+            if (dst_p->a != NULL) {
+                per_recursive_recursive_d_decode_inner(decoder_p, dst_p->a);
+            }
+
+            decoder_leave(decoder_p);
+        }
+    }
+
+    decoder_align(decoder_p);
+    dst_p->b = decoder_read_uint8(decoder_p);
+}
+
+static void per_recursive_recursive_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_recursive_recursive_e_t *dst_p,
+    uint64_t fields)
+{
+    dst_p->is_a_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_present) {
+        if ((fields & PER_RECURSIVE_RECURSIVE_E_FIELD_A) != 0u) {
+            if (decoder_enter(decoder_p)) {
+                dst_p->a = decoder_arena_alloc(
+                    decoder_p,
+                    sizeof(*dst_p->a));
+
+                if (dst_p->a != NULL) {
+                    per_recursive_recursive_d_decode_inner(decoder_p, dst_p->a);
+                }
+
+                decoder_leave(decoder_p);
+            }
+        } else {
+            if (decoder_enter(decoder_p)) {
+                per_recursive_recursive_d_skip_inner(decoder_p);
+                decoder_leave(decoder_p);
+            }
+        }
+    }
+
+    if ((fields & PER_RECURSIVE_RECURSIVE_E_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        dst_p->b = decoder_read_uint8(decoder_p);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 8u);
+    }
+}
+
+static void per_recursive_recursive_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+
+    is_present = decoder_read_bool(decoder_p);
+    if (is_present) {
+        if (decoder_enter(decoder_p)) {
+            per_recursive_recursive_d_skip_inner(decoder_p);
+            decoder_leave(decoder_p);
+        }
+    }
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 8u);
+}
+
+ssize_t per_recursive_recursive_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_a_encoded_size(
+    const struct per_recursive_recursive_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_recursive_recursive_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_a_decode(
+    struct per_recursive_recursive_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_recursive_recursive_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_recursive_recursive_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_a_decode_batch(
+    struct per_recursive_recursive_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        per_recursive_recursive_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_a_decode_fields(
+    struct per_recursive_recursive_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_b_encoded_size(
+    const struct per_recursive_recursive_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_recursive_recursive_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_b_decode(
+    struct per_recursive_recursive_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_recursive_recursive_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_recursive_recursive_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_b_decode_batch(
+    struct per_recursive_recursive_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        per_recursive_recursive_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_b_decode_fields(
+    struct per_recursive_recursive_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_c_encoded_size(
+    const struct per_recursive_recursive_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_recursive_recursive_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_c_decode(
+    struct per_recursive_recursive_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_recursive_recursive_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_recursive_recursive_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_c_decode_batch(
+    struct per_recursive_recursive_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        per_recursive_recursive_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_d_encoded_size(
+    const struct per_recursive_recursive_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_recursive_recursive_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_d_decode(
+    struct per_recursive_recursive_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_recursive_recursive_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_recursive_recursive_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_d_decode_batch(
+    struct per_recursive_recursive_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        per_recursive_recursive_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_d_decode_fields(
+    struct per_recursive_recursive_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_d_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_e_encoded_size(
+    const struct per_recursive_recursive_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_recursive_recursive_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_e_decode(
+    struct per_recursive_recursive_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_recursive_recursive_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_recursive_recursive_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_recursive_recursive_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_e_decode_batch(
+    struct per_recursive_recursive_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        per_recursive_recursive_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_recursive_recursive_e_decode_fields(
+    struct per_recursive_recursive_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct per_recursive_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    per_recursive_recursive_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+static void per_recursive_recursive_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_a_t *src_p);
+
+static void per_recursive_recursive_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_b_t *src_p);
+
+static void per_recursive_recursive_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_c_t *src_p);
+
+static void per_recursive_recursive_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_d_t *src_p);
+
+static void per_recursive_recursive_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_e_t *src_p);
+
+static void per_recursive_recursive_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_a_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_uint(encoder_p, (uint64_t)src_p->a);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+
+        if (jer_encoder_enter(encoder_p, src_p->b)) {
+            per_recursive_recursive_a_encode_jer_inner(encoder_p, src_p->b);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void per_recursive_recursive_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_b_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_bool(encoder_p, src_p->a);
+    jer_encoder_append_string(encoder_p, ",\"b\":[", 6);
+
+    for (i = 0; i < src_p->b.length; i++) {
+        if (jer_encoder_enter(encoder_p, src_p->b.elements[i])) {
+            per_recursive_recursive_b_encode_jer_inner(encoder_p, src_p->b.elements[i]);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void per_recursive_recursive_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_c_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_recursive_recursive_c_choice_a_e:
+        jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+        jer_encoder_append_uint(encoder_p, (uint64_t)src_p->value.a);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    case per_recursive_recursive_c_choice_b_e:
+        jer_encoder_append_string(encoder_p, "{\"b\":{\"a\":", 10);
+
+        if (jer_encoder_enter(encoder_p, src_p->value.b.a)) {
+            per_recursive_recursive_c_encode_jer_inner(encoder_p, src_p->value.b.a);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_string(encoder_p, ",\"b\":", 5);
+
+        if (jer_encoder_enter(encoder_p, src_p->value.b.b)) {
+            per_recursive_recursive_c_encode_jer_inner(encoder_p, src_p->value.b.b);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+        jer_encoder_close(encoder_p, '}');
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    default:
+        jer_encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_recursive_recursive_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_d_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_hex(encoder_p, src_p->a.buf, src_p->a.length);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+
+        if (jer_encoder_enter(encoder_p, src_p->b)) {
+            per_recursive_recursive_e_encode_jer_inner(encoder_p, src_p->b);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void per_recursive_recursive_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_recursive_recursive_e_t *src_p)
+{
+    jer_encoder_append_char(encoder_p, '{');
+
+    if (src_p->is_a_present) {
+        jer_encoder_append_string(encoder_p, "\"a\":", 4);
+
+        if (jer_encoder_enter(encoder_p, src_p->a)) {
+            per_recursive_recursive_d_encode_jer_inner(encoder_p, src_p->a);
+            jer_encoder_leave(encoder_p);
+        }
+
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_append_string(encoder_p, "\"b\":", 4);
+    jer_encoder_append_uint(encoder_p, (uint64_t)src_p->b);
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+ssize_t per_recursive_recursive_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_recursive_recursive_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_recursive_recursive_e_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_recursive_recursive_e_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
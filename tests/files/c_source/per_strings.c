@@ -0,0 +1,2703 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:17 2026.
+ */
+
+#include <string.h>
+
+#include "per_strings.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void encoder_append_string(struct encoder_t *self_p,
+                                  const char *buf_p,
+                                  size_t length,
+                                  const uint8_t *encode_map_p,
+                                  size_t number_of_bits)
+{
+    ssize_t pos;
+    size_t i;
+    size_t j;
+    size_t chunk_length;
+    uint64_t chunk;
+    uint8_t value;
+    uint8_t values;
+
+    pos = encoder_alloc(self_p, number_of_bits * length);
+
+    /* Characters are validated also when only calculating the size. */
+    if ((pos < 0) && !self_p->size_only) {
+        return;
+    }
+
+    if (number_of_bits > 0) {
+        chunk_length = (56u / number_of_bits);
+    } else {
+        chunk_length = length;
+    }
+
+    /* Pack up to 56 bits of characters per write. All valid indexes
+       are below 0x80, so one test per chunk finds invalid
+       characters. */
+    i = 0;
+
+    while (i < length) {
+        chunk = 0;
+        values = 0;
+
+        for (j = 0; (j < chunk_length) && (i < length); j++) {
+            value = encode_map_p[(uint8_t)buf_p[i]];
+            values |= value;
+            chunk = ((chunk << number_of_bits) | value);
+            i++;
+        }
+
+        if ((values & 0x80) != 0) {
+            encoder_abort(self_p, EBADCHAR);
+
+            return;
+        }
+
+        if (pos >= 0) {
+            encoder_write_bits(self_p, chunk, number_of_bits * j);
+        }
+    }
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static void decoder_skip_string(struct decoder_t *self_p,
+                                size_t length,
+                                const uint8_t *decode_map_p,
+                                size_t number_of_bits)
+{
+    size_t i;
+    size_t j;
+    size_t chunk_length;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t chunk;
+    uint8_t values;
+
+    pos = decoder_free(self_p, number_of_bits * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+    chunk_length = (56u / number_of_bits);
+
+    for (i = 0; i < length; i += chunk_length) {
+        if (chunk_length > (length - i)) {
+            chunk_length = (length - i);
+        }
+
+        chunk = decoder_read_bits(self_p,
+                                  bit_pos,
+                                  number_of_bits * chunk_length);
+        bit_pos += (number_of_bits * chunk_length);
+        values = 0;
+
+        for (j = 0; j < chunk_length; j++) {
+            values |= decode_map_p[chunk & ((1u << number_of_bits) - 1u)];
+            chunk >>= number_of_bits;
+        }
+
+        if ((values & 0x80) != 0) {
+            decoder_abort(self_p, EBADCHAR);
+
+            return;
+        }
+    }
+}
+
+static void decoder_read_string(struct decoder_t *self_p,
+                                char *buf_p,
+                                size_t length,
+                                const uint8_t *decode_map_p,
+                                size_t number_of_bits)
+{
+    size_t i;
+    size_t j;
+    size_t chunk_length;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t chunk;
+    uint8_t value;
+    uint8_t values;
+
+    buf_p[length] = '\0';
+    pos = decoder_free(self_p, number_of_bits * length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    if (number_of_bits == 0) {
+        (void)memset(buf_p, decode_map_p[0], length);
+
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+    chunk_length = (56u / number_of_bits);
+
+    /* Unpack up to 56 bits of characters per window load. */
+    for (i = 0; i < length; i += chunk_length) {
+        if (chunk_length > (length - i)) {
+            chunk_length = (length - i);
+        }
+
+        chunk = decoder_read_bits(self_p,
+                                  bit_pos,
+                                  number_of_bits * chunk_length);
+        bit_pos += (number_of_bits * chunk_length);
+        values = 0;
+
+        for (j = chunk_length; j > 0; j--) {
+            value = decode_map_p[chunk & ((1u << number_of_bits) - 1u)];
+            values |= value;
+            buf_p[i + j - 1] = (char)value;
+            chunk >>= number_of_bits;
+        }
+
+        if ((values & 0x80) != 0) {
+            decoder_abort(self_p, EBADCHAR);
+
+            return;
+        }
+    }
+}
+
+static ALWAYS_INLINE void encoder_align(struct encoder_t *self_p)
+{
+    encoder_append_non_negative_binary_integer(
+        self_p,
+        0,
+        (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static ALWAYS_INLINE void decoder_align(struct decoder_t *self_p)
+{
+    (void)decoder_free(self_p, (size_t)((8 - (self_p->pos & 7)) & 7));
+}
+
+static const uint8_t ia5_string_encode_map[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t ia5_string_decode_map[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t numeric_string_encode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t numeric_string_decode_map[16] = {
+    0x20, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t printable_string_encode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x27, 0x28, 0x29, 0xff, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0xff,
+    0xff, 0x3d, 0xff, 0x3f, 0xff, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t printable_string_decode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x27, 0x28, 0x29, 0xff, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0xff,
+    0xff, 0x3d, 0xff, 0x3f, 0xff, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t visible_string_encode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t visible_string_decode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t per_strings_strings_a_e_encode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t per_strings_strings_a_e_decode_map[16] = {
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66
+};
+
+static const uint8_t per_strings_strings_a_f_encode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t per_strings_strings_a_f_decode_map[4] = {
+    0x41, 0x43, 0x47, 0x54
+};
+
+static const uint8_t per_strings_strings_e_encode_map[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff
+};
+
+static const uint8_t per_strings_strings_e_decode_map[1] = {
+    0x78
+};
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_quoted_string(struct jer_encoder_t *self_p,
+                                             const char *buf_p,
+                                             size_t size)
+{
+    /* Short escapes of control characters, or 'u' for \u00XX. */
+    static const char escapes[] = "uuuuuuuubtnufruuuuuuuuuuuuuuuuuu";
+    static const char digits[] = "0123456789abcdef";
+    uint8_t *dst_p;
+    size_t length;
+    size_t i;
+    uint8_t value;
+
+    length = size + 2;
+
+    for (i = 0; i < size; i++) {
+        value = (uint8_t)buf_p[i];
+
+        if ((value == '"') || (value == '\\')) {
+            length++;
+        } else if ((value < 0x20) && (escapes[value] != 'u')) {
+            length++;
+        } else if ((value < 0x20) || (value >= 0x7f)) {
+            length += 5;
+        }
+    }
+
+    dst_p = jer_encoder_alloc(self_p, length);
+
+    if (dst_p == NULL) {
+        return;
+    }
+
+    *dst_p++ = '"';
+
+    for (i = 0; i < size; i++) {
+        value = (uint8_t)buf_p[i];
+
+        if ((value == '"') || (value == '\\')) {
+            *dst_p++ = '\\';
+            *dst_p++ = value;
+        } else if ((value < 0x20) && (escapes[value] != 'u')) {
+            *dst_p++ = '\\';
+            *dst_p++ = (uint8_t)escapes[value];
+        } else if ((value < 0x20) || (value >= 0x7f)) {
+            *dst_p++ = '\\';
+            *dst_p++ = 'u';
+            *dst_p++ = '0';
+            *dst_p++ = '0';
+            *dst_p++ = (uint8_t)digits[value >> 4];
+            *dst_p++ = (uint8_t)digits[value & 0xf];
+        } else {
+            *dst_p++ = value;
+        }
+    }
+
+    *dst_p = '"';
+}
+
+static void per_strings_strings_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_strings_strings_a_t *src_p)
+{
+    static const char h_default[] = "abc";
+
+    encoder_append_bool(encoder_p, src_p->is_g_present);
+    encoder_append_bool(encoder_p, (src_p->h.length != 3u) || (memcmp(&src_p->h.buf[0], h_default, 3u) != 0));
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->a.length - 1u,
+        4);
+
+    if (src_p->a.length > 0) {
+        encoder_align(encoder_p);
+    }
+
+    encoder_append_string(encoder_p,
+                          &src_p->a.buf[0],
+                          src_p->a.length,
+                          &ia5_string_encode_map[0],
+                          8);
+    encoder_align(encoder_p);
+    encoder_append_string(encoder_p,
+                          &src_p->b.buf[0],
+                          5u,
+                          &numeric_string_encode_map[0],
+                          4);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->c.length - 0u,
+        5);
+
+    if (src_p->c.length > 0) {
+        encoder_align(encoder_p);
+    }
+
+    encoder_append_string(encoder_p,
+                          &src_p->c.buf[0],
+                          src_p->c.length,
+                          &printable_string_encode_map[0],
+                          8);
+    encoder_append_string(encoder_p,
+                          &src_p->d.buf[0],
+                          2u,
+                          &visible_string_encode_map[0],
+                          8);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->e.length - 0u,
+        4);
+
+    if (src_p->e.length > 0) {
+        encoder_align(encoder_p);
+    }
+
+    encoder_append_string(encoder_p,
+                          &src_p->e.buf[0],
+                          src_p->e.length,
+                          &per_strings_strings_a_e_encode_map[0],
+                          4);
+    encoder_align(encoder_p);
+    encoder_append_string(encoder_p,
+                          &src_p->f.buf[0],
+                          12u,
+                          &per_strings_strings_a_f_encode_map[0],
+                          2);
+
+    if (src_p->is_g_present) {
+        encoder_align(encoder_p);
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->g.length - 0u,
+            16);
+
+        if (src_p->g.length > 0) {
+            encoder_align(encoder_p);
+        }
+
+        encoder_append_string(encoder_p,
+                              &src_p->g.buf[0],
+                              src_p->g.length,
+                              &visible_string_encode_map[0],
+                              8);
+    }
+
+    if ((src_p->h.length != 3u) || (memcmp(&src_p->h.buf[0], h_default, 3u) != 0)) {
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->h.length - 1u,
+            2);
+
+        if (src_p->h.length > 0) {
+            encoder_align(encoder_p);
+        }
+
+        encoder_append_string(encoder_p,
+                              &src_p->h.buf[0],
+                              src_p->h.length,
+                              &printable_string_encode_map[0],
+                              8);
+    }
+}
+
+static void per_strings_strings_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_a_t *dst_p)
+{
+    bool is_present;
+    static const char h_default[] = "abc";
+
+    dst_p->is_g_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+    dst_p->a.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->a.length += 1u;
+
+    if (dst_p->a.length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (dst_p->a.length > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_read_string(decoder_p,
+                        &dst_p->a.buf[0],
+                        dst_p->a.length,
+                        &ia5_string_decode_map[0],
+                        8);
+    decoder_align(decoder_p);
+    decoder_read_string(decoder_p,
+                        &dst_p->b.buf[0],
+                        5u,
+                        &numeric_string_decode_map[0],
+                        4);
+    dst_p->c.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        5);
+    dst_p->c.length += 0u;
+
+    if (dst_p->c.length > 16u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (dst_p->c.length > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_read_string(decoder_p,
+                        &dst_p->c.buf[0],
+                        dst_p->c.length,
+                        &printable_string_decode_map[0],
+                        8);
+    decoder_read_string(decoder_p,
+                        &dst_p->d.buf[0],
+                        2u,
+                        &visible_string_decode_map[0],
+                        8);
+    dst_p->e.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->e.length += 0u;
+
+    if (dst_p->e.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (dst_p->e.length > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_read_string(decoder_p,
+                        &dst_p->e.buf[0],
+                        dst_p->e.length,
+                        &per_strings_strings_a_e_decode_map[0],
+                        4);
+    decoder_align(decoder_p);
+    decoder_read_string(decoder_p,
+                        &dst_p->f.buf[0],
+                        12u,
+                        &per_strings_strings_a_f_decode_map[0],
+                        2);
+
+    if (dst_p->is_g_present) {
+        decoder_align(decoder_p);
+        dst_p->g.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        dst_p->g.length += 0u;
+
+        if (dst_p->g.length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (dst_p->g.length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_read_string(decoder_p,
+                            &dst_p->g.buf[0],
+                            dst_p->g.length,
+                            &visible_string_decode_map[0],
+                            8);
+    }
+
+    if (is_present) {
+        dst_p->h.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            2);
+        dst_p->h.length += 1u;
+
+        if (dst_p->h.length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_read_string(decoder_p,
+                            &dst_p->h.buf[0],
+                            dst_p->h.length,
+                            &printable_string_decode_map[0],
+                            8);
+    } else {
+        (void)memcpy(&dst_p->h.buf[0], h_default, sizeof(h_default));
+        dst_p->h.length = 3u;
+    }
+}
+
+static void per_strings_strings_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_a_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    uint32_t length_4;
+    uint32_t length_5;
+    static const char h_default[] = "abc";
+
+    dst_p->is_g_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+    if ((fields & PER_STRINGS_STRINGS_A_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->a.length += 1u;
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (dst_p->a.length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_read_string(decoder_p,
+                            &dst_p->a.buf[0],
+                            dst_p->a.length,
+                            &ia5_string_decode_map[0],
+                            8);
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length += 1u;
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_skip_string(decoder_p,
+                            length,
+                            &ia5_string_decode_map[0],
+                            8);
+    }
+    if ((fields & PER_STRINGS_STRINGS_A_FIELD_B) != 0u) {
+        decoder_align(decoder_p);
+        decoder_read_string(decoder_p,
+                            &dst_p->b.buf[0],
+                            5u,
+                            &numeric_string_decode_map[0],
+                            4);
+    } else {
+        decoder_align(decoder_p);
+        decoder_skip_string(decoder_p,
+                            5u,
+                            &numeric_string_decode_map[0],
+                            4);
+    }
+    if ((fields & PER_STRINGS_STRINGS_A_FIELD_C) != 0u) {
+        dst_p->c.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            5);
+        dst_p->c.length += 0u;
+
+        if (dst_p->c.length > 16u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (dst_p->c.length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_read_string(decoder_p,
+                            &dst_p->c.buf[0],
+                            dst_p->c.length,
+                            &printable_string_decode_map[0],
+                            8);
+    } else {
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            5);
+        length_2 += 0u;
+
+        if (length_2 > 16u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (length_2 > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_skip_string(decoder_p,
+                            length_2,
+                            &printable_string_decode_map[0],
+                            8);
+    }
+    if ((fields & PER_STRINGS_STRINGS_A_FIELD_D) != 0u) {
+        decoder_read_string(decoder_p,
+                            &dst_p->d.buf[0],
+                            2u,
+                            &visible_string_decode_map[0],
+                            8);
+    } else {
+        decoder_skip_string(decoder_p,
+                            2u,
+                            &visible_string_decode_map[0],
+                            8);
+    }
+    if ((fields & PER_STRINGS_STRINGS_A_FIELD_E) != 0u) {
+        dst_p->e.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->e.length += 0u;
+
+        if (dst_p->e.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (dst_p->e.length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_read_string(decoder_p,
+                            &dst_p->e.buf[0],
+                            dst_p->e.length,
+                            &per_strings_strings_a_e_decode_map[0],
+                            4);
+    } else {
+        length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_3 += 0u;
+
+        if (length_3 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (length_3 > 0) {
+            decoder_align(decoder_p);
+        }
+
+        (void)decoder_free(decoder_p, 4u * length_3);
+    }
+    if ((fields & PER_STRINGS_STRINGS_A_FIELD_F) != 0u) {
+        decoder_align(decoder_p);
+        decoder_read_string(decoder_p,
+                            &dst_p->f.buf[0],
+                            12u,
+                            &per_strings_strings_a_f_decode_map[0],
+                            2);
+    } else {
+        decoder_align(decoder_p);
+        (void)decoder_free(decoder_p, 2u * 12u);
+    }
+
+    if (dst_p->is_g_present) {
+        if ((fields & PER_STRINGS_STRINGS_A_FIELD_G) != 0u) {
+            decoder_align(decoder_p);
+            dst_p->g.length = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                16);
+            dst_p->g.length += 0u;
+
+            if (dst_p->g.length > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            if (dst_p->g.length > 0) {
+                decoder_align(decoder_p);
+            }
+
+            decoder_read_string(decoder_p,
+                                &dst_p->g.buf[0],
+                                dst_p->g.length,
+                                &visible_string_decode_map[0],
+                                8);
+        } else {
+            decoder_align(decoder_p);
+            length_4 = (uint32_t)decoder_read_non_negative_binary_integer(
+                decoder_p,
+                16);
+            length_4 += 0u;
+
+            if (length_4 > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            if (length_4 > 0) {
+                decoder_align(decoder_p);
+            }
+
+            decoder_skip_string(decoder_p,
+                                length_4,
+                                &visible_string_decode_map[0],
+                                8);
+        }
+    }
+
+    if (is_present) {
+        if ((fields & PER_STRINGS_STRINGS_A_FIELD_H) != 0u) {
+            dst_p->h.length = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                2);
+            dst_p->h.length += 1u;
+
+            if (dst_p->h.length > 0) {
+                decoder_align(decoder_p);
+            }
+
+            decoder_read_string(decoder_p,
+                                &dst_p->h.buf[0],
+                                dst_p->h.length,
+                                &printable_string_decode_map[0],
+                                8);
+        } else {
+            length_5 = (uint32_t)decoder_read_non_negative_binary_integer(
+                decoder_p,
+                2);
+            length_5 += 1u;
+
+            if (length_5 > 0) {
+                decoder_align(decoder_p);
+            }
+
+            decoder_skip_string(decoder_p,
+                                length_5,
+                                &printable_string_decode_map[0],
+                                8);
+        }
+    } else {
+        (void)memcpy(&dst_p->h.buf[0], h_default, sizeof(h_default));
+        dst_p->h.length = 3u;
+    }
+}
+
+static void per_strings_strings_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    uint32_t length_4;
+    uint32_t length_5;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length += 1u;
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (length > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_skip_string(decoder_p,
+                        length,
+                        &ia5_string_decode_map[0],
+                        8);
+    decoder_align(decoder_p);
+    decoder_skip_string(decoder_p,
+                        5u,
+                        &numeric_string_decode_map[0],
+                        4);
+    length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        5);
+    length_2 += 0u;
+
+    if (length_2 > 16u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (length_2 > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_skip_string(decoder_p,
+                        length_2,
+                        &printable_string_decode_map[0],
+                        8);
+    decoder_skip_string(decoder_p,
+                        2u,
+                        &visible_string_decode_map[0],
+                        8);
+    length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_3 += 0u;
+
+    if (length_3 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (length_3 > 0) {
+        decoder_align(decoder_p);
+    }
+
+    (void)decoder_free(decoder_p, 4u * length_3);
+    decoder_align(decoder_p);
+    (void)decoder_free(decoder_p, 2u * 12u);
+    if (is_present) {
+        decoder_align(decoder_p);
+        length_4 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            16);
+        length_4 += 0u;
+
+        if (length_4 > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (length_4 > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_skip_string(decoder_p,
+                            length_4,
+                            &visible_string_decode_map[0],
+                            8);
+    }
+    if (is_present_2) {
+        length_5 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            2);
+        length_5 += 1u;
+
+        if (length_5 > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_skip_string(decoder_p,
+                            length_5,
+                            &printable_string_decode_map[0],
+                            8);
+    }
+}
+
+static void per_strings_strings_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_strings_strings_b_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 4u,
+        2);
+
+    if (src_p->length > 0) {
+        encoder_align(encoder_p);
+    }
+
+    encoder_append_string(encoder_p,
+                          &src_p->buf[0],
+                          src_p->length,
+                          &ia5_string_encode_map[0],
+                          8);
+}
+
+static void per_strings_strings_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_b_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->length += 4u;
+
+    if (dst_p->length > 6u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (dst_p->length > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_read_string(decoder_p,
+                        &dst_p->buf[0],
+                        dst_p->length,
+                        &ia5_string_decode_map[0],
+                        8);
+}
+
+static void per_strings_strings_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    length += 4u;
+
+    if (length > 6u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    if (length > 0) {
+        decoder_align(decoder_p);
+    }
+
+    decoder_skip_string(decoder_p,
+                        length,
+                        &ia5_string_decode_map[0],
+                        8);
+}
+
+static void per_strings_strings_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_strings_strings_c_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        2);
+
+    for (i = 0; i < src_p->length; i++) {
+        per_strings_strings_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void per_strings_strings_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_c_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->length += 0u;
+
+    for (i = 0; i < dst_p->length; i++) {
+        per_strings_strings_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void per_strings_strings_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    length += 0u;
+
+    for (i = 0; i < length; i++) {
+        per_strings_strings_b_skip_inner(decoder_p);
+    }
+}
+
+static void per_strings_strings_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_strings_strings_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_strings_strings_d_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->value.a.length - 1u,
+            2);
+
+        if (src_p->value.a.length > 0) {
+            encoder_align(encoder_p);
+        }
+
+        encoder_append_string(encoder_p,
+                              &src_p->value.a.buf[0],
+                              src_p->value.a.length,
+                              &numeric_string_encode_map[0],
+                              4);
+        break;
+
+    case per_strings_strings_d_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+        per_strings_strings_b_encode_inner(encoder_p, &src_p->value.b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_strings_strings_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_d_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = per_strings_strings_d_choice_a_e;
+        dst_p->value.a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            2);
+        dst_p->value.a.length += 1u;
+
+        if (dst_p->value.a.length > 3u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (dst_p->value.a.length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_read_string(decoder_p,
+                            &dst_p->value.a.buf[0],
+                            dst_p->value.a.length,
+                            &numeric_string_decode_map[0],
+                            4);
+        break;
+
+    case 1:
+        dst_p->choice = per_strings_strings_d_choice_b_e;
+        per_strings_strings_b_decode_inner(decoder_p, &dst_p->value.b);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_strings_strings_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+    uint32_t length;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            2);
+        length += 1u;
+
+        if (length > 3u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        if (length > 0) {
+            decoder_align(decoder_p);
+        }
+
+        decoder_skip_string(decoder_p,
+                            length,
+                            &numeric_string_decode_map[0],
+                            4);
+        break;
+
+    case 1:
+        per_strings_strings_b_skip_inner(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_strings_strings_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_strings_strings_e_t *src_p)
+{
+    encoder_append_string(encoder_p,
+                          &src_p->buf[0],
+                          3u,
+                          &per_strings_strings_e_encode_map[0],
+                          0);
+}
+
+static void per_strings_strings_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_e_t *dst_p)
+{
+    decoder_read_string(decoder_p,
+                        &dst_p->buf[0],
+                        3u,
+                        &per_strings_strings_e_decode_map[0],
+                        0);
+}
+
+static void per_strings_strings_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
+static void per_strings_strings_f_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct per_strings_strings_f_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        1);
+    encoder_append_string(encoder_p,
+                          &src_p->buf[0],
+                          src_p->length,
+                          &numeric_string_encode_map[0],
+                          4);
+}
+
+static void per_strings_strings_f_decode_inner(
+    struct decoder_t *decoder_p,
+    struct per_strings_strings_f_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->length += 0u;
+
+    decoder_read_string(decoder_p,
+                        &dst_p->buf[0],
+                        dst_p->length,
+                        &numeric_string_decode_map[0],
+                        4);
+}
+
+static void per_strings_strings_f_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    length += 0u;
+
+    decoder_skip_string(decoder_p,
+                        length,
+                        &numeric_string_decode_map[0],
+                        4);
+}
+
+ssize_t per_strings_strings_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_strings_strings_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_a_encoded_size(
+    const struct per_strings_strings_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_strings_strings_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_a_decode(
+    struct per_strings_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_strings_strings_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_a_decode_batch(
+    struct per_strings_strings_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_strings_strings_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_a_decode_fields(
+    struct per_strings_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_strings_strings_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_b_encoded_size(
+    const struct per_strings_strings_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_strings_strings_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_b_decode(
+    struct per_strings_strings_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_strings_strings_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_b_decode_batch(
+    struct per_strings_strings_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_strings_strings_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_strings_strings_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_c_encoded_size(
+    const struct per_strings_strings_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_strings_strings_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_c_decode(
+    struct per_strings_strings_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_strings_strings_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_c_decode_batch(
+    struct per_strings_strings_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_strings_strings_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_strings_strings_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_d_encoded_size(
+    const struct per_strings_strings_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_strings_strings_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_d_decode(
+    struct per_strings_strings_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_strings_strings_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_d_decode_batch(
+    struct per_strings_strings_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_strings_strings_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_strings_strings_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_e_encoded_size(
+    const struct per_strings_strings_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_strings_strings_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_e_decode(
+    struct per_strings_strings_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_strings_strings_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_e_decode_batch(
+    struct per_strings_strings_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_strings_strings_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    per_strings_strings_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_f_encoded_size(
+    const struct per_strings_strings_f_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    per_strings_strings_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_f_decode(
+    struct per_strings_strings_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_f_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_f_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    per_strings_strings_f_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t per_strings_strings_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_f_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        per_strings_strings_f_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t per_strings_strings_f_decode_batch(
+    struct per_strings_strings_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        per_strings_strings_f_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+static void per_strings_strings_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_strings_strings_a_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->a.buf[0],
+                                     src_p->a.length);
+    jer_encoder_append_string(encoder_p, ",\"b\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->b.buf[0],
+                                     5u);
+    jer_encoder_append_string(encoder_p, ",\"c\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->c.buf[0],
+                                     src_p->c.length);
+    jer_encoder_append_string(encoder_p, ",\"d\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->d.buf[0],
+                                     2u);
+    jer_encoder_append_string(encoder_p, ",\"e\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->e.buf[0],
+                                     src_p->e.length);
+    jer_encoder_append_string(encoder_p, ",\"f\":", 5);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->f.buf[0],
+                                     12u);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_g_present) {
+        jer_encoder_append_string(encoder_p, "\"g\":", 4);
+        jer_encoder_append_quoted_string(encoder_p,
+                                         &src_p->g.buf[0],
+                                         src_p->g.length);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_append_string(encoder_p, "\"h\":", 4);
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->h.buf[0],
+                                     src_p->h.length);
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void per_strings_strings_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_strings_strings_b_t *src_p)
+{
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->buf[0],
+                                     src_p->length);
+}
+
+static void per_strings_strings_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_strings_strings_c_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_char(encoder_p, '[');
+
+    for (i = 0; i < src_p->length; i++) {
+        per_strings_strings_b_encode_jer_inner(encoder_p, &src_p->elements[i]);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+}
+
+static void per_strings_strings_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_strings_strings_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case per_strings_strings_d_choice_a_e:
+        jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+        jer_encoder_append_quoted_string(encoder_p,
+                                         &src_p->value.a.buf[0],
+                                         src_p->value.a.length);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    case per_strings_strings_d_choice_b_e:
+        jer_encoder_append_string(encoder_p, "{\"b\":", 5);
+        per_strings_strings_b_encode_jer_inner(encoder_p, &src_p->value.b);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    default:
+        jer_encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void per_strings_strings_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_strings_strings_e_t *src_p)
+{
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->buf[0],
+                                     3u);
+}
+
+static void per_strings_strings_f_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct per_strings_strings_f_t *src_p)
+{
+    jer_encoder_append_quoted_string(encoder_p,
+                                     &src_p->buf[0],
+                                     src_p->length);
+}
+
+ssize_t per_strings_strings_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_strings_strings_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_strings_strings_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_strings_strings_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_strings_strings_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_e_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_strings_strings_e_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t per_strings_strings_f_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_f_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    per_strings_strings_f_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
@@ -0,0 +1,862 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:36:19 2026.
+ */
+
+#ifndef PER_STRINGS_H
+#define PER_STRINGS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Type A in module Strings.
+ */
+struct per_strings_strings_a_t {
+    struct {
+        uint8_t length;
+        char buf[11];
+    } a;
+    struct {
+        char buf[6];
+    } b;
+    struct {
+        uint8_t length;
+        char buf[17];
+    } c;
+    struct {
+        char buf[3];
+    } d;
+    struct {
+        uint8_t length;
+        char buf[9];
+    } e;
+    struct {
+        char buf[13];
+    } f;
+    bool is_g_present;
+    struct {
+        uint32_t length;
+        char buf[301];
+    } g;
+    struct {
+        uint8_t length;
+        char buf[5];
+    } h;
+};
+
+/**
+ * Type B in module Strings.
+ */
+struct per_strings_strings_b_t {
+    uint8_t length;
+    char buf[7];
+};
+
+/**
+ * Type C in module Strings.
+ */
+struct per_strings_strings_c_t {
+    uint8_t length;
+    struct per_strings_strings_b_t elements[3];
+};
+
+/**
+ * Type D in module Strings.
+ */
+enum per_strings_strings_d_choice_e {
+    per_strings_strings_d_choice_a_e,
+    per_strings_strings_d_choice_b_e
+};
+
+struct per_strings_strings_d_t {
+    enum per_strings_strings_d_choice_e choice;
+    union {
+        struct {
+            uint8_t length;
+            char buf[4];
+        } a;
+        struct per_strings_strings_b_t b;
+    } value;
+};
+
+/**
+ * Type E in module Strings.
+ */
+struct per_strings_strings_e_t {
+    char buf[4];
+};
+
+/**
+ * Type F in module Strings.
+ */
+struct per_strings_strings_f_t {
+    uint8_t length;
+    char buf[2];
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Strings, in bytes.
+ */
+#define PER_STRINGS_STRINGS_A_MAX_ENCODED_SIZE 353u
+
+/**
+ * Encode type A defined in module Strings.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Strings, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_a_encoded_size(
+    const struct per_strings_strings_a_t *src_p);
+
+/**
+ * Decode type A defined in module Strings.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_a_decode(
+    struct per_strings_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Strings, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Strings after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Strings encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_a_decode_batch(
+    struct per_strings_strings_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type A defined in module Strings, to decode
+ * with per_strings_strings_a_decode_fields().
+ */
+#define PER_STRINGS_STRINGS_A_FIELD_A (1ull << 0)
+#define PER_STRINGS_STRINGS_A_FIELD_B (1ull << 1)
+#define PER_STRINGS_STRINGS_A_FIELD_C (1ull << 2)
+#define PER_STRINGS_STRINGS_A_FIELD_D (1ull << 3)
+#define PER_STRINGS_STRINGS_A_FIELD_E (1ull << 4)
+#define PER_STRINGS_STRINGS_A_FIELD_F (1ull << 5)
+#define PER_STRINGS_STRINGS_A_FIELD_G (1ull << 6)
+#define PER_STRINGS_STRINGS_A_FIELD_H (1ull << 7)
+
+/**
+ * Decode given fields of type A defined in module
+ * Strings. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_a_decode_fields(
+    struct per_strings_strings_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type A defined in module Strings as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_a_t *src_p);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Strings, in bytes.
+ */
+#define PER_STRINGS_STRINGS_B_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type B defined in module Strings.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Strings, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_b_encoded_size(
+    const struct per_strings_strings_b_t *src_p);
+
+/**
+ * Decode type B defined in module Strings.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_b_decode(
+    struct per_strings_strings_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Strings, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Strings after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Strings encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_b_decode_batch(
+    struct per_strings_strings_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type B defined in module Strings as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_b_t *src_p);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * Strings, in bytes.
+ */
+#define PER_STRINGS_STRINGS_C_MAX_ENCODED_SIZE 22u
+
+/**
+ * Encode type C defined in module Strings.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * Strings, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_c_encoded_size(
+    const struct per_strings_strings_c_t *src_p);
+
+/**
+ * Decode type C defined in module Strings.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_c_decode(
+    struct per_strings_strings_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module Strings, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * Strings after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * Strings encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_c_decode_batch(
+    struct per_strings_strings_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type C defined in module Strings as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_c_t *src_p);
+
+/**
+ * Maximum encoded size of type D defined in module
+ * Strings, in bytes.
+ */
+#define PER_STRINGS_STRINGS_D_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type D defined in module Strings.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_d_t *src_p);
+
+/**
+ * Calculate the encoded size of type D defined in module
+ * Strings, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_d_encoded_size(
+    const struct per_strings_strings_d_t *src_p);
+
+/**
+ * Decode type D defined in module Strings.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_d_decode(
+    struct per_strings_strings_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type D defined in
+ * module Strings, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * Strings after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type D defined in module
+ * Strings encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_d_decode_batch(
+    struct per_strings_strings_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type D defined in module Strings as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_d_t *src_p);
+
+/**
+ * Maximum encoded size of type E defined in module
+ * Strings, in bytes.
+ */
+#define PER_STRINGS_STRINGS_E_MAX_ENCODED_SIZE 0u
+
+/**
+ * Encode type E defined in module Strings.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_e_t *src_p);
+
+/**
+ * Calculate the encoded size of type E defined in module
+ * Strings, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_e_encoded_size(
+    const struct per_strings_strings_e_t *src_p);
+
+/**
+ * Decode type E defined in module Strings.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_e_decode(
+    struct per_strings_strings_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type E defined in
+ * module Strings, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_e_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type E defined in module
+ * Strings after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_e_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type E defined in module
+ * Strings encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_e_decode_batch(
+    struct per_strings_strings_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type E defined in module Strings as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_e_t *src_p);
+
+/**
+ * Maximum encoded size of type F defined in module
+ * Strings, in bytes.
+ */
+#define PER_STRINGS_STRINGS_F_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type F defined in module Strings.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_f_t *src_p);
+
+/**
+ * Calculate the encoded size of type F defined in module
+ * Strings, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_f_encoded_size(
+    const struct per_strings_strings_f_t *src_p);
+
+/**
+ * Decode type F defined in module Strings.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_f_decode(
+    struct per_strings_strings_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type F defined in
+ * module Strings, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_f_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type F defined in module
+ * Strings after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_f_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type F defined in module
+ * Strings encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t per_strings_strings_f_decode_batch(
+    struct per_strings_strings_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type F defined in module Strings as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t per_strings_strings_f_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct per_strings_strings_f_t *src_p);
+
+#endif
@@ -25,7 +25,7 @@
  */
 
 /**
- * This file was generated by asn1tools version 0.162.0 Thu May  5 07:13:05 2022.
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:10 2026.
  */
 
 #include <string.h>
@@ -36,6 +36,10 @@ struct encoder_t {
     uint8_t *buf_p;
     ssize_t size;
     ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
 };
 
 struct decoder_t {
@@ -44,6 +48,41 @@ struct decoder_t {
     ssize_t pos;
 };
 
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
 static void encoder_init(struct encoder_t *self_p,
                          uint8_t *buf_p,
                          size_t size)
@@ -51,11 +90,23 @@ static void encoder_init(struct encoder_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = (8 * (ssize_t)size);
     self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
 }
 
-static ssize_t encoder_get_result(const struct encoder_t *self_p)
+static ssize_t encoder_get_result(struct encoder_t *self_p)
 {
+    size_t i;
+
     if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
         return ((self_p->pos + 7) / 8);
     } else {
         return (self_p->pos);
@@ -71,14 +122,18 @@ static void encoder_abort(struct encoder_t *self_p,
     }
 }
 
-static ssize_t encoder_alloc(struct encoder_t *self_p,
-                             size_t size)
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
 {
     ssize_t pos;
 
     if ((self_p->pos + (ssize_t)size) <= self_p->size) {
         pos = self_p->pos;
         self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
     } else {
         pos = -ENOMEM;
         encoder_abort(self_p, ENOMEM);
@@ -87,123 +142,117 @@ static ssize_t encoder_alloc(struct encoder_t *self_p,
     return (pos);
 }
 
-static void encoder_append_bit(struct encoder_t *self_p,
-                               int value)
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
 {
-    ssize_t pos;
+    size_t number_of_bits;
 
-    pos = encoder_alloc(self_p, 1);
-
-    if (pos < 0) {
+    if (size == 0) {
         return;
     }
 
-    if ((pos % 8) == 0) {
-        self_p->buf_p[pos / 8] = 0;
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
     }
 
-    self_p->buf_p[pos / 8] |= (uint8_t)(value << (7 - (pos % 8)));
+    self_p->number_of_bits = number_of_bits;
 }
 
-static void encoder_append_bytes(struct encoder_t *self_p,
-                                 const uint8_t *buf_p,
-                                 size_t size)
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
 {
     size_t i;
-    ssize_t pos;
-    size_t byte_pos;
-    size_t pos_in_byte;
-
-    pos = encoder_alloc(self_p, 8u * size);
 
-    if (pos < 0) {
-        return;
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
     }
 
-    byte_pos = ((size_t)pos / 8u);
-    pos_in_byte = ((size_t)pos % 8u);
-
-    if (pos_in_byte == 0u) {
-        (void)memcpy(&self_p->buf_p[byte_pos], buf_p, size);
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
     } else {
-        for (i = 0; i < size; i++) {
-            self_p->buf_p[byte_pos + i] |= (buf_p[i] >> pos_in_byte);
-            self_p->buf_p[byte_pos + i + 1] = (buf_p[i] << (8u - pos_in_byte));
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
         }
-    }
-}
-
-static void encoder_append_uint8(struct encoder_t *self_p,
-                                 uint8_t value)
-{
-    uint8_t buf[1];
 
-    buf[0] = (uint8_t)value;
-
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
 }
 
-static void encoder_append_uint16(struct encoder_t *self_p,
-                                  uint16_t value)
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
 {
-    uint8_t buf[2];
-
-    buf[0] = (uint8_t)(value >> 8);
-    buf[1] = (uint8_t)value;
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
 
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_write_bytes(self_p, buf_p, size);
 }
 
-static void encoder_append_uint32(struct encoder_t *self_p,
-                                  uint32_t value)
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
 {
-    uint8_t buf[4];
-
-    buf[0] = (uint8_t)(value >> 24);
-    buf[1] = (uint8_t)(value >> 16);
-    buf[2] = (uint8_t)(value >> 8);
-    buf[3] = (uint8_t)value;
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
 
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_write_bits(self_p, value, size);
 }
 
-static void encoder_append_uint64(struct encoder_t *self_p,
-                                  uint64_t value)
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
 {
-    uint8_t buf[8];
-
-    buf[0] = (uint8_t)(value >> 56);
-    buf[1] = (uint8_t)(value >> 48);
-    buf[2] = (uint8_t)(value >> 40);
-    buf[3] = (uint8_t)(value >> 32);
-    buf[4] = (uint8_t)(value >> 24);
-    buf[5] = (uint8_t)(value >> 16);
-    buf[6] = (uint8_t)(value >> 8);
-    buf[7] = (uint8_t)value;
-
-    encoder_append_bytes(self_p, &buf[0], sizeof(buf));
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
 }
 
-static void encoder_append_int8(struct encoder_t *self_p,
-                                int8_t value)
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
 {
-    encoder_append_uint8(self_p, (uint8_t)value + 128);
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
 }
 
-static void encoder_append_int16(struct encoder_t *self_p,
-                                 int16_t value)
+static ALWAYS_INLINE void encoder_append_uint64(struct encoder_t *self_p,
+                                                uint64_t value)
 {
-    encoder_append_uint16(self_p, (uint16_t)value + 32768);
+    encoder_append_non_negative_binary_integer(self_p, value, 64);
 }
 
-static void encoder_append_int32(struct encoder_t *self_p,
-                                 int32_t value)
+static ALWAYS_INLINE void encoder_append_int8(struct encoder_t *self_p,
+                                              int8_t value)
 {
-    encoder_append_uint32(self_p, (uint32_t)value + 2147483648);
+    encoder_append_uint8(self_p, (uint8_t)value + 128);
 }
 
-static void encoder_append_int64(struct encoder_t *self_p,
-                                 int64_t value)
+static ALWAYS_INLINE void encoder_append_int64(struct encoder_t *self_p,
+                                               int64_t value)
 {
     uint64_t u64_value;
 
@@ -213,22 +262,11 @@ static void encoder_append_int64(struct encoder_t *self_p,
     encoder_append_uint64(self_p, u64_value);
 }
 
-static void encoder_append_bool(struct encoder_t *self_p, bool value)
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
 {
     encoder_append_bit(self_p, value ? 1 : 0);
 }
 
-static void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
-                                                       uint64_t value,
-                                                       size_t size)
-{
-    size_t i;
-
-    for (i = 0; i < size; i++) {
-        encoder_append_bit(self_p, (value >> (size - i - 1)) & 1);
-    }
-}
-
 static void decoder_init(struct decoder_t *self_p,
                          const uint8_t *buf_p,
                          size_t size)
@@ -256,8 +294,8 @@ static void decoder_abort(struct decoder_t *self_p,
     }
 }
 
-static ssize_t decoder_free(struct decoder_t *self_p,
-                            size_t size)
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
 {
     ssize_t pos;
 
@@ -272,7 +310,41 @@ static ssize_t decoder_free(struct decoder_t *self_p,
     return (pos);
 }
 
-static int decoder_read_bit(struct decoder_t *self_p)
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
 {
     ssize_t pos;
     int value;
@@ -280,7 +352,7 @@ static int decoder_read_bit(struct decoder_t *self_p)
     pos = decoder_free(self_p, 1);
 
     if (pos >= 0) {
-        value = ((self_p->buf_p[pos / 8] >> (7 - (pos % 8))) & 1);
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
     } else {
         value = 0;
     }
@@ -294,8 +366,8 @@ static void decoder_read_bytes(struct decoder_t *self_p,
 {
     size_t i;
     ssize_t pos;
-    size_t byte_pos;
-    size_t pos_in_byte;
+    size_t bit_pos;
+    uint64_t value;
 
     pos = decoder_free(self_p, 8u * size);
 
@@ -303,66 +375,77 @@ static void decoder_read_bytes(struct decoder_t *self_p,
         return;
     }
 
-    byte_pos = ((size_t)pos / 8u);
-    pos_in_byte = ((size_t)pos % 8u);
+    bit_pos = (size_t)pos;
 
-    if (pos_in_byte == 0) {
-        (void)memcpy(buf_p, &self_p->buf_p[byte_pos], size);
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
     } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
         for (i = 0; i < size; i++) {
-            buf_p[i] = (self_p->buf_p[byte_pos + i] << pos_in_byte);
-            buf_p[i] |= (self_p->buf_p[byte_pos + i + 1] >> (8u - pos_in_byte));
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
         }
     }
 }
 
-static uint8_t decoder_read_uint8(struct decoder_t *self_p)
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
 {
-    uint8_t value;
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
 
-    decoder_read_bytes(self_p, &value, sizeof(value));
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
 
     return (value);
 }
 
-static uint16_t decoder_read_uint16(struct decoder_t *self_p)
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
 {
-    uint8_t buf[2];
-
-    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
-
-    return (((uint16_t)buf[0] << 8) | (uint16_t)buf[1]);
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
 }
 
-static uint32_t decoder_read_uint32(struct decoder_t *self_p)
+static ALWAYS_INLINE uint16_t decoder_read_uint16(struct decoder_t *self_p)
 {
-    uint8_t buf[4];
-
-    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
-
-    return (((uint32_t)buf[0] << 24)
-            | ((uint32_t)buf[1] << 16)
-            | ((uint32_t)buf[2] << 8)
-            | (uint32_t)buf[3]);
+    return ((uint16_t)decoder_read_non_negative_binary_integer(self_p, 16));
 }
 
-static uint64_t decoder_read_uint64(struct decoder_t *self_p)
+static ALWAYS_INLINE uint32_t decoder_read_uint32(struct decoder_t *self_p)
 {
-    uint8_t buf[8];
-
-    decoder_read_bytes(self_p, &buf[0], sizeof(buf));
+    return ((uint32_t)decoder_read_non_negative_binary_integer(self_p, 32));
+}
 
-    return (((uint64_t)buf[0] << 56)
-            | ((uint64_t)buf[1] << 48)
-            | ((uint64_t)buf[2] << 40)
-            | ((uint64_t)buf[3] << 32)
-            | ((uint64_t)buf[4] << 24)
-            | ((uint64_t)buf[5] << 16)
-            | ((uint64_t)buf[6] << 8)
-            | (uint64_t)buf[7]);
+static ALWAYS_INLINE uint64_t decoder_read_uint64(struct decoder_t *self_p)
+{
+    return (decoder_read_non_negative_binary_integer(self_p, 64));
 }
 
-static int8_t decoder_read_int8(struct decoder_t *self_p)
+static ALWAYS_INLINE int8_t decoder_read_int8(struct decoder_t *self_p)
 {
     int8_t value;
 
@@ -372,7 +455,7 @@ static int8_t decoder_read_int8(struct decoder_t *self_p)
     return (value);
 }
 
-static int16_t decoder_read_int16(struct decoder_t *self_p)
+static ALWAYS_INLINE int16_t decoder_read_int16(struct decoder_t *self_p)
 {
     int16_t value;
 
@@ -382,7 +465,7 @@ static int16_t decoder_read_int16(struct decoder_t *self_p)
     return (value);
 }
 
-static int32_t decoder_read_int32(struct decoder_t *self_p)
+static ALWAYS_INLINE int32_t decoder_read_int32(struct decoder_t *self_p)
 {
     int32_t value;
 
@@ -392,7 +475,7 @@ static int32_t decoder_read_int32(struct decoder_t *self_p)
     return (value);
 }
 
-static int64_t decoder_read_int64(struct decoder_t *self_p)
+static ALWAYS_INLINE int64_t decoder_read_int64(struct decoder_t *self_p)
 {
     uint64_t value;
 
@@ -402,38 +485,33 @@ static int64_t decoder_read_int64(struct decoder_t *self_p)
     return ((int64_t)value);
 }
 
-static bool decoder_read_bool(struct decoder_t *self_p)
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
 {
     return (decoder_read_bit(self_p) != 0);
 }
 
-static uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
-                                                         size_t size)
-{
-    size_t i;
-    uint64_t value;
-
-    value = 0;
-
-    for (i = 0; i < size; i++) {
-        value <<= 1;
-        value |= (uint64_t)decoder_read_bit(self_p);
-    }
-
-    return (value);
-}
-
 static void uper_c_source_a_encode_inner(
     struct encoder_t *encoder_p,
     const struct uper_c_source_a_t *src_p)
 {
-    encoder_append_int8(encoder_p, src_p->a);
-    encoder_append_int16(encoder_p, src_p->b);
-    encoder_append_int32(encoder_p, src_p->c);
+    if (encoder_alloc(encoder_p, 56) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (((uint64_t)(src_p->a - -128) & 0xffu) << 48)
+                           | (((uint64_t)(src_p->b - -32768) & 0xffffu) << 32)
+                           | ((uint64_t)(src_p->c - -2147483648) & 0xffffffffu),
+                           56);
+    }
+
     encoder_append_int64(encoder_p, src_p->d);
-    encoder_append_uint8(encoder_p, src_p->e);
-    encoder_append_uint16(encoder_p, src_p->f);
-    encoder_append_uint32(encoder_p, src_p->g);
+
+    if (encoder_alloc(encoder_p, 56) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (((uint64_t)src_p->e & 0xffu) << 48)
+                           | (((uint64_t)src_p->f & 0xffffu) << 32)
+                           | ((uint64_t)src_p->g & 0xffffffffu),
+                           56);
+    }
+
     encoder_append_uint64(encoder_p, src_p->h);
     encoder_append_bool(encoder_p, src_p->i);
     encoder_append_bytes(encoder_p,
@@ -445,13 +523,37 @@ static void uper_c_source_a_decode_inner(
     struct decoder_t *decoder_p,
     struct uper_c_source_a_t *dst_p)
 {
-    dst_p->a = decoder_read_int8(decoder_p);
-    dst_p->b = decoder_read_int16(decoder_p);
-    dst_p->c = decoder_read_int32(decoder_p);
+    ssize_t pos;
+    uint64_t bits;
+    ssize_t pos_2;
+    uint64_t bits_2;
+
+    pos = decoder_free(decoder_p, 56);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 56);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->a = (int8_t)((int64_t)(bits >> 48) - 128);
+    dst_p->b = (int16_t)((int64_t)((bits >> 32) & 0xffffu) - 32768);
+    dst_p->c = (int32_t)((int64_t)(bits & 0xffffffffu) - 2147483648);
+
     dst_p->d = decoder_read_int64(decoder_p);
-    dst_p->e = decoder_read_uint8(decoder_p);
-    dst_p->f = decoder_read_uint16(decoder_p);
-    dst_p->g = decoder_read_uint32(decoder_p);
+
+    pos_2 = decoder_free(decoder_p, 56);
+
+    if (pos_2 >= 0) {
+        bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 56);
+    } else {
+        bits_2 = 0;
+    }
+
+    dst_p->e = (uint8_t)(bits_2 >> 48);
+    dst_p->f = (uint16_t)((bits_2 >> 32) & 0xffffu);
+    dst_p->g = (uint32_t)(bits_2 & 0xffffffffu);
+
     dst_p->h = decoder_read_uint64(decoder_p);
     dst_p->i = decoder_read_bool(decoder_p);
     decoder_read_bytes(decoder_p,
@@ -459,6 +561,71 @@ static void uper_c_source_a_decode_inner(
                        11);
 }
 
+static void uper_c_source_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_a_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_A_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_int8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_int16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 16u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_int32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 32u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_int64(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 64u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_F) != 0u) {
+        dst_p->f = decoder_read_uint16(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 16u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_G) != 0u) {
+        dst_p->g = decoder_read_uint32(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 32u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_H) != 0u) {
+        dst_p->h = decoder_read_uint64(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 64u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_I) != 0u) {
+        dst_p->i = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & UPER_C_SOURCE_A_FIELD_J) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           &dst_p->j.buf[0],
+                           11);
+    } else {
+        (void)decoder_free(decoder_p, 88u);
+    }
+}
+
+static void uper_c_source_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 329u);
+}
+
 static void uper_c_source_ab_encode_inner(
     struct encoder_t *encoder_p,
     const struct uper_c_source_ab_t *src_p)
@@ -487,6 +654,35 @@ static void uper_c_source_ab_decode_inner(
     dst_p->b += 10000;
 }
 
+static void uper_c_source_ab_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ab_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_AB_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->a += -1;
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & UPER_C_SOURCE_AB_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            10);
+        dst_p->b += 10000;
+    } else {
+        (void)decoder_free(decoder_p, 10u);
+    }
+}
+
+static void uper_c_source_ab_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 11u);
+}
+
 static void uper_c_source_q_encode_inner(
     struct encoder_t *encoder_p,
     const struct uper_c_source_q_t *src_p)
@@ -3085,90 +3281,1133 @@ static void uper_c_source_q_decode_inner(
     }
 }
 
-static void uper_c_source_d_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_d_t *src_p)
+static void uper_c_source_q_skip_inner(
+    struct decoder_t *decoder_p)
 {
-    uint8_t i;
-    uint8_t i_2;
-    uint16_t value;
-
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        src_p->length - 1u,
-        4);
+    uint16_t choice;
 
-    for (i = 0; i < src_p->length; i++) {
-        switch (src_p->elements[i].a.b.choice) {
+    choice = (uint16_t)decoder_read_non_negative_binary_integer(decoder_p, 9);
 
-        case uper_c_source_d_a_b_choice_c_e:
-            encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
-            encoder_append_non_negative_binary_integer(
-                encoder_p,
-                (uint64_t)(src_p->elements[i].a.b.value.c - 0),
-                1);
-            break;
+    switch (choice) {
 
-        case uper_c_source_d_a_b_choice_d_e:
-            encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
-            encoder_append_bool(encoder_p, src_p->elements[i].a.b.value.d);
-            break;
+    case 0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        default:
-            encoder_abort(encoder_p, EBADCHOICE);
-            break;
-        }
+    case 1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        encoder_append_non_negative_binary_integer(
-            encoder_p,
-            src_p->elements[i].a.e.length - 3u,
-            1);
+    case 2:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        for (i_2 = 0; i_2 < src_p->elements[i].a.e.length; i_2++) {
-        }
+    case 3:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        encoder_append_bool(encoder_p, src_p->elements[i].g.h != uper_c_source_d_g_h_j_e);
+    case 4:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].g.h != uper_c_source_d_g_h_j_e) {
-            switch (src_p->elements[i].g.h) {
-            case uper_c_source_d_g_h_i_e:
-                value = 0;
-                break;
-            case uper_c_source_d_g_h_j_e:
-                value = 1;
-                break;
-            case uper_c_source_d_g_h_k_e:
-                value = 2;
-                break;
-            default:
-                encoder_abort(encoder_p, EBADENUM);
-                return;
-            }
-            encoder_append_non_negative_binary_integer(encoder_p, value, 2);
-        }
+    case 5:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        encoder_append_non_negative_binary_integer(
-            encoder_p,
-            src_p->elements[i].g.l.length - 1u,
-            1);
-        encoder_append_bytes(encoder_p,
-                             &src_p->elements[i].g.l.buf[0],
-                             src_p->elements[i].g.l.length);
-        encoder_append_bool(encoder_p, src_p->elements[i].m.is_n_present);
-        encoder_append_bool(encoder_p, src_p->elements[i].m.o != 3);
-        encoder_append_bool(encoder_p, src_p->elements[i].m.is_p_present);
-        encoder_append_bool(encoder_p, src_p->elements[i].m.s != false);
+    case 6:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.is_n_present) {
-            encoder_append_bool(encoder_p, src_p->elements[i].m.n);
-        }
+    case 7:
+        (void)decoder_free(decoder_p, 1u);
+        break;
 
-        if (src_p->elements[i].m.o != 3) {
-            encoder_append_non_negative_binary_integer(
-                encoder_p,
-                (uint64_t)(src_p->elements[i].m.o - -2),
-                3);
-        }
+    case 8:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 9:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 10:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 11:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 12:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 13:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 14:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 15:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 16:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 17:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 18:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 19:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 20:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 21:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 22:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 23:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 24:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 25:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 26:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 27:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 28:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 29:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 30:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 31:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 32:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 33:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 34:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 35:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 36:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 37:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 38:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 39:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 40:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 41:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 42:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 43:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 44:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 45:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 46:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 47:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 48:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 49:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 50:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 51:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 52:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 53:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 54:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 55:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 56:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 57:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 58:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 59:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 60:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 61:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 62:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 63:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 64:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 65:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 66:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 67:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 68:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 69:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 70:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 71:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 72:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 73:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 74:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 75:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 76:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 77:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 78:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 79:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 80:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 81:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 82:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 83:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 84:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 85:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 86:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 87:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 88:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 89:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 90:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 91:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 92:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 93:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 94:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 95:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 96:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 97:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 98:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 99:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 100:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 101:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 102:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 103:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 104:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 105:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 106:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 107:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 108:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 109:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 110:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 111:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 112:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 113:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 114:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 115:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 116:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 117:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 118:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 119:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 120:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 121:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 122:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 123:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 124:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 125:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 126:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 127:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 128:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 129:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 130:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 131:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 132:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 133:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 134:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 135:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 136:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 137:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 138:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 139:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 140:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 141:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 142:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 143:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 144:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 145:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 146:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 147:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 148:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 149:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 150:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 151:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 152:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 153:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 154:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 155:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 156:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 157:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 158:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 159:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 160:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 161:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 162:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 163:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 164:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 165:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 166:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 167:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 168:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 169:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 170:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 171:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 172:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 173:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 174:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 175:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 176:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 177:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 178:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 179:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 180:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 181:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 182:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 183:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 184:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 185:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 186:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 187:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 188:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 189:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 190:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 191:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 192:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 193:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 194:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 195:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 196:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 197:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 198:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 199:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 200:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 201:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 202:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 203:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 204:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 205:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 206:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 207:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 208:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 209:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 210:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 211:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 212:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 213:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 214:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 215:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 216:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 217:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 218:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 219:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 220:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 221:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 222:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 223:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 224:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 225:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 226:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 227:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 228:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 229:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 230:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 231:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 232:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 233:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 234:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 235:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 236:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 237:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 238:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 239:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 240:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 241:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 242:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 243:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 244:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 245:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 246:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 247:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 248:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 249:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 250:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 251:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 252:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 253:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 254:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 255:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 256:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_d_t *src_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+    uint16_t value;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 1u,
+        4);
+
+    for (i = 0; i < src_p->length; i++) {
+        switch (src_p->elements[i].a.b.choice) {
+
+        case uper_c_source_d_a_b_choice_c_e:
+            encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+            encoder_append_non_negative_binary_integer(
+                encoder_p,
+                (uint64_t)(src_p->elements[i].a.b.value.c - 0),
+                1);
+            break;
+
+        case uper_c_source_d_a_b_choice_d_e:
+            encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+            encoder_append_bool(encoder_p, src_p->elements[i].a.b.value.d);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->elements[i].a.e.length - 3u,
+            1);
+
+        for (i_2 = 0; i_2 < src_p->elements[i].a.e.length; i_2++) {
+        }
+
+        encoder_append_bool(encoder_p, src_p->elements[i].g.h != uper_c_source_d_g_h_j_e);
+
+        if (src_p->elements[i].g.h != uper_c_source_d_g_h_j_e) {
+            switch (src_p->elements[i].g.h) {
+            case uper_c_source_d_g_h_i_e:
+                value = 0;
+                break;
+            case uper_c_source_d_g_h_j_e:
+                value = 1;
+                break;
+            case uper_c_source_d_g_h_k_e:
+                value = 2;
+                break;
+            default:
+                encoder_abort(encoder_p, EBADENUM);
+                return;
+            }
+            encoder_append_non_negative_binary_integer(encoder_p, value, 2);
+        }
+
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->elements[i].g.l.length - 1u,
+            1);
+        encoder_append_bytes(encoder_p,
+                             &src_p->elements[i].g.l.buf[0],
+                             src_p->elements[i].g.l.length);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.is_n_present);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.o != 3);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.is_p_present);
+        encoder_append_bool(encoder_p, src_p->elements[i].m.s != false);
+
+        if (src_p->elements[i].m.is_n_present) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.n);
+        }
+
+        if (src_p->elements[i].m.o != 3) {
+            encoder_append_non_negative_binary_integer(
+                encoder_p,
+                (uint64_t)(src_p->elements[i].m.o - -2),
+                3);
+        }
 
         if (src_p->elements[i].m.is_p_present) {
             encoder_append_bool(encoder_p, src_p->elements[i].m.p.is_r_present);
@@ -3176,2728 +4415,8320 @@ static void uper_c_source_d_encode_inner(
                                  &src_p->elements[i].m.p.q.buf[0],
                                  5);
 
-            if (src_p->elements[i].m.p.is_r_present) {
-                encoder_append_bool(encoder_p, src_p->elements[i].m.p.r);
-            }
-        }
+            if (src_p->elements[i].m.p.is_r_present) {
+                encoder_append_bool(encoder_p, src_p->elements[i].m.p.r);
+            }
+        }
+
+        if (src_p->elements[i].m.s != false) {
+            encoder_append_bool(encoder_p, src_p->elements[i].m.s);
+        }
+    }
+}
+
+static void uper_c_source_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_d_t *dst_p)
+{
+    uint8_t i;
+    uint8_t choice;
+    uint8_t i_2;
+    bool is_present;
+    uint16_t value;
+    bool is_present_2;
+    bool is_present_3;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->length += 1u;
+
+    if (dst_p->length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice) {
+
+        case 0:
+            dst_p->elements[i].a.b.choice = uper_c_source_d_a_b_choice_c_e;
+            dst_p->elements[i].a.b.value.c = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                1);
+            dst_p->elements[i].a.b.value.c += 0;
+            break;
+
+        case 1:
+            dst_p->elements[i].a.b.choice = uper_c_source_d_a_b_choice_d_e;
+            dst_p->elements[i].a.b.value.d = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        dst_p->elements[i].a.e.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->elements[i].a.e.length += 3u;
+
+        for (i_2 = 0; i_2 < dst_p->elements[i].a.e.length; i_2++) {
+        }
+
+        is_present = decoder_read_bool(decoder_p);
+
+        if (is_present) {
+            value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+            switch (value) {
+            case 0:
+                dst_p->elements[i].g.h = uper_c_source_d_g_h_i_e;
+                break;
+            case 1:
+                dst_p->elements[i].g.h = uper_c_source_d_g_h_j_e;
+                break;
+            case 2:
+                dst_p->elements[i].g.h = uper_c_source_d_g_h_k_e;
+                break;
+            default:
+                decoder_abort(decoder_p, EBADENUM);
+                return;
+            }
+        } else {
+            dst_p->elements[i].g.h = uper_c_source_d_g_h_j_e;
+        }
+
+        dst_p->elements[i].g.l.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->elements[i].g.l.length += 1u;
+        decoder_read_bytes(decoder_p,
+                           &dst_p->elements[i].g.l.buf[0],
+                           dst_p->elements[i].g.l.length);
+        dst_p->elements[i].m.is_n_present = decoder_read_bool(decoder_p);
+        is_present_2 = decoder_read_bool(decoder_p);
+        dst_p->elements[i].m.is_p_present = decoder_read_bool(decoder_p);
+        is_present_3 = decoder_read_bool(decoder_p);
+
+        if (dst_p->elements[i].m.is_n_present) {
+            dst_p->elements[i].m.n = decoder_read_bool(decoder_p);
+        }
+
+        if (is_present_2) {
+            dst_p->elements[i].m.o = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                3);
+            dst_p->elements[i].m.o += -2;
+        } else {
+            dst_p->elements[i].m.o = 3;
+        }
+
+        if (dst_p->elements[i].m.is_p_present) {
+            dst_p->elements[i].m.p.is_r_present = decoder_read_bool(decoder_p);
+            decoder_read_bytes(decoder_p,
+                               &dst_p->elements[i].m.p.q.buf[0],
+                               5);
+
+            if (dst_p->elements[i].m.p.is_r_present) {
+                dst_p->elements[i].m.p.r = decoder_read_bool(decoder_p);
+            }
+        }
+
+        if (is_present_3) {
+            dst_p->elements[i].m.s = decoder_read_bool(decoder_p);
+        } else {
+            dst_p->elements[i].m.s = false;
+        }
+    }
+}
+
+static void uper_c_source_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+    uint8_t choice;
+    uint32_t length_2;
+    bool is_present;
+    uint16_t value;
+    uint32_t length_3;
+    bool is_present_2;
+    bool is_present_3;
+    bool is_present_4;
+    bool is_present_5;
+    bool is_present_6;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length += 1u;
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice) {
+
+        case 0:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        case 1:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        length_2 += 3u;
+
+        is_present = decoder_read_bool(decoder_p);
+        if (is_present) {
+            value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+            if (value > 2u) {
+                decoder_abort(decoder_p, EBADENUM);
+            }
+        }
+        length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        length_3 += 1u;
+
+        (void)decoder_free(decoder_p, 8u * length_3);
+        is_present_2 = decoder_read_bool(decoder_p);
+        is_present_3 = decoder_read_bool(decoder_p);
+        is_present_4 = decoder_read_bool(decoder_p);
+        is_present_5 = decoder_read_bool(decoder_p);
+        if (is_present_2) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+        if (is_present_3) {
+            (void)decoder_free(decoder_p, 3u);
+        }
+        if (is_present_4) {
+            is_present_6 = decoder_read_bool(decoder_p);
+            (void)decoder_free(decoder_p, 40u);
+            if (is_present_6) {
+                (void)decoder_free(decoder_p, 1u);
+            }
+        }
+        if (is_present_5) {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+}
+
+static void uper_c_source_ac_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ac_t *src_p)
+{
+    uper_c_source_q_encode_inner(encoder_p, &src_p->a);
+    uper_c_source_d_encode_inner(encoder_p, &src_p->b);
+}
+
+static void uper_c_source_ac_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ac_t *dst_p)
+{
+    uper_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    uper_c_source_d_decode_inner(decoder_p, &dst_p->b);
+}
+
+static void uper_c_source_ac_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ac_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_AC_FIELD_A) != 0u) {
+        uper_c_source_q_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        uper_c_source_q_skip_inner(decoder_p);
+    }
+    if ((fields & UPER_C_SOURCE_AC_FIELD_B) != 0u) {
+        uper_c_source_d_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        uper_c_source_d_skip_inner(decoder_p);
+    }
+}
+
+static void uper_c_source_ac_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uper_c_source_q_skip_inner(decoder_p);
+    uper_c_source_d_skip_inner(decoder_p);
+}
+
+static void uper_c_source_ad_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ad_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->value;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 1);
+}
+
+static void uper_c_source_ad_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ad_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 1);
+    dst_p->value = (enum uper_c_source_ad_e)value;
+}
+
+static void uper_c_source_ad_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_source_ae_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ae_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->is_a_present,
+                           2);
+    }
+
+    encoder_append_bool(encoder_p, src_p->b != true);
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->b != true) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    encoder_append_bool(encoder_p, src_p->c);
+}
+
+static void uper_c_source_ae_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ae_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+    bool is_present;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits & 0x1u) != 0u);
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (is_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    } else {
+        dst_p->b = true;
+    }
+
+    dst_p->c = decoder_read_bool(decoder_p);
+}
+
+static void uper_c_source_ae_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ae_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t pos;
+    uint64_t bits;
+    bool is_present;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits & 0x1u) != 0u);
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_present) {
+        if ((fields & UPER_C_SOURCE_AE_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (is_present) {
+        if ((fields & UPER_C_SOURCE_AE_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->b = true;
+    }
+
+    if ((fields & UPER_C_SOURCE_AE_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void uper_c_source_ae_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    (void)decoder_free(decoder_p, 1u);
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_source_ah_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ah_t *src_p)
+{
+    if(src_p->is_d_addition_present || src_p->is_e_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->c,
+                           2);
+    }
+}
+
+static void uper_c_source_ah_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ah_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->c = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_c_source_ah_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ah_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_C_SOURCE_AH_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_c_source_ah_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_source_af_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_af_t *src_p)
+{
+    if(src_p->is_b_addition_present || src_p->is_e_addition_present || src_p->is_f_addition_present ||
+       src_p->is_g_addition_present || src_p->is_h_addition_present || src_p->is_i_addition_present ||
+       src_p->is_j_addition_present || src_p->is_k_addition_present || src_p->is_l_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->a,
+                           2);
+    }
+}
+
+static void uper_c_source_af_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_af_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_c_source_af_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_af_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_C_SOURCE_AF_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_c_source_af_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_source_ag_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ag_t *src_p)
+{
+    if(src_p->is_b_addition_present || src_p->is_c_addition_present || src_p->is_d_addition_present ||
+       src_p->is_h_addition_present || src_p->is_i_addition_present || src_p->is_j_addition_present ||
+       src_p->is_m_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->a,
+                           2);
+    }
+}
+
+static void uper_c_source_ag_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ag_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_c_source_ag_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ag_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_C_SOURCE_AG_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_c_source_ag_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_source_aj_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_aj_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->a;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 1);
+}
+
+static void uper_c_source_aj_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_aj_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 1);
+    dst_p->a = (enum uper_c_source_aj_a_e)value;
+}
+
+static void uper_c_source_aj_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_aj_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t value;
+
+    if ((fields & UPER_C_SOURCE_AJ_FIELD_A) != 0u) {
+        value = decoder_read_non_negative_binary_integer(decoder_p, 1);
+        dst_p->a = (enum uper_c_source_aj_a_e)value;
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void uper_c_source_aj_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_source_ak_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ak_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case uper_c_source_ak_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+        uper_c_source_aj_encode_inner(encoder_p, &src_p->value.a);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_ak_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ak_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = uper_c_source_ak_choice_a_e;
+        uper_c_source_aj_decode_inner(decoder_p, &dst_p->value.a);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_ak_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_ai_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ai_t *src_p)
+{
+    uper_c_source_ak_encode_inner(encoder_p, &src_p->a);
+}
+
+static void uper_c_source_ai_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ai_t *dst_p)
+{
+    uper_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+}
+
+static void uper_c_source_ai_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ai_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_AI_FIELD_A) != 0u) {
+        uper_c_source_ak_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        uper_c_source_ak_skip_inner(decoder_p);
+    }
+}
+
+static void uper_c_source_ai_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uper_c_source_ak_skip_inner(decoder_p);
+}
+
+static void uper_c_source_al_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_al_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -129),
+        9);
+}
+
+static void uper_c_source_al_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_al_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        9);
+    dst_p->value += -129;
+}
+
+static void uper_c_source_al_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 9u);
+}
+
+static void uper_c_source_am_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_am_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -2),
+        8);
+}
+
+static void uper_c_source_am_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_am_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    dst_p->value += -2;
+}
+
+static void uper_c_source_am_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void uper_c_source_an_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_an_t *src_p)
+{
+    uint32_t value;
+
+    switch (src_p->value) {
+    case uper_c_source_an_a_e:
+        value = 0;
+        break;
+    case uper_c_source_an_b_e:
+        value = 1;
+        break;
+    case uper_c_source_an_c_e:
+        value = 2;
+        break;
+    case uper_c_source_an_d_e:
+        value = 3;
+        break;
+    case uper_c_source_an_e_e:
+        value = 4;
+        break;
+    case uper_c_source_an_f_e:
+        value = 5;
+        break;
+    case uper_c_source_an_g_e:
+        value = 6;
+        break;
+    case uper_c_source_an_h_e:
+        value = 7;
+        break;
+    case uper_c_source_an_i_e:
+        value = 8;
+        break;
+    case uper_c_source_an_j_e:
+        value = 9;
+        break;
+    case uper_c_source_an_k_e:
+        value = 10;
+        break;
+    default:
+        encoder_abort(encoder_p, EBADENUM);
+        return;
+    }
+    encoder_append_non_negative_binary_integer(encoder_p, value, 4);
+}
+
+static void uper_c_source_an_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_an_t *dst_p)
+{
+    uint32_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 4);
+    switch (value) {
+    case 0:
+        dst_p->value = uper_c_source_an_a_e;
+        break;
+    case 1:
+        dst_p->value = uper_c_source_an_b_e;
+        break;
+    case 2:
+        dst_p->value = uper_c_source_an_c_e;
+        break;
+    case 3:
+        dst_p->value = uper_c_source_an_d_e;
+        break;
+    case 4:
+        dst_p->value = uper_c_source_an_e_e;
+        break;
+    case 5:
+        dst_p->value = uper_c_source_an_f_e;
+        break;
+    case 6:
+        dst_p->value = uper_c_source_an_g_e;
+        break;
+    case 7:
+        dst_p->value = uper_c_source_an_h_e;
+        break;
+    case 8:
+        dst_p->value = uper_c_source_an_i_e;
+        break;
+    case 9:
+        dst_p->value = uper_c_source_an_j_e;
+        break;
+    case 10:
+        dst_p->value = uper_c_source_an_k_e;
+        break;
+    default:
+        decoder_abort(decoder_p, EBADENUM);
+        return;
+    }
+}
+
+static void uper_c_source_an_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 4);
+
+    if (value > 10u) {
+        decoder_abort(decoder_p, EBADENUM);
+    }
+}
+
+static void uper_c_source_ao_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ao_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->a),
+        8);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->b),
+        24);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->c),
+        4);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->d),
+        32);
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->e),
+        64);
+}
+
+static void uper_c_source_ao_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ao_t *dst_p)
+{
+    dst_p->a = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    dst_p->b = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        24);
+    dst_p->c = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->d = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        32);
+    dst_p->e = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        64);
+}
+
+static void uper_c_source_ao_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ao_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_AO_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            8);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & UPER_C_SOURCE_AO_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            24);
+    } else {
+        (void)decoder_free(decoder_p, 24u);
+    }
+    if ((fields & UPER_C_SOURCE_AO_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+    } else {
+        (void)decoder_free(decoder_p, 4u);
+    }
+    if ((fields & UPER_C_SOURCE_AO_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            32);
+    } else {
+        (void)decoder_free(decoder_p, 32u);
+    }
+    if ((fields & UPER_C_SOURCE_AO_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            64);
+    } else {
+        (void)decoder_free(decoder_p, 64u);
+    }
+}
+
+static void uper_c_source_ao_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 132u);
+}
+
+static void uper_c_ref_referenced_sequence_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_ref_referenced_sequence_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->a - 0),
+        7);
+}
+
+static void uper_c_ref_referenced_sequence_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_ref_referenced_sequence_t *dst_p)
+{
+    dst_p->a = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    dst_p->a += 0;
+}
+
+static void uper_c_ref_referenced_sequence_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_ref_referenced_sequence_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_REF_REFERENCED_SEQUENCE_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        dst_p->a += 0;
+    } else {
+        (void)decoder_free(decoder_p, 7u);
+    }
+}
+
+static void uper_c_ref_referenced_sequence_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 7u);
+}
+
+static void uper_c_ref_referenced_enum_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_ref_referenced_enum_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->value;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 2);
+}
+
+static void uper_c_ref_referenced_enum_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_ref_referenced_enum_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    if (value > 2u) {
+        decoder_abort(decoder_p, EBADENUM);
+
+        return;
+    }
+
+    dst_p->value = (enum uper_c_ref_referenced_enum_e)value;
+}
+
+static void uper_c_ref_referenced_enum_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    if (value > 2u) {
+        decoder_abort(decoder_p, EBADENUM);
+    }
+}
+
+static void uper_c_source_ap_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ap_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->c.value != uper_c_ref_referenced_enum_a_e);
+    encoder_append_bool(encoder_p, src_p->d != 1);
+    uper_c_ref_referenced_sequence_encode_inner(encoder_p, &src_p->b);
+
+    if (src_p->c.value != uper_c_ref_referenced_enum_a_e) {
+        uper_c_ref_referenced_enum_encode_inner(encoder_p, &src_p->c);
+    }
+
+    if (src_p->d != 1) {
+        encoder_append_uint8(encoder_p, src_p->d);
+    }
+}
+
+static void uper_c_source_ap_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ap_t *dst_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    uper_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+
+    if (is_present) {
+        uper_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        dst_p->c.value = uper_c_ref_referenced_enum_a_e;
+    }
+
+    if (is_present_2) {
+        dst_p->d = decoder_read_uint8(decoder_p);
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void uper_c_source_ap_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ap_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    bool is_present_2;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if ((fields & UPER_C_SOURCE_AP_FIELD_B) != 0u) {
+        uper_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        (void)decoder_free(decoder_p, 7u);
+    }
+
+    if (is_present) {
+        if ((fields & UPER_C_SOURCE_AP_FIELD_C) != 0u) {
+            uper_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
+        } else {
+            uper_c_ref_referenced_enum_skip_inner(decoder_p);
+        }
+    } else {
+        dst_p->c.value = uper_c_ref_referenced_enum_a_e;
+    }
+
+    if (is_present_2) {
+        if ((fields & UPER_C_SOURCE_AP_FIELD_D) != 0u) {
+            dst_p->d = decoder_read_uint8(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 8u);
+        }
+    } else {
+        dst_p->d = 1;
+    }
+}
+
+static void uper_c_source_ap_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    (void)decoder_free(decoder_p, 7u);
+    if (is_present) {
+        uper_c_ref_referenced_enum_skip_inner(decoder_p);
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 8u);
+    }
+}
+
+static void uper_c_source_aq_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_aq_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - 0),
+        24);
+}
+
+static void uper_c_source_aq_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_aq_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        24);
+    dst_p->value += 0;
+}
+
+static void uper_c_source_aq_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 24u);
+}
+
+static void uper_c_source_ar_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_ar_t *src_p)
+{
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    encoder_append_bool(encoder_p, (memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+                                   (src_p->a.length != sizeof(a_default)));
+
+    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
+        (src_p->a.length != sizeof(a_default))) {
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->a.length - 0u,
+            4);
+        encoder_append_bytes(encoder_p,
+                             &src_p->a.buf[0],
+                             src_p->a.length);
+    }
+}
+
+static void uper_c_source_ar_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ar_t *dst_p)
+{
+    bool is_present;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (is_present) {
+        dst_p->a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->a.length += 0u;
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void uper_c_source_ar_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_ar_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    uint32_t length;
+    static const uint8_t a_default[] = {0xAB, 0xCD};
+
+    is_present = decoder_read_bool(decoder_p);
+
+    if (is_present) {
+        if ((fields & UPER_C_SOURCE_AR_FIELD_A) != 0u) {
+            dst_p->a.length = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                4);
+            dst_p->a.length += 0u;
+
+            if (dst_p->a.length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            decoder_read_bytes(decoder_p,
+                               &dst_p->a.buf[0],
+                               dst_p->a.length);
+        } else {
+            length = (uint32_t)decoder_read_non_negative_binary_integer(
+                decoder_p,
+                4);
+            length += 0u;
+
+            if (length > 10u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, 8u * length);
+        }
+    } else {
+        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
+        dst_p->a.length = sizeof(a_default);
+    }
+}
+
+static void uper_c_source_ar_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    uint32_t length;
+
+    is_present = decoder_read_bool(decoder_p);
+    if (is_present) {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length += 0u;
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 8u * length);
+    }
+}
+
+static void uper_c_source_as_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_as_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->is_a_a_present);
+    encoder_append_bool(encoder_p, src_p->a_c != true);
+
+    if (src_p->is_a_a_present) {
+        encoder_append_bool(encoder_p, src_p->a_a);
+    }
+
+    switch (src_p->a_b.choice) {
+
+    case uper_c_source_as_a_b_choice_b_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+        encoder_append_bool(encoder_p, src_p->a_b.value.b_a);
+        break;
+
+    case uper_c_source_as_a_b_choice_b_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+        encoder_append_bool(encoder_p, src_p->a_b.value.b_b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+
+    if (src_p->a_c != true) {
+        encoder_append_bool(encoder_p, src_p->a_c);
+    }
+}
+
+static void uper_c_source_as_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_as_t *dst_p)
+{
+    bool is_present;
+    uint8_t choice;
+
+    dst_p->is_a_a_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_a_present) {
+        dst_p->a_a = decoder_read_bool(decoder_p);
+    }
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->a_b.choice = uper_c_source_as_a_b_choice_b_a_e;
+        dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
+        break;
+
+    case 1:
+        dst_p->a_b.choice = uper_c_source_as_a_b_choice_b_b_e;
+        dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+
+    if (is_present) {
+        dst_p->a_c = decoder_read_bool(decoder_p);
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void uper_c_source_as_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_as_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    uint8_t choice;
+    uint8_t choice_2;
+
+    dst_p->is_a_a_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+
+    if (dst_p->is_a_a_present) {
+        if ((fields & UPER_C_SOURCE_AS_FIELD_A_A) != 0u) {
+            dst_p->a_a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & UPER_C_SOURCE_AS_FIELD_A_B) != 0u) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice) {
+
+        case 0:
+            dst_p->a_b.choice = uper_c_source_as_a_b_choice_b_a_e;
+            dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
+            break;
+
+        case 1:
+            dst_p->a_b.choice = uper_c_source_as_a_b_choice_b_b_e;
+            dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    } else {
+        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+        switch (choice_2) {
+
+        case 0:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        case 1:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    }
+
+    if (is_present) {
+        if ((fields & UPER_C_SOURCE_AS_FIELD_A_C) != 0u) {
+            dst_p->a_c = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    } else {
+        dst_p->a_c = true;
+    }
+}
+
+static void uper_c_source_as_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+    uint8_t choice;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    case 1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void uper_c_ref_at_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_ref_at_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value),
+        2);
+}
+
+static void uper_c_ref_at_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_ref_at_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+}
+
+static void uper_c_ref_at_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void uper_c_source_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_b_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case uper_c_source_b_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 2);
+        encoder_append_int8(encoder_p, src_p->value.a);
+        break;
+
+    case uper_c_source_b_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 2);
+        uper_c_source_a_encode_inner(encoder_p, &src_p->value.b);
+        break;
+
+    case uper_c_source_b_choice_c_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 2, 2);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_b_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = uper_c_source_b_choice_a_e;
+        dst_p->value.a = decoder_read_int8(decoder_p);
+        break;
+
+    case 1:
+        dst_p->choice = uper_c_source_b_choice_b_e;
+        uper_c_source_a_decode_inner(decoder_p, &dst_p->value.b);
+        break;
+
+    case 2:
+        dst_p->choice = uper_c_source_b_choice_c_e;
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+    switch (choice) {
+
+    case 0:
+        (void)decoder_free(decoder_p, 8u);
+        break;
+
+    case 1:
+        (void)decoder_free(decoder_p, 329u);
+        break;
+
+    case 2:
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_c_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        2);
+
+    for (i = 0; i < src_p->length; i++) {
+        uper_c_source_b_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void uper_c_source_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_c_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        uper_c_source_b_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void uper_c_source_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    length += 0u;
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        uper_c_source_b_skip_inner(decoder_p);
+    }
+}
+
+static void uper_c_source_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_e_t *src_p)
+{
+    switch (src_p->a.choice) {
+
+    case uper_c_source_e_a_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+
+        switch (src_p->a.value.b.choice) {
+
+        case uper_c_source_e_a_b_choice_c_e:
+            encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+            encoder_append_bool(encoder_p, src_p->a.value.b.value.c);
+            break;
+
+        default:
+            encoder_abort(encoder_p, EBADCHOICE);
+            break;
+        }
+
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_e_t *dst_p)
+{
+    uint8_t choice;
+    uint8_t choice_2;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->a.choice = uper_c_source_e_a_choice_b_e;
+        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice_2) {
+
+        case 0:
+            dst_p->a.value.b.choice = uper_c_source_e_a_b_choice_c_e;
+            dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_e_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t choice;
+    uint8_t choice_2;
+    uint8_t choice_3;
+    uint8_t choice_4;
+
+    if ((fields & UPER_C_SOURCE_E_FIELD_A) != 0u) {
+        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice) {
+
+        case 0:
+            dst_p->a.choice = uper_c_source_e_a_choice_b_e;
+            choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+            switch (choice_2) {
+
+            case 0:
+                dst_p->a.value.b.choice = uper_c_source_e_a_b_choice_c_e;
+                dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    } else {
+        choice_3 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice_3) {
+
+        case 0:
+            choice_4 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+            switch (choice_4) {
+
+            case 0:
+                (void)decoder_free(decoder_p, 1u);
+                break;
+
+            default:
+                decoder_abort(decoder_p, EBADCHOICE);
+                break;
+            }
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+    }
+}
+
+static void uper_c_source_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+    uint8_t choice_2;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+    switch (choice) {
+
+    case 0:
+        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+
+        switch (choice_2) {
+
+        case 0:
+            (void)decoder_free(decoder_p, 1u);
+            break;
+
+        default:
+            decoder_abort(decoder_p, EBADCHOICE);
+            break;
+        }
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_c_source_f_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_f_t *src_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 1u,
+        1);
+
+    for (i = 0; i < src_p->length; i++) {
+        for (i_2 = 0; i_2 < 1; i_2++) {
+            encoder_append_bool(encoder_p, src_p->elements[i].elements[i_2]);
+        }
+    }
+}
+
+static void uper_c_source_f_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_f_t *dst_p)
+{
+    uint8_t i;
+    uint8_t i_2;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->length += 1u;
+
+    for (i = 0; i < dst_p->length; i++) {
+        for (i_2 = 0; i_2 < 1; i_2++) {
+            dst_p->elements[i].elements[i_2] = decoder_read_bool(decoder_p);
+        }
+    }
+}
+
+static void uper_c_source_f_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    length += 1u;
+
+    (void)decoder_free(decoder_p, length * 1u);
+}
+
+static void uper_c_source_g_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_g_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 9) >= 0) {
+        encoder_write_bits(encoder_p,
+                           ((uint64_t)src_p->is_a_present << 8)
+                           | ((uint64_t)src_p->is_b_present << 7)
+                           | ((uint64_t)src_p->is_c_present << 6)
+                           | ((uint64_t)src_p->is_d_present << 5)
+                           | ((uint64_t)src_p->is_e_present << 4)
+                           | ((uint64_t)src_p->is_f_present << 3)
+                           | ((uint64_t)src_p->is_g_present << 2)
+                           | ((uint64_t)src_p->is_h_present << 1)
+                           | (uint64_t)src_p->is_i_present,
+                           9);
+    }
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->is_b_present) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    if (src_p->is_c_present) {
+        encoder_append_bool(encoder_p, src_p->c);
+    }
+
+    if (src_p->is_d_present) {
+        encoder_append_bool(encoder_p, src_p->d);
+    }
+
+    if (src_p->is_e_present) {
+        encoder_append_bool(encoder_p, src_p->e);
+    }
+
+    if (src_p->is_f_present) {
+        encoder_append_bool(encoder_p, src_p->f);
+    }
+
+    if (src_p->is_g_present) {
+        encoder_append_bool(encoder_p, src_p->g);
+    }
+
+    if (src_p->is_h_present) {
+        encoder_append_bool(encoder_p, src_p->h);
+    }
+
+    if (src_p->is_i_present) {
+        encoder_append_bool(encoder_p, src_p->i);
+    }
+}
+
+static void uper_c_source_g_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_g_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 9);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 9);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits >> 8) != 0u);
+    dst_p->is_b_present = (((bits >> 7) & 0x1u) != 0u);
+    dst_p->is_c_present = (((bits >> 6) & 0x1u) != 0u);
+    dst_p->is_d_present = (((bits >> 5) & 0x1u) != 0u);
+    dst_p->is_e_present = (((bits >> 4) & 0x1u) != 0u);
+    dst_p->is_f_present = (((bits >> 3) & 0x1u) != 0u);
+    dst_p->is_g_present = (((bits >> 2) & 0x1u) != 0u);
+    dst_p->is_h_present = (((bits >> 1) & 0x1u) != 0u);
+    dst_p->is_i_present = ((bits & 0x1u) != 0u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_b_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_c_present) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_d_present) {
+        dst_p->d = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_e_present) {
+        dst_p->e = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_f_present) {
+        dst_p->f = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_g_present) {
+        dst_p->g = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_h_present) {
+        dst_p->h = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_i_present) {
+        dst_p->i = decoder_read_bool(decoder_p);
+    }
+}
+
+static void uper_c_source_g_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_g_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 9);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 9);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = ((bits >> 8) != 0u);
+    dst_p->is_b_present = (((bits >> 7) & 0x1u) != 0u);
+    dst_p->is_c_present = (((bits >> 6) & 0x1u) != 0u);
+    dst_p->is_d_present = (((bits >> 5) & 0x1u) != 0u);
+    dst_p->is_e_present = (((bits >> 4) & 0x1u) != 0u);
+    dst_p->is_f_present = (((bits >> 3) & 0x1u) != 0u);
+    dst_p->is_g_present = (((bits >> 2) & 0x1u) != 0u);
+    dst_p->is_h_present = (((bits >> 1) & 0x1u) != 0u);
+    dst_p->is_i_present = ((bits & 0x1u) != 0u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_c_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_C) != 0u) {
+            dst_p->c = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_d_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_D) != 0u) {
+            dst_p->d = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_e_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_E) != 0u) {
+            dst_p->e = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_f_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_F) != 0u) {
+            dst_p->f = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_g_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_G) != 0u) {
+            dst_p->g = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_h_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_H) != 0u) {
+            dst_p->h = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_i_present) {
+        if ((fields & UPER_C_SOURCE_G_FIELD_I) != 0u) {
+            dst_p->i = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+}
+
+static void uper_c_source_g_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+    bool is_present_3;
+    bool is_present_4;
+    bool is_present_5;
+    bool is_present_6;
+    bool is_present_7;
+    bool is_present_8;
+    bool is_present_9;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    is_present_3 = decoder_read_bool(decoder_p);
+    is_present_4 = decoder_read_bool(decoder_p);
+    is_present_5 = decoder_read_bool(decoder_p);
+    is_present_6 = decoder_read_bool(decoder_p);
+    is_present_7 = decoder_read_bool(decoder_p);
+    is_present_8 = decoder_read_bool(decoder_p);
+    is_present_9 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_3) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_4) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_5) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_6) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_7) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_8) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_9) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void uper_c_source_h_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_h_t *src_p)
+{
+    (void)encoder_p;
+    (void)src_p;
+}
+
+static void uper_c_source_h_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_h_t *dst_p)
+{
+    (void)decoder_p;
+    (void)dst_p;
+}
+
+static void uper_c_source_h_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
+static void uper_c_source_i_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_i_t *src_p)
+{
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         24);
+}
+
+static void uper_c_source_i_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_i_t *dst_p)
+{
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       24);
+}
+
+static void uper_c_source_i_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 192u);
+}
+
+static void uper_c_source_j_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_j_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 22u,
+        1);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void uper_c_source_j_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_j_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->length += 22u;
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void uper_c_source_j_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    length += 22u;
+
+    (void)decoder_free(decoder_p, 8u * length);
+}
+
+static void uper_c_source_k_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_k_t *src_p)
+{
+    uint8_t value;
+
+    value = src_p->value;
+    encoder_append_non_negative_binary_integer(encoder_p, value, 0);
+}
+
+static void uper_c_source_k_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_k_t *dst_p)
+{
+    uint8_t value;
+
+    value = decoder_read_non_negative_binary_integer(decoder_p, 0);
+    dst_p->value = (enum uper_c_source_k_e)value;
+}
+
+static void uper_c_source_k_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_p;
+}
+
+static void uper_c_source_l_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_l_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        9);
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         src_p->length);
+}
+
+static void uper_c_source_l_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_l_t *dst_p)
+{
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        9);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       dst_p->length);
+}
+
+static void uper_c_source_l_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        9);
+    length += 0u;
+
+    if (length > 500u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 8u * length);
+}
+
+static void uper_c_source_o_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_o_t *src_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 1u,
+        9);
+
+    if (encoder_alloc(encoder_p, 1u * src_p->length) >= 0) {
+        for (i = 0; (i + 64u) <= src_p->length; i += 64u) {
+            bits = 0;
+
+            for (j = 0; j < 64u; j++) {
+                bits = ((bits << 1) | ((uint64_t)src_p->elements[i + j] & 0x1u));
+            }
+
+            encoder_write_bits(encoder_p, bits, 64);
+        }
+
+        for (; i < src_p->length; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->elements[i], 1);
+        }
+    }
+}
+
+static void uper_c_source_o_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_o_t *dst_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        9);
+    dst_p->length += 1u;
+
+    if (dst_p->length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(decoder_p, 1u * dst_p->length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 57u) <= dst_p->length; i += 57u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 57);
+        pos += 57;
+
+        for (j = 0; j < 57u; j++) {
+            dst_p->elements[i + j] = (((bits >> (56u - (1u * j))) & 0x1u) != 0u);
+        }
+    }
+
+    for (; i < dst_p->length; i++) {
+        dst_p->elements[i] = (decoder_read_bits(decoder_p, (size_t)pos, 1) != 0u);
+        pos += 1;
+    }
+}
+
+static void uper_c_source_o_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        9);
+    length += 1u;
+
+    if (length > 260u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 1u);
+}
+
+static void uper_c_source_n_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_n_t *src_p)
+{
+    uper_c_source_k_encode_inner(encoder_p, &src_p->a);
+    uper_c_source_a_encode_inner(encoder_p, &src_p->b);
+    uper_c_source_o_encode_inner(encoder_p, &src_p->c);
+}
+
+static void uper_c_source_n_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_n_t *dst_p)
+{
+    uper_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    uper_c_source_a_decode_inner(decoder_p, &dst_p->b);
+    uper_c_source_o_decode_inner(decoder_p, &dst_p->c);
+}
+
+static void uper_c_source_n_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_n_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_N_FIELD_A) != 0u) {
+        uper_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    }
+    if ((fields & UPER_C_SOURCE_N_FIELD_B) != 0u) {
+        uper_c_source_a_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        (void)decoder_free(decoder_p, 329u);
+    }
+    if ((fields & UPER_C_SOURCE_N_FIELD_C) != 0u) {
+        uper_c_source_o_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        uper_c_source_o_skip_inner(decoder_p);
+    }
+}
+
+static void uper_c_source_n_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 329u);
+    uper_c_source_o_skip_inner(decoder_p);
+}
+
+static void uper_c_source_m_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_m_t *src_p)
+{
+    uper_c_source_k_encode_inner(encoder_p, &src_p->a);
+    uper_c_source_n_encode_inner(encoder_p, &src_p->b);
+}
+
+static void uper_c_source_m_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_m_t *dst_p)
+{
+    uper_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    uper_c_source_n_decode_inner(decoder_p, &dst_p->b);
+}
+
+static void uper_c_source_m_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_m_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_M_FIELD_A) != 0u) {
+        uper_c_source_k_decode_inner(decoder_p, &dst_p->a);
+    }
+    if ((fields & UPER_C_SOURCE_M_FIELD_B) != 0u) {
+        uper_c_source_n_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        uper_c_source_n_skip_inner(decoder_p);
+    }
+}
+
+static void uper_c_source_m_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uper_c_source_n_skip_inner(decoder_p);
+}
+
+static void uper_c_source_p_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_p_t *src_p)
+{
+    uper_c_source_a_encode_inner(encoder_p, &src_p->a);
+    uper_c_source_m_encode_inner(encoder_p, &src_p->b);
+    uper_c_source_f_encode_inner(encoder_p, &src_p->c);
+}
+
+static void uper_c_source_p_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_p_t *dst_p)
+{
+    uper_c_source_a_decode_inner(decoder_p, &dst_p->a);
+    uper_c_source_m_decode_inner(decoder_p, &dst_p->b);
+    uper_c_source_f_decode_inner(decoder_p, &dst_p->c);
+}
+
+static void uper_c_source_p_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_p_t *dst_p,
+    uint64_t fields)
+{
+    if ((fields & UPER_C_SOURCE_P_FIELD_A) != 0u) {
+        uper_c_source_a_decode_inner(decoder_p, &dst_p->a);
+    } else {
+        (void)decoder_free(decoder_p, 329u);
+    }
+    if ((fields & UPER_C_SOURCE_P_FIELD_B) != 0u) {
+        uper_c_source_m_decode_inner(decoder_p, &dst_p->b);
+    } else {
+        uper_c_source_m_skip_inner(decoder_p);
+    }
+    if ((fields & UPER_C_SOURCE_P_FIELD_C) != 0u) {
+        uper_c_source_f_decode_inner(decoder_p, &dst_p->c);
+    } else {
+        uper_c_source_f_skip_inner(decoder_p);
+    }
+}
+
+static void uper_c_source_p_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 329u);
+    uper_c_source_m_skip_inner(decoder_p);
+    uper_c_source_f_skip_inner(decoder_p);
+}
+
+static void uper_c_source_r_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_r_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -1),
+        1);
+}
+
+static void uper_c_source_r_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_r_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        1);
+    dst_p->value += -1;
+}
+
+static void uper_c_source_r_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_c_ref_referenced_int_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_ref_referenced_int_t *src_p)
+{
+    encoder_append_uint8(encoder_p, src_p->value);
+}
+
+static void uper_c_ref_referenced_int_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_ref_referenced_int_t *dst_p)
+{
+    dst_p->value = decoder_read_uint8(decoder_p);
+}
+
+static void uper_c_ref_referenced_int_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void uper_c_source_s_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_s_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -2),
+        2);
+}
+
+static void uper_c_source_s_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_s_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->value += -2;
+}
+
+static void uper_c_source_s_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void uper_c_source_t_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_t_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -1),
+        2);
+}
+
+static void uper_c_source_t_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_t_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->value += -1;
+}
+
+static void uper_c_source_t_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 2u);
+}
+
+static void uper_c_source_u_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_u_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -64),
+        7);
+}
+
+static void uper_c_source_u_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_u_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    dst_p->value += -64;
+}
+
+static void uper_c_source_u_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 7u);
+}
+
+static void uper_c_source_v_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_v_t *src_p)
+{
+    encoder_append_int8(encoder_p, src_p->value);
+}
+
+static void uper_c_source_v_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_v_t *dst_p)
+{
+    dst_p->value = decoder_read_int8(decoder_p);
+}
+
+static void uper_c_source_v_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void uper_c_source_w_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_w_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -1),
+        9);
+}
+
+static void uper_c_source_w_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_w_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        9);
+    dst_p->value += -1;
+}
+
+static void uper_c_source_w_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 9u);
+}
+
+static void uper_c_source_x_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_x_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - -2),
+        10);
+}
+
+static void uper_c_source_x_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_x_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        10);
+    dst_p->value += -2;
+}
+
+static void uper_c_source_x_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 10u);
+}
+
+static void uper_c_source_y_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_y_t *src_p)
+{
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        (uint64_t)(src_p->value - 10000),
+        10);
+}
+
+static void uper_c_source_y_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_y_t *dst_p)
+{
+    dst_p->value = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        10);
+    dst_p->value += 10000;
+}
+
+static void uper_c_source_y_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 10u);
+}
+
+static void uper_c_source_z_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_c_source_z_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->value);
+}
+
+static void uper_c_source_z_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_c_source_z_t *dst_p)
+{
+    dst_p->value = decoder_read_bool(decoder_p);
+}
+
+static void uper_c_source_z_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 1u);
+}
+
+ssize_t uper_c_source_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_a_encoded_size(
+    const struct uper_c_source_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_a_decode(
+    struct uper_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_a_decode_batch(
+    struct uper_c_source_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_a_decode_fields(
+    struct uper_c_source_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ab_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ab_encoded_size(
+    const struct uper_c_source_ab_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ab_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ab_decode(
+    struct uper_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ab_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ab_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ab_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ab_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ab_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ab_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ab_decode_batch(
+    struct uper_c_source_ab_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ab_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ab_decode_fields(
+    struct uper_c_source_ab_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ab_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_q_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_q_encoded_size(
+    const struct uper_c_source_q_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_q_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_q_decode(
+    struct uper_c_source_q_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_q_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_q_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_q_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_q_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_q_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_q_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_q_decode_batch(
+    struct uper_c_source_q_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_q_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_d_encoded_size(
+    const struct uper_c_source_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_d_decode(
+    struct uper_c_source_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_d_decode_batch(
+    struct uper_c_source_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ac_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ac_encoded_size(
+    const struct uper_c_source_ac_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ac_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ac_decode(
+    struct uper_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ac_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ac_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ac_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ac_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ac_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ac_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ac_decode_batch(
+    struct uper_c_source_ac_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ac_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ac_decode_fields(
+    struct uper_c_source_ac_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ac_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ad_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ad_encoded_size(
+    const struct uper_c_source_ad_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ad_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ad_decode(
+    struct uper_c_source_ad_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ad_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ad_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ad_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ad_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ad_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ad_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ad_decode_batch(
+    struct uper_c_source_ad_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ad_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ae_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ae_encoded_size(
+    const struct uper_c_source_ae_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ae_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ae_decode(
+    struct uper_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ae_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ae_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ae_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ae_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ae_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ae_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ae_decode_batch(
+    struct uper_c_source_ae_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ae_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ae_decode_fields(
+    struct uper_c_source_ae_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ae_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ah_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ah_encoded_size(
+    const struct uper_c_source_ah_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ah_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ah_decode(
+    struct uper_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ah_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ah_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ah_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ah_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ah_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ah_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ah_decode_batch(
+    struct uper_c_source_ah_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ah_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ah_decode_fields(
+    struct uper_c_source_ah_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ah_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_af_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_af_encoded_size(
+    const struct uper_c_source_af_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_af_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_af_decode(
+    struct uper_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_af_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_af_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_af_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_af_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_af_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_af_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_af_decode_batch(
+    struct uper_c_source_af_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_af_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_af_decode_fields(
+    struct uper_c_source_af_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_af_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ag_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ag_encoded_size(
+    const struct uper_c_source_ag_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ag_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ag_decode(
+    struct uper_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ag_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ag_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ag_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ag_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ag_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ag_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ag_decode_batch(
+    struct uper_c_source_ag_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ag_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ag_decode_fields(
+    struct uper_c_source_ag_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ag_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_aj_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_aj_encoded_size(
+    const struct uper_c_source_aj_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_aj_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_aj_decode(
+    struct uper_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_aj_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_aj_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_aj_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_aj_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_aj_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_aj_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_aj_decode_batch(
+    struct uper_c_source_aj_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_aj_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_aj_decode_fields(
+    struct uper_c_source_aj_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_aj_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ak_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ak_encoded_size(
+    const struct uper_c_source_ak_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ak_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ak_decode(
+    struct uper_c_source_ak_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ak_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ak_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ak_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ak_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ak_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ak_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ak_decode_batch(
+    struct uper_c_source_ak_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ak_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ai_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ai_encoded_size(
+    const struct uper_c_source_ai_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ai_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ai_decode(
+    struct uper_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ai_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ai_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ai_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ai_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ai_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ai_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ai_decode_batch(
+    struct uper_c_source_ai_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ai_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ai_decode_fields(
+    struct uper_c_source_ai_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ai_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_al_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_al_encoded_size(
+    const struct uper_c_source_al_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_al_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_al_decode(
+    struct uper_c_source_al_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_al_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_al_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_al_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_al_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_al_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_al_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_al_decode_batch(
+    struct uper_c_source_al_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
 
-        if (src_p->elements[i].m.s != false) {
-            encoder_append_bool(encoder_p, src_p->elements[i].m.s);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_al_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_d_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_d_t *dst_p)
+ssize_t uper_c_source_am_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_am_t *src_p)
 {
-    uint8_t i;
-    uint8_t choice;
-    uint8_t i_2;
-    bool is_present;
-    uint16_t value;
-    bool is_present_2;
-    bool is_present_3;
+    struct encoder_t encoder;
 
-    dst_p->length = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        4);
-    dst_p->length += 1u;
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_am_encode_inner(&encoder, src_p);
 
-    if (dst_p->length > 10u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    return (encoder_get_result(&encoder));
+}
 
-        return;
+ssize_t uper_c_source_am_encoded_size(
+    const struct uper_c_source_am_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_am_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_am_decode(
+    struct uper_c_source_am_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_am_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_am_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_am_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_am_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_am_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_am_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    for (i = 0; i < dst_p->length; i++) {
-        choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+    return ((ssize_t)pos);
+}
 
-        switch (choice) {
+ssize_t uper_c_source_am_decode_batch(
+    struct uper_c_source_am_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        case 0:
-            dst_p->elements[i].a.b.choice = uper_c_source_d_a_b_choice_c_e;
-            dst_p->elements[i].a.b.value.c = decoder_read_non_negative_binary_integer(
-                decoder_p,
-                1);
-            dst_p->elements[i].a.b.value.c += 0;
-            break;
+    pos = 0;
 
-        case 1:
-            dst_p->elements[i].a.b.choice = uper_c_source_d_a_b_choice_d_e;
-            dst_p->elements[i].a.b.value.d = decoder_read_bool(decoder_p);
-            break;
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_am_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        default:
-            decoder_abort(decoder_p, EBADCHOICE);
-            break;
+        if (res < 0) {
+            return (res);
         }
 
-        dst_p->elements[i].a.e.length = decoder_read_non_negative_binary_integer(
-            decoder_p,
-            1);
-        dst_p->elements[i].a.e.length += 3u;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        for (i_2 = 0; i_2 < dst_p->elements[i].a.e.length; i_2++) {
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_an_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_an_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_an_encoded_size(
+    const struct uper_c_source_an_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_an_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_an_decode(
+    struct uper_c_source_an_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_an_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_an_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_an_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_an_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_an_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_an_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        is_present = decoder_read_bool(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-        if (is_present) {
-            value = decoder_read_non_negative_binary_integer(decoder_p, 2);
-            switch (value) {
-            case 0:
-                dst_p->elements[i].g.h = uper_c_source_d_g_h_i_e;
-                break;
-            case 1:
-                dst_p->elements[i].g.h = uper_c_source_d_g_h_j_e;
-                break;
-            case 2:
-                dst_p->elements[i].g.h = uper_c_source_d_g_h_k_e;
-                break;
-            default:
-                decoder_abort(decoder_p, EBADENUM);
-                return;
-            }
-        } else {
-            dst_p->elements[i].g.h = uper_c_source_d_g_h_j_e;
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_an_decode_batch(
+    struct uper_c_source_an_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_an_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        dst_p->elements[i].g.l.length = decoder_read_non_negative_binary_integer(
-            decoder_p,
-            1);
-        dst_p->elements[i].g.l.length += 1u;
-        decoder_read_bytes(decoder_p,
-                           &dst_p->elements[i].g.l.buf[0],
-                           dst_p->elements[i].g.l.length);
-        dst_p->elements[i].m.is_n_present = decoder_read_bool(decoder_p);
-        is_present_2 = decoder_read_bool(decoder_p);
-        dst_p->elements[i].m.is_p_present = decoder_read_bool(decoder_p);
-        is_present_3 = decoder_read_bool(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ao_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ao_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ao_encoded_size(
+    const struct uper_c_source_ao_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ao_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_ao_decode(
+    struct uper_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ao_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ao_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ao_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_ao_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ao_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        if (dst_p->elements[i].m.is_n_present) {
-            dst_p->elements[i].m.n = decoder_read_bool(decoder_p);
-        }
+    pos = 0;
 
-        if (is_present_2) {
-            dst_p->elements[i].m.o = decoder_read_non_negative_binary_integer(
-                decoder_p,
-                3);
-            dst_p->elements[i].m.o += -2;
-        } else {
-            dst_p->elements[i].m.o = 3;
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ao_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
         }
 
-        if (dst_p->elements[i].m.is_p_present) {
-            dst_p->elements[i].m.p.is_r_present = decoder_read_bool(decoder_p);
-            decoder_read_bytes(decoder_p,
-                               &dst_p->elements[i].m.p.q.buf[0],
-                               5);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-            if (dst_p->elements[i].m.p.is_r_present) {
-                dst_p->elements[i].m.p.r = decoder_read_bool(decoder_p);
-            }
-        }
+    return ((ssize_t)pos);
+}
 
-        if (is_present_3) {
-            dst_p->elements[i].m.s = decoder_read_bool(decoder_p);
-        } else {
-            dst_p->elements[i].m.s = false;
+ssize_t uper_c_source_ao_decode_batch(
+    struct uper_c_source_ao_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ao_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ac_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ac_t *src_p)
+ssize_t uper_c_source_ao_decode_fields(
+    struct uper_c_source_ao_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    uper_c_source_q_encode_inner(encoder_p, &src_p->a);
-    uper_c_source_d_encode_inner(encoder_p, &src_p->b);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ao_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_ac_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ac_t *dst_p)
+ssize_t uper_c_ref_referenced_sequence_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_ref_referenced_sequence_t *src_p)
 {
-    uper_c_source_q_decode_inner(decoder_p, &dst_p->a);
-    uper_c_source_d_decode_inner(decoder_p, &dst_p->b);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_ad_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ad_t *src_p)
+ssize_t uper_c_ref_referenced_sequence_encoded_size(
+    const struct uper_c_ref_referenced_sequence_t *src_p)
 {
-    uint8_t value;
+    struct encoder_t encoder;
 
-    value = src_p->value;
-    encoder_append_non_negative_binary_integer(encoder_p, value, 1);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_ad_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ad_t *dst_p)
+ssize_t uper_c_ref_referenced_sequence_decode(
+    struct uper_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t value;
+    struct decoder_t decoder;
 
-    value = decoder_read_non_negative_binary_integer(decoder_p, 1);
-    dst_p->value = (enum uper_c_source_ad_e)value;
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_referenced_sequence_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_ae_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ae_t *src_p)
+ssize_t uper_c_ref_referenced_sequence_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_bool(encoder_p, false);
-    encoder_append_bool(encoder_p, src_p->is_a_present);
-    encoder_append_bool(encoder_p, src_p->b != true);
+    struct decoder_t decoder;
 
-    if (src_p->is_a_present) {
-        encoder_append_bool(encoder_p, src_p->a);
-    }
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_referenced_sequence_skip_inner(&decoder);
 
-    if (src_p->b != true) {
-        encoder_append_bool(encoder_p, src_p->b);
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_ref_referenced_sequence_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_ref_referenced_sequence_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_ref_referenced_sequence_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    encoder_append_bool(encoder_p, src_p->c);
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ae_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ae_t *dst_p)
+ssize_t uper_c_ref_referenced_sequence_decode_batch(
+    struct uper_c_ref_referenced_sequence_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    bool is_present;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_read_bool(decoder_p);
-    dst_p->is_a_present = decoder_read_bool(decoder_p);
-    is_present = decoder_read_bool(decoder_p);
+    pos = 0;
 
-    if (dst_p->is_a_present) {
-        dst_p->a = decoder_read_bool(decoder_p);
-    }
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_ref_referenced_sequence_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    if (is_present) {
-        dst_p->b = decoder_read_bool(decoder_p);
-    } else {
-        dst_p->b = true;
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    dst_p->c = decoder_read_bool(decoder_p);
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ah_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ah_t *src_p)
+ssize_t uper_c_ref_referenced_sequence_decode_fields(
+    struct uper_c_ref_referenced_sequence_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    if(src_p->is_d_addition_present || src_p->is_e_addition_present) {
-        encoder_abort(encoder_p, EINVAL);
-        return;
-    }
-    encoder_append_bool(encoder_p, false);
-    encoder_append_bool(encoder_p, src_p->c);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_referenced_sequence_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_ah_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ah_t *dst_p)
+ssize_t uper_c_ref_referenced_enum_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_ref_referenced_enum_t *src_p)
 {
-    bool extension_is_present;
+    struct encoder_t encoder;
 
-    extension_is_present = decoder_read_bool(decoder_p);
-    dst_p->c = decoder_read_bool(decoder_p);
-    if(extension_is_present) {
-        decoder_abort(decoder_p, EINVAL);
-        return;
-    }
+    encoder_init(&encoder, dst_p, size);
+    uper_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_af_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_af_t *src_p)
+ssize_t uper_c_ref_referenced_enum_encoded_size(
+    const struct uper_c_ref_referenced_enum_t *src_p)
 {
-    if(src_p->is_b_addition_present || src_p->is_e_addition_present || src_p->is_f_addition_present ||
-       src_p->is_g_addition_present || src_p->is_h_addition_present || src_p->is_i_addition_present ||
-       src_p->is_j_addition_present || src_p->is_k_addition_present || src_p->is_l_addition_present) {
-        encoder_abort(encoder_p, EINVAL);
-        return;
-    }
-    encoder_append_bool(encoder_p, false);
-    encoder_append_bool(encoder_p, src_p->a);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_af_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_af_t *dst_p)
+ssize_t uper_c_ref_referenced_enum_decode(
+    struct uper_c_ref_referenced_enum_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    bool extension_is_present;
+    struct decoder_t decoder;
 
-    extension_is_present = decoder_read_bool(decoder_p);
-    dst_p->a = decoder_read_bool(decoder_p);
-    if(extension_is_present) {
-        decoder_abort(decoder_p, EINVAL);
-        return;
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_referenced_enum_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_ref_referenced_enum_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_referenced_enum_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_ref_referenced_enum_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_ref_referenced_enum_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_ref_referenced_enum_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ag_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ag_t *src_p)
+ssize_t uper_c_ref_referenced_enum_decode_batch(
+    struct uper_c_ref_referenced_enum_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    if(src_p->is_b_addition_present || src_p->is_c_addition_present || src_p->is_d_addition_present ||
-       src_p->is_h_addition_present || src_p->is_i_addition_present || src_p->is_j_addition_present ||
-       src_p->is_m_addition_present) {
-        encoder_abort(encoder_p, EINVAL);
-        return;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_ref_referenced_enum_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-    encoder_append_bool(encoder_p, false);
-    encoder_append_bool(encoder_p, src_p->a);
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_ap_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ap_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_ag_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ag_t *dst_p)
+ssize_t uper_c_source_ap_encoded_size(
+    const struct uper_c_source_ap_t *src_p)
 {
-    bool extension_is_present;
+    struct encoder_t encoder;
 
-    extension_is_present = decoder_read_bool(decoder_p);
-    dst_p->a = decoder_read_bool(decoder_p);
-    if(extension_is_present) {
-        decoder_abort(decoder_p, EINVAL);
-        return;
-    }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ap_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_aj_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_aj_t *src_p)
+ssize_t uper_c_source_ap_decode(
+    struct uper_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t value;
+    struct decoder_t decoder;
 
-    value = src_p->a;
-    encoder_append_non_negative_binary_integer(encoder_p, value, 1);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ap_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_aj_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_aj_t *dst_p)
+ssize_t uper_c_source_ap_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t value;
+    struct decoder_t decoder;
 
-    value = decoder_read_non_negative_binary_integer(decoder_p, 1);
-    dst_p->a = (enum uper_c_source_aj_a_e)value;
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ap_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_ak_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ak_t *src_p)
+ssize_t uper_c_source_ap_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ap_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    switch (src_p->choice) {
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    case uper_c_source_ak_choice_a_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
-        uper_c_source_aj_encode_inner(encoder_p, &src_p->value.a);
-        break;
+    pos = 0;
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ap_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ak_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ak_t *dst_p)
+ssize_t uper_c_source_ap_decode_batch(
+    struct uper_c_source_ap_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t choice;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+    pos = 0;
 
-    switch (choice) {
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ap_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    case 0:
-        dst_p->choice = uper_c_source_ak_choice_a_e;
-        uper_c_source_aj_decode_inner(decoder_p, &dst_p->value.a);
-        break;
+        if (res < 0) {
+            return (res);
+        }
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
-}
 
-static void uper_c_source_ai_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ai_t *src_p)
-{
-    uper_c_source_ak_encode_inner(encoder_p, &src_p->a);
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ai_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ai_t *dst_p)
+ssize_t uper_c_source_ap_decode_fields(
+    struct uper_c_source_ap_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    uper_c_source_ak_decode_inner(decoder_p, &dst_p->a);
-}
+    struct decoder_t decoder;
 
-static void uper_c_source_al_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_al_t *src_p)
-{
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -129),
-        9);
-}
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ap_decode_fields_inner(&decoder, dst_p, fields);
 
-static void uper_c_source_al_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_al_t *dst_p)
-{
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        9);
-    dst_p->value += -129;
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_am_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_am_t *src_p)
+ssize_t uper_c_source_aq_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_aq_t *src_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -2),
-        8);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_aq_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_am_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_am_t *dst_p)
+ssize_t uper_c_source_aq_encoded_size(
+    const struct uper_c_source_aq_t *src_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        8);
-    dst_p->value += -2;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_aq_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_an_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_an_t *src_p)
+ssize_t uper_c_source_aq_decode(
+    struct uper_c_source_aq_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint32_t value;
+    struct decoder_t decoder;
 
-    switch (src_p->value) {
-    case uper_c_source_an_a_e:
-        value = 0;
-        break;
-    case uper_c_source_an_b_e:
-        value = 1;
-        break;
-    case uper_c_source_an_c_e:
-        value = 2;
-        break;
-    case uper_c_source_an_d_e:
-        value = 3;
-        break;
-    case uper_c_source_an_e_e:
-        value = 4;
-        break;
-    case uper_c_source_an_f_e:
-        value = 5;
-        break;
-    case uper_c_source_an_g_e:
-        value = 6;
-        break;
-    case uper_c_source_an_h_e:
-        value = 7;
-        break;
-    case uper_c_source_an_i_e:
-        value = 8;
-        break;
-    case uper_c_source_an_j_e:
-        value = 9;
-        break;
-    case uper_c_source_an_k_e:
-        value = 10;
-        break;
-    default:
-        encoder_abort(encoder_p, EBADENUM);
-        return;
-    }
-    encoder_append_non_negative_binary_integer(encoder_p, value, 4);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_aq_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_an_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_an_t *dst_p)
+ssize_t uper_c_source_aq_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint32_t value;
+    struct decoder_t decoder;
 
-    value = decoder_read_non_negative_binary_integer(decoder_p, 4);
-    switch (value) {
-    case 0:
-        dst_p->value = uper_c_source_an_a_e;
-        break;
-    case 1:
-        dst_p->value = uper_c_source_an_b_e;
-        break;
-    case 2:
-        dst_p->value = uper_c_source_an_c_e;
-        break;
-    case 3:
-        dst_p->value = uper_c_source_an_d_e;
-        break;
-    case 4:
-        dst_p->value = uper_c_source_an_e_e;
-        break;
-    case 5:
-        dst_p->value = uper_c_source_an_f_e;
-        break;
-    case 6:
-        dst_p->value = uper_c_source_an_g_e;
-        break;
-    case 7:
-        dst_p->value = uper_c_source_an_h_e;
-        break;
-    case 8:
-        dst_p->value = uper_c_source_an_i_e;
-        break;
-    case 9:
-        dst_p->value = uper_c_source_an_j_e;
-        break;
-    case 10:
-        dst_p->value = uper_c_source_an_k_e;
-        break;
-    default:
-        decoder_abort(decoder_p, EBADENUM);
-        return;
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_aq_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_aq_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_aq_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_aq_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ao_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ao_t *src_p)
+ssize_t uper_c_source_aq_decode_batch(
+    struct uper_c_source_aq_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->a),
-        8);
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->b),
-        24);
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->c),
-        4);
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->d),
-        32);
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->e),
-        64);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_aq_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ao_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ao_t *dst_p)
+ssize_t uper_c_source_ar_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ar_t *src_p)
 {
-    dst_p->a = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        8);
-    dst_p->b = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        24);
-    dst_p->c = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        4);
-    dst_p->d = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        32);
-    dst_p->e = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        64);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_ar_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_ref_referenced_sequence_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_ref_referenced_sequence_t *src_p)
+ssize_t uper_c_source_ar_encoded_size(
+    const struct uper_c_source_ar_t *src_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->a - 0),
-        7);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_ar_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_ref_referenced_sequence_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_ref_referenced_sequence_t *dst_p)
+ssize_t uper_c_source_ar_decode(
+    struct uper_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->a = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        7);
-    dst_p->a += 0;
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ar_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_ref_referenced_enum_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_ref_referenced_enum_t *src_p)
+ssize_t uper_c_source_ar_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t value;
+    struct decoder_t decoder;
 
-    value = src_p->value;
-    encoder_append_non_negative_binary_integer(encoder_p, value, 2);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ar_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_ref_referenced_enum_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_ref_referenced_enum_t *dst_p)
+ssize_t uper_c_source_ar_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_ar_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t value;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+    pos = 0;
 
-    if (value > 2u) {
-        decoder_abort(decoder_p, EBADENUM);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_ar_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-        return;
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    dst_p->value = (enum uper_c_ref_referenced_enum_e)value;
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_ap_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ap_t *src_p)
+ssize_t uper_c_source_ar_decode_batch(
+    struct uper_c_source_ar_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_bool(encoder_p, src_p->c.value != uper_c_ref_referenced_enum_a_e);
-    encoder_append_bool(encoder_p, src_p->d != 1);
-    uper_c_ref_referenced_sequence_encode_inner(encoder_p, &src_p->b);
-
-    if (src_p->c.value != uper_c_ref_referenced_enum_a_e) {
-        uper_c_ref_referenced_enum_encode_inner(encoder_p, &src_p->c);
-    }
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (src_p->d != 1) {
-        encoder_append_uint8(encoder_p, src_p->d);
-    }
-}
+    pos = 0;
 
-static void uper_c_source_ap_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ap_t *dst_p)
-{
-    bool is_present;
-    bool is_present_2;
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_ar_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    is_present = decoder_read_bool(decoder_p);
-    is_present_2 = decoder_read_bool(decoder_p);
-    uper_c_ref_referenced_sequence_decode_inner(decoder_p, &dst_p->b);
+        if (res < 0) {
+            return (res);
+        }
 
-    if (is_present) {
-        uper_c_ref_referenced_enum_decode_inner(decoder_p, &dst_p->c);
-    } else {
-        dst_p->c.value = uper_c_ref_referenced_enum_a_e;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    if (is_present_2) {
-        dst_p->d = decoder_read_uint8(decoder_p);
-    } else {
-        dst_p->d = 1;
-    }
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_aq_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_aq_t *src_p)
+ssize_t uper_c_source_ar_decode_fields(
+    struct uper_c_source_ar_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - 0),
-        24);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_ar_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_aq_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_aq_t *dst_p)
+ssize_t uper_c_source_as_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_as_t *src_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        24);
-    dst_p->value += 0;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_as_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_ar_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_ar_t *src_p)
+ssize_t uper_c_source_as_encoded_size(
+    const struct uper_c_source_as_t *src_p)
 {
-    static const uint8_t a_default[] = {0xAB, 0xCD};
+    struct encoder_t encoder;
 
-    encoder_append_bool(encoder_p, (memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
-                                   (src_p->a.length != sizeof(a_default)));
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_as_encode_inner(&encoder, src_p);
 
-    if ((memcmp(src_p->a.buf, a_default, sizeof(a_default)) != 0) ||
-        (src_p->a.length != sizeof(a_default))) {
-        encoder_append_non_negative_binary_integer(
-            encoder_p,
-            src_p->a.length - 0u,
-            4);
-        encoder_append_bytes(encoder_p,
-                             &src_p->a.buf[0],
-                             src_p->a.length);
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_ar_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_ar_t *dst_p)
+ssize_t uper_c_source_as_decode(
+    struct uper_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    bool is_present;
-    static const uint8_t a_default[] = {0xAB, 0xCD};
-
-    is_present = decoder_read_bool(decoder_p);
+    struct decoder_t decoder;
 
-    if (is_present) {
-        dst_p->a.length = decoder_read_non_negative_binary_integer(
-            decoder_p,
-            4);
-        dst_p->a.length += 0u;
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_as_decode_inner(&decoder, dst_p);
 
-        if (dst_p->a.length > 10u) {
-            decoder_abort(decoder_p, EBADLENGTH);
+    return (decoder_get_result(&decoder));
+}
 
-            return;
-        }
+ssize_t uper_c_source_as_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-        decoder_read_bytes(decoder_p,
-                           &dst_p->a.buf[0],
-                           dst_p->a.length);
-    } else {
-        memcpy(dst_p->a.buf, a_default, sizeof(a_default));
-        dst_p->a.length = sizeof(a_default);
-    }
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_as_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_as_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_as_t *src_p)
+ssize_t uper_c_source_as_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_as_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    encoder_append_bool(encoder_p, src_p->is_a_a_present);
-    encoder_append_bool(encoder_p, src_p->a_c != true);
-
-    if (src_p->is_a_a_present) {
-        encoder_append_bool(encoder_p, src_p->a_a);
-    }
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    switch (src_p->a_b.choice) {
+    pos = 0;
 
-    case uper_c_source_as_a_b_choice_b_a_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
-        encoder_append_bool(encoder_p, src_p->a_b.value.b_a);
-        break;
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_as_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    case uper_c_source_as_a_b_choice_b_b_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
-        encoder_append_bool(encoder_p, src_p->a_b.value.b_b);
-        break;
+        if (res < 0) {
+            return (res);
+        }
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    if (src_p->a_c != true) {
-        encoder_append_bool(encoder_p, src_p->a_c);
-    }
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_as_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_as_t *dst_p)
+ssize_t uper_c_source_as_decode_batch(
+    struct uper_c_source_as_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    bool is_present;
-    uint8_t choice;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    dst_p->is_a_a_present = decoder_read_bool(decoder_p);
-    is_present = decoder_read_bool(decoder_p);
+    pos = 0;
 
-    if (dst_p->is_a_a_present) {
-        dst_p->a_a = decoder_read_bool(decoder_p);
-    }
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_as_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+        if (res < 0) {
+            return (res);
+        }
 
-    switch (choice) {
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    case 0:
-        dst_p->a_b.choice = uper_c_source_as_a_b_choice_b_a_e;
-        dst_p->a_b.value.b_a = decoder_read_bool(decoder_p);
-        break;
+    return ((ssize_t)pos);
+}
 
-    case 1:
-        dst_p->a_b.choice = uper_c_source_as_a_b_choice_b_b_e;
-        dst_p->a_b.value.b_b = decoder_read_bool(decoder_p);
-        break;
+ssize_t uper_c_source_as_decode_fields(
+    struct uper_c_source_as_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
-    }
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_as_decode_fields_inner(&decoder, dst_p, fields);
 
-    if (is_present) {
-        dst_p->a_c = decoder_read_bool(decoder_p);
-    } else {
-        dst_p->a_c = true;
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_ref_at_encode_inner(
-    struct encoder_t *encoder_p,
+ssize_t uper_c_ref_at_encode(
+    uint8_t *dst_p,
+    size_t size,
     const struct uper_c_ref_at_t *src_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value),
-        2);
-}
+    struct encoder_t encoder;
 
-static void uper_c_ref_at_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_ref_at_t *dst_p)
-{
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        2);
+    encoder_init(&encoder, dst_p, size);
+    uper_c_ref_at_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_b_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_b_t *src_p)
+ssize_t uper_c_ref_at_encoded_size(
+    const struct uper_c_ref_at_t *src_p)
 {
-    switch (src_p->choice) {
-
-    case uper_c_source_b_choice_a_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 0, 2);
-        encoder_append_int8(encoder_p, src_p->value.a);
-        break;
-
-    case uper_c_source_b_choice_b_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 1, 2);
-        uper_c_source_a_encode_inner(encoder_p, &src_p->value.b);
-        break;
+    struct encoder_t encoder;
 
-    case uper_c_source_b_choice_c_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 2, 2);
-        break;
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_ref_at_encode_inner(&encoder, src_p);
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_b_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_b_t *dst_p)
+ssize_t uper_c_ref_at_decode(
+    struct uper_c_ref_at_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t choice;
-
-    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 2);
+    struct decoder_t decoder;
 
-    switch (choice) {
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_at_decode_inner(&decoder, dst_p);
 
-    case 0:
-        dst_p->choice = uper_c_source_b_choice_a_e;
-        dst_p->value.a = decoder_read_int8(decoder_p);
-        break;
+    return (decoder_get_result(&decoder));
+}
 
-    case 1:
-        dst_p->choice = uper_c_source_b_choice_b_e;
-        uper_c_source_a_decode_inner(decoder_p, &dst_p->value.b);
-        break;
+ssize_t uper_c_ref_at_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    case 2:
-        dst_p->choice = uper_c_source_b_choice_c_e;
-        break;
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_at_skip_inner(&decoder);
 
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_c_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_c_t *src_p)
+ssize_t uper_c_ref_at_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_ref_at_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint8_t i;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        src_p->length - 0u,
-        2);
+    pos = 0;
 
-    for (i = 0; i < src_p->length; i++) {
-        uper_c_source_b_encode_inner(encoder_p, &src_p->elements[i]);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_ref_at_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_c_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_c_t *dst_p)
+ssize_t uper_c_ref_at_decode_batch(
+    struct uper_c_ref_at_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t i;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    dst_p->length = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        2);
-    dst_p->length += 0u;
+    pos = 0;
 
-    if (dst_p->length > 2u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_ref_at_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        return;
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    for (i = 0; i < dst_p->length; i++) {
-        uper_c_source_b_decode_inner(decoder_p, &dst_p->elements[i]);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_e_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_e_t *src_p)
+ssize_t uper_c_source_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_b_t *src_p)
 {
-    switch (src_p->a.choice) {
+    struct encoder_t encoder;
 
-    case uper_c_source_e_a_choice_b_e:
-        encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_b_encode_inner(&encoder, src_p);
 
-        switch (src_p->a.value.b.choice) {
+    return (encoder_get_result(&encoder));
+}
 
-        case uper_c_source_e_a_b_choice_c_e:
-            encoder_append_non_negative_binary_integer(encoder_p, 0, 0);
-            encoder_append_bool(encoder_p, src_p->a.value.b.value.c);
-            break;
+ssize_t uper_c_source_b_encoded_size(
+    const struct uper_c_source_b_t *src_p)
+{
+    struct encoder_t encoder;
 
-        default:
-            encoder_abort(encoder_p, EBADCHOICE);
-            break;
-        }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_b_encode_inner(&encoder, src_p);
 
-        break;
+    return (encoder_get_result(&encoder));
+}
 
-    default:
-        encoder_abort(encoder_p, EBADCHOICE);
-        break;
-    }
+ssize_t uper_c_source_b_decode(
+    struct uper_c_source_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_e_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_e_t *dst_p)
+ssize_t uper_c_source_b_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uint8_t choice;
-    uint8_t choice_2;
+    struct decoder_t decoder;
 
-    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_b_skip_inner(&decoder);
 
-    switch (choice) {
+    return (decoder_get_result(&decoder));
+}
 
-    case 0:
-        dst_p->a.choice = uper_c_source_e_a_choice_b_e;
-        choice_2 = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 0);
+ssize_t uper_c_source_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-        switch (choice_2) {
+    pos = 0;
 
-        case 0:
-            dst_p->a.value.b.choice = uper_c_source_e_a_b_choice_c_e;
-            dst_p->a.value.b.value.c = decoder_read_bool(decoder_p);
-            break;
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-        default:
-            decoder_abort(decoder_p, EBADCHOICE);
-            break;
+        if (res < 0) {
+            return (res);
         }
 
-        break;
-
-    default:
-        decoder_abort(decoder_p, EBADCHOICE);
-        break;
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_f_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_f_t *src_p)
+ssize_t uper_c_source_b_decode_batch(
+    struct uper_c_source_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint8_t i;
-    uint8_t i_2;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        src_p->length - 1u,
-        1);
+    pos = 0;
 
-    for (i = 0; i < src_p->length; i++) {
-        for (i_2 = 0; i_2 < 1; i_2++) {
-            encoder_append_bool(encoder_p, src_p->elements[i].elements[i_2]);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
         }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_f_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_f_t *dst_p)
+ssize_t uper_c_source_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_c_t *src_p)
 {
-    uint8_t i;
-    uint8_t i_2;
+    struct encoder_t encoder;
 
-    dst_p->length = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        1);
-    dst_p->length += 1u;
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_c_encode_inner(&encoder, src_p);
 
-    for (i = 0; i < dst_p->length; i++) {
-        for (i_2 = 0; i_2 < 1; i_2++) {
-            dst_p->elements[i].elements[i_2] = decoder_read_bool(decoder_p);
-        }
-    }
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_g_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_g_t *src_p)
+ssize_t uper_c_source_c_encoded_size(
+    const struct uper_c_source_c_t *src_p)
 {
-    encoder_append_bool(encoder_p, src_p->is_a_present);
-    encoder_append_bool(encoder_p, src_p->is_b_present);
-    encoder_append_bool(encoder_p, src_p->is_c_present);
-    encoder_append_bool(encoder_p, src_p->is_d_present);
-    encoder_append_bool(encoder_p, src_p->is_e_present);
-    encoder_append_bool(encoder_p, src_p->is_f_present);
-    encoder_append_bool(encoder_p, src_p->is_g_present);
-    encoder_append_bool(encoder_p, src_p->is_h_present);
-    encoder_append_bool(encoder_p, src_p->is_i_present);
-
-    if (src_p->is_a_present) {
-        encoder_append_bool(encoder_p, src_p->a);
-    }
+    struct encoder_t encoder;
 
-    if (src_p->is_b_present) {
-        encoder_append_bool(encoder_p, src_p->b);
-    }
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_c_encode_inner(&encoder, src_p);
 
-    if (src_p->is_c_present) {
-        encoder_append_bool(encoder_p, src_p->c);
-    }
+    return (encoder_get_result(&encoder));
+}
 
-    if (src_p->is_d_present) {
-        encoder_append_bool(encoder_p, src_p->d);
-    }
+ssize_t uper_c_source_c_decode(
+    struct uper_c_source_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    if (src_p->is_e_present) {
-        encoder_append_bool(encoder_p, src_p->e);
-    }
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_c_decode_inner(&decoder, dst_p);
 
-    if (src_p->is_f_present) {
-        encoder_append_bool(encoder_p, src_p->f);
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    if (src_p->is_g_present) {
-        encoder_append_bool(encoder_p, src_p->g);
-    }
+ssize_t uper_c_source_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
 
-    if (src_p->is_h_present) {
-        encoder_append_bool(encoder_p, src_p->h);
-    }
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_c_skip_inner(&decoder);
 
-    if (src_p->is_i_present) {
-        encoder_append_bool(encoder_p, src_p->i);
-    }
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_g_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_g_t *dst_p)
+ssize_t uper_c_source_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->is_a_present = decoder_read_bool(decoder_p);
-    dst_p->is_b_present = decoder_read_bool(decoder_p);
-    dst_p->is_c_present = decoder_read_bool(decoder_p);
-    dst_p->is_d_present = decoder_read_bool(decoder_p);
-    dst_p->is_e_present = decoder_read_bool(decoder_p);
-    dst_p->is_f_present = decoder_read_bool(decoder_p);
-    dst_p->is_g_present = decoder_read_bool(decoder_p);
-    dst_p->is_h_present = decoder_read_bool(decoder_p);
-    dst_p->is_i_present = decoder_read_bool(decoder_p);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (dst_p->is_a_present) {
-        dst_p->a = decoder_read_bool(decoder_p);
-    }
+    pos = 0;
 
-    if (dst_p->is_b_present) {
-        dst_p->b = decoder_read_bool(decoder_p);
-    }
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
 
-    if (dst_p->is_c_present) {
-        dst_p->c = decoder_read_bool(decoder_p);
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    if (dst_p->is_d_present) {
-        dst_p->d = decoder_read_bool(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
 
-    if (dst_p->is_e_present) {
-        dst_p->e = decoder_read_bool(decoder_p);
-    }
+    return ((ssize_t)pos);
+}
 
-    if (dst_p->is_f_present) {
-        dst_p->f = decoder_read_bool(decoder_p);
-    }
+ssize_t uper_c_source_c_decode_batch(
+    struct uper_c_source_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    if (dst_p->is_g_present) {
-        dst_p->g = decoder_read_bool(decoder_p);
-    }
+    pos = 0;
 
-    if (dst_p->is_h_present) {
-        dst_p->h = decoder_read_bool(decoder_p);
-    }
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-    if (dst_p->is_i_present) {
-        dst_p->i = decoder_read_bool(decoder_p);
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_h_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_h_t *src_p)
+ssize_t uper_c_source_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_e_t *src_p)
 {
-    (void)encoder_p;
-    (void)src_p;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_h_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_h_t *dst_p)
+ssize_t uper_c_source_e_encoded_size(
+    const struct uper_c_source_e_t *src_p)
 {
-    (void)decoder_p;
-    (void)dst_p;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_i_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_i_t *src_p)
+ssize_t uper_c_source_e_decode(
+    struct uper_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_bytes(encoder_p,
-                         &src_p->buf[0],
-                         24);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_i_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_i_t *dst_p)
+ssize_t uper_c_source_e_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    decoder_read_bytes(decoder_p,
-                       &dst_p->buf[0],
-                       24);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_j_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_j_t *src_p)
+ssize_t uper_c_source_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        src_p->length - 22u,
-        1);
-    encoder_append_bytes(encoder_p,
-                         &src_p->buf[0],
-                         src_p->length);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_j_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_j_t *dst_p)
+ssize_t uper_c_source_e_decode_batch(
+    struct uper_c_source_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    dst_p->length = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        1);
-    dst_p->length += 22u;
-    decoder_read_bytes(decoder_p,
-                       &dst_p->buf[0],
-                       dst_p->length);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_k_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_k_t *src_p)
+ssize_t uper_c_source_e_decode_fields(
+    struct uper_c_source_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    uint8_t value;
+    struct decoder_t decoder;
 
-    value = src_p->value;
-    encoder_append_non_negative_binary_integer(encoder_p, value, 0);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_k_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_k_t *dst_p)
+ssize_t uper_c_source_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_f_t *src_p)
 {
-    uint8_t value;
+    struct encoder_t encoder;
 
-    value = decoder_read_non_negative_binary_integer(decoder_p, 0);
-    dst_p->value = (enum uper_c_source_k_e)value;
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_l_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_l_t *src_p)
+ssize_t uper_c_source_f_encoded_size(
+    const struct uper_c_source_f_t *src_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        src_p->length - 0u,
-        9);
-    encoder_append_bytes(encoder_p,
-                         &src_p->buf[0],
-                         src_p->length);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_f_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_l_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_l_t *dst_p)
+ssize_t uper_c_source_f_decode(
+    struct uper_c_source_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->length = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        9);
-    dst_p->length += 0u;
+    struct decoder_t decoder;
 
-    if (dst_p->length > 500u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_f_decode_inner(&decoder, dst_p);
 
-        return;
-    }
+    return (decoder_get_result(&decoder));
+}
 
-    decoder_read_bytes(decoder_p,
-                       &dst_p->buf[0],
-                       dst_p->length);
+ssize_t uper_c_source_f_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_f_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_o_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_o_t *src_p)
+ssize_t uper_c_source_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_f_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uint16_t i;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        src_p->length - 1u,
-        9);
+    pos = 0;
 
-    for (i = 0; i < src_p->length; i++) {
-        encoder_append_bool(encoder_p, src_p->elements[i]);
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_f_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_o_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_o_t *dst_p)
+ssize_t uper_c_source_f_decode_batch(
+    struct uper_c_source_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uint16_t i;
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    dst_p->length = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        9);
-    dst_p->length += 1u;
+    pos = 0;
 
-    if (dst_p->length > 260u) {
-        decoder_abort(decoder_p, EBADLENGTH);
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_f_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-        return;
-    }
+        if (res < 0) {
+            return (res);
+        }
 
-    for (i = 0; i < dst_p->length; i++) {
-        dst_p->elements[i] = decoder_read_bool(decoder_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
     }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_n_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_n_t *src_p)
+ssize_t uper_c_source_g_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_g_t *src_p)
 {
-    uper_c_source_k_encode_inner(encoder_p, &src_p->a);
-    uper_c_source_a_encode_inner(encoder_p, &src_p->b);
-    uper_c_source_o_encode_inner(encoder_p, &src_p->c);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_g_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_n_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_n_t *dst_p)
+ssize_t uper_c_source_g_encoded_size(
+    const struct uper_c_source_g_t *src_p)
 {
-    uper_c_source_k_decode_inner(decoder_p, &dst_p->a);
-    uper_c_source_a_decode_inner(decoder_p, &dst_p->b);
-    uper_c_source_o_decode_inner(decoder_p, &dst_p->c);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_g_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_m_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_m_t *src_p)
+ssize_t uper_c_source_g_decode(
+    struct uper_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    uper_c_source_k_encode_inner(encoder_p, &src_p->a);
-    uper_c_source_n_encode_inner(encoder_p, &src_p->b);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_g_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_m_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_m_t *dst_p)
+ssize_t uper_c_source_g_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    uper_c_source_k_decode_inner(decoder_p, &dst_p->a);
-    uper_c_source_n_decode_inner(decoder_p, &dst_p->b);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_g_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_p_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_p_t *src_p)
+ssize_t uper_c_source_g_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_g_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    uper_c_source_a_encode_inner(encoder_p, &src_p->a);
-    uper_c_source_m_encode_inner(encoder_p, &src_p->b);
-    uper_c_source_f_encode_inner(encoder_p, &src_p->c);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_g_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_p_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_p_t *dst_p)
+ssize_t uper_c_source_g_decode_batch(
+    struct uper_c_source_g_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    uper_c_source_a_decode_inner(decoder_p, &dst_p->a);
-    uper_c_source_m_decode_inner(decoder_p, &dst_p->b);
-    uper_c_source_f_decode_inner(decoder_p, &dst_p->c);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_g_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_r_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_r_t *src_p)
+ssize_t uper_c_source_g_decode_fields(
+    struct uper_c_source_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -1),
-        1);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_g_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_r_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_r_t *dst_p)
+ssize_t uper_c_source_h_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_h_t *src_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        1);
-    dst_p->value += -1;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_ref_referenced_int_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_ref_referenced_int_t *src_p)
+ssize_t uper_c_source_h_encoded_size(
+    const struct uper_c_source_h_t *src_p)
 {
-    encoder_append_uint8(encoder_p, src_p->value);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_h_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_ref_referenced_int_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_ref_referenced_int_t *dst_p)
-{
-    dst_p->value = decoder_read_uint8(decoder_p);
+ssize_t uper_c_source_h_decode(
+    struct uper_c_source_h_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_h_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_s_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_s_t *src_p)
+ssize_t uper_c_source_h_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -2),
-        2);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_h_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_s_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_s_t *dst_p)
+ssize_t uper_c_source_h_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_h_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        2);
-    dst_p->value += -2;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_h_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_t_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_t_t *src_p)
+ssize_t uper_c_source_h_decode_batch(
+    struct uper_c_source_h_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -1),
-        2);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_h_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_t_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_t_t *dst_p)
+ssize_t uper_c_source_i_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_i_t *src_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        2);
-    dst_p->value += -1;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_i_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_u_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_u_t *src_p)
+ssize_t uper_c_source_i_encoded_size(
+    const struct uper_c_source_i_t *src_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -64),
-        7);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_i_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_u_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_u_t *dst_p)
+ssize_t uper_c_source_i_decode(
+    struct uper_c_source_i_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        7);
-    dst_p->value += -64;
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_i_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_v_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_v_t *src_p)
+ssize_t uper_c_source_i_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_int8(encoder_p, src_p->value);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_i_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_v_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_v_t *dst_p)
+ssize_t uper_c_source_i_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_i_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->value = decoder_read_int8(decoder_p);
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_i_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_w_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_w_t *src_p)
+ssize_t uper_c_source_i_decode_batch(
+    struct uper_c_source_i_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -1),
-        9);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_i_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_w_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_w_t *dst_p)
+ssize_t uper_c_source_j_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_j_t *src_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        9);
-    dst_p->value += -1;
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_x_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_x_t *src_p)
+ssize_t uper_c_source_j_encoded_size(
+    const struct uper_c_source_j_t *src_p)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - -2),
-        10);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_j_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-static void uper_c_source_x_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_x_t *dst_p)
+ssize_t uper_c_source_j_decode(
+    struct uper_c_source_j_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        10);
-    dst_p->value += -2;
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_j_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_y_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_y_t *src_p)
+ssize_t uper_c_source_j_skip(
+    const uint8_t *src_p,
+    size_t size)
 {
-    encoder_append_non_negative_binary_integer(
-        encoder_p,
-        (uint64_t)(src_p->value - 10000),
-        10);
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_j_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
 }
 
-static void uper_c_source_y_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_y_t *dst_p)
+ssize_t uper_c_source_j_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_j_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
-    dst_p->value = decoder_read_non_negative_binary_integer(
-        decoder_p,
-        10);
-    dst_p->value += 10000;
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_j_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_z_encode_inner(
-    struct encoder_t *encoder_p,
-    const struct uper_c_source_z_t *src_p)
+ssize_t uper_c_source_j_decode_batch(
+    struct uper_c_source_j_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
 {
-    encoder_append_bool(encoder_p, src_p->value);
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_j_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-static void uper_c_source_z_decode_inner(
-    struct decoder_t *decoder_p,
-    struct uper_c_source_z_t *dst_p)
+ssize_t uper_c_source_k_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_k_t *src_p)
 {
-    dst_p->value = decoder_read_bool(decoder_p);
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_k_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_a_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_a_t *src_p)
+ssize_t uper_c_source_k_encoded_size(
+    const struct uper_c_source_k_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_a_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_k_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_a_decode(
-    struct uper_c_source_a_t *dst_p,
+ssize_t uper_c_source_k_decode(
+    struct uper_c_source_k_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_a_decode_inner(&decoder, dst_p);
+    uper_c_source_k_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ab_encode(
+ssize_t uper_c_source_k_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_k_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_k_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ab_t *src_p)
+    const struct uper_c_source_k_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_ab_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_k_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ab_decode(
-    struct uper_c_source_ab_t *dst_p,
+ssize_t uper_c_source_k_decode_batch(
+    struct uper_c_source_k_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_ab_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_k_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_q_encode(
+ssize_t uper_c_source_l_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_q_t *src_p)
+    const struct uper_c_source_l_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_q_encode_inner(&encoder, src_p);
+    uper_c_source_l_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_q_decode(
-    struct uper_c_source_q_t *dst_p,
+ssize_t uper_c_source_l_encoded_size(
+    const struct uper_c_source_l_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_l_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_l_decode(
+    struct uper_c_source_l_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_q_decode_inner(&decoder, dst_p);
+    uper_c_source_l_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_d_encode(
+ssize_t uper_c_source_l_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_l_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_l_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_d_t *src_p)
+    const struct uper_c_source_l_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_d_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_l_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_d_decode(
-    struct uper_c_source_d_t *dst_p,
+ssize_t uper_c_source_l_decode_batch(
+    struct uper_c_source_l_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_d_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_l_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ac_encode(
+ssize_t uper_c_source_o_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ac_t *src_p)
+    const struct uper_c_source_o_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_ac_encode_inner(&encoder, src_p);
+    uper_c_source_o_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_ac_decode(
-    struct uper_c_source_ac_t *dst_p,
+ssize_t uper_c_source_o_encoded_size(
+    const struct uper_c_source_o_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_o_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_o_decode(
+    struct uper_c_source_o_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_ac_decode_inner(&decoder, dst_p);
+    uper_c_source_o_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ad_encode(
+ssize_t uper_c_source_o_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_o_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_o_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ad_t *src_p)
+    const struct uper_c_source_o_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_ad_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_o_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ad_decode(
-    struct uper_c_source_ad_t *dst_p,
+ssize_t uper_c_source_o_decode_batch(
+    struct uper_c_source_o_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_ad_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_o_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ae_encode(
+ssize_t uper_c_source_n_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ae_t *src_p)
+    const struct uper_c_source_n_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_ae_encode_inner(&encoder, src_p);
+    uper_c_source_n_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_ae_decode(
-    struct uper_c_source_ae_t *dst_p,
+ssize_t uper_c_source_n_encoded_size(
+    const struct uper_c_source_n_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_n_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_n_decode(
+    struct uper_c_source_n_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_ae_decode_inner(&decoder, dst_p);
+    uper_c_source_n_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ah_encode(
+ssize_t uper_c_source_n_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_n_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_c_source_n_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ah_t *src_p)
+    const struct uper_c_source_n_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_ah_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_n_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ah_decode(
-    struct uper_c_source_ah_t *dst_p,
+ssize_t uper_c_source_n_decode_batch(
+    struct uper_c_source_n_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_n_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_n_decode_fields(
+    struct uper_c_source_n_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_ah_decode_inner(&decoder, dst_p);
+    uper_c_source_n_decode_fields_inner(&decoder, dst_p, fields);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_af_encode(
+ssize_t uper_c_source_m_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_af_t *src_p)
+    const struct uper_c_source_m_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_af_encode_inner(&encoder, src_p);
+    uper_c_source_m_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_af_decode(
-    struct uper_c_source_af_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_m_encoded_size(
+    const struct uper_c_source_m_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_af_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_m_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_ag_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_ag_t *src_p)
+ssize_t uper_c_source_m_decode(
+    struct uper_c_source_m_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_ag_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_m_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ag_decode(
-    struct uper_c_source_ag_t *dst_p,
+ssize_t uper_c_source_m_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_ag_decode_inner(&decoder, dst_p);
+    uper_c_source_m_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_aj_encode(
+ssize_t uper_c_source_m_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_aj_t *src_p)
+    const struct uper_c_source_m_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_aj_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_m_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_aj_decode(
-    struct uper_c_source_aj_t *dst_p,
+ssize_t uper_c_source_m_decode_batch(
+    struct uper_c_source_m_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_aj_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
-}
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_m_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-ssize_t uper_c_source_ak_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_ak_t *src_p)
-{
-    struct encoder_t encoder;
+        if (res < 0) {
+            return (res);
+        }
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_ak_encode_inner(&encoder, src_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    return (encoder_get_result(&encoder));
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ak_decode(
-    struct uper_c_source_ak_t *dst_p,
+ssize_t uper_c_source_m_decode_fields(
+    struct uper_c_source_m_t *dst_p,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    uint64_t fields)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_ak_decode_inner(&decoder, dst_p);
+    uper_c_source_m_decode_fields_inner(&decoder, dst_p, fields);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ai_encode(
+ssize_t uper_c_source_p_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ai_t *src_p)
+    const struct uper_c_source_p_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_ai_encode_inner(&encoder, src_p);
+    uper_c_source_p_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_ai_decode(
-    struct uper_c_source_ai_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_p_encoded_size(
+    const struct uper_c_source_p_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_ai_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_p_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_al_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_al_t *src_p)
+ssize_t uper_c_source_p_decode(
+    struct uper_c_source_p_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_al_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_p_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_al_decode(
-    struct uper_c_source_al_t *dst_p,
+ssize_t uper_c_source_p_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_al_decode_inner(&decoder, dst_p);
+    uper_c_source_p_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_am_encode(
+ssize_t uper_c_source_p_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_am_t *src_p)
+    const struct uper_c_source_p_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_am_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_p_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_am_decode(
-    struct uper_c_source_am_t *dst_p,
+ssize_t uper_c_source_p_decode_batch(
+    struct uper_c_source_p_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_am_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
-}
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_p_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
 
-ssize_t uper_c_source_an_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_an_t *src_p)
-{
-    struct encoder_t encoder;
+        if (res < 0) {
+            return (res);
+        }
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_an_encode_inner(&encoder, src_p);
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
 
-    return (encoder_get_result(&encoder));
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_an_decode(
-    struct uper_c_source_an_t *dst_p,
+ssize_t uper_c_source_p_decode_fields(
+    struct uper_c_source_p_t *dst_p,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    uint64_t fields)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_an_decode_inner(&decoder, dst_p);
+    uper_c_source_p_decode_fields_inner(&decoder, dst_p, fields);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ao_encode(
+ssize_t uper_c_source_r_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ao_t *src_p)
+    const struct uper_c_source_r_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_ao_encode_inner(&encoder, src_p);
+    uper_c_source_r_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_ao_decode(
-    struct uper_c_source_ao_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_r_encoded_size(
+    const struct uper_c_source_r_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_ao_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_r_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_ref_referenced_sequence_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_ref_referenced_sequence_t *src_p)
+ssize_t uper_c_source_r_decode(
+    struct uper_c_source_r_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_ref_referenced_sequence_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_r_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_ref_referenced_sequence_decode(
-    struct uper_c_ref_referenced_sequence_t *dst_p,
+ssize_t uper_c_source_r_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_ref_referenced_sequence_decode_inner(&decoder, dst_p);
+    uper_c_source_r_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_ref_referenced_enum_encode(
+ssize_t uper_c_source_r_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_ref_referenced_enum_t *src_p)
+    const struct uper_c_source_r_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_ref_referenced_enum_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_r_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_ref_referenced_enum_decode(
-    struct uper_c_ref_referenced_enum_t *dst_p,
+ssize_t uper_c_source_r_decode_batch(
+    struct uper_c_source_r_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_ref_referenced_enum_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_r_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ap_encode(
+ssize_t uper_c_ref_referenced_int_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ap_t *src_p)
+    const struct uper_c_ref_referenced_int_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_ap_encode_inner(&encoder, src_p);
+    uper_c_ref_referenced_int_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_ap_decode(
-    struct uper_c_source_ap_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_ref_referenced_int_encoded_size(
+    const struct uper_c_ref_referenced_int_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_ap_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_ref_referenced_int_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_aq_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_aq_t *src_p)
+ssize_t uper_c_ref_referenced_int_decode(
+    struct uper_c_ref_referenced_int_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_aq_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_ref_referenced_int_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_aq_decode(
-    struct uper_c_source_aq_t *dst_p,
+ssize_t uper_c_ref_referenced_int_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_aq_decode_inner(&decoder, dst_p);
+    uper_c_ref_referenced_int_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_ar_encode(
+ssize_t uper_c_ref_referenced_int_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_ar_t *src_p)
+    const struct uper_c_ref_referenced_int_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_ar_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_ref_referenced_int_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_ar_decode(
-    struct uper_c_source_ar_t *dst_p,
+ssize_t uper_c_ref_referenced_int_decode_batch(
+    struct uper_c_ref_referenced_int_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_ar_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_ref_referenced_int_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_c_source_s_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_c_source_s_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_c_source_s_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_as_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_as_t *src_p)
+ssize_t uper_c_source_s_encoded_size(
+    const struct uper_c_source_s_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_as_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_s_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_as_decode(
-    struct uper_c_source_as_t *dst_p,
+ssize_t uper_c_source_s_decode(
+    struct uper_c_source_s_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_as_decode_inner(&decoder, dst_p);
+    uper_c_source_s_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_ref_at_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_ref_at_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    uper_c_ref_at_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t uper_c_ref_at_decode(
-    struct uper_c_ref_at_t *dst_p,
+ssize_t uper_c_source_s_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_ref_at_decode_inner(&decoder, dst_p);
+    uper_c_source_s_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_b_encode(
+ssize_t uper_c_source_s_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_b_t *src_p)
+    const struct uper_c_source_s_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_b_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_s_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_b_decode(
-    struct uper_c_source_b_t *dst_p,
+ssize_t uper_c_source_s_decode_batch(
+    struct uper_c_source_s_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_b_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_s_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_c_encode(
+ssize_t uper_c_source_t_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_c_t *src_p)
+    const struct uper_c_source_t_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_c_encode_inner(&encoder, src_p);
+    uper_c_source_t_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_c_decode(
-    struct uper_c_source_c_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_t_encoded_size(
+    const struct uper_c_source_t_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_c_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_t_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_e_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_e_t *src_p)
+ssize_t uper_c_source_t_decode(
+    struct uper_c_source_t_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_e_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_t_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_e_decode(
-    struct uper_c_source_e_t *dst_p,
+ssize_t uper_c_source_t_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_e_decode_inner(&decoder, dst_p);
+    uper_c_source_t_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_f_encode(
+ssize_t uper_c_source_t_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_f_t *src_p)
+    const struct uper_c_source_t_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_f_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_t_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_f_decode(
-    struct uper_c_source_f_t *dst_p,
+ssize_t uper_c_source_t_decode_batch(
+    struct uper_c_source_t_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_f_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_t_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_g_encode(
+ssize_t uper_c_source_u_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_g_t *src_p)
+    const struct uper_c_source_u_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_g_encode_inner(&encoder, src_p);
+    uper_c_source_u_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_g_decode(
-    struct uper_c_source_g_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_u_encoded_size(
+    const struct uper_c_source_u_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_g_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_u_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_h_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_h_t *src_p)
+ssize_t uper_c_source_u_decode(
+    struct uper_c_source_u_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_h_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_u_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_h_decode(
-    struct uper_c_source_h_t *dst_p,
+ssize_t uper_c_source_u_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_h_decode_inner(&decoder, dst_p);
+    uper_c_source_u_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_i_encode(
+ssize_t uper_c_source_u_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_i_t *src_p)
+    const struct uper_c_source_u_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_i_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_u_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_i_decode(
-    struct uper_c_source_i_t *dst_p,
+ssize_t uper_c_source_u_decode_batch(
+    struct uper_c_source_u_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_i_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_u_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_j_encode(
+ssize_t uper_c_source_v_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_j_t *src_p)
+    const struct uper_c_source_v_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_j_encode_inner(&encoder, src_p);
+    uper_c_source_v_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_j_decode(
-    struct uper_c_source_j_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_v_encoded_size(
+    const struct uper_c_source_v_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_j_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_v_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_k_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_k_t *src_p)
+ssize_t uper_c_source_v_decode(
+    struct uper_c_source_v_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_k_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_v_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_k_decode(
-    struct uper_c_source_k_t *dst_p,
+ssize_t uper_c_source_v_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_k_decode_inner(&decoder, dst_p);
+    uper_c_source_v_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_l_encode(
+ssize_t uper_c_source_v_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_l_t *src_p)
+    const struct uper_c_source_v_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_l_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_v_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_l_decode(
-    struct uper_c_source_l_t *dst_p,
+ssize_t uper_c_source_v_decode_batch(
+    struct uper_c_source_v_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_l_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_v_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_o_encode(
+ssize_t uper_c_source_w_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_o_t *src_p)
+    const struct uper_c_source_w_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_o_encode_inner(&encoder, src_p);
+    uper_c_source_w_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_c_source_w_encoded_size(
+    const struct uper_c_source_w_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_w_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_o_decode(
-    struct uper_c_source_o_t *dst_p,
+ssize_t uper_c_source_w_decode(
+    struct uper_c_source_w_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_o_decode_inner(&decoder, dst_p);
+    uper_c_source_w_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_n_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_n_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_n_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t uper_c_source_n_decode(
-    struct uper_c_source_n_t *dst_p,
+ssize_t uper_c_source_w_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_n_decode_inner(&decoder, dst_p);
+    uper_c_source_w_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_m_encode(
+ssize_t uper_c_source_w_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_m_t *src_p)
+    const struct uper_c_source_w_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_m_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_w_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_m_decode(
-    struct uper_c_source_m_t *dst_p,
+ssize_t uper_c_source_w_decode_batch(
+    struct uper_c_source_w_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_m_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_w_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_p_encode(
+ssize_t uper_c_source_x_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_p_t *src_p)
+    const struct uper_c_source_x_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_p_encode_inner(&encoder, src_p);
+    uper_c_source_x_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_p_decode(
-    struct uper_c_source_p_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
-{
-    struct decoder_t decoder;
-
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_p_decode_inner(&decoder, dst_p);
-
-    return (decoder_get_result(&decoder));
-}
-
-ssize_t uper_c_source_r_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_r_t *src_p)
+ssize_t uper_c_source_x_encoded_size(
+    const struct uper_c_source_x_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_r_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_x_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_r_decode(
-    struct uper_c_source_r_t *dst_p,
+ssize_t uper_c_source_x_decode(
+    struct uper_c_source_x_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_r_decode_inner(&decoder, dst_p);
+    uper_c_source_x_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_ref_referenced_int_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_ref_referenced_int_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    uper_c_ref_referenced_int_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t uper_c_ref_referenced_int_decode(
-    struct uper_c_ref_referenced_int_t *dst_p,
+ssize_t uper_c_source_x_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_ref_referenced_int_decode_inner(&decoder, dst_p);
+    uper_c_source_x_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_s_encode(
+ssize_t uper_c_source_x_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_s_t *src_p)
+    const struct uper_c_source_x_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_s_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_x_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_s_decode(
-    struct uper_c_source_s_t *dst_p,
+ssize_t uper_c_source_x_decode_batch(
+    struct uper_c_source_x_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_s_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_x_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_t_encode(
+ssize_t uper_c_source_y_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_t_t *src_p)
+    const struct uper_c_source_y_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_t_encode_inner(&encoder, src_p);
+    uper_c_source_y_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_t_decode(
-    struct uper_c_source_t_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
-{
-    struct decoder_t decoder;
-
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_t_decode_inner(&decoder, dst_p);
-
-    return (decoder_get_result(&decoder));
-}
-
-ssize_t uper_c_source_u_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_u_t *src_p)
+ssize_t uper_c_source_y_encoded_size(
+    const struct uper_c_source_y_t *src_p)
 {
     struct encoder_t encoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_u_encode_inner(&encoder, src_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_y_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_u_decode(
-    struct uper_c_source_u_t *dst_p,
+ssize_t uper_c_source_y_decode(
+    struct uper_c_source_y_t *dst_p,
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_u_decode_inner(&decoder, dst_p);
+    uper_c_source_y_decode_inner(&decoder, dst_p);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_v_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_v_t *src_p)
-{
-    struct encoder_t encoder;
-
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_v_encode_inner(&encoder, src_p);
-
-    return (encoder_get_result(&encoder));
-}
-
-ssize_t uper_c_source_v_decode(
-    struct uper_c_source_v_t *dst_p,
+ssize_t uper_c_source_y_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_v_decode_inner(&decoder, dst_p);
+    uper_c_source_y_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_w_encode(
+ssize_t uper_c_source_y_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_w_t *src_p)
+    const struct uper_c_source_y_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_w_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_y_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_w_decode(
-    struct uper_c_source_w_t *dst_p,
+ssize_t uper_c_source_y_decode_batch(
+    struct uper_c_source_y_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_w_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_y_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_x_encode(
+ssize_t uper_c_source_z_encode(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_x_t *src_p)
+    const struct uper_c_source_z_t *src_p)
 {
     struct encoder_t encoder;
 
     encoder_init(&encoder, dst_p, size);
-    uper_c_source_x_encode_inner(&encoder, src_p);
+    uper_c_source_z_encode_inner(&encoder, src_p);
 
     return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_x_decode(
-    struct uper_c_source_x_t *dst_p,
-    const uint8_t *src_p,
-    size_t size)
+ssize_t uper_c_source_z_encoded_size(
+    const struct uper_c_source_z_t *src_p)
 {
-    struct decoder_t decoder;
+    struct encoder_t encoder;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_x_decode_inner(&decoder, dst_p);
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_c_source_z_encode_inner(&encoder, src_p);
 
-    return (decoder_get_result(&decoder));
+    return (encoder_get_result(&encoder));
 }
 
-ssize_t uper_c_source_y_encode(
-    uint8_t *dst_p,
-    size_t size,
-    const struct uper_c_source_y_t *src_p)
+ssize_t uper_c_source_z_decode(
+    struct uper_c_source_z_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
 {
-    struct encoder_t encoder;
+    struct decoder_t decoder;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_y_encode_inner(&encoder, src_p);
+    decoder_init(&decoder, src_p, size);
+    uper_c_source_z_decode_inner(&decoder, dst_p);
 
-    return (encoder_get_result(&encoder));
+    return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_y_decode(
-    struct uper_c_source_y_t *dst_p,
+ssize_t uper_c_source_z_skip(
     const uint8_t *src_p,
     size_t size)
 {
     struct decoder_t decoder;
 
     decoder_init(&decoder, src_p, size);
-    uper_c_source_y_decode_inner(&decoder, dst_p);
+    uper_c_source_z_skip_inner(&decoder);
 
     return (decoder_get_result(&decoder));
 }
 
-ssize_t uper_c_source_z_encode(
+ssize_t uper_c_source_z_encode_batch(
     uint8_t *dst_p,
     size_t size,
-    const struct uper_c_source_z_t *src_p)
+    const struct uper_c_source_z_t *src_p,
+    size_t count,
+    size_t *offsets_p)
 {
     struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    encoder_init(&encoder, dst_p, size);
-    uper_c_source_z_encode_inner(&encoder, src_p);
+    pos = 0;
 
-    return (encoder_get_result(&encoder));
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_c_source_z_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
 
-ssize_t uper_c_source_z_decode(
+ssize_t uper_c_source_z_decode_batch(
     struct uper_c_source_z_t *dst_p,
+    size_t count,
     const uint8_t *src_p,
-    size_t size)
+    size_t size,
+    size_t *offsets_p)
 {
     struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
 
-    decoder_init(&decoder, src_p, size);
-    uper_c_source_z_decode_inner(&decoder, dst_p);
+    pos = 0;
 
-    return (decoder_get_result(&decoder));
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_c_source_z_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
 }
@@ -0,0 +1,1588 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:13 2026.
+ */
+
+#include <string.h>
+
+#include "uper_arena.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    struct uper_arena_arena_t *arena_p;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static void *decoder_arena_alloc(struct decoder_t *self_p, size_t size)
+{
+    size_t pos;
+
+    /* Keep all allocations aligned for any member type. */
+    pos = ((self_p->arena_p->pos + 7u) & ~(size_t)7u);
+
+    if ((pos > self_p->arena_p->size)
+        || (size > (self_p->arena_p->size - pos))) {
+        decoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    self_p->arena_p->pos = (pos + size);
+
+    return (&self_p->arena_p->buf[pos]);
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static const uint8_t *decoder_read_bytes_arena(struct decoder_t *self_p,
+                                               size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = decoder_arena_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        decoder_read_bytes(self_p, buf_p, size);
+    }
+
+    return (buf_p);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static void uper_arena_arena_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arena_arena_a_t *src_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        10);
+
+    if (encoder_alloc(encoder_p, 16u * src_p->length) >= 0) {
+        for (i = 0; (i + 4u) <= src_p->length; i += 4u) {
+            bits = 0;
+
+            for (j = 0; j < 4u; j++) {
+                bits = ((bits << 16) | ((uint64_t)src_p->elements[i + j] & 0xffffu));
+            }
+
+            encoder_write_bits(encoder_p, bits, 64);
+        }
+
+        for (; i < src_p->length; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->elements[i], 16);
+        }
+    }
+}
+
+static void uper_arena_arena_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arena_arena_a_t *dst_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        10);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->elements = decoder_arena_alloc(
+        decoder_p,
+        dst_p->length * sizeof(dst_p->elements[0]));
+
+    if (dst_p->elements == NULL) {
+        return;
+    }
+
+    pos = decoder_free(decoder_p, 16u * dst_p->length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 3u) <= dst_p->length; i += 3u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 48);
+        pos += 48;
+
+        for (j = 0; j < 3u; j++) {
+            dst_p->elements[i + j] = (uint16_t)((bits >> (32u - (16u * j))) & 0xffffu);
+        }
+    }
+
+    for (; i < dst_p->length; i++) {
+        dst_p->elements[i] = (uint16_t)decoder_read_bits(decoder_p, (size_t)pos, 16);
+        pos += 16;
+    }
+}
+
+static void uper_arena_arena_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        10);
+    length += 0u;
+
+    if (length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 16u);
+}
+
+static void uper_arena_arena_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arena_arena_b_t *src_p)
+{
+    static const uint8_t c_default[] = {0x01, 0x02};
+
+    encoder_append_bool(encoder_p, src_p->is_b_present);
+    encoder_append_bool(encoder_p, (src_p->c.length != sizeof(c_default)) ||
+                                   (memcmp(src_p->c.buf, c_default, sizeof(c_default)) != 0));
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->a.length - 0u,
+        4);
+    encoder_append_bytes(encoder_p,
+                         &src_p->a.buf[0],
+                         src_p->a.length);
+
+    if (src_p->is_b_present) {
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->b.length - 0u,
+            9);
+        encoder_append_bytes(encoder_p,
+                             src_p->b.buf,
+                             src_p->b.length);
+    }
+
+    if ((src_p->c.length != sizeof(c_default)) ||
+        (memcmp(src_p->c.buf, c_default, sizeof(c_default)) != 0)) {
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->c.length - 0u,
+            9);
+        encoder_append_bytes(encoder_p,
+                             src_p->c.buf,
+                             src_p->c.length);
+    }
+
+    encoder_append_uint8(encoder_p, src_p->d);
+}
+
+static void uper_arena_arena_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arena_arena_b_t *dst_p)
+{
+    bool is_present;
+    static const uint8_t c_default[] = {0x01, 0x02};
+
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+    dst_p->a.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->a.length += 0u;
+
+    if (dst_p->a.length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->a.buf[0],
+                       dst_p->a.length);
+
+    if (dst_p->is_b_present) {
+        dst_p->b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            9);
+        dst_p->b.length += 0u;
+
+        if (dst_p->b.length > 500u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->b.buf = decoder_read_bytes_arena(decoder_p,
+                                                dst_p->b.length);
+    }
+
+    if (is_present) {
+        dst_p->c.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            9);
+        dst_p->c.length += 0u;
+
+        if (dst_p->c.length > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->c.buf = decoder_read_bytes_arena(decoder_p,
+                                                dst_p->c.length);
+    } else {
+        dst_p->c.buf = &c_default[0];
+        dst_p->c.length = sizeof(c_default);
+    }
+
+    dst_p->d = decoder_read_uint8(decoder_p);
+}
+
+static void uper_arena_arena_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arena_arena_b_t *dst_p,
+    uint64_t fields)
+{
+    bool is_present;
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    static const uint8_t c_default[] = {0x01, 0x02};
+
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    is_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_ARENA_ARENA_B_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->a.length += 0u;
+
+        if (dst_p->a.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->a.buf[0],
+                           dst_p->a.length);
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length += 0u;
+
+        if (length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 8u * length);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & UPER_ARENA_ARENA_B_FIELD_B) != 0u) {
+            dst_p->b.length = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                9);
+            dst_p->b.length += 0u;
+
+            if (dst_p->b.length > 500u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            dst_p->b.buf = decoder_read_bytes_arena(decoder_p,
+                                                    dst_p->b.length);
+        } else {
+            length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+                decoder_p,
+                9);
+            length_2 += 0u;
+
+            if (length_2 > 500u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, 8u * length_2);
+        }
+    }
+
+    if (is_present) {
+        if ((fields & UPER_ARENA_ARENA_B_FIELD_C) != 0u) {
+            dst_p->c.length = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                9);
+            dst_p->c.length += 0u;
+
+            if (dst_p->c.length > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            dst_p->c.buf = decoder_read_bytes_arena(decoder_p,
+                                                    dst_p->c.length);
+        } else {
+            length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+                decoder_p,
+                9);
+            length_3 += 0u;
+
+            if (length_3 > 300u) {
+                decoder_abort(decoder_p, EBADLENGTH);
+
+                return;
+            }
+
+            (void)decoder_free(decoder_p, 8u * length_3);
+        }
+    } else {
+        dst_p->c.buf = &c_default[0];
+        dst_p->c.length = sizeof(c_default);
+    }
+
+    if ((fields & UPER_ARENA_ARENA_B_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_uint8(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+}
+
+static void uper_arena_arena_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length += 0u;
+
+    if (length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 8u * length);
+    if (is_present) {
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            9);
+        length_2 += 0u;
+
+        if (length_2 > 500u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 8u * length_2);
+    }
+    if (is_present_2) {
+        length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            9);
+        length_3 += 0u;
+
+        if (length_3 > 300u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 8u * length_3);
+    }
+    (void)decoder_free(decoder_p, 8u);
+}
+
+static void uper_arena_arena_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arena_arena_c_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        2);
+
+    for (i = 0; i < src_p->length; i++) {
+        uper_arena_arena_a_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void uper_arena_arena_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arena_arena_c_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        uper_arena_arena_a_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void uper_arena_arena_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        2);
+    length += 0u;
+
+    if (length > 2u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        uper_arena_arena_a_skip_inner(decoder_p);
+    }
+}
+
+static void uper_arena_arena_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arena_arena_d_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        8);
+
+    for (i = 0; i < src_p->length; i++) {
+        encoder_append_bool(encoder_p, src_p->elements[i].a);
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            src_p->elements[i].b.length - 0u,
+            7);
+        encoder_append_bytes(encoder_p,
+                             src_p->elements[i].b.buf,
+                             src_p->elements[i].b.length);
+    }
+}
+
+static void uper_arena_arena_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arena_arena_d_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 200u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    dst_p->elements = decoder_arena_alloc(
+        decoder_p,
+        dst_p->length * sizeof(dst_p->elements[0]));
+
+    if (dst_p->elements == NULL) {
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        dst_p->elements[i].a = decoder_read_bool(decoder_p);
+        dst_p->elements[i].b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        dst_p->elements[i].b.length += 0u;
+
+        if (dst_p->elements[i].b.length > 100u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        dst_p->elements[i].b.buf = decoder_read_bytes_arena(decoder_p,
+                                                            dst_p->elements[i].b.length);
+    }
+}
+
+static void uper_arena_arena_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+    uint32_t length_2;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        8);
+    length += 0u;
+
+    if (length > 200u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        (void)decoder_free(decoder_p, 1u);
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        length_2 += 0u;
+
+        if (length_2 > 100u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 8u * length_2);
+    }
+}
+
+static void uper_arena_arena_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arena_arena_e_t *src_p)
+{
+    encoder_append_bytes(encoder_p,
+                         &src_p->buf[0],
+                         500);
+}
+
+static void uper_arena_arena_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arena_arena_e_t *dst_p)
+{
+    decoder_read_bytes(decoder_p,
+                       &dst_p->buf[0],
+                       500);
+}
+
+static void uper_arena_arena_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    (void)decoder_free(decoder_p, 4000u);
+}
+
+ssize_t uper_arena_arena_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arena_arena_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_a_encoded_size(
+    const struct uper_arena_arena_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arena_arena_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_a_decode(
+    struct uper_arena_arena_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    uper_arena_arena_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arena_arena_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arena_arena_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_a_decode_batch(
+    struct uper_arena_arena_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        uper_arena_arena_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arena_arena_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_b_encoded_size(
+    const struct uper_arena_arena_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arena_arena_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_b_decode(
+    struct uper_arena_arena_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    uper_arena_arena_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arena_arena_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arena_arena_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_b_decode_batch(
+    struct uper_arena_arena_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        uper_arena_arena_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_b_decode_fields(
+    struct uper_arena_arena_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    uper_arena_arena_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arena_arena_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_c_encoded_size(
+    const struct uper_arena_arena_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arena_arena_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_c_decode(
+    struct uper_arena_arena_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    uper_arena_arena_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arena_arena_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arena_arena_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_c_decode_batch(
+    struct uper_arena_arena_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        uper_arena_arena_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arena_arena_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_d_encoded_size(
+    const struct uper_arena_arena_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arena_arena_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_d_decode(
+    struct uper_arena_arena_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    uper_arena_arena_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arena_arena_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arena_arena_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_d_decode_batch(
+    struct uper_arena_arena_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        uper_arena_arena_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arena_arena_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_e_encoded_size(
+    const struct uper_arena_arena_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arena_arena_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arena_arena_e_decode(
+    struct uper_arena_arena_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    decoder.arena_p = arena_p;
+    uper_arena_arena_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arena_arena_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arena_arena_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arena_arena_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arena_arena_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arena_arena_e_decode_batch(
+    struct uper_arena_arena_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_arena_arena_t *arena_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        decoder.arena_p = arena_p;
+        uper_arena_arena_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
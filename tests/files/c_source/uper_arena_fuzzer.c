@@ -0,0 +1,374 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 10:42:22 2026.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "uper_arena.h"
+
+static void assert_first_encode(ssize_t res)
+{
+    if (res < 0) {
+        printf("First encode failed with %ld.\n", res);
+        __builtin_trap();
+    }
+}
+
+static void assert_encoded_size(ssize_t res, ssize_t size)
+{
+    if (res != size) {
+        printf("Encoded size %ld does not match first encode result %ld.\n",
+               size,
+               res);
+        __builtin_trap();
+    }
+}
+
+static void assert_second_decode(ssize_t res)
+{
+    if (res < 0) {
+        printf("Second decode failed with %ld.\n", res);
+        __builtin_trap();
+    }
+}
+
+static void assert_second_decode_data(const void *decoded_p,
+                                      const void *decoded2_p,
+                                      size_t size)
+{
+    if (memcmp(decoded_p, decoded2_p, size) != 0) {
+        printf("Second decode data does not match first decoded data.\n");
+        __builtin_trap();
+    }
+}
+
+static void assert_second_encode(ssize_t res, ssize_t res2)
+{
+    if (res != res2) {
+        printf("Second encode result %ld does not match first pack "
+               "result %ld.\n",
+               res,
+               res2);
+        __builtin_trap();
+    }
+}
+
+static void assert_second_encode_data(const uint8_t *encoded_p,
+                                      const uint8_t *encoded2_p,
+                                      ssize_t size)
+{
+    ssize_t i;
+
+    if (memcmp(encoded_p, encoded2_p, size) != 0) {
+        for (i = 0; i < size; i++) {
+            printf("[%04ld]: 0x%02x 0x%02x\n", i, encoded_p[i], encoded2_p[i]);
+        }
+
+        __builtin_trap();
+    }
+}
+
+static uint8_t arena_buf[1048576];
+
+static struct uper_arena_arena_t arena = {
+    .buf = &arena_buf[0],
+    .size = sizeof(arena_buf),
+    .pos = 0
+};
+
+
+static void test_uper_arena_arena_a(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    ssize_t res;
+    ssize_t res2;
+    ssize_t i;
+    uint8_t encoded[size];
+    uint8_t encoded2[size];
+    struct uper_arena_arena_a_t decoded;
+    struct uper_arena_arena_a_t decoded2;
+
+    memset(&decoded, 0, sizeof(decoded));
+    arena.pos = 0;
+
+    res = uper_arena_arena_a_decode(
+        &decoded,
+        encoded_p,
+        size,
+        &arena);
+
+    if (res >= 0) {
+        res = uper_arena_arena_a_encode(
+            &encoded[0],
+            sizeof(encoded),
+            &decoded);
+
+        assert_first_encode(res);
+        assert_encoded_size(res, uper_arena_arena_a_encoded_size(&decoded));
+
+        memset(&decoded2, 0, sizeof(decoded2));
+        arena.pos = 0;
+
+        res2 = uper_arena_arena_a_decode(
+            &decoded2,
+            &encoded[0],
+            res,
+        &arena);
+
+        assert_second_decode(res2);
+
+        res2 = uper_arena_arena_a_encode(
+            &encoded2[0],
+            sizeof(encoded2),
+            &decoded2);
+
+        assert_second_encode(res, res2);
+        assert_second_encode_data(&encoded[0], &encoded2[0], res);
+    }
+}
+
+static void test_uper_arena_arena_b(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    ssize_t res;
+    ssize_t res2;
+    ssize_t i;
+    uint8_t encoded[size];
+    uint8_t encoded2[size];
+    struct uper_arena_arena_b_t decoded;
+    struct uper_arena_arena_b_t decoded2;
+
+    memset(&decoded, 0, sizeof(decoded));
+    arena.pos = 0;
+
+    res = uper_arena_arena_b_decode(
+        &decoded,
+        encoded_p,
+        size,
+        &arena);
+
+    if (res >= 0) {
+        res = uper_arena_arena_b_encode(
+            &encoded[0],
+            sizeof(encoded),
+            &decoded);
+
+        assert_first_encode(res);
+        assert_encoded_size(res, uper_arena_arena_b_encoded_size(&decoded));
+
+        memset(&decoded2, 0, sizeof(decoded2));
+        arena.pos = 0;
+
+        res2 = uper_arena_arena_b_decode(
+            &decoded2,
+            &encoded[0],
+            res,
+        &arena);
+
+        assert_second_decode(res2);
+
+        res2 = uper_arena_arena_b_encode(
+            &encoded2[0],
+            sizeof(encoded2),
+            &decoded2);
+
+        assert_second_encode(res, res2);
+        assert_second_encode_data(&encoded[0], &encoded2[0], res);
+    }
+}
+
+static void test_uper_arena_arena_c(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    ssize_t res;
+    ssize_t res2;
+    ssize_t i;
+    uint8_t encoded[size];
+    uint8_t encoded2[size];
+    struct uper_arena_arena_c_t decoded;
+    struct uper_arena_arena_c_t decoded2;
+
+    memset(&decoded, 0, sizeof(decoded));
+    arena.pos = 0;
+
+    res = uper_arena_arena_c_decode(
+        &decoded,
+        encoded_p,
+        size,
+        &arena);
+
+    if (res >= 0) {
+        res = uper_arena_arena_c_encode(
+            &encoded[0],
+            sizeof(encoded),
+            &decoded);
+
+        assert_first_encode(res);
+        assert_encoded_size(res, uper_arena_arena_c_encoded_size(&decoded));
+
+        memset(&decoded2, 0, sizeof(decoded2));
+        arena.pos = 0;
+
+        res2 = uper_arena_arena_c_decode(
+            &decoded2,
+            &encoded[0],
+            res,
+        &arena);
+
+        assert_second_decode(res2);
+
+        res2 = uper_arena_arena_c_encode(
+            &encoded2[0],
+            sizeof(encoded2),
+            &decoded2);
+
+        assert_second_encode(res, res2);
+        assert_second_encode_data(&encoded[0], &encoded2[0], res);
+    }
+}
+
+static void test_uper_arena_arena_d(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    ssize_t res;
+    ssize_t res2;
+    ssize_t i;
+    uint8_t encoded[size];
+    uint8_t encoded2[size];
+    struct uper_arena_arena_d_t decoded;
+    struct uper_arena_arena_d_t decoded2;
+
+    memset(&decoded, 0, sizeof(decoded));
+    arena.pos = 0;
+
+    res = uper_arena_arena_d_decode(
+        &decoded,
+        encoded_p,
+        size,
+        &arena);
+
+    if (res >= 0) {
+        res = uper_arena_arena_d_encode(
+            &encoded[0],
+            sizeof(encoded),
+            &decoded);
+
+        assert_first_encode(res);
+        assert_encoded_size(res, uper_arena_arena_d_encoded_size(&decoded));
+
+        memset(&decoded2, 0, sizeof(decoded2));
+        arena.pos = 0;
+
+        res2 = uper_arena_arena_d_decode(
+            &decoded2,
+            &encoded[0],
+            res,
+        &arena);
+
+        assert_second_decode(res2);
+
+        res2 = uper_arena_arena_d_encode(
+            &encoded2[0],
+            sizeof(encoded2),
+            &decoded2);
+
+        assert_second_encode(res, res2);
+        assert_second_encode_data(&encoded[0], &encoded2[0], res);
+    }
+}
+
+static void test_uper_arena_arena_e(
+    const uint8_t *encoded_p,
+    size_t size)
+{
+    ssize_t res;
+    ssize_t res2;
+    ssize_t i;
+    uint8_t encoded[size];
+    uint8_t encoded2[size];
+    struct uper_arena_arena_e_t decoded;
+    struct uper_arena_arena_e_t decoded2;
+
+    memset(&decoded, 0, sizeof(decoded));
+    arena.pos = 0;
+
+    res = uper_arena_arena_e_decode(
+        &decoded,
+        encoded_p,
+        size,
+        &arena);
+
+    if (res >= 0) {
+        res = uper_arena_arena_e_encode(
+            &encoded[0],
+            sizeof(encoded),
+            &decoded);
+
+        assert_first_encode(res);
+        assert_encoded_size(res, uper_arena_arena_e_encoded_size(&decoded));
+
+        memset(&decoded2, 0, sizeof(decoded2));
+        arena.pos = 0;
+
+        res2 = uper_arena_arena_e_decode(
+            &decoded2,
+            &encoded[0],
+            res,
+        &arena);
+
+        assert_second_decode(res2);
+
+        res2 = uper_arena_arena_e_encode(
+            &encoded2[0],
+            sizeof(encoded2),
+            &decoded2);
+
+        assert_second_encode(res, res2);
+        assert_second_encode_data(&encoded[0], &encoded2[0], res);
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data_p, size_t size)
+{
+    test_uper_arena_arena_a(data_p, size);
+    test_uper_arena_arena_b(data_p, size);
+    test_uper_arena_arena_c(data_p, size);
+    test_uper_arena_arena_d(data_p, size);
+    test_uper_arena_arena_e(data_p, size);
+
+    return (0);
+}
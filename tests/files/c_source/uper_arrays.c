@@ -0,0 +1,2407 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:32 2026.
+ */
+
+#include <string.h>
+
+#include "uper_arrays.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_uint32(struct encoder_t *self_p,
+                                                uint32_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 32);
+}
+
+static ALWAYS_INLINE void encoder_append_uint64(struct encoder_t *self_p,
+                                                uint64_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 64);
+}
+
+static ALWAYS_INLINE void encoder_append_int32(struct encoder_t *self_p,
+                                               int32_t value)
+{
+    encoder_append_uint32(self_p, (uint32_t)value + 2147483648);
+}
+
+static ALWAYS_INLINE void encoder_append_int64(struct encoder_t *self_p,
+                                               int64_t value)
+{
+    uint64_t u64_value;
+
+    u64_value = (uint64_t)value;
+    u64_value += 9223372036854775808ull;
+
+    encoder_append_uint64(self_p, u64_value);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint32_t decoder_read_uint32(struct decoder_t *self_p)
+{
+    return ((uint32_t)decoder_read_non_negative_binary_integer(self_p, 32));
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_uint64(struct decoder_t *self_p)
+{
+    return (decoder_read_non_negative_binary_integer(self_p, 64));
+}
+
+static ALWAYS_INLINE int32_t decoder_read_int32(struct decoder_t *self_p)
+{
+    int32_t value;
+
+    value = (int32_t)decoder_read_uint32(self_p);
+    value -= 2147483648;
+
+    return (value);
+}
+
+static ALWAYS_INLINE int64_t decoder_read_int64(struct decoder_t *self_p)
+{
+    uint64_t value;
+
+    value = decoder_read_uint64(self_p);
+    value -= 9223372036854775808ull;
+
+    return ((int64_t)value);
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static void uper_arrays_arrays_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arrays_arrays_a_t *src_p)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    uint8_t i_2;
+    uint8_t j_2;
+    uint64_t bits_2;
+    uint8_t i_3;
+    uint8_t j_3;
+    uint64_t bits_3;
+    uint8_t i_4;
+    uint8_t j_4;
+    uint64_t bits_4;
+    uint8_t i_5;
+    uint8_t i_6;
+    uint8_t i_7;
+    uint8_t i_8;
+    uint8_t i_9;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->a.length - 0u,
+        4);
+
+    if (encoder_alloc(encoder_p, 8u * src_p->a.length) >= 0) {
+        for (i = 0; (i + 8u) <= src_p->a.length; i += 8u) {
+            bits = 0;
+
+            for (j = 0; j < 8u; j++) {
+                bits = ((bits << 8) | ((uint64_t)src_p->a.elements[i + j] & 0xffu));
+            }
+
+            encoder_write_bits(encoder_p, bits, 64);
+        }
+
+        for (; i < src_p->a.length; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->a.elements[i], 8);
+        }
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->b.length - 0u,
+        4);
+
+    if (encoder_alloc(encoder_p, 8u * src_p->b.length) >= 0) {
+        for (i_2 = 0; (i_2 + 8u) <= src_p->b.length; i_2 += 8u) {
+            bits_2 = 0;
+
+            for (j_2 = 0; j_2 < 8u; j_2++) {
+                bits_2 = ((bits_2 << 8) | ((uint64_t)(src_p->b.elements[i_2 + j_2] - -128) & 0xffu));
+            }
+
+            encoder_write_bits(encoder_p, bits_2, 64);
+        }
+
+        for (; i_2 < src_p->b.length; i_2++) {
+            encoder_write_bits(encoder_p, (uint64_t)(src_p->b.elements[i_2] - -128), 8);
+        }
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->c.length - 0u,
+        4);
+
+    if (encoder_alloc(encoder_p, 16u * src_p->c.length) >= 0) {
+        for (i_3 = 0; (i_3 + 4u) <= src_p->c.length; i_3 += 4u) {
+            bits_3 = 0;
+
+            for (j_3 = 0; j_3 < 4u; j_3++) {
+                bits_3 = ((bits_3 << 16) | ((uint64_t)src_p->c.elements[i_3 + j_3] & 0xffffu));
+            }
+
+            encoder_write_bits(encoder_p, bits_3, 64);
+        }
+
+        for (; i_3 < src_p->c.length; i_3++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->c.elements[i_3], 16);
+        }
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->d.length - 0u,
+        4);
+
+    if (encoder_alloc(encoder_p, 16u * src_p->d.length) >= 0) {
+        for (i_4 = 0; (i_4 + 4u) <= src_p->d.length; i_4 += 4u) {
+            bits_4 = 0;
+
+            for (j_4 = 0; j_4 < 4u; j_4++) {
+                bits_4 = ((bits_4 << 16) | ((uint64_t)(src_p->d.elements[i_4 + j_4] - -32768) & 0xffffu));
+            }
+
+            encoder_write_bits(encoder_p, bits_4, 64);
+        }
+
+        for (; i_4 < src_p->d.length; i_4++) {
+            encoder_write_bits(encoder_p, (uint64_t)(src_p->d.elements[i_4] - -32768), 16);
+        }
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->e.length - 0u,
+        4);
+
+    for (i_5 = 0; i_5 < src_p->e.length; i_5++) {
+        encoder_append_uint32(encoder_p, src_p->e.elements[i_5]);
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->f.length - 0u,
+        4);
+
+    for (i_6 = 0; i_6 < src_p->f.length; i_6++) {
+        encoder_append_int32(encoder_p, src_p->f.elements[i_6]);
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->g.length - 0u,
+        4);
+
+    for (i_7 = 0; i_7 < src_p->g.length; i_7++) {
+        encoder_append_uint64(encoder_p, src_p->g.elements[i_7]);
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->h.length - 0u,
+        4);
+
+    for (i_8 = 0; i_8 < src_p->h.length; i_8++) {
+        encoder_append_int64(encoder_p, src_p->h.elements[i_8]);
+    }
+
+    for (i_9 = 0; i_9 < 3; i_9++) {
+        encoder_append_bool(encoder_p, src_p->i.elements[i_9]);
+    }
+}
+
+static void uper_arrays_arrays_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_a_t *dst_p)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+    uint8_t i_2;
+    uint8_t j_2;
+    uint64_t bits_2;
+    ssize_t pos_2;
+    uint8_t i_3;
+    uint8_t j_3;
+    uint64_t bits_3;
+    ssize_t pos_3;
+    uint8_t i_4;
+    uint8_t j_4;
+    uint64_t bits_4;
+    ssize_t pos_4;
+    uint8_t i_5;
+    uint8_t i_6;
+    uint8_t i_7;
+    uint8_t i_8;
+    uint8_t i_9;
+
+    dst_p->a.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->a.length += 0u;
+
+    if (dst_p->a.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(decoder_p, 8u * dst_p->a.length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 7u) <= dst_p->a.length; i += 7u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 56);
+        pos += 56;
+
+        for (j = 0; j < 7u; j++) {
+            dst_p->a.elements[i + j] = (uint8_t)((bits >> (48u - (8u * j))) & 0xffu);
+        }
+    }
+
+    for (; i < dst_p->a.length; i++) {
+        dst_p->a.elements[i] = (uint8_t)decoder_read_bits(decoder_p, (size_t)pos, 8);
+        pos += 8;
+    }
+
+    dst_p->b.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->b.length += 0u;
+
+    if (dst_p->b.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos_2 = decoder_free(decoder_p, 8u * dst_p->b.length);
+
+    if (pos_2 < 0) {
+        return;
+    }
+
+    for (i_2 = 0; (i_2 + 7u) <= dst_p->b.length; i_2 += 7u) {
+        bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 56);
+        pos_2 += 56;
+
+        for (j_2 = 0; j_2 < 7u; j_2++) {
+            dst_p->b.elements[i_2 + j_2] = (int8_t)((int64_t)((bits_2 >> (48u - (8u * j_2))) & 0xffu) - 128);
+        }
+    }
+
+    for (; i_2 < dst_p->b.length; i_2++) {
+        dst_p->b.elements[i_2] = (int8_t)((int64_t)decoder_read_bits(decoder_p, (size_t)pos_2, 8) - 128);
+        pos_2 += 8;
+    }
+
+    dst_p->c.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->c.length += 0u;
+
+    if (dst_p->c.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos_3 = decoder_free(decoder_p, 16u * dst_p->c.length);
+
+    if (pos_3 < 0) {
+        return;
+    }
+
+    for (i_3 = 0; (i_3 + 3u) <= dst_p->c.length; i_3 += 3u) {
+        bits_3 = decoder_read_bits(decoder_p, (size_t)pos_3, 48);
+        pos_3 += 48;
+
+        for (j_3 = 0; j_3 < 3u; j_3++) {
+            dst_p->c.elements[i_3 + j_3] = (uint16_t)((bits_3 >> (32u - (16u * j_3))) & 0xffffu);
+        }
+    }
+
+    for (; i_3 < dst_p->c.length; i_3++) {
+        dst_p->c.elements[i_3] = (uint16_t)decoder_read_bits(decoder_p, (size_t)pos_3, 16);
+        pos_3 += 16;
+    }
+
+    dst_p->d.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->d.length += 0u;
+
+    if (dst_p->d.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos_4 = decoder_free(decoder_p, 16u * dst_p->d.length);
+
+    if (pos_4 < 0) {
+        return;
+    }
+
+    for (i_4 = 0; (i_4 + 3u) <= dst_p->d.length; i_4 += 3u) {
+        bits_4 = decoder_read_bits(decoder_p, (size_t)pos_4, 48);
+        pos_4 += 48;
+
+        for (j_4 = 0; j_4 < 3u; j_4++) {
+            dst_p->d.elements[i_4 + j_4] = (int16_t)((int64_t)((bits_4 >> (32u - (16u * j_4))) & 0xffffu) - 32768);
+        }
+    }
+
+    for (; i_4 < dst_p->d.length; i_4++) {
+        dst_p->d.elements[i_4] = (int16_t)((int64_t)decoder_read_bits(decoder_p, (size_t)pos_4, 16) - 32768);
+        pos_4 += 16;
+    }
+
+    dst_p->e.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->e.length += 0u;
+
+    if (dst_p->e.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i_5 = 0; i_5 < dst_p->e.length; i_5++) {
+        dst_p->e.elements[i_5] = decoder_read_uint32(decoder_p);
+    }
+
+    dst_p->f.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->f.length += 0u;
+
+    if (dst_p->f.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i_6 = 0; i_6 < dst_p->f.length; i_6++) {
+        dst_p->f.elements[i_6] = decoder_read_int32(decoder_p);
+    }
+
+    dst_p->g.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->g.length += 0u;
+
+    if (dst_p->g.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i_7 = 0; i_7 < dst_p->g.length; i_7++) {
+        dst_p->g.elements[i_7] = decoder_read_uint64(decoder_p);
+    }
+
+    dst_p->h.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->h.length += 0u;
+
+    if (dst_p->h.length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i_8 = 0; i_8 < dst_p->h.length; i_8++) {
+        dst_p->h.elements[i_8] = decoder_read_int64(decoder_p);
+    }
+
+    for (i_9 = 0; i_9 < 3; i_9++) {
+        dst_p->i.elements[i_9] = decoder_read_bool(decoder_p);
+    }
+}
+
+static void uper_arrays_arrays_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_a_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+    uint32_t length;
+    uint8_t i_2;
+    uint8_t j_2;
+    uint64_t bits_2;
+    ssize_t pos_2;
+    uint32_t length_2;
+    uint8_t i_3;
+    uint8_t j_3;
+    uint64_t bits_3;
+    ssize_t pos_3;
+    uint32_t length_3;
+    uint8_t i_4;
+    uint8_t j_4;
+    uint64_t bits_4;
+    ssize_t pos_4;
+    uint32_t length_4;
+    uint8_t i_5;
+    uint32_t length_5;
+    uint8_t i_6;
+    uint32_t length_6;
+    uint8_t i_7;
+    uint32_t length_7;
+    uint8_t i_8;
+    uint32_t length_8;
+    uint8_t i_9;
+
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_A) != 0u) {
+        dst_p->a.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->a.length += 0u;
+
+        if (dst_p->a.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        pos = decoder_free(decoder_p, 8u * dst_p->a.length);
+
+        if (pos < 0) {
+            return;
+        }
+
+        for (i = 0; (i + 7u) <= dst_p->a.length; i += 7u) {
+            bits = decoder_read_bits(decoder_p, (size_t)pos, 56);
+            pos += 56;
+
+            for (j = 0; j < 7u; j++) {
+                dst_p->a.elements[i + j] = (uint8_t)((bits >> (48u - (8u * j))) & 0xffu);
+            }
+        }
+
+        for (; i < dst_p->a.length; i++) {
+            dst_p->a.elements[i] = (uint8_t)decoder_read_bits(decoder_p, (size_t)pos, 8);
+            pos += 8;
+        }
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length += 0u;
+
+        if (length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length * 8u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_B) != 0u) {
+        dst_p->b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->b.length += 0u;
+
+        if (dst_p->b.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        pos_2 = decoder_free(decoder_p, 8u * dst_p->b.length);
+
+        if (pos_2 < 0) {
+            return;
+        }
+
+        for (i_2 = 0; (i_2 + 7u) <= dst_p->b.length; i_2 += 7u) {
+            bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 56);
+            pos_2 += 56;
+
+            for (j_2 = 0; j_2 < 7u; j_2++) {
+                dst_p->b.elements[i_2 + j_2] = (int8_t)((int64_t)((bits_2 >> (48u - (8u * j_2))) & 0xffu) - 128);
+            }
+        }
+
+        for (; i_2 < dst_p->b.length; i_2++) {
+            dst_p->b.elements[i_2] = (int8_t)((int64_t)decoder_read_bits(decoder_p, (size_t)pos_2, 8) - 128);
+            pos_2 += 8;
+        }
+    } else {
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_2 += 0u;
+
+        if (length_2 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2 * 8u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_C) != 0u) {
+        dst_p->c.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->c.length += 0u;
+
+        if (dst_p->c.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        pos_3 = decoder_free(decoder_p, 16u * dst_p->c.length);
+
+        if (pos_3 < 0) {
+            return;
+        }
+
+        for (i_3 = 0; (i_3 + 3u) <= dst_p->c.length; i_3 += 3u) {
+            bits_3 = decoder_read_bits(decoder_p, (size_t)pos_3, 48);
+            pos_3 += 48;
+
+            for (j_3 = 0; j_3 < 3u; j_3++) {
+                dst_p->c.elements[i_3 + j_3] = (uint16_t)((bits_3 >> (32u - (16u * j_3))) & 0xffffu);
+            }
+        }
+
+        for (; i_3 < dst_p->c.length; i_3++) {
+            dst_p->c.elements[i_3] = (uint16_t)decoder_read_bits(decoder_p, (size_t)pos_3, 16);
+            pos_3 += 16;
+        }
+    } else {
+        length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_3 += 0u;
+
+        if (length_3 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_3 * 16u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_D) != 0u) {
+        dst_p->d.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->d.length += 0u;
+
+        if (dst_p->d.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        pos_4 = decoder_free(decoder_p, 16u * dst_p->d.length);
+
+        if (pos_4 < 0) {
+            return;
+        }
+
+        for (i_4 = 0; (i_4 + 3u) <= dst_p->d.length; i_4 += 3u) {
+            bits_4 = decoder_read_bits(decoder_p, (size_t)pos_4, 48);
+            pos_4 += 48;
+
+            for (j_4 = 0; j_4 < 3u; j_4++) {
+                dst_p->d.elements[i_4 + j_4] = (int16_t)((int64_t)((bits_4 >> (32u - (16u * j_4))) & 0xffffu) - 32768);
+            }
+        }
+
+        for (; i_4 < dst_p->d.length; i_4++) {
+            dst_p->d.elements[i_4] = (int16_t)((int64_t)decoder_read_bits(decoder_p, (size_t)pos_4, 16) - 32768);
+            pos_4 += 16;
+        }
+    } else {
+        length_4 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_4 += 0u;
+
+        if (length_4 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_4 * 16u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_E) != 0u) {
+        dst_p->e.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->e.length += 0u;
+
+        if (dst_p->e.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_5 = 0; i_5 < dst_p->e.length; i_5++) {
+            dst_p->e.elements[i_5] = decoder_read_uint32(decoder_p);
+        }
+    } else {
+        length_5 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_5 += 0u;
+
+        if (length_5 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_5 * 32u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_F) != 0u) {
+        dst_p->f.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->f.length += 0u;
+
+        if (dst_p->f.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_6 = 0; i_6 < dst_p->f.length; i_6++) {
+            dst_p->f.elements[i_6] = decoder_read_int32(decoder_p);
+        }
+    } else {
+        length_6 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_6 += 0u;
+
+        if (length_6 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_6 * 32u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_G) != 0u) {
+        dst_p->g.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->g.length += 0u;
+
+        if (dst_p->g.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_7 = 0; i_7 < dst_p->g.length; i_7++) {
+            dst_p->g.elements[i_7] = decoder_read_uint64(decoder_p);
+        }
+    } else {
+        length_7 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_7 += 0u;
+
+        if (length_7 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_7 * 64u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_H) != 0u) {
+        dst_p->h.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->h.length += 0u;
+
+        if (dst_p->h.length > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        for (i_8 = 0; i_8 < dst_p->h.length; i_8++) {
+            dst_p->h.elements[i_8] = decoder_read_int64(decoder_p);
+        }
+    } else {
+        length_8 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_8 += 0u;
+
+        if (length_8 > 8u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_8 * 64u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_A_FIELD_I) != 0u) {
+        for (i_9 = 0; i_9 < 3; i_9++) {
+            dst_p->i.elements[i_9] = decoder_read_bool(decoder_p);
+        }
+    } else {
+        (void)decoder_free(decoder_p, 3u);
+    }
+}
+
+static void uper_arrays_arrays_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t length_2;
+    uint32_t length_3;
+    uint32_t length_4;
+    uint32_t length_5;
+    uint32_t length_6;
+    uint32_t length_7;
+    uint32_t length_8;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length += 0u;
+
+    if (length > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 8u);
+    length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_2 += 0u;
+
+    if (length_2 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2 * 8u);
+    length_3 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_3 += 0u;
+
+    if (length_3 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_3 * 16u);
+    length_4 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_4 += 0u;
+
+    if (length_4 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_4 * 16u);
+    length_5 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_5 += 0u;
+
+    if (length_5 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_5 * 32u);
+    length_6 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_6 += 0u;
+
+    if (length_6 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_6 * 32u);
+    length_7 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_7 += 0u;
+
+    if (length_7 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_7 * 64u);
+    length_8 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_8 += 0u;
+
+    if (length_8 > 8u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_8 * 64u);
+    (void)decoder_free(decoder_p, 3u);
+}
+
+static void uper_arrays_arrays_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arrays_arrays_b_t *src_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        13);
+
+    if (encoder_alloc(encoder_p, 16u * src_p->length) >= 0) {
+        for (i = 0; (i + 4u) <= src_p->length; i += 4u) {
+            bits = 0;
+
+            for (j = 0; j < 4u; j++) {
+                bits = ((bits << 16) | ((uint64_t)src_p->elements[i + j] & 0xffffu));
+            }
+
+            encoder_write_bits(encoder_p, bits, 64);
+        }
+
+        for (; i < src_p->length; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->elements[i], 16);
+        }
+    }
+}
+
+static void uper_arrays_arrays_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_b_t *dst_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        13);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 4096u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(decoder_p, 16u * dst_p->length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 3u) <= dst_p->length; i += 3u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 48);
+        pos += 48;
+
+        for (j = 0; j < 3u; j++) {
+            dst_p->elements[i + j] = (uint16_t)((bits >> (32u - (16u * j))) & 0xffffu);
+        }
+    }
+
+    for (; i < dst_p->length; i++) {
+        dst_p->elements[i] = (uint16_t)decoder_read_bits(decoder_p, (size_t)pos, 16);
+        pos += 16;
+    }
+}
+
+static void uper_arrays_arrays_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        13);
+    length += 0u;
+
+    if (length > 4096u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 16u);
+}
+
+static void uper_arrays_arrays_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arrays_arrays_c_t *src_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        10);
+
+    if (encoder_alloc(encoder_p, 4u * src_p->length) >= 0) {
+        for (i = 0; (i + 16u) <= src_p->length; i += 16u) {
+            bits = 0;
+
+            for (j = 0; j < 16u; j++) {
+                bits = ((bits << 4) | ((uint64_t)src_p->elements[i + j] & 0xfu));
+            }
+
+            encoder_write_bits(encoder_p, bits, 64);
+        }
+
+        for (; i < src_p->length; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->elements[i], 4);
+        }
+    }
+}
+
+static void uper_arrays_arrays_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_c_t *dst_p)
+{
+    uint16_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        10);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(decoder_p, 4u * dst_p->length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 14u) <= dst_p->length; i += 14u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 56);
+        pos += 56;
+
+        for (j = 0; j < 14u; j++) {
+            dst_p->elements[i + j] = (uint8_t)((bits >> (52u - (4u * j))) & 0xfu);
+        }
+    }
+
+    for (; i < dst_p->length; i++) {
+        dst_p->elements[i] = (uint8_t)decoder_read_bits(decoder_p, (size_t)pos, 4);
+        pos += 4;
+    }
+}
+
+static void uper_arrays_arrays_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        10);
+    length += 0u;
+
+    if (length > 1000u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 4u);
+}
+
+static void uper_arrays_arrays_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arrays_arrays_d_t *src_p)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        7);
+
+    if (encoder_alloc(encoder_p, 2u * src_p->length) >= 0) {
+        for (i = 0; (i + 32u) <= src_p->length; i += 32u) {
+            bits = 0;
+
+            for (j = 0; j < 32u; j++) {
+                bits = ((bits << 2) | ((uint64_t)src_p->elements[i + j] & 0x3u));
+            }
+
+            encoder_write_bits(encoder_p, bits, 64);
+        }
+
+        for (; i < src_p->length; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->elements[i], 2);
+        }
+    }
+}
+
+static void uper_arrays_arrays_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_d_t *dst_p)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+    uint64_t value;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 100u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos = decoder_free(decoder_p, 2u * dst_p->length);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 28u) <= dst_p->length; i += 28u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 56);
+        pos += 56;
+
+        for (j = 0; j < 28u; j++) {
+            value = ((bits >> (54u - (2u * j))) & 0x3u);
+
+            if (value > 2u) {
+                decoder_abort(decoder_p, EBADENUM);
+
+                return;
+            }
+
+            dst_p->elements[i + j] = (enum uper_arrays_arrays_d_e)value;
+        }
+    }
+
+    for (; i < dst_p->length; i++) {
+        value = decoder_read_bits(decoder_p, (size_t)pos, 2);
+
+        if (value > 2u) {
+            decoder_abort(decoder_p, EBADENUM);
+
+            return;
+        }
+
+        dst_p->elements[i] = (enum uper_arrays_arrays_d_e)value;
+        pos += 2;
+    }
+}
+
+static void uper_arrays_arrays_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+    uint8_t value;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    length += 0u;
+
+    if (length > 100u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        value = decoder_read_non_negative_binary_integer(decoder_p, 2);
+
+        if (value > 2u) {
+            decoder_abort(decoder_p, EBADENUM);
+        }
+    }
+}
+
+static void uper_arrays_arrays_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_arrays_arrays_e_t *src_p)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    uint8_t i_2;
+    uint8_t j_2;
+    uint64_t bits_2;
+    uint8_t i_3;
+    uint8_t j_3;
+    uint64_t bits_3;
+
+    if (encoder_alloc(encoder_p, 3u * 20u) >= 0) {
+        for (i = 0; (i + 21u) <= 20u; i += 21u) {
+            bits = 0;
+
+            for (j = 0; j < 21u; j++) {
+                bits = ((bits << 3) | ((uint64_t)(src_p->a.elements[i + j] - -3) & 0x7u));
+            }
+
+            encoder_write_bits(encoder_p, bits, 63);
+        }
+
+        for (; i < 20u; i++) {
+            encoder_write_bits(encoder_p, (uint64_t)(src_p->a.elements[i] - -3), 3);
+        }
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->b.length - 0u,
+        7);
+
+    if (encoder_alloc(encoder_p, 1u * src_p->b.length) >= 0) {
+        for (i_2 = 0; (i_2 + 64u) <= src_p->b.length; i_2 += 64u) {
+            bits_2 = 0;
+
+            for (j_2 = 0; j_2 < 64u; j_2++) {
+                bits_2 = ((bits_2 << 1) | ((uint64_t)src_p->b.elements[i_2 + j_2] & 0x1u));
+            }
+
+            encoder_write_bits(encoder_p, bits_2, 64);
+        }
+
+        for (; i_2 < src_p->b.length; i_2++) {
+            encoder_write_bits(encoder_p, (uint64_t)src_p->b.elements[i_2], 1);
+        }
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->c.length - 0u,
+        4);
+
+    if (encoder_alloc(encoder_p, 8u * src_p->c.length) >= 0) {
+        for (i_3 = 0; (i_3 + 8u) <= src_p->c.length; i_3 += 8u) {
+            bits_3 = 0;
+
+            for (j_3 = 0; j_3 < 8u; j_3++) {
+                bits_3 = ((bits_3 << 8) | ((uint64_t)(src_p->c.elements[i_3 + j_3] - 10) & 0xffu));
+            }
+
+            encoder_write_bits(encoder_p, bits_3, 64);
+        }
+
+        for (; i_3 < src_p->c.length; i_3++) {
+            encoder_write_bits(encoder_p, (uint64_t)(src_p->c.elements[i_3] - 10), 8);
+        }
+    }
+}
+
+static void uper_arrays_arrays_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_e_t *dst_p)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+    uint8_t i_2;
+    uint8_t j_2;
+    uint64_t bits_2;
+    ssize_t pos_2;
+    uint8_t i_3;
+    uint8_t j_3;
+    uint64_t bits_3;
+    ssize_t pos_3;
+
+    pos = decoder_free(decoder_p, 3u * 20u);
+
+    if (pos < 0) {
+        return;
+    }
+
+    for (i = 0; (i + 19u) <= 20u; i += 19u) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 57);
+        pos += 57;
+
+        for (j = 0; j < 19u; j++) {
+            dst_p->a.elements[i + j] = (int8_t)((int64_t)((bits >> (54u - (3u * j))) & 0x7u) - 3);
+        }
+    }
+
+    for (; i < 20u; i++) {
+        dst_p->a.elements[i] = (int8_t)((int64_t)decoder_read_bits(decoder_p, (size_t)pos, 3) - 3);
+        pos += 3;
+    }
+
+    dst_p->b.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    dst_p->b.length += 0u;
+
+    if (dst_p->b.length > 70u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos_2 = decoder_free(decoder_p, 1u * dst_p->b.length);
+
+    if (pos_2 < 0) {
+        return;
+    }
+
+    for (i_2 = 0; (i_2 + 57u) <= dst_p->b.length; i_2 += 57u) {
+        bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 57);
+        pos_2 += 57;
+
+        for (j_2 = 0; j_2 < 57u; j_2++) {
+            dst_p->b.elements[i_2 + j_2] = (((bits_2 >> (56u - (1u * j_2))) & 0x1u) != 0u);
+        }
+    }
+
+    for (; i_2 < dst_p->b.length; i_2++) {
+        dst_p->b.elements[i_2] = (decoder_read_bits(decoder_p, (size_t)pos_2, 1) != 0u);
+        pos_2 += 1;
+    }
+
+    dst_p->c.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    dst_p->c.length += 0u;
+
+    if (dst_p->c.length > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    pos_3 = decoder_free(decoder_p, 8u * dst_p->c.length);
+
+    if (pos_3 < 0) {
+        return;
+    }
+
+    for (i_3 = 0; (i_3 + 7u) <= dst_p->c.length; i_3 += 7u) {
+        bits_3 = decoder_read_bits(decoder_p, (size_t)pos_3, 56);
+        pos_3 += 56;
+
+        for (j_3 = 0; j_3 < 7u; j_3++) {
+            dst_p->c.elements[i_3 + j_3] = (uint16_t)(((bits_3 >> (48u - (8u * j_3))) & 0xffu) + 10u);
+        }
+    }
+
+    for (; i_3 < dst_p->c.length; i_3++) {
+        dst_p->c.elements[i_3] = (uint16_t)(decoder_read_bits(decoder_p, (size_t)pos_3, 8) + 10u);
+        pos_3 += 8;
+    }
+}
+
+static void uper_arrays_arrays_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_arrays_arrays_e_t *dst_p,
+    uint64_t fields)
+{
+    uint8_t i;
+    uint8_t j;
+    uint64_t bits;
+    ssize_t pos;
+    uint8_t i_2;
+    uint8_t j_2;
+    uint64_t bits_2;
+    ssize_t pos_2;
+    uint32_t length;
+    uint8_t i_3;
+    uint8_t j_3;
+    uint64_t bits_3;
+    ssize_t pos_3;
+    uint32_t length_2;
+
+    if ((fields & UPER_ARRAYS_ARRAYS_E_FIELD_A) != 0u) {
+        pos = decoder_free(decoder_p, 3u * 20u);
+
+        if (pos < 0) {
+            return;
+        }
+
+        for (i = 0; (i + 19u) <= 20u; i += 19u) {
+            bits = decoder_read_bits(decoder_p, (size_t)pos, 57);
+            pos += 57;
+
+            for (j = 0; j < 19u; j++) {
+                dst_p->a.elements[i + j] = (int8_t)((int64_t)((bits >> (54u - (3u * j))) & 0x7u) - 3);
+            }
+        }
+
+        for (; i < 20u; i++) {
+            dst_p->a.elements[i] = (int8_t)((int64_t)decoder_read_bits(decoder_p, (size_t)pos, 3) - 3);
+            pos += 3;
+        }
+    } else {
+        (void)decoder_free(decoder_p, 60u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_E_FIELD_B) != 0u) {
+        dst_p->b.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        dst_p->b.length += 0u;
+
+        if (dst_p->b.length > 70u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        pos_2 = decoder_free(decoder_p, 1u * dst_p->b.length);
+
+        if (pos_2 < 0) {
+            return;
+        }
+
+        for (i_2 = 0; (i_2 + 57u) <= dst_p->b.length; i_2 += 57u) {
+            bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 57);
+            pos_2 += 57;
+
+            for (j_2 = 0; j_2 < 57u; j_2++) {
+                dst_p->b.elements[i_2 + j_2] = (((bits_2 >> (56u - (1u * j_2))) & 0x1u) != 0u);
+            }
+        }
+
+        for (; i_2 < dst_p->b.length; i_2++) {
+            dst_p->b.elements[i_2] = (decoder_read_bits(decoder_p, (size_t)pos_2, 1) != 0u);
+            pos_2 += 1;
+        }
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        length += 0u;
+
+        if (length > 70u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length * 1u);
+    }
+    if ((fields & UPER_ARRAYS_ARRAYS_E_FIELD_C) != 0u) {
+        dst_p->c.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        dst_p->c.length += 0u;
+
+        if (dst_p->c.length > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        pos_3 = decoder_free(decoder_p, 8u * dst_p->c.length);
+
+        if (pos_3 < 0) {
+            return;
+        }
+
+        for (i_3 = 0; (i_3 + 7u) <= dst_p->c.length; i_3 += 7u) {
+            bits_3 = decoder_read_bits(decoder_p, (size_t)pos_3, 56);
+            pos_3 += 56;
+
+            for (j_3 = 0; j_3 < 7u; j_3++) {
+                dst_p->c.elements[i_3 + j_3] = (uint16_t)(((bits_3 >> (48u - (8u * j_3))) & 0xffu) + 10u);
+            }
+        }
+
+        for (; i_3 < dst_p->c.length; i_3++) {
+            dst_p->c.elements[i_3] = (uint16_t)(decoder_read_bits(decoder_p, (size_t)pos_3, 8) + 10u);
+            pos_3 += 8;
+        }
+    } else {
+        length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            4);
+        length_2 += 0u;
+
+        if (length_2 > 10u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, length_2 * 8u);
+    }
+}
+
+static void uper_arrays_arrays_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t length_2;
+
+    (void)decoder_free(decoder_p, 60u);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        7);
+    length += 0u;
+
+    if (length > 70u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length * 1u);
+    length_2 = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        4);
+    length_2 += 0u;
+
+    if (length_2 > 10u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, length_2 * 8u);
+}
+
+ssize_t uper_arrays_arrays_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arrays_arrays_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_a_encoded_size(
+    const struct uper_arrays_arrays_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arrays_arrays_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_a_decode(
+    struct uper_arrays_arrays_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arrays_arrays_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_a_decode_batch(
+    struct uper_arrays_arrays_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_arrays_arrays_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_a_decode_fields(
+    struct uper_arrays_arrays_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arrays_arrays_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_b_encoded_size(
+    const struct uper_arrays_arrays_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arrays_arrays_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_b_decode(
+    struct uper_arrays_arrays_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arrays_arrays_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_b_decode_batch(
+    struct uper_arrays_arrays_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_arrays_arrays_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arrays_arrays_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_c_encoded_size(
+    const struct uper_arrays_arrays_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arrays_arrays_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_c_decode(
+    struct uper_arrays_arrays_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arrays_arrays_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_c_decode_batch(
+    struct uper_arrays_arrays_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_arrays_arrays_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arrays_arrays_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_d_encoded_size(
+    const struct uper_arrays_arrays_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arrays_arrays_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_d_decode(
+    struct uper_arrays_arrays_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arrays_arrays_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_d_decode_batch(
+    struct uper_arrays_arrays_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_arrays_arrays_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_arrays_arrays_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_e_encoded_size(
+    const struct uper_arrays_arrays_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_arrays_arrays_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_arrays_arrays_e_decode(
+    struct uper_arrays_arrays_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_arrays_arrays_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_arrays_arrays_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_e_decode_batch(
+    struct uper_arrays_arrays_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_arrays_arrays_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_arrays_arrays_e_decode_fields(
+    struct uper_arrays_arrays_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_arrays_arrays_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
@@ -0,0 +1,706 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 14:19:49 2026.
+ */
+
+#ifndef UPER_ARRAYS_H
+#define UPER_ARRAYS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Type A in module Arrays.
+ */
+struct uper_arrays_arrays_a_t {
+    struct {
+        uint8_t length;
+        uint8_t elements[8];
+    } a;
+    struct {
+        uint8_t length;
+        int8_t elements[8];
+    } b;
+    struct {
+        uint8_t length;
+        uint16_t elements[8];
+    } c;
+    struct {
+        uint8_t length;
+        int16_t elements[8];
+    } d;
+    struct {
+        uint8_t length;
+        uint32_t elements[8];
+    } e;
+    struct {
+        uint8_t length;
+        int32_t elements[8];
+    } f;
+    struct {
+        uint8_t length;
+        uint64_t elements[8];
+    } g;
+    struct {
+        uint8_t length;
+        int64_t elements[8];
+    } h;
+    struct {
+        bool elements[3];
+    } i;
+};
+
+/**
+ * Type B in module Arrays.
+ */
+struct uper_arrays_arrays_b_t {
+    uint32_t length;
+    uint16_t elements[4096];
+};
+
+/**
+ * Type C in module Arrays.
+ */
+struct uper_arrays_arrays_c_t {
+    uint32_t length;
+    uint8_t elements[1000];
+};
+
+/**
+ * Type D in module Arrays.
+ */
+enum uper_arrays_arrays_d_e {
+    uper_arrays_arrays_d_a_e = 0,
+    uper_arrays_arrays_d_b_e = 1,
+    uper_arrays_arrays_d_c_e = 2
+};
+
+struct uper_arrays_arrays_d_t {
+    uint8_t length;
+    enum uper_arrays_arrays_d_e elements[100];
+};
+
+/**
+ * Type E in module Arrays.
+ */
+struct uper_arrays_arrays_e_t {
+    struct {
+        int8_t elements[20];
+    } a;
+    struct {
+        uint8_t length;
+        bool elements[70];
+    } b;
+    struct {
+        uint8_t length;
+        uint16_t elements[10];
+    } c;
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Arrays, in bytes.
+ */
+#define UPER_ARRAYS_ARRAYS_A_MAX_ENCODED_SIZE 245u
+
+/**
+ * Encode type A defined in module Arrays.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Arrays, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_encoded_size(
+    const struct uper_arrays_arrays_a_t *src_p);
+
+/**
+ * Decode type A defined in module Arrays.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_decode(
+    struct uper_arrays_arrays_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Arrays, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Arrays after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Arrays encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_decode_batch(
+    struct uper_arrays_arrays_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type A defined in module Arrays, to decode
+ * with uper_arrays_arrays_a_decode_fields().
+ */
+#define UPER_ARRAYS_ARRAYS_A_FIELD_A (1ull << 0)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_B (1ull << 1)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_C (1ull << 2)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_D (1ull << 3)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_E (1ull << 4)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_F (1ull << 5)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_G (1ull << 6)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_H (1ull << 7)
+#define UPER_ARRAYS_ARRAYS_A_FIELD_I (1ull << 8)
+
+/**
+ * Decode given fields of type A defined in module
+ * Arrays. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_a_decode_fields(
+    struct uper_arrays_arrays_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Arrays, in bytes.
+ */
+#define UPER_ARRAYS_ARRAYS_B_MAX_ENCODED_SIZE 8194u
+
+/**
+ * Encode type B defined in module Arrays.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Arrays, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_b_encoded_size(
+    const struct uper_arrays_arrays_b_t *src_p);
+
+/**
+ * Decode type B defined in module Arrays.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_b_decode(
+    struct uper_arrays_arrays_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Arrays, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Arrays after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Arrays encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_b_decode_batch(
+    struct uper_arrays_arrays_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * Arrays, in bytes.
+ */
+#define UPER_ARRAYS_ARRAYS_C_MAX_ENCODED_SIZE 502u
+
+/**
+ * Encode type C defined in module Arrays.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * Arrays, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_c_encoded_size(
+    const struct uper_arrays_arrays_c_t *src_p);
+
+/**
+ * Decode type C defined in module Arrays.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_c_decode(
+    struct uper_arrays_arrays_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module Arrays, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * Arrays after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * Arrays encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_c_decode_batch(
+    struct uper_arrays_arrays_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type D defined in module
+ * Arrays, in bytes.
+ */
+#define UPER_ARRAYS_ARRAYS_D_MAX_ENCODED_SIZE 26u
+
+/**
+ * Encode type D defined in module Arrays.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_d_t *src_p);
+
+/**
+ * Calculate the encoded size of type D defined in module
+ * Arrays, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_d_encoded_size(
+    const struct uper_arrays_arrays_d_t *src_p);
+
+/**
+ * Decode type D defined in module Arrays.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_d_decode(
+    struct uper_arrays_arrays_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type D defined in
+ * module Arrays, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * Arrays after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type D defined in module
+ * Arrays encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_d_decode_batch(
+    struct uper_arrays_arrays_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Maximum encoded size of type E defined in module
+ * Arrays, in bytes.
+ */
+#define UPER_ARRAYS_ARRAYS_E_MAX_ENCODED_SIZE 28u
+
+/**
+ * Encode type E defined in module Arrays.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_e_t *src_p);
+
+/**
+ * Calculate the encoded size of type E defined in module
+ * Arrays, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_encoded_size(
+    const struct uper_arrays_arrays_e_t *src_p);
+
+/**
+ * Decode type E defined in module Arrays.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_decode(
+    struct uper_arrays_arrays_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type E defined in
+ * module Arrays, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type E defined in module
+ * Arrays after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_arrays_arrays_e_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type E defined in module
+ * Arrays encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_decode_batch(
+    struct uper_arrays_arrays_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type E defined in module Arrays, to decode
+ * with uper_arrays_arrays_e_decode_fields().
+ */
+#define UPER_ARRAYS_ARRAYS_E_FIELD_A (1ull << 0)
+#define UPER_ARRAYS_ARRAYS_E_FIELD_B (1ull << 1)
+#define UPER_ARRAYS_ARRAYS_E_FIELD_C (1ull << 2)
+
+/**
+ * Decode given fields of type E defined in module
+ * Arrays. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_arrays_arrays_e_decode_fields(
+    struct uper_arrays_arrays_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+#endif
@@ -0,0 +1,1013 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:36:18 2026.
+ */
+
+#ifndef UPER_JER_H
+#define UPER_JER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Type B in module Jer.
+ */
+enum uper_jer_jer_b_choice_e {
+    uper_jer_jer_b_choice_a_e,
+    uper_jer_jer_b_choice_b_c_e,
+    uper_jer_jer_b_choice_d_e
+};
+
+struct uper_jer_jer_b_t {
+    enum uper_jer_jer_b_choice_e choice;
+    union {
+        uint8_t a;
+        bool b_c;
+    } value;
+};
+
+/**
+ * Type C in module Jer.
+ */
+struct uper_jer_jer_c_t {
+    bool is_a_present;
+    bool a;
+    bool is_b_present;
+    bool b;
+};
+
+/**
+ * Type A in module Jer.
+ */
+enum uper_jer_jer_a_i_e {
+    uper_jer_jer_a_i_four_e = 2,
+    uper_jer_jer_a_i_one_e = 0,
+    uper_jer_jer_a_i_two_three_e = 1
+};
+
+struct uper_jer_jer_a_t {
+    int8_t a;
+    int64_t b;
+    uint64_t c;
+    bool d;
+    struct {
+        uint8_t length;
+        uint8_t buf[4];
+    } f;
+    struct {
+        uint8_t buf[2];
+    } g;
+    uint16_t h;
+    enum uper_jer_jer_a_i_e i;
+    struct {
+        uint8_t length;
+        uint16_t elements[3];
+    } j;
+    bool is_k_present;
+    struct uper_jer_jer_b_t k;
+    struct uper_jer_jer_c_t l;
+    bool m_n;
+    bool is_o_addition_present;
+    uint8_t o;
+};
+
+/**
+ * Type D in module Jer.
+ */
+struct uper_jer_jer_d_t {
+    struct uper_jer_jer_b_t elements[2];
+};
+
+/**
+ * Type E in module Jer.
+ */
+struct uper_jer_jer_e_t {
+    int8_t value;
+};
+
+/**
+ * Type F in module Jer.
+ */
+struct uper_jer_jer_f_t {
+    uint64_t value;
+};
+
+/**
+ * Type G in module Jer.
+ */
+enum uper_jer_jer_g_e {
+    uper_jer_jer_g_a_e = 0,
+    uper_jer_jer_g_b_e = 1
+};
+
+struct uper_jer_jer_g_t {
+    enum uper_jer_jer_g_e value;
+};
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_B_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type B defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_b_encoded_size(
+    const struct uper_jer_jer_b_t *src_p);
+
+/**
+ * Decode type B defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_b_decode(
+    struct uper_jer_jer_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_b_decode_batch(
+    struct uper_jer_jer_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type B defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_b_t *src_p);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_C_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type C defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_c_encoded_size(
+    const struct uper_jer_jer_c_t *src_p);
+
+/**
+ * Decode type C defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_c_decode(
+    struct uper_jer_jer_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_c_decode_batch(
+    struct uper_jer_jer_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type C defined in module Jer, to decode
+ * with uper_jer_jer_c_decode_fields().
+ */
+#define UPER_JER_JER_C_FIELD_A (1ull << 0)
+#define UPER_JER_JER_C_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type C defined in module
+ * Jer. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_c_decode_fields(
+    struct uper_jer_jer_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type C defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_c_t *src_p);
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_A_MAX_ENCODED_SIZE 31u
+
+/**
+ * Encode type A defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_a_encoded_size(
+    const struct uper_jer_jer_a_t *src_p);
+
+/**
+ * Decode type A defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_a_decode(
+    struct uper_jer_jer_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_a_decode_batch(
+    struct uper_jer_jer_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type A defined in module Jer, to decode
+ * with uper_jer_jer_a_decode_fields().
+ */
+#define UPER_JER_JER_A_FIELD_A (1ull << 0)
+#define UPER_JER_JER_A_FIELD_B (1ull << 1)
+#define UPER_JER_JER_A_FIELD_C (1ull << 2)
+#define UPER_JER_JER_A_FIELD_D (1ull << 3)
+#define UPER_JER_JER_A_FIELD_E (1ull << 4)
+#define UPER_JER_JER_A_FIELD_F (1ull << 5)
+#define UPER_JER_JER_A_FIELD_G (1ull << 6)
+#define UPER_JER_JER_A_FIELD_H (1ull << 7)
+#define UPER_JER_JER_A_FIELD_I (1ull << 8)
+#define UPER_JER_JER_A_FIELD_J (1ull << 9)
+#define UPER_JER_JER_A_FIELD_K (1ull << 10)
+#define UPER_JER_JER_A_FIELD_L (1ull << 11)
+#define UPER_JER_JER_A_FIELD_M_N (1ull << 12)
+
+/**
+ * Decode given fields of type A defined in module
+ * Jer. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_a_decode_fields(
+    struct uper_jer_jer_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type A defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_a_t *src_p);
+
+/**
+ * Maximum encoded size of type D defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_D_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type D defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_d_t *src_p);
+
+/**
+ * Calculate the encoded size of type D defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_d_encoded_size(
+    const struct uper_jer_jer_d_t *src_p);
+
+/**
+ * Decode type D defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_d_decode(
+    struct uper_jer_jer_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type D defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type D defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_d_decode_batch(
+    struct uper_jer_jer_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type D defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_d_t *src_p);
+
+/**
+ * Maximum encoded size of type E defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_E_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type E defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_e_t *src_p);
+
+/**
+ * Calculate the encoded size of type E defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_e_encoded_size(
+    const struct uper_jer_jer_e_t *src_p);
+
+/**
+ * Decode type E defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_e_decode(
+    struct uper_jer_jer_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type E defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_e_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type E defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_e_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type E defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_e_decode_batch(
+    struct uper_jer_jer_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type E defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_e_t *src_p);
+
+/**
+ * Maximum encoded size of type F defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_F_MAX_ENCODED_SIZE 8u
+
+/**
+ * Encode type F defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_f_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_f_t *src_p);
+
+/**
+ * Calculate the encoded size of type F defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_f_encoded_size(
+    const struct uper_jer_jer_f_t *src_p);
+
+/**
+ * Decode type F defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_f_decode(
+    struct uper_jer_jer_f_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type F defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_f_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type F defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_f_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_f_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type F defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_f_decode_batch(
+    struct uper_jer_jer_f_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type F defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_f_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_f_t *src_p);
+
+/**
+ * Maximum encoded size of type G defined in module
+ * Jer, in bytes.
+ */
+#define UPER_JER_JER_G_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type G defined in module Jer.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_g_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_g_t *src_p);
+
+/**
+ * Calculate the encoded size of type G defined in module
+ * Jer, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_g_encoded_size(
+    const struct uper_jer_jer_g_t *src_p);
+
+/**
+ * Decode type G defined in module Jer.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_g_decode(
+    struct uper_jer_jer_g_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type G defined in
+ * module Jer, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_g_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type G defined in module
+ * Jer after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_g_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_g_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type G defined in module
+ * Jer encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_jer_jer_g_decode_batch(
+    struct uper_jer_jer_g_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type G defined in module Jer as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_jer_jer_g_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_jer_jer_g_t *src_p);
+
+#endif
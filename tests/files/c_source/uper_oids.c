@@ -0,0 +1,1953 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:19 2026.
+ */
+
+#include <string.h>
+
+#include "uper_oids.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+const struct uper_oids_oid_t uper_oids_oids_id_example_oid = {
+    .length = 3,
+    .arcs = { 2u, 999u, 1u }
+};
+
+const struct uper_oids_oid_t uper_oids_oids_id_pkcs_1_oid = {
+    .length = 6,
+    .arcs = { 1u, 2u, 840u, 113549u, 1u, 1u }
+};
+
+const struct uper_oids_oid_t uper_oids_oids_id_rsa_encryption_oid = {
+    .length = 7,
+    .arcs = { 1u, 2u, 840u, 113549u, 1u, 1u, 1u }
+};
+
+const struct uper_oids_oid_t uper_oids_oids_id_rsadsi_oid = {
+    .length = 4,
+    .arcs = { 1u, 2u, 840u, 113549u }
+};
+
+const struct uper_oids_oid_t uper_oids_oids_id_sha256_with_rsa_encryption_oid = {
+    .length = 7,
+    .arcs = { 1u, 2u, 840u, 113549u, 1u, 1u, 11u }
+};
+
+static const uint8_t oids_id_example_oid_encoded[] = {
+    0x88, 0x37, 0x01
+};
+
+static const uint8_t oids_id_pkcs_1_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01
+};
+
+static const uint8_t oids_id_rsa_encryption_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01
+};
+
+static const uint8_t oids_id_rsadsi_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d
+};
+
+static const uint8_t oids_id_sha256_with_rsa_encryption_oid_encoded[] = {
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b
+};
+
+static const uint8_t *oid_lookup_encoded(const uint32_t *arcs_p,
+                                         uint8_t length,
+                                         size_t *size_p)
+{
+    const uint8_t *buf_p;
+
+    buf_p = NULL;
+
+    switch (length) {
+
+    case 3:
+        if (memcmp(arcs_p, &uper_oids_oids_id_example_oid.arcs[0], 3 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_example_oid_encoded[0];
+            *size_p = sizeof(oids_id_example_oid_encoded);
+        }
+        break;
+
+    case 4:
+        if (memcmp(arcs_p, &uper_oids_oids_id_rsadsi_oid.arcs[0], 4 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_rsadsi_oid_encoded[0];
+            *size_p = sizeof(oids_id_rsadsi_oid_encoded);
+        }
+        break;
+
+    case 6:
+        if (memcmp(arcs_p, &uper_oids_oids_id_pkcs_1_oid.arcs[0], 6 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_pkcs_1_oid_encoded[0];
+            *size_p = sizeof(oids_id_pkcs_1_oid_encoded);
+        }
+        break;
+
+    case 7:
+        if (memcmp(arcs_p, &uper_oids_oids_id_rsa_encryption_oid.arcs[0], 7 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_rsa_encryption_oid_encoded[0];
+            *size_p = sizeof(oids_id_rsa_encryption_oid_encoded);
+        } else if (memcmp(arcs_p, &uper_oids_oids_id_sha256_with_rsa_encryption_oid.arcs[0], 7 * sizeof(uint32_t)) == 0) {
+            buf_p = &oids_id_sha256_with_rsa_encryption_oid_encoded[0];
+            *size_p = sizeof(oids_id_sha256_with_rsa_encryption_oid_encoded);
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return (buf_p);
+}
+
+static bool oid_lookup_arcs(uint32_t *arcs_p,
+                            uint8_t *length_p,
+                            const uint8_t *buf_p,
+                            size_t size)
+{
+    const struct uper_oids_oid_t *oid_p;
+
+    oid_p = NULL;
+
+    switch (size) {
+
+    case 3:
+        if (memcmp(buf_p, &oids_id_example_oid_encoded[0], 3) == 0) {
+            oid_p = &uper_oids_oids_id_example_oid;
+        }
+        break;
+
+    case 6:
+        if (memcmp(buf_p, &oids_id_rsadsi_oid_encoded[0], 6) == 0) {
+            oid_p = &uper_oids_oids_id_rsadsi_oid;
+        }
+        break;
+
+    case 8:
+        if (memcmp(buf_p, &oids_id_pkcs_1_oid_encoded[0], 8) == 0) {
+            oid_p = &uper_oids_oids_id_pkcs_1_oid;
+        }
+        break;
+
+    case 9:
+        if (memcmp(buf_p, &oids_id_rsa_encryption_oid_encoded[0], 9) == 0) {
+            oid_p = &uper_oids_oids_id_rsa_encryption_oid;
+        } else if (memcmp(buf_p, &oids_id_sha256_with_rsa_encryption_oid_encoded[0], 9) == 0) {
+            oid_p = &uper_oids_oids_id_sha256_with_rsa_encryption_oid;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    if (oid_p == NULL) {
+        return (false);
+    }
+
+    memcpy(arcs_p, &oid_p->arcs[0], (size_t)oid_p->length * sizeof(uint32_t));
+    *length_p = oid_p->length;
+
+    return (true);
+}
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_uint8(struct encoder_t *self_p,
+                                               uint8_t value)
+{
+    encoder_append_non_negative_binary_integer(self_p, value, 8);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static ssize_t oid_encode(uint8_t *buf_p,
+                          const uint32_t *arcs_p,
+                          uint8_t length)
+{
+    const uint8_t *encoded_p;
+    uint64_t value;
+    size_t size;
+    uint8_t i;
+    unsigned int shift;
+
+    if ((length < 2) || (length > 16)) {
+        return (-EBADLENGTH);
+    }
+
+    /* Named values are copied as they are. */
+    encoded_p = oid_lookup_encoded(arcs_p, length, &size);
+
+    if (encoded_p != NULL) {
+        memcpy(buf_p, encoded_p, size);
+
+        return ((ssize_t)size);
+    }
+
+    if ((arcs_p[0] > 2) || ((arcs_p[0] < 2) && (arcs_p[1] > 39))) {
+        return (-EBADOID);
+    }
+
+    size = 0;
+
+    for (i = 1; i < length; i++) {
+        if (i == 1) {
+            value = (40u * (uint64_t)arcs_p[0] + arcs_p[1]);
+        } else {
+            value = arcs_p[i];
+        }
+
+        shift = 28;
+
+        while ((shift > 0) && ((value >> shift) == 0)) {
+            shift -= 7;
+        }
+
+        while (shift > 0) {
+            buf_p[size] = (uint8_t)(0x80u | ((value >> shift) & 0x7fu));
+            size++;
+            shift -= 7;
+        }
+
+        buf_p[size] = (uint8_t)(value & 0x7fu);
+        size++;
+    }
+
+    return ((ssize_t)size);
+}
+
+static void encoder_append_oid(struct encoder_t *self_p,
+                               const uint32_t *arcs_p,
+                               uint8_t length)
+{
+    uint8_t buf[75];
+    ssize_t size;
+
+    size = oid_encode(&buf[0], arcs_p, length);
+
+    if (size < 0) {
+        encoder_abort(self_p, -size);
+
+        return;
+    }
+
+    encoder_append_uint8(self_p, (uint8_t)size);
+    encoder_append_bytes(self_p, &buf[0], (size_t)size);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static int oid_decode(uint32_t *arcs_p,
+                      uint8_t *length_p,
+                      const uint8_t *buf_p,
+                      size_t size)
+{
+    uint64_t value;
+    uint8_t length;
+    size_t i;
+
+    /* Named values are matched on their encoding. */
+    if (oid_lookup_arcs(arcs_p, length_p, buf_p, size)) {
+        return (0);
+    }
+
+    if (size == 0) {
+        return (-EBADLENGTH);
+    }
+
+    if ((buf_p[size - 1] & 0x80u) != 0) {
+        return (-EBADOID);
+    }
+
+    length = 0;
+    value = 0;
+
+    for (i = 0; i < size; i++) {
+        value <<= 7;
+        value |= (buf_p[i] & 0x7fu);
+
+        if (value > 0x10000004full) {
+            return (-EBADOID);
+        }
+
+        if ((buf_p[i] & 0x80u) != 0) {
+            continue;
+        }
+
+        if (length == 0) {
+            if (value < 80) {
+                arcs_p[0] = (uint32_t)(value / 40);
+                arcs_p[1] = (uint32_t)(value % 40);
+            } else {
+                arcs_p[0] = 2;
+                arcs_p[1] = (uint32_t)(value - 80);
+            }
+
+            length = 2;
+        } else {
+            if (length == 16) {
+                return (-EBADLENGTH);
+            }
+
+            if (value > 0xffffffffu) {
+                return (-EBADOID);
+            }
+
+            arcs_p[length] = (uint32_t)value;
+            length++;
+        }
+
+        value = 0;
+    }
+
+    *length_p = length;
+
+    return (0);
+}
+
+static void decoder_read_oid(struct decoder_t *self_p,
+                             uint32_t *arcs_p,
+                             uint8_t *length_p)
+{
+    uint8_t buf[75];
+    uint8_t size;
+    int res;
+
+    size = decoder_read_uint8(self_p);
+
+    if (size > sizeof(buf)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(self_p, &buf[0], size);
+
+    if (self_p->size < 0) {
+        return;
+    }
+
+    res = oid_decode(arcs_p, length_p, &buf[0], size);
+
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+    }
+}
+
+static void decoder_skip_oid(struct decoder_t *self_p)
+{
+    uint32_t arcs[16];
+    uint8_t length;
+
+    decoder_read_oid(self_p, &arcs[0], &length);
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_uint(struct jer_encoder_t *self_p,
+                                    uint64_t value)
+{
+    static const char digits[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    uint8_t *buf_p;
+    uint64_t power;
+    size_t number_of_digits;
+    size_t i;
+
+    number_of_digits = 1;
+    power = 10;
+
+    while ((number_of_digits < 20) && (value >= power)) {
+        number_of_digits++;
+        power *= 10;
+    }
+
+    buf_p = jer_encoder_alloc(self_p, number_of_digits);
+
+    if (buf_p == NULL) {
+        return;
+    }
+
+    /* Two digits at a time from the end. */
+    i = number_of_digits;
+
+    while (value >= 100) {
+        i -= 2;
+        (void)memcpy(&buf_p[i], &digits[2 * (value % 100)], 2);
+        value /= 100;
+    }
+
+    if (value >= 10) {
+        (void)memcpy(&buf_p[0], &digits[2 * value], 2);
+    } else {
+        buf_p[0] = (uint8_t)('0' + value);
+    }
+}
+
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}
+
+static void jer_encoder_append_oid(struct jer_encoder_t *self_p,
+                                   const uint32_t *arcs_p,
+                                   uint8_t length)
+{
+    uint8_t i;
+
+    if (length > 16) {
+        jer_encoder_abort(self_p, EBADLENGTH);
+
+        return;
+    }
+
+    jer_encoder_append_char(self_p, '"');
+
+    for (i = 0; i < length; i++) {
+        if (i > 0) {
+            jer_encoder_append_char(self_p, '.');
+        }
+
+        jer_encoder_append_uint(self_p, arcs_p[i]);
+    }
+
+    jer_encoder_append_char(self_p, '"');
+}
+
+static void uper_oids_oids_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_oids_oids_a_t *src_p)
+{
+    encoder_append_oid(encoder_p,
+                       &src_p->value.arcs[0],
+                       src_p->value.length);
+}
+
+static void uper_oids_oids_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_a_t *dst_p)
+{
+    decoder_read_oid(decoder_p,
+                     &dst_p->value.arcs[0],
+                     &dst_p->value.length);
+}
+
+static void uper_oids_oids_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip_oid(decoder_p);
+}
+
+static void uper_oids_oids_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_oids_oids_b_t *src_p)
+{
+    encoder_append_bool(encoder_p, src_p->is_b_present);
+    encoder_append_oid(encoder_p,
+                       &src_p->a.arcs[0],
+                       src_p->a.length);
+
+    if (src_p->is_b_present) {
+        encoder_append_oid(encoder_p,
+                           &src_p->b.arcs[0],
+                           src_p->b.length);
+    }
+
+    encoder_append_bool(encoder_p, src_p->c);
+}
+
+static void uper_oids_oids_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_b_t *dst_p)
+{
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    decoder_read_oid(decoder_p,
+                     &dst_p->a.arcs[0],
+                     &dst_p->a.length);
+
+    if (dst_p->is_b_present) {
+        decoder_read_oid(decoder_p,
+                         &dst_p->b.arcs[0],
+                         &dst_p->b.length);
+    }
+
+    dst_p->c = decoder_read_bool(decoder_p);
+}
+
+static void uper_oids_oids_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_b_t *dst_p,
+    uint64_t fields)
+{
+    dst_p->is_b_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_OIDS_OIDS_B_FIELD_A) != 0u) {
+        decoder_read_oid(decoder_p,
+                         &dst_p->a.arcs[0],
+                         &dst_p->a.length);
+    } else {
+        decoder_skip_oid(decoder_p);
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & UPER_OIDS_OIDS_B_FIELD_B) != 0u) {
+            decoder_read_oid(decoder_p,
+                             &dst_p->b.arcs[0],
+                             &dst_p->b.length);
+        } else {
+            decoder_skip_oid(decoder_p);
+        }
+    }
+
+    if ((fields & UPER_OIDS_OIDS_B_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void uper_oids_oids_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+
+    is_present = decoder_read_bool(decoder_p);
+    decoder_skip_oid(decoder_p);
+    if (is_present) {
+        decoder_skip_oid(decoder_p);
+    }
+    (void)decoder_free(decoder_p, 1u);
+}
+
+static void uper_oids_oids_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_oids_oids_c_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        3);
+
+    for (i = 0; i < src_p->length; i++) {
+        uper_oids_oids_a_encode_inner(encoder_p, &src_p->elements[i]);
+    }
+}
+
+static void uper_oids_oids_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_c_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        uper_oids_oids_a_decode_inner(decoder_p, &dst_p->elements[i]);
+    }
+}
+
+static void uper_oids_oids_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    length += 0u;
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        uper_oids_oids_a_skip_inner(decoder_p);
+    }
+}
+
+static void uper_oids_oids_d_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_oids_oids_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case uper_oids_oids_d_choice_a_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 0, 1);
+        encoder_append_oid(encoder_p,
+                           &src_p->value.a.arcs[0],
+                           src_p->value.a.length);
+        break;
+
+    case uper_oids_oids_d_choice_b_e:
+        encoder_append_non_negative_binary_integer(encoder_p, 1, 1);
+        encoder_append_bool(encoder_p, src_p->value.b);
+        break;
+
+    default:
+        encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_oids_oids_d_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_d_t *dst_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        dst_p->choice = uper_oids_oids_d_choice_a_e;
+        decoder_read_oid(decoder_p,
+                         &dst_p->value.a.arcs[0],
+                         &dst_p->value.a.length);
+        break;
+
+    case 1:
+        dst_p->choice = uper_oids_oids_d_choice_b_e;
+        dst_p->value.b = decoder_read_bool(decoder_p);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_oids_oids_d_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint8_t choice;
+
+    choice = (uint8_t)decoder_read_non_negative_binary_integer(decoder_p, 1);
+
+    switch (choice) {
+
+    case 0:
+        decoder_skip_oid(decoder_p);
+        break;
+
+    case 1:
+        (void)decoder_free(decoder_p, 1u);
+        break;
+
+    default:
+        decoder_abort(decoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_oids_oids_e_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_oids_oids_e_t *src_p)
+{
+    if(src_p->is_b_addition_present) {
+        encoder_abort(encoder_p, EINVAL);
+        return;
+    }
+
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (uint64_t)src_p->a,
+                           2);
+    }
+}
+
+static void uper_oids_oids_e_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_e_t *dst_p)
+{
+    bool extension_is_present;
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    extension_is_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_oids_oids_e_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_oids_oids_e_t *dst_p,
+    uint64_t fields)
+{
+    bool extension_is_present;
+
+    extension_is_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_OIDS_OIDS_E_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if(extension_is_present) {
+        decoder_abort(decoder_p, EINVAL);
+        return;
+    }
+}
+
+static void uper_oids_oids_e_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    if (decoder_read_bool(decoder_p)) {
+        decoder_abort(decoder_p, EINVAL);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 1u);
+}
+
+ssize_t uper_oids_oids_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_a_encoded_size(
+    const struct uper_oids_oids_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_oids_oids_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_a_decode(
+    struct uper_oids_oids_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_oids_oids_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_a_decode_batch(
+    struct uper_oids_oids_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_oids_oids_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_b_encoded_size(
+    const struct uper_oids_oids_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_oids_oids_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_b_decode(
+    struct uper_oids_oids_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_oids_oids_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_b_decode_batch(
+    struct uper_oids_oids_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_oids_oids_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_b_decode_fields(
+    struct uper_oids_oids_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_c_encoded_size(
+    const struct uper_oids_oids_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_oids_oids_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_c_decode(
+    struct uper_oids_oids_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_oids_oids_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_c_decode_batch(
+    struct uper_oids_oids_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_oids_oids_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_d_encoded_size(
+    const struct uper_oids_oids_d_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_oids_oids_d_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_d_decode(
+    struct uper_oids_oids_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_d_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_d_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_d_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_d_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_oids_oids_d_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_d_decode_batch(
+    struct uper_oids_oids_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_oids_oids_d_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_e_encoded_size(
+    const struct uper_oids_oids_e_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_oids_oids_e_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_e_decode(
+    struct uper_oids_oids_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_e_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_e_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_e_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_oids_oids_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_e_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_oids_oids_e_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_e_decode_batch(
+    struct uper_oids_oids_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_oids_oids_e_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_oids_oids_e_decode_fields(
+    struct uper_oids_oids_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_oids_oids_e_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+static void uper_oids_oids_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_oids_oids_a_t *src_p)
+{
+    jer_encoder_append_oid(encoder_p,
+                           &src_p->value.arcs[0],
+                           src_p->value.length);
+}
+
+static void uper_oids_oids_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_oids_oids_b_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_oid(encoder_p,
+                           &src_p->a.arcs[0],
+                           src_p->a.length);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+        jer_encoder_append_oid(encoder_p,
+                               &src_p->b.arcs[0],
+                               src_p->b.length);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_append_string(encoder_p, "\"c\":", 4);
+    jer_encoder_append_bool(encoder_p, src_p->c);
+    jer_encoder_append_char(encoder_p, ',');
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void uper_oids_oids_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_oids_oids_c_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_char(encoder_p, '[');
+
+    for (i = 0; i < src_p->length; i++) {
+        uper_oids_oids_a_encode_jer_inner(encoder_p, &src_p->elements[i]);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+}
+
+static void uper_oids_oids_d_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_oids_oids_d_t *src_p)
+{
+    switch (src_p->choice) {
+
+    case uper_oids_oids_d_choice_a_e:
+        jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+        jer_encoder_append_oid(encoder_p,
+                               &src_p->value.a.arcs[0],
+                               src_p->value.a.length);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    case uper_oids_oids_d_choice_b_e:
+        jer_encoder_append_string(encoder_p, "{\"b\":", 5);
+        jer_encoder_append_bool(encoder_p, src_p->value.b);
+        jer_encoder_append_char(encoder_p, '}');
+        break;
+
+    default:
+        jer_encoder_abort(encoder_p, EBADCHOICE);
+        break;
+    }
+}
+
+static void uper_oids_oids_e_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_oids_oids_e_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_bool(encoder_p, src_p->a);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_b_addition_present) {
+        jer_encoder_append_string(encoder_p, "\"b\":", 4);
+        jer_encoder_append_oid(encoder_p,
+                               &src_p->b.arcs[0],
+                               src_p->b.length);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+ssize_t uper_oids_oids_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_d_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_d_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t uper_oids_oids_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_e_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_oids_oids_e_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
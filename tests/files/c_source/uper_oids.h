@@ -0,0 +1,768 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:36:21 2026.
+ */
+
+#ifndef UPER_OIDS_H
+#define UPER_OIDS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * An OBJECT IDENTIFIER as its arcs.
+ */
+struct uper_oids_oid_t {
+    uint8_t length;
+    uint32_t arcs[16];
+};
+
+/**
+ * OBJECT IDENTIFIER value id-example defined in module Oids.
+ */
+extern const struct uper_oids_oid_t uper_oids_oids_id_example_oid;
+
+/**
+ * OBJECT IDENTIFIER value id-pkcs-1 defined in module Oids.
+ */
+extern const struct uper_oids_oid_t uper_oids_oids_id_pkcs_1_oid;
+
+/**
+ * OBJECT IDENTIFIER value id-rsa-encryption defined in module Oids.
+ */
+extern const struct uper_oids_oid_t uper_oids_oids_id_rsa_encryption_oid;
+
+/**
+ * OBJECT IDENTIFIER value id-rsadsi defined in module Oids.
+ */
+extern const struct uper_oids_oid_t uper_oids_oids_id_rsadsi_oid;
+
+/**
+ * OBJECT IDENTIFIER value id-sha256-with-rsa-encryption defined in module Oids.
+ */
+extern const struct uper_oids_oid_t uper_oids_oids_id_sha256_with_rsa_encryption_oid;
+
+/**
+ * Type A in module Oids.
+ */
+struct uper_oids_oids_a_t {
+    struct uper_oids_oid_t value;
+};
+
+/**
+ * Type B in module Oids.
+ */
+struct uper_oids_oids_b_t {
+    struct uper_oids_oid_t a;
+    bool is_b_present;
+    struct uper_oids_oid_t b;
+    bool c;
+};
+
+/**
+ * Type C in module Oids.
+ */
+struct uper_oids_oids_c_t {
+    uint8_t length;
+    struct uper_oids_oids_a_t elements[4];
+};
+
+/**
+ * Type D in module Oids.
+ */
+enum uper_oids_oids_d_choice_e {
+    uper_oids_oids_d_choice_a_e,
+    uper_oids_oids_d_choice_b_e
+};
+
+struct uper_oids_oids_d_t {
+    enum uper_oids_oids_d_choice_e choice;
+    union {
+        struct uper_oids_oid_t a;
+        bool b;
+    } value;
+};
+
+/**
+ * Type E in module Oids.
+ */
+struct uper_oids_oids_e_t {
+    bool a;
+    bool is_b_addition_present;
+    struct uper_oids_oid_t b;
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * Oids, in bytes.
+ */
+#define UPER_OIDS_OIDS_A_MAX_ENCODED_SIZE 76u
+
+/**
+ * Encode type A defined in module Oids.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * Oids, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_a_encoded_size(
+    const struct uper_oids_oids_a_t *src_p);
+
+/**
+ * Decode type A defined in module Oids.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_a_decode(
+    struct uper_oids_oids_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module Oids, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * Oids after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * Oids encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_a_decode_batch(
+    struct uper_oids_oids_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type A defined in module Oids as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_a_t *src_p);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * Oids, in bytes.
+ */
+#define UPER_OIDS_OIDS_B_MAX_ENCODED_SIZE 153u
+
+/**
+ * Encode type B defined in module Oids.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * Oids, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_b_encoded_size(
+    const struct uper_oids_oids_b_t *src_p);
+
+/**
+ * Decode type B defined in module Oids.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_b_decode(
+    struct uper_oids_oids_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module Oids, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * Oids after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * Oids encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_b_decode_batch(
+    struct uper_oids_oids_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type B defined in module Oids, to decode
+ * with uper_oids_oids_b_decode_fields().
+ */
+#define UPER_OIDS_OIDS_B_FIELD_A (1ull << 0)
+#define UPER_OIDS_OIDS_B_FIELD_B (1ull << 1)
+#define UPER_OIDS_OIDS_B_FIELD_C (1ull << 2)
+
+/**
+ * Decode given fields of type B defined in module
+ * Oids. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_b_decode_fields(
+    struct uper_oids_oids_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type B defined in module Oids as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_b_t *src_p);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * Oids, in bytes.
+ */
+#define UPER_OIDS_OIDS_C_MAX_ENCODED_SIZE 305u
+
+/**
+ * Encode type C defined in module Oids.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * Oids, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_c_encoded_size(
+    const struct uper_oids_oids_c_t *src_p);
+
+/**
+ * Decode type C defined in module Oids.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_c_decode(
+    struct uper_oids_oids_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module Oids, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * Oids after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * Oids encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_c_decode_batch(
+    struct uper_oids_oids_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type C defined in module Oids as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_c_t *src_p);
+
+/**
+ * Maximum encoded size of type D defined in module
+ * Oids, in bytes.
+ */
+#define UPER_OIDS_OIDS_D_MAX_ENCODED_SIZE 77u
+
+/**
+ * Encode type D defined in module Oids.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_d_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_d_t *src_p);
+
+/**
+ * Calculate the encoded size of type D defined in module
+ * Oids, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_d_encoded_size(
+    const struct uper_oids_oids_d_t *src_p);
+
+/**
+ * Decode type D defined in module Oids.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_d_decode(
+    struct uper_oids_oids_d_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type D defined in
+ * module Oids, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_d_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type D defined in module
+ * Oids after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_d_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_d_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type D defined in module
+ * Oids encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_d_decode_batch(
+    struct uper_oids_oids_d_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Encode type D defined in module Oids as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_d_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_d_t *src_p);
+
+/**
+ * Maximum encoded size of type E defined in module
+ * Oids, in bytes.
+ */
+#define UPER_OIDS_OIDS_E_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type E defined in module Oids.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_e_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_e_t *src_p);
+
+/**
+ * Calculate the encoded size of type E defined in module
+ * Oids, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_e_encoded_size(
+    const struct uper_oids_oids_e_t *src_p);
+
+/**
+ * Decode type E defined in module Oids.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_e_decode(
+    struct uper_oids_oids_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Find the end of an encoded value of type E defined in
+ * module Oids, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_e_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type E defined in module
+ * Oids after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_e_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_e_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type E defined in module
+ * Oids encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_e_decode_batch(
+    struct uper_oids_oids_e_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p);
+
+/**
+ * Fields of type E defined in module Oids, to decode
+ * with uper_oids_oids_e_decode_fields().
+ */
+#define UPER_OIDS_OIDS_E_FIELD_A (1ull << 0)
+
+/**
+ * Decode given fields of type E defined in module
+ * Oids. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_oids_oids_e_decode_fields(
+    struct uper_oids_oids_e_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields);
+
+/**
+ * Encode type E defined in module Oids as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_oids_oids_e_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_oids_oids_e_t *src_p);
+
+#endif
@@ -0,0 +1,1040 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 12:55:40 2026.
+ */
+
+#ifndef UPER_OPEN_TYPES_H
+#define UPER_OPEN_TYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#ifndef ENOMEM
+#    define ENOMEM 12
+#endif
+
+#ifndef EINVAL
+#    define EINVAL 22
+#endif
+
+#ifndef EOUTOFDATA
+#    define EOUTOFDATA 500
+#endif
+
+#ifndef EBADCHOICE
+#    define EBADCHOICE 501
+#endif
+
+#ifndef EBADLENGTH
+#    define EBADLENGTH 502
+#endif
+
+#ifndef EBADENUM
+#    define EBADENUM 503
+#endif
+
+#ifndef EBADTAG
+#    define EBADTAG 504
+#endif
+
+#ifndef EBADCHAR
+#    define EBADCHAR 505
+#endif
+
+#ifndef EBADOID
+#    define EBADOID 506
+#endif
+
+#ifndef EBADDEPTH
+#    define EBADDEPTH 507
+#endif
+
+/**
+ * Encoded value of an open type, pointing into the decoded data or
+ * the arena.
+ */
+struct uper_open_types_open_type_t {
+    const uint8_t *buf;
+    size_t size;
+};
+
+/**
+ * Memory the decoders allocate SEQUENCE OF elements and OCTET STRING
+ * data from. Reset pos to zero to free everything allocated from it.
+ */
+struct uper_open_types_arena_t {
+    uint8_t *buf;
+    size_t size;
+    size_t pos;
+};
+
+/**
+ * Type A in module OpenTypes.
+ */
+struct uper_open_types_open_types_a_t {
+    uint8_t value;
+};
+
+/**
+ * Type B in module OpenTypes.
+ */
+struct uper_open_types_open_types_b_t {
+    bool a;
+    struct {
+        uint8_t length;
+        uint8_t buf[8];
+    } b;
+};
+
+/**
+ * Type C in module OpenTypes.
+ */
+struct uper_open_types_open_types_c_t {
+    const uint8_t *buf;
+    uint32_t length;
+};
+
+/**
+ * Type Field in module OpenTypes.
+ */
+struct uper_open_types_open_types_field_t {
+    uint16_t id;
+    union {
+        struct uper_open_types_open_types_a_t a;
+        struct uper_open_types_open_types_b_t b;
+        struct uper_open_types_open_types_c_t c;
+        struct uper_open_types_open_type_t unknown;
+    } value;
+};
+
+/**
+ * Type Container in module OpenTypes.
+ */
+struct uper_open_types_open_types_container_t {
+    uint8_t length;
+    struct uper_open_types_open_types_field_t elements[8];
+};
+
+/**
+ * Type Id in module OpenTypes.
+ */
+struct uper_open_types_open_types_id_t {
+    uint16_t value;
+};
+
+/**
+ * Type Message in module OpenTypes.
+ */
+struct uper_open_types_open_types_message_t {
+    bool a;
+    uint16_t id;
+    bool is_value_present;
+    union {
+        struct uper_open_types_open_types_a_t a;
+        struct uper_open_types_open_types_b_t b;
+        struct uper_open_types_open_types_c_t c;
+        struct uper_open_types_open_type_t unknown;
+    } value;
+    uint8_t b;
+};
+
+/**
+ * Maximum encoded size of type A defined in module
+ * OpenTypes, in bytes.
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_A_MAX_ENCODED_SIZE 1u
+
+/**
+ * Encode type A defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_a_t *src_p);
+
+/**
+ * Calculate the encoded size of type A defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_encoded_size(
+    const struct uper_open_types_open_types_a_t *src_p);
+
+/**
+ * Decode type A defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_decode(
+    struct uper_open_types_open_types_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type A defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type A defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_a_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type A defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_decode_batch(
+    struct uper_open_types_open_types_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type A defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_a_t *src_p);
+
+/**
+ * Maximum encoded size of type B defined in module
+ * OpenTypes, in bytes.
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_B_MAX_ENCODED_SIZE 9u
+
+/**
+ * Encode type B defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_b_t *src_p);
+
+/**
+ * Calculate the encoded size of type B defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_encoded_size(
+    const struct uper_open_types_open_types_b_t *src_p);
+
+/**
+ * Decode type B defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_decode(
+    struct uper_open_types_open_types_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type B defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type B defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_b_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type B defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_decode_batch(
+    struct uper_open_types_open_types_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Fields of type B defined in module OpenTypes, to decode
+ * with uper_open_types_open_types_b_decode_fields().
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_B_FIELD_A (1ull << 0)
+#define UPER_OPEN_TYPES_OPEN_TYPES_B_FIELD_B (1ull << 1)
+
+/**
+ * Decode given fields of type B defined in module
+ * OpenTypes. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_decode_fields(
+    struct uper_open_types_open_types_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type B defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_b_t *src_p);
+
+/**
+ * Maximum encoded size of type C defined in module
+ * OpenTypes, in bytes.
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_C_MAX_ENCODED_SIZE 201u
+
+/**
+ * Encode type C defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_c_t *src_p);
+
+/**
+ * Calculate the encoded size of type C defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_encoded_size(
+    const struct uper_open_types_open_types_c_t *src_p);
+
+/**
+ * Decode type C defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_decode(
+    struct uper_open_types_open_types_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type C defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type C defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_c_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type C defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_decode_batch(
+    struct uper_open_types_open_types_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type C defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_c_t *src_p);
+
+/**
+ * Encode type Field defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_field_t *src_p);
+
+/**
+ * Calculate the encoded size of type Field defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_encoded_size(
+    const struct uper_open_types_open_types_field_t *src_p);
+
+/**
+ * Decode type Field defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_decode(
+    struct uper_open_types_open_types_field_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type Field defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Field defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_field_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Field defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_decode_batch(
+    struct uper_open_types_open_types_field_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Fields of type Field defined in module OpenTypes, to decode
+ * with uper_open_types_open_types_field_decode_fields().
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_FIELD_FIELD_ID (1ull << 0)
+#define UPER_OPEN_TYPES_OPEN_TYPES_FIELD_FIELD_VALUE (1ull << 1)
+
+/**
+ * Decode given fields of type Field defined in module
+ * OpenTypes. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_decode_fields(
+    struct uper_open_types_open_types_field_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type Field defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_field_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_field_t *src_p);
+
+/**
+ * Encode type Container defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_container_t *src_p);
+
+/**
+ * Calculate the encoded size of type Container defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_encoded_size(
+    const struct uper_open_types_open_types_container_t *src_p);
+
+/**
+ * Decode type Container defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_decode(
+    struct uper_open_types_open_types_container_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type Container defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Container defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_container_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Container defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_decode_batch(
+    struct uper_open_types_open_types_container_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type Container defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_container_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_container_t *src_p);
+
+/**
+ * Maximum encoded size of type Id defined in module
+ * OpenTypes, in bytes.
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_ID_MAX_ENCODED_SIZE 2u
+
+/**
+ * Encode type Id defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_id_t *src_p);
+
+/**
+ * Calculate the encoded size of type Id defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_encoded_size(
+    const struct uper_open_types_open_types_id_t *src_p);
+
+/**
+ * Decode type Id defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_decode(
+    struct uper_open_types_open_types_id_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type Id defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Id defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_id_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Id defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_decode_batch(
+    struct uper_open_types_open_types_id_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type Id defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_id_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_id_t *src_p);
+
+/**
+ * Encode type Message defined in module OpenTypes.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_message_t *src_p);
+
+/**
+ * Calculate the encoded size of type Message defined in module
+ * OpenTypes, without encoding it.
+ *
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_encoded_size(
+    const struct uper_open_types_open_types_message_t *src_p);
+
+/**
+ * Decode type Message defined in module OpenTypes.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_decode(
+    struct uper_open_types_open_types_message_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Find the end of an encoded value of type Message defined in
+ * module OpenTypes, without decoding it.
+ *
+ * @param[in] src_p Data to skip.
+ * @param[in] size Size of src_p.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_skip(
+    const uint8_t *src_p,
+    size_t size);
+
+/**
+ * Encode given number of values of type Message defined in module
+ * OpenTypes after each other.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ * @param[in] count Number of values in src_p.
+ * @param[out] offsets_p Offset in dst_p of each encoded value.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_message_t *src_p,
+    size_t count,
+    size_t *offsets_p);
+
+/**
+ * Decode given number of values of type Message defined in module
+ * OpenTypes encoded after each other.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] count Number of values to decode into dst_p.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[out] offsets_p Offset in src_p of each decoded value.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_decode_batch(
+    struct uper_open_types_open_types_message_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Fields of type Message defined in module OpenTypes, to decode
+ * with uper_open_types_open_types_message_decode_fields().
+ */
+#define UPER_OPEN_TYPES_OPEN_TYPES_MESSAGE_FIELD_A (1ull << 0)
+#define UPER_OPEN_TYPES_OPEN_TYPES_MESSAGE_FIELD_ID (1ull << 1)
+#define UPER_OPEN_TYPES_OPEN_TYPES_MESSAGE_FIELD_VALUE (1ull << 2)
+#define UPER_OPEN_TYPES_OPEN_TYPES_MESSAGE_FIELD_B (1ull << 3)
+
+/**
+ * Decode given fields of type Message defined in module
+ * OpenTypes. The encoding of all other fields is skipped and their
+ * values in dst_p are left unmodified, except for presence flags and
+ * default values.
+ *
+ * @param[out] dst_p Decoded data.
+ * @param[in] src_p Data to decode.
+ * @param[in] size Size of src_p.
+ * @param[in] fields Fields to decode, a bitwise or of field defines.
+ * @param[in,out] arena_p Memory to allocate decoded data from.
+ *
+ * @return Number of bytes decoded or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_decode_fields(
+    struct uper_open_types_open_types_message_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields,
+    struct uper_open_types_arena_t *arena_p);
+
+/**
+ * Encode type Message defined in module OpenTypes as JSON
+ * (JER). The encoded text is not null terminated.
+ *
+ * @param[out] dst_p Buffer to encode into.
+ * @param[in] size Size of dst_p.
+ * @param[in] src_p Data to encode.
+ *
+ * @return Encoded data length or negative error code.
+ */
+ssize_t uper_open_types_open_types_message_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_open_types_open_types_message_t *src_p);
+
+#endif
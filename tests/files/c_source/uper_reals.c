@@ -0,0 +1,1363 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 17:14:33 2026.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "uper_reals.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static uint8_t real_encode(uint8_t *buf_p, double value)
+{
+    uint64_t bits;
+    uint64_t mantissa;
+    int32_t exponent;
+    uint8_t size;
+    uint8_t i;
+
+    (void)memcpy(&bits, &value, sizeof(bits));
+    exponent = (int32_t)((bits >> 52) & 0x7ffu);
+    mantissa = (bits & 0x000fffffffffffffull);
+
+    if (exponent == 0x7ff) {
+        if (mantissa != 0u) {
+            buf_p[0] = 0x42;
+        } else if ((bits >> 63) != 0u) {
+            buf_p[0] = 0x41;
+        } else {
+            buf_p[0] = 0x40;
+        }
+
+        return (1);
+    } else if ((exponent == 0) && (mantissa == 0u)) {
+        /* Plus zero has no contents octets. */
+        if ((bits >> 63) != 0u) {
+            buf_p[0] = 0x43;
+
+            return (1);
+        }
+
+        return (0);
+    }
+
+    if (exponent == 0) {
+        exponent = -1074;
+    } else {
+        mantissa |= 0x0010000000000000ull;
+        exponent -= 1075;
+    }
+
+    /* The mantissa must be odd. Integers and short fractions have
+       many trailing zeros, so remove whole bytes first. */
+    while ((mantissa & 0xffu) == 0u) {
+        mantissa >>= 8;
+        exponent += 8;
+    }
+
+    while ((mantissa & 1u) == 0u) {
+        mantissa >>= 1;
+        exponent++;
+    }
+
+    if ((bits >> 63) != 0u) {
+        buf_p[0] = 0xc0;
+    } else {
+        buf_p[0] = 0x80;
+    }
+
+    if ((exponent >= -128) && (exponent < 128)) {
+        buf_p[1] = (uint8_t)exponent;
+        size = 2;
+    } else {
+        buf_p[0] |= 0x01u;
+        buf_p[1] = (uint8_t)((uint32_t)exponent >> 8);
+        buf_p[2] = (uint8_t)exponent;
+        size = 3;
+    }
+
+    i = 1;
+
+    while ((mantissa >> (8u * i)) != 0u) {
+        i++;
+    }
+
+    size += i;
+
+    for (; i > 0; i--) {
+        buf_p[size - i] = (uint8_t)(mantissa >> (8u * (i - 1u)));
+    }
+
+    return (size);
+}
+
+static void encoder_append_real(struct encoder_t *self_p, double value)
+{
+    uint8_t buf[11];
+
+    /* The length determinant is always one byte. */
+    buf[0] = real_encode(&buf[1], value);
+    encoder_append_bytes(self_p, &buf[0], (size_t)buf[0] + 1u);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE uint8_t decoder_read_uint8(struct decoder_t *self_p)
+{
+    return ((uint8_t)decoder_read_non_negative_binary_integer(self_p, 8));
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static int real_decode(double *value_p, const uint8_t *buf_p, uint8_t size)
+{
+    uint8_t control;
+    uint8_t number_of_bytes;
+    uint8_t i;
+    uint64_t mantissa;
+    uint64_t bits;
+    int32_t exponent;
+    int32_t shift;
+
+    bits = 0;
+
+    if (size == 0u) {
+        (void)memcpy(value_p, &bits, sizeof(bits));
+
+        return (0);
+    }
+
+    control = buf_p[0];
+
+    if ((control & 0x80u) == 0u) {
+        if ((size != 1u) || ((control & 0xfcu) != 0x40u)) {
+            /* Decimal encodings are not supported. */
+            return (-EINVAL);
+        }
+
+        if (control == 0x40u) {
+            bits = 0x7ff0000000000000ull;
+        } else if (control == 0x41u) {
+            bits = 0xfff0000000000000ull;
+        } else if (control == 0x42u) {
+            bits = 0x7ff8000000000000ull;
+        } else {
+            bits = 0x8000000000000000ull;
+        }
+
+        (void)memcpy(value_p, &bits, sizeof(bits));
+
+        return (0);
+    }
+
+    /* Base 2 without a scaling factor, as restricted by CER and DER,
+       and an exponent of one to three bytes. Other bases and scaling
+       factors would be encoded differently, and often longer. */
+    number_of_bytes = (uint8_t)((control & 0x03u) + 1u);
+
+    if (((control & 0x3cu) != 0u)
+        || (number_of_bytes == 4u)
+        || (size < (number_of_bytes + 2u))
+        || ((size - number_of_bytes - 1u) > 8u)) {
+        return (-EINVAL);
+    }
+
+    if ((buf_p[1] & 0x80u) != 0u) {
+        exponent = -1;
+    } else {
+        exponent = 0;
+    }
+
+    for (i = 1; i <= number_of_bytes; i++) {
+        exponent = (int32_t)(((uint32_t)exponent << 8) | buf_p[i]);
+    }
+
+    mantissa = 0;
+
+    for (; i < size; i++) {
+        mantissa <<= 8;
+        mantissa |= buf_p[i];
+    }
+
+    if (mantissa != 0u) {
+        /* Canonical encodings of binary64 values have an odd mantissa
+           of at most 53 bits. */
+        while ((mantissa >> 53) != 0u) {
+            if ((mantissa & 1u) != 0u) {
+                return (-EINVAL);
+            }
+
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        while ((mantissa >> 45) == 0u) {
+            mantissa <<= 8;
+            exponent -= 8;
+        }
+
+        while ((mantissa >> 52) == 0u) {
+            mantissa <<= 1;
+            exponent--;
+        }
+
+        exponent += 1075;
+
+        if (exponent >= 0x7ff) {
+            return (-EINVAL);
+        } else if (exponent <= 0) {
+            /* Subnormal number, must be exact. */
+            shift = (1 - exponent);
+
+            if ((shift > 52)
+                || ((mantissa & ((1ull << shift) - 1u)) != 0u)) {
+                return (-EINVAL);
+            }
+
+            mantissa >>= shift;
+            exponent = 0;
+        } else {
+            mantissa &= 0x000fffffffffffffull;
+        }
+
+        bits = (((uint64_t)exponent << 52) | mantissa);
+    }
+
+    if ((control & 0x40u) != 0u) {
+        bits |= 0x8000000000000000ull;
+    }
+
+    (void)memcpy(value_p, &bits, sizeof(bits));
+
+    return (0);
+}
+
+static double decoder_read_real(struct decoder_t *self_p)
+{
+    uint8_t buf[12];
+    uint8_t size;
+    double value;
+    int res;
+
+    size = decoder_read_uint8(self_p);
+
+    if (size > sizeof(buf)) {
+        decoder_abort(self_p, EBADLENGTH);
+
+        return (0.0);
+    }
+
+    decoder_read_bytes(self_p, &buf[0], size);
+
+    if (self_p->size < 0) {
+        return (0.0);
+    }
+
+    res = real_decode(&value, &buf[0], size);
+
+    if (res != 0) {
+        decoder_abort(self_p, -res);
+
+        return (0.0);
+    }
+
+    return (value);
+}
+
+static void decoder_skip_real(struct decoder_t *self_p)
+{
+    (void)decoder_read_real(self_p);
+}
+
+struct jer_encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+static void jer_encoder_init(struct jer_encoder_t *self_p,
+                             uint8_t *buf_p,
+                             size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (ssize_t)size;
+    self_p->pos = 0;
+}
+
+static ssize_t jer_encoder_get_result(const struct jer_encoder_t *self_p)
+{
+    return (self_p->pos);
+}
+
+static void jer_encoder_abort(struct jer_encoder_t *self_p,
+                              ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static uint8_t *jer_encoder_alloc(struct jer_encoder_t *self_p,
+                                  size_t size)
+{
+    uint8_t *buf_p;
+
+    if (self_p->pos < 0) {
+        return (NULL);
+    }
+
+    if (size > (size_t)(self_p->size - self_p->pos)) {
+        jer_encoder_abort(self_p, ENOMEM);
+
+        return (NULL);
+    }
+
+    buf_p = &self_p->buf_p[self_p->pos];
+    self_p->pos += (ssize_t)size;
+
+    return (buf_p);
+}
+
+static void jer_encoder_append_string(struct jer_encoder_t *self_p,
+                                      const char *string_p,
+                                      size_t size)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, size);
+
+    if (buf_p != NULL) {
+        (void)memcpy(buf_p, string_p, size);
+    }
+}
+
+static void jer_encoder_append_char(struct jer_encoder_t *self_p,
+                                    char value)
+{
+    uint8_t *buf_p;
+
+    buf_p = jer_encoder_alloc(self_p, 1);
+
+    if (buf_p != NULL) {
+        buf_p[0] = (uint8_t)value;
+    }
+}
+
+static void jer_encoder_close(struct jer_encoder_t *self_p,
+                              char value)
+{
+    /* Replace the separator after the last member or element, if
+       any. */
+    if ((self_p->pos > 0) && (self_p->buf_p[self_p->pos - 1] == ',')) {
+        self_p->buf_p[self_p->pos - 1] = (uint8_t)value;
+    } else {
+        jer_encoder_append_char(self_p, value);
+    }
+}
+
+static void jer_encoder_append_bool(struct jer_encoder_t *self_p, bool value)
+{
+    if (value) {
+        jer_encoder_append_string(self_p, "true", 4);
+    } else {
+        jer_encoder_append_string(self_p, "false", 5);
+    }
+}
+
+static void jer_encoder_append_double(struct jer_encoder_t *self_p,
+                                      double value)
+{
+    char buf[32];
+    int length;
+
+    /* NaN compares false to everything. */
+    if (!((value <= 0.0) || (value > 0.0))) {
+        jer_encoder_append_string(self_p, "\"NaN\"", 5);
+    } else if (value > 1.7976931348623157e308) {
+        jer_encoder_append_string(self_p, "\"INF\"", 5);
+    } else if (value < -1.7976931348623157e308) {
+        jer_encoder_append_string(self_p, "\"-INF\"", 6);
+    } else {
+        length = snprintf(&buf[0], sizeof(buf), "%.17g", value);
+
+        if ((length <= 0) || ((size_t)length >= sizeof(buf))) {
+            jer_encoder_abort(self_p, EINVAL);
+
+            return;
+        }
+
+        jer_encoder_append_string(self_p, &buf[0], (size_t)length);
+
+        /* Always a number with a fraction or an exponent. */
+        if (strpbrk(&buf[0], ".e") == NULL) {
+            jer_encoder_append_string(self_p, ".0", 2);
+        }
+    }
+}
+
+static void uper_reals_reals_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_reals_reals_a_t *src_p)
+{
+    encoder_append_real(encoder_p, src_p->value);
+}
+
+static void uper_reals_reals_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_reals_reals_a_t *dst_p)
+{
+    dst_p->value = decoder_read_real(decoder_p);
+}
+
+static void uper_reals_reals_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    decoder_skip_real(decoder_p);
+}
+
+static void uper_reals_reals_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_reals_reals_b_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 2) >= 0) {
+        encoder_write_bits(encoder_p,
+                           ((uint64_t)src_p->is_c_present << 1)
+                           | (uint64_t)src_p->a,
+                           2);
+    }
+
+    encoder_append_real(encoder_p, src_p->b);
+
+    if (src_p->is_c_present) {
+        encoder_append_real(encoder_p, src_p->c);
+    }
+}
+
+static void uper_reals_reals_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_reals_reals_b_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 2);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 2);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_c_present = ((bits >> 1) != 0u);
+    dst_p->a = ((bits & 0x1u) != 0u);
+
+    dst_p->b = decoder_read_real(decoder_p);
+
+    if (dst_p->is_c_present) {
+        dst_p->c = decoder_read_real(decoder_p);
+    }
+}
+
+static void uper_reals_reals_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_reals_reals_b_t *dst_p,
+    uint64_t fields)
+{
+    dst_p->is_c_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_REALS_REALS_B_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & UPER_REALS_REALS_B_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_real(decoder_p);
+    } else {
+        decoder_skip_real(decoder_p);
+    }
+
+    if (dst_p->is_c_present) {
+        if ((fields & UPER_REALS_REALS_B_FIELD_C) != 0u) {
+            dst_p->c = decoder_read_real(decoder_p);
+        } else {
+            decoder_skip_real(decoder_p);
+        }
+    }
+}
+
+static void uper_reals_reals_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+
+    is_present = decoder_read_bool(decoder_p);
+    (void)decoder_free(decoder_p, 1u);
+    decoder_skip_real(decoder_p);
+    if (is_present) {
+        decoder_skip_real(decoder_p);
+    }
+}
+
+static void uper_reals_reals_c_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_reals_reals_c_t *src_p)
+{
+    uint8_t i;
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->length - 0u,
+        3);
+
+    for (i = 0; i < src_p->length; i++) {
+        encoder_append_real(encoder_p, src_p->elements[i]);
+    }
+}
+
+static void uper_reals_reals_c_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_reals_reals_c_t *dst_p)
+{
+    uint8_t i;
+
+    dst_p->length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    dst_p->length += 0u;
+
+    if (dst_p->length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < dst_p->length; i++) {
+        dst_p->elements[i] = decoder_read_real(decoder_p);
+    }
+}
+
+static void uper_reals_reals_c_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    uint32_t length;
+    uint32_t i;
+
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    length += 0u;
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        decoder_skip_real(decoder_p);
+    }
+}
+
+ssize_t uper_reals_reals_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_reals_reals_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_a_encoded_size(
+    const struct uper_reals_reals_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_reals_reals_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_a_decode(
+    struct uper_reals_reals_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_reals_reals_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_reals_reals_a_decode_batch(
+    struct uper_reals_reals_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_reals_reals_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_reals_reals_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_reals_reals_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_b_encoded_size(
+    const struct uper_reals_reals_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_reals_reals_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_b_decode(
+    struct uper_reals_reals_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_reals_reals_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_reals_reals_b_decode_batch(
+    struct uper_reals_reals_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_reals_reals_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_reals_reals_b_decode_fields(
+    struct uper_reals_reals_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_c_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_reals_reals_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_c_encoded_size(
+    const struct uper_reals_reals_c_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_reals_reals_c_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_c_decode(
+    struct uper_reals_reals_c_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_c_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_c_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_reals_reals_c_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_reals_reals_c_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_c_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_reals_reals_c_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_reals_reals_c_decode_batch(
+    struct uper_reals_reals_c_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_reals_reals_c_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+static void uper_reals_reals_a_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_reals_reals_a_t *src_p)
+{
+    jer_encoder_append_double(encoder_p, (double)src_p->value);
+}
+
+static void uper_reals_reals_b_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_reals_reals_b_t *src_p)
+{
+    jer_encoder_append_string(encoder_p, "{\"a\":", 5);
+    jer_encoder_append_bool(encoder_p, src_p->a);
+    jer_encoder_append_string(encoder_p, ",\"b\":", 5);
+    jer_encoder_append_double(encoder_p, (double)src_p->b);
+    jer_encoder_append_char(encoder_p, ',');
+
+    if (src_p->is_c_present) {
+        jer_encoder_append_string(encoder_p, "\"c\":", 4);
+        jer_encoder_append_double(encoder_p, (double)src_p->c);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, '}');
+}
+
+static void uper_reals_reals_c_encode_jer_inner(
+    struct jer_encoder_t *encoder_p,
+    const struct uper_reals_reals_c_t *src_p)
+{
+    uint8_t i;
+
+    jer_encoder_append_char(encoder_p, '[');
+
+    for (i = 0; i < src_p->length; i++) {
+        jer_encoder_append_double(encoder_p, (double)src_p->elements[i]);
+        jer_encoder_append_char(encoder_p, ',');
+    }
+
+    jer_encoder_close(encoder_p, ']');
+}
+
+ssize_t uper_reals_reals_a_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_a_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_reals_reals_a_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_b_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_b_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_reals_reals_b_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
+
+ssize_t uper_reals_reals_c_encode_jer(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_reals_reals_c_t *src_p)
+{
+    struct jer_encoder_t encoder;
+
+    jer_encoder_init(&encoder, dst_p, size);
+    uper_reals_reals_c_encode_jer_inner(&encoder, src_p);
+
+    return (jer_encoder_get_result(&encoder));
+}
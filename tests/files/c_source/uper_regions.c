@@ -0,0 +1,1076 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018-2019 Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file was generated by asn1tools version 0.162.0 Fri Oct 16 16:46:30 2026.
+ */
+
+#include <string.h>
+
+#include "uper_regions.h"
+
+struct encoder_t {
+    uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+    bool size_only;
+    size_t byte_pos;
+    uint64_t bits;
+    size_t number_of_bits;
+};
+
+struct decoder_t {
+    const uint8_t *buf_p;
+    ssize_t size;
+    ssize_t pos;
+};
+
+
+/* Small hot helpers are always inlined, which lets the compiler
+   specialise them for the constant sizes of each call. Define as
+   empty to let the compiler decide, for example to save space. */
+#ifndef ALWAYS_INLINE
+#    if defined(__GNUC__)
+#        define ALWAYS_INLINE inline __attribute__((always_inline))
+#    else
+#        define ALWAYS_INLINE inline
+#    endif
+#endif
+
+static ALWAYS_INLINE void store_uint64(uint8_t *buf_p, uint64_t value)
+{
+    buf_p[0] = (uint8_t)(value >> 56);
+    buf_p[1] = (uint8_t)(value >> 48);
+    buf_p[2] = (uint8_t)(value >> 40);
+    buf_p[3] = (uint8_t)(value >> 32);
+    buf_p[4] = (uint8_t)(value >> 24);
+    buf_p[5] = (uint8_t)(value >> 16);
+    buf_p[6] = (uint8_t)(value >> 8);
+    buf_p[7] = (uint8_t)value;
+}
+
+static ALWAYS_INLINE uint64_t load_uint64(const uint8_t *buf_p)
+{
+    return (((uint64_t)buf_p[0] << 56)
+            | ((uint64_t)buf_p[1] << 48)
+            | ((uint64_t)buf_p[2] << 40)
+            | ((uint64_t)buf_p[3] << 32)
+            | ((uint64_t)buf_p[4] << 24)
+            | ((uint64_t)buf_p[5] << 16)
+            | ((uint64_t)buf_p[6] << 8)
+            | (uint64_t)buf_p[7]);
+}
+static void encoder_init(struct encoder_t *self_p,
+                         uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+    self_p->size_only = false;
+    self_p->byte_pos = 0;
+    self_p->bits = 0;
+    self_p->number_of_bits = 0;
+}
+
+static ssize_t encoder_get_result(struct encoder_t *self_p)
+{
+    size_t i;
+
+    if (self_p->size >= 0) {
+        /* Store buffered bits, if any. */
+        for (i = 0; i < ((self_p->number_of_bits + 7) / 8); i++) {
+            self_p->buf_p[self_p->byte_pos + i] =
+                (uint8_t)(self_p->bits >> (56 - 8 * i));
+        }
+
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void encoder_abort(struct encoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t encoder_alloc(struct encoder_t *self_p,
+                                           size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else if (self_p->size_only && (self_p->size >= 0)) {
+        /* Size calculation only, nothing is written. */
+        pos = -ENOMEM;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -ENOMEM;
+        encoder_abort(self_p, ENOMEM);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE void encoder_write_bits(struct encoder_t *self_p,
+                                             uint64_t value,
+                                             size_t size)
+{
+    size_t number_of_bits;
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size < 64) {
+        value &= ((1ull << size) - 1);
+    }
+
+    number_of_bits = (self_p->number_of_bits + size);
+
+    if (number_of_bits < 64) {
+        self_p->bits |= (value << (64 - number_of_bits));
+    } else {
+        /* The buffer word is full, store it. */
+        number_of_bits -= 64;
+        self_p->bits |= (value >> number_of_bits);
+        store_uint64(&self_p->buf_p[self_p->byte_pos], self_p->bits);
+        self_p->byte_pos += 8;
+
+        if (number_of_bits > 0) {
+            self_p->bits = (value << (64 - number_of_bits));
+        } else {
+            self_p->bits = 0;
+        }
+    }
+
+    self_p->number_of_bits = number_of_bits;
+}
+
+static void encoder_write_bytes(struct encoder_t *self_p,
+                                const uint8_t *buf_p,
+                                size_t size)
+{
+    size_t i;
+
+    /* Store all complete buffered bytes. */
+    while (self_p->number_of_bits >= 8) {
+        self_p->buf_p[self_p->byte_pos] = (uint8_t)(self_p->bits >> 56);
+        self_p->byte_pos++;
+        self_p->bits <<= 8;
+        self_p->number_of_bits -= 8;
+    }
+
+    if (self_p->number_of_bits == 0) {
+        (void)memcpy(&self_p->buf_p[self_p->byte_pos], buf_p, size);
+        self_p->byte_pos += size;
+    } else {
+        for (i = 0; (i + 8) <= size; i += 8) {
+            encoder_write_bits(self_p, load_uint64(&buf_p[i]), 64);
+        }
+
+        for (; i < size; i++) {
+            encoder_write_bits(self_p, buf_p[i], 8);
+        }
+    }
+}
+
+static void encoder_append_bytes(struct encoder_t *self_p,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    if (encoder_alloc(self_p, 8u * size) < 0) {
+        return;
+    }
+
+    encoder_write_bytes(self_p, buf_p, size);
+}
+
+static ALWAYS_INLINE void encoder_append_non_negative_binary_integer(struct encoder_t *self_p,
+                                                                     uint64_t value,
+                                                                     size_t size)
+{
+    if (encoder_alloc(self_p, size) < 0) {
+        return;
+    }
+
+    encoder_write_bits(self_p, value, size);
+}
+
+static ALWAYS_INLINE void encoder_append_bit(struct encoder_t *self_p,
+                                             int value)
+{
+    encoder_append_non_negative_binary_integer(self_p, (uint64_t)value, 1);
+}
+
+static ALWAYS_INLINE void encoder_append_bool(struct encoder_t *self_p, bool value)
+{
+    encoder_append_bit(self_p, value ? 1 : 0);
+}
+
+static void decoder_init(struct decoder_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    self_p->buf_p = buf_p;
+    self_p->size = (8 * (ssize_t)size);
+    self_p->pos = 0;
+}
+
+static ssize_t decoder_get_result(const struct decoder_t *self_p)
+{
+    if (self_p->size >= 0) {
+        return ((self_p->pos + 7) / 8);
+    } else {
+        return (self_p->pos);
+    }
+}
+
+static void decoder_abort(struct decoder_t *self_p,
+                          ssize_t error)
+{
+    if (self_p->size >= 0) {
+        self_p->size = -error;
+        self_p->pos = -error;
+    }
+}
+
+static ALWAYS_INLINE ssize_t decoder_free(struct decoder_t *self_p,
+                                          size_t size)
+{
+    ssize_t pos;
+
+    if ((self_p->pos + (ssize_t)size) <= self_p->size) {
+        pos = self_p->pos;
+        self_p->pos += (ssize_t)size;
+    } else {
+        pos = -EOUTOFDATA;
+        decoder_abort(self_p, EOUTOFDATA);
+    }
+
+    return (pos);
+}
+
+static ALWAYS_INLINE uint64_t decoder_load_window(const struct decoder_t *self_p,
+                                                  size_t byte_pos)
+{
+    uint64_t window;
+    size_t left;
+    size_t i;
+
+    left = (((size_t)self_p->size / 8u) - byte_pos);
+
+    if (left >= 8) {
+        window = load_uint64(&self_p->buf_p[byte_pos]);
+    } else {
+        /* Tail of the buffer, never read past its end. */
+        window = 0;
+
+        for (i = 0; i < left; i++) {
+            window |= ((uint64_t)self_p->buf_p[byte_pos + i] << (56 - 8 * i));
+        }
+    }
+
+    return (window);
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_bits(const struct decoder_t *self_p,
+                                                size_t pos,
+                                                size_t size)
+{
+    uint64_t window;
+
+    window = decoder_load_window(self_p, pos / 8u);
+
+    return ((window << (pos % 8u)) >> (64u - size));
+}
+
+static ALWAYS_INLINE int decoder_read_bit(struct decoder_t *self_p)
+{
+    ssize_t pos;
+    int value;
+
+    pos = decoder_free(self_p, 1);
+
+    if (pos >= 0) {
+        value = ((self_p->buf_p[(size_t)pos / 8u] >> (7u - ((size_t)pos % 8u))) & 1);
+    } else {
+        value = 0;
+    }
+
+    return (value);
+}
+
+static void decoder_read_bytes(struct decoder_t *self_p,
+                               uint8_t *buf_p,
+                               size_t size)
+{
+    size_t i;
+    ssize_t pos;
+    size_t bit_pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, 8u * size);
+
+    if (pos < 0) {
+        return;
+    }
+
+    bit_pos = (size_t)pos;
+
+    if ((bit_pos % 8u) == 0) {
+        (void)memcpy(buf_p, &self_p->buf_p[bit_pos / 8u], size);
+    } else {
+        /* Seven bytes per window load. */
+        while (size >= 7) {
+            value = decoder_read_bits(self_p, bit_pos, 56);
+            buf_p[0] = (uint8_t)(value >> 48);
+            buf_p[1] = (uint8_t)(value >> 40);
+            buf_p[2] = (uint8_t)(value >> 32);
+            buf_p[3] = (uint8_t)(value >> 24);
+            buf_p[4] = (uint8_t)(value >> 16);
+            buf_p[5] = (uint8_t)(value >> 8);
+            buf_p[6] = (uint8_t)value;
+            buf_p += 7;
+            bit_pos += 56;
+            size -= 7;
+        }
+
+        for (i = 0; i < size; i++) {
+            buf_p[i] = (uint8_t)decoder_read_bits(self_p, bit_pos, 8);
+            bit_pos += 8;
+        }
+    }
+}
+
+static ALWAYS_INLINE uint64_t decoder_read_non_negative_binary_integer(struct decoder_t *self_p,
+                                                                       size_t size)
+{
+    ssize_t pos;
+    uint64_t value;
+
+    pos = decoder_free(self_p, size);
+
+    if ((pos < 0) || (size == 0)) {
+        return (0);
+    }
+
+    /* A window holds at least 57 bits at any bit offset. */
+    if (size <= 57) {
+        value = decoder_read_bits(self_p, (size_t)pos, size);
+    } else {
+        value = (decoder_read_bits(self_p, (size_t)pos, size - 32) << 32);
+        value |= decoder_read_bits(self_p, (size_t)pos + size - 32, 32);
+    }
+
+    return (value);
+}
+
+static ALWAYS_INLINE bool decoder_read_bool(struct decoder_t *self_p)
+{
+    return (decoder_read_bit(self_p) != 0);
+}
+
+static void uper_regions_regions_a_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_regions_regions_a_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 12) >= 0) {
+        encoder_write_bits(encoder_p,
+                           ((uint64_t)src_p->is_h_present << 11)
+                           | (((uint64_t)src_p->a & 0x7u) << 8)
+                           | ((uint64_t)src_p->b << 7)
+                           | ((uint64_t)(src_p->c - -5) & 0x7fu),
+                           12);
+    }
+
+    encoder_append_non_negative_binary_integer(
+        encoder_p,
+        src_p->d.length - 0u,
+        3);
+    encoder_append_bytes(encoder_p,
+                         &src_p->d.buf[0],
+                         src_p->d.length);
+
+    if (encoder_alloc(encoder_p, 9) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (((uint64_t)(src_p->e - 10) & 0xffu) << 1)
+                           | (uint64_t)src_p->f,
+                           9);
+    }
+
+    encoder_append_bytes(encoder_p,
+                         &src_p->g.buf[0],
+                         2);
+
+    if (src_p->is_h_present) {
+        encoder_append_non_negative_binary_integer(
+            encoder_p,
+            (uint64_t)(src_p->h - 0),
+            1);
+    }
+
+    if (encoder_alloc(encoder_p, 12) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (((uint64_t)(src_p->i - -1000) & 0x7ffu) << 1)
+                           | (uint64_t)src_p->j,
+                           12);
+    }
+}
+
+static void uper_regions_regions_a_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_regions_regions_a_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+    ssize_t pos_2;
+    uint64_t bits_2;
+    ssize_t pos_3;
+    uint64_t bits_3;
+
+    pos = decoder_free(decoder_p, 12);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 12);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_h_present = ((bits >> 11) != 0u);
+    dst_p->a = (uint8_t)((bits >> 8) & 0x7u);
+    dst_p->b = (((bits >> 7) & 0x1u) != 0u);
+    dst_p->c = (int8_t)((int64_t)(bits & 0x7fu) - 5);
+
+    dst_p->d.length = decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    dst_p->d.length += 0u;
+
+    if (dst_p->d.length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->d.buf[0],
+                       dst_p->d.length);
+
+    pos_2 = decoder_free(decoder_p, 9);
+
+    if (pos_2 >= 0) {
+        bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 9);
+    } else {
+        bits_2 = 0;
+    }
+
+    dst_p->e = (uint16_t)((bits_2 >> 1) + 10u);
+    dst_p->f = ((bits_2 & 0x1u) != 0u);
+
+    decoder_read_bytes(decoder_p,
+                       &dst_p->g.buf[0],
+                       2);
+
+    if (dst_p->is_h_present) {
+        dst_p->h = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            1);
+        dst_p->h += 0;
+    }
+
+    pos_3 = decoder_free(decoder_p, 12);
+
+    if (pos_3 >= 0) {
+        bits_3 = decoder_read_bits(decoder_p, (size_t)pos_3, 12);
+    } else {
+        bits_3 = 0;
+    }
+
+    dst_p->i = (int16_t)((int64_t)(bits_3 >> 1) - 1000);
+    dst_p->j = ((bits_3 & 0x1u) != 0u);
+}
+
+static void uper_regions_regions_a_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_regions_regions_a_t *dst_p,
+    uint64_t fields)
+{
+    uint32_t length;
+
+    dst_p->is_h_present = decoder_read_bool(decoder_p);
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_A) != 0u) {
+        dst_p->a = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            3);
+        dst_p->a += 0;
+    } else {
+        (void)decoder_free(decoder_p, 3u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_B) != 0u) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            7);
+        dst_p->c += -5;
+    } else {
+        (void)decoder_free(decoder_p, 7u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_D) != 0u) {
+        dst_p->d.length = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            3);
+        dst_p->d.length += 0u;
+
+        if (dst_p->d.length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        decoder_read_bytes(decoder_p,
+                           &dst_p->d.buf[0],
+                           dst_p->d.length);
+    } else {
+        length = (uint32_t)decoder_read_non_negative_binary_integer(
+            decoder_p,
+            3);
+        length += 0u;
+
+        if (length > 4u) {
+            decoder_abort(decoder_p, EBADLENGTH);
+
+            return;
+        }
+
+        (void)decoder_free(decoder_p, 8u * length);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            8);
+        dst_p->e += 10;
+    } else {
+        (void)decoder_free(decoder_p, 8u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_F) != 0u) {
+        dst_p->f = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_G) != 0u) {
+        decoder_read_bytes(decoder_p,
+                           &dst_p->g.buf[0],
+                           2);
+    } else {
+        (void)decoder_free(decoder_p, 16u);
+    }
+
+    if (dst_p->is_h_present) {
+        if ((fields & UPER_REGIONS_REGIONS_A_FIELD_H) != 0u) {
+            dst_p->h = decoder_read_non_negative_binary_integer(
+                decoder_p,
+                1);
+            dst_p->h += 0;
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_I) != 0u) {
+        dst_p->i = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            11);
+        dst_p->i += -1000;
+    } else {
+        (void)decoder_free(decoder_p, 11u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_A_FIELD_J) != 0u) {
+        dst_p->j = decoder_read_bool(decoder_p);
+    } else {
+        (void)decoder_free(decoder_p, 1u);
+    }
+}
+
+static void uper_regions_regions_a_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    uint32_t length;
+
+    is_present = decoder_read_bool(decoder_p);
+    (void)decoder_free(decoder_p, 11u);
+    length = (uint32_t)decoder_read_non_negative_binary_integer(
+        decoder_p,
+        3);
+    length += 0u;
+
+    if (length > 4u) {
+        decoder_abort(decoder_p, EBADLENGTH);
+
+        return;
+    }
+
+    (void)decoder_free(decoder_p, 8u * length);
+    (void)decoder_free(decoder_p, 25u);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 12u);
+}
+
+static void uper_regions_regions_b_encode_inner(
+    struct encoder_t *encoder_p,
+    const struct uper_regions_regions_b_t *src_p)
+{
+    if (encoder_alloc(encoder_p, 3) >= 0) {
+        encoder_write_bits(encoder_p,
+                           ((uint64_t)src_p->is_a_present << 1)
+                           | (uint64_t)src_p->is_b_present,
+                           3);
+    }
+
+    if (src_p->is_a_present) {
+        encoder_append_bool(encoder_p, src_p->a);
+    }
+
+    if (src_p->is_b_present) {
+        encoder_append_bool(encoder_p, src_p->b);
+    }
+
+    if (encoder_alloc(encoder_p, 40) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (((uint64_t)src_p->c & 0xfffffu) << 20)
+                           | ((uint64_t)src_p->d & 0xfffffu),
+                           40);
+    }
+
+    if (encoder_alloc(encoder_p, 22) >= 0) {
+        encoder_write_bits(encoder_p,
+                           (((uint64_t)(src_p->e - -1000000) & 0xfffffu) << 2)
+                           | ((uint64_t)src_p->f & 0x3u),
+                           22);
+    }
+}
+
+static void uper_regions_regions_b_decode_inner(
+    struct decoder_t *decoder_p,
+    struct uper_regions_regions_b_t *dst_p)
+{
+    ssize_t pos;
+    uint64_t bits;
+    ssize_t pos_2;
+    uint64_t bits_2;
+    ssize_t pos_3;
+    uint64_t bits_3;
+
+    pos = decoder_free(decoder_p, 3);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 3);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = (((bits >> 1) & 0x1u) != 0u);
+    dst_p->is_b_present = ((bits & 0x1u) != 0u);
+
+    if (dst_p->is_a_present) {
+        dst_p->a = decoder_read_bool(decoder_p);
+    }
+
+    if (dst_p->is_b_present) {
+        dst_p->b = decoder_read_bool(decoder_p);
+    }
+
+    pos_2 = decoder_free(decoder_p, 40);
+
+    if (pos_2 >= 0) {
+        bits_2 = decoder_read_bits(decoder_p, (size_t)pos_2, 40);
+    } else {
+        bits_2 = 0;
+    }
+
+    dst_p->c = (uint32_t)(bits_2 >> 20);
+    dst_p->d = (uint32_t)(bits_2 & 0xfffffu);
+
+    pos_3 = decoder_free(decoder_p, 22);
+
+    if (pos_3 >= 0) {
+        bits_3 = decoder_read_bits(decoder_p, (size_t)pos_3, 22);
+    } else {
+        bits_3 = 0;
+    }
+
+    dst_p->e = (int32_t)((int64_t)(bits_3 >> 2) - 1000000);
+    dst_p->f = (uint8_t)(bits_3 & 0x3u);
+}
+
+static void uper_regions_regions_b_decode_fields_inner(
+    struct decoder_t *decoder_p,
+    struct uper_regions_regions_b_t *dst_p,
+    uint64_t fields)
+{
+    ssize_t pos;
+    uint64_t bits;
+
+    pos = decoder_free(decoder_p, 3);
+
+    if (pos >= 0) {
+        bits = decoder_read_bits(decoder_p, (size_t)pos, 3);
+    } else {
+        bits = 0;
+    }
+
+    dst_p->is_a_present = (((bits >> 1) & 0x1u) != 0u);
+    dst_p->is_b_present = ((bits & 0x1u) != 0u);
+
+    if (dst_p->is_a_present) {
+        if ((fields & UPER_REGIONS_REGIONS_B_FIELD_A) != 0u) {
+            dst_p->a = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if (dst_p->is_b_present) {
+        if ((fields & UPER_REGIONS_REGIONS_B_FIELD_B) != 0u) {
+            dst_p->b = decoder_read_bool(decoder_p);
+        } else {
+            (void)decoder_free(decoder_p, 1u);
+        }
+    }
+
+    if ((fields & UPER_REGIONS_REGIONS_B_FIELD_C) != 0u) {
+        dst_p->c = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            20);
+        dst_p->c += 0;
+    } else {
+        (void)decoder_free(decoder_p, 20u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_B_FIELD_D) != 0u) {
+        dst_p->d = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            20);
+        dst_p->d += 0;
+    } else {
+        (void)decoder_free(decoder_p, 20u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_B_FIELD_E) != 0u) {
+        dst_p->e = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            20);
+        dst_p->e += -1000000;
+    } else {
+        (void)decoder_free(decoder_p, 20u);
+    }
+    if ((fields & UPER_REGIONS_REGIONS_B_FIELD_F) != 0u) {
+        dst_p->f = decoder_read_non_negative_binary_integer(
+            decoder_p,
+            2);
+        dst_p->f += 0;
+    } else {
+        (void)decoder_free(decoder_p, 2u);
+    }
+}
+
+static void uper_regions_regions_b_skip_inner(
+    struct decoder_t *decoder_p)
+{
+    bool is_present;
+    bool is_present_2;
+
+    (void)decoder_free(decoder_p, 1u);
+    is_present = decoder_read_bool(decoder_p);
+    is_present_2 = decoder_read_bool(decoder_p);
+    if (is_present) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    if (is_present_2) {
+        (void)decoder_free(decoder_p, 1u);
+    }
+    (void)decoder_free(decoder_p, 62u);
+}
+
+ssize_t uper_regions_regions_a_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_regions_regions_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_regions_regions_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_regions_regions_a_encoded_size(
+    const struct uper_regions_regions_a_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_regions_regions_a_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_regions_regions_a_decode(
+    struct uper_regions_regions_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_regions_regions_a_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_regions_regions_a_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_regions_regions_a_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_regions_regions_a_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_regions_regions_a_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_regions_regions_a_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_regions_regions_a_decode_batch(
+    struct uper_regions_regions_a_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_regions_regions_a_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_regions_regions_a_decode_fields(
+    struct uper_regions_regions_a_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_regions_regions_a_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_regions_regions_b_encode(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_regions_regions_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, dst_p, size);
+    uper_regions_regions_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_regions_regions_b_encoded_size(
+    const struct uper_regions_regions_b_t *src_p)
+{
+    struct encoder_t encoder;
+
+    encoder_init(&encoder, NULL, 0);
+    encoder.size_only = true;
+    uper_regions_regions_b_encode_inner(&encoder, src_p);
+
+    return (encoder_get_result(&encoder));
+}
+
+ssize_t uper_regions_regions_b_decode(
+    struct uper_regions_regions_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_regions_regions_b_decode_inner(&decoder, dst_p);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_regions_regions_b_skip(
+    const uint8_t *src_p,
+    size_t size)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_regions_regions_b_skip_inner(&decoder);
+
+    return (decoder_get_result(&decoder));
+}
+
+ssize_t uper_regions_regions_b_encode_batch(
+    uint8_t *dst_p,
+    size_t size,
+    const struct uper_regions_regions_b_t *src_p,
+    size_t count,
+    size_t *offsets_p)
+{
+    struct encoder_t encoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        encoder_init(&encoder, &dst_p[pos], size - pos);
+        uper_regions_regions_b_encode_inner(&encoder, &src_p[i]);
+        res = encoder_get_result(&encoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_regions_regions_b_decode_batch(
+    struct uper_regions_regions_b_t *dst_p,
+    size_t count,
+    const uint8_t *src_p,
+    size_t size,
+    size_t *offsets_p)
+{
+    struct decoder_t decoder;
+    ssize_t res;
+    size_t pos;
+    size_t i;
+
+    pos = 0;
+
+    for (i = 0; i < count; i++) {
+        decoder_init(&decoder, &src_p[pos], size - pos);
+        uper_regions_regions_b_decode_inner(&decoder, &dst_p[i]);
+        res = decoder_get_result(&decoder);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        offsets_p[i] = pos;
+        pos += (size_t)res;
+    }
+
+    return ((ssize_t)pos);
+}
+
+ssize_t uper_regions_regions_b_decode_fields(
+    struct uper_regions_regions_b_t *dst_p,
+    const uint8_t *src_p,
+    size_t size,
+    uint64_t fields)
+{
+    struct decoder_t decoder;
+
+    decoder_init(&decoder, src_p, size);
+    uper_regions_regions_b_decode_fields_inner(&decoder, dst_p, fields);
+
+    return (decoder_get_result(&decoder));
+}
@@ -0,0 +1,305 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "oer_arrays.h"
+#include "uper_arrays.h"
+
+TEST(oer_arrays_a)
+{
+    uint8_t encoded[80];
+    struct oer_arrays_arrays_a_t decoded;
+    const uint8_t expected[80] = {
+        0x01, 0x02, 0x00, 0xff,
+        0x01, 0x03, 0x80, 0x7f, 0xff,
+        0x01, 0x02, 0x12, 0x34, 0xff, 0xff,
+        0x01, 0x03, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xfe,
+        0x01, 0x01, 0x12, 0x34, 0x56, 0x78,
+        0x01, 0x02, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfd,
+        0x01, 0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x01, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+        0x01, 0x03, 0xff, 0x00, 0xff
+    };
+
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.a.length = 2;
+    decoded.a.elements[0] = 0;
+    decoded.a.elements[1] = 255;
+    decoded.b.length = 3;
+    decoded.b.elements[0] = -128;
+    decoded.b.elements[1] = 127;
+    decoded.b.elements[2] = -1;
+    decoded.c.length = 2;
+    decoded.c.elements[0] = 0x1234;
+    decoded.c.elements[1] = 65535;
+    decoded.d.length = 3;
+    decoded.d.elements[0] = -32768;
+    decoded.d.elements[1] = 32767;
+    decoded.d.elements[2] = -2;
+    decoded.e.length = 1;
+    decoded.e.elements[0] = 0x12345678;
+    decoded.f.length = 2;
+    decoded.f.elements[0] = INT32_MIN;
+    decoded.f.elements[1] = -3;
+    decoded.g.length = 2;
+    decoded.g.elements[0] = 0x0102030405060708;
+    decoded.g.elements[1] = UINT64_MAX;
+    decoded.h.length = 2;
+    decoded.h.elements[0] = INT64_MIN;
+    decoded.h.elements[1] = -4;
+    decoded.i.elements[0] = true;
+    decoded.i.elements[1] = false;
+    decoded.i.elements[2] = true;
+
+    ASSERT_EQ(oer_arrays_arrays_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(oer_arrays_arrays_a_encode(&encoded[0],
+                                         sizeof(encoded),
+                                         &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], &expected[0], sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_arrays_arrays_a_decode(&decoded,
+                                         &encoded[0],
+                                         sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.a.length, 2);
+    ASSERT_EQ(decoded.a.elements[1], 255);
+    ASSERT_EQ(decoded.b.length, 3);
+    ASSERT_EQ(decoded.b.elements[0], -128);
+    ASSERT_EQ(decoded.b.elements[2], -1);
+    ASSERT_EQ(decoded.c.length, 2);
+    ASSERT_EQ(decoded.c.elements[0], 0x1234);
+    ASSERT_EQ(decoded.c.elements[1], 65535);
+    ASSERT_EQ(decoded.d.length, 3);
+    ASSERT_EQ(decoded.d.elements[0], -32768);
+    ASSERT_EQ(decoded.d.elements[2], -2);
+    ASSERT_EQ(decoded.e.length, 1);
+    ASSERT_EQ(decoded.e.elements[0], 0x12345678);
+    ASSERT_EQ(decoded.f.length, 2);
+    ASSERT_EQ(decoded.f.elements[0], INT32_MIN);
+    ASSERT_EQ(decoded.f.elements[1], -3);
+    ASSERT_EQ(decoded.g.length, 2);
+    ASSERT_EQ(decoded.g.elements[0], 0x0102030405060708);
+    ASSERT_EQ(decoded.g.elements[1], UINT64_MAX);
+    ASSERT_EQ(decoded.h.length, 2);
+    ASSERT_EQ(decoded.h.elements[0], INT64_MIN);
+    ASSERT_EQ(decoded.h.elements[1], -4);
+    ASSERT_TRUE(decoded.i.elements[0]);
+    ASSERT_FALSE(decoded.i.elements[1]);
+    ASSERT_TRUE(decoded.i.elements[2]);
+
+    /* Not enough space for the last elements. */
+    ASSERT_EQ(oer_arrays_arrays_a_encode(&encoded[0],
+                                         sizeof(encoded) - 1,
+                                         &decoded), -ENOMEM);
+    ASSERT_EQ(oer_arrays_arrays_a_decode(&decoded,
+                                         &encoded[0],
+                                         sizeof(encoded) - 1), -EOUTOFDATA);
+}
+
+TEST(oer_arrays_b)
+{
+    static uint8_t encoded[3 + 2 * 4096];
+    static struct oer_arrays_arrays_b_t decoded;
+    uint32_t i;
+
+    decoded.length = 4096;
+
+    for (i = 0; i < 4096; i++) {
+        decoded.elements[i] = (uint16_t)(7 * i);
+    }
+
+    ASSERT_EQ(oer_arrays_arrays_b_encode(&encoded[0],
+                                         sizeof(encoded),
+                                         &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x02\x10\x00", 3);
+
+    for (i = 0; i < 4096; i++) {
+        ASSERT_EQ(encoded[3 + 2 * i], (uint8_t)((7 * i) >> 8));
+        ASSERT_EQ(encoded[4 + 2 * i], (uint8_t)(7 * i));
+    }
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_arrays_arrays_b_decode(&decoded,
+                                         &encoded[0],
+                                         sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 4096);
+
+    for (i = 0; i < 4096; i++) {
+        ASSERT_EQ(decoded.elements[i], (uint16_t)(7 * i));
+    }
+
+    /* Not enough space for the elements. */
+    ASSERT_EQ(oer_arrays_arrays_b_encode(&encoded[0],
+                                         sizeof(encoded) - 1,
+                                         &decoded), -ENOMEM);
+    ASSERT_EQ(oer_arrays_arrays_b_decode(&decoded,
+                                         &encoded[0],
+                                         sizeof(encoded) - 1), -EOUTOFDATA);
+}
+
+static void write_bits(uint8_t *buf_p, size_t *pos_p, uint32_t value, int size)
+{
+    int i;
+
+    for (i = size - 1; i >= 0; i--) {
+        if ((value >> i) & 1) {
+            buf_p[*pos_p / 8] |= (uint8_t)(0x80 >> (*pos_p % 8));
+        }
+
+        (*pos_p)++;
+    }
+}
+
+TEST(uper_arrays_c)
+{
+    static uint8_t encoded[502];
+    static uint8_t expected[502];
+    static struct uper_arrays_arrays_c_t decoded;
+    size_t pos;
+    uint32_t length;
+    uint32_t i;
+
+    /* Both full words and remaining elements, for some lengths. */
+    for (length = 0; length <= 1000; length += 111) {
+        decoded.length = length;
+        memset(&expected[0], 0, sizeof(expected));
+        pos = 0;
+        write_bits(&expected[0], &pos, length, 10);
+
+        for (i = 0; i < length; i++) {
+            decoded.elements[i] = (uint8_t)((7 * i) % 16);
+            write_bits(&expected[0], &pos, (7 * i) % 16, 4);
+        }
+
+        ASSERT_EQ(uper_arrays_arrays_c_encode(&encoded[0],
+                                              sizeof(encoded),
+                                              &decoded), (pos + 7) / 8);
+        ASSERT_MEMORY_EQ(&encoded[0], &expected[0], (pos + 7) / 8);
+
+        memset(&decoded, 0, sizeof(decoded));
+        ASSERT_EQ(uper_arrays_arrays_c_decode(&decoded,
+                                              &encoded[0],
+                                              (pos + 7) / 8), (pos + 7) / 8);
+        ASSERT_EQ(decoded.length, length);
+
+        for (i = 0; i < length; i++) {
+            ASSERT_EQ(decoded.elements[i], (7 * i) % 16);
+        }
+    }
+
+    /* Not enough space for the last element. */
+    decoded.length = 1000;
+
+    for (i = 0; i < 1000; i++) {
+        decoded.elements[i] = (uint8_t)((7 * i) % 16);
+    }
+
+    ASSERT_EQ(uper_arrays_arrays_c_encode(&encoded[0], 502, &decoded), 502);
+    ASSERT_EQ(uper_arrays_arrays_c_encode(&encoded[0], 501, &decoded),
+              -ENOMEM);
+    ASSERT_EQ(uper_arrays_arrays_c_decode(&decoded, &encoded[0], 501),
+              -EOUTOFDATA);
+}
+
+TEST(uper_arrays_d)
+{
+    uint8_t encoded[9];
+    struct uper_arrays_arrays_d_t decoded;
+    uint8_t i;
+
+    decoded.length = 31;
+
+    for (i = 0; i < 31; i++) {
+        decoded.elements[i] = (enum uper_arrays_arrays_d_e)(i % 3);
+    }
+
+    decoded.elements[30] = uper_arrays_arrays_d_c_e;
+    ASSERT_EQ(uper_arrays_arrays_d_encode(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x3e\x30\xc3\x0c\x30\xc3\x0c\x30\xd0",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_arrays_arrays_d_decode(&decoded,
+                                          &encoded[0],
+                                          sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 31);
+
+    for (i = 0; i < 30; i++) {
+        ASSERT_EQ(decoded.elements[i], i % 3);
+    }
+
+    ASSERT_EQ(decoded.elements[30], uper_arrays_arrays_d_c_e);
+
+    /* Bad value in a word. */
+    encoded[0] |= 0x01;
+    encoded[1] |= 0x80;
+    ASSERT_EQ(uper_arrays_arrays_d_decode(&decoded,
+                                          &encoded[0],
+                                          sizeof(encoded)), -EBADENUM);
+
+    /* Bad value in the remaining elements. */
+    encoded[0] &= 0xfe;
+    encoded[1] &= 0x7f;
+    encoded[8] |= 0x08;
+    ASSERT_EQ(uper_arrays_arrays_d_decode(&decoded,
+                                          &encoded[0],
+                                          sizeof(encoded)), -EBADENUM);
+}
+
+TEST(uper_arrays_e)
+{
+    uint8_t encoded[26];
+    struct uper_arrays_arrays_e_t decoded;
+    uint8_t i;
+
+    for (i = 0; i < 20; i++) {
+        decoded.a.elements[i] = (int8_t)((i % 7) - 3);
+    }
+
+    decoded.b.length = 60;
+
+    for (i = 0; i < 60; i++) {
+        decoded.b.elements[i] = ((i % 3) == 0);
+    }
+
+    decoded.c.length = 9;
+
+    for (i = 0; i < 9; i++) {
+        decoded.c.elements[i] = (uint16_t)(10 + 25 * i);
+    }
+
+    ASSERT_EQ(uper_arrays_arrays_e_encode(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x05\x39\x70\x29\xcb\x81\x4e\x57\x92\x49\x24\x92\x49"
+                     "\x24\x92\x49\x20\x03\x26\x49\x6c\x8f\xb2\xd5\xf9\x00",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_arrays_arrays_e_decode(&decoded,
+                                          &encoded[0],
+                                          sizeof(encoded)), sizeof(encoded));
+
+    for (i = 0; i < 20; i++) {
+        ASSERT_EQ(decoded.a.elements[i], (i % 7) - 3);
+    }
+
+    ASSERT_EQ(decoded.b.length, 60);
+
+    for (i = 0; i < 60; i++) {
+        ASSERT_EQ(decoded.b.elements[i], (i % 3) == 0);
+    }
+
+    ASSERT_EQ(decoded.c.length, 9);
+
+    for (i = 0; i < 9; i++) {
+        ASSERT_EQ(decoded.c.elements[i], 10 + 25 * i);
+    }
+}
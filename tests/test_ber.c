@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "ber.h"
+
+TEST(ber_c_source_a)
+{
+    uint8_t encoded[42];
+    struct ber_c_source_a_t decoded;
+
+    /* Encode. */
+    decoded.a = -1;
+    decoded.b = -2;
+    decoded.c = -3;
+    decoded.d = -4;
+    decoded.e = 1;
+    decoded.f = 2;
+    decoded.g = 3;
+    decoded.h = 4;
+    decoded.i = true;
+    memset(&decoded.j.buf[0], 5, sizeof(decoded.j.buf));
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(ber_c_source_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(ber_c_source_a_encode(NULL, 0, &decoded), -ENOMEM);
+    ASSERT_EQ(ber_c_source_a_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x30\x28\x80\x01\xff\x81\x01\xfe\x82\x01\xfd\x83\x01\xfc"
+                     "\x84\x01\x01\x85\x01\x02\x86\x01\x03\x87\x01\x04\x88\x01"
+                     "\xff\x89\x0b\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(ber_c_source_a_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.a, -1);
+    ASSERT_EQ(decoded.b, -2);
+    ASSERT_EQ(decoded.c, -3);
+    ASSERT_EQ(decoded.d, -4);
+    ASSERT_EQ(decoded.e, 1);
+    ASSERT_EQ(decoded.f, 2);
+    ASSERT_EQ(decoded.g, 3);
+    ASSERT_EQ(decoded.h, 4);
+    ASSERT_TRUE(decoded.i);
+    ASSERT_MEMORY_EQ(&decoded.j.buf[0],
+                     "\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05",
+                     sizeof(decoded.j.buf));
+
+    /* Skip. */
+    ASSERT_EQ(ber_c_source_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(ber_c_source_a_encode_error_no_mem)
+{
+    uint8_t encoded[41];
+    struct ber_c_source_a_t decoded;
+
+    decoded.a = -1;
+    decoded.b = -2;
+    decoded.c = -3;
+    decoded.d = -4;
+    decoded.e = 1;
+    decoded.f = 2;
+    decoded.g = 3;
+    decoded.h = 4;
+    decoded.i = true;
+    memset(&decoded.j.buf[0], 5, sizeof(decoded.j.buf));
+
+    ASSERT_EQ(ber_c_source_a_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), -ENOMEM);
+}
+
+TEST(ber_c_source_a_decode_error_out_of_data)
+{
+    uint8_t encoded[41] =
+        "\x30\x28\x80\x01\xff\x81\x01\xfe\x82\x01\xfd\x83\x01\xfc"
+        "\x84\x01\x01\x85\x01\x02\x86\x01\x03\x87\x01\x04\x88\x01"
+        "\xff\x89\x0b\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05";
+    struct ber_c_source_a_t decoded;
+
+    ASSERT_EQ(ber_c_source_a_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), -EOUTOFDATA);
+}
+
+TEST(ber_c_source_a_decode_error_bad_tag)
+{
+    uint8_t encoded[42] =
+        "\x31\x28\x80\x01\xff\x81\x01\xfe\x82\x01\xfd\x83\x01\xfc"
+        "\x84\x01\x01\x85\x01\x02\x86\x01\x03\x87\x01\x04\x88\x01"
+        "\xff\x89\x0b\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05";
+    struct ber_c_source_a_t decoded;
+
+    ASSERT_EQ(ber_c_source_a_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), -EBADTAG);
+}
+
+TEST(ber_c_source_b_choice_a)
+{
+    uint8_t encoded[3];
+    struct ber_c_source_b_t decoded;
+
+    /* Encode. */
+    decoded.choice = ber_c_source_b_choice_a_e;
+    decoded.value.a = -10;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(ber_c_source_b_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x80\x01\xf6", sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(ber_c_source_b_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.choice, ber_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded.value.a, -10);
+}
+
+TEST(ber_c_source_b_decode_error_bad_choice)
+{
+    uint8_t encoded[3] = "\x83\x01\xf6";
+    struct ber_c_source_b_t decoded;
+
+    ASSERT_EQ(ber_c_source_b_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), -EBADCHOICE);
+}
+
+TEST(ber_c_source_c)
+{
+    uint8_t encoded[8];
+    struct ber_c_source_c_t decoded;
+
+    /* Encode. */
+    decoded.length = 2;
+    decoded.elements[0].choice = ber_c_source_b_choice_a_e;
+    decoded.elements[0].value.a = -1;
+    decoded.elements[1].choice = ber_c_source_b_choice_a_e;
+    decoded.elements[1].value.a = 2;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(ber_c_source_c_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x30\x06\x80\x01\xff\x80\x01\x02",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(ber_c_source_c_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, 2);
+    ASSERT_EQ(decoded.elements[0].choice, ber_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded.elements[0].value.a, -1);
+    ASSERT_EQ(decoded.elements[1].choice, ber_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded.elements[1].value.a, 2);
+}
+
+TEST(ber_c_source_c_decode_error_bad_length)
+{
+    uint8_t encoded[11] = "\x30\x09\x80\x01\xff\x80\x01\x02\x80\x01\x03";
+    struct ber_c_source_c_t decoded;
+
+    ASSERT_EQ(ber_c_source_c_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), -EBADLENGTH);
+}
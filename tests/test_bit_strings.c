@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "oer_bit_strings.h"
+#include "uper_bit_strings.h"
+#include "per_bit_strings.h"
+
+#define C_ENCODED_JER                                                   \
+    "{\"a\":true,\"b\":{\"value\":\"101112131415161718191A1B1C1D1E1F"   \
+    "202122232425262728292A2B2C2D2E2F303132333430\",\"length\":300},"   \
+    "\"c\":\"ABC0\",\"d\":\"010203040506070880\"}"
+
+/* The C structs of all codecs have the same members. */
+#define INIT_C(c_p)                                                     \
+    do {                                                                \
+        uint8_t i;                                                      \
+                                                                        \
+        (c_p)->a = true;                                                \
+        (c_p)->b.length = 300;                                          \
+                                                                        \
+        for (i = 0; i < 38; i++) {                                      \
+            (c_p)->b.buf[i] = (uint8_t)(0x10 + i);                      \
+        }                                                               \
+                                                                        \
+        /* Unused bits are not encoded. */                              \
+        (c_p)->b.buf[37] = 0x35;                                        \
+        (c_p)->c = 0xabc0;                                              \
+        (c_p)->is_d_present = true;                                     \
+        memcpy(&(c_p)->d.buf[0],                                        \
+               "\x01\x02\x03\x04\x05\x06\x07\x08\xff",                  \
+               9);                                                      \
+    } while (0)
+
+TEST(oer_bit_strings_a)
+{
+    uint8_t encoded[13] = "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\xa0";
+    uint8_t encoded2[13];
+    struct oer_bit_strings_bit_strings_a_t decoded;
+    uint8_t i;
+
+    /* Encode. Unused bits of the last byte are ignored. */
+    for (i = 0; i < 12; i++) {
+        decoded.buf[i] = (uint8_t)(i + 1);
+    }
+
+    decoded.buf[12] = 0xaf;
+
+    ASSERT_EQ(oer_bit_strings_bit_strings_a_encode(&encoded2[0],
+                                                   sizeof(encoded2),
+                                                   &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_bit_strings_bit_strings_a_decode(&decoded,
+                                                   &encoded[0],
+                                                   sizeof(encoded)), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&decoded.buf[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(oer_bit_strings_b_decode_error_bad_length)
+{
+    struct oer_bit_strings_bit_strings_b_t decoded;
+
+    /* More than seven unused bits. */
+    ASSERT_EQ(oer_bit_strings_bit_strings_b_decode(&decoded,
+                                                   (uint8_t *)"\x03\x08\xab\xc8",
+                                                   4), -EBADLENGTH);
+
+    /* Unused bits without any bytes. */
+    ASSERT_EQ(oer_bit_strings_bit_strings_b_decode(&decoded,
+                                                   (uint8_t *)"\x01\x01",
+                                                   2), -EBADLENGTH);
+
+    /* 24 bits, but at most 20 bits. */
+    ASSERT_EQ(oer_bit_strings_bit_strings_b_decode(&decoded,
+                                                   (uint8_t *)"\x04\x00\x01\x02\x03",
+                                                   5), -EBADLENGTH);
+    ASSERT_EQ(oer_bit_strings_bit_strings_b_skip((uint8_t *)"\x04\x00\x01\x02\x03",
+                                                 5), -EBADLENGTH);
+}
+
+TEST(oer_bit_strings_c)
+{
+    uint8_t encoded[53] =
+        "\x80\xff\x27\x04\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b"
+        "\x1c\x1d\x1e\x1f\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b"
+        "\x2c\x2d\x2e\x2f\x30\x31\x32\x33\x34\x30\xab\xc0\x01\x02\x03\x04"
+        "\x05\x06\x07\x08\x80";
+    uint8_t encoded2[53];
+    uint8_t encoded_jer[152];
+    struct oer_bit_strings_bit_strings_c_t decoded;
+
+    /* Encode. */
+    INIT_C(&decoded);
+    ASSERT_EQ(oer_bit_strings_bit_strings_c_encode(&encoded2[0],
+                                                   sizeof(encoded2),
+                                                   &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+    ASSERT_EQ(oer_bit_strings_bit_strings_c_encoded_size(&decoded),
+              sizeof(encoded));
+    ASSERT_EQ(oer_bit_strings_bit_strings_c_encode_jer(&encoded_jer[0],
+                                                       sizeof(encoded_jer),
+                                                       &decoded),
+              sizeof(encoded_jer));
+    ASSERT_MEMORY_EQ(&encoded_jer[0], C_ENCODED_JER, sizeof(encoded_jer));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_bit_strings_bit_strings_c_decode(&decoded,
+                                                   &encoded[0],
+                                                   sizeof(encoded)), sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b.length, 300);
+    ASSERT_MEMORY_EQ(&decoded.b.buf[0], &encoded[4], 38);
+    ASSERT_EQ(decoded.c, 0xabc0);
+    ASSERT_TRUE(decoded.is_d_present);
+    ASSERT_MEMORY_EQ(&decoded.d.buf[0], &encoded[44], 9);
+
+    ASSERT_EQ(oer_bit_strings_bit_strings_c_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(oer_bit_strings_d)
+{
+    uint8_t encoded[12] = "\x01\x03\x01\x00\x04\x04\xf0\x00\x00\x02\x07\x80";
+    uint8_t encoded2[12];
+    struct oer_bit_strings_bit_strings_d_t decoded;
+
+    /* Decode. */
+    ASSERT_EQ(oer_bit_strings_bit_strings_d_decode(&decoded,
+                                                   &encoded[0],
+                                                   sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ(decoded.elements[0].length, 0);
+    ASSERT_EQ(decoded.elements[1].length, 20);
+    ASSERT_MEMORY_EQ(&decoded.elements[1].buf[0], "\xf0\x00\x00", 3);
+    ASSERT_EQ(decoded.elements[2].length, 1);
+    ASSERT_EQ(decoded.elements[2].buf[0], 0x80);
+
+    /* Encode. */
+    ASSERT_EQ(oer_bit_strings_bit_strings_d_encode(&encoded2[0],
+                                                   sizeof(encoded2),
+                                                   &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(uper_bit_strings_b)
+{
+    uint8_t encoded[3] = "\x6d\x5e\x40";
+    uint8_t encoded2[3];
+    struct uper_bit_strings_bit_strings_b_t decoded;
+
+    /* Encode. */
+    decoded.length = 13;
+    decoded.buf[0] = 0xab;
+    decoded.buf[1] = 0xcf;
+    ASSERT_EQ(uper_bit_strings_bit_strings_b_encode(&encoded2[0],
+                                                    sizeof(encoded2),
+                                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. Unused bits are zero. */
+    memset(&decoded, 0xff, sizeof(decoded));
+    ASSERT_EQ(uper_bit_strings_bit_strings_b_decode(&decoded,
+                                                    &encoded[0],
+                                                    sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 13);
+    ASSERT_EQ(decoded.buf[0], 0xab);
+    ASSERT_EQ(decoded.buf[1], 0xc8);
+}
+
+TEST(uper_bit_strings_b_decode_error_bad_length)
+{
+    struct uper_bit_strings_bit_strings_b_t decoded;
+
+    /* 21 bits, but at most 20 bits. */
+    ASSERT_EQ(uper_bit_strings_bit_strings_b_decode(&decoded,
+                                                    (uint8_t *)"\xa8\x00\x00",
+                                                    3), -EBADLENGTH);
+    ASSERT_EQ(uper_bit_strings_bit_strings_b_skip((uint8_t *)"\xa8\x00\x00", 3),
+              -EBADLENGTH);
+}
+
+TEST(uper_bit_strings_c)
+{
+    uint8_t encoded[49] =
+        "\xd2\xb1\x01\x11\x21\x31\x41\x51\x61\x71\x81\x91\xa1\xb1\xc1\xd1"
+        "\xe1\xf2\x02\x12\x22\x32\x42\x52\x62\x72\x82\x92\xa2\xb2\xc2\xd2"
+        "\xe2\xf3\x03\x13\x23\x33\x43\xab\xc0\x10\x20\x30\x40\x50\x60\x70"
+        "\x88";
+    uint8_t encoded2[49];
+    uint8_t encoded_jer[152];
+    struct uper_bit_strings_bit_strings_c_t decoded;
+
+    /* Encode. The bit strings are not byte aligned. */
+    INIT_C(&decoded);
+    decoded.c = 0xabc;
+    ASSERT_EQ(uper_bit_strings_bit_strings_c_encode(&encoded2[0],
+                                                    sizeof(encoded2),
+                                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+    ASSERT_EQ(uper_bit_strings_bit_strings_c_encode_jer(&encoded_jer[0],
+                                                        sizeof(encoded_jer),
+                                                        &decoded),
+              sizeof(encoded_jer));
+    ASSERT_MEMORY_EQ(&encoded_jer[0], C_ENCODED_JER, sizeof(encoded_jer));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_bit_strings_bit_strings_c_decode(&decoded,
+                                                    &encoded[0],
+                                                    sizeof(encoded)), sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b.length, 300);
+    ASSERT_EQ(decoded.b.buf[0], 0x10);
+    ASSERT_EQ(decoded.b.buf[36], 0x34);
+    ASSERT_EQ(decoded.b.buf[37], 0x30);
+    ASSERT_EQ(decoded.c, 0xabc);
+    ASSERT_TRUE(decoded.is_d_present);
+    ASSERT_MEMORY_EQ(&decoded.d.buf[0],
+                     "\x01\x02\x03\x04\x05\x06\x07\x08\x80",
+                     9);
+
+    ASSERT_EQ(uper_bit_strings_bit_strings_c_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(uper_bit_strings_d)
+{
+    uint8_t encoded[5] = "\x60\xa7\x80\x00\x06";
+    uint8_t encoded2[5];
+    struct uper_bit_strings_bit_strings_d_t decoded;
+
+    /* Decode. */
+    ASSERT_EQ(uper_bit_strings_bit_strings_d_decode(&decoded,
+                                                    &encoded[0],
+                                                    sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ(decoded.elements[0].length, 0);
+    ASSERT_EQ(decoded.elements[1].length, 20);
+    ASSERT_MEMORY_EQ(&decoded.elements[1].buf[0], "\xf0\x00\x00", 3);
+    ASSERT_EQ(decoded.elements[2].length, 1);
+    ASSERT_EQ(decoded.elements[2].buf[0], 0x80);
+
+    /* Encode. */
+    ASSERT_EQ(uper_bit_strings_bit_strings_d_encode(&encoded2[0],
+                                                    sizeof(encoded2),
+                                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(per_bit_strings_c)
+{
+    uint8_t encoded[51] =
+        "\xc0\x01\x2b\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c"
+        "\x1d\x1e\x1f\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c"
+        "\x2d\x2e\x2f\x30\x31\x32\x33\x34\x3a\xbc\x01\x02\x03\x04\x05\x06"
+        "\x07\x08\x80";
+    uint8_t encoded2[51];
+    struct per_bit_strings_bit_strings_c_t decoded;
+
+    /* Encode. The bit strings are aligned. */
+    INIT_C(&decoded);
+    decoded.c = 0xabc;
+    ASSERT_EQ(per_bit_strings_bit_strings_c_encode(&encoded2[0],
+                                                   sizeof(encoded2),
+                                                   &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_bit_strings_bit_strings_c_decode(&decoded,
+                                                   &encoded[0],
+                                                   sizeof(encoded)), sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b.length, 300);
+    ASSERT_MEMORY_EQ(&decoded.b.buf[0], &encoded[3], 37);
+    ASSERT_EQ(decoded.b.buf[37], 0x30);
+    ASSERT_EQ(decoded.c, 0xabc);
+    ASSERT_TRUE(decoded.is_d_present);
+    ASSERT_MEMORY_EQ(&decoded.d.buf[0], &encoded[42], 9);
+
+    ASSERT_EQ(per_bit_strings_bit_strings_c_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_bit_strings_d)
+{
+    uint8_t encoded[7] = "\x60\xa0\xf0\x00\x00\x80\x80";
+    uint8_t encoded2[7];
+    struct per_bit_strings_bit_strings_d_t decoded;
+
+    /* Decode. */
+    ASSERT_EQ(per_bit_strings_bit_strings_d_decode(&decoded,
+                                                   &encoded[0],
+                                                   sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ(decoded.elements[0].length, 0);
+    ASSERT_EQ(decoded.elements[1].length, 20);
+    ASSERT_MEMORY_EQ(&decoded.elements[1].buf[0], "\xf0\x00\x00", 3);
+    ASSERT_EQ(decoded.elements[2].length, 1);
+    ASSERT_EQ(decoded.elements[2].buf[0], 0x80);
+
+    /* Encode. */
+    ASSERT_EQ(per_bit_strings_bit_strings_d_encode(&encoded2[0],
+                                                   sizeof(encoded2),
+                                                   &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
@@ -15,7 +15,7 @@ class Asn1ToolsCSourceTest(unittest.TestCase):
         for codec, module in CODECS_AND_MODULES:
             foo = asn1tools.compile_string(
                 'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
-                '    A ::= OBJECT IDENTIFIER '
+                '    A ::= UTF8String '
                 'END',
                 codec)
 
@@ -23,14 +23,14 @@ class Asn1ToolsCSourceTest(unittest.TestCase):
                 module.generate(foo, 'foo')
 
             self.assertEqual(str(cm.exception),
-                             "Foo.A: Unsupported type 'OBJECT IDENTIFIER'.")
+                             "Foo.A: Unsupported type 'UTF8String'.")
 
     def test_compile_error_unsupported_type_in_sequence(self):
         for codec, module in CODECS_AND_MODULES:
             foo = asn1tools.compile_string(
                 'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
                 '    A ::= SEQUENCE { '
-                '        a NumericString '
+                '        a UTF8String '
                 '    } '
                 'END',
                 codec)
@@ -39,7 +39,40 @@ class Asn1ToolsCSourceTest(unittest.TestCase):
                 module.generate(foo, 'foo')
 
             self.assertEqual(str(cm.exception),
-                             "Foo.A.a: Unsupported type 'NumericString'.")
+                             "Foo.A.a: Unsupported type 'UTF8String'.")
+
+    def test_compile_error_object_identifier_default(self):
+        for codec, module in CODECS_AND_MODULES:
+            foo = asn1tools.compile_string(
+                'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+                '    A ::= SEQUENCE { '
+                '        a OBJECT IDENTIFIER DEFAULT { 1 2 3 } '
+                '    } '
+                'END',
+                codec)
+
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                module.generate(foo, 'foo')
+
+            self.assertEqual(
+                str(cm.exception),
+                'Foo.A.a: OBJECT IDENTIFIER DEFAULT values are not supported.')
+
+    def test_compile_error_recursive_type_without_arena(self):
+        for codec, module in CODECS_AND_MODULES:
+            foo = asn1tools.compile_string(
+                'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+                '    A ::= SEQUENCE { '
+                '        a A OPTIONAL '
+                '    } '
+                'END',
+                codec)
+
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                module.generate(foo, 'foo')
+
+            self.assertEqual(str(cm.exception),
+                             'Foo.A.a: Recursive types require an arena.')
 
     def test_compile_error_integer_no_minimum_nor_maximum(self):
         for codec, module in CODECS_AND_MODULES:
@@ -153,6 +186,20 @@ class Asn1ToolsCSourceTest(unittest.TestCase):
             self.assertEqual(str(cm.exception),
                              "Foo.A: OCTET STRING has no maximum length.")
 
+    def test_compile_error_ia5_string_no_maximum(self):
+        for codec, module in CODECS_AND_MODULES:
+            foo = asn1tools.compile_string(
+                'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+                '    A ::= IA5String (SIZE(1..MAX)) '
+                'END',
+                codec)
+
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                module.generate(foo, 'foo')
+
+            self.assertEqual(str(cm.exception),
+                             "Foo.A: IA5String has no maximum length.")
+
     def test_compile_error_sequence_of_no_size(self):
         for codec, module in CODECS_AND_MODULES:
             foo = asn1tools.compile_string(
@@ -239,30 +286,299 @@ class Asn1ToolsCSourceTest(unittest.TestCase):
                          "Foo.A: 2147483649 does not fit in int32_t.")
 
     def test_compile_error_bit_strings(self):
+        datas = [
+            (
+                'oer',
+                'A ::= BIT STRING',
+                'Foo.A: BIT STRING has no maximum length.'
+            ),
+            (
+                'oer',
+                'A ::= BIT STRING { a(0) } (SIZE(1..2))',
+                'Foo.A: BIT STRING with named bits must have a fixed size of '
+                'at most 64 bits.'
+            ),
+            (
+                'oer',
+                'A ::= SEQUENCE { a BIT STRING (SIZE(65)) DEFAULT \'00\'H }',
+                'Foo.A.a: BIT STRING DEFAULT values must have a fixed size of '
+                'at most 64 bits.'
+            ),
+            (
+                'uper',
+                'A ::= BIT STRING (SIZE(0..65536))',
+                'Foo.A: BIT STRING with a maximum size of more than 65535 bits '
+                'is not supported by UPER.'
+            ),
+            (
+                'per',
+                'A ::= BIT STRING (SIZE(65536))',
+                'Foo.A: BIT STRING with a maximum size of more than 65535 bits '
+                'is not supported by PER.'
+            ),
+            (
+                'ber',
+                'A ::= BIT STRING (SIZE(1..2))',
+                'Foo.A: BIT STRING must have a fixed size of at most 64 bits.'
+            )
+        ]
+
+        for codec, type_, message in datas:
+            foo = asn1tools.compile_string(
+                'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+                '    {} '
+                'END'.format(type_),
+                codec)
+
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                getattr(asn1tools.source.c, codec).generate(foo, 'foo')
+
+            self.assertEqual(str(cm.exception), message)
+
+    def test_compile_error_uper_octet_string_view(self):
         foo = asn1tools.compile_string(
             'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
-            '    A ::= BIT STRING (SIZE(1..2))'
+            '    A ::= SEQUENCE { '
+            '        a OCTET STRING (SIZE (0..1000)) '
+            '    } '
             'END',
-            'oer')
+            'uper')
 
         with self.assertRaises(asn1tools.errors.Error) as cm:
-            asn1tools.source.c.oer.generate(foo, 'foo')
+            asn1tools.source.c.uper.generate(foo, 'foo', view_threshold=256)
 
         self.assertEqual(str(cm.exception),
-                         "Foo.A: BIT STRING with variable SIZE not supported.")
+                         "Foo.A.a: OCTET STRING views are not supported by UPER.")
 
+    def test_compile_error_ber_addition_group(self):
         foo = asn1tools.compile_string(
             'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
-            '    A ::= BIT STRING (SIZE(65))'
+            '    A ::= SEQUENCE { '
+            '        a BOOLEAN, '
+            '        ..., '
+            '        [[ b BOOLEAN ]] '
+            '    } '
             'END',
-            'oer')
+            'ber')
 
         with self.assertRaises(asn1tools.errors.Error) as cm:
-            asn1tools.source.c.oer.generate(foo, 'foo')
+            asn1tools.source.c.ber.generate(foo, 'foo')
+
+        self.assertEqual(str(cm.exception),
+                         "Foo.A: Extension addition groups are not supported.")
+
+    def test_compile_error_ber_recursive_type(self):
+        foo = asn1tools.compile_string(
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    A ::= SEQUENCE { '
+            '        a B OPTIONAL '
+            '    } '
+            '    B ::= SEQUENCE { '
+            '        a A OPTIONAL '
+            '    } '
+            'END',
+            'ber')
+
+        with self.assertRaises(asn1tools.errors.Error) as cm:
+            asn1tools.source.c.ber.generate(foo, 'foo', arena_threshold=64)
+
+        self.assertEqual(str(cm.exception),
+                         'Foo.A.a: Recursive types are not supported.')
+
+    def test_compile_error_per_octet_string_fragmented(self):
+        foo = asn1tools.compile_string(
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    A ::= SEQUENCE { '
+            '        a OCTET STRING (SIZE (0..70000)) '
+            '    } '
+            'END',
+            'per')
+
+        with self.assertRaises(asn1tools.errors.Error) as cm:
+            asn1tools.source.c.per.generate(foo, 'foo')
+
+        self.assertEqual(str(cm.exception),
+                         "Foo.A.a: OCTET STRING with a maximum size of more than "
+                         "65535 bytes is not supported by PER.")
+
+    def test_compile_error_uper_visible_string_too_long(self):
+        foo = asn1tools.compile_string(
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    A ::= VisibleString (SIZE (0..70000)) '
+            'END',
+            'uper')
+
+        with self.assertRaises(asn1tools.errors.Error) as cm:
+            asn1tools.source.c.uper.generate(foo, 'foo')
 
         self.assertEqual(str(cm.exception),
-                         "Foo.A: BIT STRING with a length of more than 64 bits are "
-                         "not supported.")
+                         "Foo.A: VisibleString with a maximum size of more "
+                         "than 65535 characters is not supported by UPER.")
+
+    def test_compile_error_open_types(self):
+        datas = [
+            (
+                'B ::= SEQUENCE { id IE.&id, value IE.&Value } ',
+                False,
+                'Foo.B.value: Open types are only supported as members of '
+                'SEQUENCEs with a table constraint.'
+            ),
+            (
+                'B ::= SEQUENCE { '
+                '    value IE.&Value ({Ies}{@id}), '
+                '    id IE.&id ({Ies}) '
+                '} ',
+                False,
+                "Foo.B.value: Open type key 'id' is not a preceding member "
+                "of the same SEQUENCE."
+            ),
+            (
+                'B ::= SEQUENCE { '
+                '    id IE.&id ({Ies}), '
+                '    value IE.&Value ({Ies}{@id}) '
+                '} ',
+                True,
+                'Foo.B.value: Open type views require an arena in UPER.'
+            ),
+            (
+                'Jes IE ::= { { &id 0, &Value BOOLEAN } } '
+                'B ::= SEQUENCE { '
+                '    id IE.&id ({Jes}), '
+                '    value IE.&Value ({Jes}{@id}) '
+                '} ',
+                False,
+                "Foo.B.value: Open type value 'BOOLEAN' is not a type "
+                "reference."
+            )
+        ]
+
+        header = (
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    Id ::= INTEGER (0..255) '
+            '    IE ::= CLASS { &id Id UNIQUE, &Value } '
+            '    A ::= BOOLEAN '
+            '    Ies IE ::= { { &id 0, &Value A } } ')
+
+        for body, open_type_views, message in datas:
+            specification = asn1tools.parse_string(header + body + 'END')
+            foo = asn1tools.compile_dict(specification, 'uper')
+
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                asn1tools.source.c.generate(foo,
+                                            'uper',
+                                            'foo',
+                                            'foo.h',
+                                            'foo.c',
+                                            'foo_fuzzer.c',
+                                            specification=specification,
+                                            open_type_views=open_type_views)
+
+            self.assertEqual(str(cm.exception), message)
+
+    def test_compile_error_unsupported_codec(self):
+        datas = [
+            (
+                'oer',
+                'open_type_views',
+                'Open type views are not supported by OER.'
+            ),
+            (
+                'ber',
+                'open_type_views',
+                'Open type views are not supported by BER.'
+            ),
+            (
+                'der',
+                'lazy_open_types',
+                'Lazy open types are not supported by DER.'
+            ),
+            (
+                'uper',
+                'iovec_encoder',
+                'Iovec encoders are not supported by UPER.'
+            ),
+            (
+                'ber',
+                'iovec_encoder',
+                'Iovec encoders are not supported by BER.'
+            )
+        ]
+
+        specification = asn1tools.parse_string(
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    A ::= BOOLEAN '
+            'END')
+
+        for codec, option, message in datas:
+            foo = asn1tools.compile_dict(specification, codec)
+
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                asn1tools.source.c.generate(foo,
+                                            codec,
+                                            'foo',
+                                            'foo.h',
+                                            'foo.c',
+                                            'foo_fuzzer.c',
+                                            specification=specification,
+                                            **{option: True})
+
+            self.assertEqual(str(cm.exception), message)
+
+    def test_compile_error_open_types_codec(self):
+        specification = asn1tools.parse_string(
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    Id ::= INTEGER (0..255) '
+            '    IE ::= CLASS { &id Id UNIQUE, &Value } '
+            '    A ::= BOOLEAN '
+            '    Ies IE ::= { { &id 0, &Value A } } '
+            '    B ::= SEQUENCE (SIZE (0..2)) OF SEQUENCE { '
+            '        id IE.&id ({Ies}), '
+            '        value IE.&Value ({Ies}{@id}) '
+            '    } '
+            'END')
+
+        # Open types can not be compiled for these codecs, so the
+        # specification is checked before compiling it.
+        for codec in ['oer', 'ber', 'der']:
+            with self.assertRaises(asn1tools.errors.Error) as cm:
+                asn1tools.source.c.check_options(codec, specification)
+
+            self.assertEqual(str(cm.exception),
+                             'Open types are only supported by PER and UPER.')
+
+        for codec in ['per', 'uper']:
+            asn1tools.source.c.check_options(codec, specification)
+
+    def test_compile_error_jer_lazy_open_types(self):
+        specification = asn1tools.parse_string(
+            'Foo DEFINITIONS AUTOMATIC TAGS ::= BEGIN '
+            '    Id ::= INTEGER (0..255) '
+            '    IE ::= CLASS { &id Id UNIQUE, &Value } '
+            '    A ::= BOOLEAN '
+            '    Ies IE ::= { { &id 0, &Value A } } '
+            '    B ::= SEQUENCE { '
+            '        id IE.&id ({Ies}), '
+            '        value IE.&Value ({Ies}{@id}) '
+            '    } '
+            'END')
+        foo = asn1tools.compile_dict(specification, 'per')
+
+        with self.assertRaises(asn1tools.errors.Error) as cm:
+            asn1tools.source.c.generate(foo,
+                                        'per',
+                                        'foo',
+                                        'foo.h',
+                                        'foo.c',
+                                        'foo_fuzzer.c',
+                                        jer_encoder=True,
+                                        specification=specification,
+                                        lazy_open_types=True)
+
+        self.assertEqual(
+            str(cm.exception),
+            'Foo.B.value: Lazy open types are not supported by the JER '
+            'encoder.')
+
 
 if __name__ == '__main__':
     unittest.main()
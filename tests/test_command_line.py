@@ -718,6 +718,121 @@ exit
             read_file('tests/files/c_source/' + fuzzer_filename_mk),
             read_file(fuzzer_filename_mk))
 
+    def test_command_line_generate_c_source_oer_views(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--namespace', 'oer_views',
+            '--view-threshold', '256',
+            '--generate-fuzzer',
+            'tests/files/c_source/views.asn'
+        ]
+
+        filename_h = 'oer_views.h'
+        filename_c = 'oer_views.c'
+        fuzzer_filename_c = 'oer_views_fuzzer.c'
+        fuzzer_filename_mk = 'oer_views_fuzzer.mk'
+
+        for filename in [filename_h,
+                         filename_c,
+                         fuzzer_filename_c,
+                         fuzzer_filename_mk]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_c),
+            read_file(fuzzer_filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_mk),
+            read_file(fuzzer_filename_mk))
+
+    def test_command_line_generate_c_source_oer_arena(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--namespace', 'oer_arena',
+            '--arena-threshold', '64',
+            '--generate-fuzzer',
+            'tests/files/c_source/arena.asn'
+        ]
+
+        filename_h = 'oer_arena.h'
+        filename_c = 'oer_arena.c'
+        fuzzer_filename_c = 'oer_arena_fuzzer.c'
+        fuzzer_filename_mk = 'oer_arena_fuzzer.mk'
+
+        for filename in [filename_h,
+                         filename_c,
+                         fuzzer_filename_c,
+                         fuzzer_filename_mk]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_c),
+            read_file(fuzzer_filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_mk),
+            read_file(fuzzer_filename_mk))
+
+    def test_command_line_generate_c_source_uper_arena(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--codec', 'uper',
+            '--namespace', 'uper_arena',
+            '--arena-threshold', '64',
+            '--generate-fuzzer',
+            'tests/files/c_source/arena.asn'
+        ]
+
+        filename_h = 'uper_arena.h'
+        filename_c = 'uper_arena.c'
+        fuzzer_filename_c = 'uper_arena_fuzzer.c'
+        fuzzer_filename_mk = 'uper_arena_fuzzer.mk'
+
+        for filename in [filename_h,
+                         filename_c,
+                         fuzzer_filename_c,
+                         fuzzer_filename_mk]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_c),
+            read_file(fuzzer_filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_mk),
+            read_file(fuzzer_filename_mk))
+
     def test_command_line_generate_c_source_oer_minus(self):
         argv = [
             'asn1tools',
@@ -797,6 +912,396 @@ exit
             read_file('tests/files/c_source/' + fuzzer_filename_mk),
             read_file(fuzzer_filename_mk))
 
+    def test_command_line_generate_c_source_ber(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--namespace', 'ber',
+            '--codec', 'ber',
+            '--generate-fuzzer',
+            'tests/files/c_source/c_source.asn'
+        ]
+
+        filename_h = 'ber.h'
+        filename_c = 'ber.c'
+        fuzzer_filename_c = 'ber_fuzzer.c'
+        fuzzer_filename_mk = 'ber_fuzzer.mk'
+
+        for filename in [filename_h,
+                         filename_c,
+                         fuzzer_filename_c,
+                         fuzzer_filename_mk]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_c),
+            read_file(fuzzer_filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_mk),
+            read_file(fuzzer_filename_mk))
+
+    def test_command_line_generate_c_source_per(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--namespace', 'per',
+            '--codec', 'per',
+            '--generate-fuzzer',
+            'tests/files/c_source/c_source.asn'
+        ]
+
+        filename_h = 'per.h'
+        filename_c = 'per.c'
+        fuzzer_filename_c = 'per_fuzzer.c'
+        fuzzer_filename_mk = 'per_fuzzer.mk'
+
+        for filename in [filename_h,
+                         filename_c,
+                         fuzzer_filename_c,
+                         fuzzer_filename_mk]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_c),
+            read_file(fuzzer_filename_c))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + fuzzer_filename_mk),
+            read_file(fuzzer_filename_mk))
+
+    def test_command_line_generate_c_source_uper_jer(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--namespace', 'uper_jer',
+            '--codec', 'uper',
+            '--generate-jer-encoder',
+            'tests/files/c_source/jer.asn'
+        ]
+
+        filename_h = 'uper_jer.h'
+        filename_c = 'uper_jer.c'
+
+        for filename in [filename_h, filename_c]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+
+    def test_command_line_generate_c_source_strings(self):
+        for codec in ['uper', 'per', 'oer']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_strings'.format(codec),
+                '--codec', codec,
+                '--generate-jer-encoder',
+                'tests/files/c_source/strings.asn'
+            ]
+
+            filename_h = codec + '_strings.h'
+            filename_c = codec + '_strings.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_oids(self):
+        for codec in ['oer', 'uper', 'per', 'ber']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_oids'.format(codec),
+                '--codec', codec,
+                '--generate-jer-encoder',
+                'tests/files/c_source/oids.asn'
+            ]
+
+            filename_h = codec + '_oids.h'
+            filename_c = codec + '_oids.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_recursive(self):
+        for codec in ['oer', 'uper', 'per']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_recursive'.format(codec),
+                '--codec', codec,
+                '--arena-threshold', '64',
+                '--generate-jer-encoder',
+                'tests/files/c_source/recursive.asn'
+            ]
+
+            filename_h = codec + '_recursive.h'
+            filename_c = codec + '_recursive.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_open_types(self):
+        datas = [
+            ('uper', 'uper_open_types', ['--open-type-views',
+                                         '--arena-threshold', '64',
+                                         '--generate-jer-encoder']),
+            ('per', 'per_open_types', []),
+            ('uper', 'uper_lazy_open_types', ['--lazy-open-types',
+                                              '--arena-threshold', '64']),
+            ('per', 'per_lazy_open_types', ['--lazy-open-types',
+                                            '--generate-fuzzer'])
+        ]
+
+        for codec, namespace, options in datas:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', namespace,
+                '--codec', codec
+            ]
+            argv += options
+            argv.append('tests/files/c_source/open_types.asn')
+
+            filenames = [namespace + '.h', namespace + '.c']
+
+            if '--generate-fuzzer' in options:
+                filenames += [namespace + '_fuzzer.c', namespace + '_fuzzer.mk']
+
+            for filename in filenames:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            for filename in filenames:
+                self.assertEqual(
+                    read_file('tests/files/c_source/' + filename),
+                    read_file(filename))
+
+    def test_command_line_generate_c_source_bit_strings(self):
+        for codec in ['oer', 'uper', 'per']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_bit_strings'.format(codec),
+                '--codec', codec,
+                '--generate-jer-encoder',
+                'tests/files/c_source/bit_strings.asn'
+            ]
+
+            filename_h = codec + '_bit_strings.h'
+            filename_c = codec + '_bit_strings.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_reals(self):
+        for codec in ['uper', 'per']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_reals'.format(codec),
+                '--codec', codec,
+                '--generate-jer-encoder',
+                'tests/files/c_source/reals.asn'
+            ]
+
+            filename_h = codec + '_reals.h'
+            filename_c = codec + '_reals.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_regions(self):
+        for codec in ['oer', 'uper', 'per']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_regions'.format(codec),
+                '--codec', codec,
+                'tests/files/c_source/regions.asn'
+            ]
+
+            filename_h = codec + '_regions.h'
+            filename_c = codec + '_regions.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_arrays(self):
+        for codec in ['oer', 'uper']:
+            argv = [
+                'asn1tools',
+                'generate_c_source',
+                '--namespace', '{}_arrays'.format(codec),
+                '--codec', codec,
+                'tests/files/c_source/arrays.asn'
+            ]
+
+            filename_h = codec + '_arrays.h'
+            filename_c = codec + '_arrays.c'
+
+            for filename in [filename_h, filename_c]:
+                if os.path.exists(filename):
+                    os.remove(filename)
+
+            with patch('sys.argv', argv):
+                asn1tools._main()
+
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_h),
+                read_file(filename_h))
+            self.assertEqual(
+                read_file('tests/files/c_source/' + filename_c),
+                read_file(filename_c))
+
+    def test_command_line_generate_c_source_segments(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--namespace', 'oer_segments',
+            '--view-threshold', '1024',
+            '--generate-iovec-encoder',
+            'tests/files/c_source/segments.asn'
+        ]
+
+        filename_h = 'oer_segments.h'
+        filename_c = 'oer_segments.c'
+
+        for filename in [filename_h, filename_c]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+
+    def test_command_line_generate_c_source_alignment(self):
+        argv = [
+            'asn1tools',
+            'generate_c_source',
+            '--codec', 'per',
+            '--namespace', 'per_alignment',
+            'tests/files/c_source/alignment.asn'
+        ]
+
+        filename_h = 'per_alignment.h'
+        filename_c = 'per_alignment.c'
+
+        for filename in [filename_h, filename_c]:
+            if os.path.exists(filename):
+                os.remove(filename)
+
+        with patch('sys.argv', argv):
+            asn1tools._main()
+
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_h),
+            read_file(filename_h))
+        self.assertEqual(
+            read_file('tests/files/c_source/' + filename_c),
+            read_file(filename_c))
+
     def test_command_line_generate_c_source(self):
         specs = [
             'boolean',
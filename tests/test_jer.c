@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "uper_jer.h"
+
+static void fill_a(struct uper_jer_jer_a_t *decoded_p)
+{
+    memset(decoded_p, 0, sizeof(*decoded_p));
+    decoded_p->a = -128;
+    decoded_p->b = INT64_MIN;
+    decoded_p->c = UINT64_MAX;
+    decoded_p->d = true;
+    decoded_p->f.length = 2;
+    decoded_p->f.buf[0] = 0x01;
+    decoded_p->f.buf[1] = 0xab;
+    decoded_p->g.buf[0] = 0xff;
+    decoded_p->g.buf[1] = 0x00;
+    decoded_p->h = 0xabc;
+    decoded_p->i = uper_jer_jer_a_i_two_three_e;
+    decoded_p->j.length = 3;
+    decoded_p->j.elements[0] = 0;
+    decoded_p->j.elements[1] = 9;
+    decoded_p->j.elements[2] = 1000;
+    decoded_p->is_k_present = true;
+    decoded_p->k.choice = uper_jer_jer_b_choice_b_c_e;
+    decoded_p->k.value.b_c = false;
+    decoded_p->l.is_a_present = true;
+    decoded_p->l.a = true;
+    decoded_p->m_n = false;
+}
+
+TEST(uper_jer_jer_a)
+{
+    const char expected[] =
+        "{\"a\":-128,\"b\":-9223372036854775808,\"c\":18446744073709551615,"
+        "\"d\":true,\"e\":null,\"f\":\"01AB\",\"g\":\"FF00\",\"h\":\"ABC0\","
+        "\"i\":\"two-three\",\"j\":[0,9,1000],\"k\":{\"b-c\":false},"
+        "\"l\":{\"a\":true},\"m-n\":false}";
+    uint8_t encoded[sizeof(expected) - 1];
+    struct uper_jer_jer_a_t decoded;
+
+    fill_a(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_jer_jer_a_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], &expected[0], sizeof(encoded));
+}
+
+TEST(uper_jer_jer_a_encode_error_no_mem)
+{
+    uint8_t encoded[186];
+    struct uper_jer_jer_a_t decoded;
+
+    fill_a(&decoded);
+
+    ASSERT_EQ(uper_jer_jer_a_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), -ENOMEM);
+}
+
+TEST(uper_jer_jer_c_empty)
+{
+    uint8_t encoded[2];
+    struct uper_jer_jer_c_t decoded;
+
+    memset(&decoded, 0, sizeof(decoded));
+
+    ASSERT_EQ(uper_jer_jer_c_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "{}", sizeof(encoded));
+}
+
+TEST(uper_jer_jer_d)
+{
+    uint8_t encoded[20];
+    struct uper_jer_jer_d_t decoded;
+
+    decoded.elements[0].choice = uper_jer_jer_b_choice_d_e;
+    decoded.elements[1].choice = uper_jer_jer_b_choice_a_e;
+    decoded.elements[1].value.a = 5;
+
+    ASSERT_EQ(uper_jer_jer_d_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "[{\"d\":null},{\"a\":5}]", sizeof(encoded));
+}
+
+TEST(uper_jer_jer_d_encode_error_bad_choice)
+{
+    uint8_t encoded[20];
+    struct uper_jer_jer_d_t decoded;
+
+    decoded.elements[0].choice = uper_jer_jer_b_choice_d_e;
+    decoded.elements[1].choice = 10;
+
+    ASSERT_EQ(uper_jer_jer_d_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), -EBADCHOICE);
+}
+
+TEST(uper_jer_jer_e)
+{
+    uint8_t encoded[2];
+    struct uper_jer_jer_e_t decoded;
+
+    decoded.value = -5;
+
+    ASSERT_EQ(uper_jer_jer_e_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "-5", sizeof(encoded));
+}
+
+TEST(uper_jer_jer_f)
+{
+    uint8_t encoded[18];
+    struct uper_jer_jer_f_t decoded;
+
+    decoded.value = 0x0123456789abcdefull;
+
+    ASSERT_EQ(uper_jer_jer_f_encode_jer(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\"0123456789ABCDEF\"", sizeof(encoded));
+}
+
+TEST(uper_jer_jer_uper_decode_and_jer_encode)
+{
+    uint8_t encoded[64];
+    uint8_t json[sizeof(encoded)];
+    struct uper_jer_jer_d_t decoded;
+    ssize_t size;
+
+    decoded.elements[0].choice = uper_jer_jer_b_choice_a_e;
+    decoded.elements[0].value.a = 3;
+    decoded.elements[1].choice = uper_jer_jer_b_choice_b_c_e;
+    decoded.elements[1].value.b_c = true;
+
+    ASSERT_EQ(uper_jer_jer_d_encode(&encoded[0], sizeof(encoded), &decoded), 1);
+    ASSERT_MEMORY_EQ(&encoded[0], "\x1b", 1);
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_jer_jer_d_decode(&decoded, &encoded[0], 1), 1);
+
+    size = uper_jer_jer_d_encode_jer(&json[0], sizeof(json), &decoded);
+    ASSERT_EQ(size, 22);
+    ASSERT_MEMORY_EQ(&json[0], "[{\"a\":3},{\"b-c\":true}]", 22);
+}
@@ -6,6 +6,8 @@
 
 #include "files/c_source/oer.h"
 #include "files/c_source/c_source-minus.h"
+#include "files/c_source/oer_views.h"
+#include "files/c_source/oer_arena.h"
 
 #define membersof(a) (sizeof(a) / (sizeof((a)[0])))
 
@@ -41,6 +43,8 @@ TEST(oer_c_source_a)
                      "\x00\x00\x00\x04\xff\x05\x05\x05\x05\x05\x05\x05\x05"
                      "\x05\x05\x05",
                      sizeof(encoded));
+    ASSERT_EQ(oer_c_source_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(oer_c_source_a_encode(NULL, 0, &decoded), -ENOMEM);
 
     /* Decode. */
     memset(&decoded, 0, sizeof(decoded));
@@ -212,6 +216,104 @@ TEST(oer_c_source_b_decode_error_bad_choice)
                                     sizeof(encoded)), -EBADCHOICE);
 }
 
+TEST(oer_c_source_b_encoded_size_error_bad_choice)
+{
+    struct oer_c_source_b_t decoded;
+
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.choice = 10;
+
+    ASSERT_EQ(oer_c_source_b_encoded_size(&decoded), -EBADCHOICE);
+}
+
+TEST(oer_c_source_b_skip_error_bad_choice)
+{
+    /* 0x80 (a), 0x81 (b) and 0x82 (c) are valid tags in the encoded
+       data. */
+    uint8_t encoded[2] = "\x83\x00";
+
+    ASSERT_EQ(oer_c_source_b_skip(&encoded[0], sizeof(encoded)), -EBADCHOICE);
+}
+
+TEST(oer_c_source_b_batch)
+{
+    uint8_t encoded[5];
+    struct oer_c_source_b_t decoded[3];
+    size_t offsets[3];
+
+    /* Encode. */
+    decoded[0].choice = oer_c_source_b_choice_a_e;
+    decoded[0].value.a = -1;
+    decoded[1].choice = oer_c_source_b_choice_c_e;
+    decoded[2].choice = oer_c_source_b_choice_a_e;
+    decoded[2].value.a = 5;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_c_source_b_encode_batch(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded[0],
+                                          3,
+                                          &offsets[0]), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x80\xff\x82\x80\x05", sizeof(encoded));
+    ASSERT_EQ(offsets[0], 0);
+    ASSERT_EQ(offsets[1], 2);
+    ASSERT_EQ(offsets[2], 3);
+
+    /* Decode. */
+    memset(&decoded[0], 0, sizeof(decoded));
+    memset(&offsets[0], 0, sizeof(offsets));
+    ASSERT_EQ(oer_c_source_b_decode_batch(&decoded[0],
+                                          3,
+                                          &encoded[0],
+                                          sizeof(encoded),
+                                          &offsets[0]), sizeof(encoded));
+
+    ASSERT_EQ(decoded[0].choice, oer_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded[0].value.a, -1);
+    ASSERT_EQ(decoded[1].choice, oer_c_source_b_choice_c_e);
+    ASSERT_EQ(decoded[2].choice, oer_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded[2].value.a, 5);
+    ASSERT_EQ(offsets[0], 0);
+    ASSERT_EQ(offsets[1], 2);
+    ASSERT_EQ(offsets[2], 3);
+}
+
+TEST(oer_c_source_b_batch_error_out_of_data)
+{
+    uint8_t encoded[4];
+    struct oer_c_source_b_t decoded[3];
+    size_t offsets[3];
+
+    decoded[0].choice = oer_c_source_b_choice_a_e;
+    decoded[0].value.a = -1;
+    decoded[1].choice = oer_c_source_b_choice_c_e;
+    decoded[2].choice = oer_c_source_b_choice_a_e;
+    decoded[2].value.a = 5;
+
+    /* The last value does not fit. */
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_c_source_b_encode_batch(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded[0],
+                                          3,
+                                          &offsets[0]), -ENOMEM);
+
+    /* No buffer at all. */
+    ASSERT_EQ(oer_c_source_b_encode_batch(NULL,
+                                          0,
+                                          &decoded[0],
+                                          3,
+                                          &offsets[0]), -ENOMEM);
+
+    /* The encoded data ends in the middle of the last value. */
+    memcpy(&encoded[0], "\x80\xff\x82\x80", sizeof(encoded));
+    ASSERT_EQ(oer_c_source_b_decode_batch(&decoded[0],
+                                          3,
+                                          &encoded[0],
+                                          sizeof(encoded),
+                                          &offsets[0]), -EOUTOFDATA);
+}
+
 TEST(oer_c_source_c_empty)
 {
     uint8_t encoded[2];
@@ -701,6 +803,36 @@ TEST(oer_c_source_l)
     }
 }
 
+TEST(oer_c_source_l_maximum_and_encoded_size)
+{
+    struct data_t {
+        uint16_t data_length;
+        ssize_t encoded_length;
+    } datas[] = {
+        { .data_length = 0, .encoded_length = 1 },
+        { .data_length = 127, .encoded_length = 128 },
+        { .data_length = 128, .encoded_length = 130 },
+        { .data_length = 260, .encoded_length = 263 },
+        { .data_length = 500, .encoded_length = 503 }
+    };
+    uint8_t encoded[OER_C_SOURCE_L_MAX_ENCODED_SIZE];
+    struct oer_c_source_l_t decoded;
+    unsigned int i;
+
+    ASSERT_EQ(OER_C_SOURCE_L_MAX_ENCODED_SIZE, 503);
+
+    for (i = 0; i < membersof(datas); i++) {
+        decoded.length = datas[i].data_length;
+        memset(&decoded.buf[0], 0xa5, decoded.length);
+
+        ASSERT_EQ(oer_c_source_l_encoded_size(&decoded),
+                  datas[i].encoded_length);
+        ASSERT_EQ(oer_c_source_l_encode(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), datas[i].encoded_length);
+    }
+}
+
 TEST(oer_c_source_l_decode_error_bad_length)
 {
     struct data_t {
@@ -745,6 +877,91 @@ TEST(oer_c_source_l_decode_error_bad_length)
     }
 }
 
+TEST(oer_c_source_n_fields)
+{
+    uint8_t encoded[48];
+    struct oer_c_source_n_t decoded;
+
+    /* Encode. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.a.value = oer_c_source_k_a_e;
+    decoded.b.a = -1;
+    decoded.b.h = 4;
+    decoded.b.i = true;
+    memset(&decoded.b.j.buf[0], 5, sizeof(decoded.b.j.buf));
+    decoded.c.length = 3;
+    decoded.c.elements[0] = true;
+    decoded.c.elements[1] = false;
+    decoded.c.elements[2] = true;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_c_source_n_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+
+    /* Decode only b, skipping over a and c. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.c.length = 100;
+    ASSERT_EQ(oer_c_source_n_decode_fields(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded),
+                                           OER_C_SOURCE_N_FIELD_B), sizeof(encoded));
+
+    ASSERT_EQ(decoded.b.a, -1);
+    ASSERT_EQ(decoded.b.h, 4);
+    ASSERT_TRUE(decoded.b.i);
+    ASSERT_MEMORY_EQ(&decoded.b.j.buf[0],
+                     "\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05",
+                     sizeof(decoded.b.j.buf));
+    ASSERT_EQ(decoded.c.length, 100);
+
+    /* Decode only c, skipping over a and b. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_c_source_n_decode_fields(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded),
+                                           OER_C_SOURCE_N_FIELD_C), sizeof(encoded));
+
+    ASSERT_EQ(decoded.b.h, 0);
+    ASSERT_EQ(decoded.c.length, 3);
+    ASSERT_TRUE(decoded.c.elements[0]);
+    ASSERT_FALSE(decoded.c.elements[1]);
+    ASSERT_TRUE(decoded.c.elements[2]);
+
+    /* Skipped data must also be present. */
+    ASSERT_EQ(oer_c_source_n_decode_fields(&decoded,
+                                           &encoded[0],
+                                           47,
+                                           OER_C_SOURCE_N_FIELD_A), -EOUTOFDATA);
+}
+
+TEST(oer_c_source_n_skip_records)
+{
+    uint8_t encoded[94];
+    struct oer_c_source_n_t decoded[2];
+    size_t offsets[2];
+
+    /* Encode two records after each other. */
+    memset(&decoded[0], 0, sizeof(decoded));
+    decoded[0].c.length = 3;
+    decoded[1].c.length = 1;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_c_source_n_encode_batch(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded[0],
+                                          2,
+                                          &offsets[0]), sizeof(encoded));
+    ASSERT_EQ(offsets[1], 48);
+
+    /* Find the end of each record without decoding it. */
+    ASSERT_EQ(oer_c_source_n_skip(&encoded[0], sizeof(encoded)), 48);
+    ASSERT_EQ(oer_c_source_n_skip(&encoded[48], sizeof(encoded) - 48),
+              sizeof(encoded) - 48);
+    ASSERT_EQ(oer_c_source_n_skip(&encoded[48], sizeof(encoded) - 48 - 1),
+              -EOUTOFDATA);
+}
+
 TEST(oer_c_source_o)
 {
     int i;
@@ -1462,3 +1679,239 @@ TEST(oer_programming_types_double)
 
     ASSERT_TRUE(fequal(decoded.value, 1.0));
 }
+
+TEST(oer_views_a)
+{
+    uint8_t encoded[259];
+    uint8_t data[256];
+    struct oer_views_views_a_t decoded;
+
+    /* Encode. */
+    memset(&data[0], 0xa5, sizeof(data));
+    decoded.buf = &data[0];
+    decoded.length = sizeof(data);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_views_views_a_encode(&encoded[0],
+                                       sizeof(encoded),
+                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x82\x01\x00", 3);
+    ASSERT_MEMORY_EQ(&encoded[3], &data[0], sizeof(data));
+
+    /* Decode. The view points into the encoded data. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_views_views_a_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, sizeof(data));
+    ASSERT_EQ(decoded.buf, &encoded[3]);
+}
+
+TEST(oer_views_a_decode_error_out_of_data)
+{
+    uint8_t encoded[4] = "\x82\x01\x00\xa5";
+    struct oer_views_views_a_t decoded;
+
+    ASSERT_EQ(oer_views_views_a_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded)), -EOUTOFDATA);
+}
+
+TEST(oer_views_b)
+{
+    uint8_t encoded[8];
+    struct oer_views_views_b_t decoded;
+
+    /* Encode. b absent and c equal to its default value. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.a.length = 1;
+    decoded.a.buf[0] = 0x11;
+    decoded.is_b_present = false;
+    decoded.c.buf = (const uint8_t *)"\x01\x02";
+    decoded.c.length = 2;
+    decoded.d = 5;
+
+    ASSERT_EQ(oer_views_views_b_encode(&encoded[0],
+                                       sizeof(encoded),
+                                       &decoded), 4);
+    ASSERT_MEMORY_EQ(&encoded[0], "\x00\x01\x11\x05", 4);
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_views_views_b_decode(&decoded,
+                                       &encoded[0],
+                                       4), 4);
+
+    ASSERT_FALSE(decoded.is_b_present);
+    ASSERT_EQ(decoded.c.length, 2);
+    ASSERT_MEMORY_EQ(decoded.c.buf, "\x01\x02", 2);
+    ASSERT_EQ(decoded.d, 5);
+
+    /* Encode. b present and c not equal to its default value. */
+    decoded.is_b_present = true;
+    decoded.b.buf = (const uint8_t *)"\x22";
+    decoded.b.length = 1;
+    decoded.c.buf = (const uint8_t *)"\x01";
+    decoded.c.length = 1;
+
+    ASSERT_EQ(oer_views_views_b_encode(&encoded[0],
+                                       sizeof(encoded),
+                                       &decoded), 8);
+    ASSERT_MEMORY_EQ(&encoded[0], "\xc0\x01\x11\x01\x22\x01\x01\x05", 8);
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_views_views_b_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded)), 8);
+
+    ASSERT_TRUE(decoded.is_b_present);
+    ASSERT_EQ(decoded.b.length, 1);
+    ASSERT_EQ(decoded.b.buf, &encoded[4]);
+    ASSERT_EQ(decoded.c.length, 1);
+    ASSERT_EQ(decoded.c.buf, &encoded[6]);
+    ASSERT_EQ(decoded.d, 5);
+}
+
+TEST(oer_views_b_decode_error_bad_length)
+{
+    uint8_t encoded[6] = "\x80\x00\x82\x03\xe9\x00";
+    struct oer_views_views_b_t decoded;
+
+    ASSERT_EQ(oer_views_views_b_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded)), -EBADLENGTH);
+}
+
+TEST(oer_arena_a)
+{
+    uint8_t encoded[8] = "\x01\x03\x00\x01\x00\x02\x00\x03";
+    uint8_t encoded2[8];
+    uint8_t arena_buf[64];
+    struct oer_arena_arena_t arena;
+    struct oer_arena_arena_a_t decoded;
+
+    arena.buf = &arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    /* Decode. The elements are allocated from the arena. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_arena_arena_a_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded),
+                                       &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ((uint8_t *)decoded.elements, &arena_buf[0]);
+    ASSERT_EQ(decoded.elements[0], 1);
+    ASSERT_EQ(decoded.elements[1], 2);
+    ASSERT_EQ(decoded.elements[2], 3);
+    ASSERT_EQ(arena.pos, 3 * sizeof(decoded.elements[0]));
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(oer_arena_arena_a_encode(&encoded2[0],
+                                       sizeof(encoded2),
+                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode again after resetting the arena. */
+    arena.pos = 0;
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_arena_arena_a_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded),
+                                       &arena), sizeof(encoded));
+
+    ASSERT_EQ((uint8_t *)decoded.elements, &arena_buf[0]);
+}
+
+TEST(oer_arena_a_decode_error_out_of_memory)
+{
+    uint8_t encoded[8] = "\x01\x03\x00\x01\x00\x02\x00\x03";
+    uint8_t arena_buf[4];
+    struct oer_arena_arena_t arena;
+    struct oer_arena_arena_a_t decoded;
+
+    arena.buf = &arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    ASSERT_EQ(oer_arena_arena_a_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded),
+                                       &arena), -ENOMEM);
+}
+
+TEST(oer_arena_b)
+{
+    uint8_t encoded[8] = "\xc0\x01\x11\x01\x22\x01\x01\x05";
+    uint8_t encoded2[8];
+    uint64_t arena_buf[2];
+    struct oer_arena_arena_t arena;
+    struct oer_arena_arena_b_t decoded;
+
+    arena.buf = (uint8_t *)&arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    /* Decode. b and c are allocated from the arena, 8 bytes aligned. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_arena_arena_b_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded),
+                                       &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.a.length, 1);
+    ASSERT_EQ(decoded.a.buf[0], 0x11);
+    ASSERT_TRUE(decoded.is_b_present);
+    ASSERT_EQ(decoded.b.length, 1);
+    ASSERT_EQ(decoded.b.buf, arena.buf);
+    ASSERT_EQ(decoded.b.buf[0], 0x22);
+    ASSERT_EQ(decoded.c.length, 1);
+    ASSERT_EQ(decoded.c.buf, &arena.buf[8]);
+    ASSERT_EQ(decoded.c.buf[0], 0x01);
+    ASSERT_EQ(decoded.d, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(oer_arena_arena_b_encode(&encoded2[0],
+                                       sizeof(encoded2),
+                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(oer_arena_d)
+{
+    uint8_t encoded[6] = "\x01\x01\xff\x02\x11\x22";
+    uint8_t encoded2[6];
+    uint64_t arena_buf[8];
+    struct oer_arena_arena_t arena;
+    struct oer_arena_arena_d_t decoded;
+
+    arena.buf = (uint8_t *)&arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    /* Decode. The OCTET STRING follows the elements in the arena. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_arena_arena_d_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded),
+                                       &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, 1);
+    ASSERT_TRUE(decoded.elements[0].a);
+    ASSERT_EQ(decoded.elements[0].b.length, 2);
+    ASSERT_EQ(decoded.elements[0].b.buf, (const uint8_t *)&decoded.elements[1]);
+    ASSERT_MEMORY_EQ(decoded.elements[0].b.buf, "\x11\x22", 2);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(oer_arena_arena_d_encode(&encoded2[0],
+                                       sizeof(encoded2),
+                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
@@ -0,0 +1,425 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "oer_oids.h"
+#include "uper_oids.h"
+#include "per_oids.h"
+#include "ber_oids.h"
+
+#define FILL_B(decoded_p)                                       \
+    do {                                                        \
+        memset((decoded_p), 0, sizeof(*(decoded_p)));           \
+        (decoded_p)->a.length = 7;                              \
+        (decoded_p)->a.arcs[0] = 1;                             \
+        (decoded_p)->a.arcs[1] = 2;                             \
+        (decoded_p)->a.arcs[2] = 840;                           \
+        (decoded_p)->a.arcs[3] = 113549;                        \
+        (decoded_p)->a.arcs[4] = 1;                             \
+        (decoded_p)->a.arcs[5] = 1;                             \
+        (decoded_p)->a.arcs[6] = 11;                            \
+        (decoded_p)->is_b_present = true;                       \
+        (decoded_p)->b.length = 6;                              \
+        (decoded_p)->b.arcs[0] = 0;                             \
+        (decoded_p)->b.arcs[1] = 4;                             \
+        (decoded_p)->b.arcs[2] = 0;                             \
+        (decoded_p)->b.arcs[3] = 127;                           \
+        (decoded_p)->b.arcs[4] = 0;                             \
+        (decoded_p)->b.arcs[5] = 7;                             \
+        (decoded_p)->c = true;                                  \
+    } while (0)
+
+#define ASSERT_B(decoded_p)                                     \
+    do {                                                        \
+        ASSERT_EQ((decoded_p)->a.length, 7);                    \
+        ASSERT_EQ((decoded_p)->a.arcs[3], 113549);              \
+        ASSERT_EQ((decoded_p)->a.arcs[6], 11);                  \
+        ASSERT_TRUE((decoded_p)->is_b_present);                 \
+        ASSERT_EQ((decoded_p)->b.length, 6);                    \
+        ASSERT_EQ((decoded_p)->b.arcs[0], 0);                   \
+        ASSERT_EQ((decoded_p)->b.arcs[1], 4);                   \
+        ASSERT_EQ((decoded_p)->b.arcs[3], 127);                 \
+        ASSERT_EQ((decoded_p)->b.arcs[5], 7);                   \
+        ASSERT_TRUE((decoded_p)->c);                            \
+    } while (0)
+
+TEST(oer_oids_a_named_value)
+{
+    uint8_t encoded[10];
+    struct oer_oids_oids_a_t decoded;
+
+    /* Encode. */
+    decoded.value = oer_oids_oids_id_rsa_encryption_oid;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x09\x2a\x86\x48\x86\xf7\x0d\x01\x01\x01",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_oids_oids_a_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.value.length, 7);
+    ASSERT_MEMORY_EQ(&decoded.value.arcs[0],
+                     &oer_oids_oids_id_rsa_encryption_oid.arcs[0],
+                     7 * sizeof(uint32_t));
+}
+
+TEST(oer_oids_a_large_arcs)
+{
+    uint8_t encoded[14];
+    struct oer_oids_oids_a_t decoded;
+
+    /* Encode. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.value.length = 8;
+    decoded.value.arcs[0] = 1;
+    decoded.value.arcs[1] = 3;
+    decoded.value.arcs[2] = 6;
+    decoded.value.arcs[3] = 1;
+    decoded.value.arcs[4] = 4;
+    decoded.value.arcs[5] = 1;
+    decoded.value.arcs[6] = 99999;
+    decoded.value.arcs[7] = 4294967295;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x0d\x2b\x06\x01\x04\x01\x86\x8d\x1f\x8f\xff\xff\xff\x7f",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_oids_oids_a_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.value.length, 8);
+    ASSERT_EQ(decoded.value.arcs[6], 99999);
+    ASSERT_EQ(decoded.value.arcs[7], 4294967295);
+}
+
+TEST(oer_oids_a_first_arc_two)
+{
+    uint8_t encoded[5];
+    struct oer_oids_oids_a_t decoded;
+
+    /* Encode. The second arc is not limited to 39 under arc 2. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.value.length = 3;
+    decoded.value.arcs[0] = 2;
+    decoded.value.arcs[1] = 100000;
+    decoded.value.arcs[2] = 5;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x04\x86\x8d\x70\x05", sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_oids_oids_a_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.value.length, 3);
+    ASSERT_EQ(decoded.value.arcs[0], 2);
+    ASSERT_EQ(decoded.value.arcs[1], 100000);
+    ASSERT_EQ(decoded.value.arcs[2], 5);
+}
+
+TEST(oer_oids_a_encode_error)
+{
+    uint8_t encoded[76];
+    struct oer_oids_oids_a_t decoded;
+
+    /* Too few arcs. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.value.length = 1;
+
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), -EBADLENGTH);
+
+    /* Too many arcs. */
+    decoded.value.length = 17;
+
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), -EBADLENGTH);
+
+    /* Bad first arc. */
+    decoded.value.length = 2;
+    decoded.value.arcs[0] = 3;
+
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), -EBADOID);
+
+    /* Bad second arc. */
+    decoded.value.arcs[0] = 1;
+    decoded.value.arcs[1] = 40;
+
+    ASSERT_EQ(oer_oids_oids_a_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), -EBADOID);
+}
+
+TEST(oer_oids_a_decode_error)
+{
+    struct oer_oids_oids_a_t decoded;
+
+    /* No subidentifiers. */
+    ASSERT_EQ(oer_oids_oids_a_decode(&decoded,
+                                     (uint8_t *)"\x00",
+                                     1), -EBADLENGTH);
+
+    /* Last subidentifier not terminated. */
+    ASSERT_EQ(oer_oids_oids_a_decode(&decoded,
+                                     (uint8_t *)"\x02\x2a\x86",
+                                     3), -EBADOID);
+
+    /* Arc does not fit in 32 bits. */
+    ASSERT_EQ(oer_oids_oids_a_decode(&decoded,
+                                     (uint8_t *)"\x07\x2a\x90\x80\x80\x80\x80\x00",
+                                     8), -EBADOID);
+
+    /* More than 16 arcs. */
+    ASSERT_EQ(oer_oids_oids_a_decode(
+                  &decoded,
+                  (uint8_t *)"\x10\x2a\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a"
+                  "\x0b\x0c\x0d\x0e\x0f",
+                  17), -EBADLENGTH);
+}
+
+TEST(oer_oids_b)
+{
+    uint8_t encoded[18];
+    struct oer_oids_oids_b_t decoded;
+
+    /* Encode. */
+    FILL_B(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_oids_oids_b_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x80\x09\x2a\x86\x48\x86\xf7\x0d\x01\x01\x0b\x05\x04\x00"
+                     "\x7f\x00\x07\xff",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_oids_oids_b_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(&decoded);
+}
+
+TEST(oer_oids_c)
+{
+    uint8_t encoded[15];
+    struct oer_oids_oids_c_t decoded;
+
+    /* Encode. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.length = 3;
+    decoded.elements[0].value = oer_oids_oids_id_rsadsi_oid;
+    decoded.elements[1].value = oer_oids_oids_id_example_oid;
+    decoded.elements[2].value.length = 2;
+    decoded.elements[2].value.arcs[0] = 0;
+    decoded.elements[2].value.arcs[1] = 39;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_oids_oids_c_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x01\x03\x06\x2a\x86\x48\x86\xf7\x0d\x03\x88\x37\x01\x01"
+                     "\x27",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_oids_oids_c_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ(decoded.elements[0].value.length, 4);
+    ASSERT_EQ(decoded.elements[0].value.arcs[3], 113549);
+    ASSERT_EQ(decoded.elements[1].value.length, 3);
+    ASSERT_EQ(decoded.elements[1].value.arcs[0], 2);
+    ASSERT_EQ(decoded.elements[1].value.arcs[1], 999);
+    ASSERT_EQ(decoded.elements[2].value.length, 2);
+    ASSERT_EQ(decoded.elements[2].value.arcs[1], 39);
+}
+
+TEST(oer_oids_e_addition)
+{
+    uint8_t encoded[10];
+    struct oer_oids_oids_e_t decoded;
+
+    /* Encode. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.is_b_addition_present = true;
+    decoded.b.length = 4;
+    decoded.b.arcs[0] = 1;
+    decoded.b.arcs[1] = 3;
+    decoded.b.arcs[2] = 6;
+    decoded.b.arcs[3] = 1;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_oids_oids_e_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x80\x00\x02\x07\x80\x04\x03\x2b\x06\x01",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_oids_oids_e_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_TRUE(decoded.is_b_addition_present);
+    ASSERT_EQ(decoded.b.length, 4);
+    ASSERT_EQ(decoded.b.arcs[2], 6);
+}
+
+TEST(oer_oids_b_encode_jer)
+{
+    uint8_t encoded[58];
+    struct oer_oids_oids_b_t decoded;
+
+    FILL_B(&decoded);
+
+    ASSERT_EQ(oer_oids_oids_b_encode_jer(&encoded[0],
+                                         sizeof(encoded),
+                                         &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "{\"a\":\"1.2.840.113549.1.1.11\",\"b\":\"0.4.0.127.0.7\","
+                     "\"c\":true}",
+                     sizeof(encoded));
+}
+
+TEST(uper_oids_b)
+{
+    uint8_t encoded[17];
+    struct uper_oids_oids_b_t decoded;
+
+    /* Encode. */
+    FILL_B(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_oids_oids_b_encode(&encoded[0],
+                                      sizeof(encoded),
+                                      &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x84\x95\x43\x24\x43\x7b\x86\x80\x80\x85\x82\x82\x00\x3f"
+                     "\x80\x03\xc0",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_oids_oids_b_decode(&decoded,
+                                      &encoded[0],
+                                      sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(&decoded);
+}
+
+TEST(uper_oids_d)
+{
+    uint8_t encoded[10];
+    struct uper_oids_oids_d_t decoded;
+
+    /* Encode. */
+    decoded.choice = uper_oids_oids_d_choice_a_e;
+    decoded.value.a = uper_oids_oids_id_pkcs_1_oid;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_oids_oids_d_encode(&encoded[0],
+                                      sizeof(encoded),
+                                      &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x04\x15\x43\x24\x43\x7b\x86\x80\x80\x80",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_oids_oids_d_decode(&decoded,
+                                      &encoded[0],
+                                      sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.choice, uper_oids_oids_d_choice_a_e);
+    ASSERT_EQ(decoded.value.a.length, 6);
+    ASSERT_MEMORY_EQ(&decoded.value.a.arcs[0],
+                     &uper_oids_oids_id_pkcs_1_oid.arcs[0],
+                     6 * sizeof(uint32_t));
+}
+
+TEST(per_oids_b)
+{
+    uint8_t encoded[18];
+    struct per_oids_oids_b_t decoded;
+
+    /* Encode. */
+    FILL_B(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_oids_oids_b_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x80\x09\x2a\x86\x48\x86\xf7\x0d\x01\x01\x0b\x05\x04\x00"
+                     "\x7f\x00\x07\x80",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_oids_oids_b_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(&decoded);
+}
+
+TEST(ber_oids_b)
+{
+    uint8_t encoded[23];
+    struct ber_oids_oids_b_t decoded;
+
+    /* Encode. */
+    FILL_B(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(ber_oids_oids_b_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x30\x15\x80\x09\x2a\x86\x48\x86\xf7\x0d\x01\x01\x0b\x81"
+                     "\x05\x04\x00\x7f\x00\x07\x82\x01\xff",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(ber_oids_oids_b_decode(&decoded,
+                                     &encoded[0],
+                                     sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(&decoded);
+}
+
+TEST(ber_oids_a_decode_error_bad_oid)
+{
+    struct ber_oids_oids_a_t decoded;
+
+    /* Last subidentifier not terminated. */
+    ASSERT_EQ(ber_oids_oids_a_decode(&decoded,
+                                     (uint8_t *)"\x06\x02\x2a\x86",
+                                     4), -EBADOID);
+}
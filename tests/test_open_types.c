@@ -0,0 +1,522 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "uper_open_types.h"
+#include "per_open_types.h"
+#include "uper_lazy_open_types.h"
+#include "per_lazy_open_types.h"
+
+#define ARENA_INIT(arena_p, arena_buf)          \
+    do {                                        \
+        (arena_p)->buf = &(arena_buf)[0];       \
+        (arena_p)->size = sizeof(arena_buf);    \
+        (arena_p)->pos = 0;                     \
+    } while (0)
+
+TEST(uper_open_types_field)
+{
+    uint8_t encoded[6] = "\x00\x01\x03\x90\x91\xa0";
+    uint8_t encoded2[6];
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_field_t decoded;
+
+    /* Encode. The value type is selected by the id. */
+    decoded.id = 1;
+    decoded.value.b.a = true;
+    decoded.value.b.b.length = 2;
+    decoded.value.b.b.buf[0] = 0x12;
+    decoded.value.b.b.buf[1] = 0x34;
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_open_types_open_types_field_encode(&encoded2[0],
+                                                      sizeof(encoded2),
+                                                      &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+    ASSERT_EQ(uper_open_types_open_types_field_encoded_size(&decoded),
+              sizeof(encoded));
+
+    /* Decode. */
+    ARENA_INIT(&arena, arena_buf);
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_open_types_open_types_field_decode(&decoded,
+                                                      &encoded[0],
+                                                      sizeof(encoded),
+                                                      &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_TRUE(decoded.value.b.a);
+    ASSERT_EQ(decoded.value.b.b.length, 2);
+    ASSERT_EQ(decoded.value.b.b.buf[0], 0x12);
+    ASSERT_EQ(decoded.value.b.b.buf[1], 0x34);
+
+    ASSERT_EQ(uper_open_types_open_types_field_skip(&encoded[0],
+                                                    sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(uper_open_types_field_same_type)
+{
+    uint8_t encoded[4] = "\x00\x02\x01\x05";
+    uint8_t encoded2[4];
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_field_t decoded;
+
+    /* Ids 0 and 2 both select A. */
+    decoded.id = 2;
+    decoded.value.a.value = 5;
+
+    ASSERT_EQ(uper_open_types_open_types_field_encode(&encoded2[0],
+                                                      sizeof(encoded2),
+                                                      &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ARENA_INIT(&arena, arena_buf);
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_open_types_open_types_field_decode(&decoded,
+                                                      &encoded[0],
+                                                      sizeof(encoded),
+                                                      &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 2);
+    ASSERT_EQ(decoded.value.a.value, 5);
+}
+
+TEST(uper_open_types_field_long_value)
+{
+    uint8_t encoded[155];
+    uint8_t encoded2[155];
+    uint8_t buf[150];
+    uint8_t arena_buf[256];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_field_t decoded;
+    size_t i;
+
+    /* Values of 128 bytes or more have a two bytes length. */
+    for (i = 0; i < sizeof(buf); i++) {
+        buf[i] = (uint8_t)i;
+    }
+
+    memcpy(&encoded[0], "\x01\x2c\x80\x97\x96", 5);
+    memcpy(&encoded[5], &buf[0], sizeof(buf));
+
+    decoded.id = 300;
+    decoded.value.c.buf = &buf[0];
+    decoded.value.c.length = sizeof(buf);
+
+    ASSERT_EQ(uper_open_types_open_types_field_encode(&encoded2[0],
+                                                      sizeof(encoded2),
+                                                      &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ARENA_INIT(&arena, arena_buf);
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_open_types_open_types_field_decode(&decoded,
+                                                      &encoded[0],
+                                                      sizeof(encoded),
+                                                      &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 300);
+    ASSERT_EQ(decoded.value.c.length, sizeof(buf));
+    ASSERT_MEMORY_EQ(decoded.value.c.buf, &buf[0], sizeof(buf));
+}
+
+TEST(uper_open_types_field_unknown)
+{
+    uint8_t encoded[5] = "\x00\x07\x02\xab\xcd";
+    uint8_t encoded2[5];
+    uint8_t encoded3[32];
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_field_t decoded;
+
+    /* Decode. The aligned value of an unknown id is a view of the
+       encoding. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_open_types_open_types_field_decode(&decoded,
+                                                      &encoded[0],
+                                                      sizeof(encoded),
+                                                      &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 7);
+    ASSERT_EQ(decoded.value.unknown.buf, &encoded[3]);
+    ASSERT_EQ(decoded.value.unknown.size, 2);
+    ASSERT_EQ(arena.pos, 0);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_open_types_open_types_field_encode(&encoded2[0],
+                                                      sizeof(encoded2),
+                                                      &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Unknown ids can not be encoded as JSON. */
+    ASSERT_EQ(uper_open_types_open_types_field_encode_jer(&encoded3[0],
+                                                          sizeof(encoded3),
+                                                          &decoded),
+              -EBADCHOICE);
+}
+
+TEST(uper_open_types_field_decode_error_bad_length)
+{
+    uint8_t encoded[4] = "\x00\x00\x00\x05";
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_field_t decoded;
+
+    /* The value is longer than its length. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_open_types_open_types_field_decode(&decoded,
+                                                      &encoded[0],
+                                                      sizeof(encoded),
+                                                      &arena), -EBADLENGTH);
+
+    /* Empty values are never encoded, not even as views. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_open_types_open_types_field_decode(
+                  &decoded,
+                  (const uint8_t *)"\x00\x52\x00",
+                  3,
+                  &arena), -EBADLENGTH);
+}
+
+TEST(uper_open_types_field_decode_fields)
+{
+    uint8_t encoded[6] = "\x00\x01\x03\x90\x91\xa0";
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_field_t decoded;
+
+    /* The value is decoded using the id, even if only the value is
+       wanted. */
+    ARENA_INIT(&arena, arena_buf);
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_open_types_open_types_field_decode_fields(
+                  &decoded,
+                  &encoded[0],
+                  sizeof(encoded),
+                  UPER_OPEN_TYPES_OPEN_TYPES_FIELD_FIELD_VALUE,
+                  &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_TRUE(decoded.value.b.a);
+    ASSERT_EQ(decoded.value.b.b.length, 2);
+
+    /* Only the id. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_open_types_open_types_field_decode_fields(
+                  &decoded,
+                  &encoded[0],
+                  sizeof(encoded),
+                  UPER_OPEN_TYPES_OPEN_TYPES_FIELD_FIELD_ID,
+                  &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_FALSE(decoded.value.b.a);
+}
+
+TEST(uper_open_types_message)
+{
+    uint8_t encoded[7] = "\xc0\x00\x40\xe4\x24\x68\x28";
+    uint8_t encoded2[7];
+    uint8_t encoded3[53];
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_message_t decoded;
+
+    /* Decode. The value is not byte aligned. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_open_types_open_types_message_decode(&decoded,
+                                                        &encoded[0],
+                                                        sizeof(encoded),
+                                                        &arena), sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_TRUE(decoded.is_value_present);
+    ASSERT_TRUE(decoded.value.b.a);
+    ASSERT_EQ(decoded.value.b.b.length, 2);
+    ASSERT_EQ(decoded.value.b.b.buf[0], 0x12);
+    ASSERT_EQ(decoded.value.b.b.buf[1], 0x34);
+    ASSERT_EQ(decoded.b, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_open_types_open_types_message_encode(&encoded2[0],
+                                                        sizeof(encoded2),
+                                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ASSERT_EQ(uper_open_types_open_types_message_skip(&encoded[0],
+                                                      sizeof(encoded)),
+              sizeof(encoded));
+
+    /* Encode as JSON. */
+    ASSERT_EQ(uper_open_types_open_types_message_encode_jer(&encoded3[0],
+                                                            sizeof(encoded3),
+                                                            &decoded),
+              sizeof(encoded3));
+    ASSERT_MEMORY_EQ(&encoded3[0],
+                     "{\"a\":true,\"id\":1,\"value\":{\"a\":true,\"b\":\"1234\"},"
+                     "\"b\":5}",
+                     sizeof(encoded3));
+}
+
+TEST(uper_open_types_message_unknown)
+{
+    uint8_t encoded[6] = "\xc0\x01\xc0\xaa\xf3\x68";
+    uint8_t encoded2[6];
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_message_t decoded;
+
+    /* Decode. The unaligned value of an unknown id is copied to the
+       arena. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_open_types_open_types_message_decode(&decoded,
+                                                        &encoded[0],
+                                                        sizeof(encoded),
+                                                        &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 7);
+    ASSERT_TRUE(decoded.is_value_present);
+    ASSERT_EQ(decoded.value.unknown.buf, &arena_buf[0]);
+    ASSERT_EQ(decoded.value.unknown.size, 2);
+    ASSERT_MEMORY_EQ(decoded.value.unknown.buf, "\xab\xcd", 2);
+    ASSERT_EQ(decoded.b, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_open_types_open_types_message_encode(&encoded2[0],
+                                                        sizeof(encoded2),
+                                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(uper_open_types_container)
+{
+    uint8_t encoded[11] = "\x20\x00\x00\x10\x50\x00\x10\x39\x09\x1a\x00";
+    uint8_t encoded2[11];
+    uint8_t arena_buf[64];
+    struct uper_open_types_arena_t arena;
+    struct uper_open_types_open_types_container_t decoded;
+
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_open_types_open_types_container_decode(&decoded,
+                                                          &encoded[0],
+                                                          sizeof(encoded),
+                                                          &arena), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 2);
+    ASSERT_EQ(decoded.elements[0].id, 0);
+    ASSERT_EQ(decoded.elements[0].value.a.value, 5);
+    ASSERT_EQ(decoded.elements[1].id, 1);
+    ASSERT_TRUE(decoded.elements[1].value.b.a);
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_open_types_open_types_container_encode(&encoded2[0],
+                                                          sizeof(encoded2),
+                                                          &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ASSERT_EQ(uper_open_types_open_types_container_skip(&encoded[0],
+                                                        sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_open_types_message)
+{
+    uint8_t encoded[8] = "\xc0\x00\x01\x03\x90\x12\x34\xa0";
+    uint8_t encoded2[8];
+    struct per_open_types_open_types_message_t decoded;
+
+    /* Decode. The value is aligned in PER. */
+    ASSERT_EQ(per_open_types_open_types_message_decode(&decoded,
+                                                       &encoded[0],
+                                                       sizeof(encoded)),
+              sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_TRUE(decoded.is_value_present);
+    ASSERT_TRUE(decoded.value.b.a);
+    ASSERT_EQ(decoded.value.b.b.length, 2);
+    ASSERT_EQ(decoded.value.b.b.buf[0], 0x12);
+    ASSERT_EQ(decoded.value.b.b.buf[1], 0x34);
+    ASSERT_EQ(decoded.b, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(per_open_types_open_types_message_encode(&encoded2[0],
+                                                       sizeof(encoded2),
+                                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ASSERT_EQ(per_open_types_open_types_message_skip(&encoded[0],
+                                                     sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_open_types_message_not_present)
+{
+    uint8_t encoded[4] = "\x00\x00\x02\x60";
+    uint8_t encoded2[4];
+    struct per_open_types_open_types_message_t decoded;
+
+    ASSERT_EQ(per_open_types_open_types_message_decode(&decoded,
+                                                       &encoded[0],
+                                                       sizeof(encoded)),
+              sizeof(encoded));
+    ASSERT_FALSE(decoded.a);
+    ASSERT_EQ(decoded.id, 2);
+    ASSERT_FALSE(decoded.is_value_present);
+    ASSERT_EQ(decoded.b, 3);
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(per_open_types_open_types_message_encode(&encoded2[0],
+                                                       sizeof(encoded2),
+                                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(per_open_types_field_unknown)
+{
+    uint8_t encoded[5] = "\x00\x07\x02\xab\xcd";
+    uint8_t encoded2[5];
+    struct per_open_types_open_types_field_t decoded;
+
+    /* Unknown ids are errors without open type views. */
+    ASSERT_EQ(per_open_types_open_types_field_decode(&decoded,
+                                                     &encoded[0],
+                                                     sizeof(encoded)),
+              -EBADCHOICE);
+
+    decoded.id = 7;
+    ASSERT_EQ(per_open_types_open_types_field_encode(&encoded2[0],
+                                                     sizeof(encoded2),
+                                                     &decoded), -EBADCHOICE);
+
+    /* Skipping does not need to know the id. */
+    ASSERT_EQ(per_open_types_open_types_field_skip(&encoded[0],
+                                                   sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_lazy_open_types_container)
+{
+    uint8_t encoded[11] = "\x20\x00\x00\x01\x05\x00\x01\x03\x90\x12\x34";
+    uint8_t encoded2[11];
+    struct per_lazy_open_types_open_types_container_t decoded;
+    union per_lazy_open_types_open_types_field_value_t value;
+
+    /* Decode. The values are views of the encoding. */
+    ASSERT_EQ(per_lazy_open_types_open_types_container_decode(&decoded,
+                                                              &encoded[0],
+                                                              sizeof(encoded)),
+              sizeof(encoded));
+    ASSERT_EQ(decoded.length, 2);
+    ASSERT_EQ(decoded.elements[0].id, 0);
+    ASSERT_EQ(decoded.elements[0].value.buf, &encoded[4]);
+    ASSERT_EQ(decoded.elements[0].value.size, 1);
+    ASSERT_EQ(decoded.elements[1].id, 1);
+    ASSERT_EQ(decoded.elements[1].value.buf, &encoded[8]);
+    ASSERT_EQ(decoded.elements[1].value.size, 3);
+
+    /* Decode the values when needed. */
+    ASSERT_EQ(per_lazy_open_types_open_types_field_decode_value(
+                  &value,
+                  &decoded.elements[1]), 3);
+    ASSERT_TRUE(value.b.a);
+    ASSERT_EQ(value.b.b.length, 2);
+    ASSERT_EQ(value.b.b.buf[0], 0x12);
+    ASSERT_EQ(value.b.b.buf[1], 0x34);
+
+    ASSERT_EQ(per_lazy_open_types_open_types_field_decode_value(
+                  &value,
+                  &decoded.elements[0]), 1);
+    ASSERT_EQ(value.a.value, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(per_lazy_open_types_open_types_container_encode(&encoded2[0],
+                                                              sizeof(encoded2),
+                                                              &decoded),
+              sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(per_lazy_open_types_field_decode_value_error)
+{
+    uint8_t encoded[5] = "\x00\x07\x02\xab\xcd";
+    struct per_lazy_open_types_open_types_field_t decoded;
+    union per_lazy_open_types_open_types_field_value_t value;
+
+    /* Values of unknown ids are decoded as views, but can not be
+       decoded further. */
+    ASSERT_EQ(per_lazy_open_types_open_types_field_decode(&decoded,
+                                                          &encoded[0],
+                                                          sizeof(encoded)),
+              sizeof(encoded));
+    ASSERT_EQ(decoded.id, 7);
+    ASSERT_EQ(per_lazy_open_types_open_types_field_decode_value(&value,
+                                                                &decoded),
+              -EBADCHOICE);
+
+    /* Too short value. */
+    decoded.id = 1;
+    decoded.value.size = 1;
+    ASSERT_EQ(per_lazy_open_types_open_types_field_decode_value(&value,
+                                                                &decoded),
+              -EOUTOFDATA);
+}
+
+TEST(per_lazy_open_types_field_decode_error_bad_length)
+{
+    uint8_t encoded[3] = "\x00\x52\x00";
+    struct per_lazy_open_types_open_types_field_t decoded;
+
+    /* Empty values are never encoded, not even as views. */
+    ASSERT_EQ(per_lazy_open_types_open_types_field_decode(&decoded,
+                                                          &encoded[0],
+                                                          sizeof(encoded)),
+              -EBADLENGTH);
+    ASSERT_EQ(per_lazy_open_types_open_types_field_skip(&encoded[0],
+                                                        sizeof(encoded)),
+              -EBADLENGTH);
+}
+
+TEST(uper_lazy_open_types_message)
+{
+    uint8_t encoded[7] = "\xc0\x00\x40\xe4\x24\x68\x28";
+    uint8_t encoded2[7];
+    uint8_t arena_buf[64];
+    struct uper_lazy_open_types_arena_t arena;
+    struct uper_lazy_open_types_open_types_message_t decoded;
+    union uper_lazy_open_types_open_types_message_value_t value;
+
+    /* Decode. The unaligned value is copied to the arena. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_lazy_open_types_open_types_message_decode(&decoded,
+                                                             &encoded[0],
+                                                             sizeof(encoded),
+                                                             &arena),
+              sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_TRUE(decoded.is_value_present);
+    ASSERT_EQ(decoded.value.buf, &arena_buf[0]);
+    ASSERT_EQ(decoded.value.size, 3);
+    ASSERT_MEMORY_EQ(decoded.value.buf, "\x90\x91\xa0", 3);
+    ASSERT_EQ(decoded.b, 5);
+
+    ASSERT_EQ(uper_lazy_open_types_open_types_message_decode_value(
+                  &value,
+                  &decoded,
+                  &arena), 3);
+    ASSERT_TRUE(value.b.a);
+    ASSERT_EQ(value.b.b.length, 2);
+    ASSERT_EQ(value.b.b.buf[0], 0x12);
+    ASSERT_EQ(value.b.b.buf[1], 0x34);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_lazy_open_types_open_types_message_encode(&encoded2[0],
+                                                             sizeof(encoded2),
+                                                             &decoded),
+              sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
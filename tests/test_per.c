@@ -0,0 +1,423 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "per.h"
+#include "per_alignment.h"
+
+TEST(per_c_source_a)
+{
+    uint8_t encoded[36];
+    struct per_c_source_a_t decoded;
+
+    /* Encode. */
+    decoded.a = -1;
+    decoded.b = -2;
+    decoded.c = -3;
+    decoded.d = -4;
+    decoded.e = 1;
+    decoded.f = 2;
+    decoded.g = 3;
+    decoded.h = 4;
+    decoded.i = true;
+    memset(&decoded.j.buf[0], 5, sizeof(decoded.j.buf));
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_c_source_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(per_c_source_a_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x7f\x7f\xfe\xc0\x7f\xff\xff\xfd\xe0\x7f\xff\xff\xff\xff"
+                     "\xff\xff\xfc\x01\x00\x02\x00\x03\x00\x04\x80\x05\x05\x05"
+                     "\x05\x05\x05\x05\x05\x05\x05\x05",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_c_source_a_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.a, -1);
+    ASSERT_EQ(decoded.b, -2);
+    ASSERT_EQ(decoded.c, -3);
+    ASSERT_EQ(decoded.d, -4);
+    ASSERT_EQ(decoded.e, 1);
+    ASSERT_EQ(decoded.f, 2);
+    ASSERT_EQ(decoded.g, 3);
+    ASSERT_EQ(decoded.h, 4);
+    ASSERT_TRUE(decoded.i);
+    ASSERT_MEMORY_EQ(&decoded.j.buf[0],
+                     "\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05",
+                     sizeof(decoded.j.buf));
+
+    /* Skip. */
+    ASSERT_EQ(per_c_source_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_c_source_a_encode_error_no_mem)
+{
+    uint8_t encoded[35];
+    struct per_c_source_a_t decoded;
+
+    decoded.a = -1;
+    decoded.b = -2;
+    decoded.c = -3;
+    decoded.d = -4;
+    decoded.e = 1;
+    decoded.f = 2;
+    decoded.g = 3;
+    decoded.h = 4;
+    decoded.i = true;
+    memset(&decoded.j.buf[0], 5, sizeof(decoded.j.buf));
+
+    ASSERT_EQ(per_c_source_a_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), -ENOMEM);
+}
+
+TEST(per_c_source_a_decode_error_out_of_data)
+{
+    uint8_t encoded[35] =
+        "\x7f\x7f\xfe\xc0\x7f\xff\xff\xfd\xe0\x7f\xff\xff\xff\xff"
+        "\xff\xff\xfc\x01\x00\x02\x00\x03\x00\x04\x80\x05\x05\x05"
+        "\x05\x05\x05\x05\x05\x05\x05";
+    struct per_c_source_a_t decoded;
+
+    ASSERT_EQ(per_c_source_a_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), -EOUTOFDATA);
+}
+
+TEST(per_c_source_c)
+{
+    uint8_t encoded[4];
+    struct per_c_source_c_t decoded;
+
+    /* Encode. */
+    decoded.length = 2;
+    decoded.elements[0].choice = per_c_source_b_choice_a_e;
+    decoded.elements[0].value.a = -1;
+    decoded.elements[1].choice = per_c_source_b_choice_a_e;
+    decoded.elements[1].value.a = 2;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_c_source_c_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x80\x7f\x00\x82", sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_c_source_c_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, 2);
+    ASSERT_EQ(decoded.elements[0].choice, per_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded.elements[0].value.a, -1);
+    ASSERT_EQ(decoded.elements[1].choice, per_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded.elements[1].value.a, 2);
+}
+
+TEST(per_c_source_q_c256)
+{
+    uint8_t encoded[3];
+    struct per_c_source_q_t decoded;
+
+    /* Encode. */
+    decoded.choice = per_c_source_q_choice_c256_e;
+    decoded.value.c256 = true;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_c_source_q_encode(&encoded[0],
+                                    sizeof(encoded),
+                                    &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x00\xff\x80", sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_c_source_q_decode(&decoded,
+                                    &encoded[0],
+                                    sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_EQ(decoded.choice, per_c_source_q_choice_c256_e);
+    ASSERT_EQ(decoded.value.c256, true);
+}
+
+TEST(per_alignment_a)
+{
+    uint8_t encoded[13];
+    struct per_alignment_alignment_a_t decoded;
+
+    /* Encode. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.a = true;
+    decoded.b.length = 3;
+    memcpy(&decoded.b.buf[0], "\x01\x02\x03", 3);
+    decoded.c = false;
+    decoded.d = 1000;
+    decoded.e = true;
+    decoded.f.length = 3;
+    decoded.f.elements[0] = true;
+    decoded.f.elements[1] = false;
+    decoded.f.elements[2] = true;
+    decoded.g = true;
+
+    /* The lengths of b and f, and d, are octet aligned. */
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_a_encoded_size(&decoded),
+              sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_a_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x80\x00\x03\x01\x02\x03\x00\x03\xe8\x80\x00\x03\xb0",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_a_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b.length, 3);
+    ASSERT_MEMORY_EQ(&decoded.b.buf[0], "\x01\x02\x03", 3);
+    ASSERT_FALSE(decoded.c);
+    ASSERT_EQ(decoded.d, 1000);
+    ASSERT_TRUE(decoded.e);
+    ASSERT_EQ(decoded.f.length, 3);
+    ASSERT_TRUE(decoded.f.elements[0]);
+    ASSERT_FALSE(decoded.f.elements[1]);
+    ASSERT_TRUE(decoded.f.elements[2]);
+    ASSERT_TRUE(decoded.g);
+
+    /* Skip. */
+    ASSERT_EQ(per_alignment_alignment_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_a_skip(&encoded[0], sizeof(encoded) - 1),
+              -EOUTOFDATA);
+}
+
+TEST(per_alignment_a_fields)
+{
+    struct per_alignment_alignment_a_t decoded;
+    const uint8_t encoded[] = {
+        0x80, 0x00, 0x03, 0x01, 0x02, 0x03, 0x00, 0x03, 0xe8, 0x80, 0x00,
+        0x03, 0xb0
+    };
+
+    /* Decode only d and g, skipping over the padding of the others. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_a_decode_fields(
+                  &decoded,
+                  &encoded[0],
+                  sizeof(encoded),
+                  PER_ALIGNMENT_ALIGNMENT_A_FIELD_D
+                  | PER_ALIGNMENT_ALIGNMENT_A_FIELD_G), sizeof(encoded));
+
+    ASSERT_FALSE(decoded.a);
+    ASSERT_EQ(decoded.b.length, 0);
+    ASSERT_EQ(decoded.d, 1000);
+    ASSERT_EQ(decoded.f.length, 0);
+    ASSERT_TRUE(decoded.g);
+}
+
+TEST(per_alignment_a_decode_error_bad_length)
+{
+    struct per_alignment_alignment_a_t decoded;
+
+    /* The length of b, 301, is above its maximum. */
+    ASSERT_EQ(per_alignment_alignment_a_decode(&decoded,
+                                               (const uint8_t *)"\x80\x01\x2d",
+                                               3), -EBADLENGTH);
+    ASSERT_EQ(per_alignment_alignment_a_skip((const uint8_t *)"\x80\x01\x2d", 3),
+              -EBADLENGTH);
+}
+
+TEST(per_alignment_b)
+{
+    uint8_t encoded[18];
+    struct per_alignment_alignment_b_t decoded;
+
+    /* Encode. */
+    decoded.a = true;
+    decoded.b = 0x123456;
+    decoded.c = -1;
+    decoded.d = 0x0102030405060708;
+
+    /* Each integer is a length in number of bytes minus one, followed
+       by the octet aligned bytes. */
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_b_encoded_size(&decoded),
+              sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_b_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\xc0\x12\x34\x56\xc0\x7f\xff\xff\xff\xe0\x01\x02\x03\x04"
+                     "\x05\x06\x07\x08",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_b_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b, 0x123456);
+    ASSERT_EQ(decoded.c, -1);
+    ASSERT_EQ(decoded.d, 0x0102030405060708);
+
+    /* Skip. */
+    ASSERT_EQ(per_alignment_alignment_b_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_alignment_b_minimum_lengths)
+{
+    uint8_t encoded[9];
+    struct per_alignment_alignment_b_t decoded;
+
+    /* Encode. */
+    decoded.a = false;
+    decoded.b = 5;
+    decoded.c = 0;
+    decoded.d = 0;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_b_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x00\x05\xc0\x80\x00\x00\x00\x00\x00",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0xff, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_b_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_FALSE(decoded.a);
+    ASSERT_EQ(decoded.b, 5);
+    ASSERT_EQ(decoded.c, 0);
+    ASSERT_EQ(decoded.d, 0);
+}
+
+TEST(per_alignment_b_decode_error_bad_length)
+{
+    struct per_alignment_alignment_b_t decoded;
+
+    /* The length of b is four bytes, but its range fits in three. */
+    ASSERT_EQ(per_alignment_alignment_b_decode(
+                  &decoded,
+                  (const uint8_t *)"\xe0\x00\x12\x34\x56",
+                  5), -EBADLENGTH);
+    ASSERT_EQ(per_alignment_alignment_b_skip(
+                  (const uint8_t *)"\xe0\x00\x12\x34\x56",
+                  5), -EBADLENGTH);
+}
+
+TEST(per_alignment_d)
+{
+    uint8_t encoded[21];
+    struct per_alignment_alignment_d_t decoded;
+
+    /* Encode. */
+    decoded.a = true;
+    decoded.id = 0;
+    decoded.value.b.a = true;
+    decoded.value.b.b = 0x123456;
+    decoded.value.b.c = -1;
+    decoded.value.b.d = 0x0102030405060708;
+
+    /* The open type length is octet aligned. */
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_d_encoded_size(&decoded),
+              sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_d_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x80\x00\x12\xc0\x12\x34\x56\xc0\x7f\xff\xff\xff\xe0\x01"
+                     "\x02\x03\x04\x05\x06\x07\x08",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_d_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.id, 0);
+    ASSERT_TRUE(decoded.value.b.a);
+    ASSERT_EQ(decoded.value.b.b, 0x123456);
+    ASSERT_EQ(decoded.value.b.c, -1);
+    ASSERT_EQ(decoded.value.b.d, 0x0102030405060708);
+
+    /* Decode only the key, skipping over the open type. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_d_decode_fields(
+                  &decoded,
+                  &encoded[0],
+                  sizeof(encoded),
+                  PER_ALIGNMENT_ALIGNMENT_D_FIELD_ID), sizeof(encoded));
+    ASSERT_EQ(decoded.id, 0);
+    ASSERT_FALSE(decoded.value.b.a);
+
+    /* Skip. */
+    ASSERT_EQ(per_alignment_alignment_d_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_alignment_d_c)
+{
+    uint8_t encoded[7];
+    struct per_alignment_alignment_d_t decoded;
+
+    /* Encode. */
+    decoded.a = false;
+    decoded.id = 1;
+    decoded.value.c.length = 3;
+    memset(&decoded.value.c.buf[0], 0xab, 3);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_alignment_alignment_d_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x00\x01\x04\x03\xab\xab\xab",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_alignment_alignment_d_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded)), sizeof(encoded));
+
+    ASSERT_FALSE(decoded.a);
+    ASSERT_EQ(decoded.id, 1);
+    ASSERT_EQ(decoded.value.c.length, 3);
+    ASSERT_MEMORY_EQ(&decoded.value.c.buf[0], "\xab\xab\xab", 3);
+}
+
+TEST(per_alignment_d_decode_error_bad_length)
+{
+    struct per_alignment_alignment_d_t decoded;
+
+    /* Fragmented open type lengths are not supported. */
+    ASSERT_EQ(per_alignment_alignment_d_decode(
+                  &decoded,
+                  (const uint8_t *)"\x00\x01\xc1\x03\xab\xab\xab",
+                  7), -EBADLENGTH);
+    ASSERT_EQ(per_alignment_alignment_d_skip(
+                  (const uint8_t *)"\x00\x01\xc1\x03\xab\xab\xab",
+                  7), -EBADLENGTH);
+}
@@ -0,0 +1,309 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "nala.h"
+
+#include "uper_reals.h"
+#include "per_reals.h"
+
+#define membersof(a) (sizeof(a) / (sizeof((a)[0])))
+
+struct real_t {
+    double value;
+    size_t size;
+    const char *encoded_p;
+};
+
+static const struct real_t reals[] = {
+    { 1.0, 4, "\x03\x80\x00\x01" },
+    { 0.1, 10, "\x09\x80\xc9\x0c\xcc\xcc\xcc\xcc\xcc\xcd" },
+    { -2.5, 4, "\x03\xc0\xff\x05" },
+    { 1e300, 11, "\x0a\x81\x03\xb2\x05\xf9\x0f\x22\x00\x1d\x67" },
+    { 5e-324, 5, "\x04\x81\xfb\xce\x01" },
+    { INFINITY, 2, "\x01\x40" },
+    { -INFINITY, 2, "\x01\x41" },
+    { 0.0, 1, "\x00" }
+};
+
+TEST(uper_reals_a)
+{
+    uint8_t encoded[11];
+    struct uper_reals_reals_a_t decoded;
+    size_t i;
+
+    for (i = 0; i < membersof(reals); i++) {
+        /* Encode. */
+        decoded.value = reals[i].value;
+        memset(&encoded[0], 0, sizeof(encoded));
+        ASSERT_EQ(uper_reals_reals_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), reals[i].size);
+        ASSERT_MEMORY_EQ(&encoded[0], reals[i].encoded_p, reals[i].size);
+
+        /* Decode. */
+        memset(&decoded, 0, sizeof(decoded));
+        ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                            (const uint8_t *)reals[i].encoded_p,
+                                            reals[i].size), reals[i].size);
+        ASSERT_EQ(memcmp(&decoded.value, &reals[i].value, sizeof(double)), 0);
+
+        ASSERT_EQ(uper_reals_reals_a_skip((const uint8_t *)reals[i].encoded_p,
+                                          reals[i].size), reals[i].size);
+    }
+}
+
+TEST(uper_reals_a_nan_and_minus_zero)
+{
+    uint8_t encoded[2];
+    struct uper_reals_reals_a_t decoded;
+
+    decoded.value = NAN;
+    ASSERT_EQ(uper_reals_reals_a_encode(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), 2);
+    ASSERT_MEMORY_EQ(&encoded[0], "\x01\x42", 2);
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded, &encoded[0], 2), 2);
+    ASSERT_TRUE(isnan(decoded.value));
+
+    decoded.value = -0.0;
+    ASSERT_EQ(uper_reals_reals_a_encode(&encoded[0],
+                                        sizeof(encoded),
+                                        &decoded), 2);
+    ASSERT_MEMORY_EQ(&encoded[0], "\x01\x43", 2);
+    decoded.value = 1.0;
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded, &encoded[0], 2), 2);
+    ASSERT_EQ(decoded.value, 0.0);
+    ASSERT_TRUE(signbit(decoded.value));
+}
+
+TEST(uper_reals_a_decode_other_bases)
+{
+    struct uper_reals_reals_a_t decoded;
+
+    /* Base 16 and base 8 with a scaling factor are not allowed by
+       X.691, which uses the CER and DER encoding. */
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x03\xa0\x01\x03",
+                                        4), -EINVAL);
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x03\x94\xff\x03",
+                                        4), -EINVAL);
+
+    /* Base 2 with a scaling factor. */
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x03\x84\xff\x03",
+                                        4), -EINVAL);
+
+    /* A mantissa wider than 53 bits with trailing zero bits. */
+    ASSERT_EQ(uper_reals_reals_a_decode(
+                  &decoded,
+                  (const uint8_t *)"\x0a\x80\x00\x01\x00\x00\x00\x00\x00\x00\x00",
+                  11), 11);
+    ASSERT_EQ(decoded.value, 72057594037927936.0);
+}
+
+TEST(uper_reals_a_decode_error)
+{
+    struct uper_reals_reals_a_t decoded;
+
+    /* Decimal encodings are not supported. */
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x04\x03\x31\x2e\x45\x30",
+                                        5), -EINVAL);
+
+    /* Too long. */
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x0d\x80\x00\x01",
+                                        4), -EBADLENGTH);
+
+    /* Out of data. */
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x03\x80\x00",
+                                        3), -EOUTOFDATA);
+
+    /* Exponent out of range. */
+    ASSERT_EQ(uper_reals_reals_a_decode(&decoded,
+                                        (const uint8_t *)"\x04\x81\x7f\xff\x01",
+                                        5), -EINVAL);
+}
+
+TEST(uper_reals_b)
+{
+    uint8_t encoded[15] =
+        "\xc0\xf0\x3f\xc1\x42\x60\x32\x43\x33\x33\x33\x33\x33\x33\x40";
+    uint8_t encoded2[15];
+    struct uper_reals_reals_b_t decoded;
+
+    /* Encode. */
+    decoded.a = true;
+    decoded.b = -2.5;
+    decoded.is_c_present = true;
+    decoded.c = 0.1;
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_reals_reals_b_encode(&encoded2[0],
+                                        sizeof(encoded2),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_reals_reals_b_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded)), sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b, -2.5);
+    ASSERT_TRUE(decoded.is_c_present);
+    ASSERT_EQ(decoded.c, 0.1);
+
+    ASSERT_EQ(uper_reals_reals_b_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(uper_reals_b_encode_jer)
+{
+    uint8_t encoded[43];
+    struct uper_reals_reals_b_t decoded;
+
+    decoded.a = true;
+    decoded.b = -2.5;
+    decoded.is_c_present = true;
+    decoded.c = 0.1;
+
+    ASSERT_EQ(uper_reals_reals_b_encode_jer(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), 43);
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "{\"a\":true,\"b\":-2.5,\"c\":0.10000000000000001}",
+                     43);
+
+    decoded.b = INFINITY;
+    decoded.c = NAN;
+    ASSERT_EQ(uper_reals_reals_b_encode_jer(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), 30);
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "{\"a\":true,\"b\":\"INF\",\"c\":\"NaN\"}",
+                     30);
+}
+
+TEST(uper_reals_c)
+{
+    uint8_t encoded[8] = "\x60\x70\x00\x00\x20\x00\x28\x00";
+    uint8_t encoded2[8];
+    struct uper_reals_reals_c_t decoded;
+
+    /* Encode. */
+    decoded.length = 3;
+    decoded.elements[0] = 1.0;
+    decoded.elements[1] = 0.0;
+    decoded.elements[2] = INFINITY;
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_reals_reals_c_encode(&encoded2[0],
+                                        sizeof(encoded2),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_reals_reals_c_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ(decoded.elements[0], 1.0);
+    ASSERT_EQ(decoded.elements[1], 0.0);
+    ASSERT_TRUE(isinf(decoded.elements[2]));
+
+    ASSERT_EQ(uper_reals_reals_c_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_reals_a)
+{
+    uint8_t encoded[11];
+    struct per_reals_reals_a_t decoded;
+    size_t i;
+
+    /* Same as UPER as the value is octet aligned. */
+    for (i = 0; i < membersof(reals); i++) {
+        decoded.value = reals[i].value;
+        memset(&encoded[0], 0, sizeof(encoded));
+        ASSERT_EQ(per_reals_reals_a_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), reals[i].size);
+        ASSERT_MEMORY_EQ(&encoded[0], reals[i].encoded_p, reals[i].size);
+
+        memset(&decoded, 0, sizeof(decoded));
+        ASSERT_EQ(per_reals_reals_a_decode(&decoded,
+                                           (const uint8_t *)reals[i].encoded_p,
+                                           reals[i].size), reals[i].size);
+        ASSERT_EQ(memcmp(&decoded.value, &reals[i].value, sizeof(double)), 0);
+    }
+}
+
+TEST(per_reals_b)
+{
+    uint8_t encoded[15] =
+        "\xc0\x03\xc0\xff\x05\x09\x80\xc9\x0c\xcc\xcc\xcc\xcc\xcc\xcd";
+    uint8_t encoded2[15];
+    struct per_reals_reals_b_t decoded;
+
+    /* Encode. */
+    decoded.a = true;
+    decoded.b = -2.5;
+    decoded.is_c_present = true;
+    decoded.c = 0.1;
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(per_reals_reals_b_encode(&encoded2[0],
+                                       sizeof(encoded2),
+                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_reals_reals_b_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded)), sizeof(encoded));
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b, -2.5);
+    ASSERT_TRUE(decoded.is_c_present);
+    ASSERT_EQ(decoded.c, 0.1);
+
+    ASSERT_EQ(per_reals_reals_b_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_reals_c)
+{
+    uint8_t encoded[8] = "\x60\x03\x80\x00\x01\x00\x01\x40";
+    uint8_t encoded2[8];
+    struct per_reals_reals_c_t decoded;
+
+    /* Encode. */
+    decoded.length = 3;
+    decoded.elements[0] = 1.0;
+    decoded.elements[1] = 0.0;
+    decoded.elements[2] = INFINITY;
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(per_reals_reals_c_encode(&encoded2[0],
+                                       sizeof(encoded2),
+                                       &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_reals_reals_c_decode(&decoded,
+                                       &encoded[0],
+                                       sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ(decoded.elements[0], 1.0);
+    ASSERT_EQ(decoded.elements[1], 0.0);
+    ASSERT_TRUE(isinf(decoded.elements[2]));
+
+    ASSERT_EQ(per_reals_reals_c_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
@@ -0,0 +1,278 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "oer_recursive.h"
+#include "uper_recursive.h"
+#include "per_recursive.h"
+
+#define ARENA_INIT(arena_p, arena_buf)          \
+    do {                                        \
+        (arena_p)->buf = &(arena_buf)[0];       \
+        (arena_p)->size = sizeof(arena_buf);    \
+        (arena_p)->pos = 0;                     \
+    } while (0)
+
+TEST(oer_recursive_a)
+{
+    uint8_t encoded[6] = "\x80\x01\x80\x02\x00\x03";
+    uint8_t encoded2[6];
+    uint8_t arena_buf[64];
+    struct oer_recursive_arena_t arena;
+    struct oer_recursive_recursive_a_t decoded;
+    struct oer_recursive_recursive_a_t b;
+    struct oer_recursive_recursive_a_t c;
+
+    /* Encode. */
+    c.a = 3;
+    c.is_b_present = false;
+    b.a = 2;
+    b.is_b_present = true;
+    b.b = &c;
+    decoded.a = 1;
+    decoded.is_b_present = true;
+    decoded.b = &b;
+
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(oer_recursive_recursive_a_encode(&encoded2[0],
+                                               sizeof(encoded2),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode. The values of b are allocated from the arena. */
+    ARENA_INIT(&arena, arena_buf);
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_recursive_recursive_a_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded),
+                                               &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.a, 1);
+    ASSERT_TRUE(decoded.is_b_present);
+    ASSERT_EQ((uint8_t *)decoded.b, &arena_buf[0]);
+    ASSERT_EQ(decoded.b->a, 2);
+    ASSERT_TRUE(decoded.b->is_b_present);
+    ASSERT_EQ(decoded.b->b->a, 3);
+    ASSERT_FALSE(decoded.b->b->is_b_present);
+    ASSERT_EQ(arena.pos, 2 * sizeof(decoded));
+
+    ASSERT_EQ(oer_recursive_recursive_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(oer_recursive_a_encode_error_null_pointer)
+{
+    uint8_t encoded[6];
+    struct oer_recursive_recursive_a_t decoded;
+
+    decoded.a = 1;
+    decoded.is_b_present = true;
+    decoded.b = NULL;
+
+    ASSERT_EQ(oer_recursive_recursive_a_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), -EINVAL);
+}
+
+TEST(oer_recursive_a_maximum_depth)
+{
+    uint8_t encoded[2 * (OER_RECURSIVE_MAX_RECURSION_DEPTH + 2)];
+    uint8_t encoded2[sizeof(encoded)];
+    uint8_t arena_buf[16 * (OER_RECURSIVE_MAX_RECURSION_DEPTH + 1)];
+    struct oer_recursive_arena_t arena;
+    struct oer_recursive_recursive_a_t decoded;
+    size_t size;
+    size_t i;
+
+    /* The maximum depth. */
+    size = (sizeof(encoded) - 2);
+
+    for (i = 0; i < size; i += 2) {
+        encoded[i] = 0x80;
+        encoded[i + 1] = (uint8_t)i;
+    }
+
+    encoded[size - 2] = 0x00;
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(oer_recursive_recursive_a_decode(&decoded,
+                                               &encoded[0],
+                                               size,
+                                               &arena), (ssize_t)size);
+    ASSERT_EQ(oer_recursive_recursive_a_skip(&encoded[0], size),
+              (ssize_t)size);
+    ASSERT_EQ(oer_recursive_recursive_a_encode(&encoded2[0],
+                                               sizeof(encoded2),
+                                               &decoded), (ssize_t)size);
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], size);
+
+    /* One more. */
+    size = sizeof(encoded);
+    encoded[size - 4] = 0x80;
+    encoded[size - 2] = 0x00;
+    encoded[size - 1] = 0x00;
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(oer_recursive_recursive_a_decode(&decoded,
+                                               &encoded[0],
+                                               size,
+                                               &arena), -EBADDEPTH);
+    ASSERT_EQ(oer_recursive_recursive_a_skip(&encoded[0], size), -EBADDEPTH);
+}
+
+TEST(oer_recursive_a_decode_error_out_of_memory)
+{
+    uint8_t encoded[6] = "\x80\x01\x80\x02\x00\x03";
+    uint8_t arena_buf[16];
+    struct oer_recursive_arena_t arena;
+    struct oer_recursive_recursive_a_t decoded;
+
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(oer_recursive_recursive_a_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded),
+                                               &arena), -ENOMEM);
+}
+
+TEST(oer_recursive_a_encode_jer)
+{
+    uint8_t encoded[31];
+    struct oer_recursive_recursive_a_t decoded;
+    struct oer_recursive_recursive_a_t b;
+    struct oer_recursive_recursive_a_t c;
+
+    c.a = 3;
+    c.is_b_present = false;
+    b.a = 2;
+    b.is_b_present = true;
+    b.b = &c;
+    decoded.a = 1;
+    decoded.is_b_present = true;
+    decoded.b = &b;
+
+    ASSERT_EQ(oer_recursive_recursive_a_encode_jer(&encoded[0],
+                                                   sizeof(encoded),
+                                                   &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "{\"a\":1,\"b\":{\"a\":2,\"b\":{\"a\":3}}}",
+                     sizeof(encoded));
+}
+
+TEST(oer_recursive_a_encode_error_loop)
+{
+    uint8_t encoded[512];
+    struct oer_recursive_recursive_a_t decoded;
+
+    /* Encoding a loop fails when the maximum depth is reached. */
+    decoded.a = 1;
+    decoded.is_b_present = true;
+    decoded.b = &decoded;
+
+    ASSERT_EQ(oer_recursive_recursive_a_encode(&encoded[0],
+                                               sizeof(encoded),
+                                               &decoded), -EBADDEPTH);
+    ASSERT_EQ(oer_recursive_recursive_a_encoded_size(&decoded), -EBADDEPTH);
+    ASSERT_EQ(oer_recursive_recursive_a_encode_jer(&encoded[0],
+                                                   sizeof(encoded),
+                                                   &decoded), -EBADDEPTH);
+}
+
+TEST(oer_recursive_b)
+{
+    uint8_t encoded[12] = "\xff\x01\x02\x00\x01\x00\xff\x01\x01\x00\x01\x00";
+    uint8_t encoded2[12];
+    uint8_t arena_buf[256];
+    struct oer_recursive_arena_t arena;
+    struct oer_recursive_recursive_b_t decoded;
+
+    /* Decode. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(oer_recursive_recursive_b_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded),
+                                               &arena), sizeof(encoded));
+
+    ASSERT_TRUE(decoded.a);
+    ASSERT_EQ(decoded.b.length, 2);
+    ASSERT_FALSE(decoded.b.elements[0]->a);
+    ASSERT_EQ(decoded.b.elements[0]->b.length, 0);
+    ASSERT_TRUE(decoded.b.elements[1]->a);
+    ASSERT_EQ(decoded.b.elements[1]->b.length, 1);
+    ASSERT_FALSE(decoded.b.elements[1]->b.elements[0]->a);
+    ASSERT_EQ(decoded.b.elements[1]->b.elements[0]->b.length, 0);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(oer_recursive_recursive_b_encode(&encoded2[0],
+                                               sizeof(encoded2),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(uper_recursive_c)
+{
+    uint8_t encoded[4] = "\x80\x60\x20\x18";
+    uint8_t encoded2[4];
+    uint8_t arena_buf[128];
+    struct uper_recursive_arena_t arena;
+    struct uper_recursive_recursive_c_t decoded;
+
+    /* Decode. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(uper_recursive_recursive_c_decode(&decoded,
+                                                &encoded[0],
+                                                sizeof(encoded),
+                                                &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.choice, uper_recursive_recursive_c_choice_b_e);
+    ASSERT_EQ(decoded.value.b.a->choice, uper_recursive_recursive_c_choice_a_e);
+    ASSERT_EQ(decoded.value.b.a->value.a, 1);
+    ASSERT_EQ(decoded.value.b.b->choice, uper_recursive_recursive_c_choice_b_e);
+    ASSERT_EQ(decoded.value.b.b->value.b.a->value.a, 2);
+    ASSERT_EQ(decoded.value.b.b->value.b.b->value.a, 3);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_recursive_recursive_c_encode(&encoded2[0],
+                                                sizeof(encoded2),
+                                                &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ASSERT_EQ(uper_recursive_recursive_c_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(per_recursive_d)
+{
+    uint8_t encoded[6] = "\x88\x01\xc0\x00\x05\x04";
+    uint8_t encoded2[6];
+    uint8_t arena_buf[128];
+    struct per_recursive_arena_t arena;
+    struct per_recursive_recursive_d_t decoded;
+
+    /* Decode. D and E refer to each other. */
+    ARENA_INIT(&arena, arena_buf);
+    ASSERT_EQ(per_recursive_recursive_d_decode(&decoded,
+                                               &encoded[0],
+                                               sizeof(encoded),
+                                               &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.a.length, 1);
+    ASSERT_EQ(decoded.a.buf[0], 1);
+    ASSERT_TRUE(decoded.is_b_present);
+    ASSERT_EQ(decoded.b->b, 4);
+    ASSERT_TRUE(decoded.b->is_a_present);
+    ASSERT_EQ(decoded.b->a->a.length, 0);
+    ASSERT_TRUE(decoded.b->a->is_b_present);
+    ASSERT_FALSE(decoded.b->a->b->is_a_present);
+    ASSERT_EQ(decoded.b->a->b->b, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(per_recursive_recursive_d_encode(&encoded2[0],
+                                               sizeof(encoded2),
+                                               &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    ASSERT_EQ(per_recursive_recursive_d_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "oer_regions.h"
+#include "uper_regions.h"
+#include "per_regions.h"
+
+#define FILL_A(decoded)                                 \
+    do {                                                \
+        (decoded).a = 5;                                \
+        (decoded).b = true;                             \
+        (decoded).c = -5;                               \
+        (decoded).d.length = 3;                         \
+        memcpy(&(decoded).d.buf[0], "\x01\x02\x03", 3); \
+        (decoded).e = 265;                              \
+        (decoded).f = true;                             \
+        memcpy(&(decoded).g.buf[0], "\xab\xcd", 2);     \
+        (decoded).is_h_present = true;                  \
+        (decoded).h = 1;                                \
+        (decoded).i = -1000;                            \
+        (decoded).j = true;                             \
+    } while (0)
+
+#define ASSERT_A(decoded)                                       \
+    do {                                                        \
+        ASSERT_EQ((decoded).a, 5);                              \
+        ASSERT_TRUE((decoded).b);                               \
+        ASSERT_EQ((decoded).c, -5);                             \
+        ASSERT_EQ((decoded).d.length, 3);                       \
+        ASSERT_MEMORY_EQ(&(decoded).d.buf[0], "\x01\x02\x03", 3); \
+        ASSERT_EQ((decoded).e, 265);                            \
+        ASSERT_TRUE((decoded).f);                               \
+        ASSERT_MEMORY_EQ(&(decoded).g.buf[0], "\xab\xcd", 2);   \
+        ASSERT_TRUE((decoded).is_h_present);                    \
+        ASSERT_EQ((decoded).h, 1);                              \
+        ASSERT_EQ((decoded).i, -1000);                          \
+        ASSERT_TRUE((decoded).j);                               \
+    } while (0)
+
+#define FILL_B(decoded)                         \
+    do {                                        \
+        (decoded).is_a_present = true;          \
+        (decoded).a = true;                     \
+        (decoded).is_b_present = false;         \
+        (decoded).c = 1000000;                  \
+        (decoded).d = 123456;                   \
+        (decoded).e = -1000000;                 \
+        (decoded).f = 3;                        \
+    } while (0)
+
+#define ASSERT_B(decoded)                       \
+    do {                                        \
+        ASSERT_TRUE((decoded).is_a_present);    \
+        ASSERT_TRUE((decoded).a);               \
+        ASSERT_FALSE((decoded).is_b_present);   \
+        ASSERT_EQ((decoded).c, 1000000);        \
+        ASSERT_EQ((decoded).d, 123456);         \
+        ASSERT_EQ((decoded).e, -1000000);       \
+        ASSERT_EQ((decoded).f, 3);              \
+    } while (0)
+
+TEST(oer_regions_a)
+{
+    uint8_t encoded[17];
+    struct oer_regions_regions_a_t decoded;
+
+    FILL_A(decoded);
+    ASSERT_EQ(oer_regions_regions_a_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x80\x05\xff\xfb\x03\x01\x02\x03\x01\x09\xff\xab\xcd\x01"
+                     "\xfc\x18\xff",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_regions_regions_a_decode(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded)), sizeof(encoded));
+    ASSERT_A(decoded);
+
+    /* Not enough space for the last members. */
+    ASSERT_EQ(oer_regions_regions_a_encode(&encoded[0],
+                                           16,
+                                           &decoded), -ENOMEM);
+    ASSERT_EQ(oer_regions_regions_a_decode(&decoded,
+                                           &encoded[0],
+                                           16), -EOUTOFDATA);
+}
+
+TEST(oer_regions_b)
+{
+    uint8_t encoded[15];
+    struct oer_regions_regions_b_t decoded;
+
+    FILL_B(decoded);
+    ASSERT_EQ(oer_regions_regions_b_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x40\xff\x00\x0f\x42\x40\x00\x01\xe2\x40\xff\xf0\xbd\xc0"
+                     "\x03",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_regions_regions_b_decode(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(decoded);
+}
+
+TEST(uper_regions_a)
+{
+    uint8_t encoded[10];
+    struct uper_regions_regions_a_t decoded;
+
+    FILL_A(decoded);
+    ASSERT_EQ(uper_regions_regions_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(uper_regions_regions_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\xd8\x06\x02\x04\x07\xff\xab\xcd\x80\x08",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_regions_regions_a_decode(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded)), sizeof(encoded));
+    ASSERT_A(decoded);
+
+    /* Not enough space for the last members. */
+    ASSERT_EQ(uper_regions_regions_a_encode(&encoded[0],
+                                            9,
+                                            &decoded), -ENOMEM);
+    ASSERT_EQ(uper_regions_regions_a_decode(&decoded,
+                                            &encoded[0],
+                                            9), -EOUTOFDATA);
+}
+
+TEST(uper_regions_b)
+{
+    uint8_t encoded[9];
+    struct uper_regions_regions_b_t decoded;
+
+    FILL_B(decoded);
+    ASSERT_EQ(uper_regions_regions_b_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x5f\x42\x40\x1e\x24\x00\x00\x00\xc0",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_regions_regions_b_decode(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(decoded);
+
+    /* Members are decoded one by one when only some are selected. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_regions_regions_b_decode_fields(
+                  &decoded,
+                  &encoded[0],
+                  sizeof(encoded),
+                  UPER_REGIONS_REGIONS_B_FIELD_D), sizeof(encoded));
+    ASSERT_EQ(decoded.c, 0);
+    ASSERT_EQ(decoded.d, 123456);
+    ASSERT_EQ(decoded.e, 0);
+}
+
+TEST(per_regions_a)
+{
+    uint8_t encoded[12];
+    struct per_regions_regions_a_t decoded;
+
+    FILL_A(decoded);
+    ASSERT_EQ(per_regions_regions_a_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\xd8\x06\x01\x02\x03\xff\xd5\xe6\xc0\x00\x00\x80",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_regions_regions_a_decode(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded)), sizeof(encoded));
+    ASSERT_A(decoded);
+}
+
+TEST(per_regions_b)
+{
+    uint8_t encoded[11];
+    struct per_regions_regions_b_t decoded;
+
+    FILL_B(decoded);
+    ASSERT_EQ(per_regions_regions_b_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x58\x0f\x42\x40\x80\x01\xe2\x40\x00\x00\xc0",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(per_regions_regions_b_decode(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded)), sizeof(encoded));
+    ASSERT_B(decoded);
+}
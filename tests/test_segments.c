@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "oer_segments.h"
+
+static size_t join_segments(uint8_t *dst_p,
+                            const struct iovec *iov_p,
+                            ssize_t iovcnt)
+{
+    size_t size;
+    ssize_t i;
+
+    size = 0;
+
+    for (i = 0; i < iovcnt; i++) {
+        memcpy(&dst_p[size], iov_p[i].iov_base, iov_p[i].iov_len);
+        size += iov_p[i].iov_len;
+    }
+
+    return (size);
+}
+
+static void init_a(struct oer_segments_segments_a_t *decoded_p)
+{
+    memset(decoded_p, 0, sizeof(*decoded_p));
+    decoded_p->id = 0x1234;
+    memset(&decoded_p->header.buf[0], 0x11, 4);
+    decoded_p->body.length = 200;
+    memset(&decoded_p->body.buf[0], 0x22, 200);
+    memset(&decoded_p->digest.buf[0], 0x33, 64);
+    decoded_p->name.length = 3;
+    memcpy(&decoded_p->name.buf[0], "foo", 3);
+    decoded_p->is_trailer_present = true;
+    decoded_p->trailer.length = 2;
+    memset(&decoded_p->trailer.buf[0], 0x44, 2);
+}
+
+TEST(oer_segments_a)
+{
+    uint8_t encoded[512];
+    uint8_t joined[512];
+    uint8_t scratch[32];
+    struct iovec iov[8];
+    struct oer_segments_segments_a_t decoded;
+    ssize_t size;
+
+    init_a(&decoded);
+    size = oer_segments_segments_a_encode(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded);
+    ASSERT_EQ(size, 280);
+
+    /* The body and the digest are referenced, everything else is in
+       the scratch buffer. */
+    ASSERT_EQ(oer_segments_segments_a_encode_iovec(&iov[0],
+                                                   8,
+                                                   &scratch[0],
+                                                   sizeof(scratch),
+                                                   &decoded), 4);
+    ASSERT_EQ(iov[0].iov_base, &scratch[0]);
+    ASSERT_EQ(iov[0].iov_len, 9);
+    ASSERT_EQ(iov[1].iov_base, &decoded.body.buf[0]);
+    ASSERT_EQ(iov[1].iov_len, 200);
+    ASSERT_EQ(iov[2].iov_base, &decoded.digest.buf[0]);
+    ASSERT_EQ(iov[2].iov_len, 64);
+    ASSERT_EQ(iov[3].iov_base, &scratch[9]);
+    ASSERT_EQ(iov[3].iov_len, 7);
+    ASSERT_EQ(join_segments(&joined[0], &iov[0], 4), 280);
+    ASSERT_MEMORY_EQ(&joined[0], &encoded[0], 280);
+
+    /* Too few segments. */
+    ASSERT_EQ(oer_segments_segments_a_encode_iovec(&iov[0],
+                                                   3,
+                                                   &scratch[0],
+                                                   sizeof(scratch),
+                                                   &decoded), -ENOMEM);
+
+    /* Too small scratch buffer. */
+    ASSERT_EQ(oer_segments_segments_a_encode_iovec(&iov[0],
+                                                   8,
+                                                   &scratch[0],
+                                                   15,
+                                                   &decoded), -ENOMEM);
+}
+
+TEST(oer_segments_a_small)
+{
+    uint8_t encoded[512];
+    uint8_t scratch[512];
+    struct iovec iov[8];
+    struct oer_segments_segments_a_t decoded;
+    ssize_t size;
+
+    /* Values smaller than the minimum reference size are copied. */
+    init_a(&decoded);
+    decoded.body.length = 63;
+    size = oer_segments_segments_a_encode(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded);
+    ASSERT_EQ(size, 142);
+    ASSERT_EQ(oer_segments_segments_a_encode_iovec(&iov[0],
+                                                   8,
+                                                   &scratch[0],
+                                                   sizeof(scratch),
+                                                   &decoded), 3);
+    ASSERT_EQ(iov[0].iov_len, 71);
+    ASSERT_EQ(iov[1].iov_base, &decoded.digest.buf[0]);
+    ASSERT_EQ(iov[2].iov_len, 7);
+    ASSERT_MEMORY_EQ(iov[0].iov_base, &encoded[0], 71);
+    ASSERT_MEMORY_EQ(iov[2].iov_base, &encoded[135], 7);
+}
+
+TEST(oer_segments_b)
+{
+    uint8_t encoded[2048];
+    uint8_t joined[2048];
+    uint8_t scratch[64];
+    uint8_t payload[1000];
+    struct iovec iov[8];
+    struct oer_segments_segments_b_t decoded;
+    ssize_t iovcnt;
+    ssize_t size;
+
+    memset(&payload[0], 0x55, sizeof(payload));
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.messages.length = 2;
+    decoded.messages.elements[0].length = 100;
+    memset(&decoded.messages.elements[0].buf[0], 0x66, 100);
+    decoded.messages.elements[1].length = 10;
+    memset(&decoded.messages.elements[1].buf[0], 0x77, 10);
+    decoded.payload.buf = &payload[0];
+    decoded.payload.length = sizeof(payload);
+
+    size = oer_segments_segments_b_encode(&encoded[0],
+                                          sizeof(encoded),
+                                          &decoded);
+    ASSERT_EQ(size, 1117);
+
+    iovcnt = oer_segments_segments_b_encode_iovec(&iov[0],
+                                                  8,
+                                                  &scratch[0],
+                                                  sizeof(scratch),
+                                                  &decoded);
+    ASSERT_EQ(iovcnt, 4);
+    ASSERT_EQ(iov[0].iov_len, 3);
+    ASSERT_EQ(iov[1].iov_base, &decoded.messages.elements[0].buf[0]);
+    ASSERT_EQ(iov[1].iov_len, 100);
+    ASSERT_EQ(iov[2].iov_len, 14);
+    ASSERT_EQ(iov[3].iov_base, &payload[0]);
+    ASSERT_EQ(iov[3].iov_len, 1000);
+    ASSERT_EQ(join_segments(&joined[0], &iov[0], iovcnt), 1117);
+    ASSERT_MEMORY_EQ(&joined[0], &encoded[0], 1117);
+
+    /* Decode the joined segments. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(oer_segments_segments_b_decode(&decoded,
+                                             &joined[0],
+                                             1117), 1117);
+    ASSERT_EQ(decoded.messages.length, 2);
+    ASSERT_EQ(decoded.messages.elements[0].length, 100);
+    ASSERT_EQ(decoded.messages.elements[1].length, 10);
+    ASSERT_EQ(decoded.payload.length, 1000);
+    ASSERT_MEMORY_EQ(decoded.payload.buf, &payload[0], 1000);
+}
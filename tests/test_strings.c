@@ -0,0 +1,299 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "nala.h"
+
+#include "uper_strings.h"
+#include "per_strings.h"
+#include "oer_strings.h"
+
+#define FILL_A(decoded_p)                                       \
+    do {                                                        \
+        memset((decoded_p), 0, sizeof(*(decoded_p)));           \
+        (decoded_p)->a.length = 5;                              \
+        strcpy(&(decoded_p)->a.buf[0], "Hello");                \
+        strcpy(&(decoded_p)->b.buf[0], "01234");                \
+        (decoded_p)->c.length = 7;                              \
+        strcpy(&(decoded_p)->c.buf[0], "Foo Bar");              \
+        strcpy(&(decoded_p)->d.buf[0], "~!");                   \
+        (decoded_p)->e.length = 6;                              \
+        strcpy(&(decoded_p)->e.buf[0], "c0ffee");               \
+        strcpy(&(decoded_p)->f.buf[0], "GATTACAGATTA");         \
+        (decoded_p)->is_g_present = true;                       \
+        (decoded_p)->g.length = 0;                              \
+        (decoded_p)->h.length = 3;                              \
+        strcpy(&(decoded_p)->h.buf[0], "xyz");                  \
+    } while (0)
+
+#define ASSERT_A(decoded_p)                                     \
+    do {                                                        \
+        ASSERT_EQ((decoded_p)->a.length, 5);                    \
+        ASSERT_EQ(&(decoded_p)->a.buf[0], "Hello");             \
+        ASSERT_EQ(&(decoded_p)->b.buf[0], "01234");             \
+        ASSERT_EQ((decoded_p)->c.length, 7);                    \
+        ASSERT_EQ(&(decoded_p)->c.buf[0], "Foo Bar");           \
+        ASSERT_EQ(&(decoded_p)->d.buf[0], "~!");                \
+        ASSERT_EQ((decoded_p)->e.length, 6);                    \
+        ASSERT_EQ(&(decoded_p)->e.buf[0], "c0ffee");            \
+        ASSERT_EQ(&(decoded_p)->f.buf[0], "GATTACAGATTA");      \
+        ASSERT_TRUE((decoded_p)->is_g_present);                 \
+        ASSERT_EQ((decoded_p)->g.length, 0);                    \
+        ASSERT_EQ(&(decoded_p)->g.buf[0], "");                  \
+        ASSERT_EQ((decoded_p)->h.length, 3);                    \
+        ASSERT_EQ(&(decoded_p)->h.buf[0], "xyz");               \
+    } while (0)
+
+TEST(uper_strings_a)
+{
+    uint8_t encoded[27];
+    struct uper_strings_strings_a_t decoded;
+
+    /* Encode. */
+    FILL_A(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_strings_strings_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(uper_strings_strings_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\xd2\x46\x5d\x9b\x37\x89\x1a\x29\xe3\x6f\xde\x82\x16\x1e"
+                     "\x5f\x90\xb6\x07\xff\x74\x78\x91\xe0\x02\xf1\xe7\xd0",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0xff, sizeof(decoded));
+    ASSERT_EQ(uper_strings_strings_a_decode(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded)), sizeof(encoded));
+    ASSERT_A(&decoded);
+
+    /* Skip. */
+    ASSERT_EQ(uper_strings_strings_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(uper_strings_a_default)
+{
+    uint8_t encoded[23];
+    struct uper_strings_strings_a_t decoded;
+
+    FILL_A(&decoded);
+    decoded.is_g_present = false;
+    strcpy(&decoded.h.buf[0], "abc");
+
+    ASSERT_EQ(uper_strings_strings_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\x12\x46\x5d\x9b\x37\x89\x1a\x29\xe3\x6f\xde\x82\x16\x1e"
+                     "\x5f\x90\xb6\x07\xff\x74\x78\x91\xe0",
+                     sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_strings_strings_a_decode(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded)), sizeof(encoded));
+    ASSERT_FALSE(decoded.is_g_present);
+    ASSERT_EQ(decoded.h.length, 3);
+    ASSERT_EQ(&decoded.h.buf[0], "abc");
+}
+
+TEST(uper_strings_a_encode_error_bad_char)
+{
+    uint8_t encoded[27];
+    struct uper_strings_strings_a_t decoded;
+
+    /* Not a digit. */
+    FILL_A(&decoded);
+    decoded.b.buf[2] = 'x';
+
+    ASSERT_EQ(uper_strings_strings_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), -EBADCHAR);
+
+    /* Not in FROM ("ACGT"). */
+    FILL_A(&decoded);
+    decoded.f.buf[11] = 'U';
+
+    ASSERT_EQ(uper_strings_strings_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), -EBADCHAR);
+
+    /* Not IA5. */
+    FILL_A(&decoded);
+    decoded.a.buf[0] = (char)0x80;
+
+    ASSERT_EQ(uper_strings_strings_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), -EBADCHAR);
+
+    /* Also when only calculating the size. */
+    ASSERT_EQ(uper_strings_strings_a_encoded_size(&decoded), -EBADCHAR);
+}
+
+TEST(uper_strings_a_long_string)
+{
+    uint8_t encoded[UPER_STRINGS_STRINGS_A_MAX_ENCODED_SIZE];
+    struct uper_strings_strings_a_t decoded;
+    char expected[301];
+    ssize_t size;
+    int i;
+
+    for (i = 0; i < 300; i++) {
+        expected[i] = (char)(' ' + (i % 95));
+    }
+
+    expected[300] = '\0';
+
+    FILL_A(&decoded);
+    decoded.g.length = 300;
+    strcpy(&decoded.g.buf[0], &expected[0]);
+
+    size = uper_strings_strings_a_encode(&encoded[0],
+                                         sizeof(encoded),
+                                         &decoded);
+    ASSERT_EQ(size, 290);
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_strings_strings_a_decode(&decoded,
+                                            &encoded[0],
+                                            (size_t)size), size);
+    ASSERT_EQ(decoded.g.length, 300);
+    ASSERT_EQ(&decoded.g.buf[0], &expected[0]);
+
+    /* Invalid character in the last chunk. */
+    decoded.g.buf[299] = '\n';
+
+    ASSERT_EQ(uper_strings_strings_a_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), -EBADCHAR);
+}
+
+TEST(uper_strings_d)
+{
+    uint8_t encoded[2];
+    struct uper_strings_strings_d_t decoded;
+
+    decoded.choice = uper_strings_strings_d_choice_a_e;
+    decoded.value.a.length = 3;
+    strcpy(&decoded.value.a.buf[0], "123");
+
+    ASSERT_EQ(uper_strings_strings_d_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x44\x68", sizeof(encoded));
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_strings_strings_d_decode(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded)), sizeof(encoded));
+    ASSERT_EQ(decoded.choice, uper_strings_strings_d_choice_a_e);
+    ASSERT_EQ(decoded.value.a.length, 3);
+    ASSERT_EQ(&decoded.value.a.buf[0], "123");
+}
+
+TEST(uper_strings_d_decode_error_bad_char)
+{
+    struct uper_strings_strings_d_t decoded;
+
+    /* Index 15 is not in the NumericString alphabet. */
+    ASSERT_EQ(uper_strings_strings_d_decode(&decoded,
+                                            (const uint8_t *)"\x5e\x68",
+                                            2), -EBADCHAR);
+    ASSERT_EQ(uper_strings_strings_d_skip((const uint8_t *)"\x5e\x68", 2),
+              -EBADCHAR);
+}
+
+TEST(uper_strings_e_single_character_alphabet)
+{
+    uint8_t encoded[1];
+    struct uper_strings_strings_e_t decoded;
+
+    strcpy(&decoded.buf[0], "xxx");
+
+    ASSERT_EQ(uper_strings_strings_e_encode(&encoded[0],
+                                            sizeof(encoded),
+                                            &decoded), 0);
+
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_strings_strings_e_decode(&decoded, &encoded[0], 0), 0);
+    ASSERT_EQ(&decoded.buf[0], "xxx");
+}
+
+TEST(uper_strings_b_encode_jer)
+{
+    uint8_t encoded[11];
+    struct uper_strings_strings_b_t decoded;
+
+    decoded.length = 5;
+    strcpy(&decoded.buf[0], "a\"\\\n\t");
+
+    ASSERT_EQ(uper_strings_strings_b_encode_jer(&encoded[0],
+                                                sizeof(encoded),
+                                                &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\"a\\\"\\\\\\n\\t\"", sizeof(encoded));
+}
+
+TEST(per_strings_a)
+{
+    uint8_t encoded[32];
+    struct per_strings_strings_a_t decoded;
+
+    /* Encode. */
+    FILL_A(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(per_strings_strings_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(per_strings_strings_a_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\xd0\x48\x65\x6c\x6c\x6f\x12\x34\x53\x80\x46\x6f\x6f\x20"
+                     "\x42\x61\x72\x7e\x21\x60\xc0\xff\xee\x8f\x12\x3c\x00\x00"
+                     "\x80\x78\x79\x7a",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0xff, sizeof(decoded));
+    ASSERT_EQ(per_strings_strings_a_decode(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded)), sizeof(encoded));
+    ASSERT_A(&decoded);
+
+    /* Skip. */
+    ASSERT_EQ(per_strings_strings_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
+
+TEST(oer_strings_a)
+{
+    uint8_t encoded[46];
+    struct oer_strings_strings_a_t decoded;
+
+    /* Encode. */
+    FILL_A(&decoded);
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(oer_strings_strings_a_encoded_size(&decoded), sizeof(encoded));
+    ASSERT_EQ(oer_strings_strings_a_encode(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0],
+                     "\xc0\x05\x48\x65\x6c\x6c\x6f\x30\x31\x32\x33\x34\x07\x46"
+                     "\x6f\x6f\x20\x42\x61\x72\x7e\x21\x06\x63\x30\x66\x66\x65"
+                     "\x65\x47\x41\x54\x54\x41\x43\x41\x47\x41\x54\x54\x41\x00"
+                     "\x03\x78\x79\x7a",
+                     sizeof(encoded));
+
+    /* Decode. */
+    memset(&decoded, 0xff, sizeof(decoded));
+    ASSERT_EQ(oer_strings_strings_a_decode(&decoded,
+                                           &encoded[0],
+                                           sizeof(encoded)), sizeof(encoded));
+    ASSERT_A(&decoded);
+
+    /* Skip. */
+    ASSERT_EQ(oer_strings_strings_a_skip(&encoded[0], sizeof(encoded)),
+              sizeof(encoded));
+}
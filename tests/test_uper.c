@@ -7,6 +7,7 @@
 #include "uper.h"
 #include "boolean_uper.h"
 #include "octet_string_uper.h"
+#include "uper_arena.h"
 
 #define membersof(a) (sizeof(a) / (sizeof((a)[0])))
 
@@ -36,6 +37,7 @@ TEST(uper_c_source_a)
                      "\x01\x00\x02\x00\x00\x00\x03\x00\x00\x00\x00\x00\x00\x00\x04"
                      "\x82\x82\x82\x82\x82\x82\x82\x82\x82\x82\x82\x80",
                      sizeof(encoded));
+    ASSERT_EQ(uper_c_source_a_encode(NULL, 0, &decoded), -ENOMEM);
 
     /* Decode. */
     memset(&decoded, 0, sizeof(decoded));
@@ -177,6 +179,95 @@ TEST(uper_c_source_b_decode_error_bad_choice)
                                      sizeof(encoded)), -EBADCHOICE);
 }
 
+TEST(uper_c_source_b_encoded_size_error_bad_choice)
+{
+    struct uper_c_source_b_t decoded;
+
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.choice = 10;
+
+    ASSERT_EQ(uper_c_source_b_encoded_size(&decoded), -EBADCHOICE);
+}
+
+TEST(uper_c_source_b_skip_error_bad_choice)
+{
+    uint8_t encoded[2] = "\xdd\x80";
+
+    ASSERT_EQ(uper_c_source_b_skip(&encoded[0], sizeof(encoded)), -EBADCHOICE);
+}
+
+TEST(uper_c_source_b_batch)
+{
+    uint8_t encoded[5];
+    struct uper_c_source_b_t decoded[3];
+    size_t offsets[3];
+
+    /* Encode. */
+    decoded[0].choice = uper_c_source_b_choice_a_e;
+    decoded[0].value.a = -1;
+    decoded[1].choice = uper_c_source_b_choice_c_e;
+    decoded[2].choice = uper_c_source_b_choice_a_e;
+    decoded[2].value.a = 5;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_c_source_b_encode_batch(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded[0],
+                                           3,
+                                           &offsets[0]), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded[0], "\x1f\xc0\x80\x21\x40", sizeof(encoded));
+    ASSERT_EQ(offsets[0], 0);
+    ASSERT_EQ(offsets[1], 2);
+    ASSERT_EQ(offsets[2], 3);
+
+    /* Decode. */
+    memset(&decoded[0], 0, sizeof(decoded));
+    memset(&offsets[0], 0, sizeof(offsets));
+    ASSERT_EQ(uper_c_source_b_decode_batch(&decoded[0],
+                                           3,
+                                           &encoded[0],
+                                           sizeof(encoded),
+                                           &offsets[0]), sizeof(encoded));
+
+    ASSERT_EQ(decoded[0].choice, uper_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded[0].value.a, -1);
+    ASSERT_EQ(decoded[1].choice, uper_c_source_b_choice_c_e);
+    ASSERT_EQ(decoded[2].choice, uper_c_source_b_choice_a_e);
+    ASSERT_EQ(decoded[2].value.a, 5);
+    ASSERT_EQ(offsets[0], 0);
+    ASSERT_EQ(offsets[1], 2);
+    ASSERT_EQ(offsets[2], 3);
+}
+
+TEST(uper_c_source_b_batch_error_out_of_data)
+{
+    uint8_t encoded[4];
+    struct uper_c_source_b_t decoded[3];
+    size_t offsets[3];
+
+    decoded[0].choice = uper_c_source_b_choice_a_e;
+    decoded[0].value.a = -1;
+    decoded[1].choice = uper_c_source_b_choice_c_e;
+    decoded[2].choice = uper_c_source_b_choice_a_e;
+    decoded[2].value.a = 5;
+
+    /* The last value does not fit. */
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_c_source_b_encode_batch(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded[0],
+                                           3,
+                                           &offsets[0]), -ENOMEM);
+
+    /* The encoded data ends in the middle of the last value. */
+    memcpy(&encoded[0], "\x1f\xc0\x80\x21", sizeof(encoded));
+    ASSERT_EQ(uper_c_source_b_decode_batch(&decoded[0],
+                                           3,
+                                           &encoded[0],
+                                           sizeof(encoded),
+                                           &offsets[0]), -EOUTOFDATA);
+}
+
 TEST(uper_c_source_c_empty)
 {
     uint8_t encoded[1];
@@ -488,6 +579,120 @@ TEST(uper_c_source_h)
                                      sizeof(encoded)), 0);
 }
 
+TEST(uper_c_source_l_maximum_and_encoded_size)
+{
+    struct data_t {
+        uint16_t data_length;
+        ssize_t encoded_length;
+    } datas[] = {
+        { .data_length = 0, .encoded_length = 2 },
+        { .data_length = 1, .encoded_length = 3 },
+        { .data_length = 499, .encoded_length = 501 },
+        { .data_length = 500, .encoded_length = 502 }
+    };
+    uint8_t encoded[UPER_C_SOURCE_L_MAX_ENCODED_SIZE];
+    struct uper_c_source_l_t decoded;
+    unsigned int i;
+
+    ASSERT_EQ(UPER_C_SOURCE_L_MAX_ENCODED_SIZE, 502);
+
+    for (i = 0; i < membersof(datas); i++) {
+        decoded.length = datas[i].data_length;
+        memset(&decoded.buf[0], 0xa5, decoded.length);
+
+        ASSERT_EQ(uper_c_source_l_encoded_size(&decoded),
+                  datas[i].encoded_length);
+        ASSERT_EQ(uper_c_source_l_encode(&encoded[0],
+                                         sizeof(encoded),
+                                         &decoded), datas[i].encoded_length);
+    }
+}
+
+TEST(uper_c_source_n_fields)
+{
+    uint8_t encoded[43];
+    struct uper_c_source_n_t decoded;
+
+    /* Encode. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.a.value = uper_c_source_k_a_e;
+    decoded.b.a = -1;
+    decoded.b.h = 4;
+    decoded.b.i = true;
+    memset(&decoded.b.j.buf[0], 5, sizeof(decoded.b.j.buf));
+    decoded.c.length = 3;
+    decoded.c.elements[0] = true;
+    decoded.c.elements[1] = false;
+    decoded.c.elements[2] = true;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_c_source_n_encode(&encoded[0],
+                                     sizeof(encoded),
+                                     &decoded), sizeof(encoded));
+
+    /* Decode only b, skipping over a and c. */
+    memset(&decoded, 0, sizeof(decoded));
+    decoded.c.length = 100;
+    ASSERT_EQ(uper_c_source_n_decode_fields(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded),
+                                            UPER_C_SOURCE_N_FIELD_B), sizeof(encoded));
+
+    ASSERT_EQ(decoded.b.a, -1);
+    ASSERT_EQ(decoded.b.h, 4);
+    ASSERT_TRUE(decoded.b.i);
+    ASSERT_MEMORY_EQ(&decoded.b.j.buf[0],
+                     "\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05\x05",
+                     sizeof(decoded.b.j.buf));
+    ASSERT_EQ(decoded.c.length, 100);
+
+    /* Decode only c, skipping over a and b. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_c_source_n_decode_fields(&decoded,
+                                            &encoded[0],
+                                            sizeof(encoded),
+                                            UPER_C_SOURCE_N_FIELD_C), sizeof(encoded));
+
+    ASSERT_EQ(decoded.b.h, 0);
+    ASSERT_EQ(decoded.c.length, 3);
+    ASSERT_TRUE(decoded.c.elements[0]);
+    ASSERT_FALSE(decoded.c.elements[1]);
+    ASSERT_TRUE(decoded.c.elements[2]);
+
+    /* Skipped data must also be present. */
+    ASSERT_EQ(uper_c_source_n_decode_fields(&decoded,
+                                            &encoded[0],
+                                            42,
+                                            UPER_C_SOURCE_N_FIELD_A), -EOUTOFDATA);
+}
+
+TEST(uper_c_source_n_skip_records)
+{
+    uint8_t encoded[86];
+    struct uper_c_source_n_t decoded[2];
+    size_t offsets[2];
+
+    /* Encode two records after each other. */
+    memset(&decoded[0], 0, sizeof(decoded));
+    decoded[0].c.length = 3;
+    decoded[1].c.length = 1;
+
+    memset(&encoded[0], 0, sizeof(encoded));
+    ASSERT_EQ(uper_c_source_n_encode_batch(&encoded[0],
+                                           sizeof(encoded),
+                                           &decoded[0],
+                                           2,
+                                           &offsets[0]), sizeof(encoded));
+    ASSERT_EQ(offsets[1], 43);
+
+    /* Find the end of each record without decoding it. */
+    ASSERT_EQ(uper_c_source_n_skip(&encoded[0], sizeof(encoded)), 43);
+    ASSERT_EQ(uper_c_source_n_skip(&encoded[43], sizeof(encoded) - 43),
+              sizeof(encoded) - 43);
+    ASSERT_EQ(uper_c_source_n_skip(&encoded[43], sizeof(encoded) - 43 - 1),
+              -EOUTOFDATA);
+}
+
 TEST(uper_c_source_q_c256)
 {
     uint8_t encoded[2];
@@ -1170,3 +1375,135 @@ TEST(uper_c_source_ar)
     ASSERT_EQ(decoded.a.buf[1], 0xCD);
     ASSERT_EQ(decoded.a.buf[2], 0xEF);
 }
+
+TEST(uper_arena_a)
+{
+    uint8_t encoded[8] = "\x00\xc0\x00\x40\x00\x80\x00\xc0";
+    uint8_t encoded2[8];
+    uint8_t arena_buf[64];
+    struct uper_arena_arena_t arena;
+    struct uper_arena_arena_a_t decoded;
+
+    arena.buf = &arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    /* Decode. The elements are allocated from the arena. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_arena_arena_a_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded),
+                                        &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, 3);
+    ASSERT_EQ((uint8_t *)decoded.elements, &arena_buf[0]);
+    ASSERT_EQ(decoded.elements[0], 1);
+    ASSERT_EQ(decoded.elements[1], 2);
+    ASSERT_EQ(decoded.elements[2], 3);
+    ASSERT_EQ(arena.pos, 3 * sizeof(decoded.elements[0]));
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_arena_arena_a_encode(&encoded2[0],
+                                        sizeof(encoded2),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+
+    /* Decode again after resetting the arena. */
+    arena.pos = 0;
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_arena_arena_a_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded),
+                                        &arena), sizeof(encoded));
+
+    ASSERT_EQ((uint8_t *)decoded.elements, &arena_buf[0]);
+}
+
+TEST(uper_arena_a_decode_error_out_of_memory)
+{
+    uint8_t encoded[8] = "\x00\xc0\x00\x40\x00\x80\x00\xc0";
+    uint8_t arena_buf[4];
+    struct uper_arena_arena_t arena;
+    struct uper_arena_arena_a_t decoded;
+
+    arena.buf = &arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    ASSERT_EQ(uper_arena_arena_a_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded),
+                                        &arena), -ENOMEM);
+}
+
+TEST(uper_arena_b)
+{
+    uint8_t encoded[7] = "\xc4\x44\x02\x44\x01\x01\x05";
+    uint8_t encoded2[7];
+    uint64_t arena_buf[2];
+    struct uper_arena_arena_t arena;
+    struct uper_arena_arena_b_t decoded;
+
+    arena.buf = (uint8_t *)&arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    /* Decode. b and c are allocated from the arena, 8 bytes aligned. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_arena_arena_b_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded),
+                                        &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.a.length, 1);
+    ASSERT_EQ(decoded.a.buf[0], 0x11);
+    ASSERT_TRUE(decoded.is_b_present);
+    ASSERT_EQ(decoded.b.length, 1);
+    ASSERT_EQ(decoded.b.buf, arena.buf);
+    ASSERT_EQ(decoded.b.buf[0], 0x22);
+    ASSERT_EQ(decoded.c.length, 1);
+    ASSERT_EQ(decoded.c.buf, &arena.buf[8]);
+    ASSERT_EQ(decoded.c.buf[0], 0x01);
+    ASSERT_EQ(decoded.d, 5);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_arena_arena_b_encode(&encoded2[0],
+                                        sizeof(encoded2),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}
+
+TEST(uper_arena_d)
+{
+    uint8_t encoded[4] = "\x01\x82\x11\x22";
+    uint8_t encoded2[4];
+    uint64_t arena_buf[8];
+    struct uper_arena_arena_t arena;
+    struct uper_arena_arena_d_t decoded;
+
+    arena.buf = (uint8_t *)&arena_buf[0];
+    arena.size = sizeof(arena_buf);
+    arena.pos = 0;
+
+    /* Decode. The OCTET STRING follows the elements in the arena. */
+    memset(&decoded, 0, sizeof(decoded));
+    ASSERT_EQ(uper_arena_arena_d_decode(&decoded,
+                                        &encoded[0],
+                                        sizeof(encoded),
+                                        &arena), sizeof(encoded));
+
+    ASSERT_EQ(decoded.length, 1);
+    ASSERT_TRUE(decoded.elements[0].a);
+    ASSERT_EQ(decoded.elements[0].b.length, 2);
+    ASSERT_EQ(decoded.elements[0].b.buf, (const uint8_t *)&decoded.elements[1]);
+    ASSERT_MEMORY_EQ(decoded.elements[0].b.buf, "\x11\x22", 2);
+
+    /* Encode. */
+    memset(&encoded2[0], 0, sizeof(encoded2));
+    ASSERT_EQ(uper_arena_arena_d_encode(&encoded2[0],
+                                        sizeof(encoded2),
+                                        &decoded), sizeof(encoded));
+    ASSERT_MEMORY_EQ(&encoded2[0], &encoded[0], sizeof(encoded));
+}